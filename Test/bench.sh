@@ -0,0 +1,49 @@
+#!/bin/bash
+#
+# compile time benchmarks; these are not part of the tests, run them
+# with "make bench" and compare the times before and after a change
+#
+
+if [ "$1" != "" ]; then
+  PROG=$1
+else
+  PROG=../build/flexspin
+fi
+TIMEFORMAT="%R s"
+if [ "x$CC" = "x" ]; then
+  CC=cc
+fi
+
+rm -rf bench.out
+mkdir bench.out
+
+#
+# long lists: a DAT line with N items is parsed as a list that grows one
+# item at a time, so it shows whether appending to a list is O(1)
+# (the times should go up about 2x with each line, not 4x)
+#
+for n in 25000 50000 100000 200000
+do
+  awk -v n=$n 'BEGIN { printf "DAT\n  byte 0"; for (i = 1; i < n; i++) printf ",%d", i % 256; printf "\n" }' > bench.out/list$n.spin2
+  echo -n "list of $n items: "
+  time $PROG -2 -O0 -q -o bench.out/list$n.binary bench.out/list$n.spin2 || exit 1
+done
+
+#
+# -O2 compiles of programs whose functions (mostly from the BASIC
+# runtime) ask the register reuse optimization many liveness questions
+#
+for f in basexec03 basexec07
+do
+  echo -n "$f at -O2: "
+  time $PROG -2 -O2 -q -o bench.out/$f.binary $f.bas || exit 1
+done
+
+#
+# buffer growth: build a 50 MB Flexbuf a line at a time, growing it by
+# a fixed step and by doubling
+#
+$CC -O1 -I../util -o bench.out/flexbench bench/flexbench.c ../util/flexbuf.c ../util/dofmt.c ../util/lltoa_prec.c ../util/strupr.c ../util/strrev.c -lm || exit 1
+./bench.out/flexbench || exit 1
+
+rm -rf bench.out
@@ -0,0 +1,98 @@
+//
+// benchmark of buffer growth: append short lines to a buffer until it
+// holds 50 MB, once growing the buffer by a fixed step (as Flexbuf
+// used to) and once with Flexbuf itself, which doubles it
+//
+// besides the time, print how many times the buffer was reallocated
+// and how many bytes those reallocs would have to copy if the block
+// could not be grown in place; glibc can often extend a block (or
+// remap it), which hides most of the copying, but other allocators
+// copy every time
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "flexbuf.h"
+
+#define TOTAL_BYTES (50*1024*1024)
+#define GROWSIZE    512   /* what doIRAssemble uses */
+
+static const char line[] = "\tmov\tresult1, arg01\n";
+
+static double now(void)
+{
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+// the old fixed step growth
+struct fixedbuf {
+    char *data;
+    size_t len;
+    size_t space;
+};
+
+static void fixed_addmem(struct fixedbuf *fb, const char *buf, size_t N)
+{
+    size_t newlen = fb->len + N;
+    if (newlen > fb->space) {
+        size_t newspace = fb->space + GROWSIZE;
+        if (newspace < newlen) {
+            newspace = newlen + GROWSIZE;
+        }
+        fb->data = realloc(fb->data, newspace);
+        if (!fb->data) {
+            printf("out of memory\n");
+            exit(1);
+        }
+        fb->space = newspace;
+    }
+    memcpy(fb->data + fb->len, buf, N);
+    fb->len = newlen;
+}
+
+static void report(const char *what, double t, long reallocs, double copied)
+{
+    printf("%-16s %8ld reallocs, %10.1f MB to copy, %.3f s\n", what, reallocs, copied / (1024*1024), t);
+}
+
+int main(void)
+{
+    struct fixedbuf fixed = { NULL, 0, 0 };
+    Flexbuf fb;
+    long reallocs;
+    double copied, t;
+    size_t space;
+
+    reallocs = 0;
+    copied = 0;
+    t = now();
+    while (fixed.len < TOTAL_BYTES) {
+        space = fixed.space;
+        fixed_addmem(&fixed, line, sizeof(line)-1);
+        if (fixed.space != space) {
+            reallocs++;
+            copied += fixed.len - (sizeof(line)-1);
+        }
+    }
+    report("fixed growth:", now() - t, reallocs, copied);
+    free(fixed.data);
+
+    reallocs = 0;
+    copied = 0;
+    t = now();
+    flexbuf_init(&fb, GROWSIZE);
+    while (flexbuf_curlen(&fb) < TOTAL_BYTES) {
+        space = fb.space;
+        if (!flexbuf_addmem(&fb, line, sizeof(line)-1)) {
+            printf("out of memory\n");
+            return 1;
+        }
+        if (fb.space != space) {
+            reallocs++;
+            copied += fb.len - (sizeof(line)-1);
+        }
+    }
+    report("doubling:", now() - t, reallocs, copied);
+    flexbuf_delete(&fb);
+    return 0;
+}
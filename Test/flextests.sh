@@ -0,0 +1,146 @@
+#!/bin/sh
+#
+# tests of flexspin command line options that change the generated code
+#
+
+if [ "$1" != "" ]; then
+  FASTSPIN=$1
+else
+  FASTSPIN=../build/flexspin
+fi
+
+PROG="$FASTSPIN -q -I../Lib"
+ok="ok"
+endmsg=$ok
+
+# compressed LMM code (-z1)
+# the LMM kernel does not assemble in this mode yet, so only the
+# generated assembly is checked
+for i in ztest*.spin
+do
+  j=`basename $i .spin`
+  $PROG -1 -z1 $i >/dev/null 2>&1
+  if  diff -ub Expect/$j.pasm $j.pasm
+  then
+      rm -f $j.pasm $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# listings (-l) of DAT sections with FILE includes
+for i in lsttest*.spin
+do
+  j=`basename $i .spin`
+  $PROG -1 -l --test-listing $i >/dev/null 2>&1
+  if  diff -ub Expect/$j.lst $j.lst
+  then
+      rm -f $j.lst $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# execution profiles (--profile-use): the loops chosen for fcache and
+# the calls chosen for inlining; where Expect has a .noprof.p2asm too,
+# the same program is also checked without the profile so the listings
+# show what the profile changed
+for i in proftest*.spin2
+do
+  j=`basename $i .spin2`
+  if [ -f Expect/$j.noprof.p2asm ]
+  then
+    $PROG -2 $i >/dev/null 2>&1
+    if  diff -ub Expect/$j.noprof.p2asm $j.p2asm
+    then
+        rm -f $j.p2asm $j.binary
+    else
+        echo $j failed without the profile
+        endmsg="TEST FAILURES"
+    fi
+  fi
+  $PROG -2 --profile-use=$j.prof $i >/dev/null 2>&1
+  if  diff -ub Expect/$j.p2asm $j.p2asm
+  then
+      rm -f $j.p2asm $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# cycle estimates (--cycle-report)
+for i in timetest*.spin2
+do
+  j=`basename $i .spin2`
+  $PROG -2 -O1,!inline-small,!inline-single --cycle-report $i >/dev/null 2>&1
+  if  diff -ub Expect/$j.cycles.json $j.cycles.json
+  then
+      rm -f $j.cycles.json $j.p2asm $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# on-disk IR cache (--cache-dir)
+# compile the same program with an empty cache, with a full one, after
+# changing one function, and after every entry has been replaced by
+# the contents of the next one (so all are stale); the code must not
+# change, and the cache statistics show what was found
+for i in irc*.spin
+do
+  j=`basename $i .spin`
+  rm -rf $j.dir $j.out
+  mkdir $j.dir
+  CACHE="$PROG -2 --stats --cache-dir=$j.dir"
+  $CACHE $i | grep "functions looked up" >> $j.out
+  mv $j.p2asm $j.first.p2asm
+  $CACHE $i | grep "functions looked up" >> $j.out
+  cmp -s $j.first.p2asm $j.p2asm || echo "cached code differs" >> $j.out
+  $CACHE -DCHANGED $i | grep "functions looked up" >> $j.out
+  mv $j.p2asm $j.changed.p2asm
+  $PROG -2 -DCHANGED $i
+  cmp -s $j.changed.p2asm $j.p2asm || echo "code for changed function differs" >> $j.out
+  prev=""
+  for k in $j.dir/*.fir
+  do
+    if [ "x$prev" = "x" ]
+    then
+      first=$k
+    else
+      cp $k $prev.new
+    fi
+    prev=$k
+  done
+  cp $first $prev.new
+  for k in $j.dir/*.fir
+  do
+    mv $k.new $k
+  done
+  $CACHE $i | grep "functions looked up" >> $j.out
+  cmp -s $j.first.p2asm $j.p2asm || echo "code from stale cache differs" >> $j.out
+  if  diff -ub Expect/$j.out $j.out
+  then
+      rm -rf $j.dir $j.out $j.p2asm $j.first.p2asm $j.changed.p2asm $j.binary
+      echo $j passed
+  else
+      echo $j failed
+      endmsg="TEST FAILURES"
+  fi
+done
+
+# clean up
+if [ "x$endmsg" = "x$ok" ]
+then
+  exit 0
+else
+  echo $endmsg
+  exit 1
+fi
@@ -0,0 +1,30 @@
+#!/bin/sh
+#
+# host stress test of the garbage collected heap in sys/gcalloc.spin:
+# the allocator is translated to C with spin2cpp and run on the host
+# by gcstress/gcstress.c
+#
+
+if [ "$1" != "" ]; then
+  SPIN2CPP=$1
+else
+  SPIN2CPP=../build/spin2cpp
+fi
+if [ "x$CC" = "x" ]; then
+  CC=cc
+fi
+
+rm -rf gcstress.out
+mkdir gcstress.out
+# the heap size is set by gcwrap.spin
+sed '/^ *__real_heapsize__ *=/d' ../sys/gcalloc.spin | cat gcstress/gcwrap.spin - > gcstress.out/gch.spin
+if $SPIN2CPP --p2 --ccode -o gcstress.out/gch gcstress.out/gch.spin \
+  && $CC -O1 -w -Igcstress -Igcstress.out -o gcstress.out/gcstress gcstress/gcstress.c gcstress.out/gch.c \
+  && ./gcstress.out/gcstress
+then
+  rm -rf gcstress.out
+  echo gcstress passed
+else
+  echo gcstress failed
+  exit 1
+fi
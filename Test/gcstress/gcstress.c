@@ -0,0 +1,234 @@
+//
+// host stress test of the garbage collected heap
+//
+// gcstress.sh translates sys/gcalloc.spin to C with spin2cpp; this
+// program then makes random allocations, frees and collections, and
+// checks after each step that:
+//   - the blocks cover the heap exactly and their prev fields are right
+//   - no two free blocks are next to each other
+//   - every free block is on the list for its size class, and the lists
+//     and the bitmap of non-empty lists agree
+//   - allocated memory is cleared and keeps its contents until freed
+//   - an allocation only fails if no free block is big enough
+//
+// The translated code keeps addresses in 32 bit integers, so the heap
+// has to be mapped at a low address; if that is not possible the test
+// is skipped.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "gch.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE 0
+#endif
+
+#define HEAP_BASE  ((void *)0x200000)
+#define HEAP_BYTES (GCH___REAL_HEAPSIZE__ * 4)
+#define NUM_PTRS   400
+#define NUM_STEPS  300000
+
+#define FREE_FLAGS (GCH_GC_MAGIC + GCH_GC_FLAG_FREE)
+
+static gch *g;
+
+static unsigned W(uint8_t *p, int off)
+{
+    return *(uint16_t *)(p + off);
+}
+
+static int sizeClass(unsigned pages)
+{
+    int bin = 31 - __builtin_clz(pages);
+    return bin > GCH_GC_LAST_BIN ? GCH_GC_LAST_BIN : bin;
+}
+
+static uint8_t *heapEnd(void)
+{
+    return (uint8_t *)g->heap + HEAP_BYTES - GCH_HEADERSIZE;
+}
+
+// pages in the free block that _gc_ptrs sets up
+static unsigned heapPages(void)
+{
+    return (HEAP_BYTES - GCH_HEADERSIZE - (GCH_ANCHORPAGES - 1) * GCH_PAGESIZE) / GCH_PAGESIZE;
+}
+
+static uint8_t *firstBlock(void)
+{
+    return (uint8_t *)g->heap + GCH_ANCHORPAGES * GCH_PAGESIZE;
+}
+
+static int checkHeap(void)
+{
+    uint8_t *base = (uint8_t *)g->heap;
+    uint8_t *p, *prev = NULL;
+    int nfree[GCH_GC_NUM_BINS] = { 0 };
+    unsigned total = 0;
+    int prevfree = 0;
+    int bin;
+
+    if (W(base, GCH_OFF_SIZE) != GCH_ANCHORPAGES) {
+        printf("block 0 has the wrong size\n");
+        return 0;
+    }
+    for (p = firstBlock(); p < heapEnd(); p += W(p, GCH_OFF_SIZE) * GCH_PAGESIZE) {
+        unsigned size = W(p, GCH_OFF_SIZE);
+        unsigned previdx = prev ? (prev - base) / GCH_PAGESIZE : 0;
+        int isfree = W(p, GCH_OFF_FLAGS) == FREE_FLAGS;
+        if (size == 0) {
+            printf("block of size 0\n");
+            return 0;
+        }
+        if ((W(p, GCH_OFF_FLAGS) & GCH_GC_MAGIC_MASK) != GCH_GC_MAGIC) {
+            printf("bad magic\n");
+            return 0;
+        }
+        if (W(p, GCH_OFF_PREV) != previdx) {
+            printf("bad prev field\n");
+            return 0;
+        }
+        if (isfree && prevfree) {
+            printf("free blocks were not merged\n");
+            return 0;
+        }
+        if (isfree) {
+            nfree[sizeClass(size)]++;
+        }
+        prevfree = isfree;
+        total += size;
+        prev = p;
+    }
+    if (total != heapPages()) {
+        printf("blocks do not cover the heap\n");
+        return 0;
+    }
+    for (bin = 0; bin < GCH_GC_NUM_BINS; bin++) {
+        unsigned idx = W(base, GCH_OFF_BINS + 2*bin);
+        unsigned previdx = 0;
+        int n = 0;
+        if (!!(W(base, GCH_OFF_BINMAP) & (1<<bin)) != !!idx) {
+            printf("bitmap is wrong for size class %d\n", bin);
+            return 0;
+        }
+        while (idx) {
+            uint8_t *q = base + idx * GCH_PAGESIZE;
+            if (W(q, GCH_OFF_FLAGS) != FREE_FLAGS) {
+                printf("used block on a free list\n");
+                return 0;
+            }
+            if (sizeClass(W(q, GCH_OFF_SIZE)) != bin) {
+                printf("block on the wrong free list\n");
+                return 0;
+            }
+            if (W(q, GCH_OFF_FREEPREV) != previdx) {
+                printf("bad free list back link\n");
+                return 0;
+            }
+            previdx = idx;
+            idx = W(q, GCH_OFF_LINK);
+            n++;
+        }
+        if (n != nfree[bin]) {
+            printf("free list %d holds %d blocks, heap has %d\n", bin, n, nfree[bin]);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// size in pages of the largest free block
+static unsigned maxFree(void)
+{
+    uint8_t *p;
+    unsigned m = 0;
+
+    for (p = firstBlock(); p < heapEnd(); p += W(p, GCH_OFF_SIZE) * GCH_PAGESIZE) {
+        if (W(p, GCH_OFF_FLAGS) == FREE_FLAGS && W(p, GCH_OFF_SIZE) > m) {
+            m = W(p, GCH_OFF_SIZE);
+        }
+    }
+    return m;
+}
+
+int main(void)
+{
+    static int32_t ptrs[NUM_PTRS], sizes[NUM_PTRS];
+    long step, allocs = 0, fails = 0;
+    int i, k;
+
+    g = mmap(HEAP_BASE, sizeof(*g), PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS|MAP_FIXED_NOREPLACE, -1, 0);
+    if (g == MAP_FAILED || (uintptr_t)g > 0x7fffffff) {
+        printf("unable to map the heap at a low address; test skipped\n");
+        return 0;
+    }
+    gch_init(g);
+    if (!checkHeap()) {
+        return 1;
+    }
+    srand(1);
+    for (step = 0; step < NUM_STEPS; step++) {
+        i = rand() % NUM_PTRS;
+        if (ptrs[i]) {
+            uint8_t *q = (uint8_t *)(intptr_t)ptrs[i];
+            for (k = 0; k < sizes[i]; k++) {
+                if (q[k] != (uint8_t)(i*7 + k)) {
+                    printf("step %ld: allocated memory was changed\n", step);
+                    return 1;
+                }
+            }
+            // leave some blocks for the collector to free
+            if (rand() % 4 == 0) {
+                gch_manage(g, ptrs[i]);
+            } else {
+                gch_free(g, ptrs[i]);
+            }
+            ptrs[i] = 0;
+        } else {
+            int size = (rand() % 8 == 0) ? rand() % 2000 + 1 : rand() % 60 + 1;
+            unsigned pages = (size + GCH_HEADERSIZE + GCH_PAGESIZE - 1) / GCH_PAGESIZE;
+            unsigned avail = maxFree();
+            int32_t r = gch_alloc(g, size);
+            allocs++;
+            if (!r) {
+                fails++;
+                if (avail >= pages) {
+                    printf("step %ld: allocation of %u pages failed with %u free\n", step, pages, avail);
+                    return 1;
+                }
+            } else {
+                uint8_t *q = (uint8_t *)(intptr_t)r;
+                for (k = 0; k < size; k++) {
+                    if (q[k]) {
+                        printf("step %ld: allocated memory was not cleared\n", step);
+                        return 1;
+                    }
+                    q[k] = (uint8_t)(i*7 + k);
+                }
+                ptrs[i] = r;
+                sizes[i] = size;
+            }
+        }
+        if (!checkHeap()) {
+            printf("at step %ld\n", step);
+            return 1;
+        }
+    }
+    for (i = 0; i < NUM_PTRS; i++) {
+        if (ptrs[i]) {
+            gch_free(g, ptrs[i]);
+        }
+    }
+    gch_collect(g);
+    if (!checkHeap()) {
+        return 1;
+    }
+    if (maxFree() != heapPages()) {
+        printf("heap did not merge back into one free block\n");
+        return 1;
+    }
+    printf("%ld allocations, %ld out of memory\n", allocs, fails);
+    return 0;
+}
@@ -0,0 +1,3 @@
+/* just enough of propeller2.h to build the translated allocator on the host */
+#include <stdint.h>
+#include <string.h>
@@ -0,0 +1,33 @@
+//
+// a header included again while its include guard is defined may be
+// skipped, but only if that cannot change what is compiled
+//
+
+// plain guards: the second copy must be left out
+#include "sub/guard1.hh"
+#include "sub/guard1.hh"
+#include "sub/guard2.hh"
+#include "sub/guard2.hh"
+
+// an #else at the guard level: the second copy produces guard3_again
+#include "sub/guard3.hh"
+#include "sub/guard3.hh"
+
+// text after the #endif: it is compiled every time
+#define GUARD4_TAIL guard4_tail1
+#include "sub/guard4.hh"
+#undef GUARD4_TAIL
+#define GUARD4_TAIL guard4_tail2
+#include "sub/guard4.hh"
+#undef GUARD4_TAIL
+#define GUARD4_TAIL guard4_tail3
+#include "sub/guard4.hh"
+
+// guard removed with #undef: the header must be read again
+#define GUARD5_NAME guard5_first
+#include "sub/guard5.hh"
+#include "sub/guard5.hh"
+#undef GUARD5_HH
+#undef GUARD5_NAME
+#define GUARD5_NAME guard5_again
+#include "sub/guard5.hh"
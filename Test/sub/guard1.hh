@@ -0,0 +1,4 @@
+#ifndef GUARD1_HH
+#define GUARD1_HH
+int guard1(void) { return 1; }
+#endif
@@ -0,0 +1,4 @@
+#if !defined(GUARD2_HH)
+#define GUARD2_HH
+int guard2(void) { return 2; }
+#endif
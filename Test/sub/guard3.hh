@@ -0,0 +1,6 @@
+#ifndef GUARD3_HH
+#define GUARD3_HH
+int guard3_first(void) { return 3; }
+#else
+int guard3_again(void) { return 33; }
+#endif
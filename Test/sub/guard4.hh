@@ -0,0 +1,5 @@
+#ifndef GUARD4_HH
+#define GUARD4_HH
+int guard4(void) { return 4; }
+#endif
+int GUARD4_TAIL(void) { return 44; }
@@ -0,0 +1,4 @@
+#ifndef GUARD5_HH
+#define GUARD5_HH
+int GUARD5_NAME(void) { return 5; }
+#endif
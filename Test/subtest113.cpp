@@ -0,0 +1,9 @@
+#define __SPIN2CPP__
+#include <propeller.h>
+#include "subtest113.h"
+
+int32_t subtest113::Get(void)
+{
+  return A;
+}
+
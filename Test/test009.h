@@ -0,0 +1,12 @@
+#ifndef test009_Class_Defined__
+#define test009_Class_Defined__
+
+#include <stdint.h>
+
+class test009 {
+public:
+  static void 	Init(void);
+private:
+};
+
+#endif
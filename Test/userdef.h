@@ -0,0 +1,13 @@
+#ifndef userdef_Class_Defined__
+#define userdef_Class_Defined__
+
+#include <stdint.h>
+
+class userdef {
+public:
+  static const int Ticks = 100;
+  static void 	Start(void);
+private:
+};
+
+#endif
@@ -10,16 +10,15 @@
 static LexStream *s_reportas_lexdata;
 static int s_reportas_lineidx;
 
+/* AST nodes are never freed individually, so carve them out of an arena */
+Arena ast_arena = { "ast" };
+
 AST *
 NewAST(enum astkind kind, AST *left, AST *right)
 {
     AST *ast;
 
-    ast = (AST *)malloc(sizeof(*ast));
-    if (!ast) {
-        fprintf(stderr, "FATAL ERROR: out of memory\n");
-        abort();
-    }
+    ast = (AST *)arena_alloc(&ast_arena, sizeof(*ast));
     ast->kind = kind;
     ast->left = left;
     ast->right = right;
@@ -89,6 +88,40 @@ AddToLeftList(AST *list, AST *newelement)
     p->left = newelement;
     return list;
 }
+/*
+ * the parsers build lists one element at a time ("list: list item"),
+ * so with plain AddToList a long list (big CASE statements, DATA
+ * statements, enum lists, ...) costs O(n^2) to build; a ListBuilder
+ * carries the tail of the list along with its head, so that
+ * appending to it is O(1)
+ */
+ListBuilder
+ListBuilderStart(AST *first)
+{
+    ListBuilder list;
+
+    list.head = list.tail = first;
+    if (list.tail) {
+        while (list.tail->right)
+            list.tail = list.tail->right;
+    }
+    return list;
+}
+
+ListBuilder
+ListBuilderAdd(ListBuilder list, AST *newelement)
+{
+    if (!newelement)
+        return list;
+    if (!list.head)
+        return ListBuilderStart(newelement);
+    list.tail->right = newelement;
+    list.tail = newelement;
+    while (list.tail->right)
+        list.tail = list.tail->right;
+    return list;
+}
+
 /* accelerator for AddToList; keeps track of tail */
 AST *AddToListEx(AST *head, AST *newelem, AST **tailptr)
 {
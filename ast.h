@@ -2,6 +2,7 @@
 #define SPIN_AST_H
 
 #include <stdint.h>
+#include "util/arena.h"
 
 typedef struct LineInfo {
     const char *fileName;
@@ -280,9 +281,22 @@ typedef struct ASTReportInfo {
 
 /* function declarations */
 AST *NewAST(enum astkind kind, AST *left, AST *right);
+
+/* arenas holding AST nodes and the source text in LineInfo */
+extern Arena ast_arena;
+extern Arena linedata_arena;
 AST *AddToList(AST *list, AST *newelement);
 AST *AddToLeftList(AST *list, AST *newelement);
 AST *AddToListEx(AST *list, AST *newelement, AST **tail);
+
+/* a list being built one element at a time, with its tail kept at hand */
+typedef struct ListBuilder {
+    AST *head;
+    AST *tail;
+} ListBuilder;
+ListBuilder ListBuilderStart(AST *first);
+ListBuilder ListBuilderAdd(ListBuilder list, AST *newelement);
+
 AST *ListInsertBefore(AST *list, AST *member, AST *newelem);
 AST *AppendList(AST *list, AST *newlist);
 void RemoveFromList(AST **listptr, AST *newelement);
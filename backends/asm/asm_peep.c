@@ -1357,129 +1357,168 @@ struct Peepholes {
     PeepholePattern *check;
     int arg;
     int (*replace)(int arg, IRList *irl, IR *ir);
+    const char *name;  // for --stats
 } peep2[] = {
-    { pat_maxs, OPC_MAXS, ReplaceMaxMin },
-    { pat_maxu, OPC_MAXU, ReplaceMaxMin },
-    { pat_mins, OPC_MINS, ReplaceMaxMin },
-    { pat_minu, OPC_MINU, ReplaceMaxMin },
-    { pat_maxs_off, OPC_MAXS, ReplaceMaxMin },
-    { pat_maxu_off, OPC_MAXU, ReplaceMaxMin },
-
-    { pat_zeroex, OPC_ZEROX, ReplaceExtend },
-    { pat_signex, OPC_SIGNX, ReplaceExtend },
-
-    { pat_signx_and, 0, FixupSignxAndImm },
-    { pat_shl_shr_and, 0, FixupShlShrAndImm },
-    { pat_shr_and, 0, FixupShrAndImm },
-    { pat_and_wrbyte, 1, FixupDeleteInstr },
+    { pat_maxs, OPC_MAXS, ReplaceMaxMin, "maxs" },
+    { pat_maxu, OPC_MAXU, ReplaceMaxMin, "maxu" },
+    { pat_mins, OPC_MINS, ReplaceMaxMin, "mins" },
+    { pat_minu, OPC_MINU, ReplaceMaxMin, "minu" },
+    { pat_maxs_off, OPC_MAXS, ReplaceMaxMin, "maxs_off" },
+    { pat_maxu_off, OPC_MAXU, ReplaceMaxMin, "maxu_off" },
+
+    { pat_zeroex, OPC_ZEROX, ReplaceExtend, "zeroex" },
+    { pat_signex, OPC_SIGNX, ReplaceExtend, "signex" },
+
+    { pat_signx_and, 0, FixupSignxAndImm, "signx_and" },
+    { pat_shl_shr_and, 0, FixupShlShrAndImm, "shl_shr_and" },
+    { pat_shr_and, 0, FixupShrAndImm, "shr_and" },
+    { pat_and_wrbyte, 1, FixupDeleteInstr, "and_wrbyte" },
     
-    { pat_drvc1, OPC_DRVC, ReplaceDrvc },
-    { pat_drvc2, OPC_DRVC, ReplaceDrvc },
-    { pat_drvnc1, OPC_DRVNC, ReplaceDrvc },
-    { pat_drvnc2, OPC_DRVNC, ReplaceDrvc },
-    { pat_bitc1, OPC_BITC, ReplaceDrvc },
-    { pat_bitc2, OPC_BITC, ReplaceDrvc },
-    { pat_bitnc1, OPC_BITNC, ReplaceDrvc },
-    { pat_bitnc2, OPC_BITNC, ReplaceDrvc },
-    { pat_drvz, OPC_DRVZ, ReplaceDrvc },
-    { pat_drvnz1, OPC_DRVNZ, ReplaceDrvc },
-    { pat_drvnz2, OPC_DRVNZ, ReplaceDrvc },
-
-    { pat_negc1, OPC_NEGC, ReplaceDrvc },
-    { pat_negc2, OPC_NEGC, ReplaceDrvc },
-    { pat_negnc1, OPC_NEGNC, ReplaceDrvc },
-    { pat_negnc2, OPC_NEGNC, ReplaceDrvc },
-    { pat_negz1, OPC_NEGZ, ReplaceDrvc },
-    { pat_negz2, OPC_NEGZ, ReplaceDrvc },
-    { pat_negnz1, OPC_NEGNZ, ReplaceDrvc },
-    { pat_negnz2, OPC_NEGNZ, ReplaceDrvc },
-
-    { pat_sumc1, OPC_SUMC, ReplaceDrvc },
-    { pat_sumc2, OPC_SUMC, ReplaceDrvc },
-    { pat_sumnc1, OPC_SUMNC, ReplaceDrvc },
-    { pat_sumnc2, OPC_SUMNC, ReplaceDrvc },
-    { pat_sumz1, OPC_SUMZ, ReplaceDrvc },
-    { pat_sumz2, OPC_SUMZ, ReplaceDrvc },
-    { pat_sumnz1, OPC_SUMNZ, ReplaceDrvc },
-    { pat_sumnz2, OPC_SUMNZ, ReplaceDrvc },
-
-    { pat_not, 0, ReplaceNot},
-
-    { pat_cmps_abs, 0, ReplaceCmpsAbs},
-
-    { pat_wrc_cmp, 0, ReplaceWrcCmp },
-    { pat_wrc_and, 1, RemoveNFlagged },
-    { pat_wrc_test, 0, ReplaceWrcTest },
-
-    { pat_muxc_cmp, 0, ReplaceWrcCmp },
-    { pat_subx_cmp, 0, ReplaceWrcCmp },
-    { pat_muxc_wz, 1, ReplaceWrcCmp },
-
-    { pat_rdbyte1, 2, RemoveNFlagged },
-    { pat_rdword1, 2, RemoveNFlagged },
-    { pat_rdbyte2, 1, RemoveNFlagged },
-    { pat_rdword2, 1, RemoveNFlagged },
-
-    { pat_movadd, 0, FixupMovAdd },
-
-    { pat_bmask1, 0, FixupBmask },
-    { pat_bmask2, 0, FixupBmask },
-
-    { pat_waitx, 0, FixupWaitx },
-
-    { pat_seteq, OPC_WRZ, FixupEq },
-    { pat_setne, OPC_WRNZ, FixupEq },
+    { pat_drvc1, OPC_DRVC, ReplaceDrvc, "drvc1" },
+    { pat_drvc2, OPC_DRVC, ReplaceDrvc, "drvc2" },
+    { pat_drvnc1, OPC_DRVNC, ReplaceDrvc, "drvnc1" },
+    { pat_drvnc2, OPC_DRVNC, ReplaceDrvc, "drvnc2" },
+    { pat_bitc1, OPC_BITC, ReplaceDrvc, "bitc1" },
+    { pat_bitc2, OPC_BITC, ReplaceDrvc, "bitc2" },
+    { pat_bitnc1, OPC_BITNC, ReplaceDrvc, "bitnc1" },
+    { pat_bitnc2, OPC_BITNC, ReplaceDrvc, "bitnc2" },
+    { pat_drvz, OPC_DRVZ, ReplaceDrvc, "drvz" },
+    { pat_drvnz1, OPC_DRVNZ, ReplaceDrvc, "drvnz1" },
+    { pat_drvnz2, OPC_DRVNZ, ReplaceDrvc, "drvnz2" },
+
+    { pat_negc1, OPC_NEGC, ReplaceDrvc, "negc1" },
+    { pat_negc2, OPC_NEGC, ReplaceDrvc, "negc2" },
+    { pat_negnc1, OPC_NEGNC, ReplaceDrvc, "negnc1" },
+    { pat_negnc2, OPC_NEGNC, ReplaceDrvc, "negnc2" },
+    { pat_negz1, OPC_NEGZ, ReplaceDrvc, "negz1" },
+    { pat_negz2, OPC_NEGZ, ReplaceDrvc, "negz2" },
+    { pat_negnz1, OPC_NEGNZ, ReplaceDrvc, "negnz1" },
+    { pat_negnz2, OPC_NEGNZ, ReplaceDrvc, "negnz2" },
+
+    { pat_sumc1, OPC_SUMC, ReplaceDrvc, "sumc1" },
+    { pat_sumc2, OPC_SUMC, ReplaceDrvc, "sumc2" },
+    { pat_sumnc1, OPC_SUMNC, ReplaceDrvc, "sumnc1" },
+    { pat_sumnc2, OPC_SUMNC, ReplaceDrvc, "sumnc2" },
+    { pat_sumz1, OPC_SUMZ, ReplaceDrvc, "sumz1" },
+    { pat_sumz2, OPC_SUMZ, ReplaceDrvc, "sumz2" },
+    { pat_sumnz1, OPC_SUMNZ, ReplaceDrvc, "sumnz1" },
+    { pat_sumnz2, OPC_SUMNZ, ReplaceDrvc, "sumnz2" },
+
+    { pat_not, 0, ReplaceNot, "not" },
+
+    { pat_cmps_abs, 0, ReplaceCmpsAbs, "cmps_abs" },
+
+    { pat_wrc_cmp, 0, ReplaceWrcCmp, "wrc_cmp" },
+    { pat_wrc_and, 1, RemoveNFlagged, "wrc_and" },
+    { pat_wrc_test, 0, ReplaceWrcTest, "wrc_test" },
+
+    { pat_muxc_cmp, 0, ReplaceWrcCmp, "muxc_cmp" },
+    { pat_subx_cmp, 0, ReplaceWrcCmp, "subx_cmp" },
+    { pat_muxc_wz, 1, ReplaceWrcCmp, "muxc_wz" },
+
+    { pat_rdbyte1, 2, RemoveNFlagged, "rdbyte1" },
+    { pat_rdword1, 2, RemoveNFlagged, "rdword1" },
+    { pat_rdbyte2, 1, RemoveNFlagged, "rdbyte2" },
+    { pat_rdword2, 1, RemoveNFlagged, "rdword2" },
+
+    { pat_movadd, 0, FixupMovAdd, "movadd" },
+
+    { pat_bmask1, 0, FixupBmask, "bmask1" },
+    { pat_bmask2, 0, FixupBmask, "bmask2" },
+
+    { pat_waitx, 0, FixupWaitx, "waitx" },
+
+    { pat_seteq, OPC_WRZ, FixupEq, "seteq" },
+    { pat_setne, OPC_WRNZ, FixupEq, "setne" },
 #if 0
-    { pat_sar24getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr24getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_sar16getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr16getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_sar8getbyte, OPC_GETBYTE, FixupGetByteWord },
-    { pat_shr8getbyte, OPC_GETBYTE, FixupGetByteWord },
-
-    { pat_sar16getword, OPC_GETWORD, FixupGetByteWord },
-    { pat_shr16getword, OPC_GETWORD, FixupGetByteWord },
+    { pat_sar24getbyte, OPC_GETBYTE, FixupGetByteWord, "sar24getbyte" },
+    { pat_shr24getbyte, OPC_GETBYTE, FixupGetByteWord, "shr24getbyte" },
+    { pat_sar16getbyte, OPC_GETBYTE, FixupGetByteWord, "sar16getbyte" },
+    { pat_shr16getbyte, OPC_GETBYTE, FixupGetByteWord, "shr16getbyte" },
+    { pat_sar8getbyte, OPC_GETBYTE, FixupGetByteWord, "sar8getbyte" },
+    { pat_shr8getbyte, OPC_GETBYTE, FixupGetByteWord, "shr8getbyte" },
+
+    { pat_sar16getword, OPC_GETWORD, FixupGetByteWord, "sar16getword" },
+    { pat_shr16getword, OPC_GETWORD, FixupGetByteWord, "shr16getword" },
 #endif
-    { pat_shl8setbyte, OPC_SETBYTE, FixupSetByteWord },
-    { pat_shl16setbyte, OPC_SETBYTE, FixupSetByteWord },
-    { pat_shl24setbyte, OPC_SETBYTE, FixupSetByteWord },
+    { pat_shl8setbyte, OPC_SETBYTE, FixupSetByteWord, "shl8setbyte" },
+    { pat_shl16setbyte, OPC_SETBYTE, FixupSetByteWord, "shl16setbyte" },
+    { pat_shl24setbyte, OPC_SETBYTE, FixupSetByteWord, "shl24setbyte" },
 
-    { pat_shl16setword, OPC_SETWORD, FixupSetByteWord },
+    { pat_shl16setword, OPC_SETWORD, FixupSetByteWord, "shl16setword" },
 
-    { pat_clrc, 0, FixupClrC },
-    { pat_setc1, 0, FixupSetC },
-    { pat_setc2, 0, FixupSetC },
+    { pat_clrc, 0, FixupClrC, "clrc" },
+    { pat_setc1, 0, FixupSetC, "setc1" },
+    { pat_setc2, 0, FixupSetC, "setc2" },
 
-    { pat_mov_and_add, 0, FixupAndAdd },
+    { pat_mov_and_add, 0, FixupAndAdd, "mov_and_add" },
 
-    { pat_qmul_qmul1, 0, FixupQmuls },
-    { pat_qmul_qmul2, 0, FixupQmuls },
-    { pat_qdiv_qdiv1, 0, FixupQmuls },
-    { pat_qdiv_qdiv2, 0, FixupQmuls },
+    { pat_qmul_qmul1, 0, FixupQmuls, "qmul_qmul1" },
+    { pat_qmul_qmul2, 0, FixupQmuls, "qmul_qmul2" },
+    { pat_qdiv_qdiv1, 0, FixupQmuls, "qdiv_qdiv1" },
+    { pat_qdiv_qdiv2, 0, FixupQmuls, "qdiv_qdiv2" },
 
-    { pat_qdiv_qdiv_signed1, 0, FixupQdivSigned},
-    { pat_qdiv_qdiv_signed2, 0, FixupQdivSigned},
-    { pat_qdiv_qdiv_signed3, 0, FixupQdivSigned2},
-    { pat_qdiv_qdiv_signed4, 0, FixupQdivSigned2},
-    { pat_qdiv_qdiv_signed5, 0, FixupQdivSigned3},
+    { pat_qdiv_qdiv_signed1, 0, FixupQdivSigned, "qdiv_qdiv_signed1" },
+    { pat_qdiv_qdiv_signed2, 0, FixupQdivSigned, "qdiv_qdiv_signed2" },
+    { pat_qdiv_qdiv_signed3, 0, FixupQdivSigned2, "qdiv_qdiv_signed3" },
+    { pat_qdiv_qdiv_signed4, 0, FixupQdivSigned2, "qdiv_qdiv_signed4" },
+    { pat_qdiv_qdiv_signed5, 0, FixupQdivSigned3, "qdiv_qdiv_signed5" },
 
-    { pat_mux_qmux_1p, 1, FixupQMux },
-    { pat_mux_qmux_2p, 2, FixupQMux },
+    { pat_mux_qmux_1p, 1, FixupQMux, "mux_qmux_1p" },
+    { pat_mux_qmux_2p, 2, FixupQMux, "mux_qmux_2p" },
 
-    { pat_jmp_jmp, 1, FixupDeleteInstr },
+    { pat_jmp_jmp, 1, FixupDeleteInstr, "jmp_jmp" },
 
-    { pat_mov255_and, 1, FixupMov255And },
+    { pat_mov255_and, 1, FixupMov255And, "mov255_and" },
 
-    { pat_lea_ptr, 0, FixupLeaPtr },
+    { pat_lea_ptr, 0, FixupLeaPtr, "lea_ptr" },
 };
 
 
+#define NUM_PEEP2 (sizeof(peep2) / sizeof(peep2[0]))
+
+// number of times each peephole was applied
+static unsigned peep2_count[NUM_PEEP2];
+
+/*
+ * index of the peepholes by opcode: peep2_index[peep2_start[opc]] up
+ * to peep2_index[peep2_start[opc+1]] are the peep2[] entries whose
+ * first instruction may have opcode opc (in table order, since the
+ * first match wins)
+ */
+static unsigned short peep2_index[(OPC_UNKNOWN+1) * NUM_PEEP2];
+static unsigned peep2_start[OPC_UNKNOWN+2];
+
+static void
+BuildPeep2Index(void)
+{
+    int opc;
+    unsigned i, n = 0;
+
+    for (opc = 0; opc <= OPC_UNKNOWN; opc++) {
+        peep2_start[opc] = n;
+        for (i = 0; i < NUM_PEEP2; i++) {
+            int first = peep2[i].check[0].opc;
+            if (first == opc || first == OPC_ANY) {
+                peep2_index[n++] = i;
+            }
+        }
+    }
+    peep2_start[OPC_UNKNOWN+1] = n;
+}
+
 int OptimizePeephole2(IRList *irl)
 {
     IR *ir;
     int change = 0;
     int i, r;
+    unsigned j;
+    static int indexed = 0;
 
+    if (!indexed) {
+        BuildPeep2Index();
+        indexed = 1;
+    }
     ir = irl->head;
     for(;;) {
         while (ir && IsDummy(ir)) {
@@ -1487,11 +1526,13 @@ int OptimizePeephole2(IRList *irl)
         }
         if (!ir) break;
         if (!InstrIsVolatile(ir)) {
-            for (i = 0; i < sizeof(peep2) / sizeof(peep2[0]); i++) {
+            for (j = peep2_start[ir->opc]; j < peep2_start[ir->opc+1]; j++) {
+                i = peep2_index[j];
                 r = MatchPattern(peep2[i].check, ir);
                 if (r) {
                     r = (*peep2[i].replace)(peep2[i].arg, irl, ir);
                     if (r) {
+                        peep2_count[i]++;
                         change++;
                     }
                     break;
@@ -1502,3 +1543,22 @@ int OptimizePeephole2(IRList *irl)
     }
     return change;
 }
+
+//
+// print how often the peepholes fired (for --stats)
+//
+void PrintPeepholeStats(FILE *f)
+{
+    unsigned i;
+    int header = 0;
+
+    for (i = 0; i < NUM_PEEP2; i++) {
+        if (peep2_count[i]) {
+            if (!header) {
+                fprintf(f, "Peephole optimizations applied:\n");
+                header = 1;
+            }
+            fprintf(f, "  %-24s %8u\n", peep2[i].name, peep2_count[i]);
+        }
+    }
+}
@@ -102,6 +102,12 @@ static const char *RemappedName(const char *name)
     return buf;
 }
 
+// the name a label is printed with (after IRAssemble)
+const char *AsmLabelName(const char *name)
+{
+    return RemappedName(name);
+}
+
 // helper function for printing operands
 static void
 doPrintOperand(struct flexbuf *fb, Operand *reg, int useimm, enum OperandEffect effect_orig, int maximm)
@@ -1538,6 +1544,7 @@ doIRAssemble(IRList *list, Module *P, int flags)
     IR *ir;
     struct flexbuf fb;
     char *ret;
+    size_t count = 0;
 
     inDat = 0;
     inCon = 0;
@@ -1552,6 +1559,11 @@ doIRAssemble(IRList *list, Module *P, int flags)
         didPub = 1; // we do not want pub declaration in P2 code
     }
     flexbuf_init(&fb, 512);
+    // most instructions take up less than 32 characters
+    for (ir = list->head; ir; ir = ir->next) {
+        count++;
+    }
+    flexbuf_reserve(&fb, 32 * count);
     for (ir = list->head; ir; ir = ir->next) {
         if (flags && (0 != (ir->flags & FLAG_KEEP_INSTR))) {
             flexbuf_printf(&fb, "*");
@@ -33,14 +33,27 @@
 #include "outasm.h"
 
 typedef struct PtrFrequency {
-    int count; // the count of its use
     void *ptr; // the operand or instruction
+    int count; // the count of its use
 } PtrFreq;
 
+// hash index for a table of items (operands or instructions), so that
+// matching ones may be found without comparing against every entry
+// the items are pointers spaced "stride" bytes apart from "base"
+typedef struct PtrIndex {
+    int *slots;      // 1 + item number, or 0 if empty
+    unsigned mask;   // number of slots - 1
+} PtrIndex;
+
+typedef unsigned (*HashFunc)(void *);
+typedef int (*MatchFunc)(void *, void *);
+
 Flexbuf dstcount;
 Flexbuf srccount;
 Flexbuf instrcount;
 
+static PtrIndex dstindex, srcindex, instrindex;
+
 #define MAX_COMPRESS 32
 
 IR *cinstr_table[MAX_COMPRESS];
@@ -88,6 +101,20 @@ static int MatchOperand(void *aptr, void *bptr)
     return a == b;
 }
 
+static unsigned HashOperand(void *ptr)
+{
+    Operand *op = (Operand *)ptr;
+    uintptr_t h;
+
+    if (op->kind == IMM_INT) {
+        h = (uintptr_t)op->val;
+    } else {
+        h = (uintptr_t)op >> 4;
+    }
+    h = h * 31 + op->kind;
+    return (unsigned)(h ^ (h >> 16)) * 2654435761u;
+}
+
 static int MatchIR(void *aptr, void *bptr)
 {
     IR *a = (IR *)aptr;
@@ -104,27 +131,85 @@ static int MatchIR(void *aptr, void *bptr)
     return a->srceffect == b->srceffect && a->dsteffect == b->dsteffect;
 }
 
+static unsigned HashIR(void *ptr)
+{
+    IR *ir = (IR *)ptr;
+    uintptr_t h = (uintptr_t)ir->instr >> 4;
+
+    h = h * 31 + ir->flags;
+    h = h * 31 + ir->cond;
+    h = h * 31 + ir->srceffect;
+    h = h * 31 + ir->dsteffect;
+    return (unsigned)(h ^ (h >> 16)) * 2654435761u;
+}
+
+#define INDEX_ITEM(base, stride, n) (*(void **)((char *)(base) + (n)*(stride)))
+
+// find the slot for "ptr" in the index: either the one holding the
+// first matching item, or an empty one where it may be added
+static int *
+FindIndexSlot(PtrIndex *px, void *base, size_t stride, void *ptr, HashFunc hashptr, MatchFunc matchptr)
+{
+    unsigned i = hashptr(ptr) & px->mask;
+
+    while (px->slots[i] && !matchptr(INDEX_ITEM(base, stride, px->slots[i]-1), ptr)) {
+        i = (i + 1) & px->mask;
+    }
+    return &px->slots[i];
+}
+
+// (re)build the index for the first n items of a table
+static void
+BuildIndex(PtrIndex *px, void *base, size_t stride, unsigned n, HashFunc hashptr, MatchFunc matchptr)
+{
+    unsigned i;
+    int *slot;
+
+    free(px->slots);
+    px->mask = 63;
+    while (px->mask < 2*n) {
+        px->mask = 2*px->mask + 1;
+    }
+    px->slots = (int *)calloc(px->mask + 1, sizeof(int));
+    for (i = 0; i < n; i++) {
+        slot = FindIndexSlot(px, base, stride, INDEX_ITEM(base, stride, i), hashptr, matchptr);
+        if (!*slot) {
+            *slot = i+1;
+        }
+    }
+}
+
+static void
+FreeIndex(PtrIndex *px)
+{
+    free(px->slots);
+    memset(px, 0, sizeof(*px));
+}
+
 // record an operand in a frequency tables
-#define RecordOperand(fb, oper) RecordItem(fb, oper, MatchOperand)
-#define RecordInstr(fb, instr) RecordItem(fb, instr, MatchIR)
+#define RecordOperand(fb, px, oper) RecordItem(fb, px, oper, HashOperand, MatchOperand)
+#define RecordInstr(fb, px, instr) RecordItem(fb, px, instr, HashIR, MatchIR)
 
 
-static void RecordItem(Flexbuf *fb, void *ptr, int (*matchptr)(void *, void *))
+static void RecordItem(Flexbuf *fb, PtrIndex *px, void *ptr, HashFunc hashptr, MatchFunc matchptr)
 {
     size_t count = flexbuf_curlen(fb) / sizeof(PtrFreq);
     PtrFreq *freqtable = (PtrFreq *)flexbuf_peek(fb);
     PtrFreq newfreq;
-    size_t i;
+    int *slot;
     
     if (!ptr) {
         return;
     }
-    for (i = 0; i < count; i++) {
-        if (matchptr(freqtable[i].ptr, ptr)) {
-            freqtable[i].count++;
-            return;
-        }
+    if (2*(count+1) > px->mask) {
+        BuildIndex(px, freqtable, sizeof(PtrFreq), count, hashptr, matchptr);
+    }
+    slot = FindIndexSlot(px, freqtable, sizeof(PtrFreq), ptr, hashptr, matchptr);
+    if (*slot) {
+        freqtable[*slot-1].count++;
+        return;
     }
+    *slot = count+1;
     newfreq.ptr = ptr;
     newfreq.count = 1;
     flexbuf_addmem(fb, (char *)&newfreq, sizeof(newfreq));
@@ -201,15 +286,12 @@ SortPrint(const char *msg, Flexbuf *buf, void (*doprint)(struct flexbuf *, void
     (void)running;
 }
 
-static int FindPtr(void **table, void *ptr, int (*matchptr)(void *, void *))
+// find the index of ptr in one of the compression tables, or
+// MAX_COMPRESS if it is not there
+static int FindPtr(PtrIndex *px, void **table, void *ptr, HashFunc hashptr, MatchFunc matchptr)
 {
-    int i;
-    for (i = 0; i < MAX_COMPRESS; i++) {
-        if (matchptr(table[i], ptr)) {
-            break;
-        }
-    }
-    return i;
+    int *slot = FindIndexSlot(px, table, sizeof(void *), ptr, hashptr, matchptr);
+    return *slot ? *slot - 1 : MAX_COMPRESS;
 }
 
 // walk through and record the most popular instructions/operands in the
@@ -242,9 +324,9 @@ void IRCompress(IRList *irl, IRList *kernel)
         if (!ir->instr || ir->instr->ops != TWO_OPERANDS) {
             continue;
         }
-        RecordInstr(&instrcount, (void *)ir);
-        RecordOperand(&dstcount, (void *)ir->dst);
-        RecordOperand(&srccount, (void *)ir->src);
+        RecordInstr(&instrcount, &instrindex, (void *)ir);
+        RecordOperand(&dstcount, &dstindex, (void *)ir->dst);
+        RecordOperand(&srccount, &srcindex, (void *)ir->src);
     }
 
     // establish default values for various instructions
@@ -255,6 +337,9 @@ void IRCompress(IRList *irl, IRList *kernel)
     SortPrint("instructions", &instrcount, DoPrintIR, (void **)cinstr_table, (void *)ir);
     SortPrint("dst operands:", &dstcount, DoPrintOp, (void **)cdst_table, (void *)opdst);
     SortPrint("src operands:", &srccount, DoPrintOp, (void **)csrc_table, (void *)opsrc);
+    BuildIndex(&instrindex, cinstr_table, sizeof(void *), MAX_COMPRESS, HashIR, MatchIR);
+    BuildIndex(&dstindex, cdst_table, sizeof(void *), MAX_COMPRESS, HashOperand, MatchOperand);
+    BuildIndex(&srcindex, csrc_table, sizeof(void *), MAX_COMPRESS, HashOperand, MatchOperand);
     // now add 32 instructions to COMPRESS_TABLE in the kernel
     EmitNamedCogLabel(kernel, "COMPRESS_TABLE");
     
@@ -286,9 +371,9 @@ void IRCompress(IRList *irl, IRList *kernel)
             ir = origir;
             continue;
         }
-        instr_idx = FindPtr((void **)cinstr_table, ir, MatchIR);
-        dst_idx = FindPtr((void **)cdst_table, ir->dst, MatchOperand);
-        src_idx = FindPtr((void **)csrc_table, ir->src, MatchOperand);
+        instr_idx = FindPtr(&instrindex, (void **)cinstr_table, ir, HashIR, MatchIR);
+        dst_idx = FindPtr(&dstindex, (void **)cdst_table, ir->dst, HashOperand, MatchOperand);
+        src_idx = FindPtr(&srcindex, (void **)csrc_table, ir->src, HashOperand, MatchOperand);
         // 4 bits for instruction, 5 bits each for src and dst
         if (instr_idx < 16 && dst_idx < 32 && src_idx < 32) {
             word_hits++;
@@ -351,6 +436,9 @@ void IRCompress(IRList *irl, IRList *kernel)
         }
         ir = origir;
     }
+    FreeIndex(&instrindex);
+    FreeIndex(&dstindex);
+    FreeIndex(&srcindex);
     if (gl_printstats) {
         printf("hit %d words, %d tuples, %d short bytes; %d misses\n", word_hits, tuple_hits, byte_hits, misses);
     }
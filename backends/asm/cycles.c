@@ -0,0 +1,1239 @@
+//
+// Static cycle estimates for the assembly backend
+//
+// Copyright 2026 Total Spectrum Software Inc.
+// see the file COPYING for conditions of redistribution
+//
+// With --cycle-report the final IR of every function is split into basic
+// blocks, and the smallest and largest number of clock cycles is worked
+// out for each block, for one iteration of each loop, and for one call of
+// each function (from its entry to its return, not counting time spent in
+// the functions it calls). The results are written as JSON next to the
+// listing file, so that timing budgets can be checked when compiling.
+//
+// The timings come from the Propeller data sheets:
+//   P2: instructions take 2 cycles, plus 2 for each AUGS/AUGD. A taken
+//       branch takes 4 cycles to cog or LUT and 13..20 to hub, where
+//       the FIFO must be refilled. Hub reads take 9..16 cycles and hub
+//       writes 3..10 (9..26 and 3..20 when executing from hub, since
+//       the FIFO competes for the hub), and SETQ bursts add a cycle per
+//       long. CORDIC commands take 2..9 cycles to issue, and GETQX/GETQY
+//       wait for the result, which is ready 55 cycles after the command.
+//   P1: instructions take 4 cycles and hub operations 8..23. Code in hub
+//       runs through the default LMM kernel, where an instruction costs
+//       one 16 cycle hub window if the kernel stays in step with the hub
+//       and two if it does not.
+//
+// A max of null means there is no bound: the code waits for an event,
+// loops an unknown number of times, or jumps somewhere that cannot be
+// followed. A function whose min is null has no path to its return, so
+// it never returns.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "spinc.h"
+#include "outasm.h"
+#include "util/ptrmap.h"
+
+const char *gl_cycle_report;
+
+#define CORDIC_LATENCY 55
+
+#define CYC_UNBOUNDED ULONG_MAX
+#define CYC_NOPATH    (ULONG_MAX-1)
+
+typedef struct Cycles {
+    unsigned long min;
+    unsigned long max;
+} Cycles;
+
+// where code runs
+enum {
+    LOC_COG,
+    LOC_LUT,
+    LOC_HUB,
+};
+
+static const char *locName[] = { "cog", "lut", "hub" };
+
+// an edge to another block; "to" is -1 if the edge leaves the function
+typedef struct CycleEdge {
+    int to;
+    Cycles cost;
+} CycleEdge;
+
+typedef struct CycleBlock {
+    IR *first;           // first IR in the block
+    IR *last;            // last IR in the block
+    const char *label;   // label at or before the start of the block
+    int offset;          // instructions between label and block start
+    AST *line;           // source line of the first instruction
+    int loc;
+    bool real;           // block contains at least one instruction
+    bool unknown;        // ends with a jump we cannot follow
+    bool reached;
+    Cycles body;         // cost of everything but the final branch
+    CycleEdge *edges;
+    int numedges;
+    int dfsState;        // for loop and path searches
+    unsigned long path;
+} CycleBlock;
+
+// a hardware (REP) loop found inside a block
+typedef struct RepLoop {
+    int block;
+    Cycles iter;
+    int count;           // -1 if not known at compile time
+} RepLoop;
+
+// state of the CORDIC solver within a block
+typedef struct CordicState {
+    bool known;          // have we seen a command or result in this block?
+    bool pending;        // a command was issued and its result not read
+    unsigned long emin;  // cycles since the command was issued
+    unsigned long emax;
+} CordicState;
+
+//
+// small hash tables from label operands to integers
+//
+typedef PtrMap LabelTable;
+
+static void
+AddLabel(LabelTable *T, Operand *op, int val)
+{
+    ptrmap_add(T, op, val);
+}
+
+static int
+LookupLabel(LabelTable *T, Operand *op)
+{
+    intptr_t val;
+    return ptrmap_find(T, op, &val) ? (int)val : -1;
+}
+
+static void
+ClearLabels(LabelTable *T)
+{
+    ptrmap_free(T);
+}
+
+//
+// arithmetic on cycle counts
+//
+static Cycles
+Cyc(unsigned long min, unsigned long max)
+{
+    Cycles c;
+    c.min = min;
+    c.max = max;
+    return c;
+}
+
+static unsigned long
+CycSum(unsigned long a, unsigned long b)
+{
+    if (a == CYC_UNBOUNDED || b == CYC_UNBOUNDED) {
+        return CYC_UNBOUNDED;
+    }
+    return a + b;
+}
+
+static void
+CycAdd(Cycles *c, Cycles d)
+{
+    c->min = CycSum(c->min, d.min);
+    c->max = CycSum(c->max, d.max);
+}
+
+static unsigned long
+CycTimes(unsigned long a, int n)
+{
+    if (a == CYC_UNBOUNDED) {
+        return a;
+    }
+    return a * n;
+}
+
+//
+// instruction timing
+//
+
+static bool
+IsInstruction(IR *ir)
+{
+    return ir->opc < OPC_PUSH_REGS && !IsDummy(ir) && ir->opc != OPC_REPEAT_END;
+}
+
+static bool
+EndsBlock(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_JUMP:
+    case OPC_DJNZ:
+    case OPC_JMPREL:
+    case OPC_RET:
+    case OPC_GENERIC_BRANCH:
+    case OPC_GENERIC_BRCOND:
+        return !IsDummy(ir);
+    default:
+        return false;
+    }
+}
+
+static bool
+NameStarts(IR *ir, const char *prefix)
+{
+    return ir->instr && !strncmp(ir->instr->name, prefix, strlen(prefix));
+}
+
+// instructions that wait for the hub on P1, or take 2..9 cycles on P2
+static bool
+IsHubOp(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_COGID:
+    case OPC_COGSTOP:
+    case OPC_LOCKCLR:
+    case OPC_LOCKNEW:
+    case OPC_LOCKRET:
+    case OPC_LOCKSET:
+    case OPC_LOCKTRY:
+    case OPC_LOCKREL:
+    case OPC_HUBSET:
+        return true;
+    case OPC_GENERIC:
+    case OPC_GENERIC_NR:
+    case OPC_GENERIC_NOFLAGS:
+    case OPC_GENERIC_NR_NOFLAGS:
+        if (NameStarts(ir, "cog") || NameStarts(ir, "lock") || NameStarts(ir, "hubop")) {
+            return true;
+        }
+        if (!gl_p2) {
+            return NameStarts(ir, "rd") || NameStarts(ir, "wr") || NameStarts(ir, "clkset");
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+static bool
+IsWaitOp(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_WAITCNT:
+        return true;
+    case OPC_GENERIC:
+    case OPC_GENERIC_NR:
+    case OPC_GENERIC_NOFLAGS:
+    case OPC_GENERIC_NR_NOFLAGS:
+    case OPC_GENERIC_DELAY:
+        return NameStarts(ir, "wait");
+    default:
+        return false;
+    }
+}
+
+static bool
+IsCordicCommand(IR *ir)
+{
+    switch (ir->opc) {
+    case OPC_QMUL:
+    case OPC_QDIV:
+    case OPC_QFRAC:
+    case OPC_QSQRT:
+    case OPC_QROTATE:
+    case OPC_QVECTOR:
+    case OPC_QLOG:
+    case OPC_QEXP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// number of longs a SETQ/SETQ2 before ir adds to a burst, or -1 if unknown
+static int
+BurstExtra(IR *ir)
+{
+    IR *prev = ir->prev;
+    while (prev && !IsInstruction(prev) && prev->opc != OPC_LABEL) {
+        prev = prev->prev;
+    }
+    if (!prev || (prev->opc != OPC_SETQ && prev->opc != OPC_SETQ2)) {
+        return 0;
+    }
+    if (prev->dst && prev->dst->kind == IMM_INT) {
+        return prev->dst->val;
+    }
+    return -1;
+}
+
+// number of longs copied in by an FCACHE load
+static int
+FcacheLongs(IR *fcache)
+{
+    IR *ir;
+    int n = 0;
+    for (ir = fcache->next; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL && ir->dst == fcache->dst) {
+            break;
+        }
+        if (IsInstruction(ir)) {
+            n += 1 + NeedsImmAug(ir->src) + NeedsImmAug(ir->dst);
+        }
+    }
+    return n;
+}
+
+//
+// cost of a taken branch from "loc" to "toloc"; "local" is true for
+// jumps within a function
+//
+static Cycles
+BranchCycles(IR *ir, int loc, int toloc, bool local)
+{
+    if (gl_p2) {
+        return toloc == LOC_HUB ? Cyc(13, 20) : Cyc(4, 4);
+    }
+    if (loc != LOC_HUB) {
+        return Cyc(4, 4);
+    }
+    // P1 LMM: short jumps are an add/sub of the pc, longer ones
+    // read the new pc from the next long, and calls and returns
+    // go through the kernel
+    switch (ir->opc) {
+    case OPC_CALL:
+        return Cyc(64, 80);
+    case OPC_RET:
+        return Cyc(48, 64);
+    default:
+        return local ? Cyc(16, 32) : Cyc(32, 48);
+    }
+}
+
+//
+// find the cycles taken by ir when execution goes on to the next
+// instruction (*next) and when it branches (*taken)
+//
+static void
+InstrCycles(IR *ir, int loc, int toloc, bool local, CordicState *Q, Cycles *next, Cycles *taken)
+{
+    unsigned long base;
+    int aug = 0;
+    int n;
+    Cycles c;
+
+    if (gl_p2) {
+        aug = 2 * (NeedsImmAug(ir->src) + NeedsImmAug(ir->dst));
+        base = 2 + aug;
+    } else {
+        base = (loc == LOC_HUB) ? 16 : 4;
+    }
+    c = Cyc(base, base);
+    if (ir->opc == OPC_FCACHE) {
+        n = FcacheLongs(ir);
+        if (gl_p2) {
+            // callpa from hub, then a SETQ burst and a jump into cog
+            c = Cyc(38 + n, 52 + n);
+        } else {
+            // nothing is copied if the loop is already loaded
+            c = Cyc(80, 80 + 32*n);
+        }
+        *next = *taken = c;
+        return;
+    }
+    if (!IsInstruction(ir)) {
+        *next = *taken = Cyc(0, 0);
+        return;
+    }
+    switch (ir->opc) {
+    case OPC_RDBYTE:
+    case OPC_RDWORD:
+    case OPC_RDLONG:
+    case OPC_WRBYTE:
+    case OPC_WRWORD:
+    case OPC_WRLONG:
+        if (!gl_p2) {
+            c = (loc == LOC_HUB) ? Cyc(32, 48) : Cyc(8, 23);
+            break;
+        }
+        if (ir->opc == OPC_RDBYTE || ir->opc == OPC_RDWORD || ir->opc == OPC_RDLONG) {
+            c = Cyc(aug + 9, aug + (loc == LOC_HUB ? 26 : 16));
+        } else {
+            c = Cyc(aug + 3, aug + (loc == LOC_HUB ? 20 : 10));
+        }
+        n = BurstExtra(ir);
+        if (n < 0) {
+            c.max = CYC_UNBOUNDED;
+        } else {
+            c.min += n;
+            c.max += n;
+        }
+        break;
+    case OPC_GETQX:
+    case OPC_GETQY:
+        if (!Q->known) {
+            c.max += CORDIC_LATENCY;
+        } else if (Q->pending) {
+            if (Q->emax < CORDIC_LATENCY) c.min += CORDIC_LATENCY - Q->emax;
+            if (Q->emin < CORDIC_LATENCY) c.max += CORDIC_LATENCY - Q->emin;
+        }
+        Q->known = true;
+        Q->pending = false;
+        break;
+    case OPC_WAITX:
+        if (ir->dst && ir->dst->kind == IMM_INT) {
+            c.min += ir->dst->val;
+            c.max += ir->dst->val;
+        } else {
+            c.max = CYC_UNBOUNDED;
+        }
+        break;
+    default:
+        if (IsCordicCommand(ir)) {
+            c.max += 7;
+        } else if (IsHubOp(ir)) {
+            if (gl_p2) {
+                c.max += 7;
+            } else {
+                c = (loc == LOC_HUB) ? Cyc(32, 48) : Cyc(8, 23);
+            }
+        } else if (IsWaitOp(ir)) {
+            if (!gl_p2 && loc != LOC_HUB) {
+                c.min = 6;
+            }
+            c.max = CYC_UNBOUNDED;
+        }
+        break;
+    }
+    if (ir->cond != COND_TRUE && !EndsBlock(ir) && ir->opc != OPC_CALL) {
+        // a skipped instruction still takes its slot
+        c.min = base;
+    }
+
+    // keep track of the time since the last CORDIC command
+    if (Q->pending) {
+        Q->emin = CycSum(Q->emin, c.min);
+        Q->emax = CycSum(Q->emax, c.max);
+    }
+    if (IsCordicCommand(ir)) {
+        Q->known = Q->pending = true;
+        Q->emin = Q->emax = 0;
+    }
+
+    *next = *taken = c;
+    switch (ir->opc) {
+    case OPC_CALL:
+        *next = *taken = BranchCycles(ir, loc, toloc, false);
+        break;
+    case OPC_RET:
+        if (gl_p2) {
+            // we do not know where the caller is
+            if (loc == LOC_HUB) {
+                *taken = Cyc(13, 20);
+            } else if (gl_outputflags & OUTFLAG_COG_CODE) {
+                *taken = Cyc(4, 4);
+            } else {
+                *taken = Cyc(4, 20);
+            }
+        } else {
+            *taken = BranchCycles(ir, loc, toloc, false);
+        }
+        break;
+    case OPC_DJNZ:
+    case OPC_GENERIC_BRCOND:
+        *taken = BranchCycles(ir, loc, toloc, local);
+        if (!gl_p2 && loc != LOC_HUB) {
+            // P1 djnz/tjz take longer when they fall through
+            *next = Cyc(8, 8);
+        } else if (!gl_p2) {
+            *next = Cyc(16, 32);
+        }
+        break;
+    case OPC_JUMP:
+    case OPC_JMPREL:
+    case OPC_GENERIC_BRANCH:
+        *taken = BranchCycles(ir, loc, toloc, local);
+        if (!gl_p2 && loc == LOC_HUB && !local) {
+            *next = Cyc(32, 48);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+//
+// building the blocks of one function
+//
+static CycleBlock *blocks;
+static int numBlocks;
+static int maxBlocks;
+static LabelTable blockLabels;
+static RepLoop *repLoops;
+static int numRepLoops;
+static int maxRepLoops;
+
+static LabelTable funcLabels;
+static Function **funcList;
+static int numFuncs;
+
+static CycleBlock *
+NewBlock(IR *first, const char *label, int offset, int loc)
+{
+    CycleBlock *b;
+    if (numBlocks == maxBlocks) {
+        maxBlocks = maxBlocks ? 2*maxBlocks : 64;
+        blocks = (CycleBlock *)realloc(blocks, maxBlocks * sizeof(CycleBlock));
+    }
+    b = &blocks[numBlocks++];
+    memset(b, 0, sizeof(*b));
+    b->first = b->last = first;
+    b->label = label;
+    b->offset = offset;
+    b->loc = loc;
+    return b;
+}
+
+static void
+AddEdge(CycleBlock *b, int to, Cycles cost)
+{
+    b->edges = (CycleEdge *)realloc(b->edges, (b->numedges+1) * sizeof(CycleEdge));
+    b->edges[b->numedges].to = to;
+    b->edges[b->numedges].cost = cost;
+    b->numedges++;
+}
+
+static void
+AddRepLoop(int block, Cycles iter, int count)
+{
+    if (numRepLoops == maxRepLoops) {
+        maxRepLoops = maxRepLoops ? 2*maxRepLoops : 16;
+        repLoops = (RepLoop *)realloc(repLoops, maxRepLoops * sizeof(RepLoop));
+    }
+    repLoops[numRepLoops].block = block;
+    repLoops[numRepLoops].iter = iter;
+    repLoops[numRepLoops].count = count;
+    numRepLoops++;
+}
+
+static IR *
+RepeatEnd(IR *rep, IR *end)
+{
+    IR *ir;
+    for (ir = rep->next; ir && ir != end; ir = ir->next) {
+        if (ir->opc == OPC_REPEAT_END) {
+            return ir;
+        }
+    }
+    return NULL;
+}
+
+//
+// split the instructions from start up to (but not including) end
+// into basic blocks
+//
+static void
+SplitBlocks(IR *start, IR *end, const char *name, int funcloc)
+{
+    IR *ir;
+    CycleBlock *cur;
+    const char *label = name;
+    int offset = 0;
+    bool split = false;
+
+    cur = NewBlock(start, name, 0, funcloc);
+    AddLabel(&blockLabels, start->dst, 0);
+    for (ir = start->next; ir && ir != end; ir = ir->next) {
+        if (ir->opc == OPC_LABEL) {
+            label = ir->dst->name;
+            offset = 0;
+            if (cur->real) {
+                cur = NewBlock(ir, label, 0, funcloc);
+            } else {
+                // several labels in a row all name the same block
+                cur->label = label;
+                cur->offset = 0;
+            }
+            if (ir->line) {
+                cur->line = ir->line;
+            }
+            AddLabel(&blockLabels, ir->dst, numBlocks-1);
+            split = false;
+        } else if (IsInstruction(ir) || ir->opc == OPC_FCACHE) {
+            if (split) {
+                cur = NewBlock(ir, label, offset, funcloc);
+                split = false;
+            }
+            if (!cur->real) {
+                cur->loc = ir->fcache ? LOC_COG : funcloc;
+                if (!cur->line) {
+                    cur->line = ir->line;
+                }
+            }
+            cur->real = true;
+            offset++;
+            if (ir->opc == OPC_REPEAT) {
+                IR *repend = RepeatEnd(ir, end);
+                if (repend) {
+                    ir = repend;
+                }
+            }
+            split = EndsBlock(ir);
+        }
+        cur->last = ir;
+    }
+}
+
+static int
+TargetBlock(Operand *dst)
+{
+    return LookupLabel(&blockLabels, dst);
+}
+
+static int
+TargetLoc(CycleBlock *b, Operand *dst, int blk)
+{
+    int idx;
+    Function *f;
+    if (blk >= 0) {
+        return blocks[blk].loc;
+    }
+    idx = LookupLabel(&funcLabels, dst);
+    if (idx >= 0) {
+        f = funcList[idx];
+        if (f->code_placement == CODE_PLACE_LUT) return LOC_LUT;
+        if (f->code_placement == CODE_PLACE_COG) return LOC_COG;
+        return LOC_HUB;
+    }
+    return b->loc;
+}
+
+//
+// the entries of a jump table follow an indirect jump
+//
+static bool
+AddJumpTableEdges(int i, Cycles cost)
+{
+    int j;
+    bool found = false;
+    for (j = i+1; j < numBlocks; j++) {
+        CycleBlock *t = &blocks[j];
+        if (!t->real) continue;
+        if (!(t->last->flags & FLAG_JMPTABLE_INSTR)) break;
+        AddEdge(&blocks[i], j, cost);
+        found = true;
+    }
+    return found;
+}
+
+//
+// work out the cost of each block and the edges between them
+//
+static void
+TimeBlocks(void)
+{
+    int i;
+    IR *ir;
+    CycleBlock *b;
+    Cycles next, taken;
+    CordicState Q;
+    bool fallthrough;
+
+    for (i = 0; i < numBlocks; i++) {
+        b = &blocks[i];
+        memset(&Q, 0, sizeof(Q));
+        b->body = Cyc(0, 0);
+        fallthrough = true;
+        for (ir = b->first; ir; ir = ir->next) {
+            int loc = ir->fcache ? LOC_COG : b->loc;
+            Operand *dst = NULL;
+            int to = -1;
+            int toloc;
+
+            if (IsBranch(ir) && ir->opc != OPC_REPEAT && ir->opc != OPC_REPEAT_END) {
+                dst = JumpDest(ir);
+                to = TargetBlock(dst);
+            }
+            toloc = TargetLoc(b, dst, to);
+            InstrCycles(ir, loc, toloc, to >= 0, &Q, &next, &taken);
+            if (ir->opc == OPC_REPEAT) {
+                // a hardware loop: the body runs count times with no
+                // branch overhead (except that from hub the FIFO reloads)
+                IR *repend = RepeatEnd(ir, b->last->next);
+                Cycles iter = Cyc(0, 0);
+                Cycles inext, itaken;
+                int count = -1;
+                IR *body;
+                CycAdd(&b->body, next);
+                if (ir->src && ir->src->kind == IMM_INT) {
+                    count = ir->src->val;
+                }
+                for (body = ir->next; body && body != repend; body = body->next) {
+                    InstrCycles(body, loc, loc, true, &Q, &inext, &itaken);
+                    CycAdd(&iter, inext);
+                }
+                if (loc == LOC_HUB) {
+                    CycAdd(&iter, Cyc(13, 20));
+                }
+                AddRepLoop(i, iter, count);
+                if (count > 0) {
+                    b->body.min = CycSum(b->body.min, CycTimes(iter.min, count));
+                    b->body.max = CycSum(b->body.max, CycTimes(iter.max, count));
+                } else {
+                    // the count is in a register, so all we know is
+                    // that the body runs at least once; rep #0 never
+                    // stops at all
+                    b->body.min = CycSum(b->body.min, iter.min);
+                    b->body.max = CYC_UNBOUNDED;
+                    if (count == 0) {
+                        fallthrough = false;
+                    }
+                }
+                if (!repend) break;
+                ir = repend;
+                if (ir == b->last) break;
+                continue;
+            }
+            if (ir == b->last && EndsBlock(ir)) {
+                bool always = (ir->cond == COND_TRUE && ir->opc != OPC_DJNZ && ir->opc != OPC_GENERIC_BRCOND);
+                if (ir->opc == OPC_RET) {
+                    AddEdge(b, -1, taken);
+                } else if (to >= 0) {
+                    AddEdge(b, to, taken);
+                } else if (ir->opc == OPC_JMPREL || (dst && IsRegister(dst->kind))) {
+                    if (!AddJumpTableEdges(i, taken)) {
+                        b->unknown = true;
+                    }
+                } else {
+                    // a jump to some other function (a tail call)
+                    AddEdge(b, -1, taken);
+                }
+                if (always) {
+                    fallthrough = false;
+                } else {
+                    AddEdge(b, i+1 < numBlocks ? i+1 : -1, next);
+                }
+                break;
+            }
+            CycAdd(&b->body, next);
+            if (ir == b->last) break;
+        }
+        if (fallthrough && (b->numedges == 0) && !b->unknown) {
+            Cycles cost = Cyc(0, 0);
+            if (i+1 < numBlocks && b->loc != LOC_HUB && blocks[i+1].loc == LOC_HUB) {
+                // leaving an FCACHE loop for hub code
+                cost = gl_p2 ? Cyc(13, 20) : Cyc(20, 36);
+            }
+            AddEdge(b, i+1 < numBlocks ? i+1 : -1, cost);
+        }
+    }
+}
+
+//
+// path searches
+//
+
+static void
+MarkReached(int i)
+{
+    int e;
+    if (i < 0 || blocks[i].reached) return;
+    blocks[i].reached = true;
+    for (e = 0; e < blocks[i].numedges; e++) {
+        MarkReached(blocks[i].edges[e].to);
+    }
+}
+
+// does the edge end a path? (leaving the function, or going back
+// to the loop header)
+static bool
+IsPathEnd(int to, int header)
+{
+    return header < 0 ? to < 0 : to == header;
+}
+
+//
+// shortest path from start to the end (the function exit, or the loop
+// header if header >= 0), only going through blocks in "allowed"
+//
+static unsigned long
+MinPath(int start, int header, const char *allowed)
+{
+    unsigned long best = CYC_NOPATH;
+    unsigned long *dist = (unsigned long *)malloc(numBlocks * sizeof(unsigned long));
+    int *todo = (int *)malloc(numBlocks * sizeof(int));
+    int numtodo = 0;
+    int i, e, u, k;
+
+    for (i = 0; i < numBlocks; i++) {
+        dist[i] = CYC_NOPATH;
+        if (allowed[i]) todo[numtodo++] = i;
+    }
+    dist[start] = 0;
+    while (numtodo > 0) {
+        unsigned long d;
+        k = 0;
+        for (i = 1; i < numtodo; i++) {
+            if (dist[todo[i]] < dist[todo[k]]) k = i;
+        }
+        u = todo[k];
+        if (dist[u] == CYC_NOPATH) break;
+        todo[k] = todo[--numtodo];
+        d = dist[u] + blocks[u].body.min;
+        if (blocks[u].unknown && header < 0 && d < best) {
+            best = d;
+        }
+        for (e = 0; e < blocks[u].numedges; e++) {
+            CycleEdge *E = &blocks[u].edges[e];
+            unsigned long nd = d + E->cost.min;
+            if (IsPathEnd(E->to, header)) {
+                if (nd < best) best = nd;
+            } else if (E->to >= 0 && allowed[E->to] && nd < dist[E->to]) {
+                dist[E->to] = nd;
+            }
+        }
+    }
+    free(dist);
+    free(todo);
+    return best;
+}
+
+//
+// longest path from block i to the end; CYC_UNBOUNDED if it may go
+// round a cycle, CYC_NOPATH if the end cannot be reached
+//
+static unsigned long
+MaxPath(int i, int header, const char *allowed)
+{
+    CycleBlock *b = &blocks[i];
+    unsigned long best = CYC_NOPATH;
+    unsigned long p;
+    int e;
+
+    if (b->dfsState == 2) return b->path;
+    if (b->dfsState == 1) return CYC_UNBOUNDED;
+    b->dfsState = 1;
+    if (b->unknown) {
+        best = CYC_UNBOUNDED;
+    }
+    for (e = 0; e < b->numedges && best != CYC_UNBOUNDED; e++) {
+        CycleEdge *E = &b->edges[e];
+        if (IsPathEnd(E->to, header)) {
+            p = E->cost.max;
+        } else if (E->to >= 0 && allowed[E->to]) {
+            p = MaxPath(E->to, header, allowed);
+            if (p == CYC_NOPATH) continue;
+            p = CycSum(p, E->cost.max);
+        } else {
+            continue;
+        }
+        if (best == CYC_NOPATH || p == CYC_UNBOUNDED || p > best) {
+            best = p;
+        }
+    }
+    if (best != CYC_NOPATH) {
+        best = CycSum(best, b->body.max);
+    }
+    b->dfsState = 2;
+    b->path = best;
+    return best;
+}
+
+static unsigned long
+MaxPathFrom(int start, int header, const char *allowed)
+{
+    int i;
+    for (i = 0; i < numBlocks; i++) {
+        blocks[i].dfsState = 0;
+    }
+    return MaxPath(start, header, allowed);
+}
+
+//
+// find the back edges (edges to a block that is still being searched);
+// their targets are loop headers
+//
+static int *backFrom;
+static int *backTo;
+static int numBackEdges;
+
+static void
+FindBackEdges(int i)
+{
+    CycleBlock *b = &blocks[i];
+    int e;
+    b->dfsState = 1;
+    for (e = 0; e < b->numedges; e++) {
+        int to = b->edges[e].to;
+        if (to < 0) continue;
+        if (blocks[to].dfsState == 1) {
+            backFrom = (int *)realloc(backFrom, (numBackEdges+1) * sizeof(int));
+            backTo = (int *)realloc(backTo, (numBackEdges+1) * sizeof(int));
+            backFrom[numBackEdges] = i;
+            backTo[numBackEdges] = to;
+            numBackEdges++;
+        } else if (blocks[to].dfsState == 0) {
+            FindBackEdges(to);
+        }
+    }
+    b->dfsState = 2;
+}
+
+//
+// mark the body of the loop with the given header: the header, and
+// the blocks that reach one of its back edges without passing through it
+//
+static void
+MarkLoopBody(int header, char *body)
+{
+    int *work = (int *)malloc(numBlocks * sizeof(int));
+    int n = 0;
+    int i, j, e;
+
+    memset(body, 0, numBlocks);
+    body[header] = 1;
+    for (i = 0; i < numBackEdges; i++) {
+        if (backTo[i] == header && !body[backFrom[i]]) {
+            body[backFrom[i]] = 1;
+            work[n++] = backFrom[i];
+        }
+    }
+    while (n > 0) {
+        i = work[--n];
+        // look for predecessors of i
+        for (j = 0; j < numBlocks; j++) {
+            if (body[j] || !blocks[j].reached) continue;
+            for (e = 0; e < blocks[j].numedges; e++) {
+                if (blocks[j].edges[e].to == i) {
+                    body[j] = 1;
+                    work[n++] = j;
+                    break;
+                }
+            }
+        }
+    }
+    free(work);
+}
+
+//
+// JSON output
+//
+static void
+PrintJsonString(FILE *f, const char *s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+            fputc(*s, f);
+        } else if ((unsigned char)*s < ' ') {
+            fprintf(f, "\\u%04x", (unsigned char)*s);
+        } else {
+            fputc(*s, f);
+        }
+    }
+    fputc('"', f);
+}
+
+static void
+PrintCount(FILE *f, unsigned long n)
+{
+    if (n == CYC_UNBOUNDED || n == CYC_NOPATH) {
+        fprintf(f, "null");
+    } else {
+        fprintf(f, "%lu", n);
+    }
+}
+
+static void
+PrintBlockPlace(FILE *f, CycleBlock *b)
+{
+    LineInfo *info;
+    const char *fname, *s;
+
+    fprintf(f, "\"label\": ");
+    if (b->offset) {
+        const char *label = AsmLabelName(b->label);
+        char *buf = (char *)malloc(strlen(label) + 16);
+        sprintf(buf, "%s+%d", label, b->offset);
+        PrintJsonString(f, buf);
+        free(buf);
+    } else {
+        PrintJsonString(f, AsmLabelName(b->label));
+    }
+    info = b->line ? GetLineInfo(b->line) : NULL;
+    if (info && info->fileName) {
+        // same file:line naming as --profile-use
+        char *buf;
+        fname = info->fileName;
+        for (s = fname; *s; s++) {
+            if (*s == '/' || *s == '\\') {
+                fname = s+1;
+            }
+        }
+        buf = (char *)malloc(strlen(fname) + 16);
+        sprintf(buf, "%s:%d", fname, info->lineno);
+        fprintf(f, ", \"line\": ");
+        PrintJsonString(f, buf);
+        free(buf);
+    }
+}
+
+static void
+PrintCalls(FILE *f, IR *start, IR *end)
+{
+    LabelTable seen;
+    IR *ir;
+    bool first = true;
+
+    memset(&seen, 0, sizeof(seen));
+    fprintf(f, "      \"calls\": [");
+    for (ir = start; ir && ir != end; ir = ir->next) {
+        if (ir->opc != OPC_CALL || IsDummy(ir) || !ir->dst || IsRegister(ir->dst->kind)) {
+            continue;
+        }
+        // only list each function once
+        if (LookupLabel(&seen, ir->dst) >= 0) {
+            continue;
+        }
+        AddLabel(&seen, ir->dst, 0);
+        if (!first) fprintf(f, ", ");
+        PrintJsonString(f, AsmLabelName(ir->dst->name));
+        first = false;
+    }
+    fprintf(f, "],\n");
+    ClearLabels(&seen);
+}
+
+// returns true if an entry was written for the function
+static bool
+ReportFunction(FILE *f, const char *name, IR *start, IR *end, int funcloc, bool firstfunc)
+{
+    int i, j;
+    char *allowed;
+    bool first;
+    unsigned long fmin, fmax;
+
+    numBlocks = 0;
+    numRepLoops = 0;
+    SplitBlocks(start, end, name, funcloc);
+    if (numBlocks <= 0) {
+        ClearLabels(&blockLabels);
+        return false;
+    }
+    TimeBlocks();
+    MarkReached(0);
+
+    allowed = (char *)calloc((size_t)numBlocks, 1);
+    if (!allowed) {
+        ERROR(NULL, "out of memory");
+        for (i = 0; i < numBlocks; i++) {
+            free(blocks[i].edges);
+        }
+        ClearLabels(&blockLabels);
+        return false;
+    }
+    for (i = 0; i < numBlocks; i++) {
+        allowed[i] = blocks[i].reached;
+    }
+    fmin = MinPath(0, -1, allowed);
+    fmax = MaxPathFrom(0, -1, allowed);
+
+    fprintf(f, "%s    {\n", firstfunc ? "" : ",\n");
+    fprintf(f, "      \"name\": ");
+    PrintJsonString(f, AsmLabelName(name));
+    fprintf(f, ",\n      \"placement\": \"%s\",\n", locName[funcloc]);
+    fprintf(f, "      \"min\": ");
+    PrintCount(f, fmin);
+    fprintf(f, ",\n      \"max\": ");
+    PrintCount(f, fmax);
+    fprintf(f, ",\n");
+    PrintCalls(f, start, end);
+
+    fprintf(f, "      \"blocks\": [");
+    first = true;
+    for (i = 0; i < numBlocks; i++) {
+        CycleBlock *b = &blocks[i];
+        Cycles c = b->body;
+        unsigned long emin = CYC_NOPATH, emax = 0;
+        if (!b->reached || !b->real) continue;
+        for (j = 0; j < b->numedges; j++) {
+            if (b->edges[j].cost.min < emin) emin = b->edges[j].cost.min;
+            if (b->edges[j].cost.max > emax) emax = b->edges[j].cost.max;
+        }
+        if (b->numedges) {
+            c.min = CycSum(c.min, emin);
+            c.max = CycSum(c.max, emax);
+        }
+        if (b->unknown) {
+            c.max = CYC_UNBOUNDED;
+        }
+        fprintf(f, "%s\n        { ", first ? "" : ",");
+        PrintBlockPlace(f, b);
+        fprintf(f, ", \"min\": ");
+        PrintCount(f, c.min);
+        fprintf(f, ", \"max\": ");
+        PrintCount(f, c.max);
+        fprintf(f, " }");
+        first = false;
+    }
+    fprintf(f, "%s],\n", first ? "" : "\n      ");
+
+    // loops made of branches, one iteration each
+    fprintf(f, "      \"loops\": [");
+    first = true;
+    for (i = 0; i < numBlocks; i++) blocks[i].dfsState = 0;
+    numBackEdges = 0;
+    FindBackEdges(0);
+    for (i = 0; i < numBlocks; i++) {
+        unsigned long lmin, lmax;
+        for (j = 0; j < numBackEdges && backTo[j] != i; j++)
+            ;
+        if (j == numBackEdges) continue;
+        MarkLoopBody(i, allowed);
+        lmin = MinPath(i, i, allowed);
+        lmax = MaxPathFrom(i, i, allowed);
+        fprintf(f, "%s\n        { ", first ? "" : ",");
+        PrintBlockPlace(f, &blocks[i]);
+        fprintf(f, ", \"min\": ");
+        PrintCount(f, lmin);
+        fprintf(f, ", \"max\": ");
+        PrintCount(f, lmax);
+        fprintf(f, ", \"iterations\": null }");
+        first = false;
+    }
+    // and hardware (REP) loops
+    for (i = 0; i < numRepLoops; i++) {
+        RepLoop *R = &repLoops[i];
+        if (!blocks[R->block].reached) continue;
+        fprintf(f, "%s\n        { ", first ? "" : ",");
+        PrintBlockPlace(f, &blocks[R->block]);
+        fprintf(f, ", \"min\": ");
+        PrintCount(f, R->iter.min);
+        fprintf(f, ", \"max\": ");
+        PrintCount(f, R->iter.max);
+        fprintf(f, ", \"iterations\": ");
+        if (R->count > 0) {
+            fprintf(f, "%d", R->count);
+        } else {
+            fprintf(f, "null");
+        }
+        fprintf(f, " }");
+        first = false;
+    }
+    fprintf(f, "%s]\n    }", first ? "" : "\n      ");
+
+    for (i = 0; i < numBlocks; i++) {
+        free(blocks[i].edges);
+    }
+    free(allowed);
+    ClearLabels(&blockLabels);
+    return true;
+}
+
+//
+// remember the entry label of every function compiled to assembly
+//
+static void
+CollectFunction(Function *pf)
+{
+    if (!pf->bedata || !FuncData(pf)->asmname) {
+        return;
+    }
+    funcList = (Function **)realloc(funcList, (numFuncs+1) * sizeof(Function *));
+    funcList[numFuncs] = pf;
+    AddLabel(&funcLabels, FuncData(pf)->asmname, numFuncs);
+    numFuncs++;
+}
+
+static void
+CollectFunctions(void)
+{
+    Module *Q;
+    Function *pf;
+
+    for (Q = allparse; Q; Q = Q->next) {
+        for (pf = Q->functions; pf; pf = pf->next) {
+            CollectFunction(pf);
+        }
+    }
+    if (systemModule) {
+        for (pf = systemModule->functions; pf; pf = pf->next) {
+            CollectFunction(pf);
+        }
+    }
+}
+
+//
+// write the cycle report for the final code in irl to fname
+//
+void
+WriteCycleReport(const char *fname, IRList *irl)
+{
+    FILE *f;
+    IR *ir;
+    IR *start = NULL;
+    const char *name = NULL;
+    int loc = LOC_COG;
+    int funcloc = LOC_COG;
+    bool firstfunc = true;
+    bool haveInstr = false;
+
+    f = fopen(fname, "w");
+    if (!f) {
+        ERROR(NULL, "Unable to open cycle report %s", fname);
+        return;
+    }
+    CollectFunctions();
+
+    fprintf(f, "{\n  \"processor\": \"%s\",\n  \"functions\": [\n", gl_p2 ? "P2" : "P1");
+    for (ir = irl->head; ir; ir = ir->next) {
+        bool newloc = false;
+        bool newfunc = false;
+        int idx = -1;
+
+        if (ir->opc == OPC_HUBMODE) {
+            loc = LOC_HUB;
+            newloc = true;
+        } else if (ir->opc == OPC_ORG) {
+            loc = (gl_p2 && ir->dst && ir->dst->kind == IMM_INT && ir->dst->val >= 0x200) ? LOC_LUT : LOC_COG;
+            newloc = true;
+        } else if (ir->opc == OPC_LABEL) {
+            idx = LookupLabel(&funcLabels, ir->dst);
+            newfunc = (idx >= 0);
+        }
+        if (start && (newloc || (newfunc && haveInstr))) {
+            if (ReportFunction(f, name, start, ir, funcloc, firstfunc)) {
+                firstfunc = false;
+            }
+            start = NULL;
+        }
+        if (newfunc) {
+            // labels of duplicate functions come just before the
+            // real one, so the last of them names the function
+            if (!start) {
+                start = ir;
+                funcloc = loc;
+                haveInstr = false;
+            }
+            name = ir->dst->name;
+        } else if (start && IsInstruction(ir)) {
+            haveInstr = true;
+        }
+    }
+    if (start) {
+        ReportFunction(f, name, start, NULL, funcloc, firstfunc);
+    }
+    fprintf(f, "\n  ]\n}\n");
+    fclose(f);
+
+    ClearLabels(&funcLabels);
+    free(funcList);
+    funcList = NULL;
+    numFuncs = 0;
+}
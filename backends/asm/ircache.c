@@ -0,0 +1,952 @@
+//
+// On-disk cache of optimized function IR
+//
+// Copyright 2026 Total Spectrum Software Inc.
+// see the file COPYING for conditions of redistribution
+//
+// OptimizeIRLocal is usually the most expensive part of compiling
+// a function, and the same library functions get compiled again on
+// every run. If a cache directory is given (--cache-dir), the
+// unoptimized IR of each function is hashed together with everything
+// the optimizer looks at, and the optimized IR is saved under that hash.
+// A later compile that produces the same IR can then skip the optimizer.
+// Parsing, type checking and IR generation are still done every time;
+// only the optimizer's work is saved.
+//
+// IR refers to operands by pointer, so operands are described by the
+// order in which they first appear. On a cache hit the n'th operand of
+// the new IR plays the same part as the n'th operand the cached code was
+// built from, so the optimized IR is rebuilt using the live operands.
+// Temporary names are numbered by a global counter, so the numbers in
+// them are left out of the hash (but which names are equal is kept);
+// user identifiers are hashed exactly, even if they end in digits.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "spinc.h"
+#include "outasm.h"
+#include "version.h"
+#include "util/sha256.h"
+#include "util/ptrmap.h"
+
+#define IRCACHE_MAGIC "FIRC"
+
+// increase this whenever the cache file layout, or anything in the
+// optimizer that changes its output, is changed, so that entries made
+// by older compilers are no longer used
+#define IRCACHE_FORMAT_VERSION 1
+
+const char *gl_ircache_dir;
+
+/* statistics */
+static unsigned cacheLookups, cacheHits, cacheStores, cacheUncachable;
+
+//
+// maps from pointers (or string contents) to small integers
+//
+typedef PtrMap CacheMap;
+
+static void
+CacheMapClear(CacheMap *M)
+{
+    ptrmap_clear(M);
+}
+
+static int
+CacheMapFind(CacheMap *M, const void *key)
+{
+    intptr_t val;
+    return ptrmap_find(M, key, &val) ? (int)val : -1;
+}
+
+static void
+CacheMapAdd(CacheMap *M, const void *key, int val)
+{
+    ptrmap_add(M, key, val);
+}
+
+//
+// state kept between IRCacheLookup and IRCacheStore
+//
+typedef struct CacheOperand {
+    Operand *op;
+    // contents at lookup time, so we can tell if the optimizer
+    // modified the operand in place
+    Operandkind kind;
+    const char *name;
+    intptr_t val;
+    int size;
+} CacheOperand;
+
+static Flexbuf opTable;        // CacheOperand
+static Flexbuf funcTable;      // Function *
+static Flexbuf lineTable;      // AST *
+static CacheMap opMap, funcMap, lineMap;
+static CacheMap nameMap = { .strkeys = 1 };  // name -> first operand with it
+
+static int instrCount;
+static bool keyValid;
+static int keyWarnings;
+static unsigned char cacheKey[SHA256_BLOCK_SIZE];
+
+extern Instruction *instr; // in lexer.c
+
+#define OPTABLE(i) (((CacheOperand *)flexbuf_peek(&opTable))[i])
+#define FUNCTABLE(i) (((Function **)flexbuf_peek(&funcTable))[i])
+#define LINETABLE(i) (((AST **)flexbuf_peek(&lineTable))[i])
+
+// operand kinds whose "name" is really a pointer to another operand
+static bool
+NameIsOperand(Operandkind kind)
+{
+    return kind == REG_SUBREG || kind == HUBMEM_REF || kind == COGMEM_REF;
+}
+
+// operand kinds whose "val" is really a pointer to another operand
+static bool
+ValIsOperand(Operandkind kind)
+{
+    return kind == REG_HUBPTR || kind == REG_COGPTR;
+}
+
+// operand kinds whose "val" points at data the optimizer never inspects
+static bool
+ValIsOpaque(Operandkind kind)
+{
+    switch (kind) {
+    case IMM_BINARY:
+    case STRING_DEF:
+    case LONG_DEF:
+    case WORD_DEF:
+    case BYTE_DEF:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool
+HasStringName(Operandkind kind)
+{
+    return !NameIsOperand(kind) && kind != IMM_BINARY;
+}
+
+static void
+HashInt(SHA256_CTX *ctx, int64_t x)
+{
+    sha256_update(ctx, (unsigned char *)&x, sizeof(x));
+}
+
+//
+// hash a name; generated temporary names are numbered by a global
+// counter, so for those the counter is left out
+//
+static void
+HashName(SHA256_CTX *ctx, const char *name)
+{
+    const char *counter = TemporaryNameCounter(name);
+
+    if (counter) {
+        sha256_update(ctx, (unsigned char *)name, counter - name);
+        sha256_update(ctx, (unsigned char *)"_#", 2);
+    } else {
+        sha256_update(ctx, (unsigned char *)name, strlen(name));
+    }
+    HashInt(ctx, 0);
+}
+
+static int
+AddFunction(SHA256_CTX *ctx, Function *f)
+{
+    int idx;
+    IRFuncData *fdata;
+
+    if (!f) {
+        HashInt(ctx, -1);
+        return -1;
+    }
+    idx = CacheMapFind(&funcMap, f);
+    if (idx >= 0) {
+        HashInt(ctx, idx);
+        return idx;
+    }
+    idx = funcMap.count;
+    flexbuf_addmem(&funcTable, (const char *)&f, sizeof(f));
+    CacheMapAdd(&funcMap, f, idx);
+    // these are what the optimizer looks at in called functions
+    fdata = FuncData(f);
+    HashInt(ctx, 'f');
+    HashInt(ctx, f->numparams);
+    HashInt(ctx, f->is_leaf);
+    HashInt(ctx, fdata ? fdata->effectivelyLeaf : -1);
+    HashInt(ctx, fdata ? fdata->maxClobberArg : -1);
+    return idx;
+}
+
+static int
+AddOperand(SHA256_CTX *ctx, Operand *op)
+{
+    CacheOperand entry;
+    int idx;
+
+    if (!op) {
+        HashInt(ctx, -1);
+        return -1;
+    }
+    idx = CacheMapFind(&opMap, op);
+    if (idx >= 0) {
+        HashInt(ctx, idx);
+        return idx;
+    }
+    HashInt(ctx, 'o');
+    HashInt(ctx, op->kind);
+    HashInt(ctx, op->size);
+    if (NameIsOperand(op->kind)) {
+        AddOperand(ctx, (Operand *)op->name);
+    } else if (HasStringName(op->kind) && op->name) {
+        idx = CacheMapFind(&nameMap, op->name);
+        HashInt(ctx, idx);
+        HashName(ctx, op->name);
+    } else {
+        HashInt(ctx, -2);
+    }
+    if (ValIsOperand(op->kind)) {
+        AddOperand(ctx, (Operand *)op->val);
+    } else if (ValIsOpaque(op->kind)) {
+        HashInt(ctx, -2);
+    } else if (op->kind == IMM_HUB_LABEL && op->val) {
+        // the assembly name of a function points back at it
+        AddFunction(ctx, (Function *)op->val);
+    } else {
+        HashInt(ctx, op->val);
+    }
+
+    idx = opMap.count;
+    entry.op = op;
+    entry.kind = op->kind;
+    entry.name = op->name;
+    entry.val = op->val;
+    entry.size = op->size;
+    flexbuf_addmem(&opTable, (const char *)&entry, sizeof(entry));
+    CacheMapAdd(&opMap, op, idx);
+    if (HasStringName(op->kind) && op->name && CacheMapFind(&nameMap, op->name) < 0) {
+        CacheMapAdd(&nameMap, op->name, idx);
+    }
+    return idx;
+}
+
+static int
+AddLine(AST *line)
+{
+    int idx;
+    if (!line) return -1;
+    idx = CacheMapFind(&lineMap, line);
+    if (idx < 0) {
+        idx = lineMap.count;
+        flexbuf_addmem(&lineTable, (const char *)&line, sizeof(line));
+        CacheMapAdd(&lineMap, line, idx);
+    }
+    return idx;
+}
+
+static int
+InstrIndex(Instruction *in)
+{
+    if (!in) return -1;
+    if (!instrCount) {
+        while (instr[instrCount].name) {
+            instrCount++;
+        }
+    }
+    if (in < instr || in >= instr + instrCount) {
+        return -2;
+    }
+    return (int)(in - instr);
+}
+
+static void
+ResetTables(void)
+{
+    flexbuf_clear(&opTable);
+    flexbuf_clear(&funcTable);
+    flexbuf_clear(&lineTable);
+    CacheMapClear(&opMap);
+    CacheMapClear(&funcMap);
+    CacheMapClear(&lineMap);
+    CacheMapClear(&nameMap);
+}
+
+//
+// compute the key for function f, whose unoptimized IR is in irl
+// returns false if the function cannot be cached
+//
+static bool
+ComputeKey(IRList *irl, Function *f)
+{
+    SHA256_CTX ctx;
+    IRFuncData *fdata = FuncData(f);
+    IR *ir;
+    int idx;
+
+    ResetTables();
+    sha256_init(&ctx);
+
+    // entries are only good for the compiler version that made them
+    HashInt(&ctx, IRCACHE_FORMAT_VERSION);
+    sha256_update(&ctx, (unsigned char *)version_string, strlen(version_string));
+    HashInt(&ctx, sizeof(void *));
+    HashInt(&ctx, gl_p2);
+    HashInt(&ctx, gl_output);
+    HashInt(&ctx, gl_optimize_flags);
+    HashInt(&ctx, gl_compress);
+    HashInt(&ctx, gl_lmm_kind);
+    HashInt(&ctx, gl_fcache_size);
+    HashInt(&ctx, gl_cenv_flags);
+
+    HashInt(&ctx, f->optimize_flags);
+    HashInt(&ctx, f->is_leaf);
+    HashInt(&ctx, f->has_throw);
+    HashInt(&ctx, f->numresults);
+    HashInt(&ctx, f->numparams);
+    HashInt(&ctx, f->local_address_taken);
+    HashInt(&ctx, f->code_placement);
+
+    // the optimizer may refer to these even if the IR does not
+    AddOperand(&ctx, fdata->asmname);
+    AddOperand(&ctx, fdata->asmretname);
+    AddOperand(&ctx, fdata->asmreturnlabel);
+    AddOperand(&ctx, fdata->asmentername);
+
+    for (ir = irl->head; ir; ir = ir->next) {
+        HashInt(&ctx, ir->opc);
+        HashInt(&ctx, ir->cond);
+        HashInt(&ctx, ir->flags);
+        HashInt(&ctx, ir->srceffect);
+        HashInt(&ctx, ir->dsteffect);
+        idx = InstrIndex(ir->instr);
+        if (idx == -2) {
+            return false;
+        }
+        HashInt(&ctx, idx);
+        AddOperand(&ctx, ir->dst);
+        AddOperand(&ctx, ir->src);
+        AddOperand(&ctx, ir->src2);
+        AddOperand(&ctx, ir->fcache);
+        HashInt(&ctx, AddLine(ir->line));
+        if (ir->opc == OPC_CALL) {
+            AddFunction(&ctx, (Function *)ir->aux);
+        }
+    }
+    sha256_final(&ctx, cacheKey);
+    return true;
+}
+
+static char *
+CacheFileName(void)
+{
+    static const char hexdigit[] = "0123456789abcdef";
+    char hex[2*SHA256_BLOCK_SIZE+6];
+    char *r;
+    size_t len = strlen(gl_ircache_dir);
+    int i;
+
+    for (i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        hex[2*i] = hexdigit[cacheKey[i] >> 4];
+        hex[2*i+1] = hexdigit[cacheKey[i] & 15];
+    }
+    strcpy(hex + 2*SHA256_BLOCK_SIZE, ".fir");
+    r = (char *)malloc(len + sizeof(hex) + 1);
+    strcpy(r, gl_ircache_dir);
+    if (len > 0 && r[len-1] != '/' && r[len-1] != '\\') {
+        r[len++] = '/';
+    }
+    strcpy(r + len, hex);
+    return r;
+}
+
+//
+// serialized form
+//
+// header:  magic, key (which covers the compiler build)
+// operands the optimizer created:
+//    count, then for each: kind, val, used, name
+// IR:
+//    count, then for each: opc, cond, flags, srceffect, dsteffect, addr,
+//    instr, dst, src, src2, fcache, line, aux
+// operand references are 0 for NULL, i+1 for existing operand i,
+// and -(i+1) for created operand i
+//
+enum {
+    NAME_NONE,
+    NAME_OPERAND,   // same as the name of existing operand n
+    NAME_TEMP,      // the n'th new temporary label name
+    NAME_LITERAL,   // literal string follows
+};
+
+enum {
+    AUX_NONE,
+    AUX_IR,         // index of an instruction in the list
+    AUX_FUNC,       // index of a called function
+    AUX_JUMPS,      // list of jumps to this label
+};
+
+static void
+PutInt(Flexbuf *fb, int64_t x)
+{
+    flexbuf_addmem(fb, (const char *)&x, sizeof(x));
+}
+
+typedef struct CacheReader {
+    const char *data;
+    size_t len;
+    size_t pos;
+    bool failed;
+} CacheReader;
+
+static int64_t
+GetInt(CacheReader *R)
+{
+    int64_t x;
+    if (R->failed || R->pos + sizeof(x) > R->len) {
+        R->failed = true;
+        return 0;
+    }
+    memcpy(&x, R->data + R->pos, sizeof(x));
+    R->pos += sizeof(x);
+    return x;
+}
+
+// check that a value read is in the range [lo, hi)
+static int
+GetIndex(CacheReader *R, int lo, int hi)
+{
+    int64_t x = GetInt(R);
+    if (x < lo || x >= hi) {
+        R->failed = true;
+        return lo;
+    }
+    return (int)x;
+}
+
+//
+// a cache entry as read from the file; nothing is created from it
+// until the whole entry has been checked
+//
+typedef struct FreshRecord {
+    Operandkind kind;
+    intptr_t val;
+    int used;
+    int nametype;
+    int name;          // operand or temporary index, or offset of literal
+    int namelen;       // length of literal
+} FreshRecord;
+
+typedef struct IRRecord {
+    IROpcode opc;
+    IRCond cond;
+    int flags;
+    enum OperandEffect srceffect;
+    enum OperandEffect dsteffect;
+    unsigned addr;
+    int instr;
+    int refs[4];       // dst, src, src2, fcache
+    int line;
+    int auxkind;
+    int aux;           // index, or number of jumps for AUX_JUMPS
+    int jumps;         // index of the first jump in jumpList
+} IRRecord;
+
+//
+// read and check a cache entry, filling in fresh, irs and jumps;
+// returns false if the entry is damaged or does not fit the
+// current function
+//
+static bool
+ReadCacheEntry(CacheReader *R, Flexbuf *freshfb, Flexbuf *irfb, Flexbuf *jumpfb)
+{
+    int numops = opMap.count;
+    int numfuncs = funcMap.count;
+    int numlines = lineMap.count;
+    int numfresh, numir;
+    int i, j, n;
+
+    // operands created by the optimizer
+    numfresh = GetIndex(R, 0, 1<<24);
+    for (i = 0; i < numfresh && !R->failed; i++) {
+        FreshRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.kind = (Operandkind)GetIndex(R, IMM_INT, IMM_PCRELATIVE+1);
+        rec.val = (intptr_t)GetInt(R);
+        rec.used = (int)GetInt(R);
+        rec.nametype = (int)GetInt(R);
+        switch (rec.nametype) {
+        case NAME_NONE:
+            break;
+        case NAME_OPERAND:
+            rec.name = GetIndex(R, 0, numops);
+            break;
+        case NAME_TEMP:
+            rec.name = GetIndex(R, 0, numfresh);
+            break;
+        case NAME_LITERAL:
+            rec.namelen = GetIndex(R, 0, (int)(R->len - R->pos));
+            rec.name = (int)R->pos;
+            R->pos += rec.namelen;
+            break;
+        default:
+            R->failed = true;
+            break;
+        }
+        flexbuf_addmem(freshfb, (const char *)&rec, sizeof(rec));
+    }
+
+    // the instructions themselves
+    numir = GetIndex(R, 0, 1<<24);
+    for (i = 0; i < numir && !R->failed; i++) {
+        IRRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.opc = (IROpcode)GetInt(R);
+        rec.cond = (IRCond)GetInt(R);
+        rec.flags = (int)GetInt(R);
+        rec.srceffect = (enum OperandEffect)GetInt(R);
+        rec.dsteffect = (enum OperandEffect)GetInt(R);
+        rec.addr = (unsigned)GetInt(R);
+        rec.instr = GetIndex(R, -1, instrCount);
+        for (j = 0; j < 4; j++) {
+            rec.refs[j] = GetIndex(R, -numfresh, numops+1);
+        }
+        rec.line = GetIndex(R, -1, numlines);
+        rec.auxkind = (int)GetInt(R);
+        switch (rec.auxkind) {
+        case AUX_NONE:
+            break;
+        case AUX_IR:
+            rec.aux = GetIndex(R, 0, numir);
+            break;
+        case AUX_FUNC:
+            rec.aux = GetIndex(R, 0, numfuncs);
+            break;
+        case AUX_JUMPS:
+            rec.aux = GetIndex(R, 0, numir+1);
+            rec.jumps = flexbuf_curlen(jumpfb) / sizeof(int);
+            for (j = 0; j < rec.aux && !R->failed; j++) {
+                n = GetIndex(R, 0, numir);
+                flexbuf_addmem(jumpfb, (const char *)&n, sizeof(n));
+            }
+            break;
+        default:
+            R->failed = true;
+            break;
+        }
+        flexbuf_addmem(irfb, (const char *)&rec, sizeof(rec));
+    }
+    if (R->pos != R->len) {
+        R->failed = true;
+    }
+    return !R->failed;
+}
+
+//
+// look up function f in the cache
+// if found, replaces the IR in irl with the cached optimized version
+// and returns true
+// otherwise returns false; in that case IRCacheStore should be called
+// after the function is optimized
+//
+static bool
+IRCacheLookup(IRList *irl, Function *f)
+{
+    CacheReader R;
+    FILE *file;
+    char *fname;
+    char *data;
+    long len;
+    int numfresh, numir;
+    int i, j, n;
+    Flexbuf freshfb, irfb, jumpfb;
+    FreshRecord *freshrec;
+    IRRecord *irrec;
+    int *jumps;
+    Operand **fresh;
+    const char **tempnames;
+    IR **irs;
+    bool ok;
+
+    keyValid = false;
+    if (!gl_ircache_dir || !irl->head || gl_errors > 0) {
+        return false;
+    }
+    cacheLookups++;
+    if (!ComputeKey(irl, f)) {
+        cacheUncachable++;
+        return false;
+    }
+    keyValid = true;
+    keyWarnings = gl_warnings;
+
+    fname = CacheFileName();
+    file = fopen(fname, "rb");
+    free(fname);
+    if (!file) {
+        return false;
+    }
+    data = NULL;
+    len = -1;
+    if (fseek(file, 0L, SEEK_END) == 0) {
+        len = ftell(file);
+        rewind(file);
+    }
+    if (len > 0) {
+        data = (char *)malloc(len);
+        if (!data || fread(data, 1, len, file) != (size_t)len) {
+            len = -1;
+        }
+    }
+    fclose(file);
+    if (len <= 0 || len < 4 + SHA256_BLOCK_SIZE
+        || memcmp(data, IRCACHE_MAGIC, 4) != 0
+        || memcmp(data + 4, cacheKey, SHA256_BLOCK_SIZE) != 0)
+    {
+        free(data);
+        return false;
+    }
+    R.data = data;
+    R.len = len;
+    R.pos = 4 + SHA256_BLOCK_SIZE;
+    R.failed = false;
+
+    flexbuf_init(&freshfb, 1024);
+    flexbuf_init(&irfb, 4096);
+    flexbuf_init(&jumpfb, 256);
+    ok = ReadCacheEntry(&R, &freshfb, &irfb, &jumpfb);
+    if (!ok) {
+        goto done;
+    }
+
+    // the entry is good, so now build the IR from it
+    freshrec = (FreshRecord *)flexbuf_peek(&freshfb);
+    numfresh = flexbuf_curlen(&freshfb) / sizeof(FreshRecord);
+    irrec = (IRRecord *)flexbuf_peek(&irfb);
+    numir = flexbuf_curlen(&irfb) / sizeof(IRRecord);
+    jumps = (int *)flexbuf_peek(&jumpfb);
+
+    fresh = (Operand **)calloc(numfresh+1, sizeof(Operand *));
+    tempnames = (const char **)calloc(numfresh+1, sizeof(char *));
+    for (i = 0; i < numfresh; i++) {
+        FreshRecord *rec = &freshrec[i];
+        const char *name = NULL;
+        switch (rec->nametype) {
+        case NAME_OPERAND:
+            name = OPTABLE(rec->name).name;
+            break;
+        case NAME_TEMP:
+            if (!tempnames[rec->name]) {
+                tempnames[rec->name] = NewTempLabelName();
+            }
+            name = tempnames[rec->name];
+            break;
+        case NAME_LITERAL:
+            {
+                char *s = (char *)malloc(rec->namelen+1);
+                memcpy(s, data + rec->name, rec->namelen);
+                s[rec->namelen] = 0;
+                name = s;
+            }
+            break;
+        default:
+            break;
+        }
+        if (rec->kind == IMM_INT && name && name[0]) {
+            // named immediates are globals
+            fresh[i] = GetOneGlobal(IMM_INT, name, rec->val);
+        } else {
+            fresh[i] = NewOperand(rec->kind, name, rec->val);
+            fresh[i]->used = rec->used;
+        }
+    }
+    free(tempnames);
+
+    irs = (IR **)calloc(numir+1, sizeof(IR *));
+    for (i = 0; i < numir; i++) {
+        irs[i] = NewIR(OPC_DUMMY);
+    }
+    for (i = 0; i < numir; i++) {
+        IRRecord *rec = &irrec[i];
+        IR *ir = irs[i];
+        Operand **refs[4] = { &ir->dst, &ir->src, &ir->src2, &ir->fcache };
+
+        ir->opc = rec->opc;
+        ir->cond = rec->cond;
+        ir->flags = rec->flags;
+        ir->srceffect = rec->srceffect;
+        ir->dsteffect = rec->dsteffect;
+        ir->addr = rec->addr;
+        ir->instr = (rec->instr < 0) ? NULL : &instr[rec->instr];
+        for (j = 0; j < 4; j++) {
+            n = rec->refs[j];
+            if (n > 0) {
+                *refs[j] = OPTABLE(n-1).op;
+            } else if (n < 0) {
+                *refs[j] = fresh[-n-1];
+            }
+        }
+        ir->line = (rec->line < 0) ? NULL : LINETABLE(rec->line);
+        switch (rec->auxkind) {
+        case AUX_IR:
+            ir->aux = irs[rec->aux];
+            break;
+        case AUX_FUNC:
+            ir->aux = FUNCTABLE(rec->aux);
+            break;
+        case AUX_JUMPS:
+            // build the list back to front to keep its original order
+            for (j = rec->aux - 1; j >= 0; --j) {
+                struct ir_lbljumps *entry = (struct ir_lbljumps *)malloc(sizeof(*entry));
+                entry->jump = irs[jumps[rec->jumps + j]];
+                entry->next = (struct ir_lbljumps *)ir->aux;
+                ir->aux = entry;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    free(fresh);
+    irl->head = irl->tail = NULL;
+    for (i = 0; i < numir; i++) {
+        AppendIR(irl, irs[i]);
+    }
+    free(irs);
+    keyValid = false;
+    cacheHits++;
+done:
+    flexbuf_delete(&freshfb);
+    flexbuf_delete(&irfb);
+    flexbuf_delete(&jumpfb);
+    free(data);
+    return ok;
+}
+
+//
+// encode an operand reference for the cache file
+// returns false if the operand cannot be recreated later
+//
+static bool
+EncodeOperand(Flexbuf *freshfb, CacheMap *freshMap,
+              CacheMap *tempMap, Operand *op, int64_t *ref)
+{
+    int idx;
+
+    if (!op) {
+        *ref = 0;
+        return true;
+    }
+    idx = CacheMapFind(&opMap, op);
+    if (idx >= 0) {
+        CacheOperand *orig = &OPTABLE(idx);
+        if (op->kind == orig->kind && op->name == orig->name
+            && op->val == orig->val && op->size == orig->size)
+        {
+            *ref = idx+1;
+            return true;
+        }
+        // modified in place by the optimizer; save it as a new operand
+    }
+    idx = CacheMapFind(freshMap, op);
+    if (idx >= 0) {
+        *ref = -(idx+1);
+        return true;
+    }
+
+    // only a few simple kinds of operand are created by the optimizer
+    switch (op->kind) {
+    case IMM_INT:
+    case IMM_COG_LABEL:
+    case REG_HW:
+        break;
+    case IMM_HUB_LABEL:
+        if (op->val) return false;
+        break;
+    default:
+        return false;
+    }
+    if (op->size || op->origsym) {
+        return false;
+    }
+    idx = freshMap->count;
+    CacheMapAdd(freshMap, op, idx);
+    PutInt(freshfb, op->kind);
+    PutInt(freshfb, op->val);
+    PutInt(freshfb, op->used);
+    if (!op->name) {
+        PutInt(freshfb, NAME_NONE);
+    } else if (CacheMapFind(&nameMap, op->name) >= 0) {
+        PutInt(freshfb, NAME_OPERAND);
+        PutInt(freshfb, CacheMapFind(&nameMap, op->name));
+    } else if (!strncmp(op->name, "L__", 3) && op->kind != IMM_INT) {
+        int n = CacheMapFind(tempMap, op->name);
+        if (n < 0) {
+            n = idx;
+            CacheMapAdd(tempMap, op->name, n);
+        }
+        PutInt(freshfb, NAME_TEMP);
+        PutInt(freshfb, n);
+    } else {
+        size_t len = strlen(op->name);
+        PutInt(freshfb, NAME_LITERAL);
+        PutInt(freshfb, len);
+        flexbuf_addmem(freshfb, op->name, len);
+    }
+    *ref = -(idx+1);
+    return true;
+}
+
+//
+// save the optimized IR for a function previously passed to IRCacheLookup
+//
+static void
+IRCacheStore(IRList *irl, Function *f)
+{
+    Flexbuf irfb, freshfb;
+    CacheMap irMap = { 0 };
+    CacheMap freshMap = { 0 };
+    CacheMap tempMap = { .strkeys = 1 };
+    IR *ir;
+    int numir;
+    bool ok = true;
+    char *fname, *tmpname;
+    char suffix[32];
+    FILE *file;
+
+    if (!keyValid) {
+        return;
+    }
+    keyValid = false;
+    if (gl_errors > 0 || gl_warnings != keyWarnings) {
+        // make sure any diagnostics get repeated next time
+        return;
+    }
+    numir = 0;
+    for (ir = irl->head; ir; ir = ir->next) {
+        CacheMapAdd(&irMap, ir, numir++);
+    }
+    flexbuf_init(&irfb, 4096);
+    flexbuf_init(&freshfb, 1024);
+    for (ir = irl->head; ir && ok; ir = ir->next) {
+        Operand *refs[4] = { ir->dst, ir->src, ir->src2, ir->fcache };
+        int64_t ref = 0;
+        int j, n;
+
+        PutInt(&irfb, ir->opc);
+        PutInt(&irfb, ir->cond);
+        PutInt(&irfb, ir->flags);
+        PutInt(&irfb, ir->srceffect);
+        PutInt(&irfb, ir->dsteffect);
+        PutInt(&irfb, ir->addr);
+        n = InstrIndex(ir->instr);
+        if (n == -2) {
+            ok = false;
+            break;
+        }
+        PutInt(&irfb, n);
+        for (j = 0; j < 4; j++) {
+            if (!EncodeOperand(&freshfb, &freshMap, &tempMap, refs[j], &ref)) {
+                ok = false;
+                break;
+            }
+            PutInt(&irfb, ref);
+        }
+        if (!ok) {
+            break;
+        }
+        PutInt(&irfb, ir->line ? CacheMapFind(&lineMap, ir->line) : -1);
+        if (!ir->aux) {
+            PutInt(&irfb, AUX_NONE);
+        } else if (ir->opc == OPC_LABEL) {
+            struct ir_lbljumps *list;
+            n = 0;
+            for (list = (struct ir_lbljumps *)ir->aux; list; list = list->next) {
+                n++;
+            }
+            PutInt(&irfb, AUX_JUMPS);
+            PutInt(&irfb, n);
+            for (list = (struct ir_lbljumps *)ir->aux; list; list = list->next) {
+                n = CacheMapFind(&irMap, list->jump);
+                if (n < 0) ok = false;
+                PutInt(&irfb, n);
+            }
+        } else if (ir->opc == OPC_CALL) {
+            n = CacheMapFind(&funcMap, ir->aux);
+            if (n < 0) ok = false;
+            PutInt(&irfb, AUX_FUNC);
+            PutInt(&irfb, n);
+        } else {
+            n = CacheMapFind(&irMap, ir->aux);
+            if (n < 0) ok = false;
+            PutInt(&irfb, AUX_IR);
+            PutInt(&irfb, n);
+        }
+    }
+    if (!ok) {
+        cacheUncachable++;
+        goto done;
+    }
+
+    // write to a temporary file first, so that a compile running in
+    // parallel never sees a partial entry
+    fname = CacheFileName();
+    sprintf(suffix, ".%lu.tmp", (unsigned long)getpid());
+    tmpname = strdupcat(fname, suffix);
+    file = fopen(tmpname, "wb");
+    if (file) {
+        int64_t count;
+        fwrite(IRCACHE_MAGIC, 1, 4, file);
+        fwrite(cacheKey, 1, SHA256_BLOCK_SIZE, file);
+        count = freshMap.count;
+        fwrite(&count, sizeof(count), 1, file);
+        fwrite(flexbuf_peek(&freshfb), 1, flexbuf_curlen(&freshfb), file);
+        count = numir;
+        fwrite(&count, sizeof(count), 1, file);
+        fwrite(flexbuf_peek(&irfb), 1, flexbuf_curlen(&irfb), file);
+        if (fclose(file) == 0) {
+            if (rename(tmpname, fname) != 0) {
+                // Windows will not rename over an existing file
+                remove(fname);
+                rename(tmpname, fname);
+            }
+            cacheStores++;
+        }
+        remove(tmpname);
+    }
+    free(tmpname);
+    free(fname);
+done:
+    flexbuf_delete(&irfb);
+    flexbuf_delete(&freshfb);
+    ptrmap_free(&irMap);
+    ptrmap_free(&freshMap);
+    ptrmap_free(&tempMap);
+}
+
+void
+OptimizeIRLocalCached(IRList *irl, Function *f)
+{
+    if (!IRCacheLookup(irl, f)) {
+        OptimizeIRLocal(irl, f);
+        IRCacheStore(irl, f);
+    }
+}
+
+void
+PrintIRCacheStats(FILE *f)
+{
+    if (!gl_ircache_dir) {
+        return;
+    }
+    fprintf(f, "IR cache (%s):\n", gl_ircache_dir);
+    fprintf(f, "  %u functions looked up, %u found, %u saved, %u could not be cached\n",
+            cacheLookups, cacheHits, cacheStores, cacheUncachable);
+}
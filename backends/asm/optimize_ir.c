@@ -12,6 +12,7 @@
 #include <ctype.h>
 #include "spinc.h"
 #include "outasm.h"
+#include "util/ptrmap.h"
 
 // forward declarations
 static bool IsReorderBarrier(IR *ir);
@@ -892,6 +893,7 @@ static inline bool CondIsSubset(IRCond super, IRCond sub) {
 }
 
 // Note: currently only valid for P2
+// (the fuller model used for --cycle-report is in cycles.c)
 static int InstrMinCycles(IR *ir) {
     if (IsDummy(ir)||IsLabel(ir)) return 0;
     int aug = 0;
@@ -912,49 +914,6 @@ static int InstrMinCycles(IR *ir) {
         return aug+2;
     }
 }
-#if 0
-// Note: currently only valid for P2, and not used yet
-static int InstrMaxCycles(IR *ir) {
-    if (IsDummy(ir)||IsLabel(ir)) return 0;
-    if (IsBranch(ir)) return 100000; // No good.
-
-    int aug = 0;
-    if (ir->src && ir->src->kind == IMM_INT && ir->src->val > 511) aug += 2;
-    if (ir->dst && ir->dst->kind == IMM_INT && ir->dst->val > 511) aug += 2;
-
-    switch (ir->opc) {
-    case OPC_WRBYTE:
-        return aug+26; // Can never be unaligned
-    case OPC_WRWORD:
-    case OPC_WRLONG:
-        return aug+27;
-    case OPC_RDBYTE:
-        return aug+20; // Can never be unaligned
-    case OPC_RDWORD:
-    case OPC_RDLONG:
-        return aug+21;
-    case OPC_GENERIC:
-    case OPC_GENERIC_NR:
-    case OPC_GENERIC_DELAY:
-    case OPC_GENERIC_BRANCH:
-    case OPC_GENERIC_BRCOND:
-    case OPC_GENERIC_NR_NOFLAGS:
-    case OPC_GENERIC_NOFLAGS:
-    case OPC_WAITX:
-    case OPC_WAITCNT:
-        return 100000; // No good;
-    case OPC_QMUL:
-    case OPC_QDIV:
-    case OPC_QFRAC:
-    case OPC_QSQRT:
-    case OPC_QLOG:
-    case OPC_QEXP:
-        return aug+9;
-    default:
-        return aug+2;
-    }
-}
-#endif
 
 static int
 AddSubVal(IR *ir)
@@ -1278,14 +1237,74 @@ done:
     }
 }
 
-bool
-IRIsDeadAfter(IR *instr, Operand *op)
+/*
+ * optimizations that ask many liveness questions while leaving the
+ * IR alone can have the answers remembered: LiveMemoStart() begins
+ * remembering (calling it again forgets the old answers, which must
+ * be done after any change to the IR) and LiveMemoStop() ends it
+ */
+#define LIVE_MEMO_SIZE 4096
+
+typedef struct LiveMemo {
+    IR *instr;
+    Operand *op;
+    unsigned gen;
+    bool dead;
+} LiveMemo;
+
+static LiveMemo liveMemo[LIVE_MEMO_SIZE];
+static unsigned liveMemoGen;
+static bool liveMemoActive;
+
+static void
+LiveMemoStart(void)
+{
+    if (++liveMemoGen == 0) {
+        memset(liveMemo, 0, sizeof(liveMemo));
+        liveMemoGen = 1;
+    }
+    liveMemoActive = true;
+}
+
+static void
+LiveMemoStop(void)
+{
+    liveMemoActive = false;
+}
+
+static LiveMemo *
+LiveMemoSlot(IR *instr, Operand *op)
+{
+    uintptr_t h = ((uintptr_t)instr >> 3) ^ (((uintptr_t)op >> 3) * 31);
+    return &liveMemo[(h ^ (h >> 12)) & (LIVE_MEMO_SIZE-1)];
+}
+
+static bool
+LiveSearch(IR *instr, Operand *op)
 {
     IR *stack[MAX_FOLLOWED_JUMPS];
     stack[0] = instr;
     return doIsDeadAfter(instr, op, 1, stack);
 }
 
+bool
+IRIsDeadAfter(IR *instr, Operand *op)
+{
+    LiveMemo *m;
+
+    if (!liveMemoActive) {
+        return LiveSearch(instr, op);
+    }
+    m = LiveMemoSlot(instr, op);
+    if (m->gen != liveMemoGen || m->instr != instr || m->op != op) {
+        m->instr = instr;
+        m->op = op;
+        m->dead = LiveSearch(instr, op);
+        m->gen = liveMemoGen;
+    }
+    return m->dead;
+}
+
 static IR*
 SafeToReplaceBack(IR *instr, Operand *orig, Operand *replace)
 {
@@ -3347,15 +3366,97 @@ AssignTemporaryAddresses(IRList *irl, Operand *retlabel)
 }
 
 //
-// find out if a label is referenced (perhaps indirectly)
-// if there is a unique jump to it, return a pointer to it
+// label lookup table: from label operands to the IR defining them,
+// used to connect jumps to their destinations in a single pass over
+// the function
+//
+static PtrMap labelTable;
+
+static IR *
+FindLabelIR(Operand *op)
+{
+    intptr_t ir;
+    return ptrmap_find(&labelTable, op, &ir) ? (IR *)ir : NULL;
+}
+
+// returns false if another label with the same name is already present
+static bool
+AddLabelIR(IR *irlabel)
+{
+    return ptrmap_add(&labelTable, irlabel->dst, (intptr_t)irlabel) != 0;
+}
+
+// note a reference to a label
+static void
+MarkLabelReference(IR *ir, IR *irlabel)
+{
+    if (!irlabel || irlabel == ir) {
+        return;
+    }
+    if (IsJump(ir)) {
+        ir->aux = irlabel; // record where the jump goes to
+        // Append to list of label uses if not invalidated
+        if (!(irlabel->flags & FLAG_LABEL_USED) || irlabel->aux) {
+            AppendLblJump(irlabel,ir);
+            irlabel->flags |= FLAG_LABEL_USED;
+        }
+    } else {
+        irlabel->flags |= FLAG_LABEL_USED;
+        irlabel->aux = NULL; // invalidate use list
+    }
+}
+
+//
+// find out which labels are referenced (perhaps indirectly)
+// every jump gets a pointer to its destination label in aux,
+// and every label gets the list of jumps to it, if all references
+// to it are jumps
+// these jump <-> label links are the only control flow information
+// kept; there are no basic blocks or dominators, and passes such as
+// OptimizeJumps and LoopCanBeFcached still walk the IR list themselves
+// returns false if the label lookup table could not be built
+// (duplicate names)
+//
+static bool
+MarkLabelUses(IRList *irl)
+{
+    IR *ir;
+
+    ptrmap_clear(&labelTable);
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->opc == OPC_LABEL) {
+            if (!AddLabelIR(ir)) {
+                return false;
+            }
+            if (ir->dst->used >= 9999) {
+                // GOSUB labels get flagged with a large used value so they do not get taken away
+                ir->flags |= FLAG_LABEL_USED;
+            }
+        }
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (IsDummy(ir)) continue;
+        if (IsJump(ir)) {
+            MarkLabelReference(ir, FindLabelIR(JumpDest(ir)));
+        } else {
+            MarkLabelReference(ir, FindLabelIR(ir->dst));
+            if (ir->src != ir->dst) {
+                MarkLabelReference(ir, FindLabelIR(ir->src));
+            }
+        }
+    }
+    return true;
+}
+
+//
+// the same for a single label; slow, but copes with a label
+// defined more than once
 //
 static void
-MarkLabelUses(IRList *irl, IR *irlabel)
+MarkOneLabelUses(IRList *irl, IR *irlabel)
 {
     IR *ir;
     Operand *label = irlabel->dst;
-    Operand *dst;
 
     if (label->used >= 9999) {
         // GOSUB labels get flagged with a large used value so they do not get taken away
@@ -3364,20 +3465,11 @@ MarkLabelUses(IRList *irl, IR *irlabel)
     for (ir = irl->head; ir; ir = ir->next) {
         if (IsDummy(ir)) continue;
         if (IsJump(ir)) {
-            dst = JumpDest(ir);
-            if (dst == label) {
-                ir->aux = irlabel; // record where the jump goes to
-                // Append to list of label uses if not invalidated
-                if (!(irlabel->flags & FLAG_LABEL_USED) || irlabel->aux) {
-                    AppendLblJump(irlabel,ir);
-                    irlabel->flags |= FLAG_LABEL_USED;
-                }
-            }
-        } else if (ir != irlabel) {
-            if (ir->src == label || ir->dst == label) {
-                irlabel->flags |= FLAG_LABEL_USED;
-                irlabel->aux = NULL; // invalidate use list
+            if (JumpDest(ir) == label) {
+                MarkLabelReference(ir, irlabel);
             }
+        } else if (ir->src == label || ir->dst == label) {
+            MarkLabelReference(ir, irlabel);
         }
     }
 }
@@ -3401,11 +3493,14 @@ CheckLabelUsage(IRList *irl)
     IR *ir, *ir_next;
     ir = irl->head;
     int change = 0;
+    bool mapped = MarkLabelUses(irl);
 
     while (ir) {
         ir_next = ir->next;
         if (ir->opc == OPC_LABEL) {
-            MarkLabelUses(irl, ir);
+            if (!mapped) {
+                MarkOneLabelUses(irl, ir);
+            }
             if ( IsTemporaryLabel(ir->dst) && !(ir->flags & (FLAG_LABEL_USED|FLAG_KEEP_INSTR))) {
                 DeleteIR(irl, ir);
                 change = 1;
@@ -3645,7 +3740,7 @@ OptimizePeepholes(IRList *irl)
                 if (opc == OPC_AND && ((oldmask & newmask) == oldmask)) {
                     if (InstrSetsFlags(ir, FLAG_WZ)) {
                         ReplaceOpcode(ir, OPC_CMP);
-                        ir->src->val = 0;
+                        ir->src = NewImmediate(0);
                         changed = 1;
                     } else if (!InstrSetsAnyFlags(ir)) {
                         DeleteIR(irl, ir);
@@ -3655,7 +3750,7 @@ OptimizePeepholes(IRList *irl)
                 } else if (opc == OPC_OR && ((oldmask | newmask) == oldmask)) {
                     if (InstrSetsFlags(ir, FLAG_WZ)) {
                         ReplaceOpcode(ir, OPC_CMP);
-                        ir->src->val = 0;
+                        ir->src = NewImmediate(0);
                         changed = 1;
                     } else if (!InstrSetsAnyFlags(ir)) {
                         DeleteIR(irl, ir);
@@ -5277,6 +5372,8 @@ ReuseLocalRegisters(IRList *irl) {
         addKnownReg(&known_regs,ir->dst,true);
     }
 
+    // the same liveness questions come up for every candidate register
+    LiveMemoStart();
     for (IR *ir=irl->head; ir; ir=ir->next) {
         // Start of new dependency chain
         if (ir->dst && ir->dst != ir->src && IsLocal(ir->dst) && ir->dst->kind != REG_SUBREG && InstrModifies(ir,ir->dst) && !InstrUses(ir,ir->dst) && !InstrIsVolatile(ir) && !CheckDependency(&known_regs,ir->dst)) {
@@ -5286,6 +5383,7 @@ ReuseLocalRegisters(IRList *irl) {
                     ReplaceForward(ir->next,ir->dst,tmp->reg,stop_ir);
                     ir->dst = tmp->reg;
                     change = true;
+                    LiveMemoStart(); // IR changed, forget old answers
                     break;
                 }
             }
@@ -5294,6 +5392,7 @@ ReuseLocalRegisters(IRList *irl) {
         addKnownReg(&known_regs,ir->src,false);
         addKnownReg(&known_regs,ir->dst,false);
     }
+    LiveMemoStop();
     return change;
 }
 
@@ -5518,6 +5617,7 @@ AnalyzeInlineEligibility(Function *f)
     int paramfactor;
     int threshold;
     bool pure = true;
+    bool cold = false;
 
     unsigned prev_flags = FuncData(f)->inliningFlags;
     FuncData(f)->inliningFlags = 0;
@@ -5529,6 +5629,14 @@ AnalyzeInlineEligibility(Function *f)
     } else {
         threshold = INLINE_THRESHOLD_P1;
     }
+    if (!f->prefer_inline && gl_profile_use) {
+        // with a profile, don't bother with functions that hardly run
+        // (calls from busy places are checked one by one in ExpandInlines)
+        const char *name = FuncData(f)->asmname ? FuncData(f)->asmname->name : NULL;
+        if (ProfileIsCold(name)) {
+            cold = true;
+        }
+    }
 
     if (!(gl_optimize_flags & (OPT_INLINE_SMALLFUNCS|OPT_INLINE_SINGLEUSE))) {
         return false;
@@ -5593,8 +5701,12 @@ AnalyzeInlineEligibility(Function *f)
     } else {
         paramfactor = f->numparams;
     }
-    if (n <= (threshold + paramfactor)) {
+    if (n <= (threshold + paramfactor) && !cold) {
             FuncData(f)->inliningFlags |= ASM_INLINE_SMALL_FLAG;
+    } else if (gl_profile_use && !f->prefer_inline && !cold && n <= (2*threshold + paramfactor)) {
+            // a little too big to inline everywhere, but worth it
+            // at call sites the profile says are busy
+            FuncData(f)->inliningFlags |= ASM_INLINE_HOT_FLAG;
     }
 
     return FuncData(f)->inliningFlags & ~prev_flags;
@@ -5617,6 +5729,17 @@ ShouldExpandPureFunction(IR *ir) {
     return true;
 }
 
+//
+// with --profile-use, a function marked ASM_INLINE_HOT_FLAG is
+// inlined only at calls whose source line ran often
+//
+static bool
+IsHotCallSite(IR *ir, Function *f)
+{
+    if (!(FuncData(f)->inliningFlags & ASM_INLINE_HOT_FLAG)) return false;
+    return ProfileLineIsHot(ir->line);
+}
+
 static int getArgClobberVal(Operand *op) {
     int offset = 0;
     if (!op) return 0;
@@ -5647,7 +5770,7 @@ ExpandInlines(IRList *irl)
         updateMax(&FuncData(curfunc)->maxClobberArg, getArgClobberVal(ir->src));
         if (ir->opc == OPC_CALL) {
             f = (Function *)ir->aux;
-            if (f && ((FuncData(f)->inliningFlags & (ASM_INLINE_SMALL_FLAG|ASM_INLINE_SINGLE_FLAG)) || ShouldExpandPureFunction(ir))) {
+            if (f && ((FuncData(f)->inliningFlags & (ASM_INLINE_SMALL_FLAG|ASM_INLINE_SINGLE_FLAG)) || ShouldExpandPureFunction(ir) || IsHotCallSite(ir, f))) {
                 ReplaceIRWithInline(irl, ir, f);
                 FuncData(f)->actual_callsites--;
                 FuncData(f)->got_inlined = true;
@@ -5711,11 +5834,16 @@ LoopCanBeFcached(IRList *irl, IR *root, int size_left)
 
     bool non_wait = false;
     int loopsize = 0;
+    long long hottest;
 
     if (!IsHubDest(ir->dst)) {
         // this loop is not in HUB memory
         return 0;
     }
+    // with --profile-use, the count for the loop is that of the
+    // busiest loop in it (an outer loop holding a hot inner loop is
+    // better cached as a whole, so it is loaded just once)
+    hottest = ProfileLineCount(ir->line);
     endjmp = UniqJumpForLabel(ir);
     if (!endjmp || !IsJump(endjmp)) {
         // we don't know who jumps here
@@ -5756,6 +5884,12 @@ call_ok:
         if (ir->opc == OPC_FCACHE) {
             return 0;
         }
+        if (IsLabel(ir) && ir->line) {
+            long long n = ProfileLineCount(ir->line);
+            if (n > hottest) {
+                hottest = n;
+            }
+        }
         if (IsJump(ir)) {
             if (!JumpIsAfterOrEqual(root, ir))
                 return 0;
@@ -5777,6 +5911,11 @@ call_ok:
         }
         ir = ir->next;
     }
+    if (hottest >= 0 && !ProfileCountIsHot(hottest)) {
+        // the profile says this loop is not one of the busy ones, so
+        // loading it into fcache would cost more than it saves
+        return 0;
+    }
 
     //
     // OK, if we got here then the stuff from "root" to "endjmp"
@@ -136,6 +136,7 @@ typedef struct AsmVariable {
     Operand *op;
     intptr_t val;
     size_t count; // number of reps of "value"
+    int hnext;    // 1 + index of next variable in the same hash bucket, or 0
 } AsmVariable;
 
 // global variables in COG memory (really holds struct AsmVariables)
@@ -144,6 +145,13 @@ static struct flexbuf cogGlobalVars;
 // global variables in hub memory (really holds struct AsmVariables)
 static struct flexbuf hubGlobalVars;
 
+// hash buckets for finding the variables above by name; each bucket
+// holds 1 + the index of its first variable (0 if empty), and
+// buckets are chained in the order the variables were created
+#define ASMVAR_HASH_SIZE 4096
+static int cogGlobalHash[ASMVAR_HASH_SIZE];
+static int hubGlobalHash[ASMVAR_HASH_SIZE];
+
 static int sym_offset(Function *func, Symbol *s)
 {
     return s->offset;
@@ -386,6 +394,20 @@ ValidateAbortFuncs(void)
 }
 
 static Operand *pushregs_, *popregs_, *count_, *gosub_;
+static bool memmove_used;
+
+//
+// labels of builtin helper routines referenced from inline assembly
+// (some of the helpers are only emitted if they are used)
+//
+Operand *
+GetBuiltinLabel(const char *name)
+{
+    if (!strcmp(name, "builtin_memmove_")) {
+        memmove_used = true;
+    }
+    return NewOperand(IMM_COG_LABEL, name, 0);
+}
 
 static void
 ValidatePushregs(void)
@@ -417,14 +439,26 @@ static int IsMemRef(Operand *op)
     return op && (op->kind >= HUBMEM_REF) && (op->kind <= COGMEM_REF);
 }
 
+static unsigned
+AsmVarHash(const char *name)
+{
+    unsigned hash = 0;
+    while (*name) {
+        hash = hash * 31 + (unsigned char)*name++;
+    }
+    return hash % ASMVAR_HASH_SIZE;
+}
+
 static Operand *
-GetSizedVarCond(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t value, int count, bool allocateIfNeeded)
+GetSizedVarCond(struct flexbuf *fb, int *hashtab, Operandkind kind, const char *name, intptr_t value, int count, bool allocateIfNeeded)
 {
     size_t siz = flexbuf_curlen(fb) / sizeof(AsmVariable);
-    size_t i;
+    int i;
+    int *link;
     AsmVariable tmp;
     AsmVariable *g = (AsmVariable *)flexbuf_peek(fb);
-    for (i = 0; i < siz; i++) {
+    for (link = &hashtab[AsmVarHash(name)]; *link; link = &g[i].hnext) {
+        i = *link - 1;
         if (strcmp(name, g[i].op->name) == 0) {
             if (g[i].val != value) {
                 if ( (kind == REG_HUBPTR || kind == REG_COGPTR)
@@ -447,6 +481,8 @@ GetSizedVarCond(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t
         tmp.op = NewOperand(kind, name, value);
         tmp.val = value;
         tmp.count = count;
+        tmp.hnext = 0;
+        *link = (int)siz + 1;
         flexbuf_addmem(fb, (const char *)&tmp, sizeof(tmp));
         return tmp.op;
     }
@@ -454,23 +490,23 @@ GetSizedVarCond(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t
 }
 
 static Operand *
-GetSizedVar(struct flexbuf *fb, Operandkind kind, const char *name, intptr_t value, int count)
+GetSizedVar(struct flexbuf *fb, int *hashtab, Operandkind kind, const char *name, intptr_t value, int count)
 {
-    return GetSizedVarCond(fb, kind, name, value, count, true);
+    return GetSizedVarCond(fb, hashtab, kind, name, value, count, true);
 }
 
 Operand *GetOneGlobal(Operandkind kind, const char *name, intptr_t value)
 {
-    return GetSizedVar(&cogGlobalVars, kind, name, value, 1);
+    return GetSizedVar(&cogGlobalVars, cogGlobalHash, kind, name, value, 1);
 }
 Operand *GetSizedGlobal(Operandkind kind, const char *name, intptr_t value, int size)
 {
-    return GetSizedVar(&cogGlobalVars, kind, name, value, size);
+    return GetSizedVar(&cogGlobalVars, cogGlobalHash, kind, name, value, size);
 }
 
 Operand *GetOneHub(Operandkind kind, const char *name, intptr_t value)
 {
-    return GetSizedVar(&hubGlobalVars, kind, name, value, 1);
+    return GetSizedVar(&hubGlobalVars, hubGlobalHash, kind, name, value, 1);
 }
 
 Operand *GetResultReg(int n)
@@ -1136,15 +1172,62 @@ NewPcRelative(int32_t val)
     return NewOperand(IMM_PCRELATIVE, "", (int32_t)val);
 }
 
+//
+// immediates are never modified once created (code that wants a
+// different value asks for a new immediate), so one operand can be
+// shared by every use of the same value
+//
+static Operand **immTable;
+static unsigned immTableSize;
+static unsigned immTableCount;
+
+static Operand **
+FindImmediateSlot(Operand **table, unsigned size, int32_t val)
+{
+    unsigned h = ((uint32_t)val * 2654435761u) & (size - 1);
+    while (table[h] && (int32_t)table[h]->val != val) {
+        h = (h + 1) & (size - 1);
+    }
+    return &table[h];
+}
+
+static Operand *
+InternImmediate(int32_t val)
+{
+    Operand **slot;
+    unsigned i;
+
+    if (2 * (immTableCount + 1) > immTableSize) {
+        unsigned newSize = immTableSize ? 2 * immTableSize : 1024;
+        Operand **newTable = (Operand **)calloc(newSize, sizeof(Operand *));
+        for (i = 0; i < immTableSize; i++) {
+            if (immTable[i]) {
+                *FindImmediateSlot(newTable, newSize, (int32_t)immTable[i]->val) = immTable[i];
+            }
+        }
+        free(immTable);
+        immTable = newTable;
+        immTableSize = newSize;
+    }
+    slot = FindImmediateSlot(immTable, immTableSize, val);
+    if (!*slot) {
+        *slot = NewOperand(IMM_INT, "", (int32_t)val);
+        immTableCount++;
+    }
+    return *slot;
+}
+
 Operand *
 NewImmediate(int32_t val)
 {
     char temp[1024];
+    Operand *op;
     if ( gl_p2 || (val >= 0 && val < 512) ) {
-        return NewOperand(IMM_INT, "", (int32_t)val);
+        return InternImmediate(val);
     }
     sprintf(temp, "imm_%u_", (unsigned)val);
-    return GetOneGlobal(IMM_INT, strdup(temp), (int32_t)val);
+    op = GetSizedVarCond(&cogGlobalVars, cogGlobalHash, IMM_INT, temp, (int32_t)val, 1, false);
+    return op ? op : GetOneGlobal(IMM_INT, strdup(temp), (int32_t)val);
 }
 
 Operand *
@@ -1823,7 +1906,7 @@ RenameLocalRegs(Function *func, bool isLeaf)
     IRList *irl = FuncIRL(func);
     if (isLeaf) {
         doRenameLocalRegs(func, true);
-        OptimizeIRLocal(irl, func);
+        OptimizeIRLocalCached(irl, func);
     }
     return doRenameLocalRegs(func, isLeaf);
 }
@@ -1878,7 +1961,7 @@ MarkUsedOneReg(Operand *reg)
     if (reg) {
         if (reg->kind == IMM_COG_LABEL) {
             // see if a variable with this name exists
-            Operand *sub = GetSizedVarCond(&cogGlobalVars, REG_LOCAL, reg->name, 0, 0, false);
+            Operand *sub = GetSizedVarCond(&cogGlobalVars, cogGlobalHash, REG_LOCAL, reg->name, 0, 0, false);
             if (sub) {
                 sub->used = 1;
             }
@@ -3365,6 +3448,11 @@ CompileFunccall(IRList *irl, AST *expr)
         FuncData(func)->actual_callsites++;
     }
     ir->aux = (void *)func; // remember the function for optimization purposes
+    if (gl_profile_use) {
+        // ExpandInlines looks the call up in the --profile-use data
+        // by its source line (left out otherwise, as in MarkLoopStart)
+        ir->line = expr;
+    }
 
     FreeTempRegisters(irl, starttempreg);
 
@@ -4199,7 +4287,7 @@ doGetAddress(IRList *irl, AST *expr, bool isField)
             bits = CompileExpression(irl, bitsexpr, NULL);
             EmitOp2(irl, OPC_ANDN, base, NewImmediate(0x3e000000));
             if (bits->kind == IMM_INT) {
-                bits->val = bits->val << 20;
+                bits = NewImmediate(bits->val << 20);
             } else {
                 EmitOp2(irl, OPC_SHL, bits, NewImmediate(20));
             }
@@ -4869,7 +4957,7 @@ IR *EmitMove(IRList *irl, Operand *origdst, Operand *origsrc, AST *linenum)
         }
         if (off) {
             if (src->kind == IMM_INT) {
-                src->val += off;
+                src = NewImmediate(src->val + off);
             } else {
                 EmitAddSub(irl, src, off);
             }
@@ -4933,7 +5021,7 @@ IR *EmitMove(IRList *irl, Operand *origdst, Operand *origsrc, AST *linenum)
         }
         if (off) {
             if (dst->kind == IMM_INT) {
-                dst->val += off;
+                dst = NewImmediate(dst->val + off);
             } else {
                 EmitAddSub(irl, dst, off);
             }
@@ -5005,6 +5093,79 @@ IR *EmitMove(IRList *irl, Operand *origdst, Operand *origsrc, AST *linenum)
 // Lexit
 //
 
+//
+// find the first statement of a block, to look up in the --profile-use data
+// if the block starts with a loop, that is the first statement of the
+// loop's body (the position recorded for a loop statement itself is
+// often that of the line after it)
+//
+static AST *FirstStatement(AST *ast)
+{
+    AST *body;
+
+    for(;;) {
+        // comments and nodes made by later transformations may not have
+        // a source position, so stop at the last node that does
+        while (ast && (ast->kind == AST_STMTLIST || ast->kind == AST_COMMENTEDNODE || ast->kind == AST_SCOPE)
+               && ast->left && ast->left->lexdata) {
+            ast = ast->left;
+        }
+        if (!ast) {
+            return ast;
+        }
+        switch (ast->kind) {
+        case AST_WHILE:
+        case AST_DOWHILE:
+            body = ast->right;
+            break;
+        case AST_FOR:
+        case AST_FORATLEASTONCE:
+            // for loops are FOR(init, TO(cond, STEP(update, body)))
+            body = ast->right && ast->right->right ? ast->right->right->right : NULL;
+            break;
+        default:
+            body = NULL;
+            break;
+        }
+        if (!body || !body->lexdata) {
+            return ast;
+        }
+        ast = body;
+    }
+}
+
+//
+// remember where the body of a loop starts in the source, so that
+// OptimizeFcache can look it up in the --profile-use data and
+// --cycle-report can say where the loop is; this is left out otherwise
+// so that moving code around in a file does not change the IR
+//
+static void MarkLoopStart(IR *label, AST *body)
+{
+    if (label && (gl_profile_use || gl_cycle_report)) {
+        label->line = FirstStatement(body);
+    }
+}
+
+//
+// pick a likely branch for an if statement from the --profile-use data:
+// returns -1 if the "then" part hardly ran, 1 if the "else" part hardly
+// ran, and 0 if we do not know
+//
+static int ProfileLikely(AST *thenpart, AST *elsepart)
+{
+    if (!gl_profile_use) {
+        return 0;
+    }
+    if (thenpart && ProfileLineIsCold(FirstStatement(thenpart))) {
+        return -1;
+    }
+    if (elsepart && ProfileLineIsCold(FirstStatement(elsepart))) {
+        return 1;
+    }
+    return 0;
+}
+
 static void CompileForLoop(IRList *irl, IRList *cold_irl, AST *ast, int atleastonce)
 {
     AST *initstmt;
@@ -5045,7 +5206,7 @@ static void CompileForLoop(IRList *irl, IRList *cold_irl, AST *ast, int atleasto
     if (!loopcond) {
         loopcond = AstInteger(1);
     }
-    EmitLabel(irl, toplabel);
+    MarkLoopStart(EmitLabel(irl, toplabel), body);
     if (!atleastonce) {
         CompileBoolBranches(irl, loopcond, NULL, exitlabel);
     }
@@ -5322,7 +5483,7 @@ static void CompileStatement(IRList *irl, IRList *cold_irl, AST *ast)
         toploop = NewCodeLabel();
         botloop = NewCodeLabel();
         PushQuitNext(botloop, toploop);
-        EmitLabel(irl, toploop);
+        MarkLoopStart(EmitLabel(irl, toploop), ast->right);
         CompileBoolBranches(irl, ast->left, NULL, botloop);
         FreeTempRegisters(irl, starttempreg);
         CompileStatementList(irl, cold_irl, ast->right);
@@ -5335,7 +5496,7 @@ static void CompileStatement(IRList *irl, IRList *cold_irl, AST *ast)
         botloop = NewCodeLabel();
         exitloop = NewCodeLabel();
         PushQuitNext(exitloop, botloop);
-        EmitLabel(irl, toploop);
+        MarkLoopStart(EmitLabel(irl, toploop), ast->right);
         CompileStatementList(irl, cold_irl, ast->right);
         EmitLabel(irl, botloop);
         CompileBoolBranches(irl, ast->left, toploop, NULL);
@@ -5410,6 +5571,9 @@ static void CompileStatement(IRList *irl, IRList *cold_irl, AST *ast)
             ast = ast->left;
         }
         ASSERT_AST_KIND(ast,AST_THENELSE,;);
+        if (likely == 0 && cold_irl) {
+            likely = ProfileLikely(ast->left, ast->right);
+        }
         if (likely != 0 && cold_irl) { // emit to cold irl
             toploop = NewCodeLabel();
             botloop = NewCodeLabel();
@@ -5600,7 +5764,11 @@ CompileFunctionBody(Function *f)
         EmitLabel(irl,jumpover);
     }
     EmitFunctionEpilog(irl, f);
-    OptimizeIRLocal(irl, f);
+    // nothing here writes to other functions' FuncData (inlining,
+    // which does, comes later in ExpandInlines), so in principle the
+    // functions could be optimized in parallel; but temporary label
+    // names, operands and the optimizer's scratch tables are global
+    OptimizeIRLocalCached(irl, f);
     HashFuncIRL(f);
 }
 
@@ -5653,6 +5821,7 @@ static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int
     size_t siz = flexbuf_curlen(fb) / sizeof(AsmVariable);
     size_t i;
     AsmVariable *g = (AsmVariable *)flexbuf_peek(fb);
+    AsmVariable *sorted = NULL;
     int varsize;
     int alphaSort = flags & SORT_ALPHABETICALLY;
     int count = 0;
@@ -5660,9 +5829,13 @@ static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int
     if (siz > 0) {
         EmitNewline(datairl);
     }
-    /* sort the global variables */
-    if (alphaSort) {
-        qsort(g, siz, sizeof(*g), gcmpfunc);
+    /* sort the global variables; this is done on a copy, because
+       the hash chains refer to variables by their index in fb */
+    if (alphaSort && siz > 0) {
+        sorted = (AsmVariable *)malloc(siz * sizeof(*g));
+        memcpy(sorted, g, siz * sizeof(*g));
+        qsort(sorted, siz, sizeof(*g), gcmpfunc);
+        g = sorted;
     }
     for (i = 0; i < siz; i++) {
         if (g[i].op->kind == REG_LOCAL && !g[i].op->used) {
@@ -5733,6 +5906,7 @@ static int EmitAsmVars(struct flexbuf *fb, IRList *datairl, IRList *bssirl, int
             break;
         }
     }
+    free(sorted);
     return count;
 }
 
@@ -5955,7 +6129,7 @@ ExpandInline_internal(void *vptr, Module *P)
                 change = ExpandInlines(firl);
                 if (!change) break;
                 // may be new opportunities for optimization
-                OptimizeIRLocal(firl, f);
+                OptimizeIRLocalCached(firl, f);
                 // revisit the question of whether it should be inlined, given that
                 // we've perhaps changed its size
                 if (AnalyzeInlineEligibility(f)) {
@@ -6365,6 +6539,130 @@ const char *builtin_memfill_p2 =
     "        ret\n"
     ;
 
+// dst = arg01, src = arg02, count = arg03
+// copies 16 longs at a time with SETQ bursts through the
+// scratch area at $0 (kept free for fcache and inline asm);
+// if dst lies inside the source range the copy runs backwards
+const char *builtin_memmove_p2 =
+    "builtin_memmove_\n"
+    "        mov	pa, arg01\n"
+    "        sub	pa, arg02\n"
+    "        cmp	pa, arg03 wc\n"
+    " if_c   jmp	#builtin_memmove_rev_\n"
+    "        mov	pa, arg03\n"
+    "        shr	pa, #6 wz\n"
+    " if_z   jmp	#builtin_memmove_ftail_\n"
+    "builtin_memmove_floop_\n"
+    "        setq	#15\n"
+    "        rdlong	$0, arg02\n"
+    "        setq	#15\n"
+    "        wrlong	$0, arg01\n"
+    "        add	arg02, #64\n"
+    "        add	arg01, #64\n"
+    "        djnz	pa, #builtin_memmove_floop_\n"
+    "builtin_memmove_ftail_\n"
+    "        mov	pa, arg03\n"
+    "        and	pa, #63\n"
+    "        shr	pa, #2 wz\n"
+    " if_z   jmp	#builtin_memmove_fbytes_\n"
+    "        sub	pa, #1\n"
+    "        setq	pa\n"
+    "        rdlong	$0, arg02\n"
+    "        setq	pa\n"
+    "        wrlong	$0, arg01\n"
+    "        add	pa, #1\n"
+    "        shl	pa, #2\n"
+    "        add	arg02, pa\n"
+    "        add	arg01, pa\n"
+    "builtin_memmove_fbytes_\n"
+    "        test	arg03, #2 wc\n"
+    " if_c   rdword	pb, arg02\n"
+    " if_c   wrword	pb, arg01\n"
+    " if_c   add	arg02, #2\n"
+    " if_c   add	arg01, #2\n"
+    "        test	arg03, #1 wc\n"
+    " if_c   rdbyte	pb, arg02\n"
+    " if_c   wrbyte	pb, arg01\n"
+    "        ret\n"
+    "builtin_memmove_rev_\n"
+    "        add	arg02, arg03\n"
+    "        add	arg01, arg03\n"
+    "        test	arg03, #1 wc\n"
+    " if_c   sub	arg02, #1\n"
+    " if_c   sub	arg01, #1\n"
+    " if_c   rdbyte	pb, arg02\n"
+    " if_c   wrbyte	pb, arg01\n"
+    "        test	arg03, #2 wc\n"
+    " if_c   sub	arg02, #2\n"
+    " if_c   sub	arg01, #2\n"
+    " if_c   rdword	pb, arg02\n"
+    " if_c   wrword	pb, arg01\n"
+    "        shr	arg03, #2\n"
+    "        mov	pa, arg03\n"
+    "        and	pa, #15 wz\n"
+    " if_z   jmp	#builtin_memmove_rchunks_\n"
+    "        mov	pb, pa\n"
+    "        shl	pb, #2\n"
+    "        sub	arg02, pb\n"
+    "        sub	arg01, pb\n"
+    "        sub	pa, #1\n"
+    "        setq	pa\n"
+    "        rdlong	$0, arg02\n"
+    "        setq	pa\n"
+    "        wrlong	$0, arg01\n"
+    "builtin_memmove_rchunks_\n"
+    "        shr	arg03, #4 wz\n"
+    " if_z   ret\n"
+    "builtin_memmove_rloop_\n"
+    "        sub	arg02, #64\n"
+    "        sub	arg01, #64\n"
+    "        setq	#15\n"
+    "        rdlong	$0, arg02\n"
+    "        setq	#15\n"
+    "        wrlong	$0, arg01\n"
+    "        djnz	arg03, #builtin_memmove_rloop_\n"
+    "        ret\n"
+    ;
+
+// same as above, but for when there is no scratch area at $0
+// (e.g. COG code launched from Spin)
+const char *builtin_memmove_noscratch_p2 =
+    "builtin_memmove_\n"
+    "        mov	pa, arg01\n"
+    "        sub	pa, arg02\n"
+    "        cmp	pa, arg03 wc\n"
+    " if_c   jmp	#builtin_memmove_rev_\n"
+    "        mov	pa, arg03\n"
+    "        shr	pa, #2 wz\n"
+    " if_z   jmp	#builtin_memmove_fbytes_\n"
+    "        rep	#4, pa\n"
+    "        rdlong	pb, arg02\n"
+    "        wrlong	pb, arg01\n"
+    "        add	arg02, #4\n"
+    "        add	arg01, #4\n"
+    "builtin_memmove_fbytes_\n"
+    "        test	arg03, #2 wc\n"
+    " if_c   rdword	pb, arg02\n"
+    " if_c   wrword	pb, arg01\n"
+    " if_c   add	arg02, #2\n"
+    " if_c   add	arg01, #2\n"
+    "        test	arg03, #1 wc\n"
+    " if_c   rdbyte	pb, arg02\n"
+    " if_c   wrbyte	pb, arg01\n"
+    "        ret\n"
+    "builtin_memmove_rev_\n"
+    "        add	arg02, arg03\n"
+    "        add	arg01, arg03\n"
+    "        cmp	arg03, #0 wz\n"
+    " if_z   ret\n"
+    "        rep	#4, arg03\n"
+    "        sub	arg02, #1\n"
+    "        sub	arg01, #1\n"
+    "        rdbyte	pb, arg02\n"
+    "        wrbyte	pb, arg01\n"
+    "        ret\n"
+    ;
+
 /* WARNING: make sure to increase SETJMP_BUF_SIZE if you add
  * more things to be saved in abort/catch
  */
@@ -6579,6 +6877,16 @@ EmitBuiltins(IRList *irl)
         Operand *memfill = NewOperand(IMM_STRING, builtin_memfill_p2, 0);
         EmitOp1(irl, OPC_LITERAL, memfill);
     }
+    if (gl_p2 && memmove_used) {
+        Operand *memmove;
+        // the burst version needs 16 free longs at $0
+        if (gl_output != OUTPUT_COGSPIN && (gl_fcache_size == 0 || gl_fcache_size >= 16)) {
+            memmove = NewOperand(IMM_STRING, builtin_memmove_p2, 0);
+        } else {
+            memmove = NewOperand(IMM_STRING, builtin_memmove_noscratch_p2, 0);
+        }
+        EmitOp1(irl, OPC_LITERAL, memmove);
+    }
     if (pushregs_) {
         const char *builtin_pushregs = (gl_p2 ? builtin_pushregs_p2 : builtin_pushregs_p1);
         Operand *loop = NewOperand(IMM_STRING, builtin_pushregs, 0);
@@ -7414,6 +7722,12 @@ OutputAsmCode(const char *fname, Module *P, int outputMain)
     // and assemble the result
     asmcode = IRAssemble(&cogcode, P);
 
+    // this comes after IRAssemble so that it uses the same label
+    // names as the listing
+    if (gl_cycle_report && emitSpinCode) {
+        WriteCycleReport(gl_cycle_report, &cogcode);
+    }
+
     current = save;
 
     f = fopen(fname, "w");
@@ -45,6 +45,7 @@ Operand *NewImmediatePtr(const char *name, Operand *val);
 Operand *NewPcRelative(int32_t val);
 Operand *NewCodeLabel();  // use only while compiling a function
 Operand *NewHubLabel();
+Operand *GetBuiltinLabel(const char *name);
 Operand *CogMemRef(Operand *addr, int offset);
 Operand *SubRegister(Operand *reg, unsigned long offset);
 void FreeTempRegisters(IRList *irl, int starttempreg);
@@ -70,15 +71,31 @@ IR *EmitMove(IRList *irl, Operand *dst, Operand *src, AST *linenum);
 // optimization functions
 void OptimizeIRLocal(IRList *irl, Function *f);
 void OptimizeIRGlobal(IRList *irl);
+
+// like OptimizeIRLocal, but uses the on-disk cache if there is one
+void OptimizeIRLocalCached(IRList *irl, Function *f);
 void OptimizeFcache(IRList *irl);
 bool AnalyzeInlineEligibility(Function *f);
 bool RemoveIfInlined(Function *f);
 int  ExpandInlines(IRList *irl);
 
+// execution counts from --profile-use (in profile.c)
+long long ProfileCount(const char *name);
+bool ProfileIsCold(const char *name);
+bool ProfileCountIsHot(long long n);
+long long ProfileLineCount(AST *ast);
+bool ProfileLineIsHot(AST *ast);
+bool ProfileLineIsCold(AST *ast);
+
+// static cycle estimates for --cycle-report (in cycles.c)
+void WriteCycleReport(const char *fname, IRList *irl);
+const char *AsmLabelName(const char *name);
+
 void ReplaceOpcode(IR *ir, IROpcode op);
 
 bool IsDummy(IR *ir);
 bool IsBranch(IR *ir);
+bool NeedsImmAug(Operand *op);
 bool IsValidDstReg(Operand *reg);
 bool SrcOnlyHwReg(Operand *reg);
 bool IsLocal(Operand *reg);
@@ -136,6 +153,7 @@ typedef struct ir_bedata {
    #define ASM_INLINE_SMALL_FLAG  0x01
    #define ASM_INLINE_SINGLE_FLAG 0x02
    #define ASM_INLINE_PURE_FLAG   0x04
+   #define ASM_INLINE_HOT_FLAG    0x08  /* inline only at busy call sites */
 
    /* if this function was actually inlined somewhere (do we really need this?) */
     bool got_inlined;
@@ -0,0 +1,210 @@
+//
+// Execution profiles for the assembly backend
+//
+// Copyright 2026 Total Spectrum Software Inc.
+// see the file COPYING for conditions of redistribution
+//
+// A profile (--profile-use=file) is a text file giving how many times
+// each part of the program was executed, one "name count" pair per line.
+// Lines that are empty or start with '#' are ignored. Functions are named
+// by their label in the .lst/.p2asm output (like _main). Loop labels are
+// renumbered whenever the generated code changes, so loops (and the
+// branches of if statements) are named by the source position of their
+// first statement instead, as "file:line" (the file name without any
+// directory); a loop or branch that starts with another loop is named
+// by the first statement of that loop's body. Calls are looked up by
+// the "file:line" of the call itself, so a function can be inlined at a
+// busy call site and left as a call everywhere else.
+//
+// The optimizer only uses the profile to decide between choices it
+// would otherwise guess at; names that are not in the profile get the
+// usual static treatment.
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "spinc.h"
+#include "outasm.h"
+
+const char *gl_profile_use;
+
+// a label is hot if it ran at least 1/PROFILE_HOT_RATIO as often as
+// the most frequently run label, and cold if it ran less than
+// 1/PROFILE_COLD_RATIO as often
+#define PROFILE_HOT_RATIO  16
+#define PROFILE_COLD_RATIO 256
+
+typedef struct ProfileEntry {
+    const char *name;
+    unsigned long long count;
+} ProfileEntry;
+
+static ProfileEntry *profTable;
+static unsigned profSize;     // always a power of 2
+static unsigned profCount;
+static unsigned long long profMax;
+static bool profLoaded;
+
+static unsigned
+ProfileHash(const char *name)
+{
+    unsigned h = 5381;
+    while (*name) {
+        h = h * 33 + (unsigned char)*name++;
+    }
+    return h;
+}
+
+static ProfileEntry *
+FindProfileSlot(const char *name)
+{
+    unsigned i = ProfileHash(name) & (profSize - 1);
+    while (profTable[i].name && strcmp(profTable[i].name, name) != 0) {
+        i = (i + 1) & (profSize - 1);
+    }
+    return &profTable[i];
+}
+
+static void
+AddProfileEntry(const char *name, unsigned long long count)
+{
+    ProfileEntry *slot;
+
+    if (2*(profCount+1) > profSize) {
+        ProfileEntry *old = profTable;
+        unsigned oldsize = profSize;
+        unsigned i;
+        profSize = profSize ? 2*profSize : 256;
+        profTable = (ProfileEntry *)calloc(profSize, sizeof(*profTable));
+        for (i = 0; i < oldsize; i++) {
+            if (old[i].name) {
+                *FindProfileSlot(old[i].name) = old[i];
+            }
+        }
+        free(old);
+    }
+    slot = FindProfileSlot(name);
+    if (slot->name) {
+        // a label listed twice (e.g. from several cogs) gets the sum
+        slot->count += count;
+    } else {
+        slot->name = strdup(name);
+        slot->count = count;
+        profCount++;
+    }
+    if (slot->count > profMax) {
+        profMax = slot->count;
+    }
+}
+
+static void
+LoadProfile(void)
+{
+    FILE *f;
+    char line[512];
+    char *s, *name;
+    int lineno = 0;
+
+    profLoaded = true;
+    f = fopen(gl_profile_use, "r");
+    if (!f) {
+        ERROR(NULL, "Unable to open profile %s", gl_profile_use);
+        return;
+    }
+    while (fgets(line, sizeof(line), f)) {
+        lineno++;
+        s = line;
+        while (isspace((unsigned char)*s)) s++;
+        if (!*s || *s == '#') continue;
+        name = s;
+        while (*s && !isspace((unsigned char)*s)) s++;
+        if (*s) *s++ = 0;
+        while (isspace((unsigned char)*s)) s++;
+        if (!isdigit((unsigned char)*s)) {
+            WARNING(NULL, "%s:%d: expected a label and a count", gl_profile_use, lineno);
+            continue;
+        }
+        AddProfileEntry(name, strtoull(s, NULL, 10));
+    }
+    fclose(f);
+}
+
+//
+// return the execution count recorded for label "name",
+// or -1 if no profile was given or the label is not in it
+//
+long long
+ProfileCount(const char *name)
+{
+    ProfileEntry *slot;
+
+    if (!gl_profile_use || !name) {
+        return -1;
+    }
+    if (!profLoaded) {
+        LoadProfile();
+    }
+    if (!profCount) {
+        return -1;
+    }
+    slot = FindProfileSlot(name);
+    if (!slot->name) {
+        return -1;
+    }
+    return (long long)slot->count;
+}
+
+bool
+ProfileCountIsHot(long long n)
+{
+    return n > 0 && (unsigned long long)n * PROFILE_HOT_RATIO >= profMax;
+}
+
+bool
+ProfileIsCold(const char *name)
+{
+    long long n = ProfileCount(name);
+    return n >= 0 && (unsigned long long)n * PROFILE_COLD_RATIO < profMax;
+}
+
+//
+// look up the source position "file:line" of ast;
+// returns -1 if it is not in the profile
+//
+long long
+ProfileLineCount(AST *ast)
+{
+    LineInfo *info;
+    const char *fname, *s;
+    char buf[512];
+
+    if (!gl_profile_use || !ast) {
+        return -1;
+    }
+    info = GetLineInfo(ast);
+    if (!info || !info->fileName) {
+        return -1;
+    }
+    fname = info->fileName;
+    for (s = fname; *s; s++) {
+        if (*s == '/' || *s == '\\') {
+            fname = s+1;
+        }
+    }
+    snprintf(buf, sizeof(buf), "%s:%d", fname, info->lineno);
+    return ProfileCount(buf);
+}
+
+bool
+ProfileLineIsHot(AST *ast)
+{
+    return ProfileCountIsHot(ProfileLineCount(ast));
+}
+
+bool
+ProfileLineIsCold(AST *ast)
+{
+    long long n = ProfileLineCount(ast);
+    return n >= 0 && (unsigned long long)n * PROFILE_COLD_RATIO < profMax;
+}
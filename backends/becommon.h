@@ -12,6 +12,8 @@ void OutputDataBlob(Flexbuf *fb, Flexbuf *databuf, Flexbuf *relocbuf, const char
 void NormalizeVarOffsets(Function *f);
 
 void CompileAsmToBinary(const char *binname, const char *asmname); // in cmdline.c
+void PrintPeepholeStats(FILE *f); // in asm/asm_peep.c
+void PrintIRCacheStats(FILE *f); // in asm/ircache.c
 
 // evaluate any constant expressions inside a string
 // and return an AST representing the whole string
@@ -35,6 +37,7 @@ typedef struct DataBlockOutFuncs {
     void (*startAst)(Flexbuf *f, AST *ast);
     void (*putByte)(Flexbuf *f, int c);
     void (*endAst)(Flexbuf *f, AST *ast);
+    void (*putBytes)(Flexbuf *f, const char *data, size_t len); /* optional */
 } DataBlockOutFuncs;
 
 /*
@@ -6,6 +6,7 @@
 #include "bcbuffers.h"
 
 #define BC_MAX_POINTERS 256
+#define BC_FUNC_HASH_SIZE (2*BC_MAX_POINTERS) // must be a power of 2
 
 typedef struct {
     int compiledAddress; // -1 if not yet compiled
@@ -14,6 +15,10 @@ typedef struct {
     AST *objs[BC_MAX_POINTERS];
     int objs_arr_index[BC_MAX_POINTERS]; // Index of the object in the array it is part of. 0 for single objects
     BCRelocList *relocList;              // relocations for "compiledAddress"
+    // open addressed hash tables mapping Function pointers and (case folded)
+    // names to function IDs, built along with pubs/pris; 0 is an empty slot
+    uint16_t funcIdByPtr[BC_FUNC_HASH_SIZE];
+    uint16_t funcIdByName[BC_FUNC_HASH_SIZE];
 } BCModData;
 
 typedef struct {
@@ -111,11 +111,107 @@ static bool BCIR_SizeDetermined(ByteOpIR *ir) {
     return ir->fixedSize >= 0;
 }
 
+// While sizes are being determined, the size bounds of all ops are kept
+// in Fenwick trees indexed by position, so that the distance between any
+// two ops is the difference of two prefix sums, and fixing the size of an
+// op only needs a logarithmic update.
+static ByteOpIR **sizeOps;
+static int *sizeMin, *sizeMax;         // current bounds of each op
+static int *sizeMinTree, *sizeMaxTree; // Fenwick trees over the above
+static int sizeOpCount;
+
+static void BCIR_SizeTreeAdd(int pos,int dmin,int dmax) {
+    for (int i=pos+1;i<=sizeOpCount;i+=i&-i) {
+        sizeMinTree[i] += dmin;
+        sizeMaxTree[i] += dmax;
+    }
+}
+
+// Sum of the bounds of the ops before position pos
+static void BCIR_SizePrefix(int pos,int *min,int *max) {
+    *min = *max = 0;
+    for (int i=pos;i>0;i-=i&-i) {
+        *min += sizeMinTree[i];
+        *max += sizeMaxTree[i];
+    }
+}
+
+static void BCIR_SizeIndexFree() {
+    free(sizeOps);
+    free(sizeMin);
+    free(sizeMax);
+    free(sizeMinTree);
+    free(sizeMaxTree);
+    sizeOps = NULL;
+    sizeMin = sizeMax = sizeMinTree = sizeMaxTree = NULL;
+    sizeOpCount = 0;
+}
+
+static void BCIR_SizeIndexBuild(BCIRBuffer *irbuf) {
+    int n = 0;
+    BCIR_SizeIndexFree();
+    for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next) n++;
+    sizeOps = (ByteOpIR **)malloc(n*sizeof(*sizeOps));
+    sizeMin = (int *)calloc(n,sizeof(int));
+    sizeMax = (int *)calloc(n,sizeof(int));
+    sizeMinTree = (int *)calloc(n+1,sizeof(int));
+    sizeMaxTree = (int *)calloc(n+1,sizeof(int));
+    sizeOpCount = n;
+    n = 0;
+    for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next,n++) {
+        sizeOps[n] = ir;
+        ir->sizeIndex = n;
+        GetSizeBound_Func(ir,&sizeMin[n],&sizeMax[n],false);
+        BCIR_SizeTreeAdd(n,sizeMin[n],sizeMax[n]);
+    }
+}
+
+// Position of an op, or -1 if it is not in the index
+static int BCIR_SizeIndexOf(ByteOpIR *ir) {
+    int pos = ir->sizeIndex;
+    if (pos >= 0 && pos < sizeOpCount && sizeOps[pos] == ir) return pos;
+    return -1;
+}
+
+// Set the size of an op once it is known
+static void BCIR_FixSize(ByteOpIR *ir,int size) {
+    int pos;
+    ir->fixedSize = size;
+    if (sizeOps && (pos = BCIR_SizeIndexOf(ir)) >= 0) {
+        BCIR_SizeTreeAdd(pos,size-sizeMin[pos],size-sizeMax[pos]);
+        sizeMin[pos] = sizeMax[pos] = size;
+    }
+}
+
 void BCIR_GetJumpOffsetBounds(ByteOpIR *jump,bool func_relative,int *minDist, int *maxDist,int recursionsLeft) {
     ByteOpIR *searchingFor = jump->jumpTo;
     *minDist = *maxDist = 0;
     bool found = false;
     if (recursionsLeft) --recursionsLeft;
+    if (sizeOps) {
+        int from = BCIR_SizeIndexOf(jump);
+        int to = searchingFor ? BCIR_SizeIndexOf(searchingFor) : -1;
+        if (from >= 0 && to >= 0) {
+            int min1,max1,min2,max2;
+            if (func_relative) {
+                // Distance from the start of the function
+                BCIR_SizePrefix(to,minDist,maxDist);
+            } else if (to > from) {
+                // Forward (don't include jump itself)
+                BCIR_SizePrefix(from+1,&min1,&max1);
+                BCIR_SizePrefix(to,&min2,&max2);
+                *minDist = min2-min1;
+                *maxDist = max2-max1;
+            } else {
+                // Backward (include jump itself)
+                BCIR_SizePrefix(to+1,&min1,&max1);
+                BCIR_SizePrefix(from+1,&min2,&max2);
+                *minDist = min1-min2;
+                *maxDist = max1-max2;
+            }
+            return;
+        }
+    }
     // Try searching forward (don't include jump itself)
     for (ByteOpIR *ir=func_relative?current_birb->head:jump->next;ir;ir=ir->next) {
         if (ir==searchingFor) {
@@ -269,19 +365,21 @@ bool BCIR_IsResultMemop(ByteOpIR *ir) {
     return BCIR_IsConstMemOp(ir) && ir->attr.memop.base == MEMOP_BASE_DBASE && ir->data.int32 == 0 && ir->attr.memop.memSize == MEMOP_SIZE_LONG;
 }
 
-unsigned BCIR_GetRefCount(BCIRBuffer *irbuf,ByteOpIR *label) {
-    unsigned refs = 0;
+// Count the references to every label in one pass over the function
+// (rather than searching the whole function once per label)
+static void BCIR_CountRefs(BCIRBuffer *irbuf) {
     for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next) {
-        if (ir->jumpTo == label && BCIR_UsesLabel(ir)) refs++;
+        if (ir->kind == BOK_LABEL) {
+            ir->refCount = 0;
+            ir->refBy = NULL;
+        }
     }
-    return refs;
-}
-
-ByteOpIR *BCIR_AnyRef(BCIRBuffer *irbuf,ByteOpIR *label) {
     for (ByteOpIR *ir=irbuf->head;ir;ir=ir->next) {
-        if (ir->jumpTo == label && BCIR_UsesLabel(ir)) return ir;
+        if (ir->jumpTo && BCIR_UsesLabel(ir)) {
+            ir->jumpTo->refCount++;
+            ir->jumpTo->refBy = ir;
+        }
     }
-    return false;
 }
 
 static bool BCIR_OptDeadCode() {
@@ -327,11 +425,12 @@ static bool BCIR_OptPointlessJump() {
 
 static bool BCIR_OptUnusedLabel() {
     // An unreferenced label can be removed, consecutive labels can be combined
-    // This is an O(x^2) operation, but it's only per-function, so it's ok(tm)
+    // Combining labels is O(x^2), but it's only per-function, so it's ok(tm)
     bool didWork = false;
+    BCIR_CountRefs(current_birb);
     for(ByteOpIR *ir = current_birb->head;ir;ir=ir->next) {
         if (ir->kind == BOK_LABEL) {
-            if(!BCIR_AnyRef(current_birb,ir)) {
+            if(!ir->refCount) {
                 BIRB_Remove(current_birb,ir);
                 didWork = true;
             } else {
@@ -339,6 +438,7 @@ static bool BCIR_OptUnusedLabel() {
                     for (ByteOpIR *pj=current_birb->head;pj;pj=pj->next) {
                         if (BCIR_UsesLabel(pj) && pj->jumpTo == ir->next) pj->jumpTo = ir;
                     }
+                    ir->refCount += ir->next->refCount;
                     BIRB_Remove(current_birb,ir->next);
                     didWork = true;
                 }
@@ -407,10 +507,12 @@ static bool BCIR_OptReplaceJumpToOpWithItself() {
 static bool BCIR_OptMoveSingleJumpLabel() {
     // A block following a terminal op referenced by a single unconditional jump can be moved after it
     // This i.e. makes OTHER cases move to the top if possible
+    // Moving blocks doesn't retarget anything, so the counts stay valid throughout
     bool didWork = false;
+    BCIR_CountRefs(current_birb);
     for(ByteOpIR *ir = current_birb->head;ir;ir=ir->next) {
-        if (ir->kind == BOK_LABEL && ir->prev && BCIR_IsTerminalOp(ir->prev) && BCIR_GetRefCount(current_birb,ir) == 1) {
-            ByteOpIR *jump = BCIR_AnyRef(current_birb,ir);
+        if (ir->kind == BOK_LABEL && ir->prev && BCIR_IsTerminalOp(ir->prev) && ir->refCount == 1) {
+            ByteOpIR *jump = ir->refBy;
             if (!jump || jump->kind != BOK_JUMP) continue;
             ByteOpIR *first = ir->next;
             ByteOpIR *last = first;
@@ -563,10 +665,10 @@ BCIR_DetermineSizes(BCIRBuffer *irbuf,bool force,int maxRecursion) {
         GetSizeBound_Func(ir,&min,&max,maxRecursion);
         if (min<0||max<0) ERROR(NULL,"Internal error, size bounds negative");
         if (min==max) {
-            ir->fixedSize = max;
+            BCIR_FixSize(ir,max);
             didSomething = true;
         } else if (force && BCIR_CanBeOversized(ir)) {
-            ir->fixedSize = max;
+            BCIR_FixSize(ir,max);
             return true;
         }
     }
@@ -586,6 +688,7 @@ BCIR_AllDetermined(BCIRBuffer *irbuf) {
 static void
 BCIR_Compact(BCIRBuffer *irbuf,int maxRecursion) {
     for(ByteOpIR *ir=irbuf->head;ir;ir=ir->next) ir->fixedSize = -1; // Initialize all sizes to -1
+    BCIR_SizeIndexBuild(irbuf);
     for(;;) {
         // Fix sizes until we cant anymore
         while (BCIR_DetermineSizes(irbuf,false,maxRecursion));
@@ -615,6 +718,7 @@ void BCIR_to_BOB(BCIRBuffer *irbuf,ByteOutputBuffer *bob,int pbase_funoffset) {
         instrSpan->comment = comment;
         BOB_PushSpan(bob,instrSpan);
     }
+    BCIR_SizeIndexFree();
     current_birb = NULL;
 }
 
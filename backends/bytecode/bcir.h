@@ -243,6 +243,9 @@ typedef struct bcirstruct {
     struct bcirstruct *jumpTo; // Label that is referenced
 
     int fixedSize; // If set, the size of this op is known. For BOK_LABEL and other zero-size ops, this is irrelevant
+    int sizeIndex; // Position in the function while sizes are being determined
+    unsigned refCount; // For BOK_LABEL: number of ops referencing it, as of the last BCIR_CountRefs
+    struct bcirstruct *refBy; // For BOK_LABEL: the last op found referencing it
 
 } ByteOpIR;
 
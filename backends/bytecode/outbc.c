@@ -12,6 +12,7 @@
 #include <stdlib.h>
 #include "becommon.h"
 #include <inttypes.h>
+#include <ctype.h>
 
 const BCContext nullcontext = {.hiddenVariables = 0};
 
@@ -1299,6 +1300,38 @@ redoLeft:
     }
 }
 
+static unsigned funcPtrHash(Function *F) {
+    uintptr_t x = (uintptr_t)F;
+    return (unsigned)((x >> 4) ^ (x >> 13)) & (BC_FUNC_HASH_SIZE-1);
+}
+
+static unsigned funcNameHash(const char *name) {
+    unsigned h = 0;
+    // fold case so case insensitive lookups land in the same chain
+    while (*name) h = h*31 + tolower((unsigned char)*name++);
+    return h & (BC_FUNC_HASH_SIZE-1);
+}
+
+// (re)build the function ID maps; must be called whenever pubs/pris change
+static void buildFuncIDMap(Module *M) {
+    BCModData *md = ModData(M);
+    int total = md->pub_cnt + md->pri_cnt;
+
+    memset(md->funcIdByPtr, 0, sizeof(md->funcIdByPtr));
+    memset(md->funcIdByName, 0, sizeof(md->funcIdByName));
+    // insert in ID order, so that of several functions whose names compare
+    // equal the lowest ID comes first in its probe sequence
+    for (int id = 1; id <= total; id++) {
+        Function *F = BCgetFuncForId(M, id);
+        unsigned h = funcPtrHash(F);
+        while (md->funcIdByPtr[h]) h = (h+1) & (BC_FUNC_HASH_SIZE-1);
+        md->funcIdByPtr[h] = id;
+        h = funcNameHash(F->name);
+        while (md->funcIdByName[h]) h = (h+1) & (BC_FUNC_HASH_SIZE-1);
+        md->funcIdByName[h] = id;
+    }
+}
+
 static int getFuncID(Module *M,const char *name) {
     int (*StrComp)(const char *, const char *);
     
@@ -1312,11 +1345,9 @@ static int getFuncID(Module *M,const char *name) {
     } else {
         StrComp = strcasecmp;
     }
-    for (int i=0;i<ModData(M)->pub_cnt;i++) {
-        if (!StrComp(ModData(M)->pubs[i]->name,name)) return i + 1;
-    }
-    for (int i=0;i<ModData(M)->pri_cnt;i++) {
-        if (!StrComp(ModData(M)->pris[i]->name,name)) return ModData(M)->pub_cnt + i + 1;
+    for (unsigned h = funcNameHash(name); ModData(M)->funcIdByName[h]; h = (h+1) & (BC_FUNC_HASH_SIZE-1)) {
+        int id = ModData(M)->funcIdByName[h];
+        if (!StrComp(BCgetFuncForId(M, id)->name,name)) return id;
     }
     return -1;
 }
@@ -1326,11 +1357,9 @@ static int getFuncIDForKnownFunc(Module *M,Function *F) {
         ERROR(NULL,"Internal Error: bedata empty");
         return -1;
     }
-    for (int i=0;i<ModData(M)->pub_cnt;i++) {
-        if (ModData(M)->pubs[i] == F) return i + 1;
-    }
-    for (int i=0;i<ModData(M)->pri_cnt;i++) {
-        if (ModData(M)->pris[i] == F) return ModData(M)->pub_cnt + i + 1;
+    for (unsigned h = funcPtrHash(F); ModData(M)->funcIdByPtr[h]; h = (h+1) & (BC_FUNC_HASH_SIZE-1)) {
+        int id = ModData(M)->funcIdByPtr[h];
+        if (BCgetFuncForId(M, id) == F) return id;
     }
     return -1;
 }
@@ -3147,6 +3176,7 @@ BCPrepareObject(Module *P) {
         }
         ModData(P)->pub_cnt = pub_cnt;
         ModData(P)->pri_cnt = pri_cnt;
+        buildFuncIDMap(P);
     }
     // Count can't be modified anymore, so mirror it into const locals for convenience
     const int pub_cnt = ModData(P)->pub_cnt;
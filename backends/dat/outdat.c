@@ -147,6 +147,8 @@ OutputDatFile(const char *fname, Module *P, int prefixBin)
     }
 
     flexbuf_init(&fb, BUFSIZ);
+    // leave room for the Spin header and footer, too
+    flexbuf_reserve(&fb, P->datsize + 64);
     if (prefixBin && !gl_p2) {
         /* output a binary header */
         OutputSpinDummyHeader(&fb, P);
@@ -190,10 +192,17 @@ outputByteBinary(Flexbuf *f, int c)
     flexbuf_putc(c, f);
 }
 
+static void
+outputBytesBinary(Flexbuf *f, const char *data, size_t len)
+{
+    flexbuf_addmem(f, data, len);
+}
+
 static DataBlockOutFuncs defaultOutFuncs = {
     NULL,
     outputByteBinary,
     NULL,
+    outputBytesBinary,
 };
 
 static DataBlockOutFuncs *outFuncs;
@@ -205,6 +214,21 @@ outputByte(Flexbuf *f, int c)
     datacount++;
 }
 
+static void
+outputBytes(Flexbuf *f, const char *data, size_t len)
+{
+    size_t i;
+
+    if (outFuncs->putBytes) {
+        (outFuncs->putBytes)(f, data, len);
+    } else {
+        for (i = 0; i < len; i++) {
+            (outFuncs->putByte)(f, data[i] & 0xff);
+        }
+    }
+    datacount += len;
+}
+
 static void
 outputLong(Flexbuf *f, uint32_t c)
 {
@@ -1968,22 +1992,37 @@ outputAlignedDataList(Flexbuf *f, int size, AST *ast, Flexbuf *relocs, int check
 
 /*
  * output bytes for a file
+ * the whole file is copied into the output in one go
  */
 static void
 assembleFile(Flexbuf *f, AST *ast)
 {
     FILE *inf;
     const char *name = ast->d.string;
-    int c;
+    char *data;
+    long len;
+    size_t got;
 
     inf = fopen(name, "rb");
     if (!inf) {
         ERROR(ast, "file %s: %s", name, strerror(errno));
         return;
     }
-    while ((c = fgetc(inf)) >= 0) {
-        outputByte(f, c);
+    if (fseek(inf, 0L, SEEK_END) < 0 || (len = ftell(inf)) < 0) {
+        ERROR(ast, "file %s: %s", name, strerror(errno));
+        fclose(inf);
+        return;
+    }
+    rewind(inf);
+    data = (char *)malloc(len ? len : 1);
+    if (!data) {
+        ERROR(ast, "file %s: out of memory", name);
+        fclose(inf);
+        return;
     }
+    got = fread(data, 1, len, inf);
+    outputBytes(f, data, got);
+    free(data);
     fclose(inf);
 }
 
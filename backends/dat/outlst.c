@@ -69,6 +69,28 @@ static void lstPutByte(Flexbuf *f, int c) {
     cogPc++;
 }
 
+// large blocks of bytes (from FILE) are summarized: only the first
+// few are shown, followed by a line giving the count of the rest
+#define LST_BYTES_SHOWN 16
+
+static void lstPutBytes(Flexbuf *f, const char *data, size_t len) {
+    size_t i;
+
+    for (i = 0; i < len && i < LST_BYTES_SHOWN; i++) {
+        lstPutByte(f, data[i] & 0xff);
+    }
+    if (i < len) {
+        char count[16];
+
+        startNewLine(f);
+        snprintf(count, sizeof(count), "(+%u)", (unsigned)(len - i));
+        flexbuf_printf(f, "%-12s", count);
+        bytesOnLine = 4;
+        hubPc += len - i;
+        cogPc += len - i;
+    }
+}
+
 static void AddRestOfLine(Flexbuf *f, const char *s) {
     int c;
     while (bytesOnLine < 4) {
@@ -347,6 +369,7 @@ static DataBlockOutFuncs lstOutputFuncs = {
     lstStartAst,
     lstPutByte,
     lstEndAst,
+    lstPutBytes,
 };
 
 //
@@ -461,6 +484,8 @@ OutputLstFile(const char *fname, Module *P)
     }
     current = P;
     flexbuf_init(&fb, BUFSIZ);
+    // each long of data takes up a listing line of about 30 characters
+    flexbuf_reserve(&fb, 8 * (size_t)P->datsize);
     initLstOutput(P);
     
     PrintDataBlock(&fb, P->datblock, &lstOutputFuncs, NULL);
@@ -378,73 +378,256 @@ GetBytecodeFor(NuIr *ir)
     return b;
 }
 //
-// scan list of instructions for pairs that may be combined into a macro
+// pairs of instructions that may be combined into a macro
 // only opcodes that have been assigned single bytecodes may be merged
 //
+// Rather than rescanning the whole program for every new macro, we
+// count every adjacent pair once up front and then keep the counts
+// up to date as macros are substituted (much like Re-Pair / BPE
+// compression). Each occurrence is identified by the position (seqno)
+// of its second instruction; the pairs themselves are kept in
+// buckets by usage count, so the most frequent one is quick to find.
+//
 typedef struct NuMacro {
     NuBytecode *firstCode;
     NuBytecode *secondCode;
     int count;
     int depth;
+    unsigned occurs;     // position of some occurrence; see occNext/occPrev
+    unsigned lastPos;    // position of the last occurrence in the program
+    bool lastValid;      // false if lastPos has to be recomputed
+    struct NuMacro *hashNext;
+    struct NuMacro *bucketNext;
+    struct NuMacro *bucketPrev;
 } NuMacro;
 
-static NuMacro macros[256][256];
-
 #define MAX_MACRO_DEPTH 4
 
+static struct {
+    NuIr **ir;           // instruction at each position
+    NuIrList **list;     // list containing that instruction
+    NuMacro **pair;      // pair ending at this position, if any
+    unsigned *occNext;   // links between occurrences of the same pair
+    unsigned *occPrev;
+    NuMacro **hash;
+    unsigned hashMask;
+    NuMacro **bucket;    // pairs with a given count
+    int maxCount;
+} nupairs;
+
+static Arena macro_arena = { "nucode macros" };
+
 static bool Mergeable(int code) {
     return (code <= MAX_DIRECT_CONST) || (code >= FIRST_BYTECODE);
 }
 
-// scan for potential macro pairs
-static NuMacro *NuScanForMacros(NuIrList *lists, int *savings) {
-    NuIrList *irl = lists;
-    NuIr *ir;
-    int maxCount = 0;
-    NuBytecode *prevCode, *curCode;
-    NuMacro *where = 0;
-    int savedBytes;
+// check whether the sequence "prevCode curCode" may become a macro
+// (whether their bytecodes are mergeable is decided later, since
+// that may change as constants are compressed)
+static bool CanPair(NuBytecode *prevCode, NuBytecode *curCode) {
+    if (!prevCode || !curCode) {
+        return false;
+    }
+    // no macros involving inline asm or relative branches,
+    // and nothing may follow a branch
+    if (prevCode->is_inline_asm || prevCode->is_rel_branch || prevCode->is_any_branch) {
+        return false;
+    }
+    if (curCode->is_inline_asm || curCode->is_rel_branch) {
+        return false;
+    }
+    return prevCode->macro_depth < MAX_MACRO_DEPTH && curCode->macro_depth < MAX_MACRO_DEPTH;
+}
 
-    memset(macros, 0, sizeof(macros));
-    while (irl) {
-        prevCode = NULL;
-        for (ir = irl->head; ir; ir = ir->next) {
-            curCode = ir->bytecode;
-            if (curCode && (curCode->is_inline_asm || curCode->is_rel_branch)) {
-                // no macros involving inline asm or relative branches
-                curCode = NULL;
+static void NuSetPairCount(NuMacro *m, int count) {
+    if (m->count > 0) {
+        if (m->bucketPrev) {
+            m->bucketPrev->bucketNext = m->bucketNext;
+        } else {
+            nupairs.bucket[m->count] = m->bucketNext;
+        }
+        if (m->bucketNext) {
+            m->bucketNext->bucketPrev = m->bucketPrev;
+        }
+    }
+    m->count = count;
+    if (count > 0) {
+        m->bucketPrev = NULL;
+        m->bucketNext = nupairs.bucket[count];
+        if (m->bucketNext) {
+            m->bucketNext->bucketPrev = m;
+        }
+        nupairs.bucket[count] = m;
+        if (count > nupairs.maxCount) {
+            nupairs.maxCount = count;
+        }
+    }
+}
+
+static NuMacro *NuFindPair(NuBytecode *first, NuBytecode *second) {
+    uintptr_t h = ((uintptr_t)first >> 4) * 31 + ((uintptr_t)second >> 4);
+    NuMacro **where = &nupairs.hash[(h ^ (h >> 13)) & nupairs.hashMask];
+    NuMacro *m;
+
+    for (m = *where; m; m = m->hashNext) {
+        if (m->firstCode == first && m->secondCode == second) {
+            return m;
+        }
+    }
+    m = (NuMacro *)arena_calloc(&macro_arena, sizeof(*m));
+    m->firstCode = first;
+    m->secondCode = second;
+    m->hashNext = *where;
+    *where = m;
+    return m;
+}
+
+// record the pair (if any) ending at instruction ir
+static void NuAddPairAt(NuIr *ir) {
+    unsigned pos = ir->seqno;
+    NuMacro *m;
+
+    if (!ir->prev || !CanPair(ir->prev->bytecode, ir->bytecode)) {
+        return;
+    }
+    m = NuFindPair(ir->prev->bytecode, ir->bytecode);
+    nupairs.pair[pos] = m;
+    nupairs.occPrev[pos] = 0;
+    nupairs.occNext[pos] = m->occurs;
+    if (m->occurs) {
+        nupairs.occPrev[m->occurs] = pos;
+    }
+    m->occurs = pos;
+    if (m->count == 0) {
+        m->lastPos = pos;
+        m->lastValid = true;
+    } else if (pos > m->lastPos) {
+        m->lastPos = pos;
+    }
+    NuSetPairCount(m, m->count + 1);
+}
+
+// forget the pair (if any) ending at instruction ir
+static void NuRemovePairAt(NuIr *ir) {
+    unsigned pos = ir->seqno;
+    NuMacro *m = nupairs.pair[pos];
+    unsigned prev, next;
+
+    if (!m) {
+        return;
+    }
+    prev = nupairs.occPrev[pos];
+    next = nupairs.occNext[pos];
+    if (prev) {
+        nupairs.occNext[prev] = next;
+    } else {
+        m->occurs = next;
+    }
+    if (next) {
+        nupairs.occPrev[next] = prev;
+    }
+    nupairs.pair[pos] = NULL;
+    if (pos == m->lastPos) {
+        m->lastValid = false;
+    }
+    NuSetPairCount(m, m->count - 1);
+}
+
+static unsigned NuPairLastPos(NuMacro *m) {
+    unsigned pos;
+
+    if (!m->lastValid) {
+        m->lastPos = 0;
+        for (pos = m->occurs; pos; pos = nupairs.occNext[pos]) {
+            if (pos > m->lastPos) {
+                m->lastPos = pos;
             }
-            if (curCode && prevCode && curCode->macro_depth < MAX_MACRO_DEPTH && prevCode->macro_depth < MAX_MACRO_DEPTH) {
-                int bc1, bc2;
-                bc1 = prevCode->code;
-                bc2 = curCode->code;
-                if (Mergeable(bc1) && Mergeable(bc2) ) {
-                    macros[bc1][bc2].count++;
-                    if (macros[bc1][bc2].count > maxCount) {
-                        maxCount = macros[bc1][bc2].count;
-                        where = &macros[bc1][bc2];
-                        where->firstCode = prevCode;
-                        where->secondCode = curCode;
-                    }
-                }
+        }
+        m->lastValid = true;
+    }
+    return m->lastPos;
+}
+
+// number the instructions and count all the pairs in them
+static void NuInitPairs(NuIrList *lists) {
+    NuIrList *irl;
+    NuIr *ir, *prev;
+    unsigned n = 0;
+
+    for (irl = lists; irl; irl = irl->nextList) {
+        for (ir = irl->head; ir; ir = ir->next) {
+            n++;
+        }
+    }
+    nupairs.ir = (NuIr **)calloc(n+1, sizeof(NuIr *));
+    nupairs.list = (NuIrList **)calloc(n+1, sizeof(NuIrList *));
+    nupairs.pair = (NuMacro **)calloc(n+1, sizeof(NuMacro *));
+    nupairs.occNext = (unsigned *)calloc(n+1, sizeof(unsigned));
+    nupairs.occPrev = (unsigned *)calloc(n+1, sizeof(unsigned));
+    nupairs.bucket = (NuMacro **)calloc(n+1, sizeof(NuMacro *));
+    nupairs.hashMask = 255;
+    while (nupairs.hashMask < n) {
+        nupairs.hashMask = 2*nupairs.hashMask + 1;
+    }
+    nupairs.hash = (NuMacro **)calloc(nupairs.hashMask+1, sizeof(NuMacro *));
+    nupairs.maxCount = 0;
+
+    // positions follow program order, and never change after this
+    n = 0;
+    for (irl = lists; irl; irl = irl->nextList) {
+        prev = NULL;
+        for (ir = irl->head; ir; ir = ir->next) {
+            ir->seqno = ++n;
+            ir->prev = prev;
+            nupairs.ir[n] = ir;
+            nupairs.list[n] = irl;
+            NuAddPairAt(ir);
+            prev = ir;
+        }
+    }
+}
+
+static void NuFreePairs(void) {
+    free(nupairs.ir);
+    free(nupairs.list);
+    free(nupairs.pair);
+    free(nupairs.occNext);
+    free(nupairs.occPrev);
+    free(nupairs.bucket);
+    free(nupairs.hash);
+    memset(&nupairs, 0, sizeof(nupairs));
+}
+
+// find the best pair to turn into a macro: the most frequent one, and
+// of those the one whose last occurrence comes first in the program
+static NuMacro *NuScanForMacros(int *savings) {
+    NuMacro *m, *where = NULL;
+    int count;
+
+    for (count = nupairs.maxCount; count > 0; --count) {
+        where = NULL;
+        for (m = nupairs.bucket[count]; m; m = m->bucketNext) {
+            if (!Mergeable(m->firstCode->code) || !Mergeable(m->secondCode->code)) {
+                continue;
             }
-            if (curCode && !curCode->is_any_branch) {
-                prevCode = curCode;
-            } else {
-                prevCode = NULL;
+            if (!where || NuPairLastPos(m) < NuPairLastPos(where)) {
+                where = m;
             }
         }
-        irl = irl->nextList;
+        if (where) {
+            break;
+        }
+        if (count == nupairs.maxCount && !nupairs.bucket[count]) {
+            nupairs.maxCount = count - 1;
+        }
     }
     // figure out the benefit of doing this replacement
     // the new macro requires at least 8 bytes implementation
     // it will save 1 byte per invocation
-    savedBytes = maxCount - 7;
-
-    if (savedBytes < 0) {
+    if (count - 7 < 0) {
         return NULL;
     }
-    *savings = savedBytes;
+    *savings = count - 7;
     where->depth = where->firstCode->macro_depth;
     if (where->secondCode->macro_depth > where->depth) {
         where->depth = where->secondCode->macro_depth;
@@ -454,26 +637,10 @@ static NuMacro *NuScanForMacros(NuIrList *lists, int *savings) {
 }
 
 //
-// recalculate usage of bytescodes
+// sort the bytecodes by usage
+// (the usage counts themselves are kept up to date as macros are made)
 //
-static void NuRecalcUsage(NuIrList *lists) {
-    NuIrList *irl = lists;
-    NuIr *ir;
-    NuBytecode *curCode;
-    int i;
-
-    for (i = 0; i < num_bytecodes; i++) {
-        globalBytecodes[i]->usage = 0;
-    }
-    while (irl) {
-        for (ir = irl->head; ir; ir = ir->next) {
-            curCode = ir->bytecode;
-            if (curCode) {
-                curCode->usage++;
-            }
-        }
-        irl = irl->nextList;
-    }
+static void NuSortByUsage(void) {
     qsort(&globalBytecodes, num_bytecodes, sizeof(globalBytecodes[0]), usage_sortfunc);
 }
 
@@ -659,10 +826,20 @@ const char *NuMergeBytecodes(const char *bcname, NuBytecode *first, NuBytecode *
     return flexbuf_get(fb);
 }
 
-static NuBytecode *NuReplaceMacro(NuIrList *lists, NuMacro *macro) {
-    NuIrList *irl = lists;
-    NuIr *ir;
+
+static int pos_sortfunc(const void *Av, const void *Bv) {
+    unsigned A = *(const unsigned *)Av;
+    unsigned B = *(const unsigned *)Bv;
+    return (A > B) - (A < B);
+}
+
+static NuBytecode *NuReplaceMacro(NuMacro *macro) {
+    NuIrList *irl;
+    NuIr *ir, *delir;
     NuBytecode *bc, *first, *second;
+    unsigned *occ;
+    unsigned pos;
+    int i, n;
 
     bc = AllocBytecode();
     if (!bc) {
@@ -676,25 +853,45 @@ static NuBytecode *NuReplaceMacro(NuIrList *lists, NuMacro *macro) {
     bc->name = auto_printf(128, "%s_%s", first->name, second->name);
     bc->impl_ptr = NuMergeBytecodes(bc->name, first, second);
     bc->impl_size = NuImplSize(bc->impl_ptr);
-    while (irl) {
-        for (ir = irl->head; ir; ir = ir->next) {
-            NuIr *delir = ir->next;
-            if (ir->bytecode == first && delir && delir->bytecode == second) {
-                ir->bytecode = bc;
-                bc->usage++;
-                ir->next = delir->next;
-                if (ir->next) {
-                    ir->next->prev = ir;
-                } else {
-                    irl->tail = ir;
-                }
-                first->usage--;
-                second->usage--;
-            }
-        }
 
-        irl = irl->nextList;
+    // replace the occurrences in program order, so that in overlapping
+    // sequences like A A A only the first pair is replaced
+    occ = (unsigned *)malloc(macro->count * sizeof(*occ));
+    n = 0;
+    for (pos = macro->occurs; pos; pos = nupairs.occNext[pos]) {
+        occ[n++] = pos;
+    }
+    qsort(occ, n, sizeof(*occ), pos_sortfunc);
+    for (i = 0; i < n; i++) {
+        pos = occ[i];
+        if (nupairs.pair[pos] != macro) {
+            // overlapped an earlier replacement
+            continue;
+        }
+        delir = nupairs.ir[pos];
+        ir = delir->prev;
+        irl = nupairs.list[pos];
+        NuRemovePairAt(ir);
+        NuRemovePairAt(delir);
+        if (delir->next) {
+            NuRemovePairAt(delir->next);
+        }
+        ir->bytecode = bc;
+        bc->usage++;
+        ir->next = delir->next;
+        if (ir->next) {
+            ir->next->prev = ir;
+        } else {
+            irl->tail = ir;
+        }
+        first->usage--;
+        second->usage--;
+        NuAddPairAt(ir);
+        if (ir->next) {
+            NuAddPairAt(ir->next);
+        }
     }
+    free(occ);
     return bc;
 }
 
@@ -707,6 +904,7 @@ void NuCreateBytecodes(NuIrList *lists)
     int i;
     int code;
     NuBytecode *bc;
+    ArenaMark macroMark;
 
     int lut_size = 0x300;
     
@@ -745,6 +943,8 @@ void NuCreateBytecodes(NuIrList *lists)
     }
 
     // while there's room for more bytecodes, find ways to compress the code
+    arena_mark(&macro_arena, &macroMark);
+    NuInitPairs(lists);
     while (code < (MAX_BYTECODE-1) && (gl_optimize_flags & OPT_MAKE_MACROS)) {
         int32_t val;
         int cost;
@@ -755,9 +955,9 @@ void NuCreateBytecodes(NuIrList *lists)
         bool isBuiltin = false;
 
         compressValue = macroValue = -1;
-        NuRecalcUsage(lists);
+        NuSortByUsage();
         bc = NuFindCompressBytecode(lists, &compressValue);
-        macro = NuScanForMacros(lists, &macroValue);
+        macro = NuScanForMacros(&macroValue);
         if (bc) {
             if (macro) {
                 // pick which is better
@@ -828,7 +1028,7 @@ void NuCreateBytecodes(NuIrList *lists)
             bc->impl_size = (immflag[0]) ? 3 : 2;
             bc->is_const = 0; // don't need to emit PUSHI for this one
         } else if (macro) {
-            bc = NuReplaceMacro(lists, macro);
+            bc = NuReplaceMacro(macro);
         } else {
             break;
         }
@@ -837,6 +1037,9 @@ void NuCreateBytecodes(NuIrList *lists)
             lut_size += bc->impl_size;
         }
     }
+    NuFreePairs();
+    arena_release(&macro_arena, &macroMark);
+
     // finally, sort byte bytecode
     qsort(&globalBytecodes, num_bytecodes, elemsize, codenum_sortfunc);
 }
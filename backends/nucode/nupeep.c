@@ -809,36 +809,82 @@ int NuConvertDjnz(NuIrList *irl)
 }
 
 // remove unused labels
-static bool
-LabelUsed(NuIrList *irl, NuIrLabel *label)
+// the labels defined in the list are collected into a small hash table
+// first, so the whole list only has to be scanned once for references
+typedef struct LabelUse {
+    NuIrLabel *label;
+    bool used;
+} LabelUse;
+
+static LabelUse *
+FindLabelUse(LabelUse *tab, unsigned mask, NuIrLabel *label)
 {
-    NuIr *ir;
-    for (ir = irl->head; ir; ir = ir->next) {
-        if (ir->op == NU_OP_LABEL) {
-            continue;
-        }
-        if (ir->label == label) {
-            return true;
-        }
+    unsigned i = ((uintptr_t)label >> 4) & mask;
+
+    while (tab[i].label && tab[i].label != label) {
+        i = (i + 1) & mask;
     }
-    return false;
+    return &tab[i];
 }
 
 int
 NuRemoveUnusedLabels(NuIrList *irl)
 {
     int changes = 0;
+    unsigned numLabels = 0;
+    unsigned mask;
+    LabelUse *tab;
+    LabelUse *lu;
+    bool nullUsed = false;
+    bool used;
     NuIr *ir;
 
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->op == NU_OP_LABEL) {
+            numLabels++;
+        }
+    }
+    if (numLabels == 0) {
+        return 0;
+    }
+    mask = 15;
+    while (mask < 2*numLabels) {
+        mask = 2*mask + 1;
+    }
+    tab = (LabelUse *)calloc(mask+1, sizeof(*tab));
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->op == NU_OP_LABEL && ir->label) {
+            FindLabelUse(tab, mask, ir->label)->label = ir->label;
+        }
+    }
+    for (ir = irl->head; ir; ir = ir->next) {
+        if (ir->op == NU_OP_LABEL) {
+            continue;
+        }
+        if (!ir->label) {
+            nullUsed = true;
+            continue;
+        }
+        lu = FindLabelUse(tab, mask, ir->label);
+        if (lu->label) {
+            lu->used = true;
+        }
+    }
+
     ir = irl->head;
     if (ir && ir->op == NU_OP_LABEL) {
         ir = ir->next;
     }
     for (; ir; ir = ir->next) {
-        if (ir->op == NU_OP_LABEL && !LabelUsed(irl, ir->label)) {
+        if (ir->op != NU_OP_LABEL) {
+            continue;
+        }
+        used = ir->label ? FindLabelUse(tab, mask, ir->label)->used : nullUsed;
+        if (!used) {
             NuDeleteIr(irl, ir);
             changes++;
         }
     }
+    free(tab);
     return changes;
 }
@@ -0,0 +1,7878 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         BASICYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         basicyyparse
+#define yylex           basicyylex
+#define yyerror         basicyyerror
+#define yydebug         basicyydebug
+#define yynerrs         basicyynerrs
+
+/* First part of user prologue.  */
+#line 10 "frontends/basic/basic.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include "frontends/common.h"
+#include "frontends/lexer.h"
+
+#undef  YYSTYPE
+#define YYSTYPE BASICYYSTYPE
+    
+/* Yacc functions */
+    void basicyyerror(const char *);
+    int basicyylex(BASICYYSTYPE *);
+
+    extern int gl_errors;
+
+    extern AST *last_ast;
+    extern AST *CommentedListHolder(AST *); // in spin.y
+    
+#define YYERROR_VERBOSE 1
+
+extern AST *IntegerLabel(AST *);
+    
+AST *GetIORegisterPair(const char *name1, const char *name2)
+{
+    Symbol *sym = FindSymbol(&basicReservedWords, name1);
+    AST *reg1, *reg2;
+    if (!sym) {
+        SYNTAX_ERROR("Unknown ioregister %s", name1);
+        return NULL;
+    }
+    reg1 = NewAST(AST_HWREG, NULL, NULL);
+    reg2 = NULL;
+    
+    reg1->d.ptr = sym->v.ptr;
+    if (name2 && gl_p2) {
+        // for now, only use the register pairs on P2 (where it matters)
+        // (FIXME? it could also come into play for P1V on FPGA...)
+        sym = FindSymbol(&basicReservedWords, name2);
+        if (sym) {
+            reg2 = NewAST(AST_HWREG, NULL, NULL);
+            reg2->d.ptr = sym->v.ptr;
+        }
+    }
+    if (reg2) {
+        reg1 = NewAST(AST_REGPAIR, reg1, reg2);
+    }
+    return reg1;
+}
+
+AST *GetPinRange(const char *name1, const char *name2, AST *range)
+{
+    AST *reg = GetIORegisterPair(name1, name2);
+    AST *ast = NULL;
+    if (reg) {
+        ast = NewAST(AST_RANGEREF, reg, range);
+    }
+    return ast;
+}
+
+static AST *
+InputHandle(AST *h)
+{
+    return h ? h : AstInteger(0);
+}
+
+static AST *
+OutputHandle(AST *h)
+{
+    return h ? h : AstInteger(1);
+}
+
+#define ARRAY_BASE_NAME "__array_base"
+#define IMPLICIT_TYPE_NAME "__implicit_types"
+#define EXPLICIT_DECL_NAME "__explicit_declares_required"
+/* __explicit_declares_required is a bitmask saying which kinds of things
+ * require explicit declarations:
+ *  1 == assignment statements without LET
+ *  2 == assignment statements with LET
+ *  4 == read statements
+ *  8 == for loop variables
+ */
+#define DEFAULT_EXPLICIT_DECLARES 0x5
+#define GetExplicitDeclares() GetCurOptionSymbol(EXPLICIT_DECL_NAME, DEFAULT_EXPLICIT_DECLARES)
+
+Symbol *
+GetCurOptionSymbol(const char *name, int defval)
+{
+#if 0
+    // this would make option base work nicely inside scopes
+    SymbolTable *symtab = currentTypes;
+#else
+    // this is more practical and keeps a value for option base that we
+    // can use later for pointer dereferences
+    SymbolTable *symtab = current ? &current->objsyms : currentTypes;
+#endif    
+    Symbol *sym = LookupSymbolInTable(symtab, name);
+    if (!sym) {
+        sym = AddSymbol(symtab, name, SYM_CONSTANT, AstInteger(defval), NULL);
+    }
+    return sym;
+}
+
+Symbol *
+GetCurArrayBase(void)
+{
+    return GetCurOptionSymbol(ARRAY_BASE_NAME, 0);
+}
+
+Symbol *
+GetCurImplicitTypes(void)
+{
+    return GetCurOptionSymbol(IMPLICIT_TYPE_NAME, 0);
+}
+
+static AST *
+HandleBASICOption(AST *optid, AST *exprlist)
+{
+    const char *name = GetIdentifierName(optid);
+    AST *expr;
+    Symbol *sym;
+    if (!name) {
+        SYNTAX_ERROR("Error in option list");
+        return NULL;
+    }
+    if (!strcasecmp(name, "base")) {
+        int arrayBase;
+        expr = NULL;
+        if (exprlist && exprlist->kind == AST_EXPRLIST) {
+            expr = exprlist->left;
+            exprlist = exprlist->right;
+            if (exprlist) expr = NULL;
+        }
+        if (!expr || !IsConstExpr(expr)) {
+            SYNTAX_ERROR("option base must be followed by an integer");
+            return NULL;
+        }
+        arrayBase = EvalConstExpr(expr);
+        sym = GetCurArrayBase();
+        sym->v.ptr = AstInteger(arrayBase);
+    } else if (!strcasecmp(name, "explicit")) {
+        sym = GetExplicitDeclares();
+        sym->v.ptr = AstInteger(255);
+    } else if (!strcasecmp(name, "implicit")) {
+        sym = GetExplicitDeclares();
+        sym->v.ptr = AstInteger(0);
+    } else {
+        SYNTAX_ERROR("Unknown option %s", name);
+    }
+    return NULL;
+}
+
+AST *
+DefineDefaultVarTypes(AST *deflist, AST *type)
+{
+    Symbol *sym = GetCurImplicitTypes();
+    AST *entry;
+    const char *first, *last;
+    uint32_t flags;
+    uint32_t low, high;
+    uint32_t mask;
+
+    flags = EvalConstExpr( (AST *)sym->v.ptr );
+    if (IsIntType(type)) {
+        mask = 0;
+    } else if (IsFloatType(type)) {
+        mask = 1;
+    } else {
+        SYNTAX_ERROR("defXXX is supported only for int and sng");
+        return NULL;
+    }
+    while (deflist) {
+        entry = deflist->left;
+        deflist = deflist->right;
+        if (entry->kind != AST_SEQUENCE) {
+            SYNTAX_ERROR("Internal error, expected AST_SEQUENCE");
+            return NULL;
+        }
+        if (!entry->left || !entry->right) {
+            SYNTAX_ERROR("Internal error in defvar parsing");
+            return NULL;
+        }
+        first = GetIdentifierName(entry->left);
+        last = GetIdentifierName(entry->right);
+        low = toupper(first[0]) - 'A';
+        high = toupper(last[0]) - 'A';
+        if (strlen(first) != 1 || strlen(last) != 1 || low > 25 || high > 25) {
+            SYNTAX_ERROR("defXXX requires single letters in patterns");
+            return NULL;
+        }
+        if (high < low) {
+            WARNING(NULL, "range `%c' - `%c' is empty", low, high);
+        }
+        while (low <= high) {
+            if (mask) {
+                flags |= (1U << low);
+            } else {
+                flags &= ~(1U << low);
+            }
+            low++;
+        }
+    }
+    sym->v.ptr = AstInteger(flags);
+    return NULL;
+}
+
+void
+DeclareBASICMemberVariables(AST *ast)
+{
+    AST *idlist, *typ;
+    AST *ident;
+    int is_private = 0;
+    BitFieldState bitfield = { 0 };
+    
+    if (!ast) return;
+    if (ast->kind == AST_SEQUENCE) {
+        ERROR(ast, "Internal error, unexpected sequence");
+        return;
+    }
+    if (ast->kind == AST_DECLARE_ALIAS) {
+        AST *newname = ast->left;
+        AST *oldname = ast->right;
+        Symbol *sym;
+        if (!newname || !oldname) {
+            ERROR(ast, "Internal error, bad alias structure");
+            return;
+        }
+        sym = DeclareAlias(&current->objsyms, newname, oldname);
+        (void)sym;
+        return;
+    }
+    if (ast->kind != AST_DECLARE_VAR) {
+        ERROR(ast, "Internal error, unexpected ast");
+        return;
+    }
+    idlist = ast->right;
+    typ = ast->left;
+    if (idlist->kind == AST_LISTHOLDER) {
+        while (idlist) {
+            AST *bittyp = typ;
+            ident = idlist->left;
+            if (ident && ident->kind == AST_BITFIELD) {
+                bittyp = NewAST(AST_BITFIELD, typ, ident->right);
+                ident = ident->left;
+            }
+            MaybeDeclareMemberVar(current, ident, bittyp, is_private, NORMAL_VAR, &bitfield);
+            idlist = idlist->right;
+        }
+    } else {
+        MaybeDeclareMemberVar(current, idlist, typ, is_private, NORMAL_VAR, &bitfield);
+    }
+    return;
+}
+
+void
+DeclareBASICSharedVariables(AST *ast)
+{
+    // declare globals in DAT section
+    DeclareTypedGlobalVariables(ast, 1);
+}
+
+void
+DeclareBASICRegisterVariables(AST *ast)
+{
+    // declare globals in DAT section
+    DeclareTypedRegisterVariables(ast);
+}
+
+AST *BASICArrayRef(AST *id, AST *expr)
+{
+    AST *ast;
+    ast = NewAST(AST_ARRAYREF, id, expr);
+    return ast;
+}
+
+AST *AstCharItem(int c)
+{
+    AST *expr = NewAST(AST_CHAR, AstInteger(c), NULL);
+    return NewAST(AST_EXPRLIST, expr, NULL);
+}
+
+AST *AddTemplateTypes(AST *list)
+{
+  AST *orig = list;
+  AST *ident;
+  while (list) {
+    ident = list->left;
+    list = list->right;
+    AddSymbol(currentTypes, ident->d.string, SYM_TYPEDEF, (void *)ident, NULL);
+  }
+  return orig;
+}
+
+#define MAX_LOOP_NEST 256
+static int loop_stack[MAX_LOOP_NEST];
+static int loop_sp;
+
+static void
+PushLoop(int token)
+{
+    if (loop_sp >= MAX_LOOP_NEST) {
+        SYNTAX_ERROR("loops nested too deeply");
+    } else {
+        loop_stack[loop_sp++] = token;
+    }
+}
+
+static void
+PopLoop(void)
+{
+    if (loop_sp > 0) {
+        --loop_sp;
+    }
+}
+
+static int
+GetCurrentLoop(int token)
+{
+    if (loop_sp == 0 || (token && loop_stack[loop_sp-1] != token)) {
+        return 0;
+    }
+    return 1;
+}
+
+static AST *
+BuildOnGotoCases(AST *exprlist)
+{
+    ListBuilder list = { NULL, NULL };
+    AST *target;
+    AST *item;
+    int index = 1;
+    AST *gostmt;
+    while (exprlist) {
+        target = exprlist->left;
+        exprlist = exprlist->right;
+        if (IsIdentifier(target)) {
+            gostmt = NewAST(AST_GOTO, target, NULL);
+        } else if (target->kind == AST_INTEGER) {
+            gostmt = NewAST(AST_GOTO, IntegerLabel(target), NULL);
+        } else {
+            SYNTAX_ERROR("ON GOTO accepts labels or integers only");
+            return NULL;
+        }
+        gostmt = NewAST(AST_STMTLIST, gostmt, NULL);
+        item = NewAST(AST_EXPRLIST, AstInteger(index), NULL);
+        item = NewAST(AST_CASEITEM, item, gostmt);
+        item = NewAST(AST_STMTLIST, item, NULL);
+        list = ListBuilderAdd(list, item);
+        index++;
+    }
+    return list.head;
+}
+
+static AST *
+AdjustParamType(AST *param)
+{
+    AST *typ = param->left;
+    if (typ && !IsIdentifier(typ) && (IsClassType(typ) || IsArrayType(typ))) {
+        param->left = NewAST(AST_REFTYPE, typ, NULL);
+    }
+    return param;        
+}
+
+static AST *
+AdjustParamForByRef(AST *param)
+{
+    AST *typ = param->left;
+    param->left = NewAST(AST_REFTYPE, typ, NULL);
+    return param;
+}
+
+static AST *
+AdjustParamForByVal(AST *param)
+{
+    AST *typ = param->left;
+    if (typ && !IsIdentifier(typ) && (IsClassType(typ) || IsArrayType(typ))) {
+        param->left = NewAST(AST_COPYREFTYPE, typ, NULL);
+    }
+    return param;
+}
+
+
+#line 461 "build/basic.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "basic.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_BAS_EMPTY = 3,                  /* "_"  */
+  YYSYMBOL_BAS_IDENTIFIER = 4,             /* "identifier"  */
+  YYSYMBOL_BAS_LABEL_INFERRED = 5,         /* "label"  */
+  YYSYMBOL_BAS_LABEL_EXPLICIT = 6,         /* "label:"  */
+  YYSYMBOL_BAS_INTEGER = 7,                /* "integer number"  */
+  YYSYMBOL_BAS_FLOAT = 8,                  /* "number"  */
+  YYSYMBOL_BAS_STRING = 9,                 /* "literal string"  */
+  YYSYMBOL_BAS_EOLN = 10,                  /* "end of line"  */
+  YYSYMBOL_BAS_EOF = 11,                   /* "end of file"  */
+  YYSYMBOL_BAS_TYPENAME = 12,              /* "type name"  */
+  YYSYMBOL_BAS_INSTR = 13,                 /* "asm instruction"  */
+  YYSYMBOL_BAS_INSTRMODIFIER = 14,         /* "asm instruction modifier"  */
+  YYSYMBOL_BAS_HWREG = 15,                 /* "hardware register"  */
+  YYSYMBOL_BAS_ALIGNL = 16,                /* "alignl"  */
+  YYSYMBOL_BAS_ALIGNW = 17,                /* "alignw"  */
+  YYSYMBOL_BAS_FILE = 18,                  /* "file"  */
+  YYSYMBOL_BAS_FIT = 19,                   /* "fit"  */
+  YYSYMBOL_BAS_ORG = 20,                   /* "org"  */
+  YYSYMBOL_BAS_ORGF = 21,                  /* "orgf"  */
+  YYSYMBOL_BAS_ORGH = 22,                  /* "orgh"  */
+  YYSYMBOL_BAS_RES = 23,                   /* "res"  */
+  YYSYMBOL_BAS_ABS = 24,                   /* "abs"  */
+  YYSYMBOL_BAS_ALIAS = 25,                 /* "alias"  */
+  YYSYMBOL_BAS_AND = 26,                   /* "and"  */
+  YYSYMBOL_BAS_ANDALSO = 27,               /* "andalso"  */
+  YYSYMBOL_BAS_ANY = 28,                   /* "any"  */
+  YYSYMBOL_BAS_APPEND = 29,                /* "append"  */
+  YYSYMBOL_BAS_AS = 30,                    /* "as"  */
+  YYSYMBOL_BAS_ASC = 31,                   /* "asc"  */
+  YYSYMBOL_BAS_ASM = 32,                   /* "asm"  */
+  YYSYMBOL_BAS_ALLOCA = 33,                /* "__builtin_alloca"  */
+  YYSYMBOL_BAS_BOOLEAN = 34,               /* "boolean"  */
+  YYSYMBOL_BAS_BYREF = 35,                 /* "byref"  */
+  YYSYMBOL_BAS_BYTE = 36,                  /* "byte"  */
+  YYSYMBOL_BAS_BYVAL = 37,                 /* "byval"  */
+  YYSYMBOL_BAS_CALL = 38,                  /* "call"  */
+  YYSYMBOL_BAS_CASE = 39,                  /* "case"  */
+  YYSYMBOL_BAS_CAST = 40,                  /* "cast"  */
+  YYSYMBOL_BAS_CATCH = 41,                 /* "catch"  */
+  YYSYMBOL_BAS_CHAIN = 42,                 /* "chain"  */
+  YYSYMBOL_BAS_CLASS = 43,                 /* "class"  */
+  YYSYMBOL_BAS_CLOSE = 44,                 /* "close"  */
+  YYSYMBOL_BAS_CONST = 45,                 /* "const"  */
+  YYSYMBOL_BAS_CONTINUE = 46,              /* "continue"  */
+  YYSYMBOL_BAS_CPU = 47,                   /* "cpu"  */
+  YYSYMBOL_BAS_DATA = 48,                  /* "data"  */
+  YYSYMBOL_BAS_DECLARE = 49,               /* "declare"  */
+  YYSYMBOL_BAS_DEF = 50,                   /* "def"  */
+  YYSYMBOL_BAS_DEFINT = 51,                /* "defint"  */
+  YYSYMBOL_BAS_DEFSNG = 52,                /* "defsng"  */
+  YYSYMBOL_BAS_DELETE = 53,                /* "delete"  */
+  YYSYMBOL_BAS_DIM = 54,                   /* "dim"  */
+  YYSYMBOL_BAS_DIRECTION = 55,             /* "direction"  */
+  YYSYMBOL_BAS_DO = 56,                    /* "do"  */
+  YYSYMBOL_BAS_DOUBLE = 57,                /* "double"  */
+  YYSYMBOL_BAS_ELSE = 58,                  /* "else"  */
+  YYSYMBOL_BAS_END = 59,                   /* "end"  */
+  YYSYMBOL_BAS_ENDIF = 60,                 /* "endif"  */
+  YYSYMBOL_BAS_ENUM = 61,                  /* "enum"  */
+  YYSYMBOL_BAS_EXIT = 62,                  /* "exit"  */
+  YYSYMBOL_BAS_EXTERN = 63,                /* "extern"  */
+  YYSYMBOL_BAS_FIXED = 64,                 /* "fixed"  */
+  YYSYMBOL_BAS_FOR = 65,                   /* "for"  */
+  YYSYMBOL_BAS_FUNCTION = 66,              /* "function"  */
+  YYSYMBOL_BAS_FUNC_NAME = 67,             /* "__FUNCTION__"  */
+  YYSYMBOL_BAS_GET = 68,                   /* "get"  */
+  YYSYMBOL_BAS_GOTO = 69,                  /* "goto"  */
+  YYSYMBOL_BAS_GOSUB = 70,                 /* "gosub"  */
+  YYSYMBOL_BAS_HASMETHOD = 71,             /* "_hasmethod"  */
+  YYSYMBOL_BAS_IF = 72,                    /* "if"  */
+  YYSYMBOL_BAS_IMPLEMENTS = 73,            /* "implements"  */
+  YYSYMBOL_BAS_IMPORT = 74,                /* "import"  */
+  YYSYMBOL_BAS_INPUT = 75,                 /* "input"  */
+  YYSYMBOL_BAS_CAST_INT = 76,              /* "int"  */
+  YYSYMBOL_BAS_INTEGER_KW = 77,            /* "integer"  */
+  YYSYMBOL_BAS_INTERFACE = 78,             /* "interface"  */
+  YYSYMBOL_BAS_LEN = 79,                   /* "len"  */
+  YYSYMBOL_BAS_LET = 80,                   /* "let"  */
+  YYSYMBOL_BAS_LIB = 81,                   /* "lib"  */
+  YYSYMBOL_BAS_LINE = 82,                  /* "line"  */
+  YYSYMBOL_BAS_LONG = 83,                  /* "long"  */
+  YYSYMBOL_BAS_LONGINT = 84,               /* "longint"  */
+  YYSYMBOL_BAS_LOOP = 85,                  /* "loop"  */
+  YYSYMBOL_BAS_MOD = 86,                   /* "mod"  */
+  YYSYMBOL_BAS_NEW = 87,                   /* "new"  */
+  YYSYMBOL_BAS_NEXT = 88,                  /* "next"  */
+  YYSYMBOL_BAS_NIL = 89,                   /* "nil"  */
+  YYSYMBOL_BAS_NOT = 90,                   /* "not"  */
+  YYSYMBOL_BAS_OFFSETOF = 91,              /* "offsetof"  */
+  YYSYMBOL_BAS_ON = 92,                    /* "on"  */
+  YYSYMBOL_BAS_OPEN = 93,                  /* "open"  */
+  YYSYMBOL_BAS_OPTION = 94,                /* "option"  */
+  YYSYMBOL_BAS_OR = 95,                    /* "or"  */
+  YYSYMBOL_BAS_ORELSE = 96,                /* "orelse"  */
+  YYSYMBOL_BAS_OUTPUT = 97,                /* "output"  */
+  YYSYMBOL_BAS_POINTER = 98,               /* "pointer"  */
+  YYSYMBOL_BAS_PRESERVE = 99,              /* "preserve"  */
+  YYSYMBOL_BAS_PRINT = 100,                /* "print"  */
+  YYSYMBOL_BAS_PRIVATE = 101,              /* "private"  */
+  YYSYMBOL_BAS_PROGRAM = 102,              /* "program"  */
+  YYSYMBOL_BAS_PTR = 103,                  /* "ptr"  */
+  YYSYMBOL_BAS_PUT = 104,                  /* "put"  */
+  YYSYMBOL_BAS_READ = 105,                 /* "read"  */
+  YYSYMBOL_BAS_REDIM = 106,                /* "redim"  */
+  YYSYMBOL_BAS_REGISTER = 107,             /* "register"  */
+  YYSYMBOL_BAS_RESTORE = 108,              /* "restore"  */
+  YYSYMBOL_BAS_RETURN = 109,               /* "return"  */
+  YYSYMBOL_BAS_SAMETYPES = 110,            /* "_sametypes"  */
+  YYSYMBOL_BAS_SELECT = 111,               /* "select"  */
+  YYSYMBOL_BAS_SELF = 112,                 /* "self"  */
+  YYSYMBOL_BAS_SHARED = 113,               /* "shared"  */
+  YYSYMBOL_BAS_SHORT = 114,                /* "short"  */
+  YYSYMBOL_BAS_SINGLE = 115,               /* "single"  */
+  YYSYMBOL_BAS_SIZEOF = 116,               /* "sizeof"  */
+  YYSYMBOL_BAS_SQRT = 117,                 /* "sqrt"  */
+  YYSYMBOL_BAS_STEP = 118,                 /* "step"  */
+  YYSYMBOL_BAS_STRING_KW = 119,            /* "string"  */
+  YYSYMBOL_BAS_STRUCT = 120,               /* "struct"  */
+  YYSYMBOL_BAS_SUB = 121,                  /* "sub"  */
+  YYSYMBOL_BAS_THEN = 122,                 /* "then"  */
+  YYSYMBOL_BAS_THROW = 123,                /* "throw"  */
+  YYSYMBOL_BAS_THROWIFCAUGHT = 124,        /* "throwifcaught"  */
+  YYSYMBOL_BAS_TO = 125,                   /* "to"  */
+  YYSYMBOL_BAS_TRY = 126,                  /* "try"  */
+  YYSYMBOL_BAS_TYPE = 127,                 /* "type"  */
+  YYSYMBOL_BAS_UBYTE = 128,                /* "ubyte"  */
+  YYSYMBOL_BAS_UINTEGER = 129,             /* "uinteger"  */
+  YYSYMBOL_BAS_ULONG = 130,                /* "ulong"  */
+  YYSYMBOL_BAS_ULONGINT = 131,             /* "ulongint"  */
+  YYSYMBOL_BAS_UNION = 132,                /* "union"  */
+  YYSYMBOL_BAS_UNTIL = 133,                /* "until"  */
+  YYSYMBOL_BAS_USHORT = 134,               /* "ushort"  */
+  YYSYMBOL_BAS_USING = 135,                /* "using"  */
+  YYSYMBOL_BAS_VAR = 136,                  /* "var"  */
+  YYSYMBOL_BAS_WEND = 137,                 /* "wend"  */
+  YYSYMBOL_BAS_WITH = 138,                 /* "with"  */
+  YYSYMBOL_BAS_WHILE = 139,                /* "while"  */
+  YYSYMBOL_BAS_WORD = 140,                 /* "word"  */
+  YYSYMBOL_BAS_XOR = 141,                  /* "xor"  */
+  YYSYMBOL_BAS_LE = 142,                   /* "<="  */
+  YYSYMBOL_BAS_GE = 143,                   /* ">="  */
+  YYSYMBOL_BAS_NE = 144,                   /* "<>"  */
+  YYSYMBOL_BAS_SHL = 145,                  /* "shl"  */
+  YYSYMBOL_BAS_SHR = 146,                  /* "shr"  */
+  YYSYMBOL_BAS_ABSADDR = 147,              /* "@@@"  */
+  YYSYMBOL_BAS_ADD_ASSIGN = 148,           /* "+="  */
+  YYSYMBOL_BAS_SUB_ASSIGN = 149,           /* "-="  */
+  YYSYMBOL_BAS_MUL_ASSIGN = 150,           /* "*="  */
+  YYSYMBOL_BAS_DIV_ASSIGN = 151,           /* "/="  */
+  YYSYMBOL_BAS_MOD_ASSIGN = 152,           /* "MOD="  */
+  YYSYMBOL_BAS_AND_ASSIGN = 153,           /* "AND="  */
+  YYSYMBOL_BAS_OR_ASSIGN = 154,            /* "OR="  */
+  YYSYMBOL_BAS_XOR_ASSIGN = 155,           /* "XOR="  */
+  YYSYMBOL_156_ = 156,                     /* '&'  */
+  YYSYMBOL_157_ = 157,                     /* '<'  */
+  YYSYMBOL_158_ = 158,                     /* '>'  */
+  YYSYMBOL_159_ = 159,                     /* '='  */
+  YYSYMBOL_160_ = 160,                     /* '-'  */
+  YYSYMBOL_161_ = 161,                     /* '+'  */
+  YYSYMBOL_162_ = 162,                     /* '*'  */
+  YYSYMBOL_163_ = 163,                     /* '/'  */
+  YYSYMBOL_164_ = 164,                     /* '@'  */
+  YYSYMBOL_165_ = 165,                     /* '.'  */
+  YYSYMBOL_166_ = 166,                     /* '('  */
+  YYSYMBOL_167_ = 167,                     /* ':'  */
+  YYSYMBOL_168_ = 168,                     /* ')'  */
+  YYSYMBOL_169_ = 169,                     /* ','  */
+  YYSYMBOL_170_ = 170,                     /* '#'  */
+  YYSYMBOL_171_ = 171,                     /* ';'  */
+  YYSYMBOL_172_ = 172,                     /* '\\'  */
+  YYSYMBOL_173_ = 173,                     /* '['  */
+  YYSYMBOL_174_ = 174,                     /* ']'  */
+  YYSYMBOL_175_ = 175,                     /* '^'  */
+  YYSYMBOL_176_ = 176,                     /* '{'  */
+  YYSYMBOL_177_ = 177,                     /* '}'  */
+  YYSYMBOL_YYACCEPT = 178,                 /* $accept  */
+  YYSYMBOL_toplist = 179,                  /* toplist  */
+  YYSYMBOL_eoln = 180,                     /* eoln  */
+  YYSYMBOL_eolnseq = 181,                  /* eolnseq  */
+  YYSYMBOL_toplabel = 182,                 /* toplabel  */
+  YYSYMBOL_topitem = 183,                  /* topitem  */
+  YYSYMBOL_wrapped_stmt = 184,             /* wrapped_stmt  */
+  YYSYMBOL_optstatementlist = 185,         /* optstatementlist  */
+  YYSYMBOL_stmtlistitem = 186,             /* stmtlistitem  */
+  YYSYMBOL_statementlist = 187,            /* statementlist  */
+  YYSYMBOL_realstatementlist = 188,        /* realstatementlist  */
+  YYSYMBOL_iflist = 189,                   /* iflist  */
+  YYSYMBOL_optelselist = 190,              /* optelselist  */
+  YYSYMBOL_ifline = 191,                   /* ifline  */
+  YYSYMBOL_statement = 192,                /* statement  */
+  YYSYMBOL_assignment_operator = 193,      /* assignment_operator  */
+  YYSYMBOL_varassignlist = 194,            /* varassignlist  */
+  YYSYMBOL_multivars = 195,                /* multivars  */
+  YYSYMBOL_simple_assign_statement = 196,  /* simple_assign_statement  */
+  YYSYMBOL_assign_statement = 197,         /* assign_statement  */
+  YYSYMBOL_branchstmt = 198,               /* branchstmt  */
+  YYSYMBOL_optcomma = 199,                 /* optcomma  */
+  YYSYMBOL_file_handle = 200,              /* file_handle  */
+  YYSYMBOL_iostmt = 201,                   /* iostmt  */
+  YYSYMBOL_chain_args = 202,               /* chain_args  */
+  YYSYMBOL_inputitem = 203,                /* inputitem  */
+  YYSYMBOL_inputlist = 204,                /* inputlist  */
+  YYSYMBOL_printitem = 205,                /* printitem  */
+  YYSYMBOL_rawprintlist = 206,             /* rawprintlist  */
+  YYSYMBOL_usingprintlist = 207,           /* usingprintlist  */
+  YYSYMBOL_printlist = 208,                /* printlist  */
+  YYSYMBOL_putgetargs = 209,               /* putgetargs  */
+  YYSYMBOL_optzeroexpritem = 210,          /* optzeroexpritem  */
+  YYSYMBOL_optvar = 211,                   /* optvar  */
+  YYSYMBOL_ifstmt = 212,                   /* ifstmt  */
+  YYSYMBOL_thenelseblock = 213,            /* thenelseblock  */
+  YYSYMBOL_endif = 214,                    /* endif  */
+  YYSYMBOL_whilestmt = 215,                /* whilestmt  */
+  YYSYMBOL_216_1 = 216,                    /* $@1  */
+  YYSYMBOL_endwhile = 217,                 /* endwhile  */
+  YYSYMBOL_doloopstmt = 218,               /* doloopstmt  */
+  YYSYMBOL_219_2 = 219,                    /* $@2  */
+  YYSYMBOL_220_3 = 220,                    /* $@3  */
+  YYSYMBOL_221_4 = 221,                    /* $@4  */
+  YYSYMBOL_doloopend = 222,                /* doloopend  */
+  YYSYMBOL_selectstmt = 223,               /* selectstmt  */
+  YYSYMBOL_casematchlist = 224,            /* casematchlist  */
+  YYSYMBOL_casematchitem = 225,            /* casematchitem  */
+  YYSYMBOL_casematch = 226,                /* casematch  */
+  YYSYMBOL_caseitem = 227,                 /* caseitem  */
+  YYSYMBOL_caselist = 228,                 /* caselist  */
+  YYSYMBOL_forstmt = 229,                  /* forstmt  */
+  YYSYMBOL_230_5 = 230,                    /* $@5  */
+  YYSYMBOL_endfor = 231,                   /* endfor  */
+  YYSYMBOL_optstep = 232,                  /* optstep  */
+  YYSYMBOL_trycatchstmt = 233,             /* trycatchstmt  */
+  YYSYMBOL_endtry = 234,                   /* endtry  */
+  YYSYMBOL_exitstmt = 235,                 /* exitstmt  */
+  YYSYMBOL_topdecl = 236,                  /* topdecl  */
+  YYSYMBOL_defitem = 237,                  /* defitem  */
+  YYSYMBOL_deflist = 238,                  /* deflist  */
+  YYSYMBOL_varexpr = 239,                  /* varexpr  */
+  YYSYMBOL_varassigntarget = 240,          /* varassigntarget  */
+  YYSYMBOL_pinrange = 241,                 /* pinrange  */
+  YYSYMBOL_register_expr = 242,            /* register_expr  */
+  YYSYMBOL_np_primary_expr = 243,          /* np_primary_expr  */
+  YYSYMBOL_primary_expr = 244,             /* primary_expr  */
+  YYSYMBOL_unary_op = 245,                 /* unary_op  */
+  YYSYMBOL_pseudofunc_expr = 246,          /* pseudofunc_expr  */
+  YYSYMBOL_unary_expr = 247,               /* unary_expr  */
+  YYSYMBOL_np_unary_expr = 248,            /* np_unary_expr  */
+  YYSYMBOL_lambdaexpr = 249,               /* lambdaexpr  */
+  YYSYMBOL_opttype = 250,                  /* opttype  */
+  YYSYMBOL_mult_op = 251,                  /* mult_op  */
+  YYSYMBOL_power_expr = 252,               /* power_expr  */
+  YYSYMBOL_np_power_expr = 253,            /* np_power_expr  */
+  YYSYMBOL_mult_expr = 254,                /* mult_expr  */
+  YYSYMBOL_np_mult_expr = 255,             /* np_mult_expr  */
+  YYSYMBOL_add_expr = 256,                 /* add_expr  */
+  YYSYMBOL_np_add_expr = 257,              /* np_add_expr  */
+  YYSYMBOL_compare_expr = 258,             /* compare_expr  */
+  YYSYMBOL_bit_expr = 259,                 /* bit_expr  */
+  YYSYMBOL_bool_expr = 260,                /* bool_expr  */
+  YYSYMBOL_expr = 261,                     /* expr  */
+  YYSYMBOL_np_expr = 262,                  /* np_expr  */
+  YYSYMBOL_optexprlist = 263,              /* optexprlist  */
+  YYSYMBOL_initexprlist = 264,             /* initexprlist  */
+  YYSYMBOL_initexpritem = 265,             /* initexpritem  */
+  YYSYMBOL_exprlist = 266,                 /* exprlist  */
+  YYSYMBOL_expritem = 267,                 /* expritem  */
+  YYSYMBOL_np_expritem = 268,              /* np_expritem  */
+  YYSYMBOL_np_exprlist = 269,              /* np_exprlist  */
+  YYSYMBOL_subbody = 270,                  /* subbody  */
+  YYSYMBOL_endsub = 271,                   /* endsub  */
+  YYSYMBOL_funcbody = 272,                 /* funcbody  */
+  YYSYMBOL_endfunc = 273,                  /* endfunc  */
+  YYSYMBOL_attributes = 274,               /* attributes  */
+  YYSYMBOL_subdecl = 275,                  /* subdecl  */
+  YYSYMBOL_funcdecl = 276,                 /* funcdecl  */
+  YYSYMBOL_functemplate = 277,             /* functemplate  */
+  YYSYMBOL_templateheader = 278,           /* templateheader  */
+  YYSYMBOL_identlist = 279,                /* identlist  */
+  YYSYMBOL_assignitem = 280,               /* assignitem  */
+  YYSYMBOL_assignlist = 281,               /* assignlist  */
+  YYSYMBOL_optobjparams = 282,             /* optobjparams  */
+  YYSYMBOL_classdecl = 283,                /* classdecl  */
+  YYSYMBOL_classheader = 284,              /* classheader  */
+  YYSYMBOL_classdecllist = 285,            /* classdecllist  */
+  YYSYMBOL_classend = 286,                 /* classend  */
+  YYSYMBOL_classdeclitem = 287,            /* classdeclitem  */
+  YYSYMBOL_constdecl = 288,                /* constdecl  */
+  YYSYMBOL_constitem = 289,                /* constitem  */
+  YYSYMBOL_constlist = 290,                /* constlist  */
+  YYSYMBOL_typedecl = 291,                 /* typedecl  */
+  YYSYMBOL_optarraylimit = 292,            /* optarraylimit  */
+  YYSYMBOL_arraysizeitem = 293,            /* arraysizeitem  */
+  YYSYMBOL_arraysizelist = 294,            /* arraysizelist  */
+  YYSYMBOL_typename = 295,                 /* typename  */
+  YYSYMBOL_typelist = 296,                 /* typelist  */
+  YYSYMBOL_ptrdef = 297,                   /* ptrdef  */
+  YYSYMBOL_basetypename = 298,             /* basetypename  */
+  YYSYMBOL_paramdecl = 299,                /* paramdecl  */
+  YYSYMBOL_paramdecl1 = 300,               /* paramdecl1  */
+  YYSYMBOL_paramitem = 301,                /* paramitem  */
+  YYSYMBOL_paramvar = 302,                 /* paramvar  */
+  YYSYMBOL_dimension = 303,                /* dimension  */
+  YYSYMBOL_opt_type_as = 304,              /* opt_type_as  */
+  YYSYMBOL_dimlist = 305,                  /* dimlist  */
+  YYSYMBOL_dimitem = 306,                  /* dimitem  */
+  YYSYMBOL_identdecl = 307,                /* identdecl  */
+  YYSYMBOL_asmstmt = 308,                  /* asmstmt  */
+  YYSYMBOL_asmlist = 309,                  /* asmlist  */
+  YYSYMBOL_asmline = 310,                  /* asmline  */
+  YYSYMBOL_basedatline = 311,              /* basedatline  */
+  YYSYMBOL_operand = 312,                  /* operand  */
+  YYSYMBOL_pasmexpr = 313,                 /* pasmexpr  */
+  YYSYMBOL_operandlist = 314,              /* operandlist  */
+  YYSYMBOL_instruction = 315,              /* instruction  */
+  YYSYMBOL_instrmodifier = 316,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 317              /* modifierlist  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined BASICYYSTYPE_IS_TRIVIAL && BASICYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  253
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   6988
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  178
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  140
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  477
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  967
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   410
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,   170,     2,     2,   156,     2,
+     166,   168,   162,   161,   169,   160,   165,   163,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   167,   171,
+     157,   159,   158,     2,   164,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   173,   172,   174,   175,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   176,     2,   177,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155
+};
+
+#if BASICYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   593,   593,   594,   595,   599,   600,   604,   605,   609,
+     620,   621,   627,   629,   634,   641,   645,   650,   659,   660,
+     665,   667,   669,   671,   680,   682,   687,   689,   694,   696,
+     701,   704,   708,   713,   717,   723,   729,   735,   741,   748,
+     761,   763,   765,   767,   769,   771,   773,   775,   777,   779,
+     784,   786,   788,   790,   792,   794,   796,   798,   804,   809,
+     811,   817,   824,   828,   835,   837,   841,   853,   868,   869,
+     871,   873,   875,   877,   879,   881,   883,   887,   901,   901,
+     904,   905,   910,   912,   914,   923,   925,   940,   958,   960,
+     968,   975,   984,   993,  1002,  1008,  1017,  1027,  1047,  1071,
+    1072,  1081,  1093,  1095,  1102,  1104,  1109,  1111,  1113,  1118,
+    1120,  1122,  1128,  1129,  1131,  1133,  1135,  1137,  1146,  1164,
+    1190,  1194,  1200,  1203,  1209,  1213,  1220,  1227,  1235,  1237,
+    1239,  1244,  1245,  1246,  1250,  1250,  1258,  1259,  1260,  1264,
+    1264,  1270,  1270,  1276,  1276,  1284,  1286,  1288,  1293,  1295,
+    1300,  1302,  1307,  1325,  1330,  1332,  1334,  1339,  1341,  1350,
+    1350,  1389,  1391,  1397,  1398,  1403,  1425,  1429,  1431,  1433,
+    1444,  1455,  1466,  1477,  1488,  1499,  1510,  1521,  1535,  1539,
+    1543,  1554,  1558,  1559,  1560,  1561,  1562,  1563,  1567,  1572,
+    1574,  1583,  1585,  1587,  1589,  1591,  1593,  1595,  1597,  1602,
+    1604,  1609,  1611,  1616,  1618,  1620,  1626,  1628,  1630,  1632,
+    1634,  1636,  1638,  1640,  1643,  1659,  1663,  1670,  1672,  1677,
+    1679,  1681,  1683,  1685,  1687,  1692,  1697,  1701,  1709,  1715,
+    1719,  1725,  1730,  1732,  1737,  1739,  1741,  1743,  1748,  1750,
+    1752,  1754,  1759,  1770,  1778,  1786,  1794,  1807,  1808,  1813,
+    1815,  1817,  1819,  1821,  1826,  1828,  1835,  1837,  1844,  1846,
+    1854,  1856,  1865,  1867,  1869,  1874,  1876,  1878,  1883,  1885,
+    1887,  1889,  1891,  1893,  1895,  1900,  1902,  1904,  1906,  1908,
+    1913,  1915,  1917,  1922,  1924,  1929,  1930,  1935,  1936,  1941,
+    1943,  1948,  1950,  1955,  1957,  1962,  1967,  1971,  1973,  1978,
+    1983,  1984,  1988,  1993,  1994,  1999,  2000,  2009,  2020,  2031,
+    2042,  2058,  2070,  2082,  2094,  2107,  2125,  2141,  2160,  2168,
+    2172,  2180,  2188,  2190,  2201,  2202,  2209,  2217,  2221,  2240,
+    2259,  2279,  2302,  2303,  2307,  2315,  2323,  2331,  2337,  2338,
+    2343,  2348,  2357,  2358,  2359,  2363,  2369,  2377,  2379,  2384,
+    2392,  2393,  2397,  2421,  2423,  2430,  2432,  2434,  2436,  2438,
+    2447,  2449,  2461,  2461,  2465,  2467,  2469,  2471,  2473,  2475,
+    2477,  2479,  2481,  2483,  2492,  2494,  2496,  2498,  2509,  2511,
+    2513,  2515,  2517,  2519,  2521,  2537,  2538,  2542,  2544,  2549,
+    2551,  2553,  2558,  2560,  2562,  2564,  2570,  2577,  2582,  2584,
+    2586,  2588,  2590,  2592,  2594,  2596,  2598,  2600,  2610,  2625,
+    2626,  2631,  2633,  2637,  2639,  2644,  2646,  2648,  2653,  2655,
+    2668,  2680,  2697,  2717,  2729,  2740,  2757,  2780,  2785,  2789,
+    2793,  2797,  2802,  2804,  2809,  2813,  2834,  2836,  2838,  2840,
+    2842,  2844,  2846,  2848,  2850,  2852,  2854,  2856,  2858,  2860,
+    2862,  2864,  2866,  2868,  2870,  2872,  2874,  2876,  2878,  2880,
+    2882,  2884,  2889,  2891,  2893,  2895,  2897,  2902,  2904,  2906,
+    2911,  2913,  2918,  2920,  2925,  2930,  2932,  2934
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"_\"",
+  "\"identifier\"", "\"label\"", "\"label:\"", "\"integer number\"",
+  "\"number\"", "\"literal string\"", "\"end of line\"", "\"end of file\"",
+  "\"type name\"", "\"asm instruction\"", "\"asm instruction modifier\"",
+  "\"hardware register\"", "\"alignl\"", "\"alignw\"", "\"file\"",
+  "\"fit\"", "\"org\"", "\"orgf\"", "\"orgh\"", "\"res\"", "\"abs\"",
+  "\"alias\"", "\"and\"", "\"andalso\"", "\"any\"", "\"append\"", "\"as\"",
+  "\"asc\"", "\"asm\"", "\"__builtin_alloca\"", "\"boolean\"", "\"byref\"",
+  "\"byte\"", "\"byval\"", "\"call\"", "\"case\"", "\"cast\"", "\"catch\"",
+  "\"chain\"", "\"class\"", "\"close\"", "\"const\"", "\"continue\"",
+  "\"cpu\"", "\"data\"", "\"declare\"", "\"def\"", "\"defint\"",
+  "\"defsng\"", "\"delete\"", "\"dim\"", "\"direction\"", "\"do\"",
+  "\"double\"", "\"else\"", "\"end\"", "\"endif\"", "\"enum\"", "\"exit\"",
+  "\"extern\"", "\"fixed\"", "\"for\"", "\"function\"", "\"__FUNCTION__\"",
+  "\"get\"", "\"goto\"", "\"gosub\"", "\"_hasmethod\"", "\"if\"",
+  "\"implements\"", "\"import\"", "\"input\"", "\"int\"", "\"integer\"",
+  "\"interface\"", "\"len\"", "\"let\"", "\"lib\"", "\"line\"", "\"long\"",
+  "\"longint\"", "\"loop\"", "\"mod\"", "\"new\"", "\"next\"", "\"nil\"",
+  "\"not\"", "\"offsetof\"", "\"on\"", "\"open\"", "\"option\"", "\"or\"",
+  "\"orelse\"", "\"output\"", "\"pointer\"", "\"preserve\"", "\"print\"",
+  "\"private\"", "\"program\"", "\"ptr\"", "\"put\"", "\"read\"",
+  "\"redim\"", "\"register\"", "\"restore\"", "\"return\"",
+  "\"_sametypes\"", "\"select\"", "\"self\"", "\"shared\"", "\"short\"",
+  "\"single\"", "\"sizeof\"", "\"sqrt\"", "\"step\"", "\"string\"",
+  "\"struct\"", "\"sub\"", "\"then\"", "\"throw\"", "\"throwifcaught\"",
+  "\"to\"", "\"try\"", "\"type\"", "\"ubyte\"", "\"uinteger\"",
+  "\"ulong\"", "\"ulongint\"", "\"union\"", "\"until\"", "\"ushort\"",
+  "\"using\"", "\"var\"", "\"wend\"", "\"with\"", "\"while\"", "\"word\"",
+  "\"xor\"", "\"<=\"", "\">=\"", "\"<>\"", "\"shl\"", "\"shr\"", "\"@@@\"",
+  "\"+=\"", "\"-=\"", "\"*=\"", "\"/=\"", "\"MOD=\"", "\"AND=\"",
+  "\"OR=\"", "\"XOR=\"", "'&'", "'<'", "'>'", "'='", "'-'", "'+'", "'*'",
+  "'/'", "'@'", "'.'", "'('", "':'", "')'", "','", "'#'", "';'", "'\\\\'",
+  "'['", "']'", "'^'", "'{'", "'}'", "$accept", "toplist", "eoln",
+  "eolnseq", "toplabel", "topitem", "wrapped_stmt", "optstatementlist",
+  "stmtlistitem", "statementlist", "realstatementlist", "iflist",
+  "optelselist", "ifline", "statement", "assignment_operator",
+  "varassignlist", "multivars", "simple_assign_statement",
+  "assign_statement", "branchstmt", "optcomma", "file_handle", "iostmt",
+  "chain_args", "inputitem", "inputlist", "printitem", "rawprintlist",
+  "usingprintlist", "printlist", "putgetargs", "optzeroexpritem", "optvar",
+  "ifstmt", "thenelseblock", "endif", "whilestmt", "$@1", "endwhile",
+  "doloopstmt", "$@2", "$@3", "$@4", "doloopend", "selectstmt",
+  "casematchlist", "casematchitem", "casematch", "caseitem", "caselist",
+  "forstmt", "$@5", "endfor", "optstep", "trycatchstmt", "endtry",
+  "exitstmt", "topdecl", "defitem", "deflist", "varexpr",
+  "varassigntarget", "pinrange", "register_expr", "np_primary_expr",
+  "primary_expr", "unary_op", "pseudofunc_expr", "unary_expr",
+  "np_unary_expr", "lambdaexpr", "opttype", "mult_op", "power_expr",
+  "np_power_expr", "mult_expr", "np_mult_expr", "add_expr", "np_add_expr",
+  "compare_expr", "bit_expr", "bool_expr", "expr", "np_expr",
+  "optexprlist", "initexprlist", "initexpritem", "exprlist", "expritem",
+  "np_expritem", "np_exprlist", "subbody", "endsub", "funcbody", "endfunc",
+  "attributes", "subdecl", "funcdecl", "functemplate", "templateheader",
+  "identlist", "assignitem", "assignlist", "optobjparams", "classdecl",
+  "classheader", "classdecllist", "classend", "classdeclitem", "constdecl",
+  "constitem", "constlist", "typedecl", "optarraylimit", "arraysizeitem",
+  "arraysizelist", "typename", "typelist", "ptrdef", "basetypename",
+  "paramdecl", "paramdecl1", "paramitem", "paramvar", "dimension",
+  "opt_type_as", "dimlist", "dimitem", "identdecl", "asmstmt", "asmlist",
+  "asmline", "basedatline", "operand", "pasmexpr", "operandlist",
+  "instruction", "instrmodifier", "modifierlist", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-810)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-393)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    5691,  -810,  4687,  -810,  -810,  -810,   -60,    48,  -810,  -810,
+     235,    34,    55,   107,  6593,    19,   277,  -810,   140,   317,
+     350,   350,  4285,   262,   161,    31,  -810,   250,   193,  -810,
+      -1,   196,   165,   178,  4285,    54,   173,  -810,   364,  6473,
+     295,  -810,  -810,  4285,  4285,   372,   222,   227,   234,  6734,
+    -810,  4285,   379,   383,  -810,  -810,  -810,     5,  4285,  4285,
+      90,   427,  -810,  -810,  -810,  -810,   434,  -810,   438,  4285,
+      46,  5691,  -810,  -810,   286,  -810,  -810,  -810,  -810,  -810,
+    -810,  -810,  -810,  -810,  -810,  -810,  -810,   376,   281,   296,
+    -810,  -810,  -810,    56,  -810,   402,  -810,  -810,   298,  -810,
+    -810,   288,  -810,  -810,  -810,  -810,  -810,  -810,   303,   304,
+     336,  6854,   306,   307,  -810,   308,   310,   311,  -810,  1232,
+    -810,  -810,   313,   319,  -810,  4285,  -810,   320,  5226,  -810,
+    5226,  5226,  2778,   172,  -810,  -810,  5226,  -810,  -810,  -810,
+     312,   -13,   201,  -810,   322,  -810,   484,  -810,    90,  -810,
+     651,   486,   331,   330,   493,    98,   492,  4285,   344,    90,
+     338,   340,  -810,   339,  -810,  -810,  -810,  -810,    90,   482,
+     505,   506,   345,   352,  -810,   347,   347,  5226,  4285,    99,
+    -810,  -810,  5226,  -810,  -810,  -810,   342,   -13,   323,  -810,
+     142,    64,  -810,   138,  1232,   112,   133,    22,  -810,   105,
+    4285,  4285,  4285,  -810,  -810,  -810,  -810,  -810,  -810,  -810,
+     507,   509,   510,    99,   516,  4285,  -810,  -810,  -810,  -810,
+    6094,   456,   456,  4285,  4285,  6675,    90,  -810,   527,   227,
+     453,    62,  4285,  4285,  1948,  4285,  -810,   359,   172,  -810,
+     363,  -810,  4285,    90,    99,   529,  -810,  -810,  4821,    85,
+      90,   375,    90,  -810,   530,  5691,  -810,  4285,  -810,  -810,
+    -810,  -810,  -810,  -810,  -810,  -810,    65,  3180,  4285,  6532,
+    4419,   532,   535,   -60,  1232,   456,   456,  -810,  -810,  -810,
+    -810,    80,  -810,    24,    72,  4285,  4285,  1232,  4285,    99,
+    1232,  4285,  1232,  -810,   233,  1232,  4553,  -810,    99,  -810,
+    -810,  -810,   101,   540,   540,   373,   385,   377,  -810,  -810,
+    -810,  5360,  -810,  -810,  -810,  -810,  -810,  5360,  5226,  5226,
+    4285,  -810,   232,   651,   543,  5610,  -810,  -810,  -810,   544,
+     545,   541,  2082,  2216,  2912,  2350,  2912,  1507,   546,   547,
+    4285,  1654,  1801,   979,  -810,  -810,  1360,   394,  -810,  3321,
+    4285,  -810,   330,   552,  -810,   424,  -810,  4285,   651,   559,
+     651,   349,   485,   487,    99,   561,   350,  -810,   399,    14,
+    -810,  5226,  5226,  5226,  5226,  5226,  5226,  5226,  5226,  5226,
+    5226,  5226,  5226,  5226,  5226,  5226,  5226,  4285,  4285,   567,
+    1232,    36,  1232,    77,  1232,   567,  1049,   565,   406,   409,
+      90,    90,  4821,   411,   421,  -810,   413,   416,  -810,   414,
+    6795,  4955,  -810,   582,   583,   420,   422,   122,   359,  -810,
+    6734,  4285,   419,   247,  -810,   363,   426,   581,  3046,  4285,
+    -810,   139,  -810,  -810,  -810,  6734,  4285,    90,   651,   428,
+      30,  5828,   593,  4821,  -810,    90,   557,  -810,  -810,  -810,
+    1232,  -810,  -810,  4285,  -810,  -810,  -810,   363,  -810,  -810,
+    -810,   244,  -810,   430,   172,  -810,   310,   222,  -810,   436,
+     437,   567,    20,   402,  -810,  1232,  -810,  -810,   432,   435,
+     248,   439,   441,   440,   443,    50,  -810,  -810,  4285,  -810,
+     444,  4553,   445,   448,   230,   451,  1232,  4285,  3462,  -810,
+    -810,  -810,  4821,    99,  -810,   312,   -13,   -13,   363,  -810,
+     601,  1012,  -810,  -810,  -810,  -810,   602,  -810,  -810,  4285,
+    -810,   611,  -810,   612,   613,  -810,   614,   615,  -810,  2484,
+    -810,   -49,    71,  -810,  -810,   616,  -810,    73,  -810,    75,
+      94,  -810,  -810,    26,  -810,    41,  -810,  -810,   253,   330,
+    -810,   424,   623,  -810,  -810,  5482,  -810,  5509,   598,   599,
+     621,   622,   464,  -810,  -810,  -810,  -810,   342,   249,   249,
+     249,   249,   249,   249,   -13,   -13,  -810,  -810,  -810,  -810,
+     142,   142,   113,   -39,   465,   567,  1232,   567,  1232,  -810,
+    -810,  3603,  -810,  -810,  -810,  4285,  -810,  -810,   548,  -810,
+    -810,  4285,   605,    99,  4285,  -810,  4821,    -8,  -810,  -810,
+     472,   476,  -810,  -810,  -810,  6734,  6734,   172,   363,  4285,
+     619,   620,   627,  -810,   475,  -810,  -810,  3737,  3737,  -810,
+    -810,   604,  5581,  -810,    99,    90,  5965,  6231,  -810,  -810,
+    -810,  4821,   649,  -810,  -810,  4821,  -810,  6532,    99,    99,
+     465,  -810,  -810,  -810,  -810,  -810,  -810,  -810,  4285,  -810,
+    3883,   655,  -810,  -810,  -810,   537,  -810,   255,   656,  1232,
+    1232,    90,  -810,   633,   636,   258,   542,   515,  -810,  -810,
+     108,  -810,  -810,  -810,  -810,  -810,  -810,  -810,  2912,  -810,
+     523,  2912,  -810,  2631,  -810,  -810,  -810,  -810,  -810,    47,
+    -810,   680,  -810,  -810,  -810,  -810,   536,   528,  -810,   111,
+     119,  1232,  -810,  1232,   533,   534,   539,  4285,  -810,  4285,
+    4285,  4285,  -810,   465,  -810,   465,  -810,  4017,  -810,    58,
+    -810,  -810,  4821,  4821,   179,  -810,   571,  6854,   538,   549,
+    -810,   314,  -810,  6360,  6360,  -810,    99,    99,   359,   359,
+    -810,   531,   550,   551,  3737,  -810,  -810,  4151,   241,  -810,
+      90,   263,   554,  4821,  -810,  -810,    90,    29,  -810,   562,
+     563,   572,  1232,  -810,   573,  4285,  -810,  -810,  4285,   574,
+     577,   580,  4821,  1232,  1232,   672,  4285,  -810,  -810,  -810,
+    -810,   555,  -810,  -810,  -810,  4285,   623,  -810,  -810,  -810,
+    -810,    99,    99,  4285,   260,   585,   151,   584,  -810,   578,
+    3603,  -810,   618,   626,  4285,  4285,  4285,  -810,    87,  4285,
+    5089,   640,  -810,  -810,   558,  -810,   586,   588,  4285,  4285,
+    4285,  -810,   148,  -810,  -810,   570,   589,   594,  -810,  4821,
+    -810,    90,   654,  -810,  4821,   569,  -810,  -810,   685,    90,
+    -810,    90,   147,  -810,  -810,  -810,  -810,  -810,  -810,  -810,
+    -810,  -810,  1232,   686,  -810,  -810,  -810,   596,   597,  -810,
+    -810,  4285,  -810,  4285,  -810,  -810,  -810,  -810,  -810,  -810,
+    -810,  -810,   639,  1232,  4821,   592,  4821,  -810,  -810,   687,
+    -810,  -810,  -810,  -810,  3737,  3737,  4151,  4285,  -810,  -810,
+    4821,   641,  -810,   660,  -810,  1232,  4821,  4821,  -810,  1232,
+     600,   737,  -810,   645,   646,  4285,    90,  -810,    67,   713,
+    -810,  4285,   374,  1232,  -810,  -810,  -810,  -810,  -810,  -810,
+     647,  -810,    67,  -810,  -810,  -810,  -810,  1232,  4285,  4285,
+    -810,  4821,  1232,  4821,   709,  -810,   607,  -810,   608,  -810,
+    4821,   608,   610,   606,   695,  -810,  -810,  -810,  4285,  -810,
+    -810,  -810,  -810,   780,  -810,  -810,  -810
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+      10,   200,   191,     9,    71,   380,   379,     0,   373,   368,
+       0,     0,     0,     0,     0,   177,     0,    13,     0,     0,
+       0,     0,     0,     0,     0,     0,   376,   173,     0,   159,
+     305,     0,     0,     0,     0,     0,    80,   372,     0,     0,
+       0,   366,   367,     0,     0,     0,     0,    80,     0,     0,
+      89,    69,     0,     0,   369,   375,   378,   305,     0,     0,
+       0,     0,   364,   374,   370,   371,     0,   365,     0,     0,
+       0,    10,     2,    11,     0,    66,    33,    42,    41,    43,
+      44,    45,    48,    46,    47,    68,    12,    39,     0,     0,
+     185,   184,   187,     0,   182,   338,   186,   183,     0,   180,
+      49,   191,   208,   209,   213,   221,   379,   222,     0,     0,
+       0,     0,     0,     0,   212,     0,     0,     0,   223,     0,
+     210,   220,     0,     0,   211,     0,   224,     0,     0,   219,
+       0,     0,   385,   206,   207,   238,     0,   239,   256,   286,
+     260,   265,   285,   296,   297,    34,     0,     7,     0,     5,
+       0,     6,    35,    99,     0,     0,     0,     0,     0,     0,
+       0,     0,   348,   345,   381,   176,   174,   175,     0,     0,
+       0,     0,     0,     0,   189,   179,   178,     0,     0,   385,
+     217,   234,     0,   235,   254,   284,   258,   262,   268,   275,
+     280,   283,    40,   418,     0,     0,     0,   398,   411,   413,
+       0,     0,     0,   143,   171,   169,   167,   172,   168,   170,
+       0,     0,     0,   385,     0,     0,    72,    73,    74,    75,
+       0,   305,   305,     0,     0,     0,     0,    67,   199,    80,
+       0,     0,   287,     0,   112,     0,   102,    88,   101,   295,
+      70,   293,     0,     0,   385,     0,    76,    77,     0,     0,
+       0,     0,     0,     1,     0,    10,    14,     0,    53,    54,
+      51,    52,    55,    57,    56,    50,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   305,   305,   343,   342,   344,
+     327,     0,   341,     0,     0,     0,     0,     0,     0,   385,
+       0,     0,     0,   214,   355,     0,     0,   216,   385,   233,
+     240,   232,   191,     0,     0,     0,     0,   386,   387,   389,
+     241,     0,   251,   252,   253,   249,   250,     0,     0,     0,
+       0,   319,     0,     0,     0,     0,   436,   472,   474,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   432,   434,     0,     0,     8,     0,
+       0,    96,    99,     0,   328,   324,    94,     0,     0,     0,
+       0,     0,     0,     0,   385,     0,     0,   236,     0,   392,
+     237,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   404,     0,   401,     0,     0,     0,     0,     0,   201,
+       0,     0,    18,     0,     0,   306,     0,     0,    97,     0,
+       0,     0,   126,     0,     0,     0,    78,     0,    85,   331,
+       0,     0,     0,     0,   181,   288,     0,     0,   112,     0,
+     106,   113,    82,   104,    98,     0,     0,     0,     0,     0,
+     385,    22,     0,     0,    20,    26,     0,    24,    15,    21,
+       0,   329,   330,     0,   134,     4,     3,    62,   195,   196,
+     193,     0,    61,    58,   199,    59,    64,    65,    63,     0,
+       0,     0,     0,   338,   332,     0,   197,   198,     0,     0,
+       0,     0,     0,     0,     0,     0,   362,   363,     0,   356,
+       0,     0,     0,     0,   355,     0,     0,     0,     0,   390,
+     391,   192,    18,     0,   257,   261,   267,   266,   298,   318,
+       0,     0,   437,   435,   448,   449,     0,   457,   469,     0,
+     467,     0,   450,     0,     0,   452,     0,     0,   438,     0,
+     470,   462,     0,   459,   460,     0,   442,     0,   440,     0,
+       0,   433,   444,     0,   475,     0,   473,    36,     0,    99,
+      95,   324,     0,   384,   346,     0,   347,     0,   409,     0,
+       0,     0,     0,   188,   190,   218,   255,   259,   273,   274,
+     272,   270,   271,   269,   264,   263,   276,   278,   279,   277,
+     281,   282,     0,     0,   400,     0,     0,     0,     0,   399,
+     412,     0,   415,   414,   205,     0,   141,   139,     0,    19,
+     377,     0,     0,   385,   120,   125,    18,    31,   127,    28,
+       0,     0,   203,    79,    81,     0,     0,    84,   149,     0,
+       0,     0,     0,   204,     0,    83,   105,   114,   115,   103,
+     294,     0,     0,   383,   385,     0,     0,     0,    16,    23,
+      25,    18,     0,   349,    38,    18,   194,     0,   385,   385,
+     340,   334,   336,   337,   335,   333,   339,   215,     0,   227,
+       0,     0,   225,   358,   357,   350,   353,     0,     0,     0,
+       0,   383,   394,   393,     0,     0,     0,    19,   388,   320,
+       0,   461,   468,   456,   451,   454,   453,   455,     0,   463,
+       0,     0,   439,     0,   458,   443,   441,   427,   445,     0,
+     446,     0,   476,    37,   100,   326,     0,   322,   325,     0,
+       0,     0,   407,     0,     0,     0,     0,     0,   419,     0,
+       0,     0,   423,   406,   405,   403,   402,     0,   291,     0,
+     289,   202,    18,    18,   147,   144,     0,     0,     0,     0,
+     121,     0,   124,     0,     0,    32,   385,   385,    86,    87,
+      90,     0,     0,     0,     0,   108,   107,     0,     0,   150,
+       0,     0,     0,    18,    17,    27,     0,     0,    60,     0,
+       0,     0,     0,   242,     0,     0,   352,   359,     0,     0,
+       0,     0,    18,     0,     0,     0,     0,   245,   431,   464,
+     466,     0,   471,   447,   477,     0,     0,   428,   429,   410,
+     408,   385,   385,     0,     0,     0,     0,     0,   292,     0,
+       0,   416,     0,     0,     0,     0,     0,   382,     0,     0,
+       0,   131,   133,   128,    30,    29,     0,     0,     0,     0,
+       0,   109,   116,   156,   157,   153,   154,     0,   151,    18,
+     430,     0,     0,   309,     0,   138,   136,   135,     0,     0,
+     226,     0,   382,   228,   351,   354,   229,   231,   230,   244,
+     397,   395,     0,   247,   465,   321,   323,     0,     0,   315,
+     420,     0,   421,     0,   424,   425,   417,   290,   142,   140,
+     146,   145,   163,     0,    18,   118,    18,   130,   132,     0,
+     308,    93,    91,    92,     0,   117,     0,     0,   148,   152,
+      18,   300,   299,     0,   137,     0,    18,    18,   396,     0,
+       0,     0,   310,     0,     0,     0,     0,   360,     0,     0,
+     311,     0,     0,     0,   111,   110,   158,   155,   307,   301,
+       0,   165,     0,   317,   243,   248,   246,     0,     0,     0,
+     164,    18,     0,    18,   303,   302,   122,   129,   313,   166,
+      18,   314,     0,     0,     0,   361,   312,   304,     0,   119,
+     316,   422,   426,   161,   160,   123,   162
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -810,  -810,    53,  -569,  -810,   -38,  -418,  -392,  -810,  -243,
+    -810,    43,  -810,  -810,     8,  -810,  -810,  -810,   748,  -810,
+    -810,  -810,   -22,  -810,  -320,   353,  -223,  -608,  -810,  -810,
+     361,   560,  -810,  -810,  -810,  -810,  -132,  -810,  -810,  -810,
+    -810,  -810,  -810,  -810,  -810,  -810,  -810,    35,  -810,  -104,
+    -810,  -810,  -810,  -810,  -810,  -810,  -810,  -810,  -810,   431,
+     777,     0,  -263,  -114,     3,    12,  -810,    13,    15,   -83,
+     488,   798,  -810,   661,   429,   489,   -34,  -810,   -26,  -810,
+      -3,    51,  -810,   526,  -810,  -810,  -810,    -7,  -195,  -214,
+    -810,  -810,  -744,  -810,  -805,  -810,   -33,   -88,   -86,   -82,
+    -810,  -810,  -810,    11,   257,  -810,  -810,   337,  -810,  -810,
+    -810,   450,  -810,  -810,  -810,    37,   316,   -93,  -809,   333,
+      68,  -209,  -810,   301,   145,    16,  -810,   -12,   442,  -810,
+    -810,  -182,  -325,   496,   131,  -305,   -52,   478,  -334,   283
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    70,   443,   151,    71,    72,   444,   842,   445,   599,
+     447,   607,   745,   608,   448,   268,    74,   463,    75,    76,
+      77,   614,   225,    78,   351,   236,   237,   430,   431,   832,
+     432,   408,   739,   959,    79,   742,   823,    80,   645,   847,
+      81,   733,   732,   402,   735,    82,   758,   759,   760,   834,
+     835,    83,   211,   964,   916,    84,   931,    85,    86,   174,
+     175,   133,    88,   398,   134,   180,   181,   182,   183,   184,
+     138,   185,   910,   372,   186,   140,   187,   141,   188,   142,
+     189,   190,   191,   239,   143,   424,   729,   730,   240,   241,
+     144,   145,   843,   902,   920,   945,   214,    90,    91,    92,
+      93,   322,   707,   708,   553,    94,    95,   280,   474,   281,
+      96,   162,   163,    97,   776,   666,   667,   917,   918,   489,
+      98,   306,   307,   308,   309,   449,   712,   283,   198,   199,
+     100,   343,   344,   345,   530,   531,   532,   346,   347,   545
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      87,   409,   418,    89,   406,   446,   465,   277,    73,   278,
+     598,   197,   544,   279,   135,   136,    99,   137,   541,   755,
+     756,   409,   727,   638,   245,   234,   293,   521,   523,   524,
+     526,   527,   550,   256,   369,   439,   698,   425,   859,   228,
+     328,   147,    89,   153,   496,   299,   253,   300,   301,   238,
+     743,   700,   394,   310,   475,   328,   147,   793,   147,   155,
+     150,   328,   457,   651,   212,   303,   586,   304,   809,   458,
+     212,    87,   461,   312,    89,   165,   476,   147,   203,    73,
+     481,   692,   164,   695,   166,   696,   720,    99,   845,   495,
+     147,   385,   422,   480,   367,   147,   932,   147,   652,   370,
+     147,   389,   934,   369,   534,   254,   146,   588,   147,   415,
+     676,   282,   690,   248,   948,   450,   193,   883,   534,   426,
+     221,   534,   271,   255,   691,   508,   697,   423,   951,   534,
+     721,   496,   313,   314,   303,   722,   304,   193,   956,   472,
+     788,   511,   390,   797,   169,   960,   831,   653,   486,   315,
+     316,   798,   654,   487,   548,   562,   928,  -355,   167,   744,
+     386,   148,   933,   392,   201,   213,   846,   459,   381,   216,
+     202,   244,   217,   497,   477,   222,   555,   272,   557,   164,
+     498,   471,   218,   391,   393,   219,   541,   294,   413,   414,
+     156,   395,   485,   395,   479,   693,   634,   482,   149,   484,
+     640,   323,   490,   493,   154,   395,   170,   420,   354,   544,
+     701,   702,   358,   149,   741,   149,   701,   456,   638,   764,
+      87,   360,   630,    89,   689,   238,   618,   810,   412,   704,
+     541,   635,   541,   353,   149,   811,   942,   382,   717,   152,
+     693,   727,   693,   245,   693,   486,   395,   149,    87,   765,
+     487,    89,   149,   767,   149,    87,   632,   149,    89,   677,
+     497,   171,   294,    73,   396,   149,   193,   498,  -392,   464,
+    -392,    99,   397,   534,   285,   485,   620,   157,   485,   419,
+     757,   718,   719,   383,   506,   507,   924,   925,   566,   537,
+     539,   615,   194,   616,   543,   840,   438,   585,   384,   587,
+     837,   589,   451,   452,   387,   454,   204,   541,   627,   168,
+     628,   388,   814,   488,  -355,   205,   206,   894,   815,   895,
+     873,   172,   621,   135,   136,   874,   137,   200,   486,   135,
+     136,   486,   137,   487,   473,   207,   487,   266,   267,   223,
+     812,   813,   294,   224,   622,   574,   575,   568,   569,   570,
+     571,   572,   573,   558,   173,   294,   559,   643,   294,   210,
+     294,   318,   319,   294,   494,   702,   215,   794,   226,   195,
+     229,   208,   820,   821,   822,   196,   232,   584,   576,   577,
+     578,   579,   656,   789,   768,   277,   791,   278,   233,   209,
+     740,   279,   748,   749,   738,   284,   488,   224,   484,   488,
+     509,   510,    87,   672,   235,    89,   193,   327,   328,   379,
+     380,    87,   646,   436,    89,   243,   659,   436,   242,   609,
+     617,   703,   436,   777,   778,   762,   785,   778,   870,   871,
+     273,   249,   274,   821,   822,   238,   580,   581,   250,   769,
+     770,    87,   251,    87,    89,   257,    89,   899,   499,   500,
+     269,    18,    19,   596,   597,   270,    23,   639,   294,   650,
+     294,   285,   294,   284,   606,   373,   374,   375,   275,   286,
+     287,   156,   288,   289,   290,    35,   223,   291,   164,   295,
+     376,   377,   378,   379,   380,   296,   298,   311,   321,   282,
+     631,   320,   919,   724,   922,   726,   348,   349,   641,   350,
+     352,   355,    87,   357,   213,    89,   244,   361,   359,   362,
+     363,   364,   365,   404,   403,   919,   366,   371,   294,   405,
+     407,   212,   421,   276,   258,   259,   260,   261,   435,   262,
+     263,   264,   436,   440,   453,   265,   469,   826,   827,   470,
+     455,   266,   267,   294,   369,  -199,   503,   501,   192,   954,
+     516,   919,   502,   512,   514,   515,   533,   534,   919,   494,
+     220,   551,   552,   158,   294,   563,   560,   565,   561,   230,
+     231,   193,   593,   723,   594,   725,   780,   781,   595,   600,
+     601,   602,   603,   604,   246,   247,   610,   611,   612,   619,
+     624,   613,   867,   868,   623,   252,   633,   169,   642,   647,
+     657,   903,   648,   649,   658,   679,    87,   660,   662,    89,
+     661,   663,   681,   668,   669,   238,   238,   670,   799,   671,
+     800,   683,   684,   685,   686,   687,   694,   706,   711,   713,
+     714,   715,   716,   734,   395,   737,    87,    87,   746,    89,
+      89,    87,   747,   757,    89,    87,   754,   464,    89,   751,
+     752,   297,   324,   766,   294,   325,   294,   753,   305,   774,
+     779,   326,   775,   783,   327,   328,   784,   329,   330,   331,
+     332,   333,   334,   335,   336,   258,   259,   260,   261,   851,
+     262,   263,   264,   356,   790,   786,   265,   337,   763,   787,
+     860,   861,   266,   267,   328,   795,   816,   796,   803,   801,
+     802,   828,   862,   878,   368,   898,   818,   946,   904,   338,
+     339,   879,   888,   901,   897,   905,   909,   923,   819,   930,
+     829,   830,   841,   340,   782,   744,   399,   400,   401,   864,
+     848,   849,    87,    87,   341,    89,    89,   294,   294,   896,
+     850,   853,   856,    87,    87,   857,    89,    89,   858,   399,
+     416,   609,   825,   872,   889,   876,   890,   915,   875,   399,
+     433,   921,   929,    87,   911,   912,    89,   937,   437,   908,
+     938,   939,   944,   949,   936,   957,   958,   942,   961,   294,
+     962,   294,    87,   963,   966,    89,   824,   227,   629,   625,
+     947,   342,   926,   838,   462,   434,   468,   564,   176,   504,
+     139,   567,   317,   877,   678,   817,   505,   866,   705,   556,
+     655,   305,   478,   839,   675,   855,   935,   483,   664,   844,
+      87,   513,   492,    89,   792,   546,   699,     0,   887,     0,
+       0,     0,     0,     0,     0,     0,     0,   590,     0,    87,
+     852,     0,    89,     0,    87,     0,     0,    89,     0,   955,
+       0,   294,   294,     0,     0,     0,     0,     0,   520,   520,
+     520,   520,   520,   520,     0,     0,   535,   520,   520,     0,
+       0,   884,   520,   886,     0,     0,   549,     0,     0,     0,
+       0,     0,     0,   554,    87,     0,    87,    89,     0,    89,
+       0,     0,     0,     0,   900,     0,     0,     0,     0,     0,
+      87,     0,   906,    89,   907,     0,    87,    87,     0,    89,
+      89,     0,     0,   582,   583,     0,     0,     0,     0,     0,
+       0,     0,   592,     0,     0,     0,     0,     0,     0,     0,
+     294,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    87,     0,    87,    89,     0,    89,     0,     0,     0,
+      87,   294,     0,    89,   433,   626,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   941,
+       0,   943,     0,   294,     0,     0,     0,   294,     0,   644,
+     324,     0,     0,   325,     0,   950,     0,     0,     0,   326,
+       0,   294,   327,   328,     0,   329,   330,   331,   332,   333,
+     334,   335,   336,     0,     0,   294,     0,     0,     0,     0,
+     294,     0,     0,   324,   665,   337,   325,   368,     0,     0,
+       0,     0,   326,   673,   665,   327,   328,     0,   329,   330,
+     331,   332,   333,   334,   335,   336,     0,   338,   540,     0,
+       0,     0,     0,     0,     0,   682,     0,     0,   337,     0,
+       0,   340,     0,   101,     0,   520,   102,   103,   104,     0,
+       0,     5,   341,     0,     0,     0,     0,     0,     0,     0,
+     338,   680,     0,   105,     0,     0,     0,   106,     0,     0,
+     107,     0,   108,     8,   340,     9,     0,     0,     0,   109,
+       0,     0,   110,     0,   111,   341,   112,     0,     0,     0,
+       0,     0,     0,     0,    24,     0,    26,     0,     0,     0,
+       0,     0,     0,    28,     0,   113,   114,   728,     0,   342,
+     115,   731,     0,     0,   116,   117,    37,   736,   118,     0,
+       0,     0,    41,    42,     0,     0,   119,     0,   120,   121,
+     122,     0,     0,     0,     0,   750,    46,     0,     0,     0,
+       0,     0,   342,   433,   433,     0,     0,     0,     0,   123,
+       0,   124,     0,    54,    55,   125,   126,     0,    56,     0,
+     127,     0,     0,     0,     0,     0,     0,    62,    63,    64,
+      65,     0,     0,    67,   771,     0,   773,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   128,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   129,
+     177,     0,     0,   131,   520,   178,     0,   520,     0,   520,
+       0,     0,   179,     0,     0,   591,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   804,     5,   805,   806,   807,     0,     0,
+       0,     0,     0,   808,     0,     0,     0,     0,     0,     0,
+     106,     0,     0,     0,     0,     0,     8,     0,     9,     0,
+       0,     0,     0,     0,     0,   110,     0,   111,     0,     0,
+     433,     0,     0,   836,     0,     0,     0,     0,     0,    26,
+       0,     0,     0,     0,     0,     0,    28,     0,   160,     0,
+       0,   854,     0,     0,   665,     0,     0,     0,     0,    37,
+       0,     0,   863,     0,     0,    41,    42,     0,     0,     0,
+       0,   865,     0,     0,     0,     0,     0,     0,     0,   869,
+       0,     0,     0,     0,     0,     0,   728,     0,     0,     0,
+     880,   881,   882,     0,     0,   885,    54,    55,     0,     0,
+       0,    56,     0,   161,   891,   892,   893,     0,     0,     0,
+      62,    63,    64,    65,   101,     0,    67,   102,   103,   104,
+     542,     0,     5,     0,   328,   518,     0,     0,     0,     0,
+       0,     0,     0,     0,   105,     0,     0,     0,   106,     0,
+       0,   107,     0,   108,     8,     0,     9,   913,   292,   914,
+     109,     0,     0,   110,     0,   111,     0,   112,     0,     0,
+       0,     0,     0,     0,     0,    24,     0,    26,     0,     0,
+     433,   433,   836,   927,    28,     0,   113,   114,     0,     0,
+       0,   115,     0,     0,     0,   116,   117,    37,     0,   118,
+       0,   940,     0,    41,    42,     0,     0,   119,     0,   120,
+     121,   122,     0,     0,     0,     0,     0,    46,     0,     0,
+       0,     0,     0,     0,   952,   953,     0,     0,     0,     0,
+     123,     0,   124,     0,    54,    55,   125,   126,     0,    56,
+       0,   127,     0,     0,   965,     0,     0,     0,    62,    63,
+      64,    65,     0,     0,    67,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   128,     0,     0,
+       0,   101,     0,     0,   102,   103,   104,   528,     0,     5,
+     129,   177,   518,     0,   131,     0,   178,     0,     0,     0,
+     529,   105,   519,   179,     0,   106,     0,     0,   107,     0,
+     108,     8,     0,     9,     0,     0,     0,   109,     0,     0,
+     110,     0,   111,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,    24,     0,    26,     0,     0,     0,     0,     0,
+       0,    28,     0,   113,   114,     0,     0,     0,   115,     0,
+       0,     0,   116,   117,    37,     0,   118,     0,     0,     0,
+      41,    42,     0,     0,   119,     0,   120,   121,   122,     0,
+       0,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,   124,
+       0,    54,    55,   125,   126,     0,    56,     0,   127,     0,
+       0,     0,     0,     0,     0,    62,    63,    64,    65,     0,
+       0,    67,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   128,     0,     0,     0,   101,     0,
+       0,   102,   103,   104,   536,     0,     5,   129,   177,   518,
+       0,   131,     0,   178,     0,     0,     0,   529,   105,   519,
+     179,     0,   106,     0,     0,   107,     0,   108,     8,     0,
+       9,     0,     0,     0,   109,     0,     0,   110,     0,   111,
+       0,   112,     0,     0,     0,     0,     0,     0,     0,    24,
+       0,    26,     0,     0,     0,     0,     0,     0,    28,     0,
+     113,   114,     0,     0,     0,   115,     0,     0,     0,   116,
+     117,    37,     0,   118,     0,     0,     0,    41,    42,     0,
+       0,   119,     0,   120,   121,   122,     0,     0,     0,     0,
+       0,    46,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   123,     0,   124,     0,    54,    55,
+     125,   126,     0,    56,     0,   127,     0,     0,     0,     0,
+       0,     0,    62,    63,    64,    65,     0,     0,    67,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   128,     0,     0,     0,   101,     0,     0,   102,   103,
+     104,   538,     0,     5,   129,   177,   518,     0,   131,     0,
+     178,     0,     0,     0,   529,   105,   519,   179,     0,   106,
+       0,     0,   107,     0,   108,     8,     0,     9,     0,     0,
+       0,   109,     0,     0,   110,     0,   111,     0,   112,     0,
+       0,     0,     0,     0,     0,     0,    24,     0,    26,     0,
+       0,     0,     0,     0,     0,    28,     0,   113,   114,     0,
+       0,     0,   115,     0,     0,     0,   116,   117,    37,     0,
+     118,     0,     0,     0,    41,    42,     0,     0,   119,     0,
+     120,   121,   122,     0,     0,     0,     0,     0,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,   124,     0,    54,    55,   125,   126,     0,
+      56,     0,   127,     0,     0,     0,     0,     0,     0,    62,
+      63,    64,    65,     0,     0,    67,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   128,     0,
+       0,     0,   101,     0,     0,   102,   103,   104,     0,     0,
+       5,   129,   177,     0,     0,   131,     0,   178,     0,     0,
+       0,   529,   105,   519,   179,     0,   106,     0,     0,   107,
+       0,   108,     8,     0,     9,     0,     0,     0,   109,     0,
+       0,   110,     0,   111,     0,   112,     0,     0,     0,     0,
+       0,     0,     0,    24,     0,    26,     0,     0,     0,     0,
+       0,     0,    28,     0,   113,   114,     0,     0,     0,   115,
+       0,     0,     0,   116,   117,    37,     0,   118,     0,     0,
+       0,    41,    42,     0,     0,   119,     0,   120,   121,   122,
+       0,     0,     0,     0,     0,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   123,     0,
+     124,     0,    54,    55,   125,   126,     0,    56,     0,   127,
+       0,     0,     0,     0,     0,     0,    62,    63,    64,    65,
+       0,     0,    67,   427,     0,     0,   101,     0,     0,   102,
+     103,   104,   517,     0,     5,   128,     0,   518,     0,     0,
+       0,     0,     0,     0,     0,     0,   105,     0,   129,   177,
+     106,     0,   131,   107,   178,   108,     8,   428,     9,     0,
+     429,   179,   109,     0,     0,   110,     0,   111,     0,   112,
+       0,     0,     0,     0,     0,     0,     0,    24,     0,    26,
+       0,     0,     0,     0,     0,     0,    28,     0,   113,   114,
+       0,     0,     0,   115,     0,     0,     0,   116,   117,    37,
+       0,   118,     0,     0,     0,    41,    42,     0,     0,   119,
+       0,   120,   121,   122,     0,     0,     0,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   123,     0,   124,     0,    54,    55,   125,   126,
+       0,    56,     0,   127,     0,     0,     0,     0,     0,     0,
+      62,    63,    64,    65,     0,     0,    67,     0,     0,     0,
+     101,     0,     0,   102,   103,   104,   522,     0,     5,   128,
+       0,   518,     0,     0,     0,     0,     0,     0,     0,     0,
+     105,     0,   129,   177,   106,     0,   131,   107,   178,   108,
+       8,     0,     9,     0,   519,   179,   109,     0,     0,   110,
+       0,   111,     0,   112,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,    26,     0,     0,     0,     0,     0,     0,
+      28,     0,   113,   114,     0,     0,     0,   115,     0,     0,
+       0,   116,   117,    37,     0,   118,     0,     0,     0,    41,
+      42,     0,     0,   119,     0,   120,   121,   122,     0,     0,
+       0,     0,     0,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   123,     0,   124,     0,
+      54,    55,   125,   126,     0,    56,     0,   127,     0,     0,
+       0,     0,     0,     0,    62,    63,    64,    65,     0,     0,
+      67,     0,     0,     0,   101,     0,     0,   102,   103,   104,
+     525,     0,     5,   128,     0,   518,     0,     0,     0,     0,
+       0,     0,     0,     0,   105,     0,   129,   177,   106,     0,
+     131,   107,   178,   108,     8,     0,     9,     0,   519,   179,
+     109,     0,     0,   110,     0,   111,     0,   112,     0,     0,
+       0,     0,     0,     0,     0,    24,     0,    26,     0,     0,
+       0,     0,     0,     0,    28,     0,   113,   114,     0,     0,
+       0,   115,     0,     0,     0,   116,   117,    37,     0,   118,
+       0,     0,     0,    41,    42,     0,     0,   119,     0,   120,
+     121,   122,     0,     0,     0,     0,     0,    46,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     123,     0,   124,     0,    54,    55,   125,   126,     0,    56,
+       0,   127,     0,     0,     0,     0,     0,     0,    62,    63,
+      64,    65,     0,     0,    67,     0,     0,     0,   101,     0,
+       0,   102,   103,   104,     0,     0,     5,   128,     0,   518,
+       0,     0,     0,     0,     0,     0,     0,     0,   105,     0,
+     129,   177,   106,     0,   131,   107,   178,   108,     8,     0,
+       9,     0,   519,   179,   109,     0,     0,   110,     0,   111,
+       0,   112,     0,     0,     0,     0,     0,     0,     0,    24,
+       0,    26,     0,     0,     0,     0,     0,     0,    28,     0,
+     113,   114,     0,     0,     0,   115,     0,     0,     0,   116,
+     117,    37,     0,   118,     0,     0,     0,    41,    42,     0,
+       0,   119,     0,   120,   121,   122,     0,     0,     0,     0,
+       0,    46,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   123,     0,   124,     0,    54,    55,
+     125,   126,     0,    56,     0,   127,     0,     0,     0,     0,
+       0,     0,    62,    63,    64,    65,     0,     0,    67,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   128,     0,     0,     0,   101,     0,     0,   102,   103,
+     104,     0,     0,     5,   129,   177,   518,     0,   131,     0,
+     178,     0,     0,     0,   688,   105,   519,   179,     0,   106,
+       0,     0,   107,     0,   108,     8,     0,     9,     0,     0,
+       0,   109,     0,     0,   110,     0,   111,     0,   112,     0,
+       0,     0,     0,     0,     0,     0,    24,     0,    26,     0,
+       0,     0,     0,     0,     0,    28,     0,   113,   114,     0,
+       0,     0,   115,     0,     0,     0,   116,   117,    37,     0,
+     118,     0,     0,     0,    41,    42,     0,     0,   119,     0,
+     120,   121,   122,     0,     0,     0,     0,     0,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,   124,     0,    54,    55,   125,   126,     0,
+      56,     0,   127,     0,     0,     0,     0,     0,     0,    62,
+      63,    64,    65,     0,     0,    67,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   128,     0,
+       0,     0,   302,     0,     0,   102,   103,   104,     0,     0,
+       5,   129,   177,     0,     0,   131,     0,   178,     0,     0,
+       0,   529,   105,   519,   179,     0,   106,     0,     0,   107,
+       0,   108,     8,   303,     9,   304,     0,     0,   109,     0,
+       0,   110,     0,   111,     0,   112,     0,     0,     0,     0,
+       0,     0,     0,    24,     0,    26,     0,     0,     0,     0,
+       0,     0,    28,     0,   113,   114,     0,     0,     0,   115,
+       0,     0,     0,   116,   117,    37,     0,   118,     0,     0,
+       0,    41,    42,     0,     0,   119,     0,   120,   121,   122,
+       0,     0,     0,     0,     0,    46,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   123,     0,
+     124,     0,    54,    55,   125,   126,     0,    56,     0,   127,
+       0,     0,     0,     0,     0,     0,    62,    63,    64,    65,
+       0,     0,    67,     0,     0,     0,   101,     0,     0,   102,
+     103,   104,     0,     0,     5,   128,     0,   518,     0,     0,
+       0,     0,     0,     0,     0,     0,   105,     0,   129,   177,
+     106,     0,   131,   107,   178,   108,     8,     0,     9,     0,
+       0,   179,   109,     0,     0,   110,     0,   111,     0,   112,
+       0,     0,     0,     0,     0,     0,     0,    24,     0,    26,
+       0,     0,     0,     0,     0,     0,    28,     0,   113,   114,
+       0,     0,     0,   115,     0,     0,     0,   116,   117,    37,
+       0,   118,     0,     0,     0,    41,    42,     0,     0,   119,
+       0,   120,   121,   122,     0,     0,     0,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   123,     0,   124,     0,    54,    55,   125,   126,
+       0,    56,     0,   127,     0,     0,     0,     0,     0,     0,
+      62,    63,    64,    65,     0,     0,    67,     0,     0,     0,
+     101,     0,     0,   102,   103,   104,     0,     0,     5,   128,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     105,     0,   129,   177,   106,     0,   131,   107,   178,   108,
+       8,     0,     9,     0,   519,   179,   109,     0,     0,   110,
+       0,   111,     0,   112,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,    26,     0,     0,     0,     0,     0,     0,
+      28,     0,   113,   114,     0,     0,     0,   115,     0,     0,
+       0,   116,   117,    37,     0,   118,     0,     0,     0,    41,
+      42,     0,     0,   119,     0,   120,   121,   122,     0,     0,
+       0,     0,     0,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   123,     0,   124,     0,
+      54,    55,   125,   126,     0,    56,     0,   127,     0,     0,
+       0,     0,     0,     0,    62,    63,    64,    65,     0,     0,
+      67,   427,     0,     0,   101,     0,     0,   102,   103,   104,
+       0,     0,     5,   128,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   105,     0,   129,   177,   106,     0,
+     131,   107,   178,   108,     8,     0,     9,     0,   429,   179,
+     109,     0,     0,   110,     0,   111,     0,   112,     0,     0,
+       0,     0,     0,     0,     0,    24,     0,    26,     0,     0,
+       0,     0,     0,     0,    28,     0,   113,   114,     0,     0,
+       0,   115,     0,     0,     0,   116,   117,    37,     0,   118,
+       0,     0,     0,    41,    42,     0,     0,   119,     0,   120,
+     121,   122,     0,     0,     0,     0,     0,    46,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     123,     0,   124,     0,    54,    55,   125,   126,     0,    56,
+       0,   127,     0,     0,     0,     0,     0,     0,    62,    63,
+      64,    65,     0,     0,    67,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   101,     0,   128,   102,   103,
+     104,     0,     0,     5,     0,     0,     0,     0,     0,     0,
+     129,   177,     0,     0,   131,   105,   178,     0,   460,   106,
+       0,     0,   107,   179,   108,     8,     0,     9,     0,     0,
+       0,   109,     0,     0,   110,     0,   111,     0,   112,     0,
+       0,     0,     0,     0,     0,     0,    24,     0,    26,     0,
+       0,     0,     0,     0,     0,    28,     0,   113,   114,     0,
+       0,     0,   115,     0,     0,     0,   116,   117,    37,     0,
+     118,     0,     0,     0,    41,    42,     0,     0,   119,     0,
+     120,   121,   122,     0,     0,     0,     0,     0,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,   124,     0,    54,    55,   125,   126,     0,
+      56,     0,   127,     0,     0,     0,     0,     0,     0,    62,
+      63,    64,    65,     0,     0,    67,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   101,     0,   128,   102,
+     103,   104,     0,     0,     5,     0,     0,     0,     0,     0,
+       0,   129,   177,     0,     0,   131,   105,   178,     0,   547,
+     106,     0,     0,   107,   179,   108,     8,     0,     9,     0,
+       0,     0,   109,     0,     0,   110,     0,   111,     0,   112,
+       0,     0,     0,     0,     0,     0,     0,    24,     0,    26,
+       0,     0,     0,     0,     0,     0,    28,     0,   113,   114,
+       0,     0,     0,   115,     0,     0,     0,   116,   117,    37,
+       0,   118,     0,     0,     0,    41,    42,     0,     0,   119,
+       0,   120,   121,   122,     0,     0,     0,     0,     0,    46,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   123,     0,   124,     0,    54,    55,   125,   126,
+       0,    56,     0,   127,     0,     0,     0,     0,     0,     0,
+      62,    63,    64,    65,     0,     0,    67,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   101,     0,   128,
+     102,   103,   104,   147,     0,     5,     0,     0,     0,     0,
+       0,     0,   129,   177,     0,     0,   131,   105,   178,     0,
+     674,   106,     0,     0,   107,   179,   108,     8,     0,     9,
+       0,     0,     0,   109,     0,     0,   110,     0,   111,     0,
+     112,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+      26,     0,     0,     0,     0,     0,     0,    28,     0,   113,
+     114,     0,     0,     0,   115,     0,     0,     0,   116,   117,
+      37,     0,   118,     0,     0,     0,    41,    42,     0,     0,
+     119,     0,   120,   121,   122,     0,     0,     0,     0,     0,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,   124,     0,    54,    55,   125,
+     126,     0,    56,     0,   127,     0,     0,     0,     0,     0,
+       0,    62,    63,    64,    65,     0,     0,    67,     0,     0,
+       0,   101,     0,     0,   102,   103,   104,     0,     0,     5,
+     128,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   105,     0,   129,   177,   106,     0,   131,   107,   178,
+     108,     8,     0,     9,     0,     0,   179,   109,     0,     0,
+     110,     0,   111,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,    24,     0,    26,     0,     0,     0,     0,     0,
+       0,    28,     0,   113,   114,     0,     0,     0,   115,     0,
+       0,     0,   116,   117,    37,     0,   118,     0,     0,     0,
+      41,    42,     0,     0,   119,     0,   120,   121,   122,     0,
+       0,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,   124,
+       0,    54,    55,   125,   126,     0,    56,     0,   127,     0,
+       0,     0,     0,     0,     0,    62,    63,    64,    65,     0,
+       0,    67,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   128,     0,     0,   101,     0,     0,
+     102,   103,   104,     0,     0,     5,     0,   129,   177,     0,
+       0,   131,     0,   178,     0,     0,     0,   105,     0,   429,
+     179,   106,     0,   772,   107,     0,   108,     8,     0,     9,
+       0,     0,     0,   109,     0,     0,   110,     0,   111,     0,
+     112,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+      26,     0,     0,     0,     0,     0,     0,    28,     0,   113,
+     114,     0,     0,     0,   115,     0,     0,     0,   116,   117,
+      37,     0,   118,     0,     0,     0,    41,    42,     0,     0,
+     119,     0,   120,   121,   122,     0,     0,     0,     0,     0,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,   124,     0,    54,    55,   125,
+     126,     0,    56,     0,   127,     0,     0,     0,     0,     0,
+       0,    62,    63,    64,    65,     0,     0,    67,     0,     0,
+       0,   101,     0,     0,   102,   103,   104,   348,     0,     5,
+     128,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   105,     0,   129,   177,   106,     0,   131,   107,   178,
+     108,     8,     0,     9,     0,     0,   179,   109,     0,     0,
+     110,     0,   111,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,    24,     0,    26,     0,     0,     0,     0,     0,
+       0,    28,     0,   113,   114,     0,     0,     0,   115,     0,
+       0,     0,   116,   117,    37,     0,   118,     0,     0,     0,
+      41,    42,     0,     0,   119,     0,   120,   121,   122,     0,
+       0,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,   124,
+       0,    54,    55,   125,   126,     0,    56,     0,   127,     0,
+       0,     0,     0,     0,     0,    62,    63,    64,    65,     0,
+       0,    67,     0,     0,     0,   101,     0,     0,   102,   103,
+     104,     0,     0,     5,   128,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   105,     0,   129,   177,   106,
+       0,   131,   107,   178,   108,     8,     0,     9,     0,     0,
+     179,   109,     0,     0,   110,     0,   111,     0,   112,     0,
+       0,     0,     0,     0,     0,     0,    24,     0,    26,   833,
+       0,     0,     0,     0,     0,    28,     0,   113,   114,     0,
+       0,     0,   115,     0,     0,     0,   116,   117,    37,     0,
+     118,     0,     0,     0,    41,    42,     0,     0,   119,     0,
+     120,   121,   122,     0,     0,     0,     0,     0,    46,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   123,     0,   124,     0,    54,    55,   125,   126,     0,
+      56,     0,   127,     0,     0,     0,     0,     0,     0,    62,
+      63,    64,    65,     0,     0,    67,     0,     0,     0,   101,
+       0,     0,   102,   103,   104,     0,     0,     5,   128,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   105,
+       0,   129,   177,   106,     0,   131,   107,   178,   108,     8,
+       0,     9,     0,     0,   179,   109,     0,     0,   110,     0,
+     111,     0,   112,     0,     0,     0,     0,     0,     0,     0,
+      24,     0,    26,     0,     0,     0,     0,     0,     0,    28,
+       0,   113,   114,     0,     0,     0,   115,     0,     0,     0,
+     116,   117,    37,     0,   118,     0,     0,     0,    41,    42,
+       0,     0,   119,     0,   120,   121,   122,     0,     0,     0,
+       0,     0,    46,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   123,     0,   124,     0,    54,
+      55,   125,   126,     0,    56,     0,   127,     0,     0,     0,
+       0,     0,     0,    62,    63,    64,    65,     0,     0,    67,
+       0,     0,     0,   101,     0,     0,   102,   103,   104,     0,
+       0,     5,   128,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   105,     0,   129,   177,   106,     0,   131,
+     107,   178,   108,     8,     0,     9,     0,     0,   179,   109,
+       0,     0,   110,     0,   111,     0,   112,     0,     0,     0,
+       0,     0,     0,     0,    24,     0,    26,     0,     0,     0,
+       0,     0,     0,    28,     0,   113,   114,     0,     0,     0,
+     115,     0,     0,     0,   466,   117,    37,     0,   118,     0,
+       0,     0,    41,    42,     0,     0,   119,     0,   120,   121,
+     122,     0,     0,     0,     0,     0,   467,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   123,
+       0,   124,     0,    54,    55,   125,   126,     0,    56,     0,
+     127,     0,     0,     0,     0,     0,     0,    62,    63,    64,
+      65,     0,     0,    67,     0,     0,     0,   101,     0,     0,
+     102,   103,   104,     0,     0,     5,   128,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   105,     0,   129,
+     177,   106,     0,   131,   107,   178,   108,     8,     0,     9,
+       0,     0,   179,   109,     0,     0,   110,     0,   111,     0,
+     112,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+      26,     0,     0,     0,     0,     0,     0,    28,     0,   113,
+     114,     0,     0,     0,   115,     0,     0,     0,   116,   117,
+      37,     0,   118,     0,     0,     0,    41,    42,     0,     0,
+     119,     0,   120,   121,   122,     0,     0,     0,     0,     0,
+      46,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   123,     0,   124,     0,    54,    55,   125,
+     126,     0,    56,     0,   127,     0,     0,     0,     0,     0,
+       0,    62,    63,    64,    65,     0,     0,    67,     0,     0,
+       0,   101,     0,     0,   102,   103,   104,     0,     0,     5,
+     128,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   105,     0,   129,   177,   106,     0,   131,   107,   491,
+     108,     8,     0,     9,     0,     0,   179,   109,     0,     0,
+     110,     0,   111,     0,   112,     0,     0,     0,     0,     0,
+       0,     0,    24,     0,    26,     0,     0,     0,     0,     0,
+       0,    28,     0,   113,   114,     0,     0,     0,   115,     0,
+       0,     0,   116,   117,    37,     0,   118,     0,     0,     0,
+      41,    42,     0,     0,   119,     0,   120,   121,   122,     0,
+       0,     0,     0,     0,    46,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   123,     0,   124,
+       0,    54,    55,   125,   126,     0,    56,     0,   127,     0,
+       0,     0,     0,     0,     0,    62,    63,    64,    65,     0,
+       0,    67,     0,     0,     1,     2,   441,     4,     0,     0,
+       0,   147,     0,     5,   128,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   129,   130,   106,
+       0,   131,     0,     7,     0,     8,     0,     9,     0,    10,
+     132,     0,     0,    11,   110,    13,   410,    15,    16,     0,
+     442,     0,     0,     0,    22,    23,    24,    25,    26,     0,
+       0,     0,     0,    27,     0,    28,    29,   160,     0,    31,
+      32,    33,     0,    34,     0,     0,    36,     0,    37,     0,
+       0,    39,     0,    40,    41,    42,     0,     0,     0,     0,
+       0,     0,     0,    43,    44,     0,     0,     0,    46,     0,
+       0,    47,     0,     0,     0,    48,    49,     0,     0,    50,
+      51,     0,    52,     0,    53,    54,    55,     0,     0,     0,
+      56,     0,   161,     0,    58,    59,     0,    60,     0,    62,
+      63,    64,    65,     0,     0,    67,     0,    68,     1,     2,
+      69,     4,   605,     0,     0,   147,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   106,     0,     0,     0,     7,   149,     8,
+       0,     9,     0,    10,     0,     0,     0,    11,   110,    13,
+     410,    15,    16,     0,     0,     0,     0,     0,    22,     0,
+      24,    25,    26,     0,     0,     0,     0,    27,     0,    28,
+      29,   160,     0,    31,    32,    33,     0,    34,     0,     0,
+      36,     0,    37,     0,     0,    39,     0,    40,    41,    42,
+       0,     0,     0,     0,     0,     0,     0,    43,    44,     0,
+       0,     0,    46,     0,     0,    47,     0,     0,     0,    48,
+      49,     0,     0,    50,    51,     0,    52,     0,    53,    54,
+      55,     0,     0,     0,    56,     0,   161,     0,    58,    59,
+       0,    60,     0,    62,    63,    64,    65,     0,     0,    67,
+       0,    68,     1,     2,    69,     4,     0,     0,     0,   147,
+       0,     5,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   106,     0,     0,
+       0,     7,   149,     8,     0,     9,     0,    10,     0,     0,
+       0,    11,   110,    13,   410,    15,    16,     0,     0,     0,
+       0,     0,    22,     0,    24,    25,    26,     0,     0,     0,
+       0,    27,     0,    28,    29,   160,     0,    31,    32,    33,
+       0,    34,     0,     0,    36,     0,    37,     0,     0,    39,
+       0,    40,    41,    42,     0,     0,     0,     0,     0,     0,
+       0,    43,    44,     0,     0,     0,    46,     0,     0,    47,
+       0,     0,     0,    48,    49,     0,     0,    50,    51,     0,
+      52,     0,    53,    54,    55,     0,     0,     0,    56,     0,
+     161,     0,    58,    59,     0,    60,     0,    62,    63,    64,
+      65,     0,     0,    67,     0,    68,     0,     0,    69,     0,
+     101,     0,     0,   102,   103,   104,     0,     0,     5,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     105,     0,     0,     0,   106,     0,   149,   107,     0,   108,
+       8,     0,     9,     0,     0,     0,   109,     0,     0,   110,
+       0,   111,     0,   112,     0,     0,     0,     0,     0,     0,
+       0,    24,     0,    26,     0,     0,     0,     0,     0,     0,
+      28,     0,   160,   114,     0,     0,     0,   115,     0,     0,
+       0,   116,   117,    37,     0,   118,     0,     0,     0,    41,
+      42,     0,     0,   119,     0,   120,   121,   122,     0,     0,
+       0,     0,     0,    46,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   123,     0,   124,     0,
+      54,    55,   125,   126,     0,    56,     0,   161,     0,     0,
+       0,     0,     0,     0,    62,    63,    64,    65,     0,     0,
+      67,     0,     0,     0,   101,     0,     0,   102,   103,   104,
+       0,     0,     5,   128,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   105,     0,   129,   177,   106,     0,
+     131,   107,   178,   108,     8,     0,     9,     0,     0,     0,
+     109,     0,     0,   110,     0,   111,     0,   112,     0,     0,
+       0,     0,     0,     0,     0,    24,     0,    26,     0,     0,
+       0,     0,     0,     0,    28,     0,   160,   114,     0,     0,
+       0,   115,     0,     0,     0,   116,   117,    37,     0,   118,
+       0,     0,     0,    41,    42,     0,     0,   119,     0,   120,
+     121,   122,     0,     0,     0,     0,     0,    46,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     123,     0,   124,     0,    54,    55,   125,   126,     0,    56,
+       0,   161,     0,   324,     0,     0,   325,     0,    62,    63,
+      64,    65,   326,     0,    67,   327,   328,     0,   329,   330,
+     331,   332,   333,   334,   335,   336,     0,   128,     0,     0,
+     324,     0,     0,   325,     0,     0,     0,     0,   337,   326,
+     129,   130,   327,   328,   131,   329,   330,   331,   332,   333,
+     334,   335,   336,     0,     0,     0,     0,     0,     0,     0,
+     338,   709,     0,     0,     0,   337,     0,     0,     0,     0,
+       0,     0,     0,     0,   340,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   341,     0,   338,   710,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   340,   324,     0,     0,   325,     0,     0,     0,     0,
+       0,   326,   341,     0,   327,   328,     0,   329,   330,   331,
+     332,   333,   334,   335,   336,     0,     0,     0,     0,     0,
+       0,   324,     0,     0,     0,     0,     0,   337,     0,     0,
+     326,     0,   342,   327,   328,     0,   329,   330,   331,   332,
+     333,   334,   335,   336,     0,     0,     0,     0,     0,   338,
+     761,     0,     0,     0,     0,     0,   337,     0,     0,   342,
+       0,     0,     0,   340,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   341,     0,     0,     0,   338,   339,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   340,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   341,     1,     2,     3,     4,     0,     0,
+       0,     0,     0,     5,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     6,
+       0,   342,     0,     7,     0,     8,     0,     9,     0,    10,
+       0,     0,     0,    11,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,     0,
+     342,     0,     0,    27,     0,    28,    29,    30,     0,    31,
+      32,    33,     0,    34,    35,     0,    36,     0,    37,    38,
+       0,    39,     0,    40,    41,    42,     0,     0,     0,     0,
+       0,     0,     0,    43,    44,    45,     0,     0,    46,     0,
+       0,    47,     0,     0,     0,    48,    49,     0,     0,    50,
+      51,     0,    52,     0,    53,    54,    55,     0,     0,     0,
+      56,     0,    57,     0,    58,    59,     0,    60,    61,    62,
+      63,    64,    65,    66,     0,    67,     0,    68,     0,     0,
+      69,     1,     2,   636,     4,     0,     0,     0,   637,     0,
+       5,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   106,     0,     0,     0,
+       7,     0,     8,     0,     9,     0,    10,     0,     0,     0,
+      11,   110,    13,   410,    15,    16,     0,   442,     0,     0,
+       0,    22,    23,    24,    25,    26,     0,     0,     0,     0,
+      27,     0,    28,    29,   160,     0,    31,    32,    33,     0,
+      34,     0,     0,    36,     0,    37,     0,     0,    39,     0,
+      40,    41,    42,     0,     0,     0,     0,     0,     0,     0,
+      43,    44,     0,     0,     0,    46,     0,     0,    47,     0,
+       0,     0,    48,    49,     0,     0,    50,    51,     0,    52,
+       0,    53,    54,    55,     0,     0,     0,    56,     0,   161,
+       0,    58,    59,     0,    60,     0,    62,    63,    64,    65,
+       0,     0,    67,     0,    68,     0,     0,    69,     1,     2,
+     636,     4,     0,     0,     0,   637,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   106,     0,     0,     0,     7,     0,     8,
+       0,     9,     0,    10,     0,     0,     0,    11,   110,    13,
+     410,    15,    16,     0,     0,     0,     0,     0,    22,     0,
+      24,    25,    26,     0,     0,     0,     0,    27,     0,    28,
+      29,   160,     0,    31,    32,    33,     0,    34,     0,     0,
+      36,     0,    37,     0,     0,    39,     0,    40,    41,    42,
+       0,     0,     0,     0,     0,     0,     0,    43,    44,     0,
+       0,     0,    46,     0,     0,    47,     0,     0,     0,    48,
+      49,     0,     0,    50,    51,     0,    52,     0,    53,    54,
+      55,     0,     0,     0,    56,     0,   161,     0,    58,    59,
+       0,    60,     0,    62,    63,    64,    65,     1,     2,    67,
+       4,    68,     0,     0,    69,     0,     5,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,     0,     0,     0,     7,     0,     8,     0,
+       9,     0,    10,     0,     0,     0,    11,   110,    13,   410,
+      15,    16,     0,     0,     0,     0,     0,    22,     0,    24,
+      25,    26,     0,     0,     0,     0,    27,     0,    28,    29,
+     160,     0,    31,    32,    33,     0,    34,     0,     0,    36,
+       0,    37,     0,     0,    39,     0,    40,    41,    42,     0,
+       0,     0,     0,     0,     0,     0,    43,    44,     0,     0,
+       0,    46,     0,     0,    47,     0,     0,     0,    48,    49,
+       0,     0,    50,    51,     0,    52,     0,    53,    54,    55,
+       0,     0,     0,    56,     0,   161,   411,    58,    59,     0,
+      60,     0,    62,    63,    64,    65,     0,     0,    67,     0,
+      68,     0,     0,    69,     1,     2,   636,     4,     0,     0,
+       0,     0,     0,     5,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   106,
+       0,     0,     0,     7,     0,     8,     0,     9,     0,    10,
+       0,     0,     0,    11,   110,    13,   410,    15,    16,     0,
+       0,     0,     0,     0,    22,     0,    24,    25,    26,     0,
+       0,     0,     0,    27,     0,    28,    29,   160,     0,    31,
+      32,    33,     0,    34,     0,     0,    36,     0,    37,     0,
+       0,    39,     0,    40,    41,    42,     0,     0,     0,     0,
+       0,     0,     0,    43,    44,     0,     0,     0,    46,     0,
+       0,    47,     0,     0,     0,    48,    49,     0,     0,    50,
+      51,     0,    52,     0,    53,    54,    55,     0,     0,     0,
+      56,     0,   161,     0,    58,    59,     0,    60,     0,    62,
+      63,    64,    65,     1,     2,    67,     4,    68,     0,     0,
+      69,     0,     5,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   106,     0,
+       0,     0,     7,     0,     8,     0,     9,     0,    10,     0,
+       0,     0,    11,   110,    13,   410,    15,    16,     0,     0,
+       0,     0,     0,    22,     0,    24,    25,    26,     0,     0,
+       0,     0,    27,     0,    28,    29,   160,     0,    31,    32,
+      33,     0,    34,     0,     0,    36,     0,    37,     0,     0,
+      39,     0,    40,    41,    42,     0,     0,     0,     0,     0,
+       0,     0,    43,    44,     0,     0,     0,    46,     0,     0,
+      47,     0,     0,     0,    48,    49,     0,     0,    50,    51,
+       0,    52,     0,    53,    54,    55,     1,   101,     0,    56,
+       0,   161,     0,    58,    59,     5,    60,     0,    62,    63,
+      64,    65,     0,     0,    67,     0,    68,     0,     0,    69,
+       0,   106,     0,     0,     0,     0,     0,     8,     0,     9,
+       0,     0,     0,     0,     0,     0,   110,     0,   111,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    24,     0,
+      26,     0,     0,     0,     0,     1,   101,    28,     0,   160,
+       0,     0,     0,     0,     5,     0,     0,     0,   116,     0,
+      37,     0,     0,     0,     0,     0,    41,    42,     0,     0,
+     106,     0,     0,     0,     0,     0,     8,     0,     9,     0,
+      46,     0,     0,     0,     0,   110,     0,   111,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    54,    55,    26,
+       0,     0,    56,     0,   161,     0,    28,   158,   160,     0,
+       0,    62,    63,    64,    65,     5,     0,    67,     0,    37,
+       0,     0,     0,     0,     0,    41,    42,     0,     0,     0,
+       0,   106,     0,     0,     0,   159,     0,     8,     0,     9,
+       0,     0,     0,     0,     0,     0,   110,     0,   111,     0,
+       0,     0,     0,     0,     0,     0,    54,    55,     0,     0,
+      26,    56,     0,   161,     0,     0,     0,    28,     0,   160,
+      62,    63,    64,    65,     0,     0,    67,     0,     0,     0,
+      37,     0,     0,     0,     0,     0,    41,    42,     0,   101,
+       0,     0,     0,     0,   417,     0,     0,     5,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   106,     0,     0,     0,    54,    55,     8,
+       0,     9,    56,     0,   161,     0,     0,     0,   110,     0,
+     111,    62,    63,    64,    65,     0,     0,    67,     0,     0,
+       0,     0,    26,     0,     0,     0,     0,     0,   101,    28,
+       0,   160,     0,     0,     0,     0,     5,     0,     0,     0,
+       0,     0,    37,     0,     0,     0,     0,     0,    41,    42,
+       0,     0,   106,     0,     0,     0,     0,     0,     8,     0,
+       9,     0,     0,     0,     0,     0,     0,   110,     0,   111,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    54,
+      55,    26,     0,     0,    56,     0,   161,     0,    28,     0,
+     160,     0,     0,    62,    63,    64,    65,     5,     0,    67,
+       0,    37,     0,     0,     0,     0,     0,    41,    42,     0,
+       0,     0,     0,   106,     0,     0,     0,   159,     0,     8,
+       0,     9,     0,     0,     0,     0,     0,     0,   110,     0,
+     111,     0,     0,     0,     0,     0,     0,     0,    54,    55,
+       0,     0,    26,    56,     0,   161,     0,     0,     0,    28,
+       0,   160,    62,    63,    64,    65,     5,     0,    67,     0,
+       0,     0,    37,     0,     0,     0,     0,     0,    41,    42,
+       0,     0,   106,     0,     0,     0,     0,     0,     8,     0,
+       9,     0,     0,     0,     0,     0,     0,   110,     0,   111,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    54,
+      55,    26,     0,     0,    56,     0,   161,     0,    28,     0,
+     160,     0,     0,    62,    63,    64,    65,     0,     0,    67,
+       0,    37,     0,     0,     0,     0,     0,    41,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    54,    55,
+       0,     0,     0,    56,     0,   161,     0,     0,     0,     0,
+       0,     0,    62,    63,    64,    65,     0,     0,    67
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,   215,   225,     0,   213,   248,   269,    95,     0,    95,
+     402,    23,   346,    95,     2,     2,     0,     2,   343,   627,
+     628,   235,   591,   441,    57,    47,   119,   332,   333,   334,
+     335,   336,   352,    71,     4,   244,    10,   232,   782,    39,
+      14,    10,    39,     9,    30,   128,     0,   130,   131,    49,
+      58,    10,    30,   136,    30,    14,    10,    10,    10,     4,
+       7,    14,   257,    43,    65,    35,    30,    37,    10,     4,
+      65,    71,   267,    86,    71,    56,     4,    10,    25,    71,
+     289,    10,    14,    10,    65,    10,   125,    71,    59,   298,
+      10,    27,    30,   288,   177,    10,   905,    10,    78,   182,
+      10,   194,   907,     4,    10,    59,   166,    30,    10,   223,
+     502,    95,   161,    60,   923,    30,     4,    30,    10,   233,
+      66,    10,    66,    70,   173,   320,    32,    65,   937,    10,
+     169,    30,   145,   146,    35,   174,    37,     4,   943,    59,
+      32,   323,    30,    32,     4,   950,   754,   127,    98,   162,
+     163,    32,   132,   103,   349,   364,   900,    10,   139,   167,
+      96,   113,   906,    30,   133,   166,   137,   102,    26,     4,
+     139,   166,     7,   159,   102,   121,   358,   121,   360,   111,
+     166,   274,     4,   195,   196,     7,   511,   119,   221,   222,
+     135,   169,    45,   169,   287,   169,   166,   290,   167,   292,
+     443,   148,   295,   296,   170,   169,    66,   229,   155,   543,
+     169,   545,   159,   167,   606,   167,   169,   255,   636,   637,
+     220,   168,   436,   220,   529,   225,   421,   169,   220,   549,
+     555,   440,   557,   135,   167,   177,   169,    95,   125,     4,
+     169,   810,   169,   276,   169,    98,   169,   167,   248,   641,
+     103,   248,   167,   645,   167,   255,   438,   167,   255,   502,
+     159,   121,   194,   255,   159,   167,     4,   166,   167,   269,
+     169,   255,   167,    10,   173,    45,    29,   170,    45,   226,
+      39,   168,   169,   141,   318,   319,   894,   895,   371,   341,
+     342,   169,    30,   171,   346,    32,   243,   390,   156,   392,
+      59,   394,   249,   250,   166,   252,    56,   632,   169,    32,
+     171,   173,   133,   166,   167,    65,    66,   169,   139,   171,
+     169,     4,    75,   311,   311,   174,   311,   166,    98,   317,
+     317,    98,   317,   103,   281,    85,   103,   165,   166,   166,
+     732,   733,   274,   170,    97,   379,   380,   373,   374,   375,
+     376,   377,   378,     4,     4,   287,     7,   450,   290,   166,
+     292,   160,   161,   295,   296,   699,   170,   701,     4,   107,
+      75,   121,    58,    59,    60,   113,     4,   389,   381,   382,
+     383,   384,   475,   688,   647,   473,   691,   473,   166,   139,
+     604,   473,   615,   616,   603,   165,   166,   170,   491,   166,
+     168,   169,   402,   496,   170,   402,     4,    13,    14,   160,
+     161,   411,   168,   169,   411,    32,   168,   169,    39,   411,
+     420,   168,   169,   168,   169,   634,   168,   169,   168,   169,
+      28,     4,    30,    59,    60,   435,   385,   386,     4,   648,
+     649,   441,     4,   443,   441,   159,   443,   839,   303,   304,
+     169,    49,    50,   400,   401,   159,    54,   441,   390,   471,
+     392,   173,   394,   165,   411,   142,   143,   144,    66,   166,
+     166,   135,   166,   166,   166,    73,   166,   166,   410,   166,
+     157,   158,   159,   160,   161,   166,   166,   175,     4,   473,
+     437,   169,   884,   586,   886,   588,    10,   166,   445,   169,
+       7,     9,   502,   159,   166,   502,   166,    25,   169,     4,
+       4,   166,   160,     4,     7,   907,   169,   175,   450,     9,
+       4,    65,    69,   121,   148,   149,   150,   151,   169,   153,
+     154,   155,   169,     4,   159,   159,     4,   746,   747,     4,
+      10,   165,   166,   475,     4,   169,   169,   174,    22,   941,
+       9,   943,   167,    10,    10,    10,    10,    10,   950,   491,
+      34,     9,   138,     4,   496,     4,    81,   168,    81,    43,
+      44,     4,     7,   585,   168,   587,   669,   670,   169,   168,
+     159,   168,   166,   169,    58,    59,     4,     4,   168,   170,
+       9,   169,   801,   802,   168,    69,   168,     4,    41,   169,
+     168,   844,   166,   166,   169,     4,   606,   168,   168,   606,
+     169,   168,    10,   169,   169,   615,   616,   169,   711,   168,
+     713,    10,    10,    10,    10,    10,    10,     4,    30,    30,
+       9,     9,   168,    85,   169,    30,   636,   637,   166,   636,
+     637,   641,   166,    39,   641,   645,   171,   647,   645,    30,
+      30,   125,     1,     4,   586,     4,   588,    30,   132,     4,
+       4,    10,   125,    30,    13,    14,    30,    16,    17,    18,
+      19,    20,    21,    22,    23,   148,   149,   150,   151,   772,
+     153,   154,   155,   157,   161,   143,   159,    36,   635,   174,
+     783,   784,   165,   166,    14,   159,   125,   169,   159,   166,
+     166,   170,    30,    85,   178,   111,   168,   921,   139,    58,
+      59,    85,    72,    59,   125,    30,    30,    30,   169,    59,
+     170,   170,   168,    72,   671,   167,   200,   201,   202,   174,
+     168,   168,   732,   733,    83,   732,   733,   669,   670,   169,
+     168,   168,   168,   743,   744,   168,   743,   744,   168,   223,
+     224,   743,   744,   168,   168,   177,   168,   118,   174,   233,
+     234,   169,   121,   763,   168,   168,   763,    30,   242,   862,
+     125,   125,    59,   126,   174,    66,   169,   169,   168,   711,
+     174,   713,   782,    88,     4,   782,   743,    39,   435,   428,
+     922,   140,   896,   758,   268,   235,   270,   366,    21,   311,
+       2,   372,   141,   810,   503,   737,   317,   796,   551,   359,
+     473,   285,   286,   760,   498,   778,   909,   291,   485,   766,
+     820,   325,   296,   820,   693,   347,   543,    -1,   820,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   395,    -1,   839,
+     772,    -1,   839,    -1,   844,    -1,    -1,   844,    -1,   942,
+      -1,   783,   784,    -1,    -1,    -1,    -1,    -1,   332,   333,
+     334,   335,   336,   337,    -1,    -1,   340,   341,   342,    -1,
+      -1,   818,   346,   820,    -1,    -1,   350,    -1,    -1,    -1,
+      -1,    -1,    -1,   357,   884,    -1,   886,   884,    -1,   886,
+      -1,    -1,    -1,    -1,   841,    -1,    -1,    -1,    -1,    -1,
+     900,    -1,   849,   900,   851,    -1,   906,   907,    -1,   906,
+     907,    -1,    -1,   387,   388,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   396,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     862,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   941,    -1,   943,   941,    -1,   943,    -1,    -1,    -1,
+     950,   883,    -1,   950,   428,   429,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   916,
+      -1,   918,    -1,   905,    -1,    -1,    -1,   909,    -1,   453,
+       1,    -1,    -1,     4,    -1,   932,    -1,    -1,    -1,    10,
+      -1,   923,    13,    14,    -1,    16,    17,    18,    19,    20,
+      21,    22,    23,    -1,    -1,   937,    -1,    -1,    -1,    -1,
+     942,    -1,    -1,     1,   488,    36,     4,   491,    -1,    -1,
+      -1,    -1,    10,   497,   498,    13,    14,    -1,    16,    17,
+      18,    19,    20,    21,    22,    23,    -1,    58,    59,    -1,
+      -1,    -1,    -1,    -1,    -1,   519,    -1,    -1,    36,    -1,
+      -1,    72,    -1,     4,    -1,   529,     7,     8,     9,    -1,
+      -1,    12,    83,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      58,    59,    -1,    24,    -1,    -1,    -1,    28,    -1,    -1,
+      31,    -1,    33,    34,    72,    36,    -1,    -1,    -1,    40,
+      -1,    -1,    43,    -1,    45,    83,    47,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,   591,    -1,   140,
+      71,   595,    -1,    -1,    75,    76,    77,   601,    79,    -1,
+      -1,    -1,    83,    84,    -1,    -1,    87,    -1,    89,    90,
+      91,    -1,    -1,    -1,    -1,   619,    97,    -1,    -1,    -1,
+      -1,    -1,   140,   627,   628,    -1,    -1,    -1,    -1,   110,
+      -1,   112,    -1,   114,   115,   116,   117,    -1,   119,    -1,
+     121,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,
+     131,    -1,    -1,   134,   658,    -1,   660,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   147,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   160,
+     161,    -1,    -1,   164,   688,   166,    -1,   691,    -1,   693,
+      -1,    -1,   173,    -1,    -1,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   717,    12,   719,   720,   721,    -1,    -1,
+      -1,    -1,    -1,   727,    -1,    -1,    -1,    -1,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,    -1,    34,    -1,    36,    -1,
+      -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    -1,    -1,
+     754,    -1,    -1,   757,    -1,    -1,    -1,    -1,    -1,    57,
+      -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    -1,
+      -1,   775,    -1,    -1,   778,    -1,    -1,    -1,    -1,    77,
+      -1,    -1,   786,    -1,    -1,    83,    84,    -1,    -1,    -1,
+      -1,   795,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   803,
+      -1,    -1,    -1,    -1,    -1,    -1,   810,    -1,    -1,    -1,
+     814,   815,   816,    -1,    -1,   819,   114,   115,    -1,    -1,
+      -1,   119,    -1,   121,   828,   829,   830,    -1,    -1,    -1,
+     128,   129,   130,   131,     4,    -1,   134,     7,     8,     9,
+      10,    -1,    12,    -1,    14,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    24,    -1,    -1,    -1,    28,    -1,
+      -1,    31,    -1,    33,    34,    -1,    36,   871,   166,   873,
+      40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,
+     894,   895,   896,   897,    64,    -1,    66,    67,    -1,    -1,
+      -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,    79,
+      -1,   915,    -1,    83,    84,    -1,    -1,    87,    -1,    89,
+      90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,   938,   939,    -1,    -1,    -1,    -1,
+     110,    -1,   112,    -1,   114,   115,   116,   117,    -1,   119,
+      -1,   121,    -1,    -1,   958,    -1,    -1,    -1,   128,   129,
+     130,   131,    -1,    -1,   134,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   147,    -1,    -1,
+      -1,     4,    -1,    -1,     7,     8,     9,    10,    -1,    12,
+     160,   161,    15,    -1,   164,    -1,   166,    -1,    -1,    -1,
+     170,    24,   172,   173,    -1,    28,    -1,    -1,    31,    -1,
+      33,    34,    -1,    36,    -1,    -1,    -1,    40,    -1,    -1,
+      43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,
+      -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,
+      83,    84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,
+      -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,
+      -1,   114,   115,   116,   117,    -1,   119,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,
+      -1,   134,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   147,    -1,    -1,    -1,     4,    -1,
+      -1,     7,     8,     9,    10,    -1,    12,   160,   161,    15,
+      -1,   164,    -1,   166,    -1,    -1,    -1,   170,    24,   172,
+     173,    -1,    28,    -1,    -1,    31,    -1,    33,    34,    -1,
+      36,    -1,    -1,    -1,    40,    -1,    -1,    43,    -1,    45,
+      -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,
+      -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,
+      76,    77,    -1,    79,    -1,    -1,    -1,    83,    84,    -1,
+      -1,    87,    -1,    89,    90,    91,    -1,    -1,    -1,    -1,
+      -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   110,    -1,   112,    -1,   114,   115,
+     116,   117,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,
+      -1,    -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,
+       9,    10,    -1,    12,   160,   161,    15,    -1,   164,    -1,
+     166,    -1,    -1,    -1,   170,    24,   172,   173,    -1,    28,
+      -1,    -1,    31,    -1,    33,    34,    -1,    36,    -1,    -1,
+      -1,    40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,
+      -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,
+      -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,
+      79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,
+      89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   110,    -1,   112,    -1,   114,   115,   116,   117,    -1,
+     119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   147,    -1,
+      -1,    -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,
+      12,   160,   161,    -1,    -1,   164,    -1,   166,    -1,    -1,
+      -1,   170,    24,   172,   173,    -1,    28,    -1,    -1,    31,
+      -1,    33,    34,    -1,    36,    -1,    -1,    -1,    40,    -1,
+      -1,    43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,
+      -1,    -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,
+      -1,    83,    84,    -1,    -1,    87,    -1,    89,    90,    91,
+      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,
+     112,    -1,   114,   115,   116,   117,    -1,   119,    -1,   121,
+      -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,
+      -1,    -1,   134,   135,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    10,    -1,    12,   147,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    24,    -1,   160,   161,
+      28,    -1,   164,    31,   166,    33,    34,   169,    36,    -1,
+     172,   173,    40,    -1,    -1,    43,    -1,    45,    -1,    47,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,
+      -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,
+      -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,
+      -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,   117,
+      -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,
+     128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,
+       4,    -1,    -1,     7,     8,     9,    10,    -1,    12,   147,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      24,    -1,   160,   161,    28,    -1,   164,    31,   166,    33,
+      34,    -1,    36,    -1,   172,   173,    40,    -1,    -1,    43,
+      -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,    -1,
+      -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,    83,
+      84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,    -1,
+      -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,    -1,
+     114,   115,   116,   117,    -1,   119,    -1,   121,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,    -1,
+     134,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      10,    -1,    12,   147,    -1,    15,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    24,    -1,   160,   161,    28,    -1,
+     164,    31,   166,    33,    34,    -1,    36,    -1,   172,   173,
+      40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,    -1,
+      -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,    79,
+      -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,    89,
+      90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     110,    -1,   112,    -1,   114,   115,   116,   117,    -1,   119,
+      -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,    -1,    -1,   134,    -1,    -1,    -1,     4,    -1,
+      -1,     7,     8,     9,    -1,    -1,    12,   147,    -1,    15,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    24,    -1,
+     160,   161,    28,    -1,   164,    31,   166,    33,    34,    -1,
+      36,    -1,   172,   173,    40,    -1,    -1,    43,    -1,    45,
+      -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,
+      -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,
+      66,    67,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,
+      76,    77,    -1,    79,    -1,    -1,    -1,    83,    84,    -1,
+      -1,    87,    -1,    89,    90,    91,    -1,    -1,    -1,    -1,
+      -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   110,    -1,   112,    -1,   114,   115,
+     116,   117,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,
+      -1,    -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   147,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,
+       9,    -1,    -1,    12,   160,   161,    15,    -1,   164,    -1,
+     166,    -1,    -1,    -1,   170,    24,   172,   173,    -1,    28,
+      -1,    -1,    31,    -1,    33,    34,    -1,    36,    -1,    -1,
+      -1,    40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,
+      -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,
+      -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,
+      79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,
+      89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   110,    -1,   112,    -1,   114,   115,   116,   117,    -1,
+     119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   147,    -1,
+      -1,    -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,
+      12,   160,   161,    -1,    -1,   164,    -1,   166,    -1,    -1,
+      -1,   170,    24,   172,   173,    -1,    28,    -1,    -1,    31,
+      -1,    33,    34,    35,    36,    37,    -1,    -1,    40,    -1,
+      -1,    43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,
+      -1,    -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,
+      -1,    -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,
+      -1,    83,    84,    -1,    -1,    87,    -1,    89,    90,    91,
+      -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,
+     112,    -1,   114,   115,   116,   117,    -1,   119,    -1,   121,
+      -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,
+      -1,    -1,   134,    -1,    -1,    -1,     4,    -1,    -1,     7,
+       8,     9,    -1,    -1,    12,   147,    -1,    15,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    24,    -1,   160,   161,
+      28,    -1,   164,    31,   166,    33,    34,    -1,    36,    -1,
+      -1,   173,    40,    -1,    -1,    43,    -1,    45,    -1,    47,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,
+      -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,
+      -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,
+      -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,   117,
+      -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,
+     128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,
+       4,    -1,    -1,     7,     8,     9,    -1,    -1,    12,   147,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      24,    -1,   160,   161,    28,    -1,   164,    31,   166,    33,
+      34,    -1,    36,    -1,   172,   173,    40,    -1,    -1,    43,
+      -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,    -1,
+      -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,    83,
+      84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,    -1,
+      -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,    -1,
+     114,   115,   116,   117,    -1,   119,    -1,   121,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,    -1,
+     134,   135,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,   147,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    24,    -1,   160,   161,    28,    -1,
+     164,    31,   166,    33,    34,    -1,    36,    -1,   172,   173,
+      40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,    -1,
+      -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,    79,
+      -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,    89,
+      90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     110,    -1,   112,    -1,   114,   115,   116,   117,    -1,   119,
+      -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,
+     130,   131,    -1,    -1,   134,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     4,    -1,   147,     7,     8,
+       9,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+     160,   161,    -1,    -1,   164,    24,   166,    -1,   168,    28,
+      -1,    -1,    31,   173,    33,    34,    -1,    36,    -1,    -1,
+      -1,    40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,
+      -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,
+      -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,
+      79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,
+      89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   110,    -1,   112,    -1,   114,   115,   116,   117,    -1,
+     119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,   147,     7,
+       8,     9,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,
+      -1,   160,   161,    -1,    -1,   164,    24,   166,    -1,   168,
+      28,    -1,    -1,    31,   173,    33,    34,    -1,    36,    -1,
+      -1,    -1,    40,    -1,    -1,    43,    -1,    45,    -1,    47,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,
+      -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,
+      -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,
+      -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,
+      -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,   117,
+      -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,
+     128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     4,    -1,   147,
+       7,     8,     9,    10,    -1,    12,    -1,    -1,    -1,    -1,
+      -1,    -1,   160,   161,    -1,    -1,   164,    24,   166,    -1,
+     168,    28,    -1,    -1,    31,   173,    33,    34,    -1,    36,
+      -1,    -1,    -1,    40,    -1,    -1,    43,    -1,    45,    -1,
+      47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,
+      77,    -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,
+      87,    -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,
+     117,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,
+      -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,
+      -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,    12,
+     147,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    24,    -1,   160,   161,    28,    -1,   164,    31,   166,
+      33,    34,    -1,    36,    -1,    -1,   173,    40,    -1,    -1,
+      43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,
+      -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,
+      83,    84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,
+      -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,
+      -1,   114,   115,   116,   117,    -1,   119,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,
+      -1,   134,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   147,    -1,    -1,     4,    -1,    -1,
+       7,     8,     9,    -1,    -1,    12,    -1,   160,   161,    -1,
+      -1,   164,    -1,   166,    -1,    -1,    -1,    24,    -1,   172,
+     173,    28,    -1,    30,    31,    -1,    33,    34,    -1,    36,
+      -1,    -1,    -1,    40,    -1,    -1,    43,    -1,    45,    -1,
+      47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,
+      77,    -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,
+      87,    -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,
+     117,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,
+      -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,
+      -1,     4,    -1,    -1,     7,     8,     9,    10,    -1,    12,
+     147,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    24,    -1,   160,   161,    28,    -1,   164,    31,   166,
+      33,    34,    -1,    36,    -1,    -1,   173,    40,    -1,    -1,
+      43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,
+      -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,
+      83,    84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,
+      -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,
+      -1,   114,   115,   116,   117,    -1,   119,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,
+      -1,   134,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,
+       9,    -1,    -1,    12,   147,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    24,    -1,   160,   161,    28,
+      -1,   164,    31,   166,    33,    34,    -1,    36,    -1,    -1,
+     173,    40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    58,
+      -1,    -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,
+      -1,    -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,
+      79,    -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,
+      89,    90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   110,    -1,   112,    -1,   114,   115,   116,   117,    -1,
+     119,    -1,   121,    -1,    -1,    -1,    -1,    -1,    -1,   128,
+     129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,     4,
+      -1,    -1,     7,     8,     9,    -1,    -1,    12,   147,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    24,
+      -1,   160,   161,    28,    -1,   164,    31,   166,    33,    34,
+      -1,    36,    -1,    -1,   173,    40,    -1,    -1,    43,    -1,
+      45,    -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      55,    -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,    64,
+      -1,    66,    67,    -1,    -1,    -1,    71,    -1,    -1,    -1,
+      75,    76,    77,    -1,    79,    -1,    -1,    -1,    83,    84,
+      -1,    -1,    87,    -1,    89,    90,    91,    -1,    -1,    -1,
+      -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   110,    -1,   112,    -1,   114,
+     115,   116,   117,    -1,   119,    -1,   121,    -1,    -1,    -1,
+      -1,    -1,    -1,   128,   129,   130,   131,    -1,    -1,   134,
+      -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,    -1,
+      -1,    12,   147,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    24,    -1,   160,   161,    28,    -1,   164,
+      31,   166,    33,    34,    -1,    36,    -1,    -1,   173,    40,
+      -1,    -1,    43,    -1,    45,    -1,    47,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,    -1,
+      -1,    -1,    -1,    64,    -1,    66,    67,    -1,    -1,    -1,
+      71,    -1,    -1,    -1,    75,    76,    77,    -1,    79,    -1,
+      -1,    -1,    83,    84,    -1,    -1,    87,    -1,    89,    90,
+      91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,
+      -1,   112,    -1,   114,   115,   116,   117,    -1,   119,    -1,
+     121,    -1,    -1,    -1,    -1,    -1,    -1,   128,   129,   130,
+     131,    -1,    -1,   134,    -1,    -1,    -1,     4,    -1,    -1,
+       7,     8,     9,    -1,    -1,    12,   147,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    24,    -1,   160,
+     161,    28,    -1,   164,    31,   166,    33,    34,    -1,    36,
+      -1,    -1,   173,    40,    -1,    -1,    43,    -1,    45,    -1,
+      47,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,    -1,    -1,    64,    -1,    66,
+      67,    -1,    -1,    -1,    71,    -1,    -1,    -1,    75,    76,
+      77,    -1,    79,    -1,    -1,    -1,    83,    84,    -1,    -1,
+      87,    -1,    89,    90,    91,    -1,    -1,    -1,    -1,    -1,
+      97,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   110,    -1,   112,    -1,   114,   115,   116,
+     117,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,    -1,
+      -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,
+      -1,     4,    -1,    -1,     7,     8,     9,    -1,    -1,    12,
+     147,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    24,    -1,   160,   161,    28,    -1,   164,    31,   166,
+      33,    34,    -1,    36,    -1,    -1,   173,    40,    -1,    -1,
+      43,    -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,
+      -1,    64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,
+      -1,    -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,
+      83,    84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,
+      -1,    -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,
+      -1,   114,   115,   116,   117,    -1,   119,    -1,   121,    -1,
+      -1,    -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,
+      -1,   134,    -1,    -1,     3,     4,     5,     6,    -1,    -1,
+      -1,    10,    -1,    12,   147,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   160,   161,    28,
+      -1,   164,    -1,    32,    -1,    34,    -1,    36,    -1,    38,
+     173,    -1,    -1,    42,    43,    44,    45,    46,    47,    -1,
+      49,    -1,    -1,    -1,    53,    54,    55,    56,    57,    -1,
+      -1,    -1,    -1,    62,    -1,    64,    65,    66,    -1,    68,
+      69,    70,    -1,    72,    -1,    -1,    75,    -1,    77,    -1,
+      -1,    80,    -1,    82,    83,    84,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    -1,    -1,    97,    -1,
+      -1,   100,    -1,    -1,    -1,   104,   105,    -1,    -1,   108,
+     109,    -1,   111,    -1,   113,   114,   115,    -1,    -1,    -1,
+     119,    -1,   121,    -1,   123,   124,    -1,   126,    -1,   128,
+     129,   130,   131,    -1,    -1,   134,    -1,   136,     3,     4,
+     139,     6,     7,    -1,    -1,    10,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    28,    -1,    -1,    -1,    32,   167,    34,
+      -1,    36,    -1,    38,    -1,    -1,    -1,    42,    43,    44,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    53,    -1,
+      55,    56,    57,    -1,    -1,    -1,    -1,    62,    -1,    64,
+      65,    66,    -1,    68,    69,    70,    -1,    72,    -1,    -1,
+      75,    -1,    77,    -1,    -1,    80,    -1,    82,    83,    84,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      -1,    -1,    97,    -1,    -1,   100,    -1,    -1,    -1,   104,
+     105,    -1,    -1,   108,   109,    -1,   111,    -1,   113,   114,
+     115,    -1,    -1,    -1,   119,    -1,   121,    -1,   123,   124,
+      -1,   126,    -1,   128,   129,   130,   131,    -1,    -1,   134,
+      -1,   136,     3,     4,   139,     6,    -1,    -1,    -1,    10,
+      -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,
+      -1,    32,   167,    34,    -1,    36,    -1,    38,    -1,    -1,
+      -1,    42,    43,    44,    45,    46,    47,    -1,    -1,    -1,
+      -1,    -1,    53,    -1,    55,    56,    57,    -1,    -1,    -1,
+      -1,    62,    -1,    64,    65,    66,    -1,    68,    69,    70,
+      -1,    72,    -1,    -1,    75,    -1,    77,    -1,    -1,    80,
+      -1,    82,    83,    84,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    92,    93,    -1,    -1,    -1,    97,    -1,    -1,   100,
+      -1,    -1,    -1,   104,   105,    -1,    -1,   108,   109,    -1,
+     111,    -1,   113,   114,   115,    -1,    -1,    -1,   119,    -1,
+     121,    -1,   123,   124,    -1,   126,    -1,   128,   129,   130,
+     131,    -1,    -1,   134,    -1,   136,    -1,    -1,   139,    -1,
+       4,    -1,    -1,     7,     8,     9,    -1,    -1,    12,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      24,    -1,    -1,    -1,    28,    -1,   167,    31,    -1,    33,
+      34,    -1,    36,    -1,    -1,    -1,    40,    -1,    -1,    43,
+      -1,    45,    -1,    47,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    55,    -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,
+      64,    -1,    66,    67,    -1,    -1,    -1,    71,    -1,    -1,
+      -1,    75,    76,    77,    -1,    79,    -1,    -1,    -1,    83,
+      84,    -1,    -1,    87,    -1,    89,    90,    91,    -1,    -1,
+      -1,    -1,    -1,    97,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   110,    -1,   112,    -1,
+     114,   115,   116,   117,    -1,   119,    -1,   121,    -1,    -1,
+      -1,    -1,    -1,    -1,   128,   129,   130,   131,    -1,    -1,
+     134,    -1,    -1,    -1,     4,    -1,    -1,     7,     8,     9,
+      -1,    -1,    12,   147,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    24,    -1,   160,   161,    28,    -1,
+     164,    31,   166,    33,    34,    -1,    36,    -1,    -1,    -1,
+      40,    -1,    -1,    43,    -1,    45,    -1,    47,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    55,    -1,    57,    -1,    -1,
+      -1,    -1,    -1,    -1,    64,    -1,    66,    67,    -1,    -1,
+      -1,    71,    -1,    -1,    -1,    75,    76,    77,    -1,    79,
+      -1,    -1,    -1,    83,    84,    -1,    -1,    87,    -1,    89,
+      90,    91,    -1,    -1,    -1,    -1,    -1,    97,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     110,    -1,   112,    -1,   114,   115,   116,   117,    -1,   119,
+      -1,   121,    -1,     1,    -1,    -1,     4,    -1,   128,   129,
+     130,   131,    10,    -1,   134,    13,    14,    -1,    16,    17,
+      18,    19,    20,    21,    22,    23,    -1,   147,    -1,    -1,
+       1,    -1,    -1,     4,    -1,    -1,    -1,    -1,    36,    10,
+     160,   161,    13,    14,   164,    16,    17,    18,    19,    20,
+      21,    22,    23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      58,    59,    -1,    -1,    -1,    36,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    83,    -1,    58,    59,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    72,     1,    -1,    -1,     4,    -1,    -1,    -1,    -1,
+      -1,    10,    83,    -1,    13,    14,    -1,    16,    17,    18,
+      19,    20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,
+      -1,     1,    -1,    -1,    -1,    -1,    -1,    36,    -1,    -1,
+      10,    -1,   140,    13,    14,    -1,    16,    17,    18,    19,
+      20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,    58,
+      59,    -1,    -1,    -1,    -1,    -1,    36,    -1,    -1,   140,
+      -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    58,    59,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    83,     3,     4,     5,     6,    -1,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,
+      -1,   140,    -1,    32,    -1,    34,    -1,    36,    -1,    38,
+      -1,    -1,    -1,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,    57,    -1,
+     140,    -1,    -1,    62,    -1,    64,    65,    66,    -1,    68,
+      69,    70,    -1,    72,    73,    -1,    75,    -1,    77,    78,
+      -1,    80,    -1,    82,    83,    84,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    94,    -1,    -1,    97,    -1,
+      -1,   100,    -1,    -1,    -1,   104,   105,    -1,    -1,   108,
+     109,    -1,   111,    -1,   113,   114,   115,    -1,    -1,    -1,
+     119,    -1,   121,    -1,   123,   124,    -1,   126,   127,   128,
+     129,   130,   131,   132,    -1,   134,    -1,   136,    -1,    -1,
+     139,     3,     4,     5,     6,    -1,    -1,    -1,    10,    -1,
+      12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,    -1,    -1,
+      32,    -1,    34,    -1,    36,    -1,    38,    -1,    -1,    -1,
+      42,    43,    44,    45,    46,    47,    -1,    49,    -1,    -1,
+      -1,    53,    54,    55,    56,    57,    -1,    -1,    -1,    -1,
+      62,    -1,    64,    65,    66,    -1,    68,    69,    70,    -1,
+      72,    -1,    -1,    75,    -1,    77,    -1,    -1,    80,    -1,
+      82,    83,    84,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      92,    93,    -1,    -1,    -1,    97,    -1,    -1,   100,    -1,
+      -1,    -1,   104,   105,    -1,    -1,   108,   109,    -1,   111,
+      -1,   113,   114,   115,    -1,    -1,    -1,   119,    -1,   121,
+      -1,   123,   124,    -1,   126,    -1,   128,   129,   130,   131,
+      -1,    -1,   134,    -1,   136,    -1,    -1,   139,     3,     4,
+       5,     6,    -1,    -1,    -1,    10,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    28,    -1,    -1,    -1,    32,    -1,    34,
+      -1,    36,    -1,    38,    -1,    -1,    -1,    42,    43,    44,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    53,    -1,
+      55,    56,    57,    -1,    -1,    -1,    -1,    62,    -1,    64,
+      65,    66,    -1,    68,    69,    70,    -1,    72,    -1,    -1,
+      75,    -1,    77,    -1,    -1,    80,    -1,    82,    83,    84,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,
+      -1,    -1,    97,    -1,    -1,   100,    -1,    -1,    -1,   104,
+     105,    -1,    -1,   108,   109,    -1,   111,    -1,   113,   114,
+     115,    -1,    -1,    -1,   119,    -1,   121,    -1,   123,   124,
+      -1,   126,    -1,   128,   129,   130,   131,     3,     4,   134,
+       6,   136,    -1,    -1,   139,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    28,    -1,    -1,    -1,    32,    -1,    34,    -1,
+      36,    -1,    38,    -1,    -1,    -1,    42,    43,    44,    45,
+      46,    47,    -1,    -1,    -1,    -1,    -1,    53,    -1,    55,
+      56,    57,    -1,    -1,    -1,    -1,    62,    -1,    64,    65,
+      66,    -1,    68,    69,    70,    -1,    72,    -1,    -1,    75,
+      -1,    77,    -1,    -1,    80,    -1,    82,    83,    84,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    92,    93,    -1,    -1,
+      -1,    97,    -1,    -1,   100,    -1,    -1,    -1,   104,   105,
+      -1,    -1,   108,   109,    -1,   111,    -1,   113,   114,   115,
+      -1,    -1,    -1,   119,    -1,   121,   122,   123,   124,    -1,
+     126,    -1,   128,   129,   130,   131,    -1,    -1,   134,    -1,
+     136,    -1,    -1,   139,     3,     4,     5,     6,    -1,    -1,
+      -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,
+      -1,    -1,    -1,    32,    -1,    34,    -1,    36,    -1,    38,
+      -1,    -1,    -1,    42,    43,    44,    45,    46,    47,    -1,
+      -1,    -1,    -1,    -1,    53,    -1,    55,    56,    57,    -1,
+      -1,    -1,    -1,    62,    -1,    64,    65,    66,    -1,    68,
+      69,    70,    -1,    72,    -1,    -1,    75,    -1,    77,    -1,
+      -1,    80,    -1,    82,    83,    84,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    92,    93,    -1,    -1,    -1,    97,    -1,
+      -1,   100,    -1,    -1,    -1,   104,   105,    -1,    -1,   108,
+     109,    -1,   111,    -1,   113,   114,   115,    -1,    -1,    -1,
+     119,    -1,   121,    -1,   123,   124,    -1,   126,    -1,   128,
+     129,   130,   131,     3,     4,   134,     6,   136,    -1,    -1,
+     139,    -1,    12,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    28,    -1,
+      -1,    -1,    32,    -1,    34,    -1,    36,    -1,    38,    -1,
+      -1,    -1,    42,    43,    44,    45,    46,    47,    -1,    -1,
+      -1,    -1,    -1,    53,    -1,    55,    56,    57,    -1,    -1,
+      -1,    -1,    62,    -1,    64,    65,    66,    -1,    68,    69,
+      70,    -1,    72,    -1,    -1,    75,    -1,    77,    -1,    -1,
+      80,    -1,    82,    83,    84,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    92,    93,    -1,    -1,    -1,    97,    -1,    -1,
+     100,    -1,    -1,    -1,   104,   105,    -1,    -1,   108,   109,
+      -1,   111,    -1,   113,   114,   115,     3,     4,    -1,   119,
+      -1,   121,    -1,   123,   124,    12,   126,    -1,   128,   129,
+     130,   131,    -1,    -1,   134,    -1,   136,    -1,    -1,   139,
+      -1,    28,    -1,    -1,    -1,    -1,    -1,    34,    -1,    36,
+      -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    55,    -1,
+      57,    -1,    -1,    -1,    -1,     3,     4,    64,    -1,    66,
+      -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,    75,    -1,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    -1,    -1,
+      28,    -1,    -1,    -1,    -1,    -1,    34,    -1,    36,    -1,
+      97,    -1,    -1,    -1,    -1,    43,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,   115,    57,
+      -1,    -1,   119,    -1,   121,    -1,    64,     4,    66,    -1,
+      -1,   128,   129,   130,   131,    12,    -1,   134,    -1,    77,
+      -1,    -1,    -1,    -1,    -1,    83,    84,    -1,    -1,    -1,
+      -1,    28,    -1,    -1,    -1,    32,    -1,    34,    -1,    36,
+      -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   114,   115,    -1,    -1,
+      57,   119,    -1,   121,    -1,    -1,    -1,    64,    -1,    66,
+     128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,    -1,
+      77,    -1,    -1,    -1,    -1,    -1,    83,    84,    -1,     4,
+      -1,    -1,    -1,    -1,     9,    -1,    -1,    12,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    28,    -1,    -1,    -1,   114,   115,    34,
+      -1,    36,   119,    -1,   121,    -1,    -1,    -1,    43,    -1,
+      45,   128,   129,   130,   131,    -1,    -1,   134,    -1,    -1,
+      -1,    -1,    57,    -1,    -1,    -1,    -1,    -1,     4,    64,
+      -1,    66,    -1,    -1,    -1,    -1,    12,    -1,    -1,    -1,
+      -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    34,    -1,
+      36,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,
+     115,    57,    -1,    -1,   119,    -1,   121,    -1,    64,    -1,
+      66,    -1,    -1,   128,   129,   130,   131,    12,    -1,   134,
+      -1,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    -1,
+      -1,    -1,    -1,    28,    -1,    -1,    -1,    32,    -1,    34,
+      -1,    36,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,   115,
+      -1,    -1,    57,   119,    -1,   121,    -1,    -1,    -1,    64,
+      -1,    66,   128,   129,   130,   131,    12,    -1,   134,    -1,
+      -1,    -1,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,
+      -1,    -1,    28,    -1,    -1,    -1,    -1,    -1,    34,    -1,
+      36,    -1,    -1,    -1,    -1,    -1,    -1,    43,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,
+     115,    57,    -1,    -1,   119,    -1,   121,    -1,    64,    -1,
+      66,    -1,    -1,   128,   129,   130,   131,    -1,    -1,   134,
+      -1,    77,    -1,    -1,    -1,    -1,    -1,    83,    84,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   114,   115,
+      -1,    -1,    -1,   119,    -1,   121,    -1,    -1,    -1,    -1,
+      -1,    -1,   128,   129,   130,   131,    -1,    -1,   134
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     4,     5,     6,    12,    28,    32,    34,    36,
+      38,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    56,    57,    62,    64,    65,
+      66,    68,    69,    70,    72,    73,    75,    77,    78,    80,
+      82,    83,    84,    92,    93,    94,    97,   100,   104,   105,
+     108,   109,   111,   113,   114,   115,   119,   121,   123,   124,
+     126,   127,   128,   129,   130,   131,   132,   134,   136,   139,
+     179,   182,   183,   192,   194,   196,   197,   198,   201,   212,
+     215,   218,   223,   229,   233,   235,   236,   239,   240,   242,
+     275,   276,   277,   278,   283,   284,   288,   291,   298,   303,
+     308,     4,     7,     8,     9,    24,    28,    31,    33,    40,
+      43,    45,    47,    66,    67,    71,    75,    76,    79,    87,
+      89,    90,    91,   110,   112,   116,   117,   121,   147,   160,
+     161,   164,   173,   239,   242,   243,   245,   246,   248,   249,
+     253,   255,   257,   262,   268,   269,   166,    10,   113,   167,
+     180,   181,     4,     9,   170,     4,   135,   170,     4,    32,
+      66,   121,   289,   290,   298,    56,    65,   139,    32,     4,
+      66,   121,     4,     4,   237,   238,   238,   161,   166,   173,
+     243,   244,   245,   246,   247,   249,   252,   254,   256,   258,
+     259,   260,   261,     4,    30,   107,   113,   305,   306,   307,
+     166,   133,   139,   180,    56,    65,    66,    85,   121,   139,
+     166,   230,    65,   166,   274,   170,     4,     7,     4,     7,
+     261,    66,   121,   166,   170,   200,     4,   196,   239,    75,
+     261,   261,     4,   166,   200,   170,   203,   204,   239,   261,
+     266,   267,    39,    32,   166,   274,   261,   261,   180,     4,
+       4,     4,   261,     0,    59,   180,   183,   159,   148,   149,
+     150,   151,   153,   154,   155,   159,   165,   166,   193,   169,
+     159,    66,   121,    28,    30,    66,   121,   275,   276,   277,
+     285,   287,   303,   305,   165,   173,   166,   166,   166,   166,
+     166,   166,   166,   295,   298,   166,   166,   261,   166,   247,
+     247,   247,     4,    35,    37,   261,   299,   300,   301,   302,
+     247,   175,    86,   145,   146,   162,   163,   251,   160,   161,
+     169,     4,   279,   180,     1,     4,    10,    13,    14,    16,
+      17,    18,    19,    20,    21,    22,    23,    36,    58,    59,
+      72,    83,   140,   309,   310,   311,   315,   316,    10,   166,
+     169,   202,     7,   135,   180,     9,   261,   159,   180,   169,
+     180,    25,     4,     4,   166,   160,   169,   247,   261,     4,
+     247,   175,   251,   142,   143,   144,   157,   158,   159,   160,
+     161,    26,    95,   141,   156,    27,    96,   166,   173,   295,
+      30,   305,    30,   305,    30,   169,   159,   167,   241,   261,
+     261,   261,   221,     7,     4,     9,   299,     4,   209,   267,
+      45,   122,   192,   274,   274,   241,   261,     9,   204,   180,
+     200,    69,    30,    65,   263,   266,   241,   135,   169,   172,
+     205,   206,   208,   261,   209,   169,   169,   261,   180,   299,
+       4,     5,    49,   180,   184,   186,   187,   188,   192,   303,
+      30,   180,   180,   159,   180,    10,   183,   266,     4,   102,
+     168,   266,   261,   195,   239,   240,    75,    97,   261,     4,
+       4,   295,    59,   180,   286,    30,     4,   102,   261,   295,
+     266,   299,   295,   261,   295,    45,    98,   103,   166,   297,
+     295,   166,   261,   295,   298,   299,    30,   159,   166,   302,
+     302,   174,   167,   169,   248,   253,   254,   254,   266,   168,
+     169,   309,    10,   311,    10,    10,     9,    10,    15,   172,
+     261,   313,    10,   313,   313,    10,   313,   313,    10,   170,
+     312,   313,   314,    10,    10,   261,    10,   314,    10,   314,
+      59,   310,    10,   314,   316,   317,   315,   168,   266,   261,
+     202,     9,   138,   282,   261,   309,   289,   309,     4,     7,
+      81,    81,   299,     4,   237,   168,   247,   252,   256,   256,
+     256,   256,   256,   256,   254,   254,   258,   258,   258,   258,
+     259,   259,   261,   261,   305,   295,    30,   295,    30,   295,
+     306,   176,   261,     7,   168,   169,   180,   180,   185,   187,
+     168,   159,   168,   166,   169,     7,   180,   189,   191,   192,
+       4,     4,   168,   169,   199,   169,   171,   239,   266,   170,
+      29,    75,    97,   168,     9,   208,   261,   169,   171,   203,
+     267,   180,   309,   168,   166,   299,     5,    10,   184,   303,
+     187,   180,    41,   295,   261,   216,   168,   169,   166,   166,
+     305,    43,    78,   127,   132,   285,   295,   168,   169,   168,
+     168,   169,   168,   168,   297,   261,   293,   294,   169,   169,
+     169,   168,   295,   261,   168,   294,   185,   187,   301,     4,
+      59,    10,   261,    10,    10,    10,    10,    10,   170,   313,
+     161,   173,    10,   169,    10,    10,    10,    32,    10,   317,
+      10,   169,   316,   168,   202,   282,     4,   280,   281,    59,
+      59,    30,   304,    30,     9,     9,   168,   125,   168,   169,
+     125,   169,   174,   305,   295,   305,   295,   181,   261,   264,
+     265,   261,   220,   219,    85,   222,   261,    30,   299,   210,
+     267,   185,   213,    58,   167,   190,   166,   166,   204,   204,
+     261,    30,    30,    30,   171,   205,   205,    39,   224,   225,
+     226,    59,   299,   180,   184,   185,     4,   185,   240,   299,
+     299,   261,    30,   261,     4,   125,   292,   168,   169,     4,
+     295,   295,   180,    30,    30,   168,   143,   174,    32,   313,
+     161,   313,   312,    10,   316,   159,   169,    32,    32,   295,
+     295,   166,   166,   159,   261,   261,   261,   261,   261,    10,
+     169,   177,   185,   185,   133,   139,   125,   298,   168,   169,
+      58,    59,    60,   214,   189,   192,   299,   299,   170,   170,
+     170,   205,   207,    58,   227,   228,   261,    59,   225,   180,
+      32,   168,   185,   270,   180,    59,   137,   217,   168,   168,
+     168,   295,   298,   168,   261,   293,   168,   168,   168,   270,
+     295,   295,    30,   261,   174,   261,   281,   299,   299,   261,
+     168,   169,   168,   169,   174,   174,   177,   265,    85,    85,
+     261,   261,   261,    30,   180,   261,   180,   192,    72,   168,
+     168,   261,   261,   261,   169,   171,   169,   125,   111,   185,
+     180,    59,   271,   187,   139,    30,   180,   180,   295,    30,
+     250,   168,   168,   261,   261,   118,   232,   295,   296,   185,
+     272,   169,   185,    30,   205,   205,   227,   261,   270,   121,
+      59,   234,   296,   270,   272,   295,   174,    30,   125,   125,
+     261,   180,   169,   180,    59,   273,   267,   214,   296,   126,
+     180,   296,   261,   261,   185,   295,   272,    66,   169,   211,
+     272,   168,   174,    88,   231,   261,     4
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   178,   179,   179,   179,   180,   180,   181,   181,   182,
+     183,   183,   183,   183,   183,   184,   184,   184,   185,   185,
+     186,   186,   186,   186,   187,   187,   188,   188,   189,   189,
+     190,   190,   191,   192,   192,   192,   192,   192,   192,   192,
+     192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+     193,   193,   193,   193,   193,   193,   193,   193,   194,   195,
+     195,   196,   196,   196,   196,   196,   197,   197,   198,   198,
+     198,   198,   198,   198,   198,   198,   198,   198,   199,   199,
+     200,   200,   201,   201,   201,   201,   201,   201,   201,   201,
+     201,   201,   201,   201,   201,   201,   201,   201,   201,   202,
+     202,   203,   204,   204,   205,   205,   206,   206,   206,   207,
+     207,   207,   208,   208,   208,   208,   208,   208,   209,   209,
+     210,   210,   211,   211,   212,   212,   212,   212,   213,   213,
+     213,   214,   214,   214,   216,   215,   217,   217,   217,   219,
+     218,   220,   218,   221,   218,   222,   222,   222,   223,   223,
+     224,   224,   225,   226,   227,   227,   227,   228,   228,   230,
+     229,   231,   231,   232,   232,   233,   234,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   236,   236,
+     236,   236,   236,   236,   236,   236,   236,   236,   237,   238,
+     238,   239,   239,   239,   239,   239,   239,   239,   239,   240,
+     240,   241,   241,   242,   242,   242,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   244,   244,   245,
+     245,   245,   245,   245,   245,   246,   246,   246,   246,   246,
+     246,   246,   246,   246,   247,   247,   247,   247,   248,   248,
+     248,   248,   249,   249,   249,   249,   249,   250,   250,   251,
+     251,   251,   251,   251,   252,   252,   253,   253,   254,   254,
+     255,   255,   256,   256,   256,   257,   257,   257,   258,   258,
+     258,   258,   258,   258,   258,   259,   259,   259,   259,   259,
+     260,   260,   260,   261,   261,   262,   262,   263,   263,   264,
+     264,   265,   265,   266,   266,   267,   268,   269,   269,   270,
+     271,   271,   272,   273,   273,   274,   274,   275,   275,   275,
+     275,   276,   276,   276,   276,   276,   277,   277,   278,   279,
+     279,   280,   281,   281,   282,   282,   283,   283,   284,   284,
+     284,   284,   285,   285,   286,   286,   286,   286,   287,   287,
+     287,   287,   287,   287,   287,   288,   289,   290,   290,   291,
+     292,   292,   293,   294,   294,   295,   295,   295,   295,   295,
+     296,   296,   297,   297,   298,   298,   298,   298,   298,   298,
+     298,   298,   298,   298,   298,   298,   298,   298,   298,   298,
+     298,   298,   298,   298,   298,   299,   299,   300,   300,   301,
+     301,   301,   302,   302,   302,   302,   302,   302,   303,   303,
+     303,   303,   303,   303,   303,   303,   303,   303,   303,   304,
+     304,   305,   305,   306,   306,   306,   306,   306,   307,   307,
+     307,   307,   307,   307,   307,   307,   307,   308,   308,   308,
+     308,   308,   309,   309,   310,   310,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   311,   311,   311,   311,   311,   311,   311,   311,
+     311,   311,   312,   312,   312,   312,   312,   313,   313,   313,
+     314,   314,   315,   315,   316,   317,   317,   317
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     3,     3,     1,     1,     1,     2,     1,
+       0,     1,     1,     1,     2,     1,     2,     3,     0,     1,
+       1,     1,     1,     2,     1,     2,     1,     3,     1,     3,
+       2,     0,     2,     1,     2,     2,     4,     5,     4,     1,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
+       3,     3,     3,     3,     3,     3,     1,     2,     1,     1,
+       2,     1,     2,     2,     2,     2,     2,     2,     0,     1,
+       0,     3,     3,     4,     4,     3,     5,     5,     2,     1,
+       5,     7,     7,     7,     3,     4,     3,     3,     3,     0,
+       3,     1,     1,     3,     1,     2,     1,     3,     3,     1,
+       3,     3,     0,     1,     2,     2,     4,     5,     5,     8,
+       0,     1,     0,     2,     5,     4,     3,     4,     2,     5,
+       3,     1,     2,     1,     0,     6,     1,     2,     1,     0,
+       7,     0,     7,     0,     5,     3,     3,     1,     7,     4,
+       1,     2,     3,     2,     1,     3,     1,     1,     3,     0,
+      11,     1,     2,     0,     2,     8,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     2,     2,     1,     2,     2,
+       1,     3,     1,     1,     1,     1,     1,     1,     3,     1,
+       3,     1,     4,     3,     4,     3,     3,     3,     3,     1,
+       1,     1,     3,     4,     4,     4,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     4,     2,     1,     3,     1,
+       1,     1,     1,     1,     1,     4,     6,     4,     6,     6,
+       6,     6,     2,     2,     1,     1,     2,     2,     1,     1,
+       2,     2,     5,     8,     6,     5,     8,     0,     2,     1,
+       1,     1,     1,     1,     1,     3,     1,     3,     1,     3,
+       1,     3,     1,     3,     3,     1,     3,     3,     1,     3,
+       3,     3,     3,     3,     3,     1,     3,     3,     3,     3,
+       1,     3,     3,     1,     1,     1,     1,     0,     1,     1,
+       3,     1,     2,     1,     3,     1,     1,     1,     3,     2,
+       1,     2,     2,     1,     2,     0,     2,     8,     7,     6,
+       8,     8,    10,     9,    10,     7,    10,     8,     4,     1,
+       3,     3,     1,     3,     0,     2,     5,     2,     3,     3,
+       3,     3,     2,     3,     2,     2,     2,     2,     0,     3,
+       3,     1,     1,     1,     1,     2,     3,     3,     1,     4,
+       0,     2,     2,     1,     3,     1,     2,     3,     3,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     4,     1,     1,
+       1,     2,     6,     4,     4,     0,     1,     1,     3,     1,
+       2,     2,     1,     3,     3,     5,     6,     5,     2,     4,
+       4,     3,     5,     5,     3,     5,     5,     5,     6,     0,
+       2,     1,     3,     1,     3,     3,     5,     6,     1,     4,
+       6,     6,    10,     4,     6,     6,    10,     5,     6,     6,
+       6,     6,     1,     2,     1,     2,     1,     2,     2,     3,
+       2,     3,     2,     3,     2,     3,     3,     4,     2,     2,
+       2,     3,     2,     3,     3,     3,     3,     2,     3,     2,
+       2,     3,     1,     2,     3,     4,     3,     1,     2,     1,
+       1,     3,     1,     2,     1,     1,     2,     3
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = BASICYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == BASICYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use BASICYYerror or BASICYYUNDEF. */
+#define YYERRCODE BASICYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if BASICYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !BASICYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !BASICYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = BASICYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == BASICYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= BASICYYEOF)
+    {
+      yychar = BASICYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == BASICYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = BASICYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = BASICYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 9: /* toplabel: "label"  */
+#line 610 "frontends/basic/basic.y"
+  {
+        AST *label = NewAST(AST_LABEL, (yyvsp[0].ast), NULL);
+        AST *stmt = NewAST(AST_STMTLIST, label, NULL);
+        current->body = AddToList(current->body, stmt);
+  }
+#line 3957 "build/basic.tab.c"
+    break;
+
+  case 10: /* topitem: %empty  */
+#line 620 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 3963 "build/basic.tab.c"
+    break;
+
+  case 11: /* topitem: statement  */
+#line 622 "frontends/basic/basic.y"
+    {
+        AST *stmtholder = NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL);
+        current->body = AddToList(current->body, stmtholder);
+        (yyval.ast) = stmtholder;
+    }
+#line 3973 "build/basic.tab.c"
+    break;
+
+  case 12: /* topitem: topdecl  */
+#line 628 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 3979 "build/basic.tab.c"
+    break;
+
+  case 13: /* topitem: "data"  */
+#line 630 "frontends/basic/basic.y"
+    {
+        AST *list = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+        current->bas_data = AddToListEx(current->bas_data, list, &current->bas_data_tail);
+    }
+#line 3988 "build/basic.tab.c"
+    break;
+
+  case 14: /* topitem: toplabel topitem  */
+#line 635 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 3996 "build/basic.tab.c"
+    break;
+
+  case 15: /* wrapped_stmt: statement  */
+#line 642 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL);
+    }
+#line 4004 "build/basic.tab.c"
+    break;
+
+  case 16: /* wrapped_stmt: "label" wrapped_stmt  */
+#line 646 "frontends/basic/basic.y"
+    {
+        AST *label = NewAST(AST_LABEL, (yyvsp[-1].ast), NULL);
+        (yyval.ast) = NewAST(AST_STMTLIST, label, (yyvsp[0].ast));
+    }
+#line 4013 "build/basic.tab.c"
+    break;
+
+  case 17: /* wrapped_stmt: "label" "end of line" wrapped_stmt  */
+#line 651 "frontends/basic/basic.y"
+    {
+        AST *label = NewAST(AST_LABEL, (yyvsp[-2].ast), NULL);
+        (yyval.ast) = NewAST(AST_STMTLIST, label, (yyvsp[0].ast));
+    }
+#line 4022 "build/basic.tab.c"
+    break;
+
+  case 18: /* optstatementlist: %empty  */
+#line 659 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 4028 "build/basic.tab.c"
+    break;
+
+  case 19: /* optstatementlist: statementlist  */
+#line 661 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4034 "build/basic.tab.c"
+    break;
+
+  case 20: /* stmtlistitem: wrapped_stmt  */
+#line 666 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4040 "build/basic.tab.c"
+    break;
+
+  case 21: /* stmtlistitem: dimension  */
+#line 668 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL); }
+#line 4046 "build/basic.tab.c"
+    break;
+
+  case 22: /* stmtlistitem: "label"  */
+#line 670 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_STMTLIST, NewAST(AST_LABEL, (yyvsp[0].ast), NULL), NULL); }
+#line 4052 "build/basic.tab.c"
+    break;
+
+  case 23: /* stmtlistitem: "label" dimension  */
+#line 672 "frontends/basic/basic.y"
+      {
+        AST *label = NewAST(AST_STMTLIST, NewAST(AST_LABEL, (yyvsp[-1].ast), NULL), NULL);
+        AST *dim = NewAST(AST_STMTLIST, (yyvsp[0].ast), label);
+        (yyval.ast) = dim;
+      }
+#line 4062 "build/basic.tab.c"
+    break;
+
+  case 24: /* statementlist: realstatementlist  */
+#line 681 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4068 "build/basic.tab.c"
+    break;
+
+  case 25: /* statementlist: eoln statementlist  */
+#line 683 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4074 "build/basic.tab.c"
+    break;
+
+  case 26: /* realstatementlist: stmtlistitem  */
+#line 688 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4080 "build/basic.tab.c"
+    break;
+
+  case 27: /* realstatementlist: stmtlistitem eoln optstatementlist  */
+#line 690 "frontends/basic/basic.y"
+    { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4086 "build/basic.tab.c"
+    break;
+
+  case 28: /* iflist: statement  */
+#line 695 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart(NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL)); }
+#line 4092 "build/basic.tab.c"
+    break;
+
+  case 29: /* iflist: iflist ':' statement  */
+#line 697 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL)); }
+#line 4098 "build/basic.tab.c"
+    break;
+
+  case 30: /* optelselist: "else" iflist  */
+#line 702 "frontends/basic/basic.y"
+     { (yyval.ast) = (yyvsp[0].list).head; }
+#line 4104 "build/basic.tab.c"
+    break;
+
+  case 31: /* optelselist: %empty  */
+#line 704 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 4110 "build/basic.tab.c"
+    break;
+
+  case 32: /* ifline: iflist optelselist  */
+#line 709 "frontends/basic/basic.y"
+     { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-1].list).head, (yyvsp[0].ast)); }
+#line 4116 "build/basic.tab.c"
+    break;
+
+  case 33: /* statement: assign_statement  */
+#line 714 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 4124 "build/basic.tab.c"
+    break;
+
+  case 34: /* statement: "identifier" np_exprlist  */
+#line 718 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = (yyvsp[0].ast);
+        (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-1].ast), params);
+    }
+#line 4134 "build/basic.tab.c"
+    break;
+
+  case 35: /* statement: "call" "identifier"  */
+#line 724 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = NULL;
+        (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[0].ast), params);
+    }
+#line 4144 "build/basic.tab.c"
+    break;
+
+  case 36: /* statement: "call" "identifier" '(' ')'  */
+#line 730 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = NULL;
+        (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-2].ast), params);
+    }
+#line 4154 "build/basic.tab.c"
+    break;
+
+  case 37: /* statement: "call" "identifier" '(' exprlist ')'  */
+#line 736 "frontends/basic/basic.y"
+    {
+        AST *params;
+        params = (yyvsp[-1].list).head;
+        (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-3].ast), params);
+    }
+#line 4164 "build/basic.tab.c"
+    break;
+
+  case 38: /* statement: "var" "identifier" '=' expr  */
+#line 742 "frontends/basic/basic.y"
+    {
+      AST *name = (yyvsp[-2].ast);
+      AST *assign = AstAssign(name, (yyvsp[0].ast));
+      assign = NewAST(AST_LISTHOLDER, assign, NULL);
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, NULL, assign);
+    }
+#line 4175 "build/basic.tab.c"
+    break;
+
+  case 39: /* statement: varexpr  */
+#line 749 "frontends/basic/basic.y"
+    {
+        AST *top = (yyvsp[0].ast);
+        AST *ast = top;
+        while (ast && ast->kind == AST_COMMENTEDNODE) {
+            ast = ast->left;
+        }
+        if (ast && ast->kind != AST_FUNCCALL) {
+            (yyval.ast) = NewAST(AST_FUNCCALL, ast, NULL);
+        } else {
+            (yyval.ast) = top;
+        }
+    }
+#line 4192 "build/basic.tab.c"
+    break;
+
+  case 40: /* statement: "delete" expr  */
+#line 762 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DELETE, (yyvsp[0].ast), NULL); }
+#line 4198 "build/basic.tab.c"
+    break;
+
+  case 41: /* statement: iostmt  */
+#line 764 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4204 "build/basic.tab.c"
+    break;
+
+  case 42: /* statement: branchstmt  */
+#line 766 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4210 "build/basic.tab.c"
+    break;
+
+  case 43: /* statement: ifstmt  */
+#line 768 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4216 "build/basic.tab.c"
+    break;
+
+  case 44: /* statement: whilestmt  */
+#line 770 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4222 "build/basic.tab.c"
+    break;
+
+  case 45: /* statement: doloopstmt  */
+#line 772 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4228 "build/basic.tab.c"
+    break;
+
+  case 46: /* statement: forstmt  */
+#line 774 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4234 "build/basic.tab.c"
+    break;
+
+  case 47: /* statement: trycatchstmt  */
+#line 776 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4240 "build/basic.tab.c"
+    break;
+
+  case 48: /* statement: selectstmt  */
+#line 778 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4246 "build/basic.tab.c"
+    break;
+
+  case 49: /* statement: asmstmt  */
+#line 780 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4252 "build/basic.tab.c"
+    break;
+
+  case 50: /* assignment_operator: '='  */
+#line 785 "frontends/basic/basic.y"
+            { (yyval.ast) = AstAssign(NULL, NULL); }
+#line 4258 "build/basic.tab.c"
+    break;
+
+  case 51: /* assignment_operator: "*="  */
+#line 787 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('*', NULL, NULL); }
+#line 4264 "build/basic.tab.c"
+    break;
+
+  case 52: /* assignment_operator: "/="  */
+#line 789 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('/', NULL, NULL); }
+#line 4270 "build/basic.tab.c"
+    break;
+
+  case 53: /* assignment_operator: "+="  */
+#line 791 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('+', NULL, NULL); }
+#line 4276 "build/basic.tab.c"
+    break;
+
+  case 54: /* assignment_operator: "-="  */
+#line 793 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('-', NULL, NULL); }
+#line 4282 "build/basic.tab.c"
+    break;
+
+  case 55: /* assignment_operator: "AND="  */
+#line 795 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('&', NULL, NULL); }
+#line 4288 "build/basic.tab.c"
+    break;
+
+  case 56: /* assignment_operator: "XOR="  */
+#line 797 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('^', NULL, NULL); }
+#line 4294 "build/basic.tab.c"
+    break;
+
+  case 57: /* assignment_operator: "OR="  */
+#line 799 "frontends/basic/basic.y"
+            { (yyval.ast) = AstOpAssign('|', NULL, NULL); }
+#line 4300 "build/basic.tab.c"
+    break;
+
+  case 58: /* varassignlist: varassigntarget ',' multivars  */
+#line 805 "frontends/basic/basic.y"
+      { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 4306 "build/basic.tab.c"
+    break;
+
+  case 59: /* multivars: varassigntarget  */
+#line 810 "frontends/basic/basic.y"
+      { (yyval.list) = ListBuilderStart(NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 4312 "build/basic.tab.c"
+    break;
+
+  case 60: /* multivars: multivars ',' varassigntarget  */
+#line 812 "frontends/basic/basic.y"
+      { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 4318 "build/basic.tab.c"
+    break;
+
+  case 61: /* simple_assign_statement: varexpr assignment_operator expr  */
+#line 818 "frontends/basic/basic.y"
+    {
+        AST *op = (yyvsp[-1].ast);
+        op->left = (yyvsp[-2].ast);
+        op->right = (yyvsp[0].ast);
+        (yyval.ast) = op;
+    }
+#line 4329 "build/basic.tab.c"
+    break;
+
+  case 62: /* simple_assign_statement: varassignlist '=' exprlist  */
+#line 825 "frontends/basic/basic.y"
+  {
+      (yyval.ast) = AstAssignList((yyvsp[-2].ast), (yyvsp[0].list).head, (yyvsp[-1].ast));
+  }
+#line 4337 "build/basic.tab.c"
+    break;
+
+  case 63: /* simple_assign_statement: register_expr '=' expr  */
+#line 829 "frontends/basic/basic.y"
+    {
+        AST *op = AstAssign(NULL, NULL);
+        op->left = (yyvsp[-2].ast);
+        op->right = (yyvsp[0].ast);
+        (yyval.ast) = op;
+    }
+#line 4348 "build/basic.tab.c"
+    break;
+
+  case 64: /* simple_assign_statement: register_expr '=' "input"  */
+#line 836 "frontends/basic/basic.y"
+    { (yyval.ast) = AstAssign((yyvsp[-2].ast), AstInteger(0)); }
+#line 4354 "build/basic.tab.c"
+    break;
+
+  case 65: /* simple_assign_statement: register_expr '=' "output"  */
+#line 838 "frontends/basic/basic.y"
+    { (yyval.ast) = AstAssign((yyvsp[-2].ast), AstInteger(-1)); }
+#line 4360 "build/basic.tab.c"
+    break;
+
+  case 66: /* assign_statement: simple_assign_statement  */
+#line 842 "frontends/basic/basic.y"
+    {
+        AST *assign = (yyvsp[0].ast);
+        AST *ident;
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->v.ptr);
+        if (0 == (explicit_flag & 0x1) ) {
+            ident = assign->left;
+            MaybeDeclareMemberVar(current, ident, NULL, 0, IMPLICIT_VAR, NULL);
+        }
+        (yyval.ast) = assign;
+    }
+#line 4376 "build/basic.tab.c"
+    break;
+
+  case 67: /* assign_statement: "let" simple_assign_statement  */
+#line 854 "frontends/basic/basic.y"
+    {
+        AST *assign = (yyvsp[0].ast);
+        AST *ident;
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->v.ptr);
+        if (0 == (explicit_flag & 0x2) ) {
+            ident = assign->left;
+            MaybeDeclareMemberVar(current, ident, NULL, 0, IMPLICIT_VAR, NULL);
+        }
+        (yyval.ast) = assign;
+    }
+#line 4392 "build/basic.tab.c"
+    break;
+
+  case 69: /* branchstmt: "return"  */
+#line 870 "frontends/basic/basic.y"
+    { (yyval.ast) = AstReturn(NULL, (yyvsp[0].ast)); }
+#line 4398 "build/basic.tab.c"
+    break;
+
+  case 70: /* branchstmt: "return" exprlist  */
+#line 872 "frontends/basic/basic.y"
+    { (yyval.ast) = AstReturn((yyvsp[0].list).head, (yyvsp[-1].ast)); }
+#line 4404 "build/basic.tab.c"
+    break;
+
+  case 71: /* branchstmt: "label:"  */
+#line 874 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_LABEL, (yyvsp[0].ast), NULL); }
+#line 4410 "build/basic.tab.c"
+    break;
+
+  case 72: /* branchstmt: "goto" "identifier"  */
+#line 876 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GOTO, (yyvsp[0].ast), NULL); }
+#line 4416 "build/basic.tab.c"
+    break;
+
+  case 73: /* branchstmt: "goto" "integer number"  */
+#line 878 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GOTO, IntegerLabel((yyvsp[0].ast)), NULL); }
+#line 4422 "build/basic.tab.c"
+    break;
+
+  case 74: /* branchstmt: "gosub" "identifier"  */
+#line 880 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GOSUB, (yyvsp[0].ast), NULL); }
+#line 4428 "build/basic.tab.c"
+    break;
+
+  case 75: /* branchstmt: "gosub" "integer number"  */
+#line 882 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GOSUB, IntegerLabel((yyvsp[0].ast)), NULL); }
+#line 4434 "build/basic.tab.c"
+    break;
+
+  case 76: /* branchstmt: "throw" expr  */
+#line 884 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_THROW, (yyvsp[0].ast), NULL, (yyvsp[-1].ast));
+    }
+#line 4442 "build/basic.tab.c"
+    break;
+
+  case 77: /* branchstmt: "throwifcaught" expr  */
+#line 888 "frontends/basic/basic.y"
+    {
+        AST *top = NewCommentedAST(AST_THROW, (yyvsp[0].ast), NULL, (yyvsp[-1].ast));
+        AST *throwit;
+        if (top && top->kind != AST_THROW) {
+            throwit = top->left;
+        } else {
+            throwit = top;
+        }
+        throwit->d.ival = 1;
+        (yyval.ast) = top;
+    }
+#line 4458 "build/basic.tab.c"
+    break;
+
+  case 80: /* file_handle: %empty  */
+#line 904 "frontends/basic/basic.y"
+   { (yyval.ast) = NULL; }
+#line 4464 "build/basic.tab.c"
+    break;
+
+  case 81: /* file_handle: '#' expr optcomma  */
+#line 906 "frontends/basic/basic.y"
+   { (yyval.ast) = (yyvsp[-1].ast); }
+#line 4470 "build/basic.tab.c"
+    break;
+
+  case 82: /* iostmt: "print" file_handle printlist  */
+#line 911 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_PRINT, (yyvsp[0].ast), (yyvsp[-1].ast), (yyvsp[-2].ast)); }
+#line 4476 "build/basic.tab.c"
+    break;
+
+  case 83: /* iostmt: "print" file_handle ',' printlist  */
+#line 913 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_PRINT, (yyvsp[0].ast), (yyvsp[-2].ast), (yyvsp[-3].ast)); }
+#line 4482 "build/basic.tab.c"
+    break;
+
+  case 84: /* iostmt: "line" "input" file_handle varexpr  */
+#line 915 "frontends/basic/basic.y"
+    {
+        AST *handle = InputHandle((yyvsp[-1].ast));
+        AST *var = (yyvsp[0].ast);
+        AST *readit = NewAST(AST_FUNCCALL,
+                             AstIdentifier("_basic_read_line"),
+                             NewAST(AST_EXPRLIST, handle, NULL));
+        (yyval.ast) = AstAssign(var, readit);
+    }
+#line 4495 "build/basic.tab.c"
+    break;
+
+  case 85: /* iostmt: "input" file_handle inputlist  */
+#line 924 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_READ, (yyvsp[0].list).head, InputHandle((yyvsp[-1].ast)), (yyvsp[-2].ast)); }
+#line 4501 "build/basic.tab.c"
+    break;
+
+  case 86: /* iostmt: "input" file_handle "literal string" ',' inputlist  */
+#line 926 "frontends/basic/basic.y"
+    {
+        AST *inhandle = InputHandle((yyvsp[-3].ast));
+        AST *outhandle = OutputHandle((yyvsp[-3].ast));
+        AST *string = NewAST(AST_STRINGPTR,
+                             NewAST(AST_EXPRLIST, (yyvsp[-2].ast), NULL), NULL);
+        AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
+        AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, (yyvsp[-4].ast));
+        AST *inpstmt = NewAST(AST_READ, (yyvsp[0].list).head, inhandle);
+        AST *stmt;
+        stmt = NewAST(AST_STMTLIST,
+                      printstmt,
+                      NewAST(AST_STMTLIST, inpstmt, NULL));
+        (yyval.ast) = stmt;
+    }
+#line 4520 "build/basic.tab.c"
+    break;
+
+  case 87: /* iostmt: "input" file_handle "literal string" ';' inputlist  */
+#line 941 "frontends/basic/basic.y"
+    {
+        AST *inhandle = InputHandle((yyvsp[-3].ast));
+        AST *outhandle = InputHandle((yyvsp[-3].ast));
+        AST *question = NewAST(AST_EXPRLIST,
+                               AstInteger(63),
+                               NewAST(AST_EXPRLIST, AstInteger(32), NULL));
+        AST *string = NewAST(AST_STRINGPTR,
+                             NewAST(AST_EXPRLIST, (yyvsp[-2].ast), question), NULL);
+        AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
+        AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, (yyvsp[-4].ast));
+        AST *inpstmt = NewAST(AST_READ, (yyvsp[0].list).head, inhandle);
+        AST *stmt;
+        stmt = NewAST(AST_STMTLIST,
+                      printstmt,
+                      NewAST(AST_STMTLIST, inpstmt, NULL));
+        (yyval.ast) = stmt;
+    }
+#line 4542 "build/basic.tab.c"
+    break;
+
+  case 88: /* iostmt: "read" inputlist  */
+#line 959 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_READ, (yyvsp[0].list).head, NULL, (yyvsp[-1].ast)); }
+#line 4548 "build/basic.tab.c"
+    break;
+
+  case 89: /* iostmt: "restore"  */
+#line 961 "frontends/basic/basic.y"
+    {
+      AST *varname = AstIdentifier("__basic_data_ptr");
+      AST *labelref = AstIdentifier("__basic_data");
+      AST *init;
+      init = AstAssign(varname, NewAST(AST_ADDROF, labelref, NULL));
+      (yyval.ast) = init;
+    }
+#line 4560 "build/basic.tab.c"
+    break;
+
+  case 90: /* iostmt: "open" expr "as" '#' expr  */
+#line 969 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open"),
+                NewAST(AST_EXPRLIST, (yyvsp[0].ast),
+                       NewAST(AST_EXPRLIST, (yyvsp[-3].ast), NULL)), (yyvsp[-4].ast));
+    }
+#line 4571 "build/basic.tab.c"
+    break;
+
+  case 91: /* iostmt: "open" expr "for" "input" "as" '#' expr  */
+#line 976 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, (yyvsp[0].ast),
+                       NewAST(AST_EXPRLIST, (yyvsp[-5].ast),
+                              /* mode 0 is O_RDONLY */
+                              NewAST(AST_EXPRLIST, AstInteger(0), NULL))), (yyvsp[-6].ast));
+    }
+#line 4584 "build/basic.tab.c"
+    break;
+
+  case 92: /* iostmt: "open" expr "for" "output" "as" '#' expr  */
+#line 985 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, (yyvsp[0].ast),
+                       NewAST(AST_EXPRLIST, (yyvsp[-5].ast),
+                              /* mode is O_WRONLY | O_CREAT | O_TRUNC */
+                              NewAST(AST_EXPRLIST, AstInteger(1 + 4 + 8), NULL))), (yyvsp[-6].ast));
+    }
+#line 4597 "build/basic.tab.c"
+    break;
+
+  case 93: /* iostmt: "open" expr "for" "append" "as" '#' expr  */
+#line 994 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                AstIdentifier("_basic_open_string"),
+                NewAST(AST_EXPRLIST, (yyvsp[0].ast),
+                       NewAST(AST_EXPRLIST, (yyvsp[-5].ast),
+                              /* mode is O_WRONLY | O_CREAT | O_APPEND */
+                              NewAST(AST_EXPRLIST, AstInteger(1 + 4 + 32), NULL))), (yyvsp[-6].ast));
+    }
+#line 4610 "build/basic.tab.c"
+    break;
+
+  case 94: /* iostmt: "close" '#' expr  */
+#line 1003 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_basic_close"),
+                             NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL), (yyvsp[-2].ast));
+    }
+#line 4620 "build/basic.tab.c"
+    break;
+
+  case 95: /* iostmt: "chain" '#' "integer number" chain_args  */
+#line 1009 "frontends/basic/basic.y"
+    {
+        AST *args = (yyvsp[0].ast);
+        AST *handle = (yyvsp[-1].ast);
+        args = NewAST(AST_EXPRLIST, AstStringPtr("arg0"), args);
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_fexecl"),
+                             NewAST(AST_EXPRLIST, handle, args), (yyvsp[-3].ast));
+    }
+#line 4633 "build/basic.tab.c"
+    break;
+
+  case 96: /* iostmt: "chain" "literal string" chain_args  */
+#line 1018 "frontends/basic/basic.y"
+    {
+        AST *args = (yyvsp[0].ast);
+        AST *name = NewAST(AST_STRINGPTR, NewAST(AST_EXPRLIST, (yyvsp[-1].ast), NULL), NULL);
+        // add a dummy program name
+        args = NewAST(AST_EXPRLIST, AstStringPtr("arg0"), args);
+        (yyval.ast) = NewCommentedAST(AST_FUNCCALL,
+                    AstIdentifier("_execl"),
+                             NewAST(AST_EXPRLIST, name, args), (yyvsp[-2].ast));
+    }
+#line 4647 "build/basic.tab.c"
+    break;
+
+  case 97: /* iostmt: "get" '#' putgetargs  */
+#line 1028 "frontends/basic/basic.y"
+    {
+        AST *params = (yyvsp[0].ast);
+        AST *thefunc = AstIdentifier("_basic_get");
+        AST *result = NULL;
+        AST *call;
+        AST *comment = (yyvsp[-2].ast);
+        if (params && params->kind == AST_ASSIGN) {
+            result = params->left;
+            params = params->right;
+        }
+        call = NewAST(AST_FUNCCALL, thefunc, params);
+        if (result) {
+            call = AstAssign(result, call);
+        }
+        if (comment) {
+            call = NewAST(AST_COMMENTEDNODE, call, comment);
+        }
+        (yyval.ast) = call;
+    }
+#line 4671 "build/basic.tab.c"
+    break;
+
+  case 98: /* iostmt: "put" '#' putgetargs  */
+#line 1048 "frontends/basic/basic.y"
+    {
+        AST *params = (yyvsp[0].ast);
+        AST *thefunc = AstIdentifier("_basic_put");
+        AST *result = NULL;
+        AST *call;
+        AST *comment = (yyvsp[-2].ast);
+        if (params && params->kind == AST_ASSIGN) {
+            result = params->left;
+            params = params->right;
+        }
+        call = NewAST(AST_FUNCCALL, thefunc, params);
+        if (result) {
+            call = AstAssign(result, call);
+        }
+        if (comment) {
+            call = NewAST(AST_COMMENTEDNODE, call, comment);
+        }
+        (yyval.ast) = call;
+    }
+#line 4695 "build/basic.tab.c"
+    break;
+
+  case 99: /* chain_args: %empty  */
+#line 1071 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, AstInteger(0), NULL); }
+#line 4701 "build/basic.tab.c"
+    break;
+
+  case 100: /* chain_args: ',' expr chain_args  */
+#line 1073 "frontends/basic/basic.y"
+    {
+      AST *item = (yyvsp[-1].ast);
+      AST *endl = (yyvsp[0].ast);
+      (yyval.ast) = NewAST(AST_EXPRLIST, item, endl);
+    }
+#line 4711 "build/basic.tab.c"
+    break;
+
+  case 101: /* inputitem: varexpr  */
+#line 1082 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetExplicitDeclares();
+        int explicit_flag = EvalConstExpr((AST *)sym->v.ptr);
+        if (0 == (explicit_flag & 0x4)) {
+            MaybeDeclareMemberVar(current, (yyvsp[0].ast), NULL, 0, IMPLICIT_VAR, NULL);
+        }
+        (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+    }
+#line 4724 "build/basic.tab.c"
+    break;
+
+  case 102: /* inputlist: inputitem  */
+#line 1094 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 4730 "build/basic.tab.c"
+    break;
+
+  case 103: /* inputlist: inputlist ',' inputitem  */
+#line 1096 "frontends/basic/basic.y"
+    {
+        (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast));
+    }
+#line 4738 "build/basic.tab.c"
+    break;
+
+  case 104: /* printitem: expr  */
+#line 1103 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 4744 "build/basic.tab.c"
+    break;
+
+  case 105: /* printitem: '\\' expr  */
+#line 1105 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_CHAR, (yyvsp[0].ast), NULL), NULL); }
+#line 4750 "build/basic.tab.c"
+    break;
+
+  case 106: /* rawprintlist: printitem  */
+#line 1110 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 4756 "build/basic.tab.c"
+    break;
+
+  case 107: /* rawprintlist: rawprintlist ';' printitem  */
+#line 1112 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 4762 "build/basic.tab.c"
+    break;
+
+  case 108: /* rawprintlist: rawprintlist ',' printitem  */
+#line 1114 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd(ListBuilderAdd((yyvsp[-2].list), AstCharItem('\t')), (yyvsp[0].ast)); }
+#line 4768 "build/basic.tab.c"
+    break;
+
+  case 109: /* usingprintlist: printitem  */
+#line 1119 "frontends/basic/basic.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 4774 "build/basic.tab.c"
+    break;
+
+  case 110: /* usingprintlist: usingprintlist ';' printitem  */
+#line 1121 "frontends/basic/basic.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 4780 "build/basic.tab.c"
+    break;
+
+  case 111: /* usingprintlist: usingprintlist ',' printitem  */
+#line 1123 "frontends/basic/basic.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 4786 "build/basic.tab.c"
+    break;
+
+  case 112: /* printlist: %empty  */
+#line 1128 "frontends/basic/basic.y"
+    { (yyval.ast) = AstCharItem('\n'); }
+#line 4792 "build/basic.tab.c"
+    break;
+
+  case 113: /* printlist: rawprintlist  */
+#line 1130 "frontends/basic/basic.y"
+    { (yyval.ast) = ListBuilderAdd((yyvsp[0].list), AstCharItem('\n')).head; }
+#line 4798 "build/basic.tab.c"
+    break;
+
+  case 114: /* printlist: rawprintlist ','  */
+#line 1132 "frontends/basic/basic.y"
+    { (yyval.ast) = ListBuilderAdd((yyvsp[-1].list), AstCharItem('\t')).head; }
+#line 4804 "build/basic.tab.c"
+    break;
+
+  case 115: /* printlist: rawprintlist ';'  */
+#line 1134 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[-1].list).head; }
+#line 4810 "build/basic.tab.c"
+    break;
+
+  case 116: /* printlist: "using" "literal string" ';' usingprintlist  */
+#line 1136 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_USING, (yyvsp[-2].ast), ListBuilderAdd((yyvsp[0].list), AstCharItem('\n')).head); }
+#line 4816 "build/basic.tab.c"
+    break;
+
+  case 117: /* printlist: "using" "literal string" ';' usingprintlist ';'  */
+#line 1138 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_USING, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 4822 "build/basic.tab.c"
+    break;
+
+  case 118: /* putgetargs: expritem ',' optzeroexpritem ',' expr  */
+#line 1147 "frontends/basic/basic.y"
+  {
+      AST *filenum = (yyvsp[-4].ast);
+      AST *position = (yyvsp[-2].ast);
+      AST *data = (yyvsp[0].ast);
+      AST *amount = AstInteger(1);
+      AST *size = NewAST(AST_SIZEOF, data, NULL);
+
+      amount = NewAST(AST_EXPRLIST, amount, NULL);
+      size = NewAST(AST_EXPRLIST, size, NULL);
+      data = NewAST(AST_ADDROF, data, NULL);
+      data = NewAST(AST_EXPRLIST, data, NULL);
+      amount->right = size;
+      data->right = amount;
+      position->right = data;
+      filenum->right = position;
+      (yyval.ast) = filenum;
+  }
+#line 4844 "build/basic.tab.c"
+    break;
+
+  case 119: /* putgetargs: expritem ',' optzeroexpritem ',' expr ',' expritem optvar  */
+#line 1165 "frontends/basic/basic.y"
+  {
+      AST *filenum = (yyvsp[-7].ast);
+      AST *position = (yyvsp[-5].ast);
+      AST *data = (yyvsp[-3].ast);
+      AST *amount = (yyvsp[-1].ast);
+      AST *var = (yyvsp[0].ast);
+      AST *size = NewAST(AST_SIZEOF, data, NULL);
+      size = NewAST(AST_EXPRLIST, size, NULL);
+      
+      data = NewAST(AST_ADDROF, data, NULL);
+      data = NewAST(AST_EXPRLIST, data, NULL);
+      amount->right = size;
+      data->right = amount;
+      position->right = data;
+      filenum->right = position;
+
+      if (var) {
+          filenum = AstAssign(var, filenum);
+      }
+      (yyval.ast) = filenum;
+  }
+#line 4870 "build/basic.tab.c"
+    break;
+
+  case 120: /* optzeroexpritem: %empty  */
+#line 1190 "frontends/basic/basic.y"
+    {
+        AST *zero = AstInteger(0);
+        (yyval.ast) = NewAST(AST_EXPRLIST, zero, NULL);
+    }
+#line 4879 "build/basic.tab.c"
+    break;
+
+  case 121: /* optzeroexpritem: expritem  */
+#line 1195 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4885 "build/basic.tab.c"
+    break;
+
+  case 122: /* optvar: %empty  */
+#line 1200 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NULL;
+    }
+#line 4893 "build/basic.tab.c"
+    break;
+
+  case 123: /* optvar: ',' expr  */
+#line 1204 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 4899 "build/basic.tab.c"
+    break;
+
+  case 124: /* ifstmt: "if" expr "then" eoln thenelseblock  */
+#line 1210 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_IF, (yyvsp[-3].ast), (yyvsp[0].ast), (yyvsp[-4].ast));
+    }
+#line 4907 "build/basic.tab.c"
+    break;
+
+  case 125: /* ifstmt: "if" expr "then" "integer number"  */
+#line 1214 "frontends/basic/basic.y"
+    {
+        AST *stmtlist = NewCommentedStatement(
+            NewAST(AST_GOTO, IntegerLabel((yyvsp[0].ast)), NULL));
+        AST *elseblock = NewAST(AST_THENELSE, stmtlist, NULL);
+        (yyval.ast) = NewCommentedAST(AST_IF, (yyvsp[-2].ast), elseblock, (yyvsp[-3].ast));
+    }
+#line 4918 "build/basic.tab.c"
+    break;
+
+  case 126: /* ifstmt: "if" expr statement  */
+#line 1221 "frontends/basic/basic.y"
+    {
+        AST *condition = (yyvsp[-1].ast);
+        AST *stmtlist = NewCommentedStatement((yyvsp[0].ast));
+        AST *elseblock = NewAST(AST_THENELSE, stmtlist, NULL);
+        (yyval.ast) = NewCommentedAST(AST_IF, condition, elseblock, (yyvsp[-2].ast));
+    }
+#line 4929 "build/basic.tab.c"
+    break;
+
+  case 127: /* ifstmt: "if" expr "then" ifline  */
+#line 1228 "frontends/basic/basic.y"
+    {
+        AST *elseblock = (yyvsp[0].ast);
+        (yyval.ast) = NewCommentedAST(AST_IF, (yyvsp[-2].ast), elseblock, (yyvsp[-3].ast));
+    }
+#line 4938 "build/basic.tab.c"
+    break;
+
+  case 128: /* thenelseblock: optstatementlist endif  */
+#line 1236 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-1].ast), NULL); }
+#line 4944 "build/basic.tab.c"
+    break;
+
+  case 129: /* thenelseblock: optstatementlist "else" eoln optstatementlist endif  */
+#line 1238 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-4].ast), (yyvsp[-1].ast)); }
+#line 4950 "build/basic.tab.c"
+    break;
+
+  case 130: /* thenelseblock: optstatementlist "else" statement  */
+#line 1240 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-2].ast), NewCommentedStatement((yyvsp[0].ast))); }
+#line 4956 "build/basic.tab.c"
+    break;
+
+  case 134: /* $@1: %empty  */
+#line 1250 "frontends/basic/basic.y"
+                        { PushLoop(BAS_WHILE); }
+#line 4962 "build/basic.tab.c"
+    break;
+
+  case 135: /* whilestmt: "while" expr eoln $@1 optstatementlist endwhile  */
+#line 1251 "frontends/basic/basic.y"
+    { AST *body = CheckYield((yyvsp[-1].ast));
+      (yyval.ast) = NewCommentedAST(AST_WHILE, (yyvsp[-4].ast), body, (yyvsp[-5].ast));
+      PopLoop();
+    }
+#line 4971 "build/basic.tab.c"
+    break;
+
+  case 139: /* $@2: %empty  */
+#line 1264 "frontends/basic/basic.y"
+                             { PushLoop(BAS_DO); }
+#line 4977 "build/basic.tab.c"
+    break;
+
+  case 140: /* doloopstmt: "do" "while" expr eoln $@2 optstatementlist "loop"  */
+#line 1265 "frontends/basic/basic.y"
+    { AST *body = CheckYield((yyvsp[-1].ast));
+      AST *cond = (yyvsp[-4].ast);
+      (yyval.ast) = NewCommentedAST(AST_WHILE, cond, body, (yyvsp[-6].ast));
+      PopLoop();
+    }
+#line 4987 "build/basic.tab.c"
+    break;
+
+  case 141: /* $@3: %empty  */
+#line 1270 "frontends/basic/basic.y"
+                               {PushLoop(BAS_DO); }
+#line 4993 "build/basic.tab.c"
+    break;
+
+  case 142: /* doloopstmt: "do" "until" expr eoln $@3 optstatementlist "loop"  */
+#line 1271 "frontends/basic/basic.y"
+    { AST *body = CheckYield((yyvsp[-1].ast));
+      AST *cond = AstOperator(K_BOOL_NOT, NULL, (yyvsp[-4].ast));
+      (yyval.ast) = NewCommentedAST(AST_WHILE, cond, body, (yyvsp[-6].ast));
+      PopLoop();
+    }
+#line 5003 "build/basic.tab.c"
+    break;
+
+  case 143: /* $@4: %empty  */
+#line 1276 "frontends/basic/basic.y"
+                {PushLoop(BAS_DO); }
+#line 5009 "build/basic.tab.c"
+    break;
+
+  case 144: /* doloopstmt: "do" eoln $@4 optstatementlist doloopend  */
+#line 1277 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_DOWHILE, (yyvsp[0].ast), CheckYield((yyvsp[-1].ast)), (yyvsp[-4].ast));
+        PopLoop();
+    }
+#line 5018 "build/basic.tab.c"
+    break;
+
+  case 145: /* doloopend: "loop" "while" expr  */
+#line 1285 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5024 "build/basic.tab.c"
+    break;
+
+  case 146: /* doloopend: "loop" "until" expr  */
+#line 1287 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_BOOL_NOT, NULL, (yyvsp[0].ast)); }
+#line 5030 "build/basic.tab.c"
+    break;
+
+  case 147: /* doloopend: "loop"  */
+#line 1289 "frontends/basic/basic.y"
+    { (yyval.ast) = AstInteger(1); }
+#line 5036 "build/basic.tab.c"
+    break;
+
+  case 148: /* selectstmt: "select" "case" expr eoln casematchlist "end" "select"  */
+#line 1294 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_CASE, (yyvsp[-4].ast), (yyvsp[-2].list).head, (yyvsp[-6].ast)); }
+#line 5042 "build/basic.tab.c"
+    break;
+
+  case 149: /* selectstmt: "on" expr "goto" exprlist  */
+#line 1296 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_CASETABLE, (yyvsp[-2].ast), BuildOnGotoCases((yyvsp[0].list).head), (yyvsp[-3].ast)); }
+#line 5048 "build/basic.tab.c"
+    break;
+
+  case 150: /* casematchlist: casematchitem  */
+#line 1301 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 5054 "build/basic.tab.c"
+    break;
+
+  case 151: /* casematchlist: casematchlist casematchitem  */
+#line 1303 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 5060 "build/basic.tab.c"
+    break;
+
+  case 152: /* casematchitem: casematch eoln optstatementlist  */
+#line 1308 "frontends/basic/basic.y"
+    {
+        AST *expr = (yyvsp[-2].ast);
+        AST *stmts = (yyvsp[0].ast);
+        AST *firststmt;
+        AST *breakstmt = NewAST(AST_ENDCASE, NULL, NULL);
+        stmts = AddToList(stmts, NewAST(AST_STMTLIST, breakstmt, NULL));
+        firststmt = stmts->left;
+        if (expr->kind == AST_OTHER) {
+            stmts->left = NewAST(AST_OTHER, firststmt, NULL);
+        } else {
+            stmts->left = NewAST(AST_CASEITEM, expr, firststmt);
+        }
+        (yyval.ast) = stmts;
+    }
+#line 5079 "build/basic.tab.c"
+    break;
+
+  case 153: /* casematch: "case" caselist  */
+#line 1326 "frontends/basic/basic.y"
+    {  (yyval.ast) = (yyvsp[0].list).head; }
+#line 5085 "build/basic.tab.c"
+    break;
+
+  case 154: /* caseitem: expr  */
+#line 1331 "frontends/basic/basic.y"
+    {  (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 5091 "build/basic.tab.c"
+    break;
+
+  case 155: /* caseitem: expr "to" expr  */
+#line 1333 "frontends/basic/basic.y"
+    {  (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, (yyvsp[-2].ast), (yyvsp[0].ast)), NULL); }
+#line 5097 "build/basic.tab.c"
+    break;
+
+  case 156: /* caseitem: "else"  */
+#line 1335 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_OTHER, NULL, NULL); }
+#line 5103 "build/basic.tab.c"
+    break;
+
+  case 157: /* caselist: caseitem  */
+#line 1340 "frontends/basic/basic.y"
+    {  (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 5109 "build/basic.tab.c"
+    break;
+
+  case 158: /* caselist: caselist ',' caseitem  */
+#line 1342 "frontends/basic/basic.y"
+    {  (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 5115 "build/basic.tab.c"
+    break;
+
+  case 159: /* $@5: %empty  */
+#line 1350 "frontends/basic/basic.y"
+            { PushLoop(BAS_FOR); }
+#line 5121 "build/basic.tab.c"
+    break;
+
+  case 160: /* forstmt: "for" $@5 "identifier" '=' expr "to" expr optstep eoln optstatementlist endfor  */
+#line 1351 "frontends/basic/basic.y"
+    {
+      AST *from, *to, *step;
+      AST *ident = (yyvsp[-8].ast);
+      AST *closeident = (yyvsp[0].ast);
+      AST *declare;
+      AST *loop;
+      Symbol *sym = GetExplicitDeclares();
+      int explicit_flag = EvalConstExpr((AST *)sym->v.ptr);
+
+      if (0 == (explicit_flag & 0x8)) {
+          /* create a WEAK definition for ident (it will not override any existing definition) */
+          declare = NewAST(AST_DECLARE_VAR_WEAK, InferTypeFromName(ident), ident);
+      } else {
+          declare = 0;
+      }
+      step = NewAST(AST_STEP, (yyvsp[-3].ast), (yyvsp[-1].ast));
+      to = NewAST(AST_TO, (yyvsp[-4].ast), step);
+      from = NewAST(AST_FROM, (yyvsp[-6].ast), to);
+      loop = NewCommentedAST(AST_COUNTREPEAT, (yyvsp[-8].ast), from, (yyvsp[-10].ast));
+      // validate the "next i"
+      if (closeident && !AstMatch(ident, closeident)) {
+          SETCOLOR(PRINT_ERROR);
+          ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+          fprintf(stderr, "Wrong variable in next: expected %s, saw %s\n", ident->d.string, closeident->d.string);
+          gl_errors++;
+          RESETCOLOR();
+      }
+      loop = NewAST(AST_STMTLIST, loop, NULL);
+      if (declare) {
+          loop = NewAST(AST_STMTLIST, declare,
+                        NewAST(AST_STMTLIST, loop, NULL));
+      }
+      (yyval.ast) = loop;
+      PopLoop();
+    }
+#line 5161 "build/basic.tab.c"
+    break;
+
+  case 161: /* endfor: "next"  */
+#line 1390 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 5167 "build/basic.tab.c"
+    break;
+
+  case 162: /* endfor: "next" "identifier"  */
+#line 1392 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5173 "build/basic.tab.c"
+    break;
+
+  case 163: /* optstep: %empty  */
+#line 1397 "frontends/basic/basic.y"
+    { (yyval.ast) = AstInteger(1); }
+#line 5179 "build/basic.tab.c"
+    break;
+
+  case 164: /* optstep: "step" expr  */
+#line 1399 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5185 "build/basic.tab.c"
+    break;
+
+  case 165: /* trycatchstmt: "try" eoln statementlist "catch" "identifier" eoln statementlist endtry  */
+#line 1404 "frontends/basic/basic.y"
+  {
+      AST *tryblock = (yyvsp[-5].ast);
+      AST *catchvar = (yyvsp[-3].ast);
+      AST *catchblock = (yyvsp[-1].ast);
+      AST *try_if;
+      AST *trytest;
+
+      catchblock = NewAST(AST_STMTLIST,
+                          AstAssign(catchvar, NewAST(AST_CATCHRESULT, NULL, NULL)),
+                          catchblock);
+      trytest = NewAST(AST_SETJMP, NULL, NULL);
+      try_if = NewAST(AST_IF,
+                      AstOperator(K_EQ, trytest, AstInteger(0)),
+                      NewAST(AST_THENELSE, tryblock, catchblock));
+      try_if = NewCommentedStatement(try_if);
+      
+      (yyval.ast) = NewAST(AST_TRYENV, try_if, NULL);
+  }
+#line 5208 "build/basic.tab.c"
+    break;
+
+  case 167: /* exitstmt: "exit" "function"  */
+#line 1430 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_RETURN, NULL, NULL); }
+#line 5214 "build/basic.tab.c"
+    break;
+
+  case 168: /* exitstmt: "exit" "sub"  */
+#line 1432 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_RETURN, NULL, NULL); }
+#line 5220 "build/basic.tab.c"
+    break;
+
+  case 169: /* exitstmt: "exit" "for"  */
+#line 1434 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_FOR);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit for' is not inside a for loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 5235 "build/basic.tab.c"
+    break;
+
+  case 170: /* exitstmt: "exit" "while"  */
+#line 1445 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_WHILE);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit while' is not inside a while loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 5250 "build/basic.tab.c"
+    break;
+
+  case 171: /* exitstmt: "exit" "do"  */
+#line 1456 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit do' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 5265 "build/basic.tab.c"
+    break;
+
+  case 172: /* exitstmt: "exit" "loop"  */
+#line 1467 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit loop' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 5280 "build/basic.tab.c"
+    break;
+
+  case 173: /* exitstmt: "exit"  */
+#line 1478 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(0);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'exit' is not inside a loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_QUITLOOP, modifier, NULL);
+    }
+#line 5295 "build/basic.tab.c"
+    break;
+
+  case 174: /* exitstmt: "continue" "for"  */
+#line 1489 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_FOR);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue for' is not inside a for loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 5310 "build/basic.tab.c"
+    break;
+
+  case 175: /* exitstmt: "continue" "while"  */
+#line 1500 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_WHILE);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue while' is not inside a while loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 5325 "build/basic.tab.c"
+    break;
+
+  case 176: /* exitstmt: "continue" "do"  */
+#line 1511 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(BAS_DO);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue do' is not inside a do loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 5340 "build/basic.tab.c"
+    break;
+
+  case 177: /* exitstmt: "continue"  */
+#line 1522 "frontends/basic/basic.y"
+    {
+        int curLoop = GetCurrentLoop(0);
+        AST *modifier = NULL;
+        if (!curLoop) {
+            SYNTAX_ERROR("'continue' is not inside a loop");
+        } else {
+            modifier = AstInteger(curLoop);
+        }
+        (yyval.ast) = NewAST(AST_CONTINUE, modifier, NULL);
+    }
+#line 5355 "build/basic.tab.c"
+    break;
+
+  case 178: /* topdecl: "defsng" deflist  */
+#line 1536 "frontends/basic/basic.y"
+    {
+      (yyval.ast) = DefineDefaultVarTypes((yyvsp[0].ast), ast_type_float);
+    }
+#line 5363 "build/basic.tab.c"
+    break;
+
+  case 179: /* topdecl: "defint" deflist  */
+#line 1540 "frontends/basic/basic.y"
+    {
+      (yyval.ast) = DefineDefaultVarTypes((yyvsp[0].ast), ast_type_long);
+    }
+#line 5371 "build/basic.tab.c"
+    break;
+
+  case 180: /* topdecl: dimension  */
+#line 1544 "frontends/basic/basic.y"
+    {
+        AST *ast = (yyvsp[0].ast);
+        if (ast->kind == AST_GLOBALVARS) {
+            DeclareBASICSharedVariables(ast->left);
+        } else if (ast->kind == AST_REGISTERVARS) {
+            DeclareBASICRegisterVariables(ast->left);
+        } else {
+            DeclareBASICMemberVariables(ast);
+        }
+    }
+#line 5386 "build/basic.tab.c"
+    break;
+
+  case 181: /* topdecl: "option" "identifier" optexprlist  */
+#line 1555 "frontends/basic/basic.y"
+    {
+      (yyval.ast) = HandleBASICOption((yyvsp[-1].ast), (yyvsp[0].ast));
+    }
+#line 5394 "build/basic.tab.c"
+    break;
+
+  case 188: /* defitem: "identifier" '-' "identifier"  */
+#line 1568 "frontends/basic/basic.y"
+     { (yyval.ast) = NewAST(AST_SEQUENCE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5400 "build/basic.tab.c"
+    break;
+
+  case 189: /* deflist: defitem  */
+#line 1573 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 5406 "build/basic.tab.c"
+    break;
+
+  case 190: /* deflist: deflist ',' defitem  */
+#line 1575 "frontends/basic/basic.y"
+    {
+        AST *list = (yyvsp[-2].ast);
+        AST *item = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+        (yyval.ast) = AddToListEx(list, item, (AST **)&list->d.ptr);
+    }
+#line 5416 "build/basic.tab.c"
+    break;
+
+  case 191: /* varexpr: "identifier"  */
+#line 1584 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5422 "build/basic.tab.c"
+    break;
+
+  case 192: /* varexpr: "identifier" '[' expr ']'  */
+#line 1586 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 5428 "build/basic.tab.c"
+    break;
+
+  case 193: /* varexpr: varexpr '(' ')'  */
+#line 1588 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-2].ast), NULL); }
+#line 5434 "build/basic.tab.c"
+    break;
+
+  case 194: /* varexpr: varexpr '(' exprlist ')'  */
+#line 1590 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 5440 "build/basic.tab.c"
+    break;
+
+  case 195: /* varexpr: varexpr '.' "identifier"  */
+#line 1592 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_METHODREF, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5446 "build/basic.tab.c"
+    break;
+
+  case 196: /* varexpr: varexpr '.' "program"  */
+#line 1594 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_METHODREF, (yyvsp[-2].ast), AstIdentifier("program")); }
+#line 5452 "build/basic.tab.c"
+    break;
+
+  case 197: /* varexpr: basetypename '.' "identifier"  */
+#line 1596 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_METHODREF, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5458 "build/basic.tab.c"
+    break;
+
+  case 198: /* varexpr: basetypename '.' "program"  */
+#line 1598 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_METHODREF, (yyvsp[-2].ast), AstIdentifier("program")); }
+#line 5464 "build/basic.tab.c"
+    break;
+
+  case 199: /* varassigntarget: varexpr  */
+#line 1603 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5470 "build/basic.tab.c"
+    break;
+
+  case 200: /* varassigntarget: "_"  */
+#line 1605 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_EMPTY, NULL, NULL); }
+#line 5476 "build/basic.tab.c"
+    break;
+
+  case 201: /* pinrange: expr  */
+#line 1610 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_RANGE, (yyvsp[0].ast), NULL); }
+#line 5482 "build/basic.tab.c"
+    break;
+
+  case 202: /* pinrange: expr ',' expr  */
+#line 1612 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_RANGE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5488 "build/basic.tab.c"
+    break;
+
+  case 203: /* register_expr: "input" '(' pinrange ')'  */
+#line 1617 "frontends/basic/basic.y"
+    { (yyval.ast) = GetPinRange("ina", "inb", (yyvsp[-1].ast)); }
+#line 5494 "build/basic.tab.c"
+    break;
+
+  case 204: /* register_expr: "output" '(' pinrange ')'  */
+#line 1619 "frontends/basic/basic.y"
+    { (yyval.ast) = GetPinRange("outa", "outb", (yyvsp[-1].ast)); }
+#line 5500 "build/basic.tab.c"
+    break;
+
+  case 205: /* register_expr: "direction" '(' pinrange ')'  */
+#line 1621 "frontends/basic/basic.y"
+    { (yyval.ast) = GetPinRange("dira", "dirb", (yyvsp[-1].ast)); }
+#line 5506 "build/basic.tab.c"
+    break;
+
+  case 206: /* np_primary_expr: varexpr  */
+#line 1627 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5512 "build/basic.tab.c"
+    break;
+
+  case 207: /* np_primary_expr: register_expr  */
+#line 1629 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5518 "build/basic.tab.c"
+    break;
+
+  case 208: /* np_primary_expr: "integer number"  */
+#line 1631 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5524 "build/basic.tab.c"
+    break;
+
+  case 209: /* np_primary_expr: "number"  */
+#line 1633 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5530 "build/basic.tab.c"
+    break;
+
+  case 210: /* np_primary_expr: "nil"  */
+#line 1635 "frontends/basic/basic.y"
+    { (yyval.ast) = AstBitValue(0); }
+#line 5536 "build/basic.tab.c"
+    break;
+
+  case 211: /* np_primary_expr: "self"  */
+#line 1637 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_SELF, NULL, NULL); }
+#line 5542 "build/basic.tab.c"
+    break;
+
+  case 212: /* np_primary_expr: "__FUNCTION__"  */
+#line 1639 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_FUNC_NAME, NULL, NULL); }
+#line 5548 "build/basic.tab.c"
+    break;
+
+  case 213: /* np_primary_expr: "literal string"  */
+#line 1641 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_STRINGPTR,
+                  NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL), NULL); }
+#line 5555 "build/basic.tab.c"
+    break;
+
+  case 214: /* np_primary_expr: "new" typename  */
+#line 1644 "frontends/basic/basic.y"
+    {
+        AST *numElements;
+        AST *baseType;
+        baseType = (yyvsp[0].ast);
+        if (baseType->kind == AST_ARRAYTYPE) {
+            int size = TypeSize(baseType->left);
+            (void)size;
+            numElements = baseType->right;
+            baseType = baseType->left;
+        } else {
+            numElements = AstInteger(1);
+        }
+        baseType = NewAST(AST_PTRTYPE, baseType, NULL);
+        (yyval.ast) = NewAST(AST_NEW, baseType, numElements);
+    }
+#line 5575 "build/basic.tab.c"
+    break;
+
+  case 215: /* np_primary_expr: "__builtin_alloca" '(' expr ')'  */
+#line 1660 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewAST(AST_ALLOCA, ast_type_ptr_void, (yyvsp[-1].ast));
+    }
+#line 5583 "build/basic.tab.c"
+    break;
+
+  case 216: /* np_primary_expr: "sizeof" expr  */
+#line 1664 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewAST(AST_SIZEOF, (yyvsp[0].ast), NULL);
+    }
+#line 5591 "build/basic.tab.c"
+    break;
+
+  case 217: /* primary_expr: np_primary_expr  */
+#line 1671 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5597 "build/basic.tab.c"
+    break;
+
+  case 218: /* primary_expr: '(' expr ')'  */
+#line 1673 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 5603 "build/basic.tab.c"
+    break;
+
+  case 219: /* unary_op: '-'  */
+#line 1678 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_NEGATE, NULL, NULL); }
+#line 5609 "build/basic.tab.c"
+    break;
+
+  case 220: /* unary_op: "not"  */
+#line 1680 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_BIT_NOT, NULL, NULL); }
+#line 5615 "build/basic.tab.c"
+    break;
+
+  case 221: /* unary_op: "abs"  */
+#line 1682 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_ABS, NULL, NULL); }
+#line 5621 "build/basic.tab.c"
+    break;
+
+  case 222: /* unary_op: "asc"  */
+#line 1684 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_ASC, NULL, NULL); }
+#line 5627 "build/basic.tab.c"
+    break;
+
+  case 223: /* unary_op: "len"  */
+#line 1686 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_STRLEN, NULL, NULL); }
+#line 5633 "build/basic.tab.c"
+    break;
+
+  case 224: /* unary_op: "sqrt"  */
+#line 1688 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_SQRT, NULL, NULL); }
+#line 5639 "build/basic.tab.c"
+    break;
+
+  case 225: /* pseudofunc_expr: "int" '(' expr ')'  */
+#line 1693 "frontends/basic/basic.y"
+    {
+        AST *orig = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_CAST, ast_type_long, orig);
+    }
+#line 5648 "build/basic.tab.c"
+    break;
+
+  case 226: /* pseudofunc_expr: "cast" '(' typename ',' expr ')'  */
+#line 1698 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewAST(AST_CAST, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 5656 "build/basic.tab.c"
+    break;
+
+  case 227: /* pseudofunc_expr: "cpu" '(' exprlist ')'  */
+#line 1702 "frontends/basic/basic.y"
+    {
+        AST *elist;
+        AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
+        elist = NewAST(AST_EXPRLIST, immval, NULL);
+        elist = AddToList(elist, (yyvsp[-1].list).head);
+        (yyval.ast) = NewAST(AST_COGINIT, elist, NULL);
+    }
+#line 5668 "build/basic.tab.c"
+    break;
+
+  case 228: /* pseudofunc_expr: "_hasmethod" '(' typename ',' "identifier" ')'  */
+#line 1710 "frontends/basic/basic.y"
+    {
+        AST *typnam = (yyvsp[-3].ast);
+        AST *ident = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_HASMETHOD, typnam, ident);
+    }
+#line 5678 "build/basic.tab.c"
+    break;
+
+  case 229: /* pseudofunc_expr: "offsetof" '(' typename ',' "identifier" ')'  */
+#line 1716 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = NewAST(AST_OFFSETOF, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 5686 "build/basic.tab.c"
+    break;
+
+  case 230: /* pseudofunc_expr: "_sametypes" '(' typename ',' typename ')'  */
+#line 1720 "frontends/basic/basic.y"
+    {
+        AST *expr = (yyvsp[-3].ast);
+        AST *typnam = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_SAMETYPES, expr, typnam);
+    }
+#line 5696 "build/basic.tab.c"
+    break;
+
+  case 231: /* pseudofunc_expr: "_sametypes" '(' expr ',' typename ')'  */
+#line 1726 "frontends/basic/basic.y"
+    {
+        SYNTAX_ERROR("SameTypes requires two type names");
+        (yyval.ast) = AstInteger(0);
+    }
+#line 5705 "build/basic.tab.c"
+    break;
+
+  case 232: /* pseudofunc_expr: '@' unary_expr  */
+#line 1731 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_ADDROF, (yyvsp[0].ast), NULL); }
+#line 5711 "build/basic.tab.c"
+    break;
+
+  case 233: /* pseudofunc_expr: "@@@" unary_expr  */
+#line 1733 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_ABSADDROF, (yyvsp[0].ast), NULL); }
+#line 5717 "build/basic.tab.c"
+    break;
+
+  case 234: /* unary_expr: primary_expr  */
+#line 1738 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5723 "build/basic.tab.c"
+    break;
+
+  case 235: /* unary_expr: pseudofunc_expr  */
+#line 1740 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5729 "build/basic.tab.c"
+    break;
+
+  case 236: /* unary_expr: '+' unary_expr  */
+#line 1742 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5735 "build/basic.tab.c"
+    break;
+
+  case 237: /* unary_expr: unary_op unary_expr  */
+#line 1744 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->right = (yyvsp[0].ast); }
+#line 5741 "build/basic.tab.c"
+    break;
+
+  case 238: /* np_unary_expr: np_primary_expr  */
+#line 1749 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5747 "build/basic.tab.c"
+    break;
+
+  case 239: /* np_unary_expr: pseudofunc_expr  */
+#line 1751 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5753 "build/basic.tab.c"
+    break;
+
+  case 240: /* np_unary_expr: '+' unary_expr  */
+#line 1753 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5759 "build/basic.tab.c"
+    break;
+
+  case 241: /* np_unary_expr: unary_op unary_expr  */
+#line 1755 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->right = (yyvsp[0].ast); }
+#line 5765 "build/basic.tab.c"
+    break;
+
+  case 242: /* lambdaexpr: "function" '(' paramdecl ')' expr  */
+#line 1760 "frontends/basic/basic.y"
+    {
+      AST *params = (yyvsp[-2].ast);
+      AST *rettype = NULL;
+      AST *body = (yyvsp[0].ast);
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+
+      body = NewCommentedStatement(AstReturn(body, NULL));
+
+      (yyval.ast) = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5780 "build/basic.tab.c"
+    break;
+
+  case 243: /* lambdaexpr: "function" '(' paramdecl ')' "as" typename eoln funcbody  */
+#line 1771 "frontends/basic/basic.y"
+    {
+      AST *params = (yyvsp[-5].ast);
+      AST *rettype = (yyvsp[-2].ast);
+      AST *body = (yyvsp[0].ast);
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      (yyval.ast) = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5792 "build/basic.tab.c"
+    break;
+
+  case 244: /* lambdaexpr: "sub" '(' paramdecl ')' eoln subbody  */
+#line 1779 "frontends/basic/basic.y"
+    {
+      AST *params = (yyvsp[-3].ast);
+      AST *rettype = ast_type_void;
+      AST *body = (yyvsp[0].ast);
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      (yyval.ast) = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5804 "build/basic.tab.c"
+    break;
+
+  case 245: /* lambdaexpr: '[' paramdecl ':' statementlist ']'  */
+#line 1787 "frontends/basic/basic.y"
+    {
+      AST *params = (yyvsp[-3].ast);
+      AST *rettype = ast_type_void;
+      AST *body = (yyvsp[-1].ast);
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      (yyval.ast) = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5816 "build/basic.tab.c"
+    break;
+
+  case 246: /* lambdaexpr: '[' paramdecl ':' optstatementlist ">=" expr opttype ']'  */
+#line 1795 "frontends/basic/basic.y"
+    {
+      AST *params = (yyvsp[-6].ast);
+      AST *rettype = (yyvsp[-1].ast);
+      AST *body = (yyvsp[-4].ast);
+      AST *retstmt = NewCommentedStatement(AstReturn((yyvsp[-2].ast), NULL));
+      AST *functype = NewAST(AST_FUNCTYPE, rettype, params);
+      body = AddToList(body, retstmt);
+      (yyval.ast) = NewAST(AST_LAMBDA, functype, body);
+    }
+#line 5830 "build/basic.tab.c"
+    break;
+
+  case 247: /* opttype: %empty  */
+#line 1807 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 5836 "build/basic.tab.c"
+    break;
+
+  case 248: /* opttype: "as" typename  */
+#line 1809 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5842 "build/basic.tab.c"
+    break;
+
+  case 249: /* mult_op: '*'  */
+#line 1814 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('*', NULL, NULL); }
+#line 5848 "build/basic.tab.c"
+    break;
+
+  case 250: /* mult_op: '/'  */
+#line 1816 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('/', NULL, NULL); }
+#line 5854 "build/basic.tab.c"
+    break;
+
+  case 251: /* mult_op: "mod"  */
+#line 1818 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_MODULUS, NULL, NULL); }
+#line 5860 "build/basic.tab.c"
+    break;
+
+  case 252: /* mult_op: "shl"  */
+#line 1820 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_SHL, NULL, NULL); }
+#line 5866 "build/basic.tab.c"
+    break;
+
+  case 253: /* mult_op: "shr"  */
+#line 1822 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_SAR, NULL, NULL); }
+#line 5872 "build/basic.tab.c"
+    break;
+
+  case 254: /* power_expr: unary_expr  */
+#line 1827 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5878 "build/basic.tab.c"
+    break;
+
+  case 255: /* power_expr: power_expr '^' unary_expr  */
+#line 1829 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = AstOperator(K_POWER, (yyvsp[-2].ast), (yyvsp[0].ast));
+    }
+#line 5886 "build/basic.tab.c"
+    break;
+
+  case 256: /* np_power_expr: np_unary_expr  */
+#line 1836 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5892 "build/basic.tab.c"
+    break;
+
+  case 257: /* np_power_expr: np_power_expr '^' np_unary_expr  */
+#line 1838 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = AstOperator(K_POWER, (yyvsp[-2].ast), (yyvsp[0].ast));
+    }
+#line 5900 "build/basic.tab.c"
+    break;
+
+  case 258: /* mult_expr: power_expr  */
+#line 1845 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5906 "build/basic.tab.c"
+    break;
+
+  case 259: /* mult_expr: mult_expr mult_op power_expr  */
+#line 1847 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = (yyvsp[-1].ast);
+        (yyval.ast)->left = (yyvsp[-2].ast);
+        (yyval.ast)->right = (yyvsp[0].ast);
+    }
+#line 5916 "build/basic.tab.c"
+    break;
+
+  case 260: /* np_mult_expr: np_power_expr  */
+#line 1855 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5922 "build/basic.tab.c"
+    break;
+
+  case 261: /* np_mult_expr: np_mult_expr mult_op np_power_expr  */
+#line 1857 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = (yyvsp[-1].ast);
+        (yyval.ast)->left = (yyvsp[-2].ast);
+        (yyval.ast)->right = (yyvsp[0].ast);
+    }
+#line 5932 "build/basic.tab.c"
+    break;
+
+  case 262: /* add_expr: mult_expr  */
+#line 1866 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5938 "build/basic.tab.c"
+    break;
+
+  case 263: /* add_expr: add_expr '+' mult_expr  */
+#line 1868 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('+', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5944 "build/basic.tab.c"
+    break;
+
+  case 264: /* add_expr: add_expr '-' mult_expr  */
+#line 1870 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('-', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5950 "build/basic.tab.c"
+    break;
+
+  case 265: /* np_add_expr: np_mult_expr  */
+#line 1875 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5956 "build/basic.tab.c"
+    break;
+
+  case 266: /* np_add_expr: np_add_expr '+' mult_expr  */
+#line 1877 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('+', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5962 "build/basic.tab.c"
+    break;
+
+  case 267: /* np_add_expr: np_add_expr '-' mult_expr  */
+#line 1879 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('-', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5968 "build/basic.tab.c"
+    break;
+
+  case 268: /* compare_expr: add_expr  */
+#line 1884 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 5974 "build/basic.tab.c"
+    break;
+
+  case 269: /* compare_expr: add_expr '=' add_expr  */
+#line 1886 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_EQ, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5980 "build/basic.tab.c"
+    break;
+
+  case 270: /* compare_expr: add_expr '<' add_expr  */
+#line 1888 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('<', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5986 "build/basic.tab.c"
+    break;
+
+  case 271: /* compare_expr: add_expr '>' add_expr  */
+#line 1890 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('>', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5992 "build/basic.tab.c"
+    break;
+
+  case 272: /* compare_expr: add_expr "<>" add_expr  */
+#line 1892 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_NE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 5998 "build/basic.tab.c"
+    break;
+
+  case 273: /* compare_expr: add_expr "<=" add_expr  */
+#line 1894 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_LE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6004 "build/basic.tab.c"
+    break;
+
+  case 274: /* compare_expr: add_expr ">=" add_expr  */
+#line 1896 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_GE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6010 "build/basic.tab.c"
+    break;
+
+  case 275: /* bit_expr: compare_expr  */
+#line 1901 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6016 "build/basic.tab.c"
+    break;
+
+  case 276: /* bit_expr: bit_expr "and" compare_expr  */
+#line 1903 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('&', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6022 "build/basic.tab.c"
+    break;
+
+  case 277: /* bit_expr: bit_expr '&' compare_expr  */
+#line 1905 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('&', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6028 "build/basic.tab.c"
+    break;
+
+  case 278: /* bit_expr: bit_expr "or" compare_expr  */
+#line 1907 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6034 "build/basic.tab.c"
+    break;
+
+  case 279: /* bit_expr: bit_expr "xor" compare_expr  */
+#line 1909 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator('^', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6040 "build/basic.tab.c"
+    break;
+
+  case 280: /* bool_expr: bit_expr  */
+#line 1914 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6046 "build/basic.tab.c"
+    break;
+
+  case 281: /* bool_expr: bool_expr "andalso" bit_expr  */
+#line 1916 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_BOOL_AND, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6052 "build/basic.tab.c"
+    break;
+
+  case 282: /* bool_expr: bool_expr "orelse" bit_expr  */
+#line 1918 "frontends/basic/basic.y"
+    { (yyval.ast) = AstOperator(K_BOOL_OR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 6058 "build/basic.tab.c"
+    break;
+
+  case 283: /* expr: bool_expr  */
+#line 1923 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6064 "build/basic.tab.c"
+    break;
+
+  case 284: /* expr: lambdaexpr  */
+#line 1925 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6070 "build/basic.tab.c"
+    break;
+
+  case 287: /* optexprlist: %empty  */
+#line 1935 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 6076 "build/basic.tab.c"
+    break;
+
+  case 288: /* optexprlist: exprlist  */
+#line 1937 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].list).head; }
+#line 6082 "build/basic.tab.c"
+    break;
+
+  case 289: /* initexprlist: initexpritem  */
+#line 1942 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6088 "build/basic.tab.c"
+    break;
+
+  case 290: /* initexprlist: initexprlist ',' initexpritem  */
+#line 1944 "frontends/basic/basic.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6094 "build/basic.tab.c"
+    break;
+
+  case 291: /* initexpritem: expr  */
+#line 1949 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 6100 "build/basic.tab.c"
+    break;
+
+  case 292: /* initexpritem: eolnseq expr  */
+#line 1951 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 6106 "build/basic.tab.c"
+    break;
+
+  case 293: /* exprlist: expritem  */
+#line 1956 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6112 "build/basic.tab.c"
+    break;
+
+  case 294: /* exprlist: exprlist ',' expritem  */
+#line 1958 "frontends/basic/basic.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6118 "build/basic.tab.c"
+    break;
+
+  case 295: /* expritem: expr  */
+#line 1963 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 6124 "build/basic.tab.c"
+    break;
+
+  case 296: /* np_expritem: np_expr  */
+#line 1968 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 6130 "build/basic.tab.c"
+    break;
+
+  case 297: /* np_exprlist: np_expritem  */
+#line 1972 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6136 "build/basic.tab.c"
+    break;
+
+  case 298: /* np_exprlist: np_expritem ',' exprlist  */
+#line 1974 "frontends/basic/basic.y"
+    { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 6142 "build/basic.tab.c"
+    break;
+
+  case 299: /* subbody: optstatementlist endsub  */
+#line 1979 "frontends/basic/basic.y"
+  { (yyval.ast) = (yyvsp[-1].ast); }
+#line 6148 "build/basic.tab.c"
+    break;
+
+  case 302: /* funcbody: optstatementlist endfunc  */
+#line 1989 "frontends/basic/basic.y"
+  { (yyval.ast) = (yyvsp[-1].ast); }
+#line 6154 "build/basic.tab.c"
+    break;
+
+  case 305: /* attributes: %empty  */
+#line 1999 "frontends/basic/basic.y"
+    { (yyval.ast) = 0; }
+#line 6160 "build/basic.tab.c"
+    break;
+
+  case 306: /* attributes: "for" "literal string"  */
+#line 2001 "frontends/basic/basic.y"
+    {
+        AST *ast = (yyvsp[0].ast);
+        ast->kind = AST_ANNOTATION;
+        (yyval.ast) = ast;
+    }
+#line 6170 "build/basic.tab.c"
+    break;
+
+  case 307: /* subdecl: "sub" attributes "identifier" '(' paramdecl ')' eoln subbody  */
+#line 2010 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-6].ast);
+    AST *ident = (yyvsp[-5].ast);
+    AST *parms = (yyvsp[-3].ast);
+    AST *body = (yyvsp[0].ast);
+    AST *funcdecl = NewAST(AST_FUNCDECL, ident, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, ast_type_void, 1, funcdef, body, attrib, (yyvsp[-7].ast));
+  }
+#line 6185 "build/basic.tab.c"
+    break;
+
+  case 308: /* subdecl: "implements" "sub" attributes "identifier" '(' paramdecl ')'  */
+#line 2021 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-4].ast);
+    AST *ident = (yyvsp[-3].ast);
+    AST *parms = (yyvsp[-1].ast);
+    AST *body = NULL;
+    AST *funcdecl = NewAST(AST_FUNCDECL, ident, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, ast_type_void, 1, funcdef, body, attrib, (yyvsp[-5].ast));
+  }
+#line 6200 "build/basic.tab.c"
+    break;
+
+  case 309: /* subdecl: "sub" attributes "identifier" paramdecl eoln subbody  */
+#line 2032 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-4].ast);
+    AST *ident = (yyvsp[-3].ast);
+    AST *parms = (yyvsp[-2].ast);
+    AST *body = (yyvsp[0].ast);
+    AST *funcdecl = NewAST(AST_FUNCDECL, ident, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, ast_type_void, 1, funcdef, body, attrib, (yyvsp[-5].ast));
+  }
+#line 6215 "build/basic.tab.c"
+    break;
+
+  case 310: /* subdecl: "declare" "sub" "identifier" "lib" "literal string" '(' paramdecl ')'  */
+#line 2043 "frontends/basic/basic.y"
+     {
+         AST *attrib = NULL;
+         AST *name = (yyvsp[-5].ast);
+         AST *parms = (yyvsp[-1].ast);
+         AST *rettype = ast_type_void;
+         AST *body = (yyvsp[-3].ast);
+         AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+         AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+         AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+         
+         DeclareFunction(current, rettype, 1, funcdef, body, attrib, (yyvsp[-7].ast));
+     }
+#line 6232 "build/basic.tab.c"
+    break;
+
+  case 311: /* funcdecl: "function" attributes "identifier" '(' paramdecl ')' eoln funcbody  */
+#line 2059 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-6].ast);
+    AST *name = (yyvsp[-5].ast);
+    AST *parms = (yyvsp[-3].ast);
+    AST *body = (yyvsp[0].ast);
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    AST *rettype = InferTypeFromName(name);
+    DeclareFunction(current, rettype, 1, funcdef, body, attrib, (yyvsp[-7].ast));
+  }
+#line 6248 "build/basic.tab.c"
+    break;
+
+  case 312: /* funcdecl: "function" attributes "identifier" '(' paramdecl ')' "as" typelist eoln funcbody  */
+#line 2071 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-8].ast);
+    AST *name = (yyvsp[-7].ast);
+    AST *parms = (yyvsp[-5].ast);
+    AST *rettype = (yyvsp[-2].list).head;
+    AST *body = (yyvsp[0].ast);
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, rettype, 1, funcdef, body, attrib, (yyvsp[-9].ast));
+  }
+#line 6264 "build/basic.tab.c"
+    break;
+
+  case 313: /* funcdecl: "implements" "function" attributes "identifier" '(' paramdecl ')' "as" typelist  */
+#line 2083 "frontends/basic/basic.y"
+  {
+    AST *attrib = (yyvsp[-6].ast);
+    AST *name = (yyvsp[-5].ast);
+    AST *parms = (yyvsp[-3].ast);
+    AST *rettype = (yyvsp[0].list).head;
+    AST *body = NULL;
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    DeclareFunction(current, rettype, 1, funcdef, body, attrib, (yyvsp[-7].ast));
+  }
+#line 6280 "build/basic.tab.c"
+    break;
+
+  case 314: /* funcdecl: "declare" "function" "identifier" "lib" "literal string" '(' paramdecl ')' "as" typelist  */
+#line 2095 "frontends/basic/basic.y"
+     {
+         AST *attrib = NULL;
+         AST *name = (yyvsp[-7].ast);
+         AST *parms = (yyvsp[-3].ast);
+         AST *rettype = (yyvsp[0].list).head;
+         AST *body = (yyvsp[-5].ast);
+         AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+         AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
+         AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+         
+         DeclareFunction(current, rettype, 1, funcdef, body, attrib, (yyvsp[-9].ast));
+     }
+#line 6297 "build/basic.tab.c"
+    break;
+
+  case 315: /* funcdecl: "def" "identifier" '(' paramdecl ')' '=' expr  */
+#line 2108 "frontends/basic/basic.y"
+  {
+    AST *name = (yyvsp[-5].ast);
+    AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
+    AST *funcvars = NewAST(AST_FUNCVARS, (yyvsp[-3].ast), NULL);
+    AST *funcdef = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+    AST *rettype = InferTypeFromName(name);
+    AST *retval = (yyvsp[0].ast);
+    AST *body;
+
+    body = NewAST(AST_STMTLIST,
+                  NewAST(AST_RETURN, retval, NULL),
+                  NULL);
+    DeclareFunction(current, rettype, 1, funcdef, body, NULL, (yyvsp[-6].ast));
+  }
+#line 6316 "build/basic.tab.c"
+    break;
+
+  case 316: /* functemplate: templateheader "function" "identifier" '(' paramdecl ')' "as" typelist eoln funcbody  */
+#line 2126 "frontends/basic/basic.y"
+    {
+        AST *name = (yyvsp[-7].ast);
+	AST *types = (yyvsp[-9].ast);
+        AST *paramvars = (yyvsp[-5].ast);
+        AST *rettype = (yyvsp[-2].list).head;
+	AST *functype = NewAST(AST_FUNCTYPE, rettype, paramvars);
+	AST *body = (yyvsp[0].ast);
+	AST *top_decl;
+	top_decl = NewAST(AST_LISTHOLDER, functype,
+			  NewAST(AST_LISTHOLDER, name,
+				 NewAST(AST_LISTHOLDER, body, NULL)));
+        PopCurrentTypes();
+	top_decl = NewAST(AST_FUNC_TEMPLATE, types, top_decl);
+	DeclareFunctionTemplate(current, top_decl);
+    }
+#line 6336 "build/basic.tab.c"
+    break;
+
+  case 317: /* functemplate: templateheader "sub" "identifier" '(' paramdecl ')' eoln subbody  */
+#line 2142 "frontends/basic/basic.y"
+    {
+        AST *name = (yyvsp[-5].ast);
+	AST *types = (yyvsp[-7].ast);
+        AST *paramvars = (yyvsp[-3].ast);
+        AST *rettype = ast_type_void;
+	AST *functype = NewAST(AST_FUNCTYPE, rettype, paramvars);
+	AST *body = (yyvsp[0].ast);
+	AST *top_decl;
+	top_decl = NewAST(AST_LISTHOLDER, functype,
+			  NewAST(AST_LISTHOLDER, name,
+				 NewAST(AST_LISTHOLDER, body, NULL)));
+        PopCurrentTypes();
+	top_decl = NewAST(AST_FUNC_TEMPLATE, types, top_decl);
+	DeclareFunctionTemplate(current, top_decl);
+    }
+#line 6356 "build/basic.tab.c"
+    break;
+
+  case 318: /* templateheader: "any" '(' identlist ')'  */
+#line 2161 "frontends/basic/basic.y"
+    {
+      PushCurrentTypes();
+      (yyval.ast) = AddTemplateTypes((yyvsp[-1].list).head);
+    }
+#line 6365 "build/basic.tab.c"
+    break;
+
+  case 319: /* identlist: "identifier"  */
+#line 2169 "frontends/basic/basic.y"
+    {
+      (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL));
+    }
+#line 6373 "build/basic.tab.c"
+    break;
+
+  case 320: /* identlist: identlist ',' "identifier"  */
+#line 2173 "frontends/basic/basic.y"
+    {
+      AST *rhs = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+      (yyval.list) = ListBuilderAdd((yyvsp[-2].list), rhs);
+    }
+#line 6382 "build/basic.tab.c"
+    break;
+
+  case 321: /* assignitem: "identifier" '=' expr  */
+#line 2181 "frontends/basic/basic.y"
+    {
+        AST *assign = NewAST(AST_ASSIGN, (yyvsp[-2].ast), (yyvsp[0].ast));
+        (yyval.ast) = NewAST(AST_LISTHOLDER, assign, NULL);
+    }
+#line 6391 "build/basic.tab.c"
+    break;
+
+  case 322: /* assignlist: assignitem  */
+#line 2189 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6397 "build/basic.tab.c"
+    break;
+
+  case 323: /* assignlist: assignitem ',' assignlist  */
+#line 2191 "frontends/basic/basic.y"
+    {
+        AST *first = (yyvsp[-2].ast);
+        AST *rest = (yyvsp[0].ast);
+        first->right = rest;
+        (yyval.ast) = first;
+    }
+#line 6408 "build/basic.tab.c"
+    break;
+
+  case 324: /* optobjparams: %empty  */
+#line 2201 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 6414 "build/basic.tab.c"
+    break;
+
+  case 325: /* optobjparams: "with" assignlist  */
+#line 2203 "frontends/basic/basic.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 6422 "build/basic.tab.c"
+    break;
+
+  case 326: /* classdecl: "class" "identifier" "using" "literal string" optobjparams  */
+#line 2210 "frontends/basic/basic.y"
+    {
+        AST *params = (yyvsp[0].ast);
+        AST *newobj = NewAbstractObjectWithParams( (yyvsp[-3].ast), (yyvsp[-1].ast), 1, params );
+        current->objblock = AddToList(current->objblock, newobj);
+        AddSymbol(currentTypes, (yyvsp[-3].ast)->d.string, SYM_TYPEDEF, newobj, NULL);
+        (yyval.ast) = NULL;
+    }
+#line 6434 "build/basic.tab.c"
+    break;
+
+  case 328: /* classheader: "class" "identifier" eoln  */
+#line 2222 "frontends/basic/basic.y"
+    {
+      AST *ident = (yyvsp[-1].ast);
+      const char *classname = ident->d.string;
+      Module *P = NewModule(classname, current->curLanguage);
+      AST *newobj = NewAbstractObject( ident, NULL, 0 );
+      newobj->d.ptr = P;
+      AddSymbol(currentTypes, classname, SYM_TYPEDEF, newobj, NULL);
+      if (P != current) {
+          P->Lptr = current->Lptr;
+          P->subclasses = current->subclasses;
+          current->subclasses = P;
+          P->superclass = current;
+          P->fullname = current->fullname; // for finding "class using"
+      }
+      PushCurrentModule();
+      current = P;
+      (yyval.ast) = NULL;
+    }
+#line 6457 "build/basic.tab.c"
+    break;
+
+  case 329: /* classheader: "type" "identifier" eoln  */
+#line 2241 "frontends/basic/basic.y"
+    {
+      AST *ident = (yyvsp[-1].ast);
+      const char *classname = ident->d.string;
+      Module *P = NewModule(classname, current->curLanguage);
+      AST *newobj = NewAbstractObject( ident, NULL, 0 );
+      newobj->d.ptr = P;
+      AddSymbol(currentTypes, classname, SYM_TYPEDEF, newobj, NULL);
+      if (P != current) {
+          P->Lptr = current->Lptr;
+          P->subclasses = current->subclasses;
+          current->subclasses = P;
+          P->superclass = current;
+          P->fullname = current->fullname; // for finding "class using"
+      }
+      PushCurrentModule();
+      current = P;
+      (yyval.ast) = NULL;
+    }
+#line 6480 "build/basic.tab.c"
+    break;
+
+  case 330: /* classheader: "union" "identifier" eoln  */
+#line 2260 "frontends/basic/basic.y"
+    {
+      AST *ident = (yyvsp[-1].ast);
+      const char *classname = ident->d.string;
+      Module *P = NewModule(classname, current->curLanguage);
+      AST *newobj = NewAbstractObject( (yyvsp[-1].ast), NULL, 0 );
+      newobj->d.ptr = P;
+      AddSymbol(currentTypes, (yyvsp[-1].ast)->d.string, SYM_TYPEDEF, newobj, NULL);
+      if (P != current) {
+          P->Lptr = current->Lptr;
+          P->subclasses = current->subclasses;
+          current->subclasses = P;
+          P->superclass = current;
+          P->fullname = current->fullname; // for finding "class using"
+      }
+      P->isUnion = 1;
+      PushCurrentModule();
+      current = P;
+      (yyval.ast) = NULL;
+    }
+#line 6504 "build/basic.tab.c"
+    break;
+
+  case 331: /* classheader: "interface" "identifier" eoln  */
+#line 2280 "frontends/basic/basic.y"
+    {
+      AST *ident = (yyvsp[-1].ast);
+      const char *classname = ident->d.string;
+      Module *P = NewModule(classname, current->curLanguage);
+      AST *newobj = NewAbstractObject( (yyvsp[-1].ast), NULL, 0 );
+      newobj->d.ptr = P;
+      AddSymbol(currentTypes, (yyvsp[-1].ast)->d.string, SYM_TYPEDEF, newobj, NULL);
+      if (P != current) {
+          P->Lptr = current->Lptr;
+          P->subclasses = current->subclasses;
+          current->subclasses = P;
+          P->superclass = current;
+          P->fullname = current->fullname; // for finding "class using"
+      }
+      P->isInterface = 1;
+      PushCurrentModule();
+      current = P;
+      (yyval.ast) = NULL;
+    }
+#line 6528 "build/basic.tab.c"
+    break;
+
+  case 334: /* classend: "end" "class"  */
+#line 2308 "frontends/basic/basic.y"
+    {
+      if (!current->superclass || current->isUnion || current->isInterface) {
+        SYNTAX_ERROR("END CLASS not inside class");
+      } else {
+          PopCurrentModule();
+      }
+    }
+#line 6540 "build/basic.tab.c"
+    break;
+
+  case 335: /* classend: "end" "union"  */
+#line 2316 "frontends/basic/basic.y"
+    {
+      if (!current->superclass || !current->isUnion || current->isInterface) {
+        SYNTAX_ERROR("END UNION not inside union");
+      } else {
+          PopCurrentModule();
+      }
+    }
+#line 6552 "build/basic.tab.c"
+    break;
+
+  case 336: /* classend: "end" "interface"  */
+#line 2324 "frontends/basic/basic.y"
+    {
+      if (!current->isInterface) {
+        SYNTAX_ERROR("END INTERFACE not inside interface");
+      } else {
+          PopCurrentModule();
+      }
+    }
+#line 6564 "build/basic.tab.c"
+    break;
+
+  case 337: /* classend: "end" "type"  */
+#line 2332 "frontends/basic/basic.y"
+    {
+      PopCurrentModule();
+    }
+#line 6572 "build/basic.tab.c"
+    break;
+
+  case 339: /* classdeclitem: dimlist "as" typename  */
+#line 2339 "frontends/basic/basic.y"
+    {
+        AST *ast = NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), (yyvsp[-2].list).head);
+        DeclareBASICMemberVariables(ast);
+    }
+#line 6581 "build/basic.tab.c"
+    break;
+
+  case 340: /* classdeclitem: "as" typename dimlist  */
+#line 2344 "frontends/basic/basic.y"
+    {
+        AST *ast = NewAST(AST_DECLARE_VAR, (yyvsp[-1].ast), (yyvsp[0].list).head);
+        DeclareBASICMemberVariables(ast);
+    }
+#line 6590 "build/basic.tab.c"
+    break;
+
+  case 341: /* classdeclitem: dimension  */
+#line 2349 "frontends/basic/basic.y"
+    {
+        AST *ast = (yyvsp[0].ast);
+        if (ast->kind == AST_GLOBALVARS) {
+            DeclareBASICSharedVariables(ast->left);
+        } else {
+            DeclareBASICMemberVariables(ast);
+        }
+    }
+#line 6603 "build/basic.tab.c"
+    break;
+
+  case 345: /* constdecl: "const" constlist  */
+#line 2364 "frontends/basic/basic.y"
+  {
+      (yyval.ast) = current->conblock = AddToList(current->conblock, (yyvsp[0].list).head);
+  }
+#line 6611 "build/basic.tab.c"
+    break;
+
+  case 346: /* constitem: "identifier" '=' expr  */
+#line 2370 "frontends/basic/basic.y"
+    {
+      AST *decl = AstAssign((yyvsp[-2].ast), (yyvsp[0].ast));
+      decl = CommentedListHolder(decl);
+      (yyval.ast) = decl;
+    }
+#line 6621 "build/basic.tab.c"
+    break;
+
+  case 347: /* constlist: constlist ',' constitem  */
+#line 2378 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6627 "build/basic.tab.c"
+    break;
+
+  case 348: /* constlist: constitem  */
+#line 2380 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6633 "build/basic.tab.c"
+    break;
+
+  case 349: /* typedecl: "type" "identifier" "as" typename  */
+#line 2385 "frontends/basic/basic.y"
+    {
+        AddSymbol(currentTypes, (yyvsp[-2].ast)->d.string, SYM_TYPEDEF, (yyvsp[0].ast), NULL);
+    }
+#line 6641 "build/basic.tab.c"
+    break;
+
+  case 350: /* optarraylimit: %empty  */
+#line 2392 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 6647 "build/basic.tab.c"
+    break;
+
+  case 351: /* optarraylimit: "to" expr  */
+#line 2394 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6653 "build/basic.tab.c"
+    break;
+
+  case 352: /* arraysizeitem: expr optarraylimit  */
+#line 2398 "frontends/basic/basic.y"
+  {
+      AST *first = (yyvsp[-1].ast);
+      AST *second = (yyvsp[0].ast);
+      AST *base;
+      AST *limit;
+      
+      if (second) {
+          base = first;
+          limit = second;
+      } else {
+          Symbol *sym = GetCurArrayBase();
+          if (sym) {
+              base = (AST *)sym->v.ptr;
+          } else {
+              base = AstInteger(0);
+          }
+          limit = first;
+      }
+      (yyval.ast) = NewAST(AST_RANGE, base, limit);
+  }
+#line 6678 "build/basic.tab.c"
+    break;
+
+  case 353: /* arraysizelist: arraysizeitem  */
+#line 2422 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart(NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 6684 "build/basic.tab.c"
+    break;
+
+  case 354: /* arraysizelist: arraysizelist ',' arraysizeitem  */
+#line 2424 "frontends/basic/basic.y"
+    {
+        (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast));
+    }
+#line 6692 "build/basic.tab.c"
+    break;
+
+  case 355: /* typename: basetypename  */
+#line 2431 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6698 "build/basic.tab.c"
+    break;
+
+  case 356: /* typename: basetypename ptrdef  */
+#line 2433 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_PTRTYPE, (yyvsp[-1].ast), NULL); }
+#line 6704 "build/basic.tab.c"
+    break;
+
+  case 357: /* typename: basetypename "const" ptrdef  */
+#line 2435 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_MODIFIER_CONST, NewAST(AST_PTRTYPE, (yyvsp[-2].ast), NULL), NULL); }
+#line 6710 "build/basic.tab.c"
+    break;
+
+  case 358: /* typename: '(' typename ')'  */
+#line 2437 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 6716 "build/basic.tab.c"
+    break;
+
+  case 359: /* typename: basetypename '(' arraysizelist ')'  */
+#line 2439 "frontends/basic/basic.y"
+    {
+        AST *typ = (yyvsp[-3].ast);
+        AST *siz = (yyvsp[-1].list).head;
+        (yyval.ast) = MakeArrayType(typ, siz);
+    }
+#line 6726 "build/basic.tab.c"
+    break;
+
+  case 360: /* typelist: typename  */
+#line 2448 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6732 "build/basic.tab.c"
+    break;
+
+  case 361: /* typelist: typelist ',' typename  */
+#line 2450 "frontends/basic/basic.y"
+    {
+        ListBuilder list = (yyvsp[-2].list);
+        AST *added = (yyvsp[0].ast);
+        if (list.head->kind != AST_TUPLE_TYPE) {
+            list = ListBuilderStart(NewAST(AST_TUPLE_TYPE, list.head, NULL));
+        }
+        (yyval.list) = ListBuilderAdd(list, NewAST(AST_TUPLE_TYPE, added, NULL));
+    }
+#line 6745 "build/basic.tab.c"
+    break;
+
+  case 364: /* basetypename: "ubyte"  */
+#line 2466 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_byte; }
+#line 6751 "build/basic.tab.c"
+    break;
+
+  case 365: /* basetypename: "ushort"  */
+#line 2468 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_word; }
+#line 6757 "build/basic.tab.c"
+    break;
+
+  case 366: /* basetypename: "long"  */
+#line 2470 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_long; }
+#line 6763 "build/basic.tab.c"
+    break;
+
+  case 367: /* basetypename: "longint"  */
+#line 2472 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_long64; }
+#line 6769 "build/basic.tab.c"
+    break;
+
+  case 368: /* basetypename: "byte"  */
+#line 2474 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_signed_byte; }
+#line 6775 "build/basic.tab.c"
+    break;
+
+  case 369: /* basetypename: "short"  */
+#line 2476 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_signed_word; }
+#line 6781 "build/basic.tab.c"
+    break;
+
+  case 370: /* basetypename: "ulong"  */
+#line 2478 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_unsigned_long; }
+#line 6787 "build/basic.tab.c"
+    break;
+
+  case 371: /* basetypename: "ulongint"  */
+#line 2480 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_unsigned_long64; }
+#line 6793 "build/basic.tab.c"
+    break;
+
+  case 372: /* basetypename: "integer"  */
+#line 2482 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_long; }
+#line 6799 "build/basic.tab.c"
+    break;
+
+  case 373: /* basetypename: "boolean"  */
+#line 2484 "frontends/basic/basic.y"
+    {
+        AST *typ = ast_type_basic_boolean_small;
+        if (TraditionalBytecodeOutput()) {
+            // sign extension is a problem in bytecode output
+            typ = ast_type_basic_boolean;
+        }
+        (yyval.ast) = typ;
+    }
+#line 6812 "build/basic.tab.c"
+    break;
+
+  case 374: /* basetypename: "uinteger"  */
+#line 2493 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_unsigned_long; }
+#line 6818 "build/basic.tab.c"
+    break;
+
+  case 375: /* basetypename: "single"  */
+#line 2495 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_float; }
+#line 6824 "build/basic.tab.c"
+    break;
+
+  case 376: /* basetypename: "double"  */
+#line 2497 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_float; }
+#line 6830 "build/basic.tab.c"
+    break;
+
+  case 377: /* basetypename: "fixed" '(' "integer number" ')'  */
+#line 2499 "frontends/basic/basic.y"
+    {
+        AST *sizeexpr = (yyvsp[-1].ast);
+        int siz = sizeexpr->d.ival;
+        if (siz < 1 || siz > 31) {
+            SYNTAX_ERROR("Fixed point size %d is out of range 1..31", siz);
+            siz = 16;
+        }
+        SYNTAX_ERROR("Fixed point types not implemented yet");
+        (yyval.ast) = ast_type_float;
+    }
+#line 6845 "build/basic.tab.c"
+    break;
+
+  case 378: /* basetypename: "string"  */
+#line 2510 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_string; }
+#line 6851 "build/basic.tab.c"
+    break;
+
+  case 379: /* basetypename: "any"  */
+#line 2512 "frontends/basic/basic.y"
+    { (yyval.ast) = ast_type_generic; }
+#line 6857 "build/basic.tab.c"
+    break;
+
+  case 380: /* basetypename: "type name"  */
+#line 2514 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6863 "build/basic.tab.c"
+    break;
+
+  case 381: /* basetypename: "const" basetypename  */
+#line 2516 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_MODIFIER_CONST, (yyvsp[0].ast), NULL); }
+#line 6869 "build/basic.tab.c"
+    break;
+
+  case 382: /* basetypename: "function" '(' paramdecl ')' "as" basetypename  */
+#line 2518 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_PTRTYPE, NewAST(AST_FUNCTYPE, (yyvsp[0].ast), (yyvsp[-3].ast)), NULL); }
+#line 6875 "build/basic.tab.c"
+    break;
+
+  case 383: /* basetypename: "sub" '(' paramdecl ')'  */
+#line 2520 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_PTRTYPE, NewAST(AST_FUNCTYPE, ast_type_void, (yyvsp[-1].ast)), NULL); }
+#line 6881 "build/basic.tab.c"
+    break;
+
+  case 384: /* basetypename: "class" "using" "literal string" optobjparams  */
+#line 2522 "frontends/basic/basic.y"
+    {
+        AST *params = (yyvsp[0].ast);
+        AST *tempnam = NewAST(AST_IDENTIFIER, NULL, NULL);
+        const char *name = NewTemporaryVariable("_class_", NULL);
+        AST *newobj;
+
+        tempnam->d.string = name;
+        newobj = NewAbstractObjectWithParams( tempnam, (yyvsp[-1].ast), 1, params );        
+        current->objblock = AddToList(current->objblock, newobj);
+        (yyval.ast) = newobj;
+    }
+#line 6897 "build/basic.tab.c"
+    break;
+
+  case 385: /* paramdecl: %empty  */
+#line 2537 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 6903 "build/basic.tab.c"
+    break;
+
+  case 386: /* paramdecl: paramdecl1  */
+#line 2539 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].list).head; }
+#line 6909 "build/basic.tab.c"
+    break;
+
+  case 387: /* paramdecl1: paramitem  */
+#line 2543 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 6915 "build/basic.tab.c"
+    break;
+
+  case 388: /* paramdecl1: paramdecl1 ',' paramitem  */
+#line 2545 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 6921 "build/basic.tab.c"
+    break;
+
+  case 389: /* paramitem: paramvar  */
+#line 2550 "frontends/basic/basic.y"
+    { (yyval.ast) = AdjustParamType((yyvsp[0].ast)); }
+#line 6927 "build/basic.tab.c"
+    break;
+
+  case 390: /* paramitem: "byref" paramvar  */
+#line 2552 "frontends/basic/basic.y"
+    { (yyval.ast) = AdjustParamForByRef((yyvsp[0].ast)); }
+#line 6933 "build/basic.tab.c"
+    break;
+
+  case 391: /* paramitem: "byval" paramvar  */
+#line 2554 "frontends/basic/basic.y"
+    { (yyval.ast) = AdjustParamForByVal((yyvsp[0].ast)); }
+#line 6939 "build/basic.tab.c"
+    break;
+
+  case 392: /* paramvar: "identifier"  */
+#line 2559 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, InferTypeFromName((yyvsp[0].ast)), (yyvsp[0].ast)); }
+#line 6945 "build/basic.tab.c"
+    break;
+
+  case 393: /* paramvar: "identifier" '=' expr  */
+#line 2561 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, InferTypeFromName((yyvsp[-2].ast)), AstAssign((yyvsp[-2].ast), (yyvsp[0].ast))); }
+#line 6951 "build/basic.tab.c"
+    break;
+
+  case 394: /* paramvar: "identifier" "as" typename  */
+#line 2563 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), (yyvsp[-2].ast)); }
+#line 6957 "build/basic.tab.c"
+    break;
+
+  case 395: /* paramvar: "identifier" '(' ')' "as" typename  */
+#line 2565 "frontends/basic/basic.y"
+    {
+        AST *typ = (yyvsp[0].ast);
+        typ = MakeArrayType(typ, AstInteger(0));
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[-4].ast));
+    }
+#line 6967 "build/basic.tab.c"
+    break;
+
+  case 396: /* paramvar: "identifier" '(' arraysizelist ')' "as" typename  */
+#line 2571 "frontends/basic/basic.y"
+    {
+        AST *siz = (yyvsp[-3].list).head;
+        AST *typ = (yyvsp[0].ast);
+        typ = MakeArrayType(typ, siz);
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[-5].ast));
+    }
+#line 6978 "build/basic.tab.c"
+    break;
+
+  case 397: /* paramvar: "identifier" '=' expr "as" typename  */
+#line 2578 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), AstAssign((yyvsp[-4].ast), (yyvsp[-2].ast))); }
+#line 6984 "build/basic.tab.c"
+    break;
+
+  case 398: /* dimension: "dim" dimlist  */
+#line 2583 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, NULL, (yyvsp[0].list).head); }
+#line 6990 "build/basic.tab.c"
+    break;
+
+  case 399: /* dimension: "dim" dimlist "as" typename  */
+#line 2585 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), (yyvsp[-2].list).head); }
+#line 6996 "build/basic.tab.c"
+    break;
+
+  case 400: /* dimension: "dim" "as" typename dimlist  */
+#line 2587 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, (yyvsp[-1].ast), (yyvsp[0].list).head); }
+#line 7002 "build/basic.tab.c"
+    break;
+
+  case 401: /* dimension: "dim" "shared" dimlist  */
+#line 2589 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, NULL, (yyvsp[0].list).head), NULL); }
+#line 7008 "build/basic.tab.c"
+    break;
+
+  case 402: /* dimension: "dim" "shared" dimlist "as" typename  */
+#line 2591 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), (yyvsp[-2].list).head), NULL); }
+#line 7014 "build/basic.tab.c"
+    break;
+
+  case 403: /* dimension: "dim" "shared" "as" typename dimlist  */
+#line 2593 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, (yyvsp[-1].ast), (yyvsp[0].list).head), NULL); }
+#line 7020 "build/basic.tab.c"
+    break;
+
+  case 404: /* dimension: "dim" "register" dimlist  */
+#line 2595 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, NULL, (yyvsp[0].list).head), NULL); }
+#line 7026 "build/basic.tab.c"
+    break;
+
+  case 405: /* dimension: "dim" "register" dimlist "as" typename  */
+#line 2597 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, (yyvsp[0].ast), (yyvsp[-2].list).head), NULL); }
+#line 7032 "build/basic.tab.c"
+    break;
+
+  case 406: /* dimension: "dim" "register" "as" typename dimlist  */
+#line 2599 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, (yyvsp[-1].ast), (yyvsp[0].list).head), NULL); }
+#line 7038 "build/basic.tab.c"
+    break;
+
+  case 407: /* dimension: "declare" "identifier" "alias" "identifier" opt_type_as  */
+#line 2601 "frontends/basic/basic.y"
+    {
+        AST *newname = (yyvsp[-3].ast);
+        AST *oldname = (yyvsp[-1].ast);
+        AST *newtype = (yyvsp[0].ast);
+        if (newtype) {
+            oldname = NewAST(AST_TYPEDEF, newtype, oldname);
+        }
+        (yyval.ast) = NewAST(AST_DECLARE_ALIAS, newname, oldname);
+    }
+#line 7052 "build/basic.tab.c"
+    break;
+
+  case 408: /* dimension: "declare" "identifier" "alias" "integer number" "as" typename  */
+#line 2611 "frontends/basic/basic.y"
+    {
+        AST *newname = (yyvsp[-4].ast);
+        AST *addr = (yyvsp[-2].ast);
+        AST *newtype = (yyvsp[0].ast);
+
+        addr = NewAST(AST_MEMREF, newtype, addr);
+        addr = BASICArrayRef(addr, AstInteger(0));
+        addr = NewAST(AST_TYPEDEF, newtype, addr);
+        (yyval.ast) = NewAST(AST_DECLARE_ALIAS, newname, addr);
+    }
+#line 7067 "build/basic.tab.c"
+    break;
+
+  case 409: /* opt_type_as: %empty  */
+#line 2625 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 7073 "build/basic.tab.c"
+    break;
+
+  case 410: /* opt_type_as: "as" typename  */
+#line 2627 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 7079 "build/basic.tab.c"
+    break;
+
+  case 411: /* dimlist: dimitem  */
+#line 2632 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7085 "build/basic.tab.c"
+    break;
+
+  case 412: /* dimlist: dimlist ',' dimitem  */
+#line 2634 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 7091 "build/basic.tab.c"
+    break;
+
+  case 413: /* dimitem: identdecl  */
+#line 2638 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL); }
+#line 7097 "build/basic.tab.c"
+    break;
+
+  case 414: /* dimitem: identdecl ':' "integer number"  */
+#line 2640 "frontends/basic/basic.y"
+    {
+        AST *bitdecl = NewAST(AST_BITFIELD, (yyvsp[-2].ast), (yyvsp[0].ast));
+        (yyval.ast) = NewAST(AST_LISTHOLDER, bitdecl, NULL);
+    }
+#line 7106 "build/basic.tab.c"
+    break;
+
+  case 415: /* dimitem: identdecl '=' expr  */
+#line 2645 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_LISTHOLDER, AstAssign((yyvsp[-2].ast), (yyvsp[0].ast)), NULL); }
+#line 7112 "build/basic.tab.c"
+    break;
+
+  case 416: /* dimitem: identdecl '=' '{' initexprlist '}'  */
+#line 2647 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_LISTHOLDER, AstAssign((yyvsp[-4].ast), (yyvsp[-1].list).head), NULL); }
+#line 7118 "build/basic.tab.c"
+    break;
+
+  case 417: /* dimitem: identdecl '=' '{' initexprlist "end of line" '}'  */
+#line 2649 "frontends/basic/basic.y"
+    { (yyval.ast) = NewAST(AST_LISTHOLDER, AstAssign((yyvsp[-5].ast), (yyvsp[-2].list).head), NULL); }
+#line 7124 "build/basic.tab.c"
+    break;
+
+  case 418: /* identdecl: "identifier"  */
+#line 2654 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 7130 "build/basic.tab.c"
+    break;
+
+  case 419: /* identdecl: "identifier" '(' expr ')'  */
+#line 2656 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = (yyvsp[-3].ast);
+        AST *base = (AST *)sym->v.ptr;
+        AST *size = (yyvsp[-1].ast);
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+//        size = AstInteger(EvalConstExpr(size));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7147 "build/basic.tab.c"
+    break;
+
+  case 420: /* identdecl: "identifier" '(' expr "to" expr ')'  */
+#line 2669 "frontends/basic/basic.y"
+    {
+        AST *ident = (yyvsp[-5].ast);
+        AST *base = (yyvsp[-3].ast);
+        AST *size = (yyvsp[-1].ast);
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+//        size = AstInteger(EvalConstExpr(size));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7163 "build/basic.tab.c"
+    break;
+
+  case 421: /* identdecl: "identifier" '(' expr ',' expr ')'  */
+#line 2681 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = (yyvsp[-5].ast);
+        AST *base = (AST *)sym->v.ptr;
+        AST *size1 = (yyvsp[-3].ast);
+        AST *size2 = (yyvsp[-1].ast);
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7184 "build/basic.tab.c"
+    break;
+
+  case 422: /* identdecl: "identifier" '(' expr "to" expr ',' expr "to" expr ')'  */
+#line 2698 "frontends/basic/basic.y"
+    {
+        AST *ident = (yyvsp[-9].ast);
+        AST *base1 = (yyvsp[-7].ast);
+        AST *size1 = (yyvsp[-5].ast);
+        AST *base2 = (yyvsp[-3].ast);
+        AST *size2 = (yyvsp[-1].ast);
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base1, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base2, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        if (!AstMatch(base1, base2)) {
+            SYNTAX_ERROR("Base values for multi-dimensional array indices must match");
+        }
+        decl->d.ptr = base1;
+        (yyval.ast) = decl;
+    }
+#line 7208 "build/basic.tab.c"
+    break;
+
+  case 423: /* identdecl: "identifier" '[' expr ']'  */
+#line 2718 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = (yyvsp[-3].ast);
+        AST *base = (AST *)sym->v.ptr;
+        AST *size = (yyvsp[-1].ast);
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7224 "build/basic.tab.c"
+    break;
+
+  case 424: /* identdecl: "identifier" '[' expr "to" expr ']'  */
+#line 2730 "frontends/basic/basic.y"
+    {
+        AST *ident = (yyvsp[-5].ast);
+        AST *base = (yyvsp[-3].ast);
+        AST *size = (yyvsp[-1].ast);
+        AST *decl;
+        size = AstOperator('-', size, AstOperator('-', base, AstInteger(1)));
+        decl = NewAST(AST_ARRAYDECL, ident, size);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7239 "build/basic.tab.c"
+    break;
+
+  case 425: /* identdecl: "identifier" '[' expr ',' expr ']'  */
+#line 2741 "frontends/basic/basic.y"
+    {
+        Symbol *sym = GetCurArrayBase();
+        AST *ident = (yyvsp[-5].ast);
+        AST *base = (AST *)sym->v.ptr;
+        AST *size1 = (yyvsp[-3].ast);
+        AST *size2 = (yyvsp[-1].ast);
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        decl->d.ptr = base;
+        (yyval.ast) = decl;
+    }
+#line 7260 "build/basic.tab.c"
+    break;
+
+  case 426: /* identdecl: "identifier" '[' expr "to" expr ',' expr "to" expr ']'  */
+#line 2758 "frontends/basic/basic.y"
+    {
+        AST *ident = (yyvsp[-9].ast);
+        AST *base1 = (yyvsp[-7].ast);
+        AST *size1 = (yyvsp[-5].ast);
+        AST *base2 = (yyvsp[-3].ast);
+        AST *size2 = (yyvsp[-1].ast);
+        AST *sizelist;
+        AST *decl;
+        size1 = AstOperator('-', size1, AstOperator('-', base1, AstInteger(1)));
+        size2 = AstOperator('-', size2, AstOperator('-', base2, AstInteger(1)));
+        sizelist = NewAST(AST_EXPRLIST, size1,
+                          NewAST(AST_EXPRLIST, size2, NULL));
+        decl = NewAST(AST_ARRAYDECL, ident, sizelist);
+        if (!AstMatch(base1, base2)) {
+            SYNTAX_ERROR("Base values for multi-dimensional array indices must match");
+        }
+        decl->d.ptr = base1;
+        (yyval.ast) = decl;
+    }
+#line 7284 "build/basic.tab.c"
+    break;
+
+  case 427: /* asmstmt: "asm" eoln asmlist "end" "asm"  */
+#line 2781 "frontends/basic/basic.y"
+      {
+          // integer 0 means default asm
+          (yyval.ast) = NewCommentedAST(AST_INLINEASM, (yyvsp[-2].list).head, AstInteger(0), (yyvsp[-4].ast));
+      }
+#line 7293 "build/basic.tab.c"
+    break;
+
+  case 428: /* asmstmt: "const" "asm" eoln asmlist "end" "asm"  */
+#line 2786 "frontends/basic/basic.y"
+      {
+          (yyval.ast) = NewCommentedAST(AST_INLINEASM, (yyvsp[-2].list).head, AstInteger(INLINE_ASM_FLAG_CONST), (yyvsp[-5].ast));
+      }
+#line 7301 "build/basic.tab.c"
+    break;
+
+  case 429: /* asmstmt: "cpu" "asm" eoln asmlist "end" "asm"  */
+#line 2790 "frontends/basic/basic.y"
+      {
+          (yyval.ast) = NewCommentedAST(AST_INLINEASM, (yyvsp[-2].list).head, AstInteger(INLINE_ASM_FLAG_VOLATILE), (yyvsp[-5].ast));
+      }
+#line 7309 "build/basic.tab.c"
+    break;
+
+  case 430: /* asmstmt: "shared" "asm" eoln asmlist "end" "asm"  */
+#line 2794 "frontends/basic/basic.y"
+      { current->datblock = AddToListEx(current->datblock, (yyvsp[-2].list).head, &current->datblock_tail); (yyval.ast) = 0;}
+#line 7315 "build/basic.tab.c"
+    break;
+
+  case 431: /* asmstmt: "asm" "shared" eoln asmlist "end" "asm"  */
+#line 2798 "frontends/basic/basic.y"
+      { current->datblock = AddToListEx(current->datblock, (yyvsp[-2].list).head, &current->datblock_tail); (yyval.ast) = 0;}
+#line 7321 "build/basic.tab.c"
+    break;
+
+  case 432: /* asmlist: asmline  */
+#line 2803 "frontends/basic/basic.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7327 "build/basic.tab.c"
+    break;
+
+  case 433: /* asmlist: asmlist asmline  */
+#line 2805 "frontends/basic/basic.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 7333 "build/basic.tab.c"
+    break;
+
+  case 434: /* asmline: basedatline  */
+#line 2810 "frontends/basic/basic.y"
+  {
+      (yyval.ast) = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+  }
+#line 7341 "build/basic.tab.c"
+    break;
+
+  case 435: /* asmline: "identifier" basedatline  */
+#line 2814 "frontends/basic/basic.y"
+    {   AST *linebreak = NULL;
+        AST *comment = GetComments();
+        AST *datitem = (yyvsp[0].ast);
+        AST *changetype = NULL;
+        if (datitem) {
+            changetype = ExtractPasmType(datitem);
+            datitem = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+        }
+        AST *ast = NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), datitem);
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, changetype, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, changetype, NULL);
+        }
+        ast = NewAST(AST_LISTHOLDER, linebreak, ast);
+        (yyval.ast) = ast;
+    }
+#line 7363 "build/basic.tab.c"
+    break;
+
+  case 436: /* basedatline: "end of line"  */
+#line 2835 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 7369 "build/basic.tab.c"
+    break;
+
+  case 437: /* basedatline: error "end of line"  */
+#line 2837 "frontends/basic/basic.y"
+    { (yyval.ast) = NULL; }
+#line 7375 "build/basic.tab.c"
+    break;
+
+  case 438: /* basedatline: "byte" "end of line"  */
+#line 2839 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7381 "build/basic.tab.c"
+    break;
+
+  case 439: /* basedatline: "byte" operandlist "end of line"  */
+#line 2841 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 7387 "build/basic.tab.c"
+    break;
+
+  case 440: /* basedatline: "word" "end of line"  */
+#line 2843 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7393 "build/basic.tab.c"
+    break;
+
+  case 441: /* basedatline: "word" operandlist "end of line"  */
+#line 2845 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 7399 "build/basic.tab.c"
+    break;
+
+  case 442: /* basedatline: "long" "end of line"  */
+#line 2847 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7405 "build/basic.tab.c"
+    break;
+
+  case 443: /* basedatline: "long" operandlist "end of line"  */
+#line 2849 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 7411 "build/basic.tab.c"
+    break;
+
+  case 444: /* basedatline: instruction "end of line"  */
+#line 2851 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedInstr((yyvsp[-1].ast)); }
+#line 7417 "build/basic.tab.c"
+    break;
+
+  case 445: /* basedatline: instruction operandlist "end of line"  */
+#line 2853 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 7423 "build/basic.tab.c"
+    break;
+
+  case 446: /* basedatline: instruction modifierlist "end of line"  */
+#line 2855 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 7429 "build/basic.tab.c"
+    break;
+
+  case 447: /* basedatline: instruction operandlist modifierlist "end of line"  */
+#line 2857 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-3].ast), ListBuilderAdd((yyvsp[-2].list), (yyvsp[-1].list).head).head)); }
+#line 7435 "build/basic.tab.c"
+    break;
+
+  case 448: /* basedatline: "alignl" "end of line"  */
+#line 2859 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, (yyvsp[-1].ast)); }
+#line 7441 "build/basic.tab.c"
+    break;
+
+  case 449: /* basedatline: "alignw" "end of line"  */
+#line 2861 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, (yyvsp[-1].ast)); }
+#line 7447 "build/basic.tab.c"
+    break;
+
+  case 450: /* basedatline: "org" "end of line"  */
+#line 2863 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7453 "build/basic.tab.c"
+    break;
+
+  case 451: /* basedatline: "org" pasmexpr "end of line"  */
+#line 2865 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7459 "build/basic.tab.c"
+    break;
+
+  case 452: /* basedatline: "orgh" "end of line"  */
+#line 2867 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7465 "build/basic.tab.c"
+    break;
+
+  case 453: /* basedatline: "orgh" pasmexpr "end of line"  */
+#line 2869 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7471 "build/basic.tab.c"
+    break;
+
+  case 454: /* basedatline: "orgf" pasmexpr "end of line"  */
+#line 2871 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7477 "build/basic.tab.c"
+    break;
+
+  case 455: /* basedatline: "res" pasmexpr "end of line"  */
+#line 2873 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_RES, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7483 "build/basic.tab.c"
+    break;
+
+  case 456: /* basedatline: "fit" pasmexpr "end of line"  */
+#line 2875 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7489 "build/basic.tab.c"
+    break;
+
+  case 457: /* basedatline: "fit" "end of line"  */
+#line 2877 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, (yyvsp[-1].ast)); }
+#line 7495 "build/basic.tab.c"
+    break;
+
+  case 458: /* basedatline: "if" expr "end of line"  */
+#line 2879 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_IF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7501 "build/basic.tab.c"
+    break;
+
+  case 459: /* basedatline: "else" "end of line"  */
+#line 2881 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_ELSEIF, AstInteger(1), NULL, (yyvsp[-1].ast)); }
+#line 7507 "build/basic.tab.c"
+    break;
+
+  case 460: /* basedatline: "end" "end of line"  */
+#line 2883 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_ENDIF, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7513 "build/basic.tab.c"
+    break;
+
+  case 461: /* basedatline: "file" "literal string" "end of line"  */
+#line 2885 "frontends/basic/basic.y"
+    { (yyval.ast) = NewCommentedAST(AST_FILE, GetFullFileName((yyvsp[-1].ast)), NULL, (yyvsp[-2].ast)); }
+#line 7519 "build/basic.tab.c"
+    break;
+
+  case 462: /* operand: pasmexpr  */
+#line 2890 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 7525 "build/basic.tab.c"
+    break;
+
+  case 463: /* operand: '#' pasmexpr  */
+#line 2892 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 7531 "build/basic.tab.c"
+    break;
+
+  case 464: /* operand: '#' '#' pasmexpr  */
+#line 2894 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 7537 "build/basic.tab.c"
+    break;
+
+  case 465: /* operand: pasmexpr '[' pasmexpr ']'  */
+#line 2896 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL); }
+#line 7543 "build/basic.tab.c"
+    break;
+
+  case 466: /* operand: pasmexpr '+' '+'  */
+#line 2898 "frontends/basic/basic.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, AstOperator(K_INCREMENT, (yyvsp[-2].ast), NULL), NULL); }
+#line 7549 "build/basic.tab.c"
+    break;
+
+  case 467: /* pasmexpr: expr  */
+#line 2903 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 7555 "build/basic.tab.c"
+    break;
+
+  case 468: /* pasmexpr: '\\' expr  */
+#line 2905 "frontends/basic/basic.y"
+    { (yyval.ast) = AstCatch((yyvsp[0].ast)); }
+#line 7561 "build/basic.tab.c"
+    break;
+
+  case 469: /* pasmexpr: "hardware register"  */
+#line 2907 "frontends/basic/basic.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 7567 "build/basic.tab.c"
+    break;
+
+  case 470: /* operandlist: operand  */
+#line 2912 "frontends/basic/basic.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7573 "build/basic.tab.c"
+    break;
+
+  case 471: /* operandlist: operandlist ',' operand  */
+#line 2914 "frontends/basic/basic.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 7579 "build/basic.tab.c"
+    break;
+
+  case 472: /* instruction: "asm instruction"  */
+#line 2919 "frontends/basic/basic.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 7585 "build/basic.tab.c"
+    break;
+
+  case 473: /* instruction: instrmodifier instruction  */
+#line 2921 "frontends/basic/basic.y"
+  { (yyval.ast) = AddToList((yyvsp[0].ast), (yyvsp[-1].ast)); }
+#line 7591 "build/basic.tab.c"
+    break;
+
+  case 474: /* instrmodifier: "asm instruction modifier"  */
+#line 2926 "frontends/basic/basic.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 7597 "build/basic.tab.c"
+    break;
+
+  case 475: /* modifierlist: instrmodifier  */
+#line 2931 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7603 "build/basic.tab.c"
+    break;
+
+  case 476: /* modifierlist: modifierlist instrmodifier  */
+#line 2933 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 7609 "build/basic.tab.c"
+    break;
+
+  case 477: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2935 "frontends/basic/basic.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 7615 "build/basic.tab.c"
+    break;
+
+
+#line 7619 "build/basic.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == BASICYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= BASICYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == BASICYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = BASICYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != BASICYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 2938 "frontends/basic/basic.y"
+
+void
+basicyyerror(const char *msg)
+{
+    extern int saved_basicyychar;
+    int yychar = saved_basicyychar;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "syntax error, unexpected end of file");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");     
+    gl_errors++;
+    RESETCOLOR();
+}
@@ -0,0 +1,230 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED
+# define YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef BASICYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define BASICYYDEBUG 1
+#  else
+#   define BASICYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define BASICYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined BASICYYDEBUG */
+#if BASICYYDEBUG
+extern int basicyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef BASICYYTOKENTYPE
+# define BASICYYTOKENTYPE
+  enum basicyytokentype
+  {
+    BASICYYEMPTY = -2,
+    BASICYYEOF = 0,                /* "end of file"  */
+    BASICYYerror = 256,            /* error  */
+    BASICYYUNDEF = 257,            /* "invalid token"  */
+    BAS_EMPTY = 258,               /* "_"  */
+    BAS_IDENTIFIER = 259,          /* "identifier"  */
+    BAS_LABEL_INFERRED = 260,      /* "label"  */
+    BAS_LABEL_EXPLICIT = 261,      /* "label:"  */
+    BAS_INTEGER = 262,             /* "integer number"  */
+    BAS_FLOAT = 263,               /* "number"  */
+    BAS_STRING = 264,              /* "literal string"  */
+    BAS_EOLN = 265,                /* "end of line"  */
+    BAS_EOF = 266,                 /* "end of file"  */
+    BAS_TYPENAME = 267,            /* "type name"  */
+    BAS_INSTR = 268,               /* "asm instruction"  */
+    BAS_INSTRMODIFIER = 269,       /* "asm instruction modifier"  */
+    BAS_HWREG = 270,               /* "hardware register"  */
+    BAS_ALIGNL = 271,              /* "alignl"  */
+    BAS_ALIGNW = 272,              /* "alignw"  */
+    BAS_FILE = 273,                /* "file"  */
+    BAS_FIT = 274,                 /* "fit"  */
+    BAS_ORG = 275,                 /* "org"  */
+    BAS_ORGF = 276,                /* "orgf"  */
+    BAS_ORGH = 277,                /* "orgh"  */
+    BAS_RES = 278,                 /* "res"  */
+    BAS_ABS = 279,                 /* "abs"  */
+    BAS_ALIAS = 280,               /* "alias"  */
+    BAS_AND = 281,                 /* "and"  */
+    BAS_ANDALSO = 282,             /* "andalso"  */
+    BAS_ANY = 283,                 /* "any"  */
+    BAS_APPEND = 284,              /* "append"  */
+    BAS_AS = 285,                  /* "as"  */
+    BAS_ASC = 286,                 /* "asc"  */
+    BAS_ASM = 287,                 /* "asm"  */
+    BAS_ALLOCA = 288,              /* "__builtin_alloca"  */
+    BAS_BOOLEAN = 289,             /* "boolean"  */
+    BAS_BYREF = 290,               /* "byref"  */
+    BAS_BYTE = 291,                /* "byte"  */
+    BAS_BYVAL = 292,               /* "byval"  */
+    BAS_CALL = 293,                /* "call"  */
+    BAS_CASE = 294,                /* "case"  */
+    BAS_CAST = 295,                /* "cast"  */
+    BAS_CATCH = 296,               /* "catch"  */
+    BAS_CHAIN = 297,               /* "chain"  */
+    BAS_CLASS = 298,               /* "class"  */
+    BAS_CLOSE = 299,               /* "close"  */
+    BAS_CONST = 300,               /* "const"  */
+    BAS_CONTINUE = 301,            /* "continue"  */
+    BAS_CPU = 302,                 /* "cpu"  */
+    BAS_DATA = 303,                /* "data"  */
+    BAS_DECLARE = 304,             /* "declare"  */
+    BAS_DEF = 305,                 /* "def"  */
+    BAS_DEFINT = 306,              /* "defint"  */
+    BAS_DEFSNG = 307,              /* "defsng"  */
+    BAS_DELETE = 308,              /* "delete"  */
+    BAS_DIM = 309,                 /* "dim"  */
+    BAS_DIRECTION = 310,           /* "direction"  */
+    BAS_DO = 311,                  /* "do"  */
+    BAS_DOUBLE = 312,              /* "double"  */
+    BAS_ELSE = 313,                /* "else"  */
+    BAS_END = 314,                 /* "end"  */
+    BAS_ENDIF = 315,               /* "endif"  */
+    BAS_ENUM = 316,                /* "enum"  */
+    BAS_EXIT = 317,                /* "exit"  */
+    BAS_EXTERN = 318,              /* "extern"  */
+    BAS_FIXED = 319,               /* "fixed"  */
+    BAS_FOR = 320,                 /* "for"  */
+    BAS_FUNCTION = 321,            /* "function"  */
+    BAS_FUNC_NAME = 322,           /* "__FUNCTION__"  */
+    BAS_GET = 323,                 /* "get"  */
+    BAS_GOTO = 324,                /* "goto"  */
+    BAS_GOSUB = 325,               /* "gosub"  */
+    BAS_HASMETHOD = 326,           /* "_hasmethod"  */
+    BAS_IF = 327,                  /* "if"  */
+    BAS_IMPLEMENTS = 328,          /* "implements"  */
+    BAS_IMPORT = 329,              /* "import"  */
+    BAS_INPUT = 330,               /* "input"  */
+    BAS_CAST_INT = 331,            /* "int"  */
+    BAS_INTEGER_KW = 332,          /* "integer"  */
+    BAS_INTERFACE = 333,           /* "interface"  */
+    BAS_LEN = 334,                 /* "len"  */
+    BAS_LET = 335,                 /* "let"  */
+    BAS_LIB = 336,                 /* "lib"  */
+    BAS_LINE = 337,                /* "line"  */
+    BAS_LONG = 338,                /* "long"  */
+    BAS_LONGINT = 339,             /* "longint"  */
+    BAS_LOOP = 340,                /* "loop"  */
+    BAS_MOD = 341,                 /* "mod"  */
+    BAS_NEW = 342,                 /* "new"  */
+    BAS_NEXT = 343,                /* "next"  */
+    BAS_NIL = 344,                 /* "nil"  */
+    BAS_NOT = 345,                 /* "not"  */
+    BAS_OFFSETOF = 346,            /* "offsetof"  */
+    BAS_ON = 347,                  /* "on"  */
+    BAS_OPEN = 348,                /* "open"  */
+    BAS_OPTION = 349,              /* "option"  */
+    BAS_OR = 350,                  /* "or"  */
+    BAS_ORELSE = 351,              /* "orelse"  */
+    BAS_OUTPUT = 352,              /* "output"  */
+    BAS_POINTER = 353,             /* "pointer"  */
+    BAS_PRESERVE = 354,            /* "preserve"  */
+    BAS_PRINT = 355,               /* "print"  */
+    BAS_PRIVATE = 356,             /* "private"  */
+    BAS_PROGRAM = 357,             /* "program"  */
+    BAS_PTR = 358,                 /* "ptr"  */
+    BAS_PUT = 359,                 /* "put"  */
+    BAS_READ = 360,                /* "read"  */
+    BAS_REDIM = 361,               /* "redim"  */
+    BAS_REGISTER = 362,            /* "register"  */
+    BAS_RESTORE = 363,             /* "restore"  */
+    BAS_RETURN = 364,              /* "return"  */
+    BAS_SAMETYPES = 365,           /* "_sametypes"  */
+    BAS_SELECT = 366,              /* "select"  */
+    BAS_SELF = 367,                /* "self"  */
+    BAS_SHARED = 368,              /* "shared"  */
+    BAS_SHORT = 369,               /* "short"  */
+    BAS_SINGLE = 370,              /* "single"  */
+    BAS_SIZEOF = 371,              /* "sizeof"  */
+    BAS_SQRT = 372,                /* "sqrt"  */
+    BAS_STEP = 373,                /* "step"  */
+    BAS_STRING_KW = 374,           /* "string"  */
+    BAS_STRUCT = 375,              /* "struct"  */
+    BAS_SUB = 376,                 /* "sub"  */
+    BAS_THEN = 377,                /* "then"  */
+    BAS_THROW = 378,               /* "throw"  */
+    BAS_THROWIFCAUGHT = 379,       /* "throwifcaught"  */
+    BAS_TO = 380,                  /* "to"  */
+    BAS_TRY = 381,                 /* "try"  */
+    BAS_TYPE = 382,                /* "type"  */
+    BAS_UBYTE = 383,               /* "ubyte"  */
+    BAS_UINTEGER = 384,            /* "uinteger"  */
+    BAS_ULONG = 385,               /* "ulong"  */
+    BAS_ULONGINT = 386,            /* "ulongint"  */
+    BAS_UNION = 387,               /* "union"  */
+    BAS_UNTIL = 388,               /* "until"  */
+    BAS_USHORT = 389,              /* "ushort"  */
+    BAS_USING = 390,               /* "using"  */
+    BAS_VAR = 391,                 /* "var"  */
+    BAS_WEND = 392,                /* "wend"  */
+    BAS_WITH = 393,                /* "with"  */
+    BAS_WHILE = 394,               /* "while"  */
+    BAS_WORD = 395,                /* "word"  */
+    BAS_XOR = 396,                 /* "xor"  */
+    BAS_LE = 397,                  /* "<="  */
+    BAS_GE = 398,                  /* ">="  */
+    BAS_NE = 399,                  /* "<>"  */
+    BAS_SHL = 400,                 /* "shl"  */
+    BAS_SHR = 401,                 /* "shr"  */
+    BAS_ABSADDR = 402,             /* "@@@"  */
+    BAS_ADD_ASSIGN = 403,          /* "+="  */
+    BAS_SUB_ASSIGN = 404,          /* "-="  */
+    BAS_MUL_ASSIGN = 405,          /* "*="  */
+    BAS_DIV_ASSIGN = 406,          /* "/="  */
+    BAS_MOD_ASSIGN = 407,          /* "MOD="  */
+    BAS_AND_ASSIGN = 408,          /* "AND="  */
+    BAS_OR_ASSIGN = 409,           /* "OR="  */
+    BAS_XOR_ASSIGN = 410           /* "XOR="  */
+  };
+  typedef enum basicyytokentype basicyytoken_kind_t;
+#endif
+
+/* Value type.  */
+
+
+
+
+int basicyyparse (void);
+
+
+#endif /* !YY_BASICYY_BUILD_BASIC_TAB_H_INCLUDED  */
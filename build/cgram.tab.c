@@ -0,0 +1,7683 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         CGRAMYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         cgramyyparse
+#define yylex           cgramyylex
+#define yyerror         cgramyyerror
+#define yydebug         cgramyydebug
+#define yynerrs         cgramyynerrs
+
+/* First part of user prologue.  */
+#line 9 "frontends/c/cgram.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <stdlib.h>
+#include "frontends/common.h"
+#include "frontends/lexer.h"
+
+    extern AST *BuildDebugList(AST *, AST *); /* in frontends/printdebug.c */
+    
+#undef  YYSTYPE
+#define YYSTYPE CGRAMYYSTYPE
+#define IN_DAT 1
+    
+/* special flag */
+    AST *ast_type_c_signed = NULL;
+    AST *ast_type_c_long = NULL;
+    
+/* Yacc functions */
+    void cgramyyerror(const char *);
+    int cgramyylex(CGRAMYYSTYPE *);
+
+    extern int gl_errors;
+
+    extern AST *last_ast;
+    extern AST *CommentedListHolder(AST *); // in spin.y
+
+#define YYERROR_VERBOSE 1
+
+extern int allow_type_names;
+
+static void
+DisallowTypeNames()
+{
+    allow_type_names = 0;
+}
+
+static void
+AllowTypeNames()
+{
+    allow_type_names = 1;
+}
+
+static AST *
+MakeSigned(AST *type, int isSigned)
+{
+    if (!type) return type;
+    if (type->kind == AST_INTTYPE) {
+        if (isSigned) return type;
+        return NewAST(AST_UNSIGNEDTYPE, type->left, NULL);
+    }
+    if (type->kind == AST_UNSIGNEDTYPE) {
+        if (!isSigned) return type;
+        return NewAST(AST_INTTYPE, type->left, NULL);
+    }
+    type->left = MakeSigned(type->left, isSigned);
+    return type;
+}
+static AST *
+LengthenType(AST *type)
+{
+    if (!type) {
+        return ast_type_c_long;
+    }
+    if (type == ast_type_c_long) {
+        // "long long" -> 8 byte type
+        return NewAST(AST_INTTYPE, AstInteger(8), NULL);
+    }
+    if (type->kind == AST_FLOATTYPE) {
+        // "long double" -> 8 byte double
+        return NewAST(AST_FLOATTYPE, AstInteger(8), NULL);
+    }
+    // otherwise make sure it is 4 bytes long
+    // and that further lengthening it will make it 8 bytes
+    return ast_type_c_long;
+}
+
+static AST *
+LabelName(AST *x)
+{
+    const char *orig_name = GetUserIdentifierName(x);
+    char *new_name;
+
+    if (!orig_name) return x;
+    new_name = (char *)calloc(strlen(orig_name) + 8, 1);
+    strcpy(new_name, "label:");
+    strcat(new_name, orig_name);
+    return AstIdentifier(new_name);
+}
+
+static AST *CombineTypes(AST *first, AST *second, AST **identifier, Module **module);
+
+static AST *
+C_ModifySignedUnsigned(AST *modifier, AST *type)
+{
+    if (modifier == ast_type_c_signed) {
+        type = MakeSigned(type, 1);
+    } else if (modifier == ast_type_unsigned_long) {
+        type = MakeSigned(type, 0);
+    } else if (modifier == ast_type_c_long) {
+    // we need to be able to distinguish between
+    // "long long" and "long int"
+        type = LengthenType(type);
+    } else {
+        type = CombineTypes(modifier, type, NULL, NULL);
+    }
+    return type;
+}
+
+static AST *
+CombinePointer(AST *ptr, AST *type)
+{
+    AST *q = ptr;
+    while (q && q->left) {
+        q = q->left;
+    }
+    if (q) {
+        q->left = type;
+    }
+    return ptr;
+}
+
+Module *
+FindClassByAst(AST *astName)
+{
+    const char *name = GetUserIdentifierName(astName);
+    Module *P = NULL;
+    Symbol *sym = LookupSymbolInTable(currentTypes, name);
+    if (sym && sym->kind == SYM_TYPEDEF) {
+        AST *typ = (AST *)sym->v.ptr;
+        if (typ->kind != AST_OBJECT) {
+            ERROR(astName, "%s is not a class", name);
+            return NULL;
+        }
+        P = GetClassPtr(typ);
+    }
+    if (!P) {
+        ERROR(astName, "cannot find class %s", name);
+    }
+    return P;
+}
+
+static AST *MergePrefix(AST *prefix, AST *first)
+{
+    if (prefix) {
+        AST *register_pre = NULL;
+        AST *static_pre = NULL;
+        AST *extern_pre = NULL;
+        AST *annote_pre = NULL;
+        
+        // make sure we migrate INLINE, REGISTER, STATIC and EXTERN to the front of the list
+        if (first && first->kind == AST_REGISTER) {
+            first = first->left;
+            prefix = AddToLeftList(prefix, NewAST(AST_REGISTER, NULL, NULL));
+        }
+        while (first) {
+            if (first->kind == AST_REGISTER) {
+                register_pre = first;
+            } else if (first->kind == AST_STATIC) {
+                static_pre = first;
+            } else if (first->kind == AST_EXTERN) {
+                extern_pre = first;
+            } else if (first->kind == AST_ANNOTATION) {
+                annote_pre = first;
+            } else {
+                break;
+            }
+            first = first->left;
+        }
+        // add in reverse order
+        if (extern_pre) {
+            extern_pre->left = prefix;
+            prefix = extern_pre;
+        }
+        if (static_pre) {
+            static_pre->left = prefix;
+            prefix = static_pre;
+        }
+        if (register_pre) {
+            register_pre->left = prefix;
+            prefix = register_pre;
+        }
+        if (annote_pre) {
+            annote_pre->left = prefix;
+            prefix = annote_pre;
+        }
+
+        first = AddToLeftList(prefix, first);
+    }
+    return first;
+}
+
+static AST *
+CombineTypes(AST *first, AST *second, AST **identifier, Module **module)
+{
+    AST *expr, *ident;
+    AST *prefix = NULL;
+    
+    if (second && second->kind == AST_COMMENT) {
+        second = NULL;
+    }
+    if (first && first->kind == AST_COMMENT) {
+        first = NULL;
+    }
+    if (!second || first == second) {
+        return first;
+    }
+    while (first && (first->kind == AST_STATIC || first->kind == AST_TYPEDEF || first->kind == AST_EXTERN || first->kind == AST_REGISTER || first->kind == AST_ANNOTATION)) {
+        AST *dup = DupAST(first);
+        first = first->left;
+        dup->left = NULL;
+        if (prefix) {
+            prefix->left = dup;
+        } else {
+            prefix = dup;
+        }
+    }
+    switch (second->kind) {
+    case AST_DECLARE_VAR:
+        first = CombineTypes(first, second->left, identifier, module);
+        first = CombineTypes(first, second->right, identifier, module);
+        return MergePrefix(prefix, first);
+    case AST_METHODREF:
+        if (module) {
+            if (*module) {
+                ERROR(second, "flexspin only supports one :: in declarations");
+            } else {
+                *module = FindClassByAst(second->left);
+            }
+            second = second->right;
+        }
+        /* fall through */
+    case AST_SYMBOL:
+    case AST_LOCAL_IDENTIFIER:
+    case AST_IDENTIFIER:
+        if (identifier) {
+            *identifier = second;
+        }
+        return MergePrefix(prefix, first);
+    case AST_ARRAYDECL:
+    case AST_ARRAYTYPE:
+        first = NewAST(AST_ARRAYTYPE, first, second->right);
+        return MergePrefix(prefix, CombineTypes(first, second->left, identifier, module));
+    case AST_REFTYPE:
+    case AST_PTRTYPE:
+        if (identifier || !IsFunctionType(second->left)) {
+            first = NewAST(second->kind, first, NULL);
+        }
+        second = CombineTypes(first, second->left, identifier, module);
+        return MergePrefix(prefix, second);
+        
+    case AST_FUNCTYPE:
+        second->left = CombineTypes(first, second->left, identifier,  module);
+        return MergePrefix(prefix, second);
+    case AST_ASSIGN:
+        expr = second->right;
+        first = CombineTypes(first, second->left, &ident, module);
+        ident = AstAssign(ident, expr);
+        if (identifier) {
+            *identifier = ident;
+        }
+        return MergePrefix(prefix, first);
+    case AST_MODIFIER_CONST:
+    case AST_MODIFIER_VOLATILE:
+        expr = NewAST(second->kind, NULL, NULL);
+        second = MergePrefix(prefix, CombineTypes(first, second->left, identifier, module));
+        expr->left = second;
+        return expr;
+    case AST_BITFIELD:
+        // first == type
+        // second == BITFIELD(ident, size)
+        // -> BITFIELD(type, size)
+        if (identifier) {
+            *identifier = second->left;
+        }
+        second->left = first;
+        return second;
+    case AST_ANNOTATION: {
+        Module *P = GetClassPtr(first);
+        if (!P) {
+            WARNING(second, "Ignoring attributes on non aggregate type");
+            return first;
+        }
+        if (FindAnnotation(second, "packed")) {
+            P->isPacked = true;
+            if (!gl_p2) {
+                WARNING(second, "on P1, member alignment is forced even for packed structs");
+            }
+        }
+        return first;
+    }
+    default:
+        if (first && second && first == ast_type_signed_word) {
+            if (TypeSize(second) == 4 && IsUnsignedType(second)) {
+                second = DupAST(ast_type_word);
+                first = NULL;
+            }
+        }
+        if (!first) {
+            return MergePrefix(prefix, second);
+        }
+        if (second && second == ast_type_long) {
+            return first;
+        }
+        ERROR(first ? first : second, "Unable to combine types");
+        return first;
+    }
+}
+
+static AST *
+DeclareStatics(Module *P, AST *basetype, AST *decllist)
+{
+    AST *ident;
+    AST *decl;
+    AST *nameAst;
+    AST *globalname;
+    AST *results = NULL;
+    const char *nameString;
+    int needs_initializer = 0;
+    int has_initializer;
+    int inSubModule = !IsTopLevel(P);
+    
+    // ignore static declarations like
+    //   static int blah[]
+    if (basetype && basetype->kind == AST_ARRAYTYPE && !basetype->right) {
+        needs_initializer = 1;
+    }
+    // go through the identifier list
+    while (decllist) {
+        has_initializer = 0;
+        if (decllist->kind == AST_LISTHOLDER) {
+            decl = decllist->left;
+            decllist = decllist->right;
+        } else {
+            decl = decllist;
+            decllist = NULL;
+        }
+        if (decl->kind == AST_ASSIGN) {
+            ident = decl->left;
+            has_initializer = 1;
+        } else {
+            ident = decl;
+        }
+        if (ident->kind == AST_ARRAYDECL) {
+            nameAst = ident->left;
+        } else {
+            nameAst = ident;
+        }
+        if (needs_initializer && !has_initializer) {
+            continue;
+        }
+        if (nameAst->kind == AST_LOCAL_IDENTIFIER) {
+            // we have to be very careful here; a new static declaration
+            // for an identifier needs to override an existing static in
+            // an outer scope
+            Symbol *sym;
+            const char *idstr = GetUserIdentifierName(nameAst);
+            // use FindSymbol to look only in current tables, not enclosing
+            // ones
+            sym = FindSymbol(currentTypes, idstr);
+            if (!sym) {
+                *nameAst = *nameAst->right; // create a new local
+            }
+        }
+        if (nameAst->kind == AST_LOCAL_IDENTIFIER || inSubModule) {
+            DeclareOneGlobalVar(P, decl, basetype, IN_DAT);
+        } else {
+            // OK, "nameAst" is the name we want it to be known as inside
+            // the function, but we will want to create a global variable
+            // with a new name
+
+            nameString = GetIdentifierName(nameAst);
+            globalname = AstTempIdentifier(nameString);
+            EnterLocalAlias(currentTypes, globalname, nameString);
+            // and enter a new global definition
+            *nameAst = *globalname;
+            DeclareOneGlobalVar(P, decl, basetype, IN_DAT);
+        }
+    }
+    return results;
+}
+
+static AST *IsGlobalRegisterDecl(AST *type)
+{
+    if (!type || !type->left) return NULL;
+    
+    if ( (type->kind == AST_EXTERN && type->left->kind == AST_REGISTER)
+         || (type->kind == AST_REGISTER && type->left->kind == AST_EXTERN) )
+    {
+        type = type->left->left;
+        return type;
+    }
+    return NULL;
+}
+
+bool IsStaticType(AST *type) {
+    while (type && type->kind == AST_ANNOTATION)
+        type = type->left;
+    return type && type->kind == AST_STATIC;
+}
+
+AST *ExtractStaticType(AST *type) {
+    AST *annotations = NULL;
+    while (type && type->kind == AST_ANNOTATION) {
+        AST *item = DupAST(type);
+        item->left = annotations;
+        item->right = NULL;
+        annotations = item;
+        type = type->left;
+    }
+    if (type && type->kind == AST_STATIC) {
+        type = type->left;
+    }
+    // preserve the annotations
+    if (annotations) {
+        AST *base = type;
+        type = annotations;
+        while (annotations->left) {
+            annotations = annotations->left;
+        }
+        annotations->left = base;
+    }
+    return type;
+}
+
+static AST *
+MultipleDeclareVar(AST *first, AST *second)
+{
+    AST *ident, *type;
+    ListBuilder stmtlist = { NULL, NULL };
+    AST *item;
+    Module *module = NULL;
+    AST *regtype = NULL;
+    
+    while (second) {
+        if (second->kind != AST_LISTHOLDER) {
+            ERROR(second, "internal error in createVarDeclarations: expected listholder");
+            return stmtlist.head;
+        }
+        item = second->left;
+        second = second->right;
+        type = CombineTypes(first, item, &ident, &module);
+        if (module) {
+            ERROR(first, ":: not supported yet");
+        }
+        if (IsStaticType(type)) {
+            stmtlist = ListBuilderAdd(stmtlist, DeclareStatics(current, ExtractStaticType(type), ident));
+        } else if ( NULL != (regtype = IsGlobalRegisterDecl(type)) ) {
+            /* declare a register global variable */
+            ident = NewAST(AST_DECLARE_VAR, regtype, ident);
+            DeclareTypedRegisterVariables(ident);
+        } else if (type && (type->kind == AST_EXTERN || (IsConstArrayType(type) && IsConstInitializer(ident)) ) ) {
+            if (type->kind == AST_EXTERN) type = type->left;
+            /* declare a global variable */
+            ident = NewAST(AST_DECLARE_VAR, type, ident);
+            DeclareTypedGlobalVariables(ident, 1); // "extern" variables are always in DAT
+        } else {
+            while (type && type->kind == AST_REGISTER) {
+                type = type->left;
+            }
+            ident = NewAST(AST_DECLARE_VAR, type, ident);
+            stmtlist = ListBuilderAdd(stmtlist, NewAST(AST_STMTLIST, ident, NULL));
+        }
+    }
+    return stmtlist.head;
+}
+
+AST *
+SingleDeclareInitedVar(AST *decl_spec, AST *declarator, AST *initval)
+{
+    AST *type, *ident;
+    Module *module = NULL;
+    
+    ident = NULL;
+    type = CombineTypes(decl_spec, declarator, &ident, &module);
+    if (type && type->kind == AST_EXTERN) {
+        // just ignore EXTERN declarations
+        return NULL;
+    }
+    if (!ident && !type) {
+        return NULL;
+    }
+    if (module) {
+        ERROR(declarator, ":: not supported for variable declarations yet");
+    }
+    while (type && type->kind == AST_REGISTER) {
+        type = type->left;
+    }
+    if (initval) {
+        ident = NewAST(AST_ASSIGN, ident, initval);
+    }
+    return NewAST(AST_DECLARE_VAR, type, ident);
+}
+
+AST *
+SingleDeclareVar(AST *decl_spec, AST *declarator)
+{
+    return SingleDeclareInitedVar(decl_spec, declarator, NULL);
+}
+
+static void
+DeclareCGlobalVariables(AST *slist)
+{
+    AST *temp;
+    int inDat;
+
+    if (!current || IsTopLevel(current) || !strcmp(current->classname, "_system_")) {
+        inDat = 1;
+    } else {
+//        inDat = 0;
+        inDat = current->fromUsing ? 0 : 1;
+    }
+    if (slist && slist->kind == AST_DECLARE_VAR) {
+        DeclareTypedGlobalVariables(slist, inDat);
+        return;
+    }
+    while (slist) {
+        if (slist->kind != AST_STMTLIST) {
+            ERROR(slist, "internal error in DeclareCGlobalVars");
+        }
+        temp = slist->left;
+        DeclareTypedGlobalVariables(temp, inDat);
+        slist = slist->right;
+    }
+}
+
+/* process a parameter list and fix it up as necessary */
+static AST *
+ProcessParamList(AST *list)
+{
+    AST *entry, *type;
+    int count = 0;
+    AST *orig_list = list;
+    
+    if (list->kind == AST_EXPRLIST) {
+        while (list) {
+            entry = list->left;
+            list->left = NewAST(AST_DECLARE_VAR, ast_type_long, entry);
+            list->kind = AST_LISTHOLDER;
+            list = list->right;
+        }
+        list = orig_list;
+    }
+    while (list) {
+        entry = list->left;
+        list = list->right;
+        if (entry == ast_type_void) {
+            if (list || count) {
+                SYNTAX_ERROR("void should appear alone in a parameter list");
+            }
+            return NULL;
+        }
+        if (entry && entry->kind == AST_DECLARE_VAR) {
+            type = entry->left;
+            while (type->kind == AST_MODIFIER_CONST || type->kind == AST_MODIFIER_VOLATILE) {
+                type = type->left;
+            }
+            if (type->kind == AST_ARRAYTYPE) {
+                type->kind = AST_PTRTYPE;
+            }
+        }
+        count++;
+    }
+    return orig_list;
+}
+
+/* make sure a statement is embedded in a statement list */
+static AST *
+ForceStatementList(AST *stmt)
+{
+    if (stmt && stmt->kind != AST_STMTLIST) {
+        return NewAST(AST_STMTLIST, stmt, NULL);
+    }
+    return stmt;
+}
+
+static AST *
+AddEnumerators(AST *identifier, AST *enumlist)
+{
+    AST *resetZero = NewAST(AST_ENUMSET, AstInteger(0), NULL);
+    Module *P;
+    enumlist = NewAST(AST_LISTHOLDER, resetZero, enumlist);
+
+    if (current->curLanguage == LANG_CFAMILY_C) {
+        // enum symbols in C get declared with global scope
+        P = GetTopLevelModule();
+        if (P->curLanguage != LANG_CFAMILY_C) {
+            // handle the case where a C file is included as a module
+            // in another language
+            P = current;
+        }
+    } else {
+        // in C++ enums get declared in the context of the class
+        // they're declared in
+        P = current;
+    }
+    // we have to process the enumerators now so that they may be used
+    // in struct definitions and such
+    P->conblock = AddToList(P->conblock, enumlist);
+    DeclareConstants(P, &P->conblock);
+    P->conblock = NULL;
+    return ast_type_long;
+}
+
+static void
+DeclareCMemberVariables(Module *P, AST *astlist, int is_union)
+{
+    AST *idlist, *typ;
+    AST *ident;
+    AST *ast;
+    BitFieldState bitfield = { 0 };
+    int is_private = -P->defaultPrivate;
+    
+    if (!astlist) return;
+    if (astlist->kind != AST_STMTLIST) {
+        ERROR(astlist, "Internal error, expected stmt list");
+        return;
+    }
+    if (is_union) {
+        P->isUnion = 1;
+    }
+    while (astlist) {
+        ast = astlist->left;
+        astlist = astlist->right;
+        if (ast->kind == AST_PUBFUNC) {
+            is_private = 0;
+            continue;
+        }
+        if (ast->kind == AST_PRIFUNC) {
+            is_private = 1;
+            continue;
+        }
+        if (is_private == -1) {
+            WARNING(ast, "declarations in class with no explicit public or private; assuming private");
+            is_private = 1;
+        }
+        if (ast->kind == AST_FUNCDECL) {
+            AST *type;
+            AST *ident;
+            AST *body;
+            int is_public = !is_private;
+            AST *list = ast->left;
+            if (list->kind != AST_LISTHOLDER) {
+                ERROR(list, "malformed func decl");
+                return;
+            }
+            type = list->left; list = list->right;
+            ident = list->left; list = list->right;
+            body = list->left;
+            DeclareTypedFunction(P, type, ident, is_public, body, NULL, NULL);
+            continue;
+        }
+        if (ast->kind != AST_DECLARE_VAR) {
+            ERROR(ast, "internal error, not DECLARE_VAR");
+            return;
+        }
+        idlist = ast->right;
+        typ = ast->left;
+        if (idlist->kind == AST_LISTHOLDER) {
+            if (typ->kind == AST_BITFIELD) {
+                ERROR(typ, "Internal error, bitfield in a list");
+                typ = typ->left;
+            }
+            while (idlist) {
+                ident = idlist->left;
+                MaybeDeclareMemberVar(P, ident, typ, is_private, NORMAL_VAR, &bitfield);
+                idlist = idlist->right;
+            }
+        } else {
+            ident = idlist;
+            MaybeDeclareMemberVar(P, ident, typ, is_private, NORMAL_VAR, &bitfield);
+        }
+    }
+
+}
+
+static void
+AddStructBody(Module *C, AST *body)
+{
+    if (body) {
+        int is_union = C->isUnion;
+        DeclareCMemberVariables(C, body, is_union);
+        DeclareMemberVariables(C);
+    }
+}
+
+// make a new struct
+// skind is either AST_STRUCT or AST_UNION
+// identifier is NULL or is a struct tag
+// body is the contents of the struct, or NULL
+// if no struct tag is given, we use one generated from the
+// file name and line number
+//
+static AST *
+MakeNewStruct(Module *Parent, AST *skind, AST *identifier, AST *body, AST *options)
+{
+    int is_union = 0;
+    int is_class = 0;
+    int is_packed = 0;
+    const char *name;
+    const char *classname;
+    char *typname;
+    Module *C;
+    Symbol *sym;
+    AST *class_type;
+    AST *attributes = skind->left;
+    
+    if (identifier && identifier->kind == AST_LOCAL_IDENTIFIER) {
+        identifier = identifier->right;
+    }
+    if (Parent->mainLanguage == LANG_CFAMILY_C) {
+        // structs inside structs get declared with global scope
+        Module *Q = GetTopLevelModule();
+        if (Q->mainLanguage == LANG_CFAMILY_C) {
+            Parent = Q;
+        }
+    }
+    /* attempt to better handle class inside class */
+    if (0 && current && !IsTopLevel(current)) {
+        /* this causes problems with struct references inside structs */
+        classname = current->classname;
+    } else {
+        classname = "";
+    }
+    if (skind->kind == AST_STRUCT) {
+        is_union = 0;
+        is_class = skind->d.ival != 0;
+    } else if (skind->kind == AST_UNION) {
+        is_union = 1;
+        is_class = 0;
+    } else {
+        ERROR(skind, "Internal error, not struct or union");
+        return NULL;
+    }
+    if (attributes) {
+        if (FindAnnotation(attributes, "packed")) {
+            is_packed = 1;
+            if (!gl_p2) {
+                WARNING(skind, "on P1 variables must be aligned even in packed structures");
+            }
+        }
+    }
+    bool force_typedef = false;
+    if (!identifier) {
+        // use file name and line number
+        char buf[128];
+        const char *stem_name = current->Lptr->fileName;
+        const char *root = strrchr(stem_name, '/');
+        if (root) stem_name = root+1;
+#ifdef WIN32
+        if (root) root = strrchr(root, '\\');
+        if (root) stem_name = root+1;
+#endif
+        sprintf(buf, "__anon_%s_%08d", stem_name, current->Lptr->lineCounter);
+        identifier = AstIdentifier(strdup(buf));
+        force_typedef = true;
+    }
+    if (!IsIdentifier(identifier)) {
+        ERROR(identifier, "Internal error, bad struct def");
+        return NULL;
+    }
+    name = GetIdentifierName(identifier);
+    typname = (char *)malloc(strlen(name)+strlen(classname)+16);
+    if (force_typedef || LangStructAutoTypedef(current->curLanguage)) {
+        strcpy(typname, name);
+    } else {
+        strcpy(typname, classname);
+        strcat(typname, "_struct__");
+        strcat(typname, name);
+    }
+    /* see if there is already a type with that name */
+    sym = LookupSymbolInTable(currentTypes, typname);
+    if (!sym) {
+        sym = LookupSymbolInTable(&Parent->objsyms, typname);
+    }
+    if (sym && sym->kind == SYM_TYPEDEF) {
+        class_type = (AST *)sym->v.ptr;
+        if (!IsClassType(class_type)) {
+            SYNTAX_ERROR("%s is not a class", typname);
+            return NULL;
+        }
+        C = (Module *)class_type->d.ptr;
+        if (C->isUnion != is_union) {
+            SYNTAX_ERROR("Inconsistent use of union/struct for %s", typname);
+        }
+        if (options) {
+            SYNTAX_ERROR("typedef use with options not supported yet");
+        } else {
+            C->Lptr = current->Lptr;
+        }
+    } else {
+        if (body && body->kind == AST_STRING) {
+            class_type = NewAbstractObjectWithParams(AstIdentifier(typname), body, 1, options);
+            Parent->objblock = AddToList(Parent->objblock, class_type);
+            body = NULL;
+            C = NULL;
+        } else {
+            C = NewModule(typname, LANG_CFAMILY_C);
+            C->defaultPrivate = is_class;
+            C->Lptr = current->Lptr;
+            C->isUnion = is_union;
+            C->isPacked = is_packed;
+            class_type = NewAbstractObjectWithParams(AstIdentifier(typname), NULL, 0, options);
+            class_type->d.ptr = C;
+            AddSymbol(currentTypes, typname, SYM_TYPEDEF, class_type, NULL);
+            AddSymbol(&Parent->objsyms, typname, SYM_TYPEDEF, class_type, NULL);
+            AddSubClass(Parent, C);
+        }
+    }
+    AddStructBody(C, body);
+    return class_type;
+}
+
+//
+// utility function: find a variable in a declaration list
+//
+static AST *
+FindDeclInList(AST *param, AST *decl_list)
+{
+    AST *decl;
+    AST *ident;
+    while (decl_list) {
+        if (decl_list->kind != AST_STMTLIST) {
+            ERROR(decl_list, "Internal error, badly formed declaration list");
+            return NULL;
+        }
+        decl = decl_list->left;
+        if (decl->kind == AST_DECLARE_VAR) {
+            ident = decl->right;
+            if (AstUses(ident, param)) {
+                return DupAST(decl);
+            }
+        }
+        decl_list = decl_list->right;
+    }
+    return NULL;
+}
+
+//
+// convert an old style declaration like:
+//   int strlen(x) char *x; { ... }
+// into
+//   int strlen(char *x) { ... }
+//
+// actually this part just finds the declarations
+//
+AST *
+MergeOldStyleDeclarationList(AST *orig_funcdecl, AST *decl_list)
+{
+    AST *funcdecl = orig_funcdecl;
+    AST *param_list;
+    AST *param;
+    if (!funcdecl) return NULL;
+    while (funcdecl && funcdecl->kind == AST_PTRTYPE) {
+        funcdecl = funcdecl->left;
+    }
+    if (funcdecl->kind != AST_DECLARE_VAR) {
+        ERROR(funcdecl, "Internal error expected declaration");
+        return orig_funcdecl;
+    }
+    if (funcdecl->left->kind != AST_FUNCTYPE) {
+        ERROR(funcdecl, "Expected function declaration");
+        return orig_funcdecl;
+    }
+    funcdecl = funcdecl->left;
+    param_list = funcdecl->right;
+    while(param_list) {
+        AST *newdecl;
+        param = param_list->left;
+        if (!param || param->kind != AST_DECLARE_VAR) {
+            ERROR(param, "Internal error, expecting to find variable");
+            return orig_funcdecl;
+        }
+        // find the corresponding one from decl_list and replace it
+        newdecl = FindDeclInList(param->right, decl_list);
+        if (newdecl) {
+            param_list->left = newdecl;
+        }
+        param_list = param_list->right;
+    }
+    return orig_funcdecl;
+}
+
+/* declare a typed function, optionally using a local identifier (if the function is STATIC) */
+static AST *
+DeclareCTypedFunction(Module *P, AST *ftype, AST *nameAst, int is_public, AST *body, AST *attribute)
+{
+    if (ftype && ftype->kind == AST_ANNOTATION) {
+        if (attribute) {
+            const char *name = nameAst ? GetUserIdentifierName(nameAst) : "";
+            ERROR(attribute, "cannot accept multiple annotations (like __attribute__ or inline) on function %s", name);
+        } else {
+            attribute = ftype;
+            ftype = ftype->left;
+            attribute->left = NULL;
+        }
+    }
+    if (ftype && ftype->kind == AST_EXTERN) {
+        ftype = ftype->left;
+    }
+    if (IsStaticType(ftype) && nameAst->kind == AST_IDENTIFIER) {
+        /* declare a local alias for the name */
+        const char *nameString = GetIdentifierName(nameAst);
+        AST *globalName = AstTempIdentifier(nameString);
+        AST *origName = nameAst;
+        EnterLocalAlias(currentTypes, globalName, nameString);
+        nameAst = NewAST(AST_LOCAL_IDENTIFIER, globalName, nameAst);
+        if (body && body->kind == AST_STRING) {
+            ERROR(body, "__fromfile references cannot be declared static");
+        } else {
+            // we have to fix up the body of the function so that references
+            // to the original name are replaced with the new name
+            ReplaceAst(body, origName, nameAst);
+        }
+    }
+    const char *name = GetIdentifierName(nameAst);
+
+    // handle some special cases
+
+    // if "main" is declared as "main(argc, argv) we need ARGV processing
+    if (!strcmp(name, "main")) {
+        // check for parameters
+        AST *params = ftype ? ftype->right : NULL;
+        if (AstListLen(params) > 1) {
+            gl_cenv_flags |= CENV_CHECK_ARGV;
+        }
+    }
+    return DeclareTypedFunction(P, ftype, nameAst, is_public, body, attribute, NULL);
+}
+
+static AST *
+ConstructDefaultValue(AST *decl, AST *val)
+{
+    AST *ident;
+    AST *ast;
+    if (!val) {
+        return decl;
+    }
+    if (!decl || decl->kind != AST_DECLARE_VAR) {
+        ERROR(decl, "Internal error, expected variable declaration");
+        return decl;
+    }
+    ident = decl->right;
+    ast = NewAST(AST_ASSIGN, ident, val);
+    decl->right = ast;
+    return decl;
+}
+
+
+#line 1027 "build/cgram.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "cgram.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_C_IDENTIFIER = 3,               /* "identifier"  */
+  YYSYMBOL_C_CONSTANT = 4,                 /* "constant"  */
+  YYSYMBOL_C_STRING_LITERAL = 5,           /* "string literal"  */
+  YYSYMBOL_C_SIZEOF = 6,                   /* "sizeof"  */
+  YYSYMBOL_C_TYPEOF = 7,                   /* "typeof"  */
+  YYSYMBOL_C_PTR_OP = 8,                   /* "->"  */
+  YYSYMBOL_C_INC_OP = 9,                   /* "++"  */
+  YYSYMBOL_C_DEC_OP = 10,                  /* "--"  */
+  YYSYMBOL_C_LEFT_OP = 11,                 /* "<<"  */
+  YYSYMBOL_C_RIGHT_OP = 12,                /* ">>"  */
+  YYSYMBOL_C_LE_OP = 13,                   /* "<="  */
+  YYSYMBOL_C_GE_OP = 14,                   /* ">="  */
+  YYSYMBOL_C_EQ_OP = 15,                   /* "=="  */
+  YYSYMBOL_C_NE_OP = 16,                   /* "!="  */
+  YYSYMBOL_C_AND_OP = 17,                  /* "&&"  */
+  YYSYMBOL_C_OR_OP = 18,                   /* "||"  */
+  YYSYMBOL_C_MUL_ASSIGN = 19,              /* "*="  */
+  YYSYMBOL_C_DIV_ASSIGN = 20,              /* "/="  */
+  YYSYMBOL_C_MOD_ASSIGN = 21,              /* "%="  */
+  YYSYMBOL_C_ADD_ASSIGN = 22,              /* "+="  */
+  YYSYMBOL_C_SUB_ASSIGN = 23,              /* "-="  */
+  YYSYMBOL_C_LEFT_ASSIGN = 24,             /* "<<="  */
+  YYSYMBOL_C_RIGHT_ASSIGN = 25,            /* ">>="  */
+  YYSYMBOL_C_AND_ASSIGN = 26,              /* "&="  */
+  YYSYMBOL_C_XOR_ASSIGN = 27,              /* "^="  */
+  YYSYMBOL_C_OR_ASSIGN = 28,               /* "|="  */
+  YYSYMBOL_C_TYPE_NAME = 29,               /* "type name"  */
+  YYSYMBOL_C_LIMITMIN_OP = 30,             /* "#<"  */
+  YYSYMBOL_C_LIMITMAX_OP = 31,             /* "#>"  */
+  YYSYMBOL_C_ABSADDR_OP = 32,              /* "@@@"  */
+  YYSYMBOL_C_TYPEDEF = 33,                 /* "typedef"  */
+  YYSYMBOL_C_EXTERN = 34,                  /* "extern"  */
+  YYSYMBOL_C_STATIC = 35,                  /* "static"  */
+  YYSYMBOL_C_AUTO = 36,                    /* "auto"  */
+  YYSYMBOL_C_REGISTER = 37,                /* "register"  */
+  YYSYMBOL_C_RESTRICT = 38,                /* "__restrict"  */
+  YYSYMBOL_C_BOOL = 39,                    /* "_Bool"  */
+  YYSYMBOL_C_CHAR = 40,                    /* "char"  */
+  YYSYMBOL_C_SHORT = 41,                   /* "short"  */
+  YYSYMBOL_C_IMAGINARY = 42,               /* "_Imaginary"  */
+  YYSYMBOL_C_INLINE = 43,                  /* "inline"  */
+  YYSYMBOL_C_INT = 44,                     /* "int"  */
+  YYSYMBOL_C_LONG = 45,                    /* "long"  */
+  YYSYMBOL_C_SIGNED = 46,                  /* "signed"  */
+  YYSYMBOL_C_UNSIGNED = 47,                /* "unsigned"  */
+  YYSYMBOL_C_FLOAT = 48,                   /* "float"  */
+  YYSYMBOL_C_DOUBLE = 49,                  /* "double"  */
+  YYSYMBOL_C_CONST = 50,                   /* "const"  */
+  YYSYMBOL_C_VOLATILE = 51,                /* "volatile"  */
+  YYSYMBOL_C_VOID = 52,                    /* "void"  */
+  YYSYMBOL_C_STRUCT = 53,                  /* "struct"  */
+  YYSYMBOL_C_UNION = 54,                   /* "union"  */
+  YYSYMBOL_C_ENUM = 55,                    /* "enum"  */
+  YYSYMBOL_C_ELLIPSIS = 56,                /* "..."  */
+  YYSYMBOL_C_DOUBLECOLON = 57,             /* "::"  */
+  YYSYMBOL_C_CASE = 58,                    /* "case"  */
+  YYSYMBOL_C_DEFAULT = 59,                 /* "default"  */
+  YYSYMBOL_C_IF = 60,                      /* "if"  */
+  YYSYMBOL_C_ELSE = 61,                    /* "else"  */
+  YYSYMBOL_C_SWITCH = 62,                  /* "switch"  */
+  YYSYMBOL_C_WHILE = 63,                   /* "while"  */
+  YYSYMBOL_C_DO = 64,                      /* "do"  */
+  YYSYMBOL_C_FOR = 65,                     /* "for"  */
+  YYSYMBOL_C_GOTO = 66,                    /* "goto"  */
+  YYSYMBOL_C_CONTINUE = 67,                /* "continue"  */
+  YYSYMBOL_C_BREAK = 68,                   /* "break"  */
+  YYSYMBOL_C_RETURN = 69,                  /* "return"  */
+  YYSYMBOL_C_FROMFILE = 70,                /* "__fromfile"  */
+  YYSYMBOL_C_USING = 71,                   /* "__using"  */
+  YYSYMBOL_C_ATTRIBUTE = 72,               /* "__attribute__"  */
+  YYSYMBOL_C_ASM = 73,                     /* "__asm"  */
+  YYSYMBOL_C_PASM = 74,                    /* "__pasm"  */
+  YYSYMBOL_C_DEBUG = 75,                   /* "__debug"  */
+  YYSYMBOL_C_INSTR = 76,                   /* "asm instruction"  */
+  YYSYMBOL_C_INSTRMODIFIER = 77,           /* "instruction modifier"  */
+  YYSYMBOL_C_HWREG = 78,                   /* "hardware register"  */
+  YYSYMBOL_C_CATCH = 79,                   /* "catch"  */
+  YYSYMBOL_C_CLASS = 80,                   /* "class"  */
+  YYSYMBOL_C_DELETE = 81,                  /* "delete"  */
+  YYSYMBOL_C_FALSE = 82,                   /* "false"  */
+  YYSYMBOL_C_NEW = 83,                     /* "new"  */
+  YYSYMBOL_C_NULLPTR = 84,                 /* "nullptr"  */
+  YYSYMBOL_C_TRUE = 85,                    /* "true"  */
+  YYSYMBOL_C_PRIVATE = 86,                 /* "private"  */
+  YYSYMBOL_C_PUBLIC = 87,                  /* "public"  */
+  YYSYMBOL_C_TEMPLATE = 88,                /* "template"  */
+  YYSYMBOL_C_THIS = 89,                    /* "this"  */
+  YYSYMBOL_C_THROW = 90,                   /* "throw"  */
+  YYSYMBOL_C_THROWIF = 91,                 /* "__throwifcaught"  */
+  YYSYMBOL_C_TRY = 92,                     /* "try"  */
+  YYSYMBOL_C_VIRTUAL = 93,                 /* "virtual"  */
+  YYSYMBOL_C_ALIGNL = 94,                  /* "alignl"  */
+  YYSYMBOL_C_ALIGNW = 95,                  /* "alignw"  */
+  YYSYMBOL_C_BYTE = 96,                    /* "byte"  */
+  YYSYMBOL_C_ELSEIF = 97,                  /* "elseif"  */
+  YYSYMBOL_C_END = 98,                     /* "end"  */
+  YYSYMBOL_C_FILE = 99,                    /* "file"  */
+  YYSYMBOL_C_FIT = 100,                    /* "fit"  */
+  YYSYMBOL_C_ORG = 101,                    /* "org"  */
+  YYSYMBOL_C_ORGH = 102,                   /* "orgh"  */
+  YYSYMBOL_C_ORGF = 103,                   /* "orgf"  */
+  YYSYMBOL_C_RES = 104,                    /* "res"  */
+  YYSYMBOL_C_WORD = 105,                   /* "word"  */
+  YYSYMBOL_C_EOLN = 106,                   /* "end of line"  */
+  YYSYMBOL_C_FUNC = 107,                   /* "__func__ or __FUNCTION__"  */
+  YYSYMBOL_C_BUILTIN_ABS = 108,            /* "__builtin_abs"  */
+  YYSYMBOL_C_BUILTIN_CLZ = 109,            /* "__builtin_clz"  */
+  YYSYMBOL_C_BUILTIN_SQRT = 110,           /* "__builtin_sqrt"  */
+  YYSYMBOL_C_BUILTIN_FRAC = 111,           /* "__builtin_frac"  */
+  YYSYMBOL_C_BUILTIN_MULH = 112,           /* "__builtin_mulh"  */
+  YYSYMBOL_C_BUILTIN_MULUH = 113,          /* "__builtin_muluh"  */
+  YYSYMBOL_C_BUILTIN_ALLOCA = 114,         /* "__builtin_alloca"  */
+  YYSYMBOL_C_BUILTIN_COGSTART = 115,       /* "__builtin_cogstart"  */
+  YYSYMBOL_C_BUILTIN_COGSTART_COG = 116,   /* "__builtin_cogstart_cog"  */
+  YYSYMBOL_C_BUILTIN_EXPECT = 117,         /* "__builtin_expect"  */
+  YYSYMBOL_C_BUILTIN_OFFSETOF = 118,       /* "__builtin_offsetof"  */
+  YYSYMBOL_C_BUILTIN_PRINTF = 119,         /* "__builtin_printf"  */
+  YYSYMBOL_C_BUILTIN_REV = 120,            /* "__builtin_rev"  */
+  YYSYMBOL_C_BUILTIN_VA_START = 121,       /* "__builtin_va_start"  */
+  YYSYMBOL_C_BUILTIN_VA_ARG = 122,         /* "__builtin_va_arg"  */
+  YYSYMBOL_C_BUILTIN_SETJMP = 123,         /* "__builtin_setjmp"  */
+  YYSYMBOL_C_BUILTIN_LONGJMP = 124,        /* "__builtin_longjmp"  */
+  YYSYMBOL_C_BUILTIN_STRLEN = 125,         /* "__builtin_strlen"  */
+  YYSYMBOL_C_EOF = 126,                    /* "end of file"  */
+  YYSYMBOL_127_ = 127,                     /* '$'  */
+  YYSYMBOL_128_ = 128,                     /* '('  */
+  YYSYMBOL_129_ = 129,                     /* ')'  */
+  YYSYMBOL_130_ = 130,                     /* ','  */
+  YYSYMBOL_131_ = 131,                     /* '['  */
+  YYSYMBOL_132_ = 132,                     /* ']'  */
+  YYSYMBOL_133_ = 133,                     /* '.'  */
+  YYSYMBOL_134_ = 134,                     /* '{'  */
+  YYSYMBOL_135_ = 135,                     /* '}'  */
+  YYSYMBOL_136_ = 136,                     /* '&'  */
+  YYSYMBOL_137_ = 137,                     /* '@'  */
+  YYSYMBOL_138_ = 138,                     /* '*'  */
+  YYSYMBOL_139_ = 139,                     /* '+'  */
+  YYSYMBOL_140_ = 140,                     /* '-'  */
+  YYSYMBOL_141_ = 141,                     /* '~'  */
+  YYSYMBOL_142_ = 142,                     /* '!'  */
+  YYSYMBOL_143_ = 143,                     /* '/'  */
+  YYSYMBOL_144_ = 144,                     /* '%'  */
+  YYSYMBOL_145_ = 145,                     /* '<'  */
+  YYSYMBOL_146_ = 146,                     /* '>'  */
+  YYSYMBOL_147_ = 147,                     /* '^'  */
+  YYSYMBOL_148_ = 148,                     /* '|'  */
+  YYSYMBOL_149_ = 149,                     /* '?'  */
+  YYSYMBOL_150_ = 150,                     /* ':'  */
+  YYSYMBOL_151_ = 151,                     /* '='  */
+  YYSYMBOL_152_ = 152,                     /* ';'  */
+  YYSYMBOL_153_ = 153,                     /* '#'  */
+  YYSYMBOL_154_ = 154,                     /* '\\'  */
+  YYSYMBOL_YYACCEPT = 155,                 /* $accept  */
+  YYSYMBOL_primary_expression = 156,       /* primary_expression  */
+  YYSYMBOL_postfix_expression = 157,       /* postfix_expression  */
+  YYSYMBOL_argument_expression_list = 158, /* argument_expression_list  */
+  YYSYMBOL_unary_expression = 159,         /* unary_expression  */
+  YYSYMBOL_unary_operator = 160,           /* unary_operator  */
+  YYSYMBOL_cast_expression = 161,          /* cast_expression  */
+  YYSYMBOL_multiplicative_expression = 162, /* multiplicative_expression  */
+  YYSYMBOL_additive_expression = 163,      /* additive_expression  */
+  YYSYMBOL_shift_expression = 164,         /* shift_expression  */
+  YYSYMBOL_relational_expression = 165,    /* relational_expression  */
+  YYSYMBOL_equality_expression = 166,      /* equality_expression  */
+  YYSYMBOL_and_expression = 167,           /* and_expression  */
+  YYSYMBOL_exclusive_or_expression = 168,  /* exclusive_or_expression  */
+  YYSYMBOL_inclusive_or_expression = 169,  /* inclusive_or_expression  */
+  YYSYMBOL_logical_and_expression = 170,   /* logical_and_expression  */
+  YYSYMBOL_logical_or_expression = 171,    /* logical_or_expression  */
+  YYSYMBOL_conditional_expression = 172,   /* conditional_expression  */
+  YYSYMBOL_assignment_expression = 173,    /* assignment_expression  */
+  YYSYMBOL_assignment_operator = 174,      /* assignment_operator  */
+  YYSYMBOL_expression = 175,               /* expression  */
+  YYSYMBOL_constant_expression = 176,      /* constant_expression  */
+  YYSYMBOL_declaration = 177,              /* declaration  */
+  YYSYMBOL_declaration_specifiers = 178,   /* declaration_specifiers  */
+  YYSYMBOL_reset_identifier_expectation = 179, /* reset_identifier_expectation  */
+  YYSYMBOL_init_declarator_list = 180,     /* init_declarator_list  */
+  YYSYMBOL_init_declarator = 181,          /* init_declarator  */
+  YYSYMBOL_storage_class_specifier = 182,  /* storage_class_specifier  */
+  YYSYMBOL_type_specifier = 183,           /* type_specifier  */
+  YYSYMBOL_struct_or_union_specifier = 184, /* struct_or_union_specifier  */
+  YYSYMBOL_any_identifier = 185,           /* any_identifier  */
+  YYSYMBOL_struct_or_union = 186,          /* struct_or_union  */
+  YYSYMBOL_using_clause = 187,             /* using_clause  */
+  YYSYMBOL_optobjarguments = 188,          /* optobjarguments  */
+  YYSYMBOL_objargs = 189,                  /* objargs  */
+  YYSYMBOL_one_objarg = 190,               /* one_objarg  */
+  YYSYMBOL_struct_open = 191,              /* struct_open  */
+  YYSYMBOL_struct_close = 192,             /* struct_close  */
+  YYSYMBOL_struct_declaration_list = 193,  /* struct_declaration_list  */
+  YYSYMBOL_struct_declaration = 194,       /* struct_declaration  */
+  YYSYMBOL_struct_specifier_qualifier_list = 195, /* struct_specifier_qualifier_list  */
+  YYSYMBOL_specifier_qualifier_list = 196, /* specifier_qualifier_list  */
+  YYSYMBOL_struct_declarator_list = 197,   /* struct_declarator_list  */
+  YYSYMBOL_struct_declarator = 198,        /* struct_declarator  */
+  YYSYMBOL_enum_specifier = 199,           /* enum_specifier  */
+  YYSYMBOL_enumerator_list = 200,          /* enumerator_list  */
+  YYSYMBOL_enumerator = 201,               /* enumerator  */
+  YYSYMBOL_type_qualifier = 202,           /* type_qualifier  */
+  YYSYMBOL_declarator = 203,               /* declarator  */
+  YYSYMBOL_direct_declarator = 204,        /* direct_declarator  */
+  YYSYMBOL_pointer = 205,                  /* pointer  */
+  YYSYMBOL_type_qualifier_list = 206,      /* type_qualifier_list  */
+  YYSYMBOL_parameter_type_list = 207,      /* parameter_type_list  */
+  YYSYMBOL_parameter_list = 208,           /* parameter_list  */
+  YYSYMBOL_raw_parameter_declaration = 209, /* raw_parameter_declaration  */
+  YYSYMBOL_parameter_declaration = 210,    /* parameter_declaration  */
+  YYSYMBOL_opt_param_default = 211,        /* opt_param_default  */
+  YYSYMBOL_identifier_list = 212,          /* identifier_list  */
+  YYSYMBOL_type_name = 213,                /* type_name  */
+  YYSYMBOL_abstract_declarator = 214,      /* abstract_declarator  */
+  YYSYMBOL_direct_abstract_declarator = 215, /* direct_abstract_declarator  */
+  YYSYMBOL_initializer = 216,              /* initializer  */
+  YYSYMBOL_initializer_list = 217,         /* initializer_list  */
+  YYSYMBOL_designation = 218,              /* designation  */
+  YYSYMBOL_designator_list = 219,          /* designator_list  */
+  YYSYMBOL_designator = 220,               /* designator  */
+  YYSYMBOL_statement = 221,                /* statement  */
+  YYSYMBOL_labeled_statement = 222,        /* labeled_statement  */
+  YYSYMBOL_compound_statement = 223,       /* compound_statement  */
+  YYSYMBOL_compound_statement_open = 224,  /* compound_statement_open  */
+  YYSYMBOL_compound_statement_close = 225, /* compound_statement_close  */
+  YYSYMBOL_for_statement_start = 226,      /* for_statement_start  */
+  YYSYMBOL_block_item_list = 227,          /* block_item_list  */
+  YYSYMBOL_block_item = 228,               /* block_item  */
+  YYSYMBOL_asm_statement = 229,            /* asm_statement  */
+  YYSYMBOL_opt_asm_volatile = 230,         /* opt_asm_volatile  */
+  YYSYMBOL_top_asm = 231,                  /* top_asm  */
+  YYSYMBOL_asmlist = 232,                  /* asmlist  */
+  YYSYMBOL_asmline = 233,                  /* asmline  */
+  YYSYMBOL_asm_eoln = 234,                 /* asm_eoln  */
+  YYSYMBOL_asm_baseline = 235,             /* asm_baseline  */
+  YYSYMBOL_asm_debug_exprlist = 236,       /* asm_debug_exprlist  */
+  YYSYMBOL_asm_debug_expritem_first = 237, /* asm_debug_expritem_first  */
+  YYSYMBOL_asm_debug_exprlist_continue = 238, /* asm_debug_exprlist_continue  */
+  YYSYMBOL_asm_debug_expritem = 239,       /* asm_debug_expritem  */
+  YYSYMBOL_asm_operand = 240,              /* asm_operand  */
+  YYSYMBOL_asm_operandlist = 241,          /* asm_operandlist  */
+  YYSYMBOL_asmexpr = 242,                  /* asmexpr  */
+  YYSYMBOL_instruction = 243,              /* instruction  */
+  YYSYMBOL_instrmodifier = 244,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 245,             /* modifierlist  */
+  YYSYMBOL_func_declaration_list = 246,    /* func_declaration_list  */
+  YYSYMBOL_declaration_list = 247,         /* declaration_list  */
+  YYSYMBOL_expression_statement = 248,     /* expression_statement  */
+  YYSYMBOL_selection_statement = 249,      /* selection_statement  */
+  YYSYMBOL_iteration_statement = 250,      /* iteration_statement  */
+  YYSYMBOL_for_declaration = 251,          /* for_declaration  */
+  YYSYMBOL_jump_statement = 252,           /* jump_statement  */
+  YYSYMBOL_try_statement = 253,            /* try_statement  */
+  YYSYMBOL_handler_sequence = 254,         /* handler_sequence  */
+  YYSYMBOL_handler_item = 255,             /* handler_item  */
+  YYSYMBOL_push_current_types = 256,       /* push_current_types  */
+  YYSYMBOL_pop_current_types = 257,        /* pop_current_types  */
+  YYSYMBOL_handler_declarator = 258,       /* handler_declarator  */
+  YYSYMBOL_translation_unit = 259,         /* translation_unit  */
+  YYSYMBOL_external_declaration = 260,     /* external_declaration  */
+  YYSYMBOL_function_definition = 261,      /* function_definition  */
+  YYSYMBOL_attribute_decl = 262,           /* attribute_decl  */
+  YYSYMBOL_fromfile_decl = 263,            /* fromfile_decl  */
+  YYSYMBOL_compound_statement_or_fromfile = 264, /* compound_statement_or_fromfile  */
+  YYSYMBOL_top_pasm = 265,                 /* top_pasm  */
+  YYSYMBOL_pasmlist = 266,                 /* pasmlist  */
+  YYSYMBOL_pasmline = 267,                 /* pasmline  */
+  YYSYMBOL_pasm_baseline = 268,            /* pasm_baseline  */
+  YYSYMBOL_pasm_debug_exprlist = 269,      /* pasm_debug_exprlist  */
+  YYSYMBOL_pasm_debug_expritem_first = 270, /* pasm_debug_expritem_first  */
+  YYSYMBOL_pasm_debug_exprlist_continue = 271, /* pasm_debug_exprlist_continue  */
+  YYSYMBOL_pasm_debug_expritem = 272,      /* pasm_debug_expritem  */
+  YYSYMBOL_pasm_operand = 273,             /* pasm_operand  */
+  YYSYMBOL_pasm_operandlist = 274,         /* pasm_operandlist  */
+  YYSYMBOL_optpasmrange = 275,             /* optpasmrange  */
+  YYSYMBOL_pasmatom = 276,                 /* pasmatom  */
+  YYSYMBOL_pasmunary = 277,                /* pasmunary  */
+  YYSYMBOL_pasm_e1 = 278,                  /* pasm_e1  */
+  YYSYMBOL_pasm_e2 = 279,                  /* pasm_e2  */
+  YYSYMBOL_pasm_e3 = 280,                  /* pasm_e3  */
+  YYSYMBOL_pasm_e4 = 281,                  /* pasm_e4  */
+  YYSYMBOL_pasm_e5 = 282,                  /* pasm_e5  */
+  YYSYMBOL_pasm_e6 = 283,                  /* pasm_e6  */
+  YYSYMBOL_pasm_e7 = 284,                  /* pasm_e7  */
+  YYSYMBOL_pasmexpr = 285                  /* pasmexpr  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined CGRAMYYSTYPE_IS_TRIVIAL && CGRAMYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  97
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   4748
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  155
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  131
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  466
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  858
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   381
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   142,     2,   153,   127,   144,   136,     2,
+     128,   129,   138,   139,   130,   140,   133,   143,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   150,   152,
+     145,   151,   146,   149,   137,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   131,   154,   132,   147,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   134,   148,   135,   141,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126
+};
+
+#if CGRAMYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,  1128,  1128,  1130,  1132,  1147,  1149,  1151,  1153,  1155,
+    1157,  1159,  1161,  1163,  1165,  1170,  1172,  1174,  1180,  1182,
+    1208,  1231,  1254,  1277,  1281,  1286,  1290,  1292,  1300,  1305,
+    1309,  1313,  1317,  1319,  1321,  1323,  1325,  1330,  1332,  1334,
+    1349,  1366,  1368,  1373,  1375,  1377,  1379,  1389,  1391,  1393,
+    1398,  1400,  1402,  1404,  1406,  1408,  1410,  1412,  1417,  1419,
+    1435,  1437,  1439,  1441,  1446,  1448,  1450,  1455,  1457,  1459,
+    1464,  1466,  1468,  1470,  1472,  1477,  1479,  1481,  1486,  1488,
+    1493,  1495,  1500,  1502,  1507,  1509,  1514,  1516,  1521,  1523,
+    1528,  1530,  1535,  1537,  1539,  1541,  1543,  1545,  1547,  1549,
+    1551,  1553,  1555,  1560,  1562,  1567,  1572,  1574,  1581,  1583,
+    1589,  1591,  1593,  1595,  1601,  1605,  1607,  1612,  1614,  1619,
+    1621,  1623,  1625,  1627,  1634,  1636,  1641,  1643,  1645,  1647,
+    1649,  1651,  1660,  1662,  1664,  1673,  1675,  1677,  1679,  1690,
+    1699,  1706,  1708,  1721,  1723,  1727,  1733,  1739,  1744,  1759,
+    1762,  1766,  1768,  1775,  1782,  1797,  1814,  1820,  1822,  1827,
+    1846,  1850,  1855,  1860,  1887,  1889,  1891,  1893,  1895,  1904,
+    1906,  1908,  1910,  1915,  1917,  1922,  1924,  1926,  1933,  1935,
+    1937,  1939,  1941,  1946,  1948,  1953,  1955,  1965,  1967,  1969,
+    1974,  1976,  1981,  1983,  1989,  1991,  1993,  1995,  1997,  1999,
+    2004,  2006,  2010,  2012,  2020,  2022,  2026,  2028,  2039,  2041,
+    2047,  2049,  2058,  2060,  2065,  2067,  2069,  2073,  2081,  2084,
+    2088,  2090,  2095,  2097,  2107,  2109,  2111,  2116,  2118,  2120,
+    2122,  2124,  2126,  2130,  2135,  2151,  2170,  2172,  2174,  2176,
+    2183,  2188,  2198,  2205,  2219,  2228,  2230,  2240,  2242,  2247,
+    2248,  2249,  2250,  2251,  2252,  2253,  2254,  2258,  2264,  2271,
+    2278,  2285,  2287,  2292,  2297,  2302,  2307,  2309,  2314,  2319,
+    2324,  2331,  2342,  2343,  2345,  2350,  2352,  2357,  2359,  2364,
+    2368,  2389,  2390,  2394,  2396,  2398,  2400,  2402,  2404,  2406,
+    2408,  2410,  2412,  2414,  2416,  2418,  2420,  2422,  2424,  2426,
+    2428,  2430,  2432,  2434,  2436,  2438,  2440,  2442,  2444,  2446,
+    2448,  2457,  2469,  2471,  2476,  2486,  2488,  2492,  2496,  2498,
+    2500,  2502,  2504,  2506,  2511,  2513,  2518,  2520,  2525,  2527,
+    2532,  2537,  2539,  2541,  2546,  2548,  2553,  2555,  2560,  2562,
+    2567,  2570,  2574,  2581,  2585,  2589,  2606,  2623,  2643,  2665,
+    2670,  2672,  2674,  2676,  2678,  2680,  2682,  2697,  2728,  2730,
+    2738,  2748,  2751,  2755,  2760,  2769,  2770,  2774,  2775,  2776,
+    2777,  2782,  2799,  2815,  2831,  2849,  2854,  2858,  2869,  2870,
+    2875,  2877,  2882,  2884,  2889,  2893,  2915,  2917,  2919,  2921,
+    2923,  2925,  2927,  2929,  2931,  2933,  2935,  2937,  2939,  2941,
+    2943,  2945,  2947,  2949,  2951,  2953,  2955,  2957,  2959,  2961,
+    2970,  2982,  2984,  2989,  2999,  3001,  3005,  3009,  3011,  3013,
+    3015,  3020,  3022,  3027,  3032,  3034,  3037,  3041,  3043,  3045,
+    3047,  3062,  3064,  3066,  3068,  3070,  3072,  3077,  3079,  3081,
+    3083,  3085,  3090,  3092,  3094,  3098,  3100,  3104,  3106,  3108,
+    3112,  3114,  3116,  3118,  3122,  3124,  3126,  3130,  3132,  3134,
+    3138,  3140,  3142,  3144,  3146,  3151,  3153
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"identifier\"",
+  "\"constant\"", "\"string literal\"", "\"sizeof\"", "\"typeof\"",
+  "\"->\"", "\"++\"", "\"--\"", "\"<<\"", "\">>\"", "\"<=\"", "\">=\"",
+  "\"==\"", "\"!=\"", "\"&&\"", "\"||\"", "\"*=\"", "\"/=\"", "\"%=\"",
+  "\"+=\"", "\"-=\"", "\"<<=\"", "\">>=\"", "\"&=\"", "\"^=\"", "\"|=\"",
+  "\"type name\"", "\"#<\"", "\"#>\"", "\"@@@\"", "\"typedef\"",
+  "\"extern\"", "\"static\"", "\"auto\"", "\"register\"", "\"__restrict\"",
+  "\"_Bool\"", "\"char\"", "\"short\"", "\"_Imaginary\"", "\"inline\"",
+  "\"int\"", "\"long\"", "\"signed\"", "\"unsigned\"", "\"float\"",
+  "\"double\"", "\"const\"", "\"volatile\"", "\"void\"", "\"struct\"",
+  "\"union\"", "\"enum\"", "\"...\"", "\"::\"", "\"case\"", "\"default\"",
+  "\"if\"", "\"else\"", "\"switch\"", "\"while\"", "\"do\"", "\"for\"",
+  "\"goto\"", "\"continue\"", "\"break\"", "\"return\"", "\"__fromfile\"",
+  "\"__using\"", "\"__attribute__\"", "\"__asm\"", "\"__pasm\"",
+  "\"__debug\"", "\"asm instruction\"", "\"instruction modifier\"",
+  "\"hardware register\"", "\"catch\"", "\"class\"", "\"delete\"",
+  "\"false\"", "\"new\"", "\"nullptr\"", "\"true\"", "\"private\"",
+  "\"public\"", "\"template\"", "\"this\"", "\"throw\"",
+  "\"__throwifcaught\"", "\"try\"", "\"virtual\"", "\"alignl\"",
+  "\"alignw\"", "\"byte\"", "\"elseif\"", "\"end\"", "\"file\"", "\"fit\"",
+  "\"org\"", "\"orgh\"", "\"orgf\"", "\"res\"", "\"word\"",
+  "\"end of line\"", "\"__func__ or __FUNCTION__\"", "\"__builtin_abs\"",
+  "\"__builtin_clz\"", "\"__builtin_sqrt\"", "\"__builtin_frac\"",
+  "\"__builtin_mulh\"", "\"__builtin_muluh\"", "\"__builtin_alloca\"",
+  "\"__builtin_cogstart\"", "\"__builtin_cogstart_cog\"",
+  "\"__builtin_expect\"", "\"__builtin_offsetof\"", "\"__builtin_printf\"",
+  "\"__builtin_rev\"", "\"__builtin_va_start\"", "\"__builtin_va_arg\"",
+  "\"__builtin_setjmp\"", "\"__builtin_longjmp\"", "\"__builtin_strlen\"",
+  "\"end of file\"", "'$'", "'('", "')'", "','", "'['", "']'", "'.'",
+  "'{'", "'}'", "'&'", "'@'", "'*'", "'+'", "'-'", "'~'", "'!'", "'/'",
+  "'%'", "'<'", "'>'", "'^'", "'|'", "'?'", "':'", "'='", "';'", "'#'",
+  "'\\\\'", "$accept", "primary_expression", "postfix_expression",
+  "argument_expression_list", "unary_expression", "unary_operator",
+  "cast_expression", "multiplicative_expression", "additive_expression",
+  "shift_expression", "relational_expression", "equality_expression",
+  "and_expression", "exclusive_or_expression", "inclusive_or_expression",
+  "logical_and_expression", "logical_or_expression",
+  "conditional_expression", "assignment_expression", "assignment_operator",
+  "expression", "constant_expression", "declaration",
+  "declaration_specifiers", "reset_identifier_expectation",
+  "init_declarator_list", "init_declarator", "storage_class_specifier",
+  "type_specifier", "struct_or_union_specifier", "any_identifier",
+  "struct_or_union", "using_clause", "optobjarguments", "objargs",
+  "one_objarg", "struct_open", "struct_close", "struct_declaration_list",
+  "struct_declaration", "struct_specifier_qualifier_list",
+  "specifier_qualifier_list", "struct_declarator_list",
+  "struct_declarator", "enum_specifier", "enumerator_list", "enumerator",
+  "type_qualifier", "declarator", "direct_declarator", "pointer",
+  "type_qualifier_list", "parameter_type_list", "parameter_list",
+  "raw_parameter_declaration", "parameter_declaration",
+  "opt_param_default", "identifier_list", "type_name",
+  "abstract_declarator", "direct_abstract_declarator", "initializer",
+  "initializer_list", "designation", "designator_list", "designator",
+  "statement", "labeled_statement", "compound_statement",
+  "compound_statement_open", "compound_statement_close",
+  "for_statement_start", "block_item_list", "block_item", "asm_statement",
+  "opt_asm_volatile", "top_asm", "asmlist", "asmline", "asm_eoln",
+  "asm_baseline", "asm_debug_exprlist", "asm_debug_expritem_first",
+  "asm_debug_exprlist_continue", "asm_debug_expritem", "asm_operand",
+  "asm_operandlist", "asmexpr", "instruction", "instrmodifier",
+  "modifierlist", "func_declaration_list", "declaration_list",
+  "expression_statement", "selection_statement", "iteration_statement",
+  "for_declaration", "jump_statement", "try_statement", "handler_sequence",
+  "handler_item", "push_current_types", "pop_current_types",
+  "handler_declarator", "translation_unit", "external_declaration",
+  "function_definition", "attribute_decl", "fromfile_decl",
+  "compound_statement_or_fromfile", "top_pasm", "pasmlist", "pasmline",
+  "pasm_baseline", "pasm_debug_exprlist", "pasm_debug_expritem_first",
+  "pasm_debug_exprlist_continue", "pasm_debug_expritem", "pasm_operand",
+  "pasm_operandlist", "optpasmrange", "pasmatom", "pasmunary", "pasm_e1",
+  "pasm_e2", "pasm_e3", "pasm_e4", "pasm_e5", "pasm_e6", "pasm_e7",
+  "pasmexpr", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-686)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-377)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    4046,     7,   -91,  -686,  -686,  -686,  -686,  -686,  -686,  -686,
+    -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,
+    -686,  -686,  -686,   -21,   -21,   184,  -686,   104,   109,   -21,
+     219,   391,   391,  -686,   123,  4521,  -686,  -686,   164,  4366,
+    -686,  4521,  4570,    14,    57,  -686,  3993,  -686,  -686,  -686,
+      82,  3708,  -686,  -686,  -686,  -686,  -686,    94,   -28,    97,
+     655,   110,   523,  -686,   -34,  -686,  -686,   391,  -686,   391,
+    -686,   130,  -686,  2636,  -686,  4521,    63,  -686,   112,  4619,
+     115,   143,  4668,  4205,  -686,   159,  4619,  -686,   -36,    13,
+     123,   128,  4521,   128,  4264,  3072,    14,  -686,  -686,  -686,
+    -686,  -686,  -686,  3802,  3708,  3708,  -686,    -2,  -686,  -686,
+    -686,  -686,  -686,   179,   186,   206,   210,   225,   234,   240,
+     271,   293,   306,   310,  -686,   319,   344,   350,   356,   371,
+     377,  -686,  2689,  -686,  -686,  -686,  -686,  -686,  -686,  -686,
+    -686,   258,   216,  3867,   359,   146,  -686,    94,   655,   -62,
+     922,   926,  1460,   -62,   384,  -686,  -686,   -62,   -62,   926,
+    1460,   -62,   367,  1300,  1300,  1300,  1460,  1460,   926,  -686,
+    -686,  1456,  -686,  -686,  -686,   773,   144,   523,   -62,   722,
+    1717,   395,   -62,   -62,  1717,   546,  1746,  1746,  1746,  1783,
+    1783,  1717,  -686,  1119,  1011,  -686,  -686,  -686,  -686,  -686,
+    -686,   219,  -686,  3166,   415,   128,  -686,   560,  -686,  -686,
+    -686,  -686,  -686,  4668,  -686,  4668,  -686,  -686,  3867,  -686,
+      71,  -686,   375,  -686,   394,   441,  -686,  -686,  1929,  -686,
+    -686,   137,  -686,  -686,  -686,   208,   444,   455,   442,  -686,
+     353,  2689,  -686,  -686,  -686,   221,   378,   519,    91,   517,
+     467,   462,   468,   617,     1,  -686,   505,  2689,  -686,  -686,
+    -686,   557,  -686,  3867,  3867,  3867,  3867,  3867,  3867,  3867,
+    3867,  3867,  3867,  4668,  3867,  3708,  3867,  3867,  3867,  3867,
+     818,  -686,  -686,   411,   373,   518,  2069,   205,  -686,  -686,
+    3231,  3867,   205,  -686,  -686,  3867,    36,  -686,   175,  1545,
+    -686,  -686,  1460,  1460,  1366,  3867,  -686,  -686,  -686,   178,
+     526,   -62,  -686,  1066,  -686,  -686,  -686,   178,   -62,  -686,
+     -62,  -686,   -62,  -686,   -62,  -686,   -62,   -62,   -62,  -686,
+     178,  -686,  -686,  -686,   383,  -686,   390,  -686,  1732,  -686,
+    -686,  -686,  -686,  -686,   601,   601,    -2,  -686,  1783,   657,
+     601,   601,  1086,  1783,  -686,  -686,   218,    98,  -686,   536,
+     530,   406,   244,   419,   533,   370,   545,   826,  -686,  -686,
+    -686,   218,   -62,  -686,   -62,  -686,   -62,  -686,   -62,   -62,
+     -62,  -686,   218,  -686,   390,   392,  -686,  -686,  -686,  2754,
+    -686,  -686,  -686,  -686,   552,  -686,  -686,  -686,  -686,    64,
+    -686,  -686,  3867,   681,   543,   548,  3867,   564,   568,   573,
+     579,  2349,  -686,   205,   570,   575,  2420,   520,  3867,  3867,
+     415,  -686,  -686,   139,  -686,   583,  -686,  -686,  -686,  -686,
+     592,  1929,  -686,  -686,  -686,  -686,  -686,  -686,  -686,  4099,
+    3325,  -686,    66,  -686,   264,  -686,  4421,  3867,  -686,  -686,
+     732,   607,  3867,  3867,  3867,  3867,  3867,  3867,  3867,  3867,
+    3867,  3867,  3867,  3867,  3867,  3867,  3867,  3867,  3867,  3867,
+    3867,  -686,   608,  1783,   586,   610,   611,   616,   618,   451,
+    -686,   453,   461,   619,   466,   472,   632,   633,   491,   634,
+     635,   637,   639,   642,  -686,  -686,  -686,  -686,  -686,  -686,
+    -686,  -686,  -686,  -686,  -686,  3867,  -686,  3867,  4152,   372,
+    -686,   612,  1929,  -686,  -686,   510,   -80,  -686,  -686,  -686,
+    -686,    55,  -686,  -686,  -686,  -686,  1460,  -686,  -686,  1206,
+    -686,  1460,  -686,   -62,   643,   644,  -686,  -686,  -686,  -686,
+    -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,   390,   696,
+    -686,  -686,  -686,  -686,  -686,  -686,   646,  -686,  -686,  -686,
+    1783,  -686,  -686,  1775,  -686,  -686,  -686,  1775,   601,   601,
+     601,   601,   601,   601,  1259,   601,   601,   601,   601,   601,
+     601,   601,   601,  1783,   -62,   651,   654,  -686,  -686,  -686,
+    -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,   390,
+    3867,   205,  -686,  -686,   301,  3166,   227,  -686,   778,   656,
+    -686,  -686,   658,   -20,  2349,  3867,  3867,  3867,   723,   640,
+    -686,  -686,  -686,   149,  -686,  -686,   151,   150,   211,   710,
+    -686,  2349,  2209,  -686,  -686,  -686,   662,   664,  -686,   663,
+     264,  4314,  3390,  -686,  -686,  -686,  -686,  3484,  -686,  -686,
+    -686,   221,   221,   378,   378,   519,   519,   519,   519,    91,
+      91,   517,   467,   462,   468,   617,   120,   612,   668,  1783,
+    -686,  -686,  -686,  -686,  -686,  3867,  -686,  -686,  -686,  -686,
+    -686,  3867,   791,  -686,   798,  4668,  -686,  3867,  -686,  -686,
+    -686,  3007,   673,  -686,  -686,  -686,  -686,  -686,   671,  -686,
+     -62,  1206,  -686,  -686,  -686,  -686,  -686,   513,  -686,  -686,
+     536,   530,   530,   406,   601,   406,   244,   244,   419,   419,
+     533,   533,   533,   533,   672,  -686,   -62,  1775,  -686,   674,
+    -686,  2848,  -686,  -686,  -686,  -686,   659,   678,  -686,  -686,
+     660,  3867,  2349,  -686,   515,   540,   544,   683,  -686,  -686,
+     675,   655,  -686,  -686,  -686,   710,  -686,  -686,  -686,  2514,
+    2514,  -686,  -686,  -686,  -686,   684,  -686,   682,  -686,  3867,
+    -686,   688,  -686,   686,   704,   705,   718,   719,   338,  -686,
+    -686,  -686,   726,  -686,  -686,   406,  -686,  -686,   731,  -686,
+    -686,  -686,  -686,  3166,  3867,   778,  -686,   699,  -686,  2349,
+    2349,  2349,  3867,   655,  1608,   724,  -686,  3549,  3643,  -686,
+    -686,  -686,  -686,  -686,  -686,  -686,  -686,  -686,  2913,  -686,
+    1206,  1775,  -686,  -686,  -686,  2349,   792,  -686,  -686,   551,
+    1670,  -686,  4471,  2349,   559,  2349,   574,  -686,  -686,  -686,
+    -686,  2349,   711,  -686,  -686,  -686,   735,  -686,  2349,  -686,
+    2349,  -686,  -686,   415,  -686,  -686,  -686,  -686
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,   192,     0,   138,   119,   120,   121,   122,   125,   189,
+     128,   127,   129,   123,   130,   131,   134,   135,   132,   133,
+     187,   188,   126,   376,   376,     0,   124,     0,     0,   376,
+       0,   204,   200,   370,     0,   108,   114,   136,     0,     0,
+     137,   112,   376,   191,     0,   368,     0,   365,   367,   369,
+       0,     0,   375,   145,   147,   143,   144,     0,   182,     0,
+       0,     0,     0,   146,     0,   208,   206,   205,   202,   201,
+     106,     0,   115,   117,   109,   110,     0,   155,   141,     0,
+       0,     0,   165,     0,   157,     0,   167,   113,   124,   336,
+       0,     0,     0,     0,     0,     0,   190,     1,   366,   193,
+       2,     3,     9,     0,     0,     0,    52,   426,     7,     8,
+       6,     5,    10,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    11,     0,     0,     0,     0,     0,
+       0,    12,     0,    50,    51,    53,    54,    55,    56,    57,
+      15,    43,     0,     0,   185,     0,   183,     0,     0,     0,
+       0,     0,     0,     0,     0,   328,   330,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   281,
+     282,     0,   277,   283,   279,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   386,     0,     0,   382,   384,   194,   209,   207,
+     203,     0,   107,     0,     0,     0,   111,     0,   142,   154,
+     168,   162,   161,   170,   164,   172,   156,   158,     0,   159,
+       0,   173,   175,   166,   117,     0,   263,   379,     0,   378,
+     373,   337,   374,   220,   199,   216,     0,   210,   219,   212,
+       0,     0,   196,    58,    60,    64,    67,    70,    75,    78,
+      80,    82,    84,    86,    88,   105,     0,     0,    48,    44,
+      45,     0,     4,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      58,    90,   103,     0,   222,     0,     0,     0,    37,    38,
+       0,     0,     0,   139,    46,     0,     0,   178,     0,     0,
+     284,   280,     0,     0,     0,     0,   326,   289,   324,     0,
+     318,     0,   305,     0,   295,   296,   285,     0,     0,   306,
+       0,   308,     0,   297,     0,   299,     0,     0,     0,   287,
+       0,   275,   278,   291,     0,   331,     0,   329,     0,   387,
+     385,   427,   428,   431,     0,     0,   426,   429,     0,     0,
+       0,     0,     0,     0,   392,   421,     0,   437,   442,   445,
+     447,   450,   454,   457,   460,   465,   417,     0,   398,   399,
+     388,     0,     0,   407,     0,   400,     0,   402,     0,     0,
+       0,   390,     0,   394,     0,     0,   380,   383,   116,     0,
+     236,   118,   371,   372,   150,   169,   171,   140,   176,     0,
+     160,   163,     0,     0,     2,   138,     0,     0,     0,     0,
+       0,     0,   265,     0,     0,     0,     0,   272,     0,     0,
+       0,   264,   338,     0,   268,     0,   269,   249,   250,   261,
+       0,     0,   266,   255,   251,   252,   253,   254,   256,     0,
+       0,   214,   224,   215,   225,   197,     0,     0,   217,   198,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   195,     0,     0,     0,     0,     0,     0,     0,     0,
+      41,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    93,    94,    95,    96,    97,    98,
+      99,   100,   101,   102,    92,     0,    13,     0,     0,   224,
+     223,     0,     0,    36,    33,     0,     0,    35,   186,   180,
+     184,     0,   179,   276,   322,   320,     0,   319,   327,     0,
+     290,     0,   303,     0,     0,   312,   314,   317,   286,   304,
+     309,   307,   298,   300,   301,   302,   288,   292,     0,     0,
+     293,   332,   381,   440,   441,   430,     0,   432,   438,   439,
+       0,   418,   466,     0,   393,   434,   435,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   411,   413,   416,   389,
+     408,   406,   401,   403,   404,   405,   391,   396,   395,     0,
+       0,     0,   239,   240,     0,     0,     0,   245,     0,     0,
+     174,   177,     0,     0,     0,     0,     0,     0,     0,     0,
+     351,   352,   353,     0,   274,   273,     0,     0,     0,     0,
+     339,     0,     0,   262,   267,   232,     0,     0,   228,     0,
+     226,     0,     0,   211,   213,   218,   221,     0,    61,    62,
+      63,    65,    66,    68,    69,    73,    74,    71,    72,    76,
+      77,    79,    81,    83,    85,    87,     0,    47,     0,     0,
+     423,    16,    17,    18,    20,     0,    22,    21,    26,    27,
+      28,     0,     0,    19,     0,     0,    25,     0,    31,    91,
+     104,     0,     0,    34,    32,   181,   321,   325,     0,   310,
+       0,     0,   294,   333,   433,   419,   422,     0,   443,   444,
+     446,   449,   448,   451,     0,   452,   455,   456,   458,   459,
+     463,   464,   462,   461,     0,   409,     0,     0,   397,     0,
+     248,     0,   237,   241,   244,   246,     0,   149,   151,   148,
+       0,     0,     0,   260,     0,     0,     0,     0,   350,   354,
+       0,     0,   355,   356,   361,   357,   358,   257,   349,     0,
+       0,   233,   227,   229,   234,     0,   230,     0,    59,     0,
+     425,     0,    42,     0,     0,     0,     0,     0,     0,    14,
+     323,   311,   313,   315,   436,   453,   420,   410,   412,   414,
+     247,   238,   242,     0,     0,     0,   377,     0,   259,     0,
+       0,     0,     0,     0,     0,     0,   359,     0,     0,   235,
+     231,    89,   424,    29,    49,    23,    24,    30,     0,    39,
+       0,     0,   243,   153,   152,     0,   340,   342,   343,     0,
+       0,   270,     0,     0,     0,     0,     0,    40,   316,   415,
+     258,     0,     0,   271,   364,   363,     0,   345,     0,   347,
+       0,   341,   344,     0,   346,   348,   362,   360
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -686,  -686,  -686,   397,   -50,  -686,  -126,   194,   195,    77,
+     242,   400,   401,   402,   403,   399,  -686,   -86,   185,  -686,
+    -130,  -207,    92,     0,  -686,  -686,   669,  -686,   217,  -686,
+     -15,  -686,  -686,  -686,  -686,    78,  -686,  -686,  -686,   794,
+     -39,   -49,  -686,   476,  -686,   752,  -281,    17,    38,   -14,
+      -6,   846,   -89,  -686,    74,   457,  -686,  -686,  -214,  -197,
+    -418,  -185,   228,  -661,  -686,   302,  -187,  -686,   -85,   -61,
+    -400,  -686,   621,  -369,  -686,  -686,  -686,  -144,  -168,    -5,
+     767,  -686,  -686,  -686,  -680,  -301,   226,   328,   -55,   -42,
+    -179,   845,  -686,  -556,  -686,  -686,  -686,  -686,  -686,  -686,
+     165,  -686,  -686,  -686,  -686,   875,  -686,   308,  -686,    44,
+    -686,   745,  -162,   749,  -686,  -686,  -686,  -685,  -351,  -171,
+     587,  -686,  -103,   364,   141,  -545,   142,   148,    -4,  -686,
+     236
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,   140,   141,   479,   280,   143,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   281,   282,   505,
+     423,   256,   424,    90,    75,    71,    72,    35,    36,    37,
+     425,    38,   208,   609,   737,   738,    39,   397,    83,    84,
+      85,   284,   220,   221,    40,   145,   146,    41,    42,    43,
+      44,    67,   636,   237,   238,   239,   448,   240,   285,   637,
+     444,   603,   604,   605,   606,   607,   426,   427,   428,   228,
+     429,   430,   431,   432,   433,   626,    45,   171,   172,   173,
+     174,   534,   535,   782,   536,   308,   309,   310,   175,   176,
+     336,    91,    92,   434,   435,   436,   760,   437,   438,   755,
+     756,   805,   857,   846,    46,    47,    48,    53,   229,   230,
+      49,   194,   195,   196,   585,   586,   788,   587,   355,   356,
+     262,   357,   358,   359,   360,   361,   362,   363,   364,   365,
+     366
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      34,   142,   283,   332,   299,   236,   227,   193,   227,   255,
+      58,   398,   537,   371,   384,   520,   588,   294,   391,   469,
+     382,   783,   385,    78,   640,    66,    68,   451,   713,   715,
+      96,   633,   387,   214,  -375,    74,   741,    51,   443,   144,
+     210,    87,   789,   472,   169,   243,    34,   223,    65,    65,
+     507,    52,   694,   258,   259,   260,    86,   192,   144,   487,
+       1,   199,   634,   200,    50,   306,   306,     1,    64,     1,
+     793,   286,    73,   306,   306,   206,   759,   306,   306,   306,
+     306,   306,   306,  -334,   198,    99,   198,   510,   518,   306,
+     170,   640,    33,   243,   235,   197,    86,   144,  -375,   215,
+      86,   243,   243,    86,   459,   460,   147,   565,   566,   243,
+     243,   283,   692,   243,   243,   243,   243,   243,   243,   392,
+     227,   337,   193,   222,   193,   243,     1,   283,   224,   261,
+     742,   332,   255,   335,    89,   227,   839,   232,    33,   193,
+     838,   225,    94,   634,   300,    95,   307,  -334,   312,   215,
+     470,   335,   314,   315,   316,   548,   319,   793,   321,   323,
+     325,   516,     1,   329,   395,    89,   396,    55,   243,   785,
+     333,   519,   192,   339,   192,   354,   387,   368,   369,   370,
+     286,   373,   375,   377,   231,    30,   381,    55,   383,   192,
+     695,   207,    30,    56,   439,   611,   286,   440,   225,   613,
+      31,   399,    32,   807,   808,   226,   599,  -335,    55,   255,
+      59,     1,   706,    56,   218,    61,   306,   306,   306,   528,
+     155,   156,     1,   400,   618,   489,   567,   306,   697,   442,
+     215,   148,   215,   639,    56,    76,   461,   462,    60,   224,
+     520,   553,   554,    62,   177,   243,   209,   558,   559,   393,
+     507,    30,   243,   243,   243,   243,    82,   750,   215,    31,
+     201,    32,   226,   243,   401,   211,   287,   288,   289,   507,
+     769,  -335,   513,   441,   215,    70,   296,   517,   509,   507,
+     507,   297,   202,   193,   169,   751,   623,    30,   627,   628,
+     215,   630,   335,   212,   551,    31,    82,    32,    77,   213,
+      82,   749,   752,    82,   530,   521,   532,   263,   529,   218,
+     522,   219,   538,   539,   264,   540,   255,   541,    57,   542,
+     255,   543,   544,   545,   169,   546,   648,   649,   650,   547,
+     170,   550,    54,   192,   265,   629,   439,    63,   266,   440,
+     666,   507,   551,   335,    31,   293,    32,    30,   563,   213,
+      93,   564,   243,   267,   255,    31,   243,    32,   600,   452,
+     601,   645,   268,   753,   453,   454,   589,   590,   269,   591,
+     170,   592,   320,   593,   594,   595,   588,   596,   734,   597,
+     598,   205,   573,   579,   580,   317,   290,   574,   390,   291,
+     243,   292,   641,   729,   330,   642,   707,   243,   619,   270,
+     537,   334,   243,   243,   243,   243,   243,   243,   243,   243,
+     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
+     733,   271,   374,   376,   378,   379,   380,   743,    96,     9,
+     213,   731,   213,   442,   272,   767,   732,   222,   273,   235,
+     306,    20,    21,   306,   757,   306,   235,   274,   476,   477,
+     478,   480,   480,   480,   483,   480,   480,   486,   213,   480,
+     156,   490,   491,   492,   493,   708,   709,   156,   818,   156,
+     588,   776,   275,   819,   213,   480,   243,    64,   276,   243,
+     311,   243,   449,   450,   277,   744,   745,   746,   318,   169,
+     213,   322,   324,   326,   327,   328,   169,   475,   169,   278,
+     508,   508,   509,   440,   440,   279,   551,   703,   235,    31,
+     295,    32,   313,   529,   255,   581,   582,   455,   456,   537,
+     549,   768,   563,   367,   178,   402,   179,    31,   699,    32,
+     457,   458,   463,   464,   797,   170,   655,   656,   657,   658,
+     506,   507,   170,   702,   170,   203,   792,   568,   569,   226,
+     243,   372,   765,   571,   572,   798,   255,   551,   575,   576,
+     341,   342,   343,   577,   578,   394,   344,   345,   180,   403,
+     624,   625,   473,   445,   390,   720,   721,   722,   723,   725,
+     674,   675,   676,   675,   556,   446,   730,   823,   561,   562,
+     677,   675,   243,   447,   728,   679,   675,   243,   181,   155,
+     156,   680,   675,   465,   341,   342,   343,   804,   822,   466,
+     344,   345,   826,   827,   828,   306,   467,   182,   183,   184,
+     683,   675,   185,   186,   187,   188,   189,   190,   191,   169,
+     524,   525,   527,   792,   468,   346,   332,   471,   840,   693,
+     675,   235,   784,   563,   799,   507,   847,   511,   849,   651,
+     652,   243,   653,   654,   851,   255,   149,   531,   150,   830,
+     557,   854,   332,   855,   481,   482,   570,   484,   485,   800,
+     507,   488,   829,   801,   507,   170,   583,   834,   836,   346,
+     842,   507,   608,   811,   347,   348,   612,   515,   848,   507,
+     689,   243,   690,  -143,   349,   781,   615,   350,  -144,   351,
+     151,   616,   215,   850,   507,   659,   660,   617,   255,   668,
+     474,   353,   711,   712,   614,   152,   153,   716,   717,   243,
+     632,   787,   620,   178,   758,   718,   719,   621,   347,   348,
+     154,   155,   156,   631,   306,   646,   647,   667,   349,   669,
+     671,   350,   670,   351,   243,   672,   691,   673,   678,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   681,   682,   684,   685,   686,   180,   856,   687,
+     243,   688,   700,   156,   701,   704,   100,   101,   102,   103,
+     726,   736,   104,   105,   727,   739,   747,   740,   302,   754,
+     390,   761,   748,   762,   774,   763,   705,   181,   155,   156,
+     770,   775,   779,   780,   786,   106,   790,   170,   795,   803,
+     794,   802,   796,   809,   810,   813,   182,   183,   184,   724,
+     812,   185,   186,   187,   188,   189,   190,   191,   169,   341,
+     342,   343,   235,   814,   815,   344,   345,   494,   495,   496,
+     497,   498,   499,   500,   501,   502,   503,   816,   817,   825,
+     156,   107,   832,   841,   696,   108,   820,   109,   110,   698,
+     772,   821,   111,   852,   853,   661,   773,   662,   665,   663,
+     388,   664,   777,   824,   170,   610,   390,   217,    69,   169,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   298,
+     131,   241,   213,   644,   346,   771,   845,   512,   735,   133,
+     134,   135,   136,   137,   138,   139,   390,   301,   204,   778,
+     806,    98,   338,   149,   303,   170,   304,   305,   340,   100,
+     101,   102,   103,   555,   710,   104,   105,     0,     0,     0,
+       0,   302,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   347,   348,   584,     0,     0,   106,     0,
+       0,     0,     0,   349,     0,     0,   350,   151,   351,   504,
+       0,     0,     0,     0,     0,     0,     0,     0,   390,   352,
+     353,     0,   152,   153,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   154,   155,   156,
+       0,     0,     0,   390,   107,     0,     0,     0,   108,     0,
+     109,   110,   178,     0,   179,   111,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,     0,
+       0,     0,   169,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,     0,   131,   241,     0,   180,     0,     0,     0,
+       0,     0,   133,   134,   135,   136,   137,   138,   139,   100,
+     101,   102,   103,     0,   170,   104,   105,   303,   170,   304,
+     305,   302,     0,     0,     0,     0,   181,   155,   156,   341,
+     342,   343,     0,     0,     0,   344,   345,     0,   106,     0,
+       0,     0,     0,     0,     0,   182,   183,   184,     0,     0,
+     185,   186,   187,   188,   189,   190,   191,   169,     0,     0,
+       0,     0,   341,   342,   343,     0,     0,     0,   344,   345,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   107,     0,   386,     0,   108,     0,
+     109,   110,     0,     0,     0,   111,     0,     0,     0,     0,
+       0,     0,     0,   170,   346,     0,     0,     0,     0,     0,
+       0,     0,     0,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,     0,   131,   241,   533,   156,   346,     0,     0,
+       0,     0,   133,   134,   135,   136,   137,   138,   139,   100,
+     101,   102,   103,   347,   348,   104,   105,   303,     0,   304,
+     305,   302,     0,   349,     0,   169,   350,     0,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   106,   560,
+     353,     0,     0,     0,     0,     0,   347,   348,     0,     0,
+       0,     0,     0,     0,     0,     0,   349,     0,     0,   350,
+       0,   351,   341,   342,   343,     0,     0,     0,   344,   345,
+       0,   170,   352,   353,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   107,     0,     0,     0,   108,     0,
+     109,   110,     0,     0,     0,   111,     0,     0,     0,     0,
+       0,     0,     0,   100,   101,   102,   103,     0,     0,   104,
+     105,     0,     0,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   106,   131,   241,     0,     0,   346,     0,     0,
+       0,     0,   133,   134,   135,   136,   137,   138,   139,     0,
+       0,     0,     0,     0,     0,     0,     0,   303,     0,   304,
+     305,     0,     0,     0,     0,     0,     0,     0,     0,   100,
+     101,   102,   103,     0,     0,   104,   105,     0,   107,     0,
+       0,     0,   108,     0,   109,   110,   347,   348,     0,   111,
+       0,     0,     0,     0,     0,     0,   349,     0,   106,   350,
+       0,   351,   714,     0,     0,     0,   169,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,     0,   131,   241,     0,
+       0,     0,     0,     0,     0,     0,   133,   134,   135,   136,
+     137,   138,   139,     0,   107,     0,     0,     0,   108,     0,
+     109,   110,   170,     0,   305,   111,     0,   149,     0,   150,
+       0,     0,     0,   100,   101,   102,   103,     0,     0,   104,
+     105,     0,     0,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   106,   131,   241,     0,     0,     0,     0,     0,
+       0,   151,   133,   134,   135,   136,   137,   138,   139,     0,
+       0,     0,     0,     0,     0,     0,   152,   153,     0,   526,
+     305,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   154,   155,   156,     0,     0,     0,     0,   107,     0,
+       0,     0,   108,     0,   109,   110,   149,     0,   150,   111,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,     0,     0,     0,     0,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,     0,   131,   241,     0,
+     151,   331,     0,     0,     0,     0,   133,   134,   135,   136,
+     137,   138,   139,     0,     0,   152,   153,     0,   170,   149,
+       0,   150,     0,     0,   305,     0,     0,     0,     0,     0,
+     154,   155,   156,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,     0,   151,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   152,   153,
+       0,   149,     0,   150,     0,     0,     0,     0,     0,     0,
+     523,     0,     0,   154,   155,   156,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   170,     0,     0,
+       0,     0,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   151,     0,     0,     0,     0,
+     341,   342,   343,     0,     0,     0,   344,   345,     0,     0,
+     152,   153,     0,   178,     0,   179,     0,     0,     0,     0,
+       0,     0,     0,   831,     0,   154,   155,   156,     0,   341,
+     342,   343,     0,     0,     0,   344,   345,     0,     0,     0,
+     170,     0,     0,     0,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   180,   341,   342,
+     343,     0,     0,     0,   344,   345,   341,   342,   343,     0,
+       0,     0,   344,   345,     0,   346,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   843,     0,   181,   155,   156,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   170,   169,   346,     0,   182,   183,   184,     0,
+       0,   185,   186,   187,   188,   189,   190,   191,   169,     0,
+       0,     0,     0,     0,   347,   348,     0,     0,     0,     0,
+       0,     0,   169,   346,   349,     0,     0,   350,     0,   351,
+       0,   346,     0,     0,     0,     0,     0,   552,     0,   170,
+     352,   353,     0,   347,   348,     0,     0,     0,     0,     0,
+       0,     0,     0,   349,   170,     0,   350,     0,   351,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   170,     0,
+     353,     0,   347,   348,     0,     0,     0,     0,     0,     0,
+     347,   348,   349,     0,     0,   350,     0,   351,     0,     0,
+     349,     0,     0,   350,     0,   351,     0,     0,   352,   353,
+       0,     0,   404,   101,   102,   103,     2,   353,   104,   105,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   405,     0,
+       0,   106,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,   406,   407,   408,
+       0,   409,   410,   411,   412,   413,   414,   415,   416,     0,
+       0,    26,   417,     0,     0,     0,     0,   107,     0,    29,
+       0,   108,     0,   109,   110,     0,     0,     0,   111,   418,
+     419,   420,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,     0,   131,   241,     0,     0,
+       0,     0,     0,   226,   421,   133,   134,   135,   136,   137,
+     138,   139,   404,   101,   102,   103,     2,     0,   104,   105,
+       0,   422,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   405,     0,
+       0,   106,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,   406,   407,   408,
+       0,   409,   410,   411,   412,   413,   414,   415,   416,     0,
+       0,    26,   417,     0,     0,     0,     0,   107,     0,    29,
+       0,   108,     0,   109,   110,     0,     0,     0,   111,   418,
+     419,   420,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,     0,   131,   241,     0,     0,
+       0,     0,     0,   226,     0,   133,   134,   135,   136,   137,
+     138,   139,   100,   101,   102,   103,     2,     0,   104,   105,
+       0,   422,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     3,     0,
+       0,   106,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    26,     0,     0,     0,     0,     0,   107,     0,    29,
+       0,   108,     0,   109,   110,     0,     0,     0,   111,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,     0,   131,   241,     0,     0,
+       0,     0,     0,     0,     0,   133,   134,   135,   136,   137,
+     138,   139,   404,   101,   102,   103,     0,     0,   104,   105,
+       0,   422,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    56,     0,
+       0,   106,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   406,   407,   408,
+       0,   409,   410,   411,   412,   413,   414,   415,   416,     0,
+       0,     0,   417,   100,   101,   102,   103,   107,     0,   104,
+     105,   108,     0,   109,   110,     0,     0,     0,   111,   418,
+     419,   420,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   106,     0,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,     0,   131,   241,     0,     0,
+       0,     0,     0,   226,     0,   133,   134,   135,   136,   137,
+     138,   139,     0,     0,     0,     0,     0,     0,   107,     0,
+       0,   422,   108,     0,   109,   110,     0,     0,     0,   111,
+       0,     0,     0,     0,     0,     0,     0,   100,   101,   102,
+     103,     0,     0,   104,   105,     0,     0,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   106,   131,   241,     0,
+       0,     0,     0,     0,     0,     0,   133,   134,   135,   136,
+     137,   138,   139,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   622,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   107,     0,     0,     0,   108,     0,   109,   110,
+       0,     0,     0,   111,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+       0,   131,   241,     2,     0,     0,     0,     0,     0,     0,
+     133,   134,   135,   136,   137,   138,   139,     0,     0,     0,
+       0,     0,     0,     0,     0,     3,   422,     0,     0,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,     0,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,   100,   101,   102,   103,     2,     0,   104,   105,
+       0,     0,     0,     0,     0,     0,  -376,     0,    88,     0,
+       0,     0,     0,     0,     0,     0,    29,     0,     3,     0,
+       0,   106,     0,     0,     0,     0,     0,     9,    10,    11,
+      12,     0,     0,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   100,   101,   102,
+     103,     0,     0,   104,   105,     0,     0,   107,     0,    29,
+    -376,   108,     0,   109,   110,     0,     0,     0,   111,     0,
+       0,     0,     0,     0,     0,     0,   106,   203,     0,     0,
+       0,     0,     0,     0,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,     0,   131,   241,     0,     0,
+       0,     0,     0,   226,     0,   133,   134,   135,   136,   137,
+     138,   139,   107,     0,     0,     0,   108,     0,   109,   110,
+       0,     0,     0,   111,     0,     0,     0,     0,     0,     0,
+       0,   100,   101,   102,   103,     0,     0,   104,   105,     0,
+       0,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     106,   131,   241,     0,     0,   600,     0,   601,   389,   602,
+     133,   134,   135,   136,   137,   138,   139,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   100,   101,   102,   103,
+       0,     0,   104,   105,     0,     0,   107,     0,     0,     0,
+     108,     0,   109,   110,     0,     0,     0,   111,     0,     0,
+       0,     0,     0,     0,     0,   106,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,     0,   131,   241,     0,     0,   600,
+       0,   601,   389,   791,   133,   134,   135,   136,   137,   138,
+     139,   107,     0,     0,     0,   108,     0,   109,   110,     0,
+       0,     0,   111,     0,     0,     0,     0,     0,     0,     0,
+     100,   101,   102,   103,     0,     0,   104,   105,     0,     0,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   106,
+     131,   241,     0,     0,   600,     0,   601,   389,   837,   133,
+     134,   135,   136,   137,   138,   139,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   100,   101,   102,   103,     0,
+       0,   104,   105,     0,     0,   107,     0,     0,     0,   108,
+       0,   109,   110,     0,     0,     0,   111,     0,     0,     0,
+       0,     0,     0,     0,   106,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,     0,   131,   241,     0,     0,   600,     0,
+     601,   389,     0,   133,   134,   135,   136,   137,   138,   139,
+     107,     0,     0,     0,   108,     0,   109,   110,     0,     0,
+       0,   111,     0,     0,     0,     0,     0,     0,     0,   100,
+     101,   102,   103,     0,     0,   104,   105,     0,     0,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   106,   131,
+     241,     0,     0,     0,   242,     0,     0,     0,   133,   134,
+     135,   136,   137,   138,   139,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   100,   101,   102,   103,     0,     0,
+     104,   105,     0,     0,   107,     0,     0,     0,   108,     0,
+     109,   110,     0,     0,     0,   111,     0,     0,     0,     0,
+       0,     0,     0,   106,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,     0,   131,   241,     0,     0,     0,     0,     0,
+     389,     0,   133,   134,   135,   136,   137,   138,   139,   107,
+       0,     0,     0,   108,     0,   109,   110,     0,     0,     0,
+     111,     0,     0,     0,     0,     0,     0,     0,   100,   101,
+     102,   103,     0,     0,   104,   105,     0,     0,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   106,   131,   241,
+     514,     0,     0,     0,     0,     0,     0,   133,   134,   135,
+     136,   137,   138,   139,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   100,   101,   102,   103,     0,     0,   104,
+     105,     0,     0,   107,     0,     0,     0,   108,     0,   109,
+     110,     0,     0,     0,   111,     0,     0,     0,     0,     0,
+       0,     0,   106,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,     0,   131,   241,     0,     0,     0,   638,     0,     0,
+       0,   133,   134,   135,   136,   137,   138,   139,   107,     0,
+       0,     0,   108,     0,   109,   110,     0,     0,     0,   111,
+       0,     0,     0,     0,     0,     0,     0,   100,   101,   102,
+     103,     0,     0,   104,   105,     0,     0,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   106,   131,   241,     0,
+       0,     0,   766,     0,     0,     0,   133,   134,   135,   136,
+     137,   138,   139,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   100,   101,   102,   103,     0,     0,   104,   105,
+       0,     0,   107,     0,     0,     0,   108,     0,   109,   110,
+       0,     0,     0,   111,     0,     0,     0,     0,     0,     0,
+       0,   106,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+       0,   131,   241,     0,     0,     0,     0,     0,   691,     0,
+     133,   134,   135,   136,   137,   138,   139,   107,     0,     0,
+       0,   108,     0,   109,   110,     0,     0,     0,   111,     0,
+       0,     0,     0,     0,     0,     0,   100,   101,   102,   103,
+       0,     0,   104,   105,     0,     0,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   106,   131,   241,   833,     0,
+       0,     0,     0,     0,     0,   133,   134,   135,   136,   137,
+     138,   139,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   100,   101,   102,   103,     0,     0,   104,   105,     0,
+       0,   107,     0,     0,     0,   108,     0,   109,   110,     0,
+       0,     0,   111,     0,     0,     0,     0,     0,     0,     0,
+     106,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,     0,
+     131,   241,   835,     0,     0,     0,     0,     0,     0,   133,
+     134,   135,   136,   137,   138,   139,   107,     0,     0,     0,
+     108,     0,   109,   110,     0,     0,     0,   111,     0,     0,
+       0,     0,     0,     0,     0,   100,   101,   102,   103,     0,
+       0,   104,   105,     0,     0,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   106,   131,   132,     0,     0,     0,
+       0,     0,     0,     0,   133,   134,   135,   136,   137,   138,
+     139,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     100,   101,   102,   103,     0,     0,   104,   105,     0,     0,
+     107,     0,     0,     0,   108,     0,   109,   110,     0,     0,
+       0,   111,     0,     0,     0,     0,     0,     0,     0,   106,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,     0,   131,
+     257,     0,     0,     0,     0,     0,     0,     0,   133,   134,
+     135,   136,   137,   138,   139,   107,     0,     0,     0,   108,
+       0,   109,   110,     0,     0,     0,   111,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,    97,   131,   241,     1,     0,     0,     0,
+       2,     0,     0,   133,   134,   135,   136,   137,   138,   139,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     3,     0,     0,     0,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,     0,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    23,    24,    25,     1,
+       0,     0,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    26,    27,    28,     0,     0,
+       0,     0,     0,    29,     0,     3,     0,     0,     0,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,     0,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,     1,     0,     0,     0,     2,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    26,    27,
+      28,    30,     0,     0,     0,     0,    29,     0,     3,    31,
+       0,    32,     4,     5,     6,     7,     8,     9,    10,    11,
+      12,     0,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     0,     0,     0,     0,     2,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    26,     0,     0,    30,     0,     0,     0,     0,    29,
+       0,     3,    31,     0,    32,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,     0,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,     0,     0,
+       0,     0,     2,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    26,     0,     0,   439,   635,     0,
+     440,     0,    29,     0,     3,    31,     0,    32,     0,     0,
+      79,     0,     0,     9,    10,    11,    12,     0,     0,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,     0,     0,     0,     0,     0,     0,   233,     0,     0,
+       0,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+     508,   635,     0,   440,     0,    29,     0,     0,    31,     0,
+      32,    80,    81,     3,     0,     0,     0,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,     0,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+       0,     2,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    26,     0,     0,     0,
+     216,     0,     0,     3,    29,     0,     0,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,     0,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+       0,     0,     0,     2,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    26,     0,     0,     0,
+       0,     0,     0,   234,    29,     3,     0,     0,     0,     0,
+       0,    79,     0,     0,     9,    10,    11,    12,     0,     0,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,     0,     0,     0,     0,     0,     0,     2,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   764,     0,     0,    29,     0,     0,     0,
+       3,     0,    80,    81,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,   643,     2,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    26,     0,     0,     0,     0,     0,     0,
+       3,    29,     0,     0,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,   844,     2,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    26,     0,     0,     0,     0,     0,     0,
+       3,    29,     0,     0,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,     0,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,     2,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    26,     0,     0,     0,     0,     0,     3,
+       0,    29,     0,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,     0,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,     2,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    88,     0,     0,     0,     0,     0,     3,     0,
+      29,     0,     0,     0,    79,     0,     0,     9,    10,    11,
+      12,     0,     0,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    24,    25,     2,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     3,     0,    29,
+       0,     0,     0,     0,     0,     0,     9,    10,    11,    12,
+       0,     0,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    29
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,    51,   132,   171,   148,    94,    91,    62,    93,    95,
+      25,   218,   313,   184,   193,   296,   367,   143,   203,    18,
+     191,   701,   193,    38,   442,    31,    32,   241,   573,   574,
+      44,   431,   194,    82,    70,    35,    56,   128,   235,     3,
+      79,    41,   727,   257,   106,    95,    46,    86,    31,    32,
+     130,    72,   132,   103,   104,   105,    39,    62,     3,   273,
+       3,    67,   431,    69,    57,   151,   152,     3,    30,     3,
+     731,   132,    34,   159,   160,    75,   632,   163,   164,   165,
+     166,   167,   168,    70,    67,     3,    69,   284,   295,   175,
+     152,   509,     0,   143,    94,   129,    79,     3,   134,    82,
+      83,   151,   152,    86,    13,    14,   134,     9,    10,   159,
+     160,   241,   512,   163,   164,   165,   166,   167,   168,   204,
+     205,   176,   177,    85,   179,   175,     3,   257,    90,   131,
+     150,   299,   218,   175,    42,   220,   821,    93,    46,   194,
+     820,    70,   128,   512,   149,   131,   151,   134,   153,   132,
+     149,   193,   157,   158,   159,   334,   161,   818,   163,   164,
+     165,   291,     3,   168,   213,    73,   215,     3,   218,   714,
+     175,   135,   177,   178,   179,   180,   338,   182,   183,   184,
+     241,   186,   187,   188,    92,   128,   191,     3,   193,   194,
+     135,   128,   128,    29,   128,   402,   257,   131,    70,   406,
+     136,   130,   138,   759,   760,   134,   385,    70,     3,   295,
+     106,     3,   563,    29,   150,   106,   302,   303,   304,   305,
+      76,    77,     3,   152,   411,   275,   128,   313,   529,   235,
+     213,   134,   215,   440,    29,    71,   145,   146,   134,   201,
+     521,   344,   345,   134,   134,   295,   134,   350,   351,   205,
+     130,   128,   302,   303,   304,   305,    39,   106,   241,   136,
+     130,   138,   134,   313,   220,   150,     8,     9,    10,   130,
+     150,   134,   287,   235,   257,   152,   130,   292,   284,   130,
+     130,   135,   152,   338,   106,   134,   416,   128,   418,   419,
+     273,   152,   334,   150,   336,   136,    79,   138,   134,    82,
+      83,   152,   152,    86,   309,   130,   311,   128,   130,   150,
+     135,   152,   317,   318,   128,   320,   402,   322,   134,   324,
+     406,   326,   327,   328,   106,   330,   452,   453,   454,   334,
+     152,   336,    24,   338,   128,   420,   128,    29,   128,   131,
+     470,   130,   384,   385,   136,   129,   138,   128,   130,   132,
+      42,   356,   402,   128,   440,   136,   406,   138,   131,   138,
+     133,   447,   128,   152,   143,   144,   371,   372,   128,   374,
+     152,   376,     5,   378,   379,   380,   727,   382,   151,   384,
+     385,    73,   138,    13,    14,   159,   128,   143,   203,   131,
+     440,   133,   128,   600,   168,   131,   567,   447,   413,   128,
+     701,   175,   452,   453,   454,   455,   456,   457,   458,   459,
+     460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
+     605,   128,   186,   187,   188,   189,   190,   614,   442,    38,
+     213,   130,   215,   439,   128,   642,   135,   399,   128,   439,
+     526,    50,    51,   529,   631,   531,   446,   128,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   241,   274,
+      77,   276,   277,   278,   279,   568,   569,    77,   130,    77,
+     821,   685,   128,   135,   257,   290,   526,   439,   128,   529,
+     152,   531,   129,   130,   128,   615,   616,   617,   160,   106,
+     273,   163,   164,   165,   166,   167,   106,   261,   106,   128,
+     128,   128,   508,   131,   131,   128,   548,   549,   508,   136,
+     151,   138,   128,   130,   600,   145,   146,   139,   140,   820,
+     130,   647,   130,   128,     1,   150,     3,   136,   533,   138,
+      11,    12,    15,    16,   741,   152,   459,   460,   461,   462,
+     129,   130,   152,   548,   152,   151,   731,    11,    12,   134,
+     600,     5,   641,   147,   148,   742,   642,   599,   139,   140,
+       3,     4,     5,    30,    31,     5,     9,    10,    45,   128,
+      50,    51,    15,   129,   389,   579,   580,   581,   582,   584,
+     129,   130,   129,   130,   348,   130,   601,   794,   352,   353,
+     129,   130,   642,   151,   599,   129,   130,   647,    75,    76,
+      77,   129,   130,   136,     3,     4,     5,   751,   793,   147,
+       9,    10,   799,   800,   801,   701,   148,    94,    95,    96,
+     129,   130,    99,   100,   101,   102,   103,   104,   105,   106,
+     302,   303,   304,   818,    17,    78,   804,   132,   825,   129,
+     130,   641,   129,   130,   129,   130,   833,   129,   835,   455,
+     456,   701,   457,   458,   841,   741,     1,   131,     3,   803,
+       3,   848,   830,   850,   267,   268,   136,   270,   271,   129,
+     130,   274,   802,   129,   130,   152,   131,   807,   808,    78,
+     129,   130,   130,   769,   127,   128,     5,   290,   129,   130,
+     505,   741,   507,   150,   137,   700,   128,   140,   150,   142,
+      45,   128,   685,   129,   130,   463,   464,   128,   794,   473,
+     153,   154,   571,   572,   150,    60,    61,   575,   576,   769,
+     128,   726,   152,     1,   632,   577,   578,   152,   127,   128,
+      75,    76,    77,   150,   820,     3,   129,   129,   137,   153,
+     129,   140,   132,   142,   794,   129,   134,   129,   129,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   130,   130,   130,   130,   129,    45,   853,   130,
+     820,   129,   129,    77,   130,   129,     3,     4,     5,     6,
+     129,     3,     9,    10,   130,   129,    63,   129,    15,    79,
+     605,   129,   152,   129,     3,   132,   560,    75,    76,    77,
+     132,     3,   129,   132,   132,    32,   132,   152,   130,   134,
+     151,   128,   152,   129,   132,   129,    94,    95,    96,   583,
+     132,    99,   100,   101,   102,   103,   104,   105,   106,     3,
+       4,     5,   832,   129,   129,     9,    10,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,   129,   129,   150,
+      77,    78,   128,    61,   526,    82,   130,    84,    85,   531,
+     675,   130,    89,   152,   129,   465,   681,   466,   469,   467,
+     201,   468,   687,   795,   152,   399,   691,    83,    32,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   147,
+     127,   128,   685,   446,    78,   669,   832,   286,   606,   136,
+     137,   138,   139,   140,   141,   142,   731,   150,    73,   691,
+     755,    46,   177,     1,   151,   152,   153,   154,   179,     3,
+       4,     5,     6,   346,   570,     9,    10,    -1,    -1,    -1,
+      -1,    15,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   127,   128,   129,    -1,    -1,    32,    -1,
+      -1,    -1,    -1,   137,    -1,    -1,   140,    45,   142,   151,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   793,   153,
+     154,    -1,    60,    61,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    75,    76,    77,
+      -1,    -1,    -1,   818,    78,    -1,    -1,    -1,    82,    -1,
+      84,    85,     1,    -1,     3,    89,    94,    95,    96,    97,
+      98,    99,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,    -1,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,   136,   137,   138,   139,   140,   141,   142,     3,
+       4,     5,     6,    -1,   152,     9,    10,   151,   152,   153,
+     154,    15,    -1,    -1,    -1,    -1,    75,    76,    77,     3,
+       4,     5,    -1,    -1,    -1,     9,    10,    -1,    32,    -1,
+      -1,    -1,    -1,    -1,    -1,    94,    95,    96,    -1,    -1,
+      99,   100,   101,   102,   103,   104,   105,   106,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,    -1,    -1,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   135,    -1,    82,    -1,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   152,    78,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,   129,    77,    78,    -1,    -1,
+      -1,    -1,   136,   137,   138,   139,   140,   141,   142,     3,
+       4,     5,     6,   127,   128,     9,    10,   151,    -1,   153,
+     154,    15,    -1,   137,    -1,   106,   140,    -1,   142,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,   153,
+     154,    -1,    -1,    -1,    -1,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   137,    -1,    -1,   140,
+      -1,   142,     3,     4,     5,    -1,    -1,    -1,     9,    10,
+      -1,   152,   153,   154,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,    82,    -1,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    32,   127,   128,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,   136,   137,   138,   139,   140,   141,   142,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   151,    -1,   153,
+     154,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    -1,    78,    -1,
+      -1,    -1,    82,    -1,    84,    85,   127,   128,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,   137,    -1,    32,   140,
+      -1,   142,   143,    -1,    -1,    -1,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,   138,   139,
+     140,   141,   142,    -1,    78,    -1,    -1,    -1,    82,    -1,
+      84,    85,   152,    -1,   154,    89,    -1,     1,    -1,     3,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    32,   127,   128,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,   136,   137,   138,   139,   140,   141,   142,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    60,    61,    -1,   153,
+     154,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    75,    76,    77,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,    -1,    82,    -1,    84,    85,     1,    -1,     3,    89,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    -1,   127,   128,    -1,
+      45,   135,    -1,    -1,    -1,    -1,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,    60,    61,    -1,   152,     1,
+      -1,     3,    -1,    -1,   154,    -1,    -1,    -1,    -1,    -1,
+      75,    76,    77,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    60,    61,
+      -1,     1,    -1,     3,    -1,    -1,    -1,    -1,    -1,    -1,
+     135,    -1,    -1,    75,    76,    77,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,    -1,    -1,
+      -1,    -1,    94,    95,    96,    97,    98,    99,   100,   101,
+     102,   103,   104,   105,   106,    45,    -1,    -1,    -1,    -1,
+       3,     4,     5,    -1,    -1,    -1,     9,    10,    -1,    -1,
+      60,    61,    -1,     1,    -1,     3,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   135,    -1,    75,    76,    77,    -1,     3,
+       4,     5,    -1,    -1,    -1,     9,    10,    -1,    -1,    -1,
+     152,    -1,    -1,    -1,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   105,   106,    45,     3,     4,
+       5,    -1,    -1,    -1,     9,    10,     3,     4,     5,    -1,
+      -1,    -1,     9,    10,    -1,    78,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   135,    -1,    75,    76,    77,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   152,   106,    78,    -1,    94,    95,    96,    -1,
+      -1,    99,   100,   101,   102,   103,   104,   105,   106,    -1,
+      -1,    -1,    -1,    -1,   127,   128,    -1,    -1,    -1,    -1,
+      -1,    -1,   106,    78,   137,    -1,    -1,   140,    -1,   142,
+      -1,    78,    -1,    -1,    -1,    -1,    -1,   135,    -1,   152,
+     153,   154,    -1,   127,   128,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   137,   152,    -1,   140,    -1,   142,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   152,    -1,
+     154,    -1,   127,   128,    -1,    -1,    -1,    -1,    -1,    -1,
+     127,   128,   137,    -1,    -1,   140,    -1,   142,    -1,    -1,
+     137,    -1,    -1,   140,    -1,   142,    -1,    -1,   153,   154,
+      -1,    -1,     3,     4,     5,     6,     7,   154,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    -1,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    58,    59,    60,
+      -1,    62,    63,    64,    65,    66,    67,    68,    69,    -1,
+      -1,    72,    73,    -1,    -1,    -1,    -1,    78,    -1,    80,
+      -1,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    90,
+      91,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     3,     4,     5,     6,     7,    -1,     9,    10,
+      -1,   152,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    -1,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    58,    59,    60,
+      -1,    62,    63,    64,    65,    66,    67,    68,    69,    -1,
+      -1,    72,    73,    -1,    -1,    -1,    -1,    78,    -1,    80,
+      -1,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    90,
+      91,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,     3,     4,     5,     6,     7,    -1,     9,    10,
+      -1,   152,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      -1,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    -1,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    72,    -1,    -1,    -1,    -1,    -1,    78,    -1,    80,
+      -1,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,   138,   139,   140,
+     141,   142,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      -1,   152,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    58,    59,    60,
+      -1,    62,    63,    64,    65,    66,    67,    68,    69,    -1,
+      -1,    -1,    73,     3,     4,     5,     6,    78,    -1,     9,
+      10,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    90,
+      91,    92,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    32,    -1,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,    -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+      -1,   152,    82,    -1,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    32,   127,   128,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   152,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,    -1,    -1,    82,    -1,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+     136,   137,   138,   139,   140,   141,   142,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    29,   152,    -1,    -1,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,     3,     4,     5,     6,     7,    -1,     9,    10,
+      -1,    -1,    -1,    -1,    -1,    -1,    70,    -1,    72,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    80,    -1,    29,    -1,
+      -1,    32,    -1,    -1,    -1,    -1,    -1,    38,    39,    40,
+      41,    -1,    -1,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,    78,    -1,    80,
+     134,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    32,   151,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    -1,   127,   128,    -1,    -1,
+      -1,    -1,    -1,   134,    -1,   136,   137,   138,   139,   140,
+     141,   142,    78,    -1,    -1,    -1,    82,    -1,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    -1,
+      -1,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      32,   127,   128,    -1,    -1,   131,    -1,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,     9,    10,    -1,    -1,    78,    -1,    -1,    -1,
+      82,    -1,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    -1,   127,   128,    -1,    -1,   131,
+      -1,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,    78,    -1,    -1,    -1,    82,    -1,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    32,
+     127,   128,    -1,    -1,   131,    -1,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    -1,    -1,    78,    -1,    -1,    -1,    82,
+      -1,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,    -1,   127,   128,    -1,    -1,   131,    -1,
+     133,   134,    -1,   136,   137,   138,   139,   140,   141,   142,
+      78,    -1,    -1,    -1,    82,    -1,    84,    85,    -1,    -1,
+      -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    32,   127,
+     128,    -1,    -1,    -1,   132,    -1,    -1,    -1,   136,   137,
+     138,   139,   140,   141,   142,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,
+       9,    10,    -1,    -1,    78,    -1,    -1,    -1,    82,    -1,
+      84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,    -1,   127,   128,    -1,    -1,    -1,    -1,    -1,
+     134,    -1,   136,   137,   138,   139,   140,   141,   142,    78,
+      -1,    -1,    -1,    82,    -1,    84,    85,    -1,    -1,    -1,
+      89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,    -1,    -1,     9,    10,    -1,    -1,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,    32,   127,   128,
+     129,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,   138,
+     139,   140,   141,   142,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,
+      10,    -1,    -1,    78,    -1,    -1,    -1,    82,    -1,    84,
+      85,    -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,    -1,   127,   128,    -1,    -1,    -1,   132,    -1,    -1,
+      -1,   136,   137,   138,   139,   140,   141,   142,    78,    -1,
+      -1,    -1,    82,    -1,    84,    85,    -1,    -1,    -1,    89,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+       6,    -1,    -1,     9,    10,    -1,    -1,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
+     120,   121,   122,   123,   124,   125,    32,   127,   128,    -1,
+      -1,    -1,   132,    -1,    -1,    -1,   136,   137,   138,   139,
+     140,   141,   142,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,    -1,    -1,     9,    10,
+      -1,    -1,    78,    -1,    -1,    -1,    82,    -1,    84,    85,
+      -1,    -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
+      -1,   127,   128,    -1,    -1,    -1,    -1,    -1,   134,    -1,
+     136,   137,   138,   139,   140,   141,   142,    78,    -1,    -1,
+      -1,    82,    -1,    84,    85,    -1,    -1,    -1,    89,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+      -1,    -1,     9,    10,    -1,    -1,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,    32,   127,   128,   129,    -1,
+      -1,    -1,    -1,    -1,    -1,   136,   137,   138,   139,   140,
+     141,   142,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,     6,    -1,    -1,     9,    10,    -1,
+      -1,    78,    -1,    -1,    -1,    82,    -1,    84,    85,    -1,
+      -1,    -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      32,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,    -1,
+     127,   128,   129,    -1,    -1,    -1,    -1,    -1,    -1,   136,
+     137,   138,   139,   140,   141,   142,    78,    -1,    -1,    -1,
+      82,    -1,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,     6,    -1,
+      -1,     9,    10,    -1,    -1,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,    32,   127,   128,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   136,   137,   138,   139,   140,   141,
+     142,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,    -1,    -1,     9,    10,    -1,    -1,
+      78,    -1,    -1,    -1,    82,    -1,    84,    85,    -1,    -1,
+      -1,    89,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   125,    -1,   127,
+     128,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   136,   137,
+     138,   139,   140,   141,   142,    78,    -1,    -1,    -1,    82,
+      -1,    84,    85,    -1,    -1,    -1,    89,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,     0,   127,   128,     3,    -1,    -1,    -1,
+       7,    -1,    -1,   136,   137,   138,   139,   140,   141,   142,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    29,    -1,    -1,    -1,    33,    34,    35,    36,
+      37,    38,    39,    40,    41,    -1,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,     3,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    72,    73,    74,    -1,    -1,
+      -1,    -1,    -1,    80,    -1,    29,    -1,    -1,    -1,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    -1,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,     3,    -1,    -1,    -1,     7,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    72,    73,
+      74,   128,    -1,    -1,    -1,    -1,    80,    -1,    29,   136,
+      -1,   138,    33,    34,    35,    36,    37,    38,    39,    40,
+      41,    -1,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,    -1,    -1,    -1,    -1,     7,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    72,    -1,    -1,   128,    -1,    -1,    -1,    -1,    80,
+      -1,    29,   136,    -1,   138,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    -1,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    -1,    -1,
+      -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    72,    -1,    -1,   128,   129,    -1,
+     131,    -1,    80,    -1,    29,   136,    -1,   138,    -1,    -1,
+      35,    -1,    -1,    38,    39,    40,    41,    -1,    -1,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    -1,    -1,    -1,    -1,    -1,    -1,     3,    -1,    -1,
+      -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     128,   129,    -1,   131,    -1,    80,    -1,    -1,   136,    -1,
+     138,    86,    87,    29,    -1,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    -1,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,
+     135,    -1,    -1,    29,    80,    -1,    -1,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    -1,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      -1,    -1,    -1,     7,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,
+      -1,    -1,    -1,   129,    80,    29,    -1,    -1,    -1,    -1,
+      -1,    35,    -1,    -1,    38,    39,    40,    41,    -1,    -1,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    -1,    -1,    -1,    -1,    -1,    -1,     7,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   129,    -1,    -1,    80,    -1,    -1,    -1,
+      29,    -1,    86,    87,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    -1,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,     7,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,
+      29,    80,    -1,    -1,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    -1,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,    56,     7,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    -1,
+      29,    80,    -1,    -1,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    -1,    43,    44,    45,    46,    47,    48,
+      49,    50,    51,    52,    53,    54,    55,     7,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    29,
+      -1,    80,    -1,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    -1,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,     7,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,    29,    -1,
+      80,    -1,    -1,    -1,    35,    -1,    -1,    38,    39,    40,
+      41,    -1,    -1,    44,    45,    46,    47,    48,    49,    50,
+      51,    52,    53,    54,    55,     7,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    -1,    80,
+      -1,    -1,    -1,    -1,    -1,    -1,    38,    39,    40,    41,
+      -1,    -1,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    80
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     3,     7,    29,    33,    34,    35,    36,    37,    38,
+      39,    40,    41,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    72,    73,    74,    80,
+     128,   136,   138,   177,   178,   182,   183,   184,   186,   191,
+     199,   202,   203,   204,   205,   231,   259,   260,   261,   265,
+      57,   128,    72,   262,   262,     3,    29,   134,   185,   106,
+     134,   106,   134,   262,   203,   202,   205,   206,   205,   206,
+     152,   180,   181,   203,   178,   179,    71,   134,   185,    35,
+      86,    87,   183,   193,   194,   195,   202,   178,    72,   177,
+     178,   246,   247,   262,   128,   131,   204,     0,   260,     3,
+       3,     4,     5,     6,     9,    10,    32,    78,    82,    84,
+      85,    89,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   127,   128,   136,   137,   138,   139,   140,   141,   142,
+     156,   157,   159,   160,     3,   200,   201,   134,   134,     1,
+       3,    45,    60,    61,    75,    76,    77,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   106,
+     152,   232,   233,   234,   235,   243,   244,   134,     1,     3,
+      45,    75,    94,    95,    96,    99,   100,   101,   102,   103,
+     104,   105,   234,   243,   266,   267,   268,   129,   202,   205,
+     205,   130,   152,   151,   246,   262,   178,   128,   187,   134,
+     195,   150,   150,   183,   196,   202,   135,   194,   150,   152,
+     197,   198,   203,   195,   203,    70,   134,   223,   224,   263,
+     264,   177,   264,     3,   129,   178,   207,   208,   209,   210,
+     212,   128,   132,   159,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   176,   128,   159,   159,
+     159,   131,   275,   128,   128,   128,   128,   128,   128,   128,
+     128,   128,   128,   128,   128,   128,   128,   128,   128,   128,
+     159,   172,   173,   175,   196,   213,   224,     8,     9,    10,
+     128,   131,   133,   129,   161,   151,   130,   135,   200,   232,
+     234,   235,    15,   151,   153,   154,   172,   234,   240,   241,
+     242,   242,   234,   128,   234,   234,   234,   241,   242,   234,
+       5,   234,   242,   234,   242,   234,   242,   242,   242,   234,
+     241,   135,   233,   234,   241,   244,   245,   243,   266,   234,
+     268,     3,     4,     5,     9,    10,    78,   127,   128,   137,
+     140,   142,   153,   154,   234,   273,   274,   276,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   128,   234,   234,
+     234,   274,     5,   234,   285,   234,   285,   234,   285,   285,
+     285,   234,   274,   234,   245,   274,   135,   267,   181,   134,
+     173,   216,   223,   264,     5,   196,   196,   192,   176,   130,
+     152,   264,   150,   128,     3,    29,    58,    59,    60,    62,
+      63,    64,    65,    66,    67,    68,    69,    73,    90,    91,
+      92,   135,   152,   175,   177,   185,   221,   222,   223,   225,
+     226,   227,   228,   229,   248,   249,   250,   252,   253,   128,
+     131,   203,   205,   214,   215,   129,   130,   151,   211,   129,
+     130,   213,   138,   143,   144,   139,   140,    11,    12,    13,
+      14,   145,   146,    15,    16,   136,   147,   148,    17,    18,
+     149,   132,   213,    15,   153,   285,   173,   173,   173,   158,
+     173,   158,   158,   173,   158,   158,   173,   213,   158,   159,
+     173,   173,   173,   173,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,   151,   174,   129,   130,   128,   205,
+     214,   129,   227,   185,   129,   158,   175,   185,   176,   135,
+     201,   130,   135,   135,   242,   242,   153,   242,   172,   130,
+     234,   131,   234,   129,   236,   237,   239,   240,   234,   234,
+     234,   234,   234,   234,   234,   234,   234,   234,   245,   130,
+     234,   244,   135,   277,   277,   275,   285,     3,   277,   277,
+     153,   285,   285,   130,   234,     9,    10,   128,    11,    12,
+     136,   147,   148,   138,   143,   139,   140,    30,    31,    13,
+      14,   145,   146,   131,   129,   269,   270,   272,   273,   234,
+     234,   234,   234,   234,   234,   234,   234,   234,   234,   245,
+     131,   133,   135,   216,   217,   218,   219,   220,   130,   188,
+     198,   176,     5,   176,   150,   128,   128,   128,   221,   185,
+     152,   152,   152,   175,    50,    51,   230,   175,   175,   223,
+     152,   150,   128,   225,   228,   129,   207,   214,   132,   176,
+     215,   128,   131,    56,   210,   172,     3,   129,   161,   161,
+     161,   162,   162,   163,   163,   164,   164,   164,   164,   165,
+     165,   166,   167,   168,   169,   170,   175,   129,   285,   153,
+     132,   129,   129,   129,   129,   130,   129,   129,   129,   129,
+     129,   130,   130,   129,   130,   130,   129,   130,   129,   173,
+     173,   134,   225,   129,   132,   135,   242,   240,   242,   234,
+     129,   130,   234,   244,   129,   285,   273,   274,   277,   277,
+     278,   279,   279,   280,   143,   280,   281,   281,   282,   282,
+     283,   283,   283,   283,   285,   234,   129,   130,   234,   176,
+     185,   130,   135,   216,   151,   220,     3,   189,   190,   129,
+     129,    56,   150,   221,   175,   175,   175,    63,   152,   152,
+     106,   134,   152,   152,    79,   254,   255,   221,   177,   248,
+     251,   129,   129,   132,   129,   207,   132,   176,   161,   150,
+     132,   285,   173,   173,     3,     3,   213,   173,   217,   129,
+     132,   234,   238,   239,   129,   280,   132,   234,   271,   272,
+     132,   135,   216,   218,   151,   130,   152,   176,   221,   129,
+     129,   129,   128,   134,   232,   256,   255,   248,   248,   129,
+     132,   172,   132,   129,   129,   129,   129,   129,   130,   135,
+     130,   130,   216,   176,   190,   150,   221,   221,   221,   175,
+     232,   135,   128,   129,   175,   129,   175,   135,   239,   272,
+     221,    61,   129,   135,    56,   209,   258,   221,   129,   221,
+     129,   221,   152,   129,   221,   221,   223,   257
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   155,   156,   156,   156,   156,   156,   156,   156,   156,
+     156,   156,   156,   156,   156,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   157,   157,   157,   157,   157,   157,   157,   157,   157,
+     157,   158,   158,   159,   159,   159,   159,   159,   159,   159,
+     160,   160,   160,   160,   160,   160,   160,   160,   161,   161,
+     162,   162,   162,   162,   163,   163,   163,   164,   164,   164,
+     165,   165,   165,   165,   165,   166,   166,   166,   167,   167,
+     168,   168,   169,   169,   170,   170,   171,   171,   172,   172,
+     173,   173,   174,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,   175,   175,   176,   177,   177,   178,   178,
+     178,   178,   178,   178,   179,   180,   180,   181,   181,   182,
+     182,   182,   182,   182,   182,   182,   183,   183,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   183,   183,
+     184,   184,   184,   185,   185,   186,   186,   186,   187,   188,
+     188,   189,   189,   190,   191,   191,   192,   193,   193,   194,
+     194,   194,   194,   194,   195,   195,   195,   195,   195,   196,
+     196,   196,   196,   197,   197,   198,   198,   198,   199,   199,
+     199,   199,   199,   200,   200,   201,   201,   202,   202,   202,
+     203,   203,   204,   204,   204,   204,   204,   204,   204,   204,
+     205,   205,   205,   205,   205,   205,   205,   205,   206,   206,
+     207,   207,   208,   208,   209,   209,   209,   210,   211,   211,
+     212,   212,   213,   213,   214,   214,   214,   215,   215,   215,
+     215,   215,   215,   215,   215,   215,   216,   216,   216,   216,
+     217,   217,   217,   217,   218,   219,   219,   220,   220,   221,
+     221,   221,   221,   221,   221,   221,   221,   222,   222,   222,
+     222,   223,   223,   224,   225,   226,   227,   227,   228,   228,
+     229,   229,   230,   230,   230,   231,   231,   232,   232,   233,
+     233,   234,   234,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   235,   235,   235,   235,   235,   235,   235,   235,
+     235,   235,   236,   236,   237,   238,   238,   239,   240,   240,
+     240,   240,   240,   240,   241,   241,   242,   242,   243,   243,
+     244,   245,   245,   245,   246,   246,   247,   247,   248,   248,
+     249,   249,   249,   250,   250,   250,   250,   250,   250,   251,
+     252,   252,   252,   252,   252,   252,   252,   253,   254,   254,
+     255,   256,   257,   258,   258,   259,   259,   260,   260,   260,
+     260,   261,   261,   261,   261,   262,   262,   263,   264,   264,
+     265,   265,   266,   266,   267,   267,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   268,   268,   268,   268,   268,   268,   268,   268,   268,
+     268,   269,   269,   270,   271,   271,   272,   273,   273,   273,
+     273,   274,   274,   275,   275,   275,   275,   276,   276,   276,
+     276,   276,   276,   276,   276,   276,   276,   277,   277,   277,
+     277,   277,   278,   278,   278,   279,   279,   280,   280,   280,
+     281,   281,   281,   281,   282,   282,   282,   283,   283,   283,
+     284,   284,   284,   284,   284,   285,   285
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     2,     1,     1,     1,     1,     1,
+       1,     1,     1,     3,     5,     1,     4,     4,     4,     4,
+       4,     4,     4,     6,     6,     4,     4,     4,     4,     6,
+       6,     4,     4,     3,     4,     3,     3,     2,     2,     6,
+       7,     1,     3,     1,     2,     2,     2,     4,     2,     6,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
+       1,     3,     3,     3,     1,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     3,     3,     1,     3,
+       1,     3,     1,     3,     1,     3,     1,     3,     1,     5,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     1,     2,     3,     1,     2,
+       2,     3,     1,     2,     0,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     4,
+       4,     2,     3,     1,     1,     2,     2,     2,     4,     2,
+       0,     1,     3,     3,     3,     2,     0,     1,     2,     2,
+       3,     2,     2,     3,     2,     1,     2,     1,     2,     2,
+       1,     2,     1,     1,     3,     1,     2,     3,     4,     5,
+       5,     6,     2,     1,     3,     1,     3,     1,     1,     1,
+       2,     1,     1,     3,     3,     4,     3,     4,     4,     3,
+       1,     2,     2,     3,     1,     2,     2,     3,     1,     2,
+       1,     3,     1,     3,     2,     2,     1,     2,     2,     0,
+       1,     3,     1,     2,     1,     1,     2,     3,     2,     3,
+       3,     4,     2,     3,     3,     4,     1,     3,     4,     2,
+       1,     2,     3,     4,     2,     1,     2,     3,     2,     1,
+       1,     1,     1,     1,     1,     1,     1,     3,     6,     4,
+       3,     2,     3,     1,     1,     1,     1,     2,     1,     1,
+       5,     6,     0,     1,     1,     4,     5,     1,     2,     1,
+       2,     1,     1,     1,     2,     2,     3,     2,     3,     2,
+       3,     2,     3,     3,     4,     2,     2,     2,     3,     2,
+       3,     3,     3,     3,     3,     2,     2,     3,     2,     3,
+       4,     5,     1,     3,     1,     1,     3,     1,     1,     2,
+       2,     3,     2,     4,     1,     3,     1,     2,     1,     2,
+       1,     1,     2,     3,     1,     2,     1,     2,     1,     2,
+       5,     7,     5,     5,     7,     6,     7,     6,     7,     1,
+       3,     2,     2,     2,     3,     3,     3,     3,     1,     2,
+       7,     0,     0,     1,     1,     1,     2,     1,     1,     1,
+       1,     4,     4,     3,     3,     1,     0,     5,     1,     1,
+       4,     5,     1,     2,     1,     2,     1,     2,     2,     3,
+       2,     3,     2,     3,     2,     3,     3,     4,     2,     2,
+       2,     3,     2,     3,     3,     3,     3,     2,     3,     4,
+       5,     1,     3,     1,     1,     3,     1,     1,     2,     3,
+       4,     1,     3,     3,     5,     4,     0,     1,     1,     1,
+       2,     1,     2,     3,     2,     2,     4,     1,     2,     2,
+       2,     2,     1,     3,     3,     1,     3,     1,     3,     3,
+       1,     3,     3,     4,     1,     3,     3,     1,     3,     3,
+       1,     3,     3,     3,     3,     1,     2
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = CGRAMYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == CGRAMYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use CGRAMYYerror or CGRAMYYUNDEF. */
+#define YYERRCODE CGRAMYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if CGRAMYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !CGRAMYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !CGRAMYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = CGRAMYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == CGRAMYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= CGRAMYYEOF)
+    {
+      yychar = CGRAMYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == CGRAMYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = CGRAMYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = CGRAMYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 2: /* primary_expression: "identifier"  */
+#line 1129 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4011 "build/cgram.tab.c"
+    break;
+
+  case 3: /* primary_expression: "constant"  */
+#line 1131 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4017 "build/cgram.tab.c"
+    break;
+
+  case 4: /* primary_expression: "hardware register" optpasmrange  */
+#line 1133 "frontends/c/cgram.y"
+            {
+                AST *reg = (yyvsp[-1].ast);
+                AST *range = (yyvsp[0].ast);
+                if (range) {
+                    AST *index = NewAST(AST_RANGE, range, NULL);
+                    AST *base = NewAST(AST_RANGEREF, reg, index);
+                    if (range->kind == AST_BIGIMMHOLDER) {
+                        base = NewAST(AST_BIGIMMHOLDER, base, NULL);
+                    }
+                    (yyval.ast) = base;
+                } else {
+                    (yyval.ast) = reg;
+                }
+            }
+#line 4036 "build/cgram.tab.c"
+    break;
+
+  case 5: /* primary_expression: "this"  */
+#line 1148 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_SELF, NULL, NULL); }
+#line 4042 "build/cgram.tab.c"
+    break;
+
+  case 6: /* primary_expression: "true"  */
+#line 1150 "frontends/c/cgram.y"
+            { (yyval.ast) = AstInteger(1); }
+#line 4048 "build/cgram.tab.c"
+    break;
+
+  case 7: /* primary_expression: "false"  */
+#line 1152 "frontends/c/cgram.y"
+            { (yyval.ast) = AstInteger(0); }
+#line 4054 "build/cgram.tab.c"
+    break;
+
+  case 8: /* primary_expression: "nullptr"  */
+#line 1154 "frontends/c/cgram.y"
+            { (yyval.ast) = AstBitValue(0); }
+#line 4060 "build/cgram.tab.c"
+    break;
+
+  case 9: /* primary_expression: "string literal"  */
+#line 1156 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_STRINGPTR, (yyvsp[0].ast), NULL); }
+#line 4066 "build/cgram.tab.c"
+    break;
+
+  case 10: /* primary_expression: "__func__ or __FUNCTION__"  */
+#line 1158 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_FUNC_NAME, NULL, NULL); }
+#line 4072 "build/cgram.tab.c"
+    break;
+
+  case 11: /* primary_expression: "__builtin_printf"  */
+#line 1160 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_PRINT, NULL, NULL); }
+#line 4078 "build/cgram.tab.c"
+    break;
+
+  case 12: /* primary_expression: '$'  */
+#line 1162 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_HERE, NULL, NULL); }
+#line 4084 "build/cgram.tab.c"
+    break;
+
+  case 13: /* primary_expression: '(' expression ')'  */
+#line 1164 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 4090 "build/cgram.tab.c"
+    break;
+
+  case 14: /* primary_expression: '(' compound_statement_open block_item_list compound_statement_close ')'  */
+#line 1166 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-2].list).head; }
+#line 4096 "build/cgram.tab.c"
+    break;
+
+  case 15: /* postfix_expression: primary_expression  */
+#line 1171 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4102 "build/cgram.tab.c"
+    break;
+
+  case 16: /* postfix_expression: "__builtin_abs" '(' assignment_expression ')'  */
+#line 1173 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_ABS, NULL, (yyvsp[-1].ast)); }
+#line 4108 "build/cgram.tab.c"
+    break;
+
+  case 17: /* postfix_expression: "__builtin_clz" '(' assignment_expression ')'  */
+#line 1175 "frontends/c/cgram.y"
+            {
+                AST *expr = AstOperator(K_ENCODE, NULL, (yyvsp[-1].ast));
+                expr = AstOperator('-', AstInteger(32), expr);
+                (yyval.ast) = expr;
+            }
+#line 4118 "build/cgram.tab.c"
+    break;
+
+  case 18: /* postfix_expression: "__builtin_sqrt" '(' assignment_expression ')'  */
+#line 1181 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_SQRT, NULL, (yyvsp[-1].ast)); }
+#line 4124 "build/cgram.tab.c"
+    break;
+
+  case 19: /* postfix_expression: "__builtin_rev" '(' argument_expression_list ')'  */
+#line 1183 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = (yyvsp[-1].list).head;
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_rev");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_rev");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+
+                // PropGCC defines __builtin_rev to match the ASM instruction,
+                // not the >< operator, hence the 32 - arg2
+                (yyval.ast) = AstOperator(K_REV, arg1, AstOperator('-', AstInteger(32), arg2));
+            }
+#line 4154 "build/cgram.tab.c"
+    break;
+
+  case 20: /* postfix_expression: "__builtin_frac" '(' argument_expression_list ')'  */
+#line 1209 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = (yyvsp[-1].list).head;
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_frac");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_frac");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                (yyval.ast) = AstOperator(K_FRAC64, arg1, arg2);
+            }
+#line 4181 "build/cgram.tab.c"
+    break;
+
+  case 21: /* postfix_expression: "__builtin_muluh" '(' argument_expression_list ')'  */
+#line 1232 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = (yyvsp[-1].list).head;
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_muluh");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_muluh");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                (yyval.ast) = AstOperator(K_UNS_HIGHMULT, arg1, arg2);
+            }
+#line 4208 "build/cgram.tab.c"
+    break;
+
+  case 22: /* postfix_expression: "__builtin_mulh" '(' argument_expression_list ')'  */
+#line 1255 "frontends/c/cgram.y"
+            {
+                AST *list;
+                AST *arg1, *arg2;
+                
+                list = (yyvsp[-1].list).head;
+                if (!list || !list->left)
+                {
+                    SYNTAX_ERROR("Missing argument to __builtin_mulh");
+                    arg1 = AstInteger(1);
+                } else {
+                    arg1 = list->left;
+                }
+                if (list && list->right) {
+                    arg2 = list->right->left;
+                    if (list->right->right) {
+                        SYNTAX_ERROR("Too many arguments to __builtin_mulh");
+                    }
+                } else {
+                    arg2 = AstInteger(0);
+                }
+                (yyval.ast) = AstOperator(K_HIGHMULT, arg1, arg2);
+            }
+#line 4235 "build/cgram.tab.c"
+    break;
+
+  case 23: /* postfix_expression: "__builtin_va_start" '(' unary_expression ',' "identifier" ')'  */
+#line 1278 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_VA_START, (yyvsp[-3].ast), (yyvsp[-1].ast));
+            }
+#line 4243 "build/cgram.tab.c"
+    break;
+
+  case 24: /* postfix_expression: "__builtin_va_arg" '(' assignment_expression ',' type_name ')'  */
+#line 1282 "frontends/c/cgram.y"
+            {
+                // NOTE: like an AST_MEMREF, the type goes first
+                (yyval.ast) = NewAST(AST_VA_ARG, (yyvsp[-1].ast), (yyvsp[-3].ast));
+            }
+#line 4252 "build/cgram.tab.c"
+    break;
+
+  case 25: /* postfix_expression: "__builtin_setjmp" '(' assignment_expression ')'  */
+#line 1287 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_SETJMP, (yyvsp[-1].ast), NULL);
+            }
+#line 4260 "build/cgram.tab.c"
+    break;
+
+  case 26: /* postfix_expression: "__builtin_alloca" '(' assignment_expression ')'  */
+#line 1291 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ALLOCA, ast_type_ptr_void, (yyvsp[-1].ast)); }
+#line 4266 "build/cgram.tab.c"
+    break;
+
+  case 27: /* postfix_expression: "__builtin_cogstart" '(' argument_expression_list ')'  */
+#line 1293 "frontends/c/cgram.y"
+            {
+                AST *elist;
+                AST *immval = AstInteger(0x1e);
+                elist = NewAST(AST_EXPRLIST, immval, NULL);
+                elist = AddToList(elist, (yyvsp[-1].list).head);
+                (yyval.ast) = NewAST(AST_COGINIT, elist, NULL);
+            }
+#line 4278 "build/cgram.tab.c"
+    break;
+
+  case 28: /* postfix_expression: "__builtin_cogstart_cog" '(' argument_expression_list ')'  */
+#line 1301 "frontends/c/cgram.y"
+            {
+                AST *elist = (yyvsp[-1].list).head;
+                (yyval.ast) = NewAST(AST_COGINIT, elist, NULL);
+            }
+#line 4287 "build/cgram.tab.c"
+    break;
+
+  case 29: /* postfix_expression: "__builtin_expect" '(' assignment_expression ',' assignment_expression ')'  */
+#line 1306 "frontends/c/cgram.y"
+            { 
+                (yyval.ast) = NewAST(AST_EXPECT, (yyvsp[-3].ast), (yyvsp[-1].ast));
+            }
+#line 4295 "build/cgram.tab.c"
+    break;
+
+  case 30: /* postfix_expression: "__builtin_longjmp" '(' assignment_expression ',' assignment_expression ')'  */
+#line 1310 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_THROW, (yyvsp[-1].ast), (yyvsp[-3].ast));
+            }
+#line 4303 "build/cgram.tab.c"
+    break;
+
+  case 31: /* postfix_expression: "__builtin_strlen" '(' assignment_expression ')'  */
+#line 1314 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = AstOperator(K_STRLEN, NULL, (yyvsp[-1].ast));
+            }
+#line 4311 "build/cgram.tab.c"
+    break;
+
+  case 32: /* postfix_expression: postfix_expression '[' expression ']'  */
+#line 1318 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 4317 "build/cgram.tab.c"
+    break;
+
+  case 33: /* postfix_expression: postfix_expression '(' ')'  */
+#line 1320 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-2].ast), NULL); }
+#line 4323 "build/cgram.tab.c"
+    break;
+
+  case 34: /* postfix_expression: postfix_expression '(' argument_expression_list ')'  */
+#line 1322 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 4329 "build/cgram.tab.c"
+    break;
+
+  case 35: /* postfix_expression: postfix_expression '.' any_identifier  */
+#line 1324 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_METHODREF, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4335 "build/cgram.tab.c"
+    break;
+
+  case 36: /* postfix_expression: postfix_expression "->" any_identifier  */
+#line 1326 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_METHODREF,
+                          NewAST(AST_ARRAYREF, (yyvsp[-2].ast), AstInteger(0)),
+                          (yyvsp[0].ast));
+            }
+#line 4344 "build/cgram.tab.c"
+    break;
+
+  case 37: /* postfix_expression: postfix_expression "++"  */
+#line 1331 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_INCREMENT, (yyvsp[-1].ast), NULL); }
+#line 4350 "build/cgram.tab.c"
+    break;
+
+  case 38: /* postfix_expression: postfix_expression "--"  */
+#line 1333 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_DECREMENT, (yyvsp[-1].ast), NULL); }
+#line 4356 "build/cgram.tab.c"
+    break;
+
+  case 39: /* postfix_expression: '(' type_name ')' '{' initializer_list '}'  */
+#line 1335 "frontends/c/cgram.y"
+            {
+                /* FIXME: treat this like ({ type_name t = initializer_list; t; }) */
+                AST *typ = (yyvsp[-4].ast);
+                AST *initlist = (yyvsp[-1].ast);
+                AST *id = AstTempIdentifier("_initval_");
+
+                AST *decl;
+                AST *stmt;
+
+                decl = SingleDeclareInitedVar(typ, id, initlist);
+                stmt = NewAST(AST_STMTLIST, decl, NULL);                
+                stmt = AddToList(stmt, NewAST(AST_STMTLIST, id, NULL));
+                (yyval.ast) = stmt;
+            }
+#line 4375 "build/cgram.tab.c"
+    break;
+
+  case 40: /* postfix_expression: '(' type_name ')' '{' initializer_list ',' '}'  */
+#line 1350 "frontends/c/cgram.y"
+            {
+                /* treat this like ({ type_name t = initializer_list; t; }) */
+                AST *typ = (yyvsp[-5].ast);
+                AST *initlist = (yyvsp[-2].ast);
+                AST *id = AstTempIdentifier("_initval_");
+
+                AST *decl = AstAssign(id, initlist);
+                AST *stmt;
+
+                DeclareOneGlobalVar(current, decl, typ, IN_DAT);
+                stmt = NewAST(AST_STMTLIST, id, NULL);
+                (yyval.ast) = stmt;
+            }
+#line 4393 "build/cgram.tab.c"
+    break;
+
+  case 41: /* argument_expression_list: assignment_expression  */
+#line 1367 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 4399 "build/cgram.tab.c"
+    break;
+
+  case 42: /* argument_expression_list: argument_expression_list ',' assignment_expression  */
+#line 1369 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 4405 "build/cgram.tab.c"
+    break;
+
+  case 43: /* unary_expression: postfix_expression  */
+#line 1374 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4411 "build/cgram.tab.c"
+    break;
+
+  case 44: /* unary_expression: "++" unary_expression  */
+#line 1376 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_INCREMENT, NULL, (yyvsp[0].ast)); }
+#line 4417 "build/cgram.tab.c"
+    break;
+
+  case 45: /* unary_expression: "--" unary_expression  */
+#line 1378 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_DECREMENT, NULL, (yyvsp[0].ast)); }
+#line 4423 "build/cgram.tab.c"
+    break;
+
+  case 46: /* unary_expression: unary_operator cast_expression  */
+#line 1380 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = (yyvsp[-1].ast);
+                if ((yyval.ast)->kind == AST_ADDROF ||
+                    (yyval.ast)->kind == AST_ABSADDROF ||
+                    (yyval.ast)->kind == AST_ARRAYREF)
+                    (yyval.ast)->left = (yyvsp[0].ast);
+                else
+                    (yyval.ast)->right = (yyvsp[0].ast);
+            }
+#line 4437 "build/cgram.tab.c"
+    break;
+
+  case 47: /* unary_expression: "sizeof" '(' type_name ')'  */
+#line 1390 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_SIZEOF, (yyvsp[-1].ast), NULL); }
+#line 4443 "build/cgram.tab.c"
+    break;
+
+  case 48: /* unary_expression: "sizeof" unary_expression  */
+#line 1392 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_SIZEOF, (yyvsp[0].ast), NULL); }
+#line 4449 "build/cgram.tab.c"
+    break;
+
+  case 49: /* unary_expression: "__builtin_offsetof" '(' type_name ',' "identifier" ')'  */
+#line 1394 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_OFFSETOF, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 4455 "build/cgram.tab.c"
+    break;
+
+  case 50: /* unary_operator: '&'  */
+#line 1399 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ADDROF, NULL, NULL); }
+#line 4461 "build/cgram.tab.c"
+    break;
+
+  case 51: /* unary_operator: '@'  */
+#line 1401 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ADDROF, NULL, NULL); }
+#line 4467 "build/cgram.tab.c"
+    break;
+
+  case 52: /* unary_operator: "@@@"  */
+#line 1403 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ABSADDROF, NULL, NULL); }
+#line 4473 "build/cgram.tab.c"
+    break;
+
+  case 53: /* unary_operator: '*'  */
+#line 1405 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYREF, NULL, AstInteger(0)); }
+#line 4479 "build/cgram.tab.c"
+    break;
+
+  case 54: /* unary_operator: '+'  */
+#line 1407 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('+', NULL, NULL); }
+#line 4485 "build/cgram.tab.c"
+    break;
+
+  case 55: /* unary_operator: '-'  */
+#line 1409 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_NEGATE, NULL, NULL); }
+#line 4491 "build/cgram.tab.c"
+    break;
+
+  case 56: /* unary_operator: '~'  */
+#line 1411 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_BIT_NOT, NULL, NULL); }
+#line 4497 "build/cgram.tab.c"
+    break;
+
+  case 57: /* unary_operator: '!'  */
+#line 1413 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_BOOL_NOT, NULL, NULL); }
+#line 4503 "build/cgram.tab.c"
+    break;
+
+  case 58: /* cast_expression: unary_expression  */
+#line 1418 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4509 "build/cgram.tab.c"
+    break;
+
+  case 59: /* cast_expression: '(' type_name ')' cast_expression  */
+#line 1420 "frontends/c/cgram.y"
+            {
+                AST *typ = (yyvsp[-2].ast);
+                AST *expr = (yyvsp[0].ast);
+                (yyval.ast) = NewAST(AST_CAST, typ, expr);
+            }
+#line 4519 "build/cgram.tab.c"
+    break;
+
+  case 60: /* multiplicative_expression: cast_expression  */
+#line 1436 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4525 "build/cgram.tab.c"
+    break;
+
+  case 61: /* multiplicative_expression: multiplicative_expression '*' cast_expression  */
+#line 1438 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('*', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4531 "build/cgram.tab.c"
+    break;
+
+  case 62: /* multiplicative_expression: multiplicative_expression '/' cast_expression  */
+#line 1440 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('/', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4537 "build/cgram.tab.c"
+    break;
+
+  case 63: /* multiplicative_expression: multiplicative_expression '%' cast_expression  */
+#line 1442 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_MODULUS, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4543 "build/cgram.tab.c"
+    break;
+
+  case 64: /* additive_expression: multiplicative_expression  */
+#line 1447 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4549 "build/cgram.tab.c"
+    break;
+
+  case 65: /* additive_expression: additive_expression '+' multiplicative_expression  */
+#line 1449 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('+', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4555 "build/cgram.tab.c"
+    break;
+
+  case 66: /* additive_expression: additive_expression '-' multiplicative_expression  */
+#line 1451 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('-', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4561 "build/cgram.tab.c"
+    break;
+
+  case 67: /* shift_expression: additive_expression  */
+#line 1456 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4567 "build/cgram.tab.c"
+    break;
+
+  case 68: /* shift_expression: shift_expression "<<" additive_expression  */
+#line 1458 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_SHL, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4573 "build/cgram.tab.c"
+    break;
+
+  case 69: /* shift_expression: shift_expression ">>" additive_expression  */
+#line 1460 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_SAR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4579 "build/cgram.tab.c"
+    break;
+
+  case 70: /* relational_expression: shift_expression  */
+#line 1465 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4585 "build/cgram.tab.c"
+    break;
+
+  case 71: /* relational_expression: relational_expression '<' shift_expression  */
+#line 1467 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('<', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4591 "build/cgram.tab.c"
+    break;
+
+  case 72: /* relational_expression: relational_expression '>' shift_expression  */
+#line 1469 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('>', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4597 "build/cgram.tab.c"
+    break;
+
+  case 73: /* relational_expression: relational_expression "<=" shift_expression  */
+#line 1471 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_LE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4603 "build/cgram.tab.c"
+    break;
+
+  case 74: /* relational_expression: relational_expression ">=" shift_expression  */
+#line 1473 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_GE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4609 "build/cgram.tab.c"
+    break;
+
+  case 75: /* equality_expression: relational_expression  */
+#line 1478 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4615 "build/cgram.tab.c"
+    break;
+
+  case 76: /* equality_expression: equality_expression "==" relational_expression  */
+#line 1480 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_EQ, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4621 "build/cgram.tab.c"
+    break;
+
+  case 77: /* equality_expression: equality_expression "!=" relational_expression  */
+#line 1482 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_NE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4627 "build/cgram.tab.c"
+    break;
+
+  case 78: /* and_expression: equality_expression  */
+#line 1487 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4633 "build/cgram.tab.c"
+    break;
+
+  case 79: /* and_expression: and_expression '&' equality_expression  */
+#line 1489 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('&', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4639 "build/cgram.tab.c"
+    break;
+
+  case 80: /* exclusive_or_expression: and_expression  */
+#line 1494 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4645 "build/cgram.tab.c"
+    break;
+
+  case 81: /* exclusive_or_expression: exclusive_or_expression '^' and_expression  */
+#line 1496 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('^', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4651 "build/cgram.tab.c"
+    break;
+
+  case 82: /* inclusive_or_expression: exclusive_or_expression  */
+#line 1501 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4657 "build/cgram.tab.c"
+    break;
+
+  case 83: /* inclusive_or_expression: inclusive_or_expression '|' exclusive_or_expression  */
+#line 1503 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4663 "build/cgram.tab.c"
+    break;
+
+  case 84: /* logical_and_expression: inclusive_or_expression  */
+#line 1508 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4669 "build/cgram.tab.c"
+    break;
+
+  case 85: /* logical_and_expression: logical_and_expression "&&" inclusive_or_expression  */
+#line 1510 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_BOOL_AND, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4675 "build/cgram.tab.c"
+    break;
+
+  case 86: /* logical_or_expression: logical_and_expression  */
+#line 1515 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4681 "build/cgram.tab.c"
+    break;
+
+  case 87: /* logical_or_expression: logical_or_expression "||" logical_and_expression  */
+#line 1517 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_BOOL_OR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4687 "build/cgram.tab.c"
+    break;
+
+  case 88: /* conditional_expression: logical_or_expression  */
+#line 1522 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4693 "build/cgram.tab.c"
+    break;
+
+  case 89: /* conditional_expression: logical_or_expression '?' expression ':' conditional_expression  */
+#line 1524 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_CONDRESULT, (yyvsp[-4].ast), NewAST(AST_THENELSE, (yyvsp[-2].ast), (yyvsp[0].ast))); }
+#line 4699 "build/cgram.tab.c"
+    break;
+
+  case 90: /* assignment_expression: conditional_expression  */
+#line 1529 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4705 "build/cgram.tab.c"
+    break;
+
+  case 91: /* assignment_expression: unary_expression assignment_operator assignment_expression  */
+#line 1531 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->left = (yyvsp[-2].ast); (yyval.ast)->right = (yyvsp[0].ast); }
+#line 4711 "build/cgram.tab.c"
+    break;
+
+  case 92: /* assignment_operator: '='  */
+#line 1536 "frontends/c/cgram.y"
+            { (yyval.ast) = AstAssign(NULL, NULL); }
+#line 4717 "build/cgram.tab.c"
+    break;
+
+  case 93: /* assignment_operator: "*="  */
+#line 1538 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('*', NULL, NULL); }
+#line 4723 "build/cgram.tab.c"
+    break;
+
+  case 94: /* assignment_operator: "/="  */
+#line 1540 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('/', NULL, NULL); }
+#line 4729 "build/cgram.tab.c"
+    break;
+
+  case 95: /* assignment_operator: "%="  */
+#line 1542 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign(K_MODULUS, NULL, NULL); }
+#line 4735 "build/cgram.tab.c"
+    break;
+
+  case 96: /* assignment_operator: "+="  */
+#line 1544 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('+', NULL, NULL); }
+#line 4741 "build/cgram.tab.c"
+    break;
+
+  case 97: /* assignment_operator: "-="  */
+#line 1546 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('-', NULL, NULL); }
+#line 4747 "build/cgram.tab.c"
+    break;
+
+  case 98: /* assignment_operator: "<<="  */
+#line 1548 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign(K_SHL, NULL, NULL); }
+#line 4753 "build/cgram.tab.c"
+    break;
+
+  case 99: /* assignment_operator: ">>="  */
+#line 1550 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign(K_SAR, NULL, NULL); }
+#line 4759 "build/cgram.tab.c"
+    break;
+
+  case 100: /* assignment_operator: "&="  */
+#line 1552 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('&', NULL, NULL); }
+#line 4765 "build/cgram.tab.c"
+    break;
+
+  case 101: /* assignment_operator: "^="  */
+#line 1554 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('^', NULL, NULL); }
+#line 4771 "build/cgram.tab.c"
+    break;
+
+  case 102: /* assignment_operator: "|="  */
+#line 1556 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOpAssign('|', NULL, NULL); }
+#line 4777 "build/cgram.tab.c"
+    break;
+
+  case 103: /* expression: assignment_expression  */
+#line 1561 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4783 "build/cgram.tab.c"
+    break;
+
+  case 104: /* expression: expression ',' assignment_expression  */
+#line 1563 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_SEQUENCE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4789 "build/cgram.tab.c"
+    break;
+
+  case 105: /* constant_expression: conditional_expression  */
+#line 1568 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4795 "build/cgram.tab.c"
+    break;
+
+  case 106: /* declaration: declaration_specifiers ';'  */
+#line 1573 "frontends/c/cgram.y"
+            { (yyval.ast) = SingleDeclareVar(NULL, (yyvsp[-1].ast)); }
+#line 4801 "build/cgram.tab.c"
+    break;
+
+  case 107: /* declaration: declaration_specifiers init_declarator_list ';'  */
+#line 1575 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = MultipleDeclareVar((yyvsp[-2].ast), (yyvsp[-1].list).head);
+            }
+#line 4809 "build/cgram.tab.c"
+    break;
+
+  case 108: /* declaration_specifiers: storage_class_specifier  */
+#line 1582 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4815 "build/cgram.tab.c"
+    break;
+
+  case 109: /* declaration_specifiers: storage_class_specifier declaration_specifiers  */
+#line 1584 "frontends/c/cgram.y"
+            {
+                AST *prefix = (yyvsp[-1].ast);
+                AST *suffix = (yyvsp[0].ast);
+                (yyval.ast) = MergePrefix(prefix, suffix);
+            }
+#line 4825 "build/cgram.tab.c"
+    break;
+
+  case 110: /* declaration_specifiers: type_specifier reset_identifier_expectation  */
+#line 1590 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); AllowTypeNames(); }
+#line 4831 "build/cgram.tab.c"
+    break;
+
+  case 111: /* declaration_specifiers: type_specifier reset_identifier_expectation declaration_specifiers  */
+#line 1592 "frontends/c/cgram.y"
+            { (yyval.ast) = C_ModifySignedUnsigned((yyvsp[-2].ast), (yyvsp[0].ast)); AllowTypeNames(); }
+#line 4837 "build/cgram.tab.c"
+    break;
+
+  case 112: /* declaration_specifiers: type_qualifier  */
+#line 1594 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); (yyval.ast)->left = ast_type_long; }
+#line 4843 "build/cgram.tab.c"
+    break;
+
+  case 113: /* declaration_specifiers: type_qualifier declaration_specifiers  */
+#line 1596 "frontends/c/cgram.y"
+            { (yyval.ast) = MergePrefix((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 4849 "build/cgram.tab.c"
+    break;
+
+  case 114: /* reset_identifier_expectation: %empty  */
+#line 1601 "frontends/c/cgram.y"
+            { DisallowTypeNames(); }
+#line 4855 "build/cgram.tab.c"
+    break;
+
+  case 115: /* init_declarator_list: init_declarator  */
+#line 1606 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 4861 "build/cgram.tab.c"
+    break;
+
+  case 116: /* init_declarator_list: init_declarator_list ',' init_declarator  */
+#line 1608 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 4867 "build/cgram.tab.c"
+    break;
+
+  case 117: /* init_declarator: declarator  */
+#line 1613 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4873 "build/cgram.tab.c"
+    break;
+
+  case 118: /* init_declarator: declarator '=' initializer  */
+#line 1615 "frontends/c/cgram.y"
+            { (yyval.ast) = AstAssign((yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 4879 "build/cgram.tab.c"
+    break;
+
+  case 119: /* storage_class_specifier: "typedef"  */
+#line 1620 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_TYPEDEF, NULL, NULL); }
+#line 4885 "build/cgram.tab.c"
+    break;
+
+  case 120: /* storage_class_specifier: "extern"  */
+#line 1622 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_EXTERN, NULL, NULL); }
+#line 4891 "build/cgram.tab.c"
+    break;
+
+  case 121: /* storage_class_specifier: "static"  */
+#line 1624 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_STATIC, NULL, NULL); }
+#line 4897 "build/cgram.tab.c"
+    break;
+
+  case 122: /* storage_class_specifier: "auto"  */
+#line 1626 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 4903 "build/cgram.tab.c"
+    break;
+
+  case 123: /* storage_class_specifier: "inline"  */
+#line 1628 "frontends/c/cgram.y"
+            {                
+                //AST *attr = NewAST(AST_ANNOTATION, NULL, NULL);
+                //attr->d.string = "inline";
+                //$$ = attr;
+                (yyval.ast) = NULL; /* ignore for now */
+            }
+#line 4914 "build/cgram.tab.c"
+    break;
+
+  case 124: /* storage_class_specifier: "__attribute__"  */
+#line 1635 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 4920 "build/cgram.tab.c"
+    break;
+
+  case 125: /* storage_class_specifier: "register"  */
+#line 1637 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_REGISTER, NULL, NULL); }
+#line 4926 "build/cgram.tab.c"
+    break;
+
+  case 126: /* type_specifier: "void"  */
+#line 1642 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_void; }
+#line 4932 "build/cgram.tab.c"
+    break;
+
+  case 127: /* type_specifier: "char"  */
+#line 1644 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_byte; }
+#line 4938 "build/cgram.tab.c"
+    break;
+
+  case 128: /* type_specifier: "_Bool"  */
+#line 1646 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_c_boolean_small; }
+#line 4944 "build/cgram.tab.c"
+    break;
+
+  case 129: /* type_specifier: "short"  */
+#line 1648 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_signed_word; }
+#line 4950 "build/cgram.tab.c"
+    break;
+
+  case 130: /* type_specifier: "int"  */
+#line 1650 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_long; }
+#line 4956 "build/cgram.tab.c"
+    break;
+
+  case 131: /* type_specifier: "long"  */
+#line 1652 "frontends/c/cgram.y"
+            {
+                if (!ast_type_c_long) {
+                    // same as ast_type_long, but a distinct memory address
+                    // so we can distinguish it
+                    ast_type_c_long = NewAST(AST_INTTYPE, AstInteger(4), NULL);
+                }
+                (yyval.ast) = ast_type_c_long;
+            }
+#line 4969 "build/cgram.tab.c"
+    break;
+
+  case 132: /* type_specifier: "float"  */
+#line 1661 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_float; }
+#line 4975 "build/cgram.tab.c"
+    break;
+
+  case 133: /* type_specifier: "double"  */
+#line 1663 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_float; }
+#line 4981 "build/cgram.tab.c"
+    break;
+
+  case 134: /* type_specifier: "signed"  */
+#line 1665 "frontends/c/cgram.y"
+            {
+                if (!ast_type_c_signed) {
+                    // same as ast_type_long, but a distinct memory address
+                    // so we can distinguish it
+                    ast_type_c_signed = NewAST(AST_INTTYPE, AstInteger(4), NULL);
+                }
+                (yyval.ast) = ast_type_c_signed;
+            }
+#line 4994 "build/cgram.tab.c"
+    break;
+
+  case 135: /* type_specifier: "unsigned"  */
+#line 1674 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_unsigned_long; }
+#line 5000 "build/cgram.tab.c"
+    break;
+
+  case 136: /* type_specifier: struct_or_union_specifier  */
+#line 1676 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5006 "build/cgram.tab.c"
+    break;
+
+  case 137: /* type_specifier: enum_specifier  */
+#line 1678 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5012 "build/cgram.tab.c"
+    break;
+
+  case 138: /* type_specifier: "type name"  */
+#line 1680 "frontends/c/cgram.y"
+            {
+                AST *ident = (yyvsp[0].ast);
+                Symbol *sym = LookupSymbolInTable(currentTypes, ident->d.string);
+                if (sym && sym->kind == SYM_TYPEDEF) {
+                    (yyval.ast) = (AST *)sym->v.ptr;
+                } else {
+                    SYNTAX_ERROR("Internal error, bad typename %s", ident->d.string);
+                    (yyval.ast) = NULL;
+                }
+            }
+#line 5027 "build/cgram.tab.c"
+    break;
+
+  case 139: /* type_specifier: "typeof" '(' unary_expression ')'  */
+#line 1691 "frontends/c/cgram.y"
+            {
+                AST *expr = (yyvsp[-1].ast);
+                AST *typ = NewAST(AST_TYPEOF, expr, NULL);
+                (yyval.ast) = typ;
+            }
+#line 5037 "build/cgram.tab.c"
+    break;
+
+  case 140: /* struct_or_union_specifier: struct_open struct_declaration_list '}' struct_close  */
+#line 1700 "frontends/c/cgram.y"
+            {
+                AST *d = (yyvsp[-3].ast);
+                AddStructBody(current, (yyvsp[-2].list).head);
+                PopCurrentModule();
+                (yyval.ast) = d;
+            }
+#line 5048 "build/cgram.tab.c"
+    break;
+
+  case 141: /* struct_or_union_specifier: struct_or_union any_identifier  */
+#line 1707 "frontends/c/cgram.y"
+            { (yyval.ast) = MakeNewStruct(current, (yyvsp[-1].ast), (yyvsp[0].ast), NULL, NULL); }
+#line 5054 "build/cgram.tab.c"
+    break;
+
+  case 142: /* struct_or_union_specifier: struct_or_union "__using" using_clause  */
+#line 1709 "frontends/c/cgram.y"
+            {
+                AST *body = (yyvsp[0].ast);
+                AST *options = NULL;
+                if (body && body->kind == AST_EXPRLIST) {
+                    options = body->right;
+                    body = body->left;
+                }
+                (yyval.ast) = MakeNewStruct(current, (yyvsp[-2].ast), NULL, body, options);
+            }
+#line 5068 "build/cgram.tab.c"
+    break;
+
+  case 143: /* any_identifier: "identifier"  */
+#line 1722 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5074 "build/cgram.tab.c"
+    break;
+
+  case 144: /* any_identifier: "type name"  */
+#line 1724 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5080 "build/cgram.tab.c"
+    break;
+
+  case 145: /* struct_or_union: "struct" attribute_decl  */
+#line 1728 "frontends/c/cgram.y"
+            {
+                AST *c = NewAST(AST_STRUCT, (yyvsp[0].ast), NULL);
+                c->d.ival = 0;  // public by default
+                (yyval.ast) = c;
+            }
+#line 5090 "build/cgram.tab.c"
+    break;
+
+  case 146: /* struct_or_union: "class" attribute_decl  */
+#line 1734 "frontends/c/cgram.y"
+            {
+                AST *c = NewAST(AST_STRUCT, (yyvsp[0].ast), NULL);
+                c->d.ival = 1;  // private by default
+                (yyval.ast) = c;
+            }
+#line 5100 "build/cgram.tab.c"
+    break;
+
+  case 147: /* struct_or_union: "union" attribute_decl  */
+#line 1740 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_UNION, (yyvsp[0].ast), NULL); }
+#line 5106 "build/cgram.tab.c"
+    break;
+
+  case 148: /* using_clause: '(' "string literal" optobjarguments ')'  */
+#line 1745 "frontends/c/cgram.y"
+            {
+                AST *str = (yyvsp[-2].ast);
+                AST *options = (yyvsp[-1].ast);
+                if (str && str->kind == AST_EXPRLIST) {
+                    str = str->left;
+                }
+                if (options) {
+                    str = NewAST(AST_EXPRLIST, str, options);
+                }
+                (yyval.ast) = str;
+            }
+#line 5122 "build/cgram.tab.c"
+    break;
+
+  case 149: /* optobjarguments: ',' objargs  */
+#line 1760 "frontends/c/cgram.y"
+          { (yyval.ast) = (yyvsp[0].list).head; }
+#line 5128 "build/cgram.tab.c"
+    break;
+
+  case 150: /* optobjarguments: %empty  */
+#line 1762 "frontends/c/cgram.y"
+          { (yyval.ast) = NULL; }
+#line 5134 "build/cgram.tab.c"
+    break;
+
+  case 151: /* objargs: one_objarg  */
+#line 1767 "frontends/c/cgram.y"
+         { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 5140 "build/cgram.tab.c"
+    break;
+
+  case 152: /* objargs: objargs ',' one_objarg  */
+#line 1769 "frontends/c/cgram.y"
+         {
+             (yyval.list) = ListBuilderAdd((yyvsp[-2].list), CommentedListHolder((yyvsp[0].ast)));
+         }
+#line 5148 "build/cgram.tab.c"
+    break;
+
+  case 153: /* one_objarg: "identifier" '=' constant_expression  */
+#line 1776 "frontends/c/cgram.y"
+        {
+            (yyval.ast) = NewAST(AST_ASSIGN, (yyvsp[-2].ast), (yyvsp[0].ast));
+        }
+#line 5156 "build/cgram.tab.c"
+    break;
+
+  case 154: /* struct_open: struct_or_union any_identifier '{'  */
+#line 1783 "frontends/c/cgram.y"
+            {
+                AST *newstruct;
+                Module *C;
+                newstruct = MakeNewStruct(current, (yyvsp[-2].ast), (yyvsp[-1].ast), NULL, NULL);
+                (yyval.ast) = newstruct;
+                C = GetClassPtr(newstruct);
+                if (current != C) {
+                    C->superclass = current;
+                    //printf("class transition: %s -> %s\n", current->classname, C->classname);
+                }
+                PushCurrentModule();
+                current = C;
+                PushCurrentTypes();
+            }
+#line 5175 "build/cgram.tab.c"
+    break;
+
+  case 155: /* struct_open: struct_or_union '{'  */
+#line 1798 "frontends/c/cgram.y"
+            {
+                AST *newstruct;
+                Module *C;
+                newstruct = MakeNewStruct(current, (yyvsp[-1].ast), NULL, NULL, NULL);
+                (yyval.ast) = newstruct;
+                C = GetClassPtr(newstruct);
+                if (C != current) {
+                    C->superclass = current;
+                }
+                PushCurrentModule();
+                current = C;
+                PushCurrentTypes();
+            }
+#line 5193 "build/cgram.tab.c"
+    break;
+
+  case 156: /* struct_close: %empty  */
+#line 1814 "frontends/c/cgram.y"
+    {
+        PopCurrentTypes();
+    }
+#line 5201 "build/cgram.tab.c"
+    break;
+
+  case 157: /* struct_declaration_list: struct_declaration  */
+#line 1821 "frontends/c/cgram.y"
+           { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 5207 "build/cgram.tab.c"
+    break;
+
+  case 158: /* struct_declaration_list: struct_declaration_list struct_declaration  */
+#line 1823 "frontends/c/cgram.y"
+           { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 5213 "build/cgram.tab.c"
+    break;
+
+  case 159: /* struct_declaration: struct_specifier_qualifier_list ';'  */
+#line 1828 "frontends/c/cgram.y"
+            {
+                AST *dummy;
+                AST *anonstruct = (yyvsp[-1].ast);
+                AST *decl;
+                dummy = AstTempIdentifier("__anonymous__");
+                dummy = NewAST(AST_LISTHOLDER, dummy, NULL);
+                decl = MultipleDeclareVar(anonstruct, dummy);
+                // declare aliases for each variable in the object
+                if (IsClassType(anonstruct)) {
+                    Module *P = GetClassPtr(anonstruct);
+                    if (P) {
+                        DeclareAnonymousAliases(current, P, dummy);
+                    }
+                } else {
+                    SYNTAX_ERROR("Internal error, confusing type declaration");
+                }
+                (yyval.ast) = decl;
+            }
+#line 5236 "build/cgram.tab.c"
+    break;
+
+  case 160: /* struct_declaration: struct_specifier_qualifier_list struct_declarator_list ';'  */
+#line 1847 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = MultipleDeclareVar((yyvsp[-2].ast), (yyvsp[-1].list).head);
+            }
+#line 5244 "build/cgram.tab.c"
+    break;
+
+  case 161: /* struct_declaration: "public" ':'  */
+#line 1851 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_STMTLIST,
+                            NewAST(AST_PUBFUNC, NULL, NULL), NULL);
+            }
+#line 5253 "build/cgram.tab.c"
+    break;
+
+  case 162: /* struct_declaration: "private" ':'  */
+#line 1856 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_STMTLIST,
+                            NewAST(AST_PRIFUNC, NULL, NULL), NULL);
+            }
+#line 5262 "build/cgram.tab.c"
+    break;
+
+  case 163: /* struct_declaration: struct_specifier_qualifier_list struct_declarator_list compound_statement_or_fromfile  */
+#line 1861 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                AST *body = (yyvsp[0].ast);
+                AST *decl = (yyvsp[-1].list).head;
+                AST *spqual = (yyvsp[-2].ast);
+                AST *top_decl;
+                Module *module = NULL;
+                
+                if (decl->right) {
+                    SYNTAX_ERROR("bad method declaration");
+                }
+                type = CombineTypes(spqual, decl->left, &ident, &module);
+
+                top_decl = NewAST(AST_LISTHOLDER, type,
+                                  NewAST(AST_LISTHOLDER, ident,
+                                         NewAST(AST_LISTHOLDER, body, NULL)));
+                if (module) {
+                    ERROR(decl, ":: not supported inside structures");
+                }
+                top_decl = NewAST(AST_FUNCDECL, top_decl, NULL);
+                (yyval.ast) = NewAST(AST_STMTLIST, top_decl, NULL);
+            }
+#line 5290 "build/cgram.tab.c"
+    break;
+
+  case 164: /* struct_specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 1888 "frontends/c/cgram.y"
+            { (yyval.ast) = C_ModifySignedUnsigned((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5296 "build/cgram.tab.c"
+    break;
+
+  case 165: /* struct_specifier_qualifier_list: type_specifier  */
+#line 1890 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5302 "build/cgram.tab.c"
+    break;
+
+  case 166: /* struct_specifier_qualifier_list: type_qualifier struct_specifier_qualifier_list  */
+#line 1892 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->left = (yyvsp[0].ast); }
+#line 5308 "build/cgram.tab.c"
+    break;
+
+  case 167: /* struct_specifier_qualifier_list: type_qualifier  */
+#line 1894 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); (yyval.ast)->left = ast_type_long; }
+#line 5314 "build/cgram.tab.c"
+    break;
+
+  case 168: /* struct_specifier_qualifier_list: "static" struct_specifier_qualifier_list  */
+#line 1896 "frontends/c/cgram.y"
+            {
+                AST *list = (yyvsp[0].ast);
+                AST *static_spec = NewAST(AST_STATIC, NULL, NULL);
+                (yyval.ast) = MergePrefix(static_spec, list);
+            }
+#line 5324 "build/cgram.tab.c"
+    break;
+
+  case 169: /* specifier_qualifier_list: type_specifier specifier_qualifier_list  */
+#line 1905 "frontends/c/cgram.y"
+            { (yyval.ast) = C_ModifySignedUnsigned((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5330 "build/cgram.tab.c"
+    break;
+
+  case 170: /* specifier_qualifier_list: type_specifier  */
+#line 1907 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5336 "build/cgram.tab.c"
+    break;
+
+  case 171: /* specifier_qualifier_list: type_qualifier specifier_qualifier_list  */
+#line 1909 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->left = (yyvsp[0].ast); }
+#line 5342 "build/cgram.tab.c"
+    break;
+
+  case 172: /* specifier_qualifier_list: type_qualifier  */
+#line 1911 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); (yyval.ast)->left = ast_type_long; }
+#line 5348 "build/cgram.tab.c"
+    break;
+
+  case 173: /* struct_declarator_list: struct_declarator  */
+#line 1916 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 5354 "build/cgram.tab.c"
+    break;
+
+  case 174: /* struct_declarator_list: struct_declarator_list ',' struct_declarator  */
+#line 1918 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 5360 "build/cgram.tab.c"
+    break;
+
+  case 175: /* struct_declarator: declarator  */
+#line 1923 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5366 "build/cgram.tab.c"
+    break;
+
+  case 176: /* struct_declarator: ':' constant_expression  */
+#line 1925 "frontends/c/cgram.y"
+            { SYNTAX_ERROR("Empty bitfields not supported yet"); (yyval.ast) = NULL; }
+#line 5372 "build/cgram.tab.c"
+    break;
+
+  case 177: /* struct_declarator: declarator ':' constant_expression  */
+#line 1927 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_BITFIELD, (yyvsp[-2].ast), (yyvsp[0].ast));
+            }
+#line 5380 "build/cgram.tab.c"
+    break;
+
+  case 178: /* enum_specifier: "enum" '{' enumerator_list '}'  */
+#line 1934 "frontends/c/cgram.y"
+            { (yyval.ast) = AddEnumerators(NULL, (yyvsp[-1].list).head); }
+#line 5386 "build/cgram.tab.c"
+    break;
+
+  case 179: /* enum_specifier: "enum" any_identifier '{' enumerator_list '}'  */
+#line 1936 "frontends/c/cgram.y"
+            { (yyval.ast) = AddEnumerators((yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 5392 "build/cgram.tab.c"
+    break;
+
+  case 180: /* enum_specifier: "enum" '{' enumerator_list ',' '}'  */
+#line 1938 "frontends/c/cgram.y"
+            { (yyval.ast) = AddEnumerators(NULL, (yyvsp[-2].list).head); }
+#line 5398 "build/cgram.tab.c"
+    break;
+
+  case 181: /* enum_specifier: "enum" any_identifier '{' enumerator_list ',' '}'  */
+#line 1940 "frontends/c/cgram.y"
+            { (yyval.ast) = AddEnumerators((yyvsp[-4].ast), (yyvsp[-2].list).head); }
+#line 5404 "build/cgram.tab.c"
+    break;
+
+  case 182: /* enum_specifier: "enum" any_identifier  */
+#line 1942 "frontends/c/cgram.y"
+            { (yyval.ast) = ast_type_long; }
+#line 5410 "build/cgram.tab.c"
+    break;
+
+  case 183: /* enumerator_list: enumerator  */
+#line 1947 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 5416 "build/cgram.tab.c"
+    break;
+
+  case 184: /* enumerator_list: enumerator_list ',' enumerator  */
+#line 1949 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 5422 "build/cgram.tab.c"
+    break;
+
+  case 185: /* enumerator: "identifier"  */
+#line 1954 "frontends/c/cgram.y"
+            { (yyval.ast) = CommentedListHolder((yyvsp[0].ast)); }
+#line 5428 "build/cgram.tab.c"
+    break;
+
+  case 186: /* enumerator: "identifier" '=' constant_expression  */
+#line 1956 "frontends/c/cgram.y"
+            {
+                AST *setval = NewAST(AST_ENUMSET, (yyvsp[0].ast), NULL);
+                AST *id = CommentedListHolder((yyvsp[-2].ast));
+                setval = NewAST(AST_LISTHOLDER, setval, id);
+                (yyval.ast) = setval;
+            }
+#line 5439 "build/cgram.tab.c"
+    break;
+
+  case 187: /* type_qualifier: "const"  */
+#line 1966 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_MODIFIER_CONST, NULL, NULL); }
+#line 5445 "build/cgram.tab.c"
+    break;
+
+  case 188: /* type_qualifier: "volatile"  */
+#line 1968 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_MODIFIER_VOLATILE, NULL, NULL); }
+#line 5451 "build/cgram.tab.c"
+    break;
+
+  case 189: /* type_qualifier: "__restrict"  */
+#line 1970 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 5457 "build/cgram.tab.c"
+    break;
+
+  case 190: /* declarator: pointer direct_declarator  */
+#line 1975 "frontends/c/cgram.y"
+            {  (yyval.ast) = CombinePointer((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5463 "build/cgram.tab.c"
+    break;
+
+  case 191: /* declarator: direct_declarator  */
+#line 1977 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5469 "build/cgram.tab.c"
+    break;
+
+  case 192: /* direct_declarator: "identifier"  */
+#line 1982 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5475 "build/cgram.tab.c"
+    break;
+
+  case 193: /* direct_declarator: "identifier" "::" "identifier"  */
+#line 1984 "frontends/c/cgram.y"
+            {
+                AST *modname = (yyvsp[-2].ast);
+                AST *member = (yyvsp[0].ast);
+                (yyval.ast) = NewAST(AST_METHODREF, modname, member);
+            }
+#line 5485 "build/cgram.tab.c"
+    break;
+
+  case 194: /* direct_declarator: '(' declarator ')'  */
+#line 1990 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 5491 "build/cgram.tab.c"
+    break;
+
+  case 195: /* direct_declarator: direct_declarator '[' constant_expression ']'  */
+#line 1992 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 5497 "build/cgram.tab.c"
+    break;
+
+  case 196: /* direct_declarator: direct_declarator '[' ']'  */
+#line 1994 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYDECL, (yyvsp[-2].ast), NULL); }
+#line 5503 "build/cgram.tab.c"
+    break;
+
+  case 197: /* direct_declarator: direct_declarator '(' parameter_type_list ')'  */
+#line 1996 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList((yyvsp[-1].ast))), (yyvsp[-3].ast)); }
+#line 5509 "build/cgram.tab.c"
+    break;
+
+  case 198: /* direct_declarator: direct_declarator '(' identifier_list ')'  */
+#line 1998 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList((yyvsp[-1].list).head)), (yyvsp[-3].ast)); }
+#line 5515 "build/cgram.tab.c"
+    break;
+
+  case 199: /* direct_declarator: direct_declarator '(' ')'  */
+#line 2000 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, NULL), (yyvsp[-2].ast)); }
+#line 5521 "build/cgram.tab.c"
+    break;
+
+  case 200: /* pointer: '*'  */
+#line 2005 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_PTRTYPE, NULL, NULL); }
+#line 5527 "build/cgram.tab.c"
+    break;
+
+  case 201: /* pointer: '*' type_qualifier_list  */
+#line 2007 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = CombinePointer(NewAST(AST_PTRTYPE, NULL, NULL), (yyvsp[0].ast));
+            }
+#line 5535 "build/cgram.tab.c"
+    break;
+
+  case 202: /* pointer: '*' pointer  */
+#line 2011 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_PTRTYPE, (yyvsp[0].ast), NULL); }
+#line 5541 "build/cgram.tab.c"
+    break;
+
+  case 203: /* pointer: '*' type_qualifier_list pointer  */
+#line 2013 "frontends/c/cgram.y"
+            {
+                AST *q = (yyvsp[-1].ast);
+                while (q && q->left)
+                    q = q->left;
+                if (q) q->left = (yyvsp[0].ast);
+                (yyval.ast) = NewAST(AST_PTRTYPE, (yyvsp[-1].ast), NULL);
+            }
+#line 5553 "build/cgram.tab.c"
+    break;
+
+  case 204: /* pointer: '&'  */
+#line 2021 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_REFTYPE, NULL, NULL); }
+#line 5559 "build/cgram.tab.c"
+    break;
+
+  case 205: /* pointer: '&' type_qualifier_list  */
+#line 2023 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = CombinePointer(NewAST(AST_REFTYPE, NULL, NULL), (yyvsp[0].ast));
+            }
+#line 5567 "build/cgram.tab.c"
+    break;
+
+  case 206: /* pointer: '&' pointer  */
+#line 2027 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_REFTYPE, (yyvsp[0].ast), NULL); }
+#line 5573 "build/cgram.tab.c"
+    break;
+
+  case 207: /* pointer: '&' type_qualifier_list pointer  */
+#line 2029 "frontends/c/cgram.y"
+            {
+                AST *q = (yyvsp[-1].ast);
+                while (q && q->left)
+                    q = q->left;
+                if (q) q->left = (yyvsp[0].ast);
+                (yyval.ast) = NewAST(AST_REFTYPE, (yyvsp[-1].ast), NULL);
+            }
+#line 5585 "build/cgram.tab.c"
+    break;
+
+  case 208: /* type_qualifier_list: type_qualifier  */
+#line 2040 "frontends/c/cgram.y"
+           { (yyval.ast) = (yyvsp[0].ast); }
+#line 5591 "build/cgram.tab.c"
+    break;
+
+  case 209: /* type_qualifier_list: type_qualifier_list type_qualifier  */
+#line 2042 "frontends/c/cgram.y"
+           { (yyval.ast) = (yyvsp[-1].ast); (yyval.ast)->left = (yyvsp[0].ast); }
+#line 5597 "build/cgram.tab.c"
+    break;
+
+  case 210: /* parameter_type_list: parameter_list  */
+#line 2048 "frontends/c/cgram.y"
+           { (yyval.ast) = (yyvsp[0].list).head; }
+#line 5603 "build/cgram.tab.c"
+    break;
+
+  case 211: /* parameter_type_list: parameter_list ',' "..."  */
+#line 2050 "frontends/c/cgram.y"
+            { (yyval.ast) = ListBuilderAdd((yyvsp[-2].list),
+                             NewAST(AST_LISTHOLDER,
+                                    NewAST(AST_VARARGS, NULL, NULL),
+                                    NULL)).head;
+            }
+#line 5613 "build/cgram.tab.c"
+    break;
+
+  case 212: /* parameter_list: parameter_declaration  */
+#line 2059 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 5619 "build/cgram.tab.c"
+    break;
+
+  case 213: /* parameter_list: parameter_list ',' parameter_declaration  */
+#line 2061 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 5625 "build/cgram.tab.c"
+    break;
+
+  case 214: /* raw_parameter_declaration: declaration_specifiers declarator  */
+#line 2066 "frontends/c/cgram.y"
+            { (yyval.ast) = SingleDeclareVar((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5631 "build/cgram.tab.c"
+    break;
+
+  case 215: /* raw_parameter_declaration: declaration_specifiers abstract_declarator  */
+#line 2068 "frontends/c/cgram.y"
+            { (yyval.ast) = SingleDeclareVar((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5637 "build/cgram.tab.c"
+    break;
+
+  case 216: /* raw_parameter_declaration: declaration_specifiers  */
+#line 2070 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5643 "build/cgram.tab.c"
+    break;
+
+  case 217: /* parameter_declaration: raw_parameter_declaration opt_param_default  */
+#line 2074 "frontends/c/cgram.y"
+            {
+                AST *assign = (yyvsp[0].ast);
+                AST *decl = (yyvsp[-1].ast);
+                (yyval.ast) = ConstructDefaultValue(decl, assign);
+            }
+#line 5653 "build/cgram.tab.c"
+    break;
+
+  case 218: /* opt_param_default: '=' conditional_expression  */
+#line 2082 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5659 "build/cgram.tab.c"
+    break;
+
+  case 219: /* opt_param_default: %empty  */
+#line 2084 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 5665 "build/cgram.tab.c"
+    break;
+
+  case 220: /* identifier_list: "identifier"  */
+#line 2089 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 5671 "build/cgram.tab.c"
+    break;
+
+  case 221: /* identifier_list: identifier_list ',' "identifier"  */
+#line 2091 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL)); }
+#line 5677 "build/cgram.tab.c"
+    break;
+
+  case 222: /* type_name: specifier_qualifier_list  */
+#line 2096 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5683 "build/cgram.tab.c"
+    break;
+
+  case 223: /* type_name: specifier_qualifier_list abstract_declarator  */
+#line 2098 "frontends/c/cgram.y"
+            {
+                AST *lhs = (yyvsp[-1].ast);
+                AST *rhs = (yyvsp[0].ast);
+                AST *final = CombineTypes(lhs, rhs, NULL, NULL);
+                (yyval.ast) = final;
+            }
+#line 5694 "build/cgram.tab.c"
+    break;
+
+  case 224: /* abstract_declarator: pointer  */
+#line 2108 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5700 "build/cgram.tab.c"
+    break;
+
+  case 225: /* abstract_declarator: direct_abstract_declarator  */
+#line 2110 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5706 "build/cgram.tab.c"
+    break;
+
+  case 226: /* abstract_declarator: pointer direct_abstract_declarator  */
+#line 2112 "frontends/c/cgram.y"
+            { (yyval.ast) = CombinePointer((yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 5712 "build/cgram.tab.c"
+    break;
+
+  case 227: /* direct_abstract_declarator: '(' abstract_declarator ')'  */
+#line 2117 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 5718 "build/cgram.tab.c"
+    break;
+
+  case 228: /* direct_abstract_declarator: '[' ']'  */
+#line 2119 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYTYPE, NULL, NULL); }
+#line 5724 "build/cgram.tab.c"
+    break;
+
+  case 229: /* direct_abstract_declarator: '[' constant_expression ']'  */
+#line 2121 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYTYPE, NULL, (yyvsp[-1].ast)); }
+#line 5730 "build/cgram.tab.c"
+    break;
+
+  case 230: /* direct_abstract_declarator: direct_abstract_declarator '[' ']'  */
+#line 2123 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYTYPE, (yyvsp[-2].ast), NULL); }
+#line 5736 "build/cgram.tab.c"
+    break;
+
+  case 231: /* direct_abstract_declarator: direct_abstract_declarator '[' constant_expression ']'  */
+#line 2125 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYTYPE, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 5742 "build/cgram.tab.c"
+    break;
+
+  case 232: /* direct_abstract_declarator: '(' ')'  */
+#line 2127 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NULL;
+            }
+#line 5750 "build/cgram.tab.c"
+    break;
+
+  case 233: /* direct_abstract_declarator: '(' parameter_type_list ')'  */
+#line 2131 "frontends/c/cgram.y"
+            {
+                AST *parmlist = ProcessParamList((yyvsp[-1].ast));
+                (yyval.ast) = NewAST(AST_FUNCTYPE, ast_type_long, parmlist);
+            }
+#line 5759 "build/cgram.tab.c"
+    break;
+
+  case 234: /* direct_abstract_declarator: direct_abstract_declarator '(' ')'  */
+#line 2136 "frontends/c/cgram.y"
+            {
+                AST *rettype = (yyvsp[-2].ast);
+                AST *parmlist = NULL;
+                AST *ftype;
+                bool need_pointer = false;
+                if (IsPointerType(rettype)) {
+                    need_pointer = true;
+                    rettype = BaseType(rettype);
+                }
+                ftype = NewAST(AST_FUNCTYPE, rettype, parmlist);
+                if (need_pointer) {
+                    ftype = NewAST(AST_PTRTYPE, ftype, NULL);
+                }
+                (yyval.ast) = ftype;
+            }
+#line 5779 "build/cgram.tab.c"
+    break;
+
+  case 235: /* direct_abstract_declarator: direct_abstract_declarator '(' parameter_type_list ')'  */
+#line 2152 "frontends/c/cgram.y"
+            {
+                AST *rettype = (yyvsp[-3].ast);
+                AST *parmlist = ProcessParamList((yyvsp[-1].ast));
+                AST *ftype;
+                bool need_pointer = false;
+                if (IsPointerType(rettype)) {
+                    need_pointer = true;
+                    rettype = BaseType(rettype);
+                }
+                ftype = NewAST(AST_FUNCTYPE, rettype, parmlist);
+                if (need_pointer) {
+                    ftype = NewAST(AST_PTRTYPE, ftype, NULL);
+                }
+                (yyval.ast) = ftype;
+            }
+#line 5799 "build/cgram.tab.c"
+    break;
+
+  case 236: /* initializer: assignment_expression  */
+#line 2171 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5805 "build/cgram.tab.c"
+    break;
+
+  case 237: /* initializer: '{' initializer_list '}'  */
+#line 2173 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 5811 "build/cgram.tab.c"
+    break;
+
+  case 238: /* initializer: '{' initializer_list ',' '}'  */
+#line 2175 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-2].ast); }
+#line 5817 "build/cgram.tab.c"
+    break;
+
+  case 239: /* initializer: '{' '}'  */
+#line 2177 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_EXPRLIST, AstInteger(0), NULL);
+            }
+#line 5825 "build/cgram.tab.c"
+    break;
+
+  case 240: /* initializer_list: initializer  */
+#line 2184 "frontends/c/cgram.y"
+            {
+                AST *ast = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+                (yyval.ast) = ast;
+            }
+#line 5834 "build/cgram.tab.c"
+    break;
+
+  case 241: /* initializer_list: designation initializer  */
+#line 2189 "frontends/c/cgram.y"
+            {
+                AST *desig = (yyvsp[-1].ast);
+                AST *initval = (yyvsp[0].ast);
+                AST *ast;
+
+                ast = NewAST(AST_INITMODIFIER, desig, initval);
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                (yyval.ast) = ast;
+            }
+#line 5848 "build/cgram.tab.c"
+    break;
+
+  case 242: /* initializer_list: initializer_list ',' initializer  */
+#line 2199 "frontends/c/cgram.y"
+            {
+                AST *list = (yyvsp[-2].ast);
+                AST *ast = (yyvsp[0].ast);
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                (yyval.ast) = AddToListEx(list, ast, (AST **)&list->d.ptr);
+            }
+#line 5859 "build/cgram.tab.c"
+    break;
+
+  case 243: /* initializer_list: initializer_list ',' designation initializer  */
+#line 2206 "frontends/c/cgram.y"
+            {
+                AST *list = (yyvsp[-3].ast);
+                AST *desig = (yyvsp[-1].ast);
+                AST *initval = (yyvsp[0].ast);
+                AST *ast;
+                
+                ast = NewAST(AST_INITMODIFIER, desig, initval);
+                ast = NewAST(AST_EXPRLIST, ast, NULL);
+                (yyval.ast) = AddToListEx(list, ast, (AST **)&list->d.ptr);
+            }
+#line 5874 "build/cgram.tab.c"
+    break;
+
+  case 244: /* designation: designator_list '='  */
+#line 2220 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 5880 "build/cgram.tab.c"
+    break;
+
+  case 245: /* designator_list: designator  */
+#line 2229 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 5886 "build/cgram.tab.c"
+    break;
+
+  case 246: /* designator_list: designator_list designator  */
+#line 2231 "frontends/c/cgram.y"
+            {
+                AST *upper = (yyvsp[-1].ast);
+                AST *lower = (yyvsp[0].ast);
+                upper->left = lower;
+                (yyval.ast) = upper;
+            }
+#line 5897 "build/cgram.tab.c"
+    break;
+
+  case 247: /* designator: '[' constant_expression ']'  */
+#line 2241 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ARRAYREF, NULL, (yyvsp[-1].ast)); }
+#line 5903 "build/cgram.tab.c"
+    break;
+
+  case 248: /* designator: '.' any_identifier  */
+#line 2243 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_METHODREF, NULL, (yyvsp[0].ast)); }
+#line 5909 "build/cgram.tab.c"
+    break;
+
+  case 257: /* labeled_statement: any_identifier ':' statement  */
+#line 2259 "frontends/c/cgram.y"
+            {
+                AST *label = NewAST(AST_LABEL, LabelName((yyvsp[-2].ast)), NULL);
+                (yyval.ast) = NewAST(AST_STMTLIST, label,
+                              NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL));
+            }
+#line 5919 "build/cgram.tab.c"
+    break;
+
+  case 258: /* labeled_statement: "case" constant_expression "..." constant_expression ':' statement  */
+#line 2265 "frontends/c/cgram.y"
+            {
+                AST *stmt = (yyvsp[0].ast);
+                AST *range = NewAST(AST_RANGE, (yyvsp[-4].ast), (yyvsp[-2].ast));
+                range = NewAST(AST_EXPRLIST, range, NULL);
+                (yyval.ast) = NewAST(AST_CASEITEM, range, stmt);
+            }
+#line 5930 "build/cgram.tab.c"
+    break;
+
+  case 259: /* labeled_statement: "case" constant_expression ':' statement  */
+#line 2272 "frontends/c/cgram.y"
+            {
+                AST *range = (yyvsp[-2].ast);
+                AST *stmt = (yyvsp[0].ast);
+                range = NewAST(AST_EXPRLIST, range, NULL);
+                (yyval.ast) = NewAST(AST_CASEITEM, range, stmt);
+            }
+#line 5941 "build/cgram.tab.c"
+    break;
+
+  case 260: /* labeled_statement: "default" ':' statement  */
+#line 2279 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewAST(AST_OTHER, (yyvsp[0].ast), NULL);
+            }
+#line 5949 "build/cgram.tab.c"
+    break;
+
+  case 261: /* compound_statement: compound_statement_open compound_statement_close  */
+#line 2286 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 5955 "build/cgram.tab.c"
+    break;
+
+  case 262: /* compound_statement: compound_statement_open block_item_list compound_statement_close  */
+#line 2288 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].list).head; }
+#line 5961 "build/cgram.tab.c"
+    break;
+
+  case 263: /* compound_statement_open: '{'  */
+#line 2293 "frontends/c/cgram.y"
+    { PushCurrentTypes(); }
+#line 5967 "build/cgram.tab.c"
+    break;
+
+  case 264: /* compound_statement_close: '}'  */
+#line 2298 "frontends/c/cgram.y"
+    { PopCurrentTypes(); }
+#line 5973 "build/cgram.tab.c"
+    break;
+
+  case 265: /* for_statement_start: "for"  */
+#line 2303 "frontends/c/cgram.y"
+  { PushCurrentTypes(); }
+#line 5979 "build/cgram.tab.c"
+    break;
+
+  case 266: /* block_item_list: block_item  */
+#line 2308 "frontends/c/cgram.y"
+       { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 5985 "build/cgram.tab.c"
+    break;
+
+  case 267: /* block_item_list: block_item_list block_item  */
+#line 2310 "frontends/c/cgram.y"
+       { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 5991 "build/cgram.tab.c"
+    break;
+
+  case 268: /* block_item: declaration  */
+#line 2315 "frontends/c/cgram.y"
+       {
+           AST *decl = MakeDeclarations((yyvsp[0].ast), currentTypes);
+           (yyval.ast) = decl;
+       }
+#line 6000 "build/cgram.tab.c"
+    break;
+
+  case 269: /* block_item: statement  */
+#line 2320 "frontends/c/cgram.y"
+       { (yyval.ast) = NewAST(AST_STMTLIST, (yyvsp[0].ast), NULL); }
+#line 6006 "build/cgram.tab.c"
+    break;
+
+  case 270: /* asm_statement: "__asm" opt_asm_volatile '{' asmlist '}'  */
+#line 2325 "frontends/c/cgram.y"
+    {
+        AST *asmcode;
+        AST *vol = (yyvsp[-3].ast);
+        asmcode = NewAST(AST_INLINEASM, (yyvsp[-1].list).head, vol);
+        (yyval.ast) = asmcode;
+    }
+#line 6017 "build/cgram.tab.c"
+    break;
+
+  case 271: /* asm_statement: "__asm" opt_asm_volatile "end of line" '{' asmlist '}'  */
+#line 2332 "frontends/c/cgram.y"
+    {
+        AST *asmcode;
+        AST *vol = (yyvsp[-4].ast);
+        asmcode = NewAST(AST_INLINEASM, (yyvsp[-1].list).head, vol);
+        (yyval.ast) = asmcode;
+    }
+#line 6028 "build/cgram.tab.c"
+    break;
+
+  case 272: /* opt_asm_volatile: %empty  */
+#line 2342 "frontends/c/cgram.y"
+    { (yyval.ast) = 0; }
+#line 6034 "build/cgram.tab.c"
+    break;
+
+  case 273: /* opt_asm_volatile: "volatile"  */
+#line 2344 "frontends/c/cgram.y"
+    { (yyval.ast) = AstInteger(INLINE_ASM_FLAG_VOLATILE); }
+#line 6040 "build/cgram.tab.c"
+    break;
+
+  case 274: /* opt_asm_volatile: "const"  */
+#line 2346 "frontends/c/cgram.y"
+    { (yyval.ast) = AstInteger(INLINE_ASM_FLAG_CONST); }
+#line 6046 "build/cgram.tab.c"
+    break;
+
+  case 275: /* top_asm: "__asm" '{' asmlist '}'  */
+#line 2351 "frontends/c/cgram.y"
+      { (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[-1].list).head, &current->datblock_tail); }
+#line 6052 "build/cgram.tab.c"
+    break;
+
+  case 276: /* top_asm: "__asm" "end of line" '{' asmlist '}'  */
+#line 2353 "frontends/c/cgram.y"
+      { (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[-1].list).head, &current->datblock_tail); }
+#line 6058 "build/cgram.tab.c"
+    break;
+
+  case 277: /* asmlist: asmline  */
+#line 2358 "frontends/c/cgram.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6064 "build/cgram.tab.c"
+    break;
+
+  case 278: /* asmlist: asmlist asmline  */
+#line 2360 "frontends/c/cgram.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 6070 "build/cgram.tab.c"
+    break;
+
+  case 279: /* asmline: asm_baseline  */
+#line 2365 "frontends/c/cgram.y"
+  {
+      (yyval.ast) = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+  }
+#line 6078 "build/cgram.tab.c"
+    break;
+
+  case 280: /* asmline: "identifier" asm_baseline  */
+#line 2369 "frontends/c/cgram.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *datitem = (yyvsp[0].ast);
+        AST *changetype = NULL;
+        if (datitem) {
+            changetype = ExtractPasmType(datitem);
+            datitem = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+        }
+        AST *ast = NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), datitem);
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, changetype, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, changetype, NULL);
+        }
+        ast = NewAST(AST_LISTHOLDER, linebreak, ast);
+        (yyval.ast) = ast;
+    }
+#line 6100 "build/cgram.tab.c"
+    break;
+
+  case 283: /* asm_baseline: asm_eoln  */
+#line 2395 "frontends/c/cgram.y"
+    { (yyval.ast) = NULL; }
+#line 6106 "build/cgram.tab.c"
+    break;
+
+  case 284: /* asm_baseline: error asm_eoln  */
+#line 2397 "frontends/c/cgram.y"
+    { (yyval.ast) = NULL; }
+#line 6112 "build/cgram.tab.c"
+    break;
+
+  case 285: /* asm_baseline: "byte" asm_eoln  */
+#line 2399 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6118 "build/cgram.tab.c"
+    break;
+
+  case 286: /* asm_baseline: "byte" asm_operandlist asm_eoln  */
+#line 2401 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6124 "build/cgram.tab.c"
+    break;
+
+  case 287: /* asm_baseline: "word" asm_eoln  */
+#line 2403 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6130 "build/cgram.tab.c"
+    break;
+
+  case 288: /* asm_baseline: "word" asm_operandlist asm_eoln  */
+#line 2405 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6136 "build/cgram.tab.c"
+    break;
+
+  case 289: /* asm_baseline: "long" asm_eoln  */
+#line 2407 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6142 "build/cgram.tab.c"
+    break;
+
+  case 290: /* asm_baseline: "long" asm_operandlist asm_eoln  */
+#line 2409 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6148 "build/cgram.tab.c"
+    break;
+
+  case 291: /* asm_baseline: instruction asm_eoln  */
+#line 2411 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr((yyvsp[-1].ast)); }
+#line 6154 "build/cgram.tab.c"
+    break;
+
+  case 292: /* asm_baseline: instruction asm_operandlist asm_eoln  */
+#line 2413 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 6160 "build/cgram.tab.c"
+    break;
+
+  case 293: /* asm_baseline: instruction modifierlist asm_eoln  */
+#line 2415 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 6166 "build/cgram.tab.c"
+    break;
+
+  case 294: /* asm_baseline: instruction asm_operandlist modifierlist asm_eoln  */
+#line 2417 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-3].ast), ListBuilderAdd((yyvsp[-2].list), (yyvsp[-1].list).head).head)); }
+#line 6172 "build/cgram.tab.c"
+    break;
+
+  case 295: /* asm_baseline: "alignl" asm_eoln  */
+#line 2419 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, (yyvsp[-1].ast)); }
+#line 6178 "build/cgram.tab.c"
+    break;
+
+  case 296: /* asm_baseline: "alignw" asm_eoln  */
+#line 2421 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, (yyvsp[-1].ast)); }
+#line 6184 "build/cgram.tab.c"
+    break;
+
+  case 297: /* asm_baseline: "org" asm_eoln  */
+#line 2423 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6190 "build/cgram.tab.c"
+    break;
+
+  case 298: /* asm_baseline: "org" asmexpr asm_eoln  */
+#line 2425 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6196 "build/cgram.tab.c"
+    break;
+
+  case 299: /* asm_baseline: "orgh" asm_eoln  */
+#line 2427 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6202 "build/cgram.tab.c"
+    break;
+
+  case 300: /* asm_baseline: "orgh" asmexpr asm_eoln  */
+#line 2429 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6208 "build/cgram.tab.c"
+    break;
+
+  case 301: /* asm_baseline: "orgf" asmexpr asm_eoln  */
+#line 2431 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6214 "build/cgram.tab.c"
+    break;
+
+  case 302: /* asm_baseline: "res" asmexpr asm_eoln  */
+#line 2433 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_RES, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6220 "build/cgram.tab.c"
+    break;
+
+  case 303: /* asm_baseline: "if" asmexpr asm_eoln  */
+#line 2435 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_IF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6226 "build/cgram.tab.c"
+    break;
+
+  case 304: /* asm_baseline: "elseif" asmexpr asm_eoln  */
+#line 2437 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_ELSEIF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6232 "build/cgram.tab.c"
+    break;
+
+  case 305: /* asm_baseline: "else" asm_eoln  */
+#line 2439 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_ELSEIF, AstInteger(1), NULL, (yyvsp[-1].ast)); }
+#line 6238 "build/cgram.tab.c"
+    break;
+
+  case 306: /* asm_baseline: "end" asm_eoln  */
+#line 2441 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ASM_ENDIF, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6244 "build/cgram.tab.c"
+    break;
+
+  case 307: /* asm_baseline: "fit" asmexpr asm_eoln  */
+#line 2443 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6250 "build/cgram.tab.c"
+    break;
+
+  case 308: /* asm_baseline: "fit" asm_eoln  */
+#line 2445 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, (yyvsp[-1].ast)); }
+#line 6256 "build/cgram.tab.c"
+    break;
+
+  case 309: /* asm_baseline: "file" "string literal" asm_eoln  */
+#line 2447 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FILE, GetFullFileName((yyvsp[-1].ast)), NULL, (yyvsp[-2].ast)); }
+#line 6262 "build/cgram.tab.c"
+    break;
+
+  case 310: /* asm_baseline: "__debug" '(' ')' asm_eoln  */
+#line 2449 "frontends/c/cgram.y"
+    {
+        AST *ast = NULL;
+        AST *comment = (yyvsp[-3].ast);
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        (yyval.ast) = ast;
+    }
+#line 6275 "build/cgram.tab.c"
+    break;
+
+  case 311: /* asm_baseline: "__debug" '(' asm_debug_exprlist ')' asm_eoln  */
+#line 2458 "frontends/c/cgram.y"
+    {
+        AST *ast = BuildDebugList((yyvsp[-2].ast), NULL);
+        AST *comment = (yyvsp[-4].ast);
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        (yyval.ast) = ast;
+    }
+#line 6288 "build/cgram.tab.c"
+    break;
+
+  case 312: /* asm_debug_exprlist: asm_debug_expritem_first  */
+#line 2470 "frontends/c/cgram.y"
+     { (yyval.ast) = (yyvsp[0].ast); }
+#line 6294 "build/cgram.tab.c"
+    break;
+
+  case 313: /* asm_debug_exprlist: asm_debug_expritem_first ',' asm_debug_exprlist_continue  */
+#line 2472 "frontends/c/cgram.y"
+     { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 6300 "build/cgram.tab.c"
+    break;
+
+  case 314: /* asm_debug_expritem_first: asm_debug_expritem  */
+#line 2477 "frontends/c/cgram.y"
+    {
+        AST *list = (yyvsp[0].ast);
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        (yyval.ast) = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 6311 "build/cgram.tab.c"
+    break;
+
+  case 315: /* asm_debug_exprlist_continue: asm_debug_expritem  */
+#line 2487 "frontends/c/cgram.y"
+     { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6317 "build/cgram.tab.c"
+    break;
+
+  case 316: /* asm_debug_exprlist_continue: asm_debug_exprlist_continue ',' asm_debug_expritem  */
+#line 2489 "frontends/c/cgram.y"
+     { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6323 "build/cgram.tab.c"
+    break;
+
+  case 318: /* asm_operand: asmexpr  */
+#line 2497 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 6329 "build/cgram.tab.c"
+    break;
+
+  case 319: /* asm_operand: '#' asmexpr  */
+#line 2499 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 6335 "build/cgram.tab.c"
+    break;
+
+  case 320: /* asm_operand: '=' asmexpr  */
+#line 2501 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 6341 "build/cgram.tab.c"
+    break;
+
+  case 321: /* asm_operand: '#' '#' asmexpr  */
+#line 2503 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 6347 "build/cgram.tab.c"
+    break;
+
+  case 322: /* asm_operand: "==" asmexpr  */
+#line 2505 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 6353 "build/cgram.tab.c"
+    break;
+
+  case 323: /* asm_operand: asmexpr '[' asmexpr ']'  */
+#line 2507 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL); }
+#line 6359 "build/cgram.tab.c"
+    break;
+
+  case 324: /* asm_operandlist: asm_operand  */
+#line 2512 "frontends/c/cgram.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6365 "build/cgram.tab.c"
+    break;
+
+  case 325: /* asm_operandlist: asm_operandlist ',' asm_operand  */
+#line 2514 "frontends/c/cgram.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6371 "build/cgram.tab.c"
+    break;
+
+  case 326: /* asmexpr: conditional_expression  */
+#line 2519 "frontends/c/cgram.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 6377 "build/cgram.tab.c"
+    break;
+
+  case 327: /* asmexpr: '\\' conditional_expression  */
+#line 2521 "frontends/c/cgram.y"
+    { (yyval.ast) = AstCatch((yyvsp[0].ast)); }
+#line 6383 "build/cgram.tab.c"
+    break;
+
+  case 328: /* instruction: "asm instruction"  */
+#line 2526 "frontends/c/cgram.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 6389 "build/cgram.tab.c"
+    break;
+
+  case 329: /* instruction: instrmodifier instruction  */
+#line 2528 "frontends/c/cgram.y"
+  { (yyval.ast) = AddToList((yyvsp[0].ast), (yyvsp[-1].ast)); }
+#line 6395 "build/cgram.tab.c"
+    break;
+
+  case 330: /* instrmodifier: "instruction modifier"  */
+#line 2533 "frontends/c/cgram.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 6401 "build/cgram.tab.c"
+    break;
+
+  case 331: /* modifierlist: instrmodifier  */
+#line 2538 "frontends/c/cgram.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6407 "build/cgram.tab.c"
+    break;
+
+  case 332: /* modifierlist: modifierlist instrmodifier  */
+#line 2540 "frontends/c/cgram.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 6413 "build/cgram.tab.c"
+    break;
+
+  case 333: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2542 "frontends/c/cgram.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 6419 "build/cgram.tab.c"
+    break;
+
+  case 334: /* func_declaration_list: declaration  */
+#line 2547 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 6425 "build/cgram.tab.c"
+    break;
+
+  case 335: /* func_declaration_list: declaration_list declaration  */
+#line 2549 "frontends/c/cgram.y"
+            { (yyval.ast) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)).head; }
+#line 6431 "build/cgram.tab.c"
+    break;
+
+  case 336: /* declaration_list: declaration  */
+#line 2554 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderStart(MakeDeclarations((yyvsp[0].ast), currentTypes)); }
+#line 6437 "build/cgram.tab.c"
+    break;
+
+  case 337: /* declaration_list: declaration_list declaration  */
+#line 2556 "frontends/c/cgram.y"
+            { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), MakeDeclarations((yyvsp[0].ast), currentTypes)); }
+#line 6443 "build/cgram.tab.c"
+    break;
+
+  case 338: /* expression_statement: ';'  */
+#line 2561 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 6449 "build/cgram.tab.c"
+    break;
+
+  case 339: /* expression_statement: expression ';'  */
+#line 2563 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_STMTLIST, (yyvsp[-1].ast), NULL); }
+#line 6455 "build/cgram.tab.c"
+    break;
+
+  case 340: /* selection_statement: "if" '(' expression ')' statement  */
+#line 2568 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_IF, (yyvsp[-2].ast),
+                          NewAST(AST_THENELSE, ForceStatementList((yyvsp[0].ast)), NULL)); }
+#line 6462 "build/cgram.tab.c"
+    break;
+
+  case 341: /* selection_statement: "if" '(' expression ')' statement "else" statement  */
+#line 2571 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_IF, (yyvsp[-4].ast),
+                          NewAST(AST_THENELSE, ForceStatementList((yyvsp[-2].ast)), ForceStatementList((yyvsp[0].ast))));
+            }
+#line 6470 "build/cgram.tab.c"
+    break;
+
+  case 342: /* selection_statement: "switch" '(' expression ')' statement  */
+#line 2575 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = NewCommentedAST(AST_CASE, (yyvsp[-2].ast), (yyvsp[0].ast), (yyvsp[-4].ast));
+            }
+#line 6478 "build/cgram.tab.c"
+    break;
+
+  case 343: /* iteration_statement: "while" '(' expression ')' statement  */
+#line 2582 "frontends/c/cgram.y"
+            { AST *body = ForceStatementList(CheckYield((yyvsp[0].ast)));
+              (yyval.ast) = NewCommentedAST(AST_WHILE, (yyvsp[-2].ast), body, (yyvsp[-4].ast));
+            }
+#line 6486 "build/cgram.tab.c"
+    break;
+
+  case 344: /* iteration_statement: "do" statement "while" '(' expression ')' ';'  */
+#line 2586 "frontends/c/cgram.y"
+            { AST *body = ForceStatementList(CheckYield((yyvsp[-5].ast)));
+              (yyval.ast) = NewCommentedAST(AST_DOWHILE, (yyvsp[-2].ast), body, (yyvsp[-6].ast));
+            }
+#line 6494 "build/cgram.tab.c"
+    break;
+
+  case 345: /* iteration_statement: for_statement_start '(' expression_statement expression_statement ')' statement  */
+#line 2590 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield((yyvsp[0].ast)));
+                AST *init = (yyvsp[-3].ast);
+                AST *cond = (yyvsp[-2].ast);
+                AST *update = NULL;
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                (yyval.ast) = NewCommentedAST(AST_FOR, init, condtest, (yyvsp[-5].ast));
+                PopCurrentTypes();
+            }
+#line 6515 "build/cgram.tab.c"
+    break;
+
+  case 346: /* iteration_statement: for_statement_start '(' expression_statement expression_statement expression ')' statement  */
+#line 2607 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield((yyvsp[0].ast)));
+                AST *init = (yyvsp[-4].ast);
+                AST *cond = (yyvsp[-3].ast);
+                AST *update = (yyvsp[-2].ast);
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                (yyval.ast) = NewCommentedAST(AST_FOR, init, condtest, (yyvsp[-6].ast));
+                PopCurrentTypes();
+            }
+#line 6536 "build/cgram.tab.c"
+    break;
+
+  case 347: /* iteration_statement: for_statement_start '(' for_declaration expression_statement ')' statement  */
+#line 2624 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield((yyvsp[0].ast)));
+                AST *init = (yyvsp[-3].ast);
+                AST *cond = (yyvsp[-2].ast);
+                AST *update = NULL;
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                body = NewCommentedAST(AST_FOR, NULL, condtest, (yyvsp[-5].ast));
+                init = NewAST(AST_STMTLIST, init,
+                              NewAST(AST_STMTLIST, body, NULL));
+                (yyval.ast) = NewAST(AST_SCOPE, init, NULL);
+                PopCurrentTypes();
+            }
+#line 6560 "build/cgram.tab.c"
+    break;
+
+  case 348: /* iteration_statement: for_statement_start '(' for_declaration expression_statement expression ')' statement  */
+#line 2644 "frontends/c/cgram.y"
+            {   AST *body = ForceStatementList(CheckYield((yyvsp[0].ast)));
+                AST *init = (yyvsp[-4].ast);
+                AST *cond = (yyvsp[-3].ast);
+                AST *update = (yyvsp[-2].ast);
+                AST *stepstmt, *condtest;
+                if (init && init->kind == AST_STMTLIST && !init->right) {
+                    init = init->left;
+                }
+                if (cond && cond->kind == AST_STMTLIST && !cond->right) {
+                    cond = cond->left;
+                }
+                stepstmt = NewAST(AST_STEP, update, body);
+                condtest = NewAST(AST_TO, cond, stepstmt);
+                body = NewCommentedAST(AST_FOR, NULL, condtest, (yyvsp[-6].ast));
+                init = NewAST(AST_STMTLIST, init,
+                              NewAST(AST_STMTLIST, body, NULL));
+                (yyval.ast) = NewAST(AST_SCOPE, init, NULL);
+                PopCurrentTypes();
+            }
+#line 6584 "build/cgram.tab.c"
+    break;
+
+  case 349: /* for_declaration: declaration  */
+#line 2666 "frontends/c/cgram.y"
+          { (yyval.ast) = MakeDeclarations((yyvsp[0].ast), currentTypes); }
+#line 6590 "build/cgram.tab.c"
+    break;
+
+  case 350: /* jump_statement: "goto" any_identifier ';'  */
+#line 2671 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_GOTO, LabelName((yyvsp[-1].ast)), NULL, (yyvsp[-2].ast)); }
+#line 6596 "build/cgram.tab.c"
+    break;
+
+  case 351: /* jump_statement: "continue" ';'  */
+#line 2673 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_CONTINUE, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6602 "build/cgram.tab.c"
+    break;
+
+  case 352: /* jump_statement: "break" ';'  */
+#line 2675 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_ENDCASE, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6608 "build/cgram.tab.c"
+    break;
+
+  case 353: /* jump_statement: "return" ';'  */
+#line 2677 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_RETURN, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6614 "build/cgram.tab.c"
+    break;
+
+  case 354: /* jump_statement: "return" expression ';'  */
+#line 2679 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_RETURN, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6620 "build/cgram.tab.c"
+    break;
+
+  case 355: /* jump_statement: "throw" expression ';'  */
+#line 2681 "frontends/c/cgram.y"
+            { (yyval.ast) = NewCommentedAST(AST_THROW, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6626 "build/cgram.tab.c"
+    break;
+
+  case 356: /* jump_statement: "__throwifcaught" expression ';'  */
+#line 2683 "frontends/c/cgram.y"
+          {
+              AST *top = NewCommentedAST(AST_THROW, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast));
+              AST *throwit;
+              if (top && top->kind != AST_THROW) {
+                  throwit = top->left;
+              } else {
+                  throwit = top;
+              }
+              throwit->d.ival = 1;
+              (yyval.ast) = top;
+          }
+#line 6642 "build/cgram.tab.c"
+    break;
+
+  case 357: /* try_statement: "try" compound_statement handler_sequence  */
+#line 2698 "frontends/c/cgram.y"
+          {
+              AST *tryblock = (yyvsp[-1].ast);
+              AST *catchlist = (yyvsp[0].list).head;
+              AST *catchseq;
+              AST *catchvar, *catchblock, *catchdecl;
+              AST *try_if = NULL;
+              AST *trytest;
+
+              while (catchlist) {
+                  catchseq = catchlist->left;
+                  catchlist = catchlist->right;
+                  catchdecl = catchseq->left;
+                  catchblock = catchseq->right;
+
+                  catchvar = catchdecl->left->right;
+                  catchblock = NewAST(AST_STMTLIST, AstAssign(catchvar, NewAST(AST_CATCHRESULT, NULL, NULL)), catchblock);
+                  catchblock = NewAST(AST_STMTLIST, catchdecl, catchblock);
+
+                  trytest = NewAST(AST_SETJMP, NULL, NULL);
+                  try_if = NewAST(AST_IF,
+                                  AstOperator(K_EQ, trytest, AstInteger(0)),
+                                  NewAST(AST_THENELSE, tryblock, catchblock));
+                  try_if = NewCommentedStatement(try_if);
+                  tryblock = NewAST(AST_TRYENV, try_if, NULL);
+              }
+              (yyval.ast) = tryblock;
+          }
+#line 6674 "build/cgram.tab.c"
+    break;
+
+  case 358: /* handler_sequence: handler_item  */
+#line 2729 "frontends/c/cgram.y"
+          { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 6680 "build/cgram.tab.c"
+    break;
+
+  case 359: /* handler_sequence: handler_sequence handler_item  */
+#line 2731 "frontends/c/cgram.y"
+          {
+              AST *last = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+              (yyval.list) = ListBuilderAdd((yyvsp[-1].list), last);
+          }
+#line 6689 "build/cgram.tab.c"
+    break;
+
+  case 360: /* handler_item: "catch" push_current_types '(' handler_declarator ')' compound_statement pop_current_types  */
+#line 2739 "frontends/c/cgram.y"
+          {
+              AST *declarator = (yyvsp[-3].ast);
+              AST *block = (yyvsp[-1].ast);
+              // NOTE: the declarator is wrapped in a stmtlist
+              (yyval.ast) = NewAST(AST_SEQUENCE, declarator, block);
+          }
+#line 6700 "build/cgram.tab.c"
+    break;
+
+  case 361: /* push_current_types: %empty  */
+#line 2748 "frontends/c/cgram.y"
+          { PushCurrentTypes(); }
+#line 6706 "build/cgram.tab.c"
+    break;
+
+  case 362: /* pop_current_types: %empty  */
+#line 2751 "frontends/c/cgram.y"
+          { PopCurrentTypes(); }
+#line 6712 "build/cgram.tab.c"
+    break;
+
+  case 363: /* handler_declarator: raw_parameter_declaration  */
+#line 2756 "frontends/c/cgram.y"
+          {
+              AST *decl = MakeDeclarations((yyvsp[0].ast), currentTypes);
+              (yyval.ast) = decl;
+          }
+#line 6721 "build/cgram.tab.c"
+    break;
+
+  case 364: /* handler_declarator: "..."  */
+#line 2761 "frontends/c/cgram.y"
+          {
+              AST *var = AstTempIdentifier("catch");
+              var = NewAST(AST_DECLARE_VAR, ast_type_generic, var);
+              (yyval.ast) = var;
+          }
+#line 6731 "build/cgram.tab.c"
+    break;
+
+  case 370: /* external_declaration: declaration  */
+#line 2778 "frontends/c/cgram.y"
+           { DeclareCGlobalVariables((yyvsp[0].ast)); }
+#line 6737 "build/cgram.tab.c"
+    break;
+
+  case 371: /* function_definition: declaration_specifiers declarator func_declaration_list compound_statement  */
+#line 2783 "frontends/c/cgram.y"
+            {
+                AST *type = (yyvsp[-3].ast);
+                AST *decl = (yyvsp[-2].ast);
+                AST *decl_list = (yyvsp[-1].ast);
+                AST *body = (yyvsp[0].ast);
+                AST *ident = NULL;
+                Module *module = NULL;
+                int is_public = 1;
+
+                decl = MergeOldStyleDeclarationList(decl, decl_list);
+                type = CombineTypes(type, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: not supported yet for old style functions");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, NULL);
+            }
+#line 6758 "build/cgram.tab.c"
+    break;
+
+  case 372: /* function_definition: declaration_specifiers declarator attribute_decl compound_statement_or_fromfile  */
+#line 2800 "frontends/c/cgram.y"
+            {
+                AST *type = (yyvsp[-3].ast);
+                AST *decl = (yyvsp[-2].ast);
+                AST *anno = (yyvsp[-1].ast);
+                AST *body = (yyvsp[0].ast);
+                AST *ident = NULL;
+                Module *module = NULL;
+                int is_public = 1;
+                type = CombineTypes(type, decl, &ident, &module);
+                if (module) {
+                    DeclareCTypedFunction(module, type, ident, is_public, body, anno);
+                } else {
+                    DeclareCTypedFunction(current, type, ident, is_public, body, anno);
+                }
+            }
+#line 6778 "build/cgram.tab.c"
+    break;
+
+  case 373: /* function_definition: declarator func_declaration_list compound_statement_or_fromfile  */
+#line 2816 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                Module *module = NULL;
+                AST *decl = (yyvsp[-2].ast);
+                AST *decl_list = (yyvsp[-1].ast);
+                AST *body = (yyvsp[0].ast);
+                int is_public = 1;
+                decl = MergeOldStyleDeclarationList(decl, decl_list);
+                type = CombineTypes(NULL, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: not allowed with old style function declarations");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, NULL);
+            }
+#line 6798 "build/cgram.tab.c"
+    break;
+
+  case 374: /* function_definition: declarator attribute_decl compound_statement_or_fromfile  */
+#line 2832 "frontends/c/cgram.y"
+            {
+                AST *type;
+                AST *ident = NULL;
+                Module *module = NULL;
+                AST *decl = (yyvsp[-2].ast);
+                AST *anno = (yyvsp[-1].ast);
+                AST *body = (yyvsp[0].ast);
+                int is_public = 1;
+                type = CombineTypes(NULL, decl, &ident, &module);
+                if (module) {
+                    ERROR(decl, ":: needs fixing");
+                }
+                DeclareCTypedFunction(current, type, ident, is_public, body, anno);
+            }
+#line 6817 "build/cgram.tab.c"
+    break;
+
+  case 375: /* attribute_decl: "__attribute__"  */
+#line 2850 "frontends/c/cgram.y"
+            {
+                (yyval.ast) = (yyvsp[0].ast);
+            }
+#line 6825 "build/cgram.tab.c"
+    break;
+
+  case 376: /* attribute_decl: %empty  */
+#line 2854 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 6831 "build/cgram.tab.c"
+    break;
+
+  case 377: /* fromfile_decl: "__fromfile" '(' "string literal" ')' ';'  */
+#line 2859 "frontends/c/cgram.y"
+            {
+                AST *str = (yyvsp[-2].ast);
+                if (str && str->kind == AST_EXPRLIST) {
+                    str = str->left;
+                }
+                (yyval.ast) = str;
+            }
+#line 6843 "build/cgram.tab.c"
+    break;
+
+  case 380: /* top_pasm: "__pasm" '{' pasmlist '}'  */
+#line 2876 "frontends/c/cgram.y"
+      { (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[-1].list).head, &current->datblock_tail); }
+#line 6849 "build/cgram.tab.c"
+    break;
+
+  case 381: /* top_pasm: "__pasm" "end of line" '{' pasmlist '}'  */
+#line 2878 "frontends/c/cgram.y"
+      { (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[-1].list).head, &current->datblock_tail); }
+#line 6855 "build/cgram.tab.c"
+    break;
+
+  case 382: /* pasmlist: pasmline  */
+#line 2883 "frontends/c/cgram.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 6861 "build/cgram.tab.c"
+    break;
+
+  case 383: /* pasmlist: pasmlist pasmline  */
+#line 2885 "frontends/c/cgram.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 6867 "build/cgram.tab.c"
+    break;
+
+  case 384: /* pasmline: pasm_baseline  */
+#line 2890 "frontends/c/cgram.y"
+  {
+      (yyval.ast) = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+  }
+#line 6875 "build/cgram.tab.c"
+    break;
+
+  case 385: /* pasmline: "identifier" pasm_baseline  */
+#line 2894 "frontends/c/cgram.y"
+    {   AST *linebreak;
+        AST *comment = GetComments();
+        AST *changetypes = NULL;
+        AST *datitem = (yyvsp[0].ast);
+
+        if (datitem) {
+            changetypes = ExtractPasmType(datitem);
+            datitem = NewAST(AST_LISTHOLDER, datitem, NULL);
+        }
+        AST *ast = NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), datitem);
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, changetypes, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, changetypes, NULL);
+        }
+        ast = NewAST(AST_LISTHOLDER, linebreak, ast);
+        (yyval.ast) = ast;
+    }
+#line 6898 "build/cgram.tab.c"
+    break;
+
+  case 386: /* pasm_baseline: asm_eoln  */
+#line 2916 "frontends/c/cgram.y"
+    { (yyval.ast) = NULL; }
+#line 6904 "build/cgram.tab.c"
+    break;
+
+  case 387: /* pasm_baseline: error asm_eoln  */
+#line 2918 "frontends/c/cgram.y"
+    { (yyval.ast) = NULL; }
+#line 6910 "build/cgram.tab.c"
+    break;
+
+  case 388: /* pasm_baseline: "byte" asm_eoln  */
+#line 2920 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6916 "build/cgram.tab.c"
+    break;
+
+  case 389: /* pasm_baseline: "byte" pasm_operandlist asm_eoln  */
+#line 2922 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6922 "build/cgram.tab.c"
+    break;
+
+  case 390: /* pasm_baseline: "word" asm_eoln  */
+#line 2924 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6928 "build/cgram.tab.c"
+    break;
+
+  case 391: /* pasm_baseline: "word" pasm_operandlist asm_eoln  */
+#line 2926 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6934 "build/cgram.tab.c"
+    break;
+
+  case 392: /* pasm_baseline: "long" asm_eoln  */
+#line 2928 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6940 "build/cgram.tab.c"
+    break;
+
+  case 393: /* pasm_baseline: "long" pasm_operandlist asm_eoln  */
+#line 2930 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, (yyvsp[-1].list).head, NULL, (yyvsp[-2].ast)); }
+#line 6946 "build/cgram.tab.c"
+    break;
+
+  case 394: /* pasm_baseline: instruction asm_eoln  */
+#line 2932 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr((yyvsp[-1].ast)); }
+#line 6952 "build/cgram.tab.c"
+    break;
+
+  case 395: /* pasm_baseline: instruction pasm_operandlist asm_eoln  */
+#line 2934 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 6958 "build/cgram.tab.c"
+    break;
+
+  case 396: /* pasm_baseline: instruction modifierlist asm_eoln  */
+#line 2936 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 6964 "build/cgram.tab.c"
+    break;
+
+  case 397: /* pasm_baseline: instruction pasm_operandlist modifierlist asm_eoln  */
+#line 2938 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-3].ast), ListBuilderAdd((yyvsp[-2].list), (yyvsp[-1].list).head).head)); }
+#line 6970 "build/cgram.tab.c"
+    break;
+
+  case 398: /* pasm_baseline: "alignl" asm_eoln  */
+#line 2940 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, (yyvsp[-1].ast)); }
+#line 6976 "build/cgram.tab.c"
+    break;
+
+  case 399: /* pasm_baseline: "alignw" asm_eoln  */
+#line 2942 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, (yyvsp[-1].ast)); }
+#line 6982 "build/cgram.tab.c"
+    break;
+
+  case 400: /* pasm_baseline: "org" asm_eoln  */
+#line 2944 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, NULL, NULL, (yyvsp[-1].ast)); }
+#line 6988 "build/cgram.tab.c"
+    break;
+
+  case 401: /* pasm_baseline: "org" pasmexpr asm_eoln  */
+#line 2946 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 6994 "build/cgram.tab.c"
+    break;
+
+  case 402: /* pasm_baseline: "orgh" asm_eoln  */
+#line 2948 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, NULL, NULL, (yyvsp[-1].ast)); }
+#line 7000 "build/cgram.tab.c"
+    break;
+
+  case 403: /* pasm_baseline: "orgh" pasmexpr asm_eoln  */
+#line 2950 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7006 "build/cgram.tab.c"
+    break;
+
+  case 404: /* pasm_baseline: "orgf" pasmexpr asm_eoln  */
+#line 2952 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7012 "build/cgram.tab.c"
+    break;
+
+  case 405: /* pasm_baseline: "res" pasmexpr asm_eoln  */
+#line 2954 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_RES, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7018 "build/cgram.tab.c"
+    break;
+
+  case 406: /* pasm_baseline: "fit" pasmexpr asm_eoln  */
+#line 2956 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 7024 "build/cgram.tab.c"
+    break;
+
+  case 407: /* pasm_baseline: "fit" asm_eoln  */
+#line 2958 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, (yyvsp[-1].ast)); }
+#line 7030 "build/cgram.tab.c"
+    break;
+
+  case 408: /* pasm_baseline: "file" "string literal" asm_eoln  */
+#line 2960 "frontends/c/cgram.y"
+    { (yyval.ast) = NewCommentedAST(AST_FILE, GetFullFileName((yyvsp[-1].ast)), NULL, (yyvsp[-2].ast)); }
+#line 7036 "build/cgram.tab.c"
+    break;
+
+  case 409: /* pasm_baseline: "__debug" '(' ')' asm_eoln  */
+#line 2962 "frontends/c/cgram.y"
+    {
+        AST *ast = NULL;
+        AST *comment = (yyvsp[-3].ast);
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        (yyval.ast) = ast;
+    }
+#line 7049 "build/cgram.tab.c"
+    break;
+
+  case 410: /* pasm_baseline: "__debug" '(' pasm_debug_exprlist ')' asm_eoln  */
+#line 2971 "frontends/c/cgram.y"
+    {
+        AST *ast = BuildDebugList((yyvsp[-2].ast), NULL);
+        AST *comment = (yyvsp[-4].ast);
+        if (comment) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, comment);
+        }
+        (yyval.ast) = ast;
+    }
+#line 7062 "build/cgram.tab.c"
+    break;
+
+  case 411: /* pasm_debug_exprlist: pasm_debug_expritem_first  */
+#line 2983 "frontends/c/cgram.y"
+     { (yyval.ast) = (yyvsp[0].ast); }
+#line 7068 "build/cgram.tab.c"
+    break;
+
+  case 412: /* pasm_debug_exprlist: pasm_debug_expritem_first ',' pasm_debug_exprlist_continue  */
+#line 2985 "frontends/c/cgram.y"
+     { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 7074 "build/cgram.tab.c"
+    break;
+
+  case 413: /* pasm_debug_expritem_first: pasm_debug_expritem  */
+#line 2990 "frontends/c/cgram.y"
+    {
+        AST *list = (yyvsp[0].ast);
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        (yyval.ast) = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 7085 "build/cgram.tab.c"
+    break;
+
+  case 414: /* pasm_debug_exprlist_continue: pasm_debug_expritem  */
+#line 3000 "frontends/c/cgram.y"
+     { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7091 "build/cgram.tab.c"
+    break;
+
+  case 415: /* pasm_debug_exprlist_continue: pasm_debug_exprlist_continue ',' pasm_debug_expritem  */
+#line 3002 "frontends/c/cgram.y"
+     { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 7097 "build/cgram.tab.c"
+    break;
+
+  case 417: /* pasm_operand: pasmexpr  */
+#line 3010 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 7103 "build/cgram.tab.c"
+    break;
+
+  case 418: /* pasm_operand: '#' pasmexpr  */
+#line 3012 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 7109 "build/cgram.tab.c"
+    break;
+
+  case 419: /* pasm_operand: '#' '#' pasmexpr  */
+#line 3014 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, (yyvsp[0].ast), NULL), NULL); }
+#line 7115 "build/cgram.tab.c"
+    break;
+
+  case 420: /* pasm_operand: pasmexpr '[' pasmexpr ']'  */
+#line 3016 "frontends/c/cgram.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL); }
+#line 7121 "build/cgram.tab.c"
+    break;
+
+  case 421: /* pasm_operandlist: pasm_operand  */
+#line 3021 "frontends/c/cgram.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 7127 "build/cgram.tab.c"
+    break;
+
+  case 422: /* pasm_operandlist: pasm_operandlist ',' pasm_operand  */
+#line 3023 "frontends/c/cgram.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 7133 "build/cgram.tab.c"
+    break;
+
+  case 423: /* optpasmrange: '[' pasmexpr ']'  */
+#line 3028 "frontends/c/cgram.y"
+            {
+                AST *expr = (yyvsp[-1].ast);
+                (yyval.ast) = expr;
+            }
+#line 7142 "build/cgram.tab.c"
+    break;
+
+  case 424: /* optpasmrange: '[' '#' '#' pasmexpr ']'  */
+#line 3033 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_BIGIMMHOLDER, (yyvsp[-1].ast), NULL); }
+#line 7148 "build/cgram.tab.c"
+    break;
+
+  case 425: /* optpasmrange: '[' "==" pasmexpr ']'  */
+#line 3035 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_BIGIMMHOLDER, (yyvsp[-1].ast), NULL); }
+#line 7154 "build/cgram.tab.c"
+    break;
+
+  case 426: /* optpasmrange: %empty  */
+#line 3037 "frontends/c/cgram.y"
+            { (yyval.ast) = NULL; }
+#line 7160 "build/cgram.tab.c"
+    break;
+
+  case 427: /* pasmatom: "identifier"  */
+#line 3042 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7166 "build/cgram.tab.c"
+    break;
+
+  case 428: /* pasmatom: "constant"  */
+#line 3044 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7172 "build/cgram.tab.c"
+    break;
+
+  case 429: /* pasmatom: '$'  */
+#line 3046 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_HERE, NULL, NULL); }
+#line 7178 "build/cgram.tab.c"
+    break;
+
+  case 430: /* pasmatom: "hardware register" optpasmrange  */
+#line 3048 "frontends/c/cgram.y"
+            {
+                AST *reg = (yyvsp[-1].ast);
+                AST *index = (yyvsp[0].ast);
+                if (index) {
+                    if (index->kind == AST_BIGIMMHOLDER) {
+                        index->left = NewAST(AST_RANGEREF, reg, index->left);
+                        (yyval.ast) = index;
+                    } else {
+                        (yyval.ast) = NewAST(AST_RANGEREF, reg, index);
+                    }
+                } else {
+                    (yyval.ast) = reg;
+                }
+            }
+#line 7197 "build/cgram.tab.c"
+    break;
+
+  case 431: /* pasmatom: "string literal"  */
+#line 3063 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7203 "build/cgram.tab.c"
+    break;
+
+  case 432: /* pasmatom: '@' "identifier"  */
+#line 3065 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_ADDROF, (yyvsp[0].ast), NULL); }
+#line 7209 "build/cgram.tab.c"
+    break;
+
+  case 433: /* pasmatom: '(' pasmexpr ')'  */
+#line 3067 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[-1].ast); }
+#line 7215 "build/cgram.tab.c"
+    break;
+
+  case 434: /* pasmatom: pasmatom "++"  */
+#line 3069 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_INCREMENT, (yyvsp[-1].ast), NULL); }
+#line 7221 "build/cgram.tab.c"
+    break;
+
+  case 435: /* pasmatom: pasmatom "--"  */
+#line 3071 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_DECREMENT, (yyvsp[-1].ast), NULL); }
+#line 7227 "build/cgram.tab.c"
+    break;
+
+  case 436: /* pasmatom: pasmatom '(' pasm_operandlist ')'  */
+#line 3073 "frontends/c/cgram.y"
+            { (yyval.ast) = NewAST(AST_FUNCCALL, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 7233 "build/cgram.tab.c"
+    break;
+
+  case 437: /* pasmunary: pasmatom  */
+#line 3078 "frontends/c/cgram.y"
+          { (yyval.ast) = (yyvsp[0].ast); }
+#line 7239 "build/cgram.tab.c"
+    break;
+
+  case 438: /* pasmunary: '-' pasmunary  */
+#line 3080 "frontends/c/cgram.y"
+          { (yyval.ast) = AstOperator(K_NEGATE, NULL, (yyvsp[0].ast)); }
+#line 7245 "build/cgram.tab.c"
+    break;
+
+  case 439: /* pasmunary: '!' pasmunary  */
+#line 3082 "frontends/c/cgram.y"
+          { (yyval.ast) = AstOperator(K_BIT_NOT, NULL, (yyvsp[0].ast)); }
+#line 7251 "build/cgram.tab.c"
+    break;
+
+  case 440: /* pasmunary: "++" pasmunary  */
+#line 3084 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_INCREMENT, NULL, (yyvsp[0].ast)); }
+#line 7257 "build/cgram.tab.c"
+    break;
+
+  case 441: /* pasmunary: "--" pasmunary  */
+#line 3086 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_DECREMENT, NULL, (yyvsp[0].ast)); }
+#line 7263 "build/cgram.tab.c"
+    break;
+
+  case 442: /* pasm_e1: pasmunary  */
+#line 3091 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7269 "build/cgram.tab.c"
+    break;
+
+  case 443: /* pasm_e1: pasm_e1 "<<" pasmunary  */
+#line 3093 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_SHL, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7275 "build/cgram.tab.c"
+    break;
+
+  case 444: /* pasm_e1: pasm_e1 ">>" pasmunary  */
+#line 3095 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_SHR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7281 "build/cgram.tab.c"
+    break;
+
+  case 445: /* pasm_e2: pasm_e1  */
+#line 3099 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7287 "build/cgram.tab.c"
+    break;
+
+  case 446: /* pasm_e2: pasm_e2 '&' pasm_e1  */
+#line 3101 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('&', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7293 "build/cgram.tab.c"
+    break;
+
+  case 447: /* pasm_e3: pasm_e2  */
+#line 3105 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7299 "build/cgram.tab.c"
+    break;
+
+  case 448: /* pasm_e3: pasm_e3 '|' pasm_e2  */
+#line 3107 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7305 "build/cgram.tab.c"
+    break;
+
+  case 449: /* pasm_e3: pasm_e3 '^' pasm_e2  */
+#line 3109 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('^', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7311 "build/cgram.tab.c"
+    break;
+
+  case 450: /* pasm_e4: pasm_e3  */
+#line 3113 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7317 "build/cgram.tab.c"
+    break;
+
+  case 451: /* pasm_e4: pasm_e4 '*' pasm_e3  */
+#line 3115 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('*', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7323 "build/cgram.tab.c"
+    break;
+
+  case 452: /* pasm_e4: pasm_e4 '/' pasm_e3  */
+#line 3117 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('/', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7329 "build/cgram.tab.c"
+    break;
+
+  case 453: /* pasm_e4: pasm_e4 '/' '/' pasm_e3  */
+#line 3119 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_MODULUS, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 7335 "build/cgram.tab.c"
+    break;
+
+  case 454: /* pasm_e5: pasm_e4  */
+#line 3123 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7341 "build/cgram.tab.c"
+    break;
+
+  case 455: /* pasm_e5: pasm_e5 '+' pasm_e4  */
+#line 3125 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('+', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7347 "build/cgram.tab.c"
+    break;
+
+  case 456: /* pasm_e5: pasm_e5 '-' pasm_e4  */
+#line 3127 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('-', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7353 "build/cgram.tab.c"
+    break;
+
+  case 457: /* pasm_e6: pasm_e5  */
+#line 3131 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7359 "build/cgram.tab.c"
+    break;
+
+  case 458: /* pasm_e6: pasm_e6 "#<" pasm_e5  */
+#line 3133 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_LIMITMIN, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7365 "build/cgram.tab.c"
+    break;
+
+  case 459: /* pasm_e6: pasm_e6 "#>" pasm_e5  */
+#line 3135 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_LIMITMAX, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7371 "build/cgram.tab.c"
+    break;
+
+  case 460: /* pasm_e7: pasm_e6  */
+#line 3139 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7377 "build/cgram.tab.c"
+    break;
+
+  case 461: /* pasm_e7: pasm_e7 '>' pasm_e6  */
+#line 3141 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('>', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7383 "build/cgram.tab.c"
+    break;
+
+  case 462: /* pasm_e7: pasm_e7 '<' pasm_e6  */
+#line 3143 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator('<', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7389 "build/cgram.tab.c"
+    break;
+
+  case 463: /* pasm_e7: pasm_e7 "<=" pasm_e6  */
+#line 3145 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_LE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7395 "build/cgram.tab.c"
+    break;
+
+  case 464: /* pasm_e7: pasm_e7 ">=" pasm_e6  */
+#line 3147 "frontends/c/cgram.y"
+            { (yyval.ast) = AstOperator(K_GE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 7401 "build/cgram.tab.c"
+    break;
+
+  case 465: /* pasmexpr: pasm_e7  */
+#line 3152 "frontends/c/cgram.y"
+            { (yyval.ast) = (yyvsp[0].ast); }
+#line 7407 "build/cgram.tab.c"
+    break;
+
+  case 466: /* pasmexpr: '\\' pasmexpr  */
+#line 3154 "frontends/c/cgram.y"
+            { (yyval.ast) = AstCatch((yyvsp[0].ast)); }
+#line 7413 "build/cgram.tab.c"
+    break;
+
+
+#line 7417 "build/cgram.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == CGRAMYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= CGRAMYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == CGRAMYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = CGRAMYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != CGRAMYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 3157 "frontends/c/cgram.y"
+
+#include <stdio.h>
+
+void
+cgramyyerror(const char *msg)
+{
+    extern int saved_cgramyychar;
+    int yychar = saved_cgramyychar;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "syntax error, unexpected end of file");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+        }
+        else if (!strncmp(msg, "unexpected type name", strlen("unexpected type name")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected type name `%s'", last_ast->d.string);
+            msg += strlen("unexpected type name");
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");
+    gl_errors++;
+    RESETCOLOR();
+}
+
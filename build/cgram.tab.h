@@ -0,0 +1,201 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED
+# define YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef CGRAMYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define CGRAMYYDEBUG 1
+#  else
+#   define CGRAMYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define CGRAMYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined CGRAMYYDEBUG */
+#if CGRAMYYDEBUG
+extern int cgramyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef CGRAMYYTOKENTYPE
+# define CGRAMYYTOKENTYPE
+  enum cgramyytokentype
+  {
+    CGRAMYYEMPTY = -2,
+    CGRAMYYEOF = 0,                /* "end of file"  */
+    CGRAMYYerror = 256,            /* error  */
+    CGRAMYYUNDEF = 257,            /* "invalid token"  */
+    C_IDENTIFIER = 258,            /* "identifier"  */
+    C_CONSTANT = 259,              /* "constant"  */
+    C_STRING_LITERAL = 260,        /* "string literal"  */
+    C_SIZEOF = 261,                /* "sizeof"  */
+    C_TYPEOF = 262,                /* "typeof"  */
+    C_PTR_OP = 263,                /* "->"  */
+    C_INC_OP = 264,                /* "++"  */
+    C_DEC_OP = 265,                /* "--"  */
+    C_LEFT_OP = 266,               /* "<<"  */
+    C_RIGHT_OP = 267,              /* ">>"  */
+    C_LE_OP = 268,                 /* "<="  */
+    C_GE_OP = 269,                 /* ">="  */
+    C_EQ_OP = 270,                 /* "=="  */
+    C_NE_OP = 271,                 /* "!="  */
+    C_AND_OP = 272,                /* "&&"  */
+    C_OR_OP = 273,                 /* "||"  */
+    C_MUL_ASSIGN = 274,            /* "*="  */
+    C_DIV_ASSIGN = 275,            /* "/="  */
+    C_MOD_ASSIGN = 276,            /* "%="  */
+    C_ADD_ASSIGN = 277,            /* "+="  */
+    C_SUB_ASSIGN = 278,            /* "-="  */
+    C_LEFT_ASSIGN = 279,           /* "<<="  */
+    C_RIGHT_ASSIGN = 280,          /* ">>="  */
+    C_AND_ASSIGN = 281,            /* "&="  */
+    C_XOR_ASSIGN = 282,            /* "^="  */
+    C_OR_ASSIGN = 283,             /* "|="  */
+    C_TYPE_NAME = 284,             /* "type name"  */
+    C_LIMITMIN_OP = 285,           /* "#<"  */
+    C_LIMITMAX_OP = 286,           /* "#>"  */
+    C_ABSADDR_OP = 287,            /* "@@@"  */
+    C_TYPEDEF = 288,               /* "typedef"  */
+    C_EXTERN = 289,                /* "extern"  */
+    C_STATIC = 290,                /* "static"  */
+    C_AUTO = 291,                  /* "auto"  */
+    C_REGISTER = 292,              /* "register"  */
+    C_RESTRICT = 293,              /* "__restrict"  */
+    C_BOOL = 294,                  /* "_Bool"  */
+    C_CHAR = 295,                  /* "char"  */
+    C_SHORT = 296,                 /* "short"  */
+    C_IMAGINARY = 297,             /* "_Imaginary"  */
+    C_INLINE = 298,                /* "inline"  */
+    C_INT = 299,                   /* "int"  */
+    C_LONG = 300,                  /* "long"  */
+    C_SIGNED = 301,                /* "signed"  */
+    C_UNSIGNED = 302,              /* "unsigned"  */
+    C_FLOAT = 303,                 /* "float"  */
+    C_DOUBLE = 304,                /* "double"  */
+    C_CONST = 305,                 /* "const"  */
+    C_VOLATILE = 306,              /* "volatile"  */
+    C_VOID = 307,                  /* "void"  */
+    C_STRUCT = 308,                /* "struct"  */
+    C_UNION = 309,                 /* "union"  */
+    C_ENUM = 310,                  /* "enum"  */
+    C_ELLIPSIS = 311,              /* "..."  */
+    C_DOUBLECOLON = 312,           /* "::"  */
+    C_CASE = 313,                  /* "case"  */
+    C_DEFAULT = 314,               /* "default"  */
+    C_IF = 315,                    /* "if"  */
+    C_ELSE = 316,                  /* "else"  */
+    C_SWITCH = 317,                /* "switch"  */
+    C_WHILE = 318,                 /* "while"  */
+    C_DO = 319,                    /* "do"  */
+    C_FOR = 320,                   /* "for"  */
+    C_GOTO = 321,                  /* "goto"  */
+    C_CONTINUE = 322,              /* "continue"  */
+    C_BREAK = 323,                 /* "break"  */
+    C_RETURN = 324,                /* "return"  */
+    C_FROMFILE = 325,              /* "__fromfile"  */
+    C_USING = 326,                 /* "__using"  */
+    C_ATTRIBUTE = 327,             /* "__attribute__"  */
+    C_ASM = 328,                   /* "__asm"  */
+    C_PASM = 329,                  /* "__pasm"  */
+    C_DEBUG = 330,                 /* "__debug"  */
+    C_INSTR = 331,                 /* "asm instruction"  */
+    C_INSTRMODIFIER = 332,         /* "instruction modifier"  */
+    C_HWREG = 333,                 /* "hardware register"  */
+    C_CATCH = 334,                 /* "catch"  */
+    C_CLASS = 335,                 /* "class"  */
+    C_DELETE = 336,                /* "delete"  */
+    C_FALSE = 337,                 /* "false"  */
+    C_NEW = 338,                   /* "new"  */
+    C_NULLPTR = 339,               /* "nullptr"  */
+    C_TRUE = 340,                  /* "true"  */
+    C_PRIVATE = 341,               /* "private"  */
+    C_PUBLIC = 342,                /* "public"  */
+    C_TEMPLATE = 343,              /* "template"  */
+    C_THIS = 344,                  /* "this"  */
+    C_THROW = 345,                 /* "throw"  */
+    C_THROWIF = 346,               /* "__throwifcaught"  */
+    C_TRY = 347,                   /* "try"  */
+    C_VIRTUAL = 348,               /* "virtual"  */
+    C_ALIGNL = 349,                /* "alignl"  */
+    C_ALIGNW = 350,                /* "alignw"  */
+    C_BYTE = 351,                  /* "byte"  */
+    C_ELSEIF = 352,                /* "elseif"  */
+    C_END = 353,                   /* "end"  */
+    C_FILE = 354,                  /* "file"  */
+    C_FIT = 355,                   /* "fit"  */
+    C_ORG = 356,                   /* "org"  */
+    C_ORGH = 357,                  /* "orgh"  */
+    C_ORGF = 358,                  /* "orgf"  */
+    C_RES = 359,                   /* "res"  */
+    C_WORD = 360,                  /* "word"  */
+    C_EOLN = 361,                  /* "end of line"  */
+    C_FUNC = 362,                  /* "__func__ or __FUNCTION__"  */
+    C_BUILTIN_ABS = 363,           /* "__builtin_abs"  */
+    C_BUILTIN_CLZ = 364,           /* "__builtin_clz"  */
+    C_BUILTIN_SQRT = 365,          /* "__builtin_sqrt"  */
+    C_BUILTIN_FRAC = 366,          /* "__builtin_frac"  */
+    C_BUILTIN_MULH = 367,          /* "__builtin_mulh"  */
+    C_BUILTIN_MULUH = 368,         /* "__builtin_muluh"  */
+    C_BUILTIN_ALLOCA = 369,        /* "__builtin_alloca"  */
+    C_BUILTIN_COGSTART = 370,      /* "__builtin_cogstart"  */
+    C_BUILTIN_COGSTART_COG = 371,  /* "__builtin_cogstart_cog"  */
+    C_BUILTIN_EXPECT = 372,        /* "__builtin_expect"  */
+    C_BUILTIN_OFFSETOF = 373,      /* "__builtin_offsetof"  */
+    C_BUILTIN_PRINTF = 374,        /* "__builtin_printf"  */
+    C_BUILTIN_REV = 375,           /* "__builtin_rev"  */
+    C_BUILTIN_VA_START = 376,      /* "__builtin_va_start"  */
+    C_BUILTIN_VA_ARG = 377,        /* "__builtin_va_arg"  */
+    C_BUILTIN_SETJMP = 378,        /* "__builtin_setjmp"  */
+    C_BUILTIN_LONGJMP = 379,       /* "__builtin_longjmp"  */
+    C_BUILTIN_STRLEN = 380,        /* "__builtin_strlen"  */
+    C_EOF = 381                    /* "end of file"  */
+  };
+  typedef enum cgramyytokentype cgramyytoken_kind_t;
+#endif
+
+/* Value type.  */
+
+
+
+
+int cgramyyparse (void);
+
+
+#endif /* !YY_CGRAMYY_BUILD_CGRAM_TAB_H_INCLUDED  */
@@ -0,0 +1,12988 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+/* Substitute the type names.  */
+#define YYSTYPE         SPINYYSTYPE
+/* Substitute the variable and function names.  */
+#define yyparse         spinyyparse
+#define yylex           spinyylex
+#define yyerror         spinyyerror
+#define yydebug         spinyydebug
+#define yynerrs         spinyynerrs
+
+/* First part of user prologue.  */
+#line 10 "frontends/spin/spin.y"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include "spinc.h"
+
+#undef  YYSTYPE
+#define YYSTYPE SPINYYSTYPE
+    
+/* Yacc functions */
+    void spinyyerror(const char *);
+    int spinyylex(SPINYYSTYPE *);
+
+    extern int gl_errors;
+
+    extern AST *last_ast, *prev_last_ast;
+    extern bool Spin2NewKeyword(LexStream *L, const char *ident);
+
+AST *
+SpinRetType(AST *funcdef)
+{
+    AST *resultvars = NULL;
+    
+    if (funcdef->kind != AST_FUNCDEF) return NULL;
+    funcdef = funcdef->left;
+    if (funcdef->kind != AST_FUNCDECL) return NULL;
+    resultvars = funcdef->right;
+    if (resultvars && resultvars->kind == AST_DECLARE_VAR) {
+        return resultvars->left;
+    }
+    funcdef = funcdef ->left;
+    if (funcdef->kind != AST_IDENTIFIER) return NULL;
+    if (strrchr(funcdef->d.string, '$') != NULL)
+        return ast_type_string;
+    return NULL;
+}
+
+// add a block of data to the DAT section, and return a pointer to its address
+static AST *
+SpinAddDatList(AST *datlist)
+{
+    AST *label = AstTempIdentifier("_byteptr_");
+    AST *ptr = NewAST(AST_ABSADDROF, DupAST(label), NULL);
+    AST *ast = label;
+
+    if (datlist && datlist->kind != AST_LISTHOLDER)
+        datlist = NewAST(AST_LISTHOLDER, datlist, NULL);
+    ast = NewAST(AST_LISTHOLDER, ast, datlist);
+
+    // add this entry to the DAT section
+    current->datblock = AddToListEx(current->datblock, ast, &current->datblock_tail);
+    
+    // return a pointer to it
+    return ptr;
+    
+}
+
+// add a constant definition immediately (if we know the
+// values) or later (if we do not)
+static AST *
+SpinAddConstant(AST *id, AST *val)
+{
+    int op = K_ASSIGN;
+    if (IsConstExpr(val)) {
+        const char *name = GetIdentifierName(id);
+        if (!LookupSymbolInTable(&current->objsyms, name)) {
+            EnterConstant(current, GetIdentifierName(id),
+                          val);
+            op = K_NOP;
+        }
+    }
+    return AstOpAssign(op, id, val);
+}
+
+// add symbol definitions to currentTypes
+static void
+SpinAddLocalSymbol(AST *ident, int kind, void *val)
+{
+    const char *name;
+    if (!currentTypes) return;
+    if (ident && ident->kind == AST_DECLARE_VAR) {
+        ident = ident->left;
+    }
+    if (!ident) return;
+    if (ident->kind == AST_ASSIGN) {
+        ident = ident->left;
+    }
+    name = GetIdentifierName(ident);
+    AddSymbol(currentTypes, name, kind, val, NULL);
+}
+
+void
+SpinDeclareFuncSymbols(AST *paramlist, AST *resultname, AST *varlist)
+{
+    AST *list;
+    AST *item;
+    SpinAddLocalSymbol(resultname, SYM_LOCALVAR, NULL);
+    for (list = paramlist; list; list = list->right) {
+        item = list->left;
+        SpinAddLocalSymbol(item, SYM_LOCALVAR, NULL);
+    }
+    for (list = varlist; list; list = list->right) {
+        item = list->left;
+        SpinAddLocalSymbol(item, SYM_LOCALVAR, NULL);
+    }
+    
+}
+
+void
+SpinDeclareVarSymbols(AST *varlist)
+{
+    AST *list;
+    AST *item;
+
+    for (list = varlist; list; list = list->right) {
+        item = list->left;
+        SpinAddLocalSymbol(item, SYM_LOCALVAR, NULL);
+    }
+}
+
+void
+SpinDeclareObjectSymbols(AST *objlist)
+{
+    AST *item;
+    AST *typ;
+    // this is a list of OBJECTs
+    while (objlist != NULL) {
+        item = objlist->left;
+        objlist = objlist->right;
+        if (!item) continue;
+        if (item->kind == AST_OBJECT) {
+            item = item->left;
+        }
+        typ = ExprType(item);
+        SpinAddLocalSymbol(item, SYM_VARIABLE, typ);
+    }
+}
+
+// expand C escapes (like \n) in a string
+// return an exprlist of strings and characters
+AST *ExpandCEscapes(AST *str) {
+    ListBuilder elist = { NULL, NULL };
+    const char *inpstr;
+    int c;
+    
+    if (str->kind != AST_STRING) {
+        ERROR(str, "Internal error, expected AST_STRING");
+        return NULL;
+    }
+    inpstr = str->d.string;
+    c = *inpstr++;
+    while (c) {
+        int digit = -1;
+        int d2 = 0;
+        AST *elem = NULL;
+        if (c == '\\') {
+            c = *inpstr++;
+            switch (c) {
+            case 'a': digit =  7; break;
+            case 'b': digit =  8; break;
+            case 't': digit =  9; break;
+            case 'n': digit = 10; break;
+            case 'f': digit = 12; break;
+            case 'r': digit = 13; break;
+            case '\\': digit = 92; break;
+            case 'x':
+                if (!isxdigit(inpstr[0]) || !isxdigit(inpstr[1])) {
+                    ERROR(str, "illegal escape (should have 2 hex digits after \\x)");
+                } else {
+                    digit = toupper(inpstr[0]);
+                    if (digit >= 'A' && digit <= 'F')
+                        digit = (digit - 'A') + 10;
+                    else
+                        digit = (digit - '0');
+                    d2 = toupper(inpstr[0]);
+                    if (d2 >= 'A' && d2 <= 'F')
+                        d2 = (d2 - 'A') + 10;
+                    else
+                        d2 = (d2 - '0');
+                    digit = (digit << 4) + d2;
+                    inpstr += 2;
+                }
+                break;
+            default:
+                break;
+            }
+            if (digit != -1) {
+                elem = NewAST(AST_EXPRLIST, AstInteger(digit), NULL);
+            } else {
+                elem = NewAST(AST_EXPRLIST, AstInteger('\\'),
+                              NewAST(AST_EXPRLIST, AstInteger(c), NULL));
+            }
+        } else if (c) {
+            char *dummy = strdup(inpstr-1);
+            char *ptr = dummy;
+            while (*ptr && *ptr != '\\')
+                ptr++;
+            *ptr = 0;
+            inpstr += (ptr-dummy)-1;
+            elem = NewAST(AST_STRING, NULL, NULL);
+            elem->d.string = dummy;
+            elem = NewAST(AST_EXPRLIST, elem, NULL);
+        }
+        elist = ListBuilderAdd(elist, elem);
+        c = *inpstr++;
+    }
+    return elist.head;
+}
+
+static AST *
+MakeFunccall(AST *func, AST *params, AST *numresults)
+{
+    if (numresults) {
+        func = NewAST(AST_CAST, GenericFunctionPtr(numresults), func);
+    }
+    return NewAST(AST_FUNCCALL, func, params);
+}
+
+static AST *
+MakeFunccall1(AST *func, AST *arg1)
+{
+    AST *exprlist = NewAST(AST_EXPRLIST, arg1, NULL);
+    return MakeFunccall(func, exprlist, NULL);
+}
+
+// special handling for things like "abc" | x
+// in Spin this is the same as "ab", "c" | x
+
+static int IsLongString(AST *ast)
+{
+    if (ast && ast->kind == AST_STRING) {
+        return strlen(ast->d.string) > 1;
+    }
+    return 0;
+}
+
+// convert a pin range like 57..46 to an ADDPINS expression
+static AST *
+ConvertPinRange(AST *exprlist)
+{
+    AST *expr;
+    AST *lhs, *rhs;
+    if (!exprlist || !exprlist->left) {
+        return exprlist;
+    }
+    expr = exprlist->left;
+    if (expr->kind != AST_RANGE) {
+        return exprlist;
+    }
+    lhs = expr->left;
+    rhs = expr->right;
+    if (!rhs) {
+        exprlist->left = rhs;
+        return exprlist;
+    }
+    // convert A..B to B ADDPINS  (B-A)
+    lhs = AstOperator('-', lhs, rhs);
+    expr = AstOperator('|', rhs, AstOperator(K_SHL, lhs, AstInteger(6)));
+    exprlist->left = expr;
+    return exprlist;
+}
+
+// Fix up an expression list
+// convert any long string operator entries by folding the operation
+// into the first/last character of the string
+
+static AST *
+FixupList(AST *list)
+{
+    AST *item, *left, *right;
+    AST *origlist = list;
+    char *shortstr;
+    char *singlechar;
+    int slen;
+    int op;
+    
+    while (list && list->kind == AST_EXPRLIST) {
+        item = list->left;
+        if (item && item->kind == AST_OPERATOR) {
+            op = item->d.ival;
+            left = item->left;
+            right = item->right;
+            if (IsLongString(left)) {
+                if (IsLongString(right)) {
+                    SYNTAX_ERROR("unable to apply operator to two strings");
+                } else {
+                    // convert to AST_EXPRLIST( most of left, left_last_char OP right )
+                    shortstr = strdup(left->d.string);
+                    slen = strlen(left->d.string);
+                    singlechar = strdup(shortstr + slen - 1);
+                    shortstr[slen - 1] = 0;
+                    left = AstPlainString(shortstr);
+                    right = AstOperator(op, AstPlainString(singlechar), right);
+                    list->left = left;
+                    list->right = NewAST(AST_EXPRLIST, right, list->right);
+                }
+            } else if (IsLongString(right)) {
+                shortstr = strdup(right->d.string+1);
+                singlechar = (char *)calloc(1, 2);
+                singlechar[0] = right->d.string[0];
+                left = AstOperator(op, left, AstPlainString(singlechar));
+                right = AstPlainString(shortstr);
+                list->left = left;
+                list->right = NewAST(AST_EXPRLIST, right, list->right);
+            }
+        }
+        list = list->right;
+    }
+    return origlist;
+}
+
+// possibly create an array type
+AST *
+MaybeArrayType(AST *basetype, AST *size)
+{
+    if (!size) return basetype;
+
+    return MakeArrayType(basetype, size);
+}
+
+// declare a Spin structure
+static void
+SpinDeclareStruct(AST *ident, AST *defs)
+{
+    const char *classname = GetUserIdentifierName(ident);
+    Module *P = NewModule(classname, current->curLanguage);
+    AST *newobj = NewAbstractObject(ident, NULL, 0);
+    newobj->d.ptr = P;
+    AddSymbol(currentTypes, classname, SYM_TYPEDEF, newobj, NULL);
+    
+    if (P != current) {
+        P->Lptr = current->Lptr;
+        P->subclasses = current->subclasses;
+        current->subclasses = P;
+        P->superclass = current;
+        P->fullname = current->fullname; // for finding "class using"
+         newobj->d.ptr = (void *)P;
+        P->isPacked = 1;
+
+        /* import parent's symbols into P */
+        P->objsyms.next = &current->objsyms;
+        AddSymbol(&current->objsyms, classname, SYM_TYPEDEF, newobj, NULL);
+    }
+
+    PushCurrentModule();
+    current = P;
+    AST *item;
+    /* declare member variables */
+    while (defs) {
+        item = defs->left;
+        defs = defs->right;
+        while (item && item->kind == AST_COMMENTEDNODE) {
+            item = item->left;
+        }
+        DeclareBASICMemberVariables(item);
+    }
+    PopCurrentModule();
+}
+
+// declare a Spin structure
+static void
+SpinDeclareInterface(AST *ident, AST *defs)
+{
+    const char *classname = GetUserIdentifierName(ident);
+    Module *P = NewModule(classname, current->curLanguage);
+    AST *newobj = NewAbstractObject(ident, NULL, 0);
+    newobj->d.ptr = P;
+    P->isInterface = 1;
+    
+    AddSymbol(currentTypes, classname, SYM_TYPEDEF, newobj, NULL);
+    
+    if (P != current) {
+        P->Lptr = current->Lptr;
+        P->subclasses = current->subclasses;
+        current->subclasses = P;
+        P->superclass = current;
+        P->fullname = current->fullname; // for finding "class using"
+         newobj->d.ptr = (void *)P;
+        P->isPacked = 1;
+
+        /* import parent's symbols into P */
+        P->objsyms.next = &current->objsyms;
+        AddSymbol(&current->objsyms, classname, SYM_TYPEDEF, newobj, NULL);
+    }
+
+    PushCurrentModule();
+    current = P;
+    AST *item;
+    /* declare abstract methods */
+    while (defs) {
+        AST *rettype;
+        AST *body = NULL;
+        item = defs->left;
+        defs = defs->right;
+        while (item && item->kind == AST_COMMENTEDNODE) {
+            item = item->left;
+        }
+        rettype = SpinRetType(item);
+        DeclareFunction(current, rettype, 1, item, body, NULL, NULL);
+    }
+    PopCurrentModule();
+}
+
+#define YYERROR_VERBOSE 1
+
+#line 483 "build/spin.tab.c"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "spin.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SP_IDENTIFIER = 3,              /* "identifier"  */
+  YYSYMBOL_SP_BYTECODE = 4,                /* "__bytecode__"  */
+  YYSYMBOL_SP_NUM = 5,                     /* "number"  */
+  YYSYMBOL_SP_STRING = 6,                  /* "string"  */
+  YYSYMBOL_SP_BACKTICK_STRING = 7,         /* "` string"  */
+  YYSYMBOL_SP_FLOATNUM = 8,                /* "float point number"  */
+  YYSYMBOL_SP_SPR = 9,                     /* "SPR"  */
+  YYSYMBOL_SP_COGREG = 10,                 /* "REG"  */
+  YYSYMBOL_SP_CON = 11,                    /* "CON"  */
+  YYSYMBOL_SP_VAR = 12,                    /* "VAR"  */
+  YYSYMBOL_SP_DAT = 13,                    /* "DAT"  */
+  YYSYMBOL_SP_PUB = 14,                    /* "PUB"  */
+  YYSYMBOL_SP_PRI = 15,                    /* "PRI"  */
+  YYSYMBOL_SP_OBJ = 16,                    /* "OBJ"  */
+  YYSYMBOL_SP_END = 17,                    /* "END"  */
+  YYSYMBOL_SP_INLINECCODE = 18,            /* "CCODE"  */
+  YYSYMBOL_SP_BYTE = 19,                   /* "BYTE"  */
+  YYSYMBOL_SP_WORD = 20,                   /* "WORD"  */
+  YYSYMBOL_SP_LONG = 21,                   /* "LONG"  */
+  YYSYMBOL_SP_QUAD = 22,                   /* "%QUAD"  */
+  YYSYMBOL_SP_BYTEFIT = 23,                /* "BYTEFIT"  */
+  YYSYMBOL_SP_WORDFIT = 24,                /* "WORDFIT"  */
+  YYSYMBOL_SP_FVAR = 25,                   /* "FVAR"  */
+  YYSYMBOL_SP_FVARS = 26,                  /* "FVARS"  */
+  YYSYMBOL_SP_ASMCLK = 27,                 /* "ASMCLK"  */
+  YYSYMBOL_SP_INSTR = 28,                  /* "instruction"  */
+  YYSYMBOL_SP_INSTRMODIFIER = 29,          /* "instruction modifier"  */
+  YYSYMBOL_SP_HWREG = 30,                  /* "hardware register"  */
+  YYSYMBOL_SP_ORG = 31,                    /* "ORG"  */
+  YYSYMBOL_SP_ORGH = 32,                   /* "ORGH"  */
+  YYSYMBOL_SP_ORGF = 33,                   /* "ORGF"  */
+  YYSYMBOL_SP_RES = 34,                    /* "RES"  */
+  YYSYMBOL_SP_FIT = 35,                    /* "FIT"  */
+  YYSYMBOL_SP_ALIGNL = 36,                 /* "ALIGNL"  */
+  YYSYMBOL_SP_ALIGNW = 37,                 /* "ALIGNW"  */
+  YYSYMBOL_SP_REPEAT = 38,                 /* "REPEAT"  */
+  YYSYMBOL_SP_FROM = 39,                   /* "FROM"  */
+  YYSYMBOL_SP_TO = 40,                     /* "TO"  */
+  YYSYMBOL_SP_STEP = 41,                   /* "STEP"  */
+  YYSYMBOL_SP_WHILE = 42,                  /* "WHILE"  */
+  YYSYMBOL_SP_WITH = 43,                   /* "WITH"  */
+  YYSYMBOL_SP_UNTIL = 44,                  /* "UNTIL"  */
+  YYSYMBOL_SP_IF = 45,                     /* "IF"  */
+  YYSYMBOL_SP_IFNOT = 46,                  /* "IFNOT"  */
+  YYSYMBOL_SP_ELSE = 47,                   /* "ELSE"  */
+  YYSYMBOL_SP_ELSEIF = 48,                 /* "ELSEIF"  */
+  YYSYMBOL_SP_ELSEIFNOT = 49,              /* "ELSEIFNOT"  */
+  YYSYMBOL_SP_THEN = 50,                   /* "THEN"  */
+  YYSYMBOL_SP_ENDIF = 51,                  /* "ENDIF"  */
+  YYSYMBOL_SP_LOOKDOWN = 52,               /* "LOOKDOWN"  */
+  YYSYMBOL_SP_LOOKDOWNZ = 53,              /* "LOOKDOWNZ"  */
+  YYSYMBOL_SP_LOOKUP = 54,                 /* "LOOKUP"  */
+  YYSYMBOL_SP_LOOKUPZ = 55,                /* "LOOKUPZ"  */
+  YYSYMBOL_SP_COGINIT = 56,                /* "COGINIT"  */
+  YYSYMBOL_SP_COGNEW = 57,                 /* "COGNEW"  */
+  YYSYMBOL_SP_TASKINIT = 58,               /* "TASKSPIN"  */
+  YYSYMBOL_SP_TASKHLT = 59,                /* "TASKHLT"  */
+  YYSYMBOL_SP_PINR = 60,                   /* "PINREAD"  */
+  YYSYMBOL_SP_PINT = 61,                   /* "PINTOGGLE"  */
+  YYSYMBOL_SP_PINW = 62,                   /* "PINWRITE"  */
+  YYSYMBOL_SP_PINL = 63,                   /* "PINLOW"  */
+  YYSYMBOL_SP_PINH = 64,                   /* "PINHIGH"  */
+  YYSYMBOL_SP_CASE = 65,                   /* "CASE"  */
+  YYSYMBOL_SP_CASE_FAST = 66,              /* "CASE_FAST"  */
+  YYSYMBOL_SP_OTHER = 67,                  /* "OTHER"  */
+  YYSYMBOL_SP_QUIT = 68,                   /* "QUIT"  */
+  YYSYMBOL_SP_NEXT = 69,                   /* "NEXT"  */
+  YYSYMBOL_SP_ALLOCA = 70,                 /* "__BUILTIN_ALLOCA"  */
+  YYSYMBOL_SP_REGEXEC = 71,                /* "REGEXEC"  */
+  YYSYMBOL_SP_REGLOAD = 72,                /* "REGLOAD"  */
+  YYSYMBOL_SP_ABORT = 73,                  /* "ABORT"  */
+  YYSYMBOL_SP_RESULT = 74,                 /* "RESULT"  */
+  YYSYMBOL_SP_RETURN = 75,                 /* "RETURN"  */
+  YYSYMBOL_SP_INDENT = 76,                 /* "indentation"  */
+  YYSYMBOL_SP_OUTDENT = 77,                /* "lack of indentation"  */
+  YYSYMBOL_SP_EOLN = 78,                   /* "end of line"  */
+  YYSYMBOL_SP_EOF = 79,                    /* "end of file"  */
+  YYSYMBOL_SP_DOTS = 80,                   /* ".."  */
+  YYSYMBOL_SP_HERE = 81,                   /* "$"  */
+  YYSYMBOL_SP_STRINGPTR = 82,              /* "STRING"  */
+  YYSYMBOL_SP_FILE = 83,                   /* "FILE"  */
+  YYSYMBOL_SP_ANNOTATION = 84,             /* SP_ANNOTATION  */
+  YYSYMBOL_SP_ASM = 85,                    /* "ASM"  */
+  YYSYMBOL_SP_ASM_CONST = 86,              /* "ASM_CONST"  */
+  YYSYMBOL_SP_ENDASM = 87,                 /* "ENDASM"  */
+  YYSYMBOL_SP_ASM_IF = 88,                 /* "%IF"  */
+  YYSYMBOL_SP_ASM_ELSEIF = 89,             /* "%ELSEIF"  */
+  YYSYMBOL_SP_ASM_ELSE = 90,               /* "%ELSE"  */
+  YYSYMBOL_SP_ASM_ENDIF = 91,              /* "%END"  */
+  YYSYMBOL_SP_INTERFACE = 92,              /* "%INTERFACE"  */
+  YYSYMBOL_SP_NAMESP = 93,                 /* "%NAMESP"  */
+  YYSYMBOL_SP_VARARGS = 94,                /* "%VARARGS"  */
+  YYSYMBOL_SP_FIELD = 95,                  /* "FIELD"  */
+  YYSYMBOL_SP_BYTES = 96,                  /* "BYTES"  */
+  YYSYMBOL_SP_WORDS = 97,                  /* "WORDS"  */
+  YYSYMBOL_SP_LONGS = 98,                  /* "LONGS"  */
+  YYSYMBOL_SP_LSTRING = 99,                /* "LSTRING"  */
+  YYSYMBOL_SP_TYPENAME = 100,              /* "STRUCTURE NAME"  */
+  YYSYMBOL_SP_BYTESWAP = 101,              /* "BYTESWAP"  */
+  YYSYMBOL_SP_WORDSWAP = 102,              /* "WORDSWAP"  */
+  YYSYMBOL_SP_LONGSWAP = 103,              /* "LONGSWAP"  */
+  YYSYMBOL_SP_BYTECOMP = 104,              /* "BYTECOMP"  */
+  YYSYMBOL_SP_WORDCOMP = 105,              /* "WORDCOMP"  */
+  YYSYMBOL_SP_LONGCOMP = 106,              /* "LONGCOMP"  */
+  YYSYMBOL_SP_FILL = 107,                  /* "FILL"  */
+  YYSYMBOL_SP_COPY = 108,                  /* "COPY"  */
+  YYSYMBOL_SP_SWAP = 109,                  /* "SWAP"  */
+  YYSYMBOL_SP_COMP = 110,                  /* "COMP"  */
+  YYSYMBOL_SP_STRUCT = 111,                /* "STRUCT"  */
+  YYSYMBOL_SP_SIZEOF = 112,                /* "SIZEOF"  */
+  YYSYMBOL_SP_SWAP_OP = 113,               /* ":=:"  */
+  YYSYMBOL_SP_C_Z = 114,                   /* "C_Z"  */
+  YYSYMBOL_SP_NEWTASK = 115,               /* "NEWTASK"  */
+  YYSYMBOL_SP_THISTASK = 116,              /* "THISTASK"  */
+  YYSYMBOL_SP_DITTO = 117,                 /* "DITTO"  */
+  YYSYMBOL_SP_ASSIGN = 118,                /* ":="  */
+  YYSYMBOL_SP_XOR = 119,                   /* "XOR (^^)"  */
+  YYSYMBOL_SP_OR = 120,                    /* "OR (||)"  */
+  YYSYMBOL_SP_AND = 121,                   /* "AND (&&)"  */
+  YYSYMBOL_SP_ORELSE = 122,                /* "__ORELSE__"  */
+  YYSYMBOL_SP_ANDTHEN = 123,               /* "__ANDTHEN__"  */
+  YYSYMBOL_SP_GE = 124,                    /* "=>"  */
+  YYSYMBOL_SP_LE = 125,                    /* "=<"  */
+  YYSYMBOL_SP_GEU = 126,                   /* "+=>"  */
+  YYSYMBOL_SP_LEU = 127,                   /* "+=<"  */
+  YYSYMBOL_SP_GTU = 128,                   /* "+>"  */
+  YYSYMBOL_SP_LTU = 129,                   /* "+<"  */
+  YYSYMBOL_SP_NE = 130,                    /* "<>"  */
+  YYSYMBOL_SP_EQ = 131,                    /* "=="  */
+  YYSYMBOL_SP_SGNCOMP = 132,               /* "<=>"  */
+  YYSYMBOL_SP_LIMITMIN = 133,              /* "#>"  */
+  YYSYMBOL_SP_LIMITMAX = 134,              /* "<#"  */
+  YYSYMBOL_SP_REMAINDER = 135,             /* "//"  */
+  YYSYMBOL_SP_UNSDIV = 136,                /* "+/"  */
+  YYSYMBOL_SP_UNSMOD = 137,                /* "+//"  */
+  YYSYMBOL_SP_FRAC = 138,                  /* "FRAC"  */
+  YYSYMBOL_SP_HIGHMULT = 139,              /* "**"  */
+  YYSYMBOL_SP_SCAS = 140,                  /* "SCAS"  */
+  YYSYMBOL_SP_UNSHIGHMULT = 141,           /* "SCA (+**)"  */
+  YYSYMBOL_SP_ROTR = 142,                  /* "ROR (->)"  */
+  YYSYMBOL_SP_ROTL = 143,                  /* "ROL (<-)"  */
+  YYSYMBOL_SP_SHL = 144,                   /* "<<"  */
+  YYSYMBOL_SP_SHR = 145,                   /* ">>"  */
+  YYSYMBOL_SP_SAR = 146,                   /* "SAR (~>)"  */
+  YYSYMBOL_SP_REV = 147,                   /* "><"  */
+  YYSYMBOL_SP_REV2 = 148,                  /* "REV"  */
+  YYSYMBOL_SP_ADDBITS = 149,               /* "ADDBITS"  */
+  YYSYMBOL_SP_ADDPINS = 150,               /* "ADDPINS"  */
+  YYSYMBOL_SP_NEGATE = 151,                /* "-"  */
+  YYSYMBOL_SP_BIT_NOT = 152,               /* "!"  */
+  YYSYMBOL_SP_SQRT = 153,                  /* "SQRT (^^)"  */
+  YYSYMBOL_SP_ABS = 154,                   /* "ABS (||)"  */
+  YYSYMBOL_SP_FSQRT = 155,                 /* "FSQRT"  */
+  YYSYMBOL_SP_FABS = 156,                  /* "FABS"  */
+  YYSYMBOL_SP_DECODE = 157,                /* "DECOD (|<)"  */
+  YYSYMBOL_SP_ENCODE = 158,                /* ">|"  */
+  YYSYMBOL_SP_ENCODE2 = 159,               /* "ENCOD"  */
+  YYSYMBOL_SP_NOT = 160,                   /* "NOT (!!)"  */
+  YYSYMBOL_SP_DOUBLETILDE = 161,           /* "~~"  */
+  YYSYMBOL_SP_INCREMENT = 162,             /* "++"  */
+  YYSYMBOL_SP_DECREMENT = 163,             /* "--"  */
+  YYSYMBOL_SP_REF_INC = 164,               /* "[++]"  */
+  YYSYMBOL_SP_REF_DEC = 165,               /* "[--]"  */
+  YYSYMBOL_SP_DOUBLEAT = 166,              /* "@@"  */
+  YYSYMBOL_SP_TRIPLEAT = 167,              /* "@@@"  */
+  YYSYMBOL_SP_FIELDPTR = 168,              /* "^@"  */
+  YYSYMBOL_SP_FLOAT = 169,                 /* "floating point number"  */
+  YYSYMBOL_SP_TRUNC = 170,                 /* "TRUNC"  */
+  YYSYMBOL_SP_ROUND = 171,                 /* "ROUND"  */
+  YYSYMBOL_SP_CONSTANT = 172,              /* "constant"  */
+  YYSYMBOL_SP_RANDOM = 173,                /* "??"  */
+  YYSYMBOL_SP_EMPTY = 174,                 /* "empty assignment marker _"  */
+  YYSYMBOL_SP_SIGNX = 175,                 /* "SIGNX"  */
+  YYSYMBOL_SP_ZEROX = 176,                 /* "ZEROX"  */
+  YYSYMBOL_SP_NAN = 177,                   /* "NAN"  */
+  YYSYMBOL_SP_ONES = 178,                  /* "ONES"  */
+  YYSYMBOL_SP_BMASK = 179,                 /* "BMASK"  */
+  YYSYMBOL_SP_QLOG = 180,                  /* "QLOG"  */
+  YYSYMBOL_SP_QEXP = 181,                  /* "QEXP"  */
+  YYSYMBOL_SP_DEBUG = 182,                 /* "DEBUG"  */
+  YYSYMBOL_SP_LOOK_SEP = 183,              /* ": after lookup/down"  */
+  YYSYMBOL_SP_CONDITIONAL = 184,           /* "?"  */
+  YYSYMBOL_SP_CONDITIONAL_SEP = 185,       /* ": after ?"  */
+  YYSYMBOL_SP_REPEAT_SEP = 186,            /* ": after repeat"  */
+  YYSYMBOL_SP_LOG2 = 187,                  /* "LOG2"  */
+  YYSYMBOL_SP_EXP2 = 188,                  /* "EXP2"  */
+  YYSYMBOL_SP_LOG10 = 189,                 /* "LOG10"  */
+  YYSYMBOL_SP_EXP10 = 190,                 /* "EXP10"  */
+  YYSYMBOL_SP_LOG = 191,                   /* "LN"  */
+  YYSYMBOL_SP_EXP = 192,                   /* "EXP"  */
+  YYSYMBOL_SP_POW = 193,                   /* "POW"  */
+  YYSYMBOL_SP_MOVBYTS = 194,               /* "MOVBYTS"  */
+  YYSYMBOL_SP_ENDIANL = 195,               /* "ENDIANL"  */
+  YYSYMBOL_SP_ENDIANW = 196,               /* "ENDIANW"  */
+  YYSYMBOL_SP_DEBUG_END_SESSION = 197,     /* "DEBUG_END_SESSION"  */
+  YYSYMBOL_SP_OFFSETOF = 198,              /* "OFFSETOF"  */
+  YYSYMBOL_SP_FADD = 199,                  /* "+."  */
+  YYSYMBOL_SP_FSUB = 200,                  /* "-."  */
+  YYSYMBOL_SP_FMUL = 201,                  /* "*."  */
+  YYSYMBOL_SP_FDIV = 202,                  /* "%."  */
+  YYSYMBOL_SP_FLT = 203,                   /* "<."  */
+  YYSYMBOL_SP_FGT = 204,                   /* ">."  */
+  YYSYMBOL_SP_FNE = 205,                   /* "<>."  */
+  YYSYMBOL_SP_FEQ = 206,                   /* "==."  */
+  YYSYMBOL_SP_FLE = 207,                   /* "<=."  */
+  YYSYMBOL_SP_FGE = 208,                   /* ">=."  */
+  YYSYMBOL_SP_FNEGATE = 209,               /* "float negate"  */
+  YYSYMBOL_SP_DAT_LBRACK = 210,            /* "[ in DAT"  */
+  YYSYMBOL_SP_DAT_RBRACK = 211,            /* "] in DAT"  */
+  YYSYMBOL_SP_DOUBLE_DOLLAR = 212,         /* "$$"  */
+  YYSYMBOL_213_ = 213,                     /* '\\'  */
+  YYSYMBOL_214_ = 214,                     /* '<'  */
+  YYSYMBOL_215_ = 215,                     /* '>'  */
+  YYSYMBOL_216_ = 216,                     /* '-'  */
+  YYSYMBOL_217_ = 217,                     /* '+'  */
+  YYSYMBOL_218_ = 218,                     /* '*'  */
+  YYSYMBOL_219_ = 219,                     /* '/'  */
+  YYSYMBOL_220_ = 220,                     /* '|'  */
+  YYSYMBOL_221_ = 221,                     /* '^'  */
+  YYSYMBOL_222_ = 222,                     /* '&'  */
+  YYSYMBOL_223_ = 223,                     /* '@'  */
+  YYSYMBOL_224_ = 224,                     /* '~'  */
+  YYSYMBOL_225_ = 225,                     /* '?'  */
+  YYSYMBOL_226_ = 226,                     /* '='  */
+  YYSYMBOL_227_ = 227,                     /* '('  */
+  YYSYMBOL_228_ = 228,                     /* ')'  */
+  YYSYMBOL_229_ = 229,                     /* ':'  */
+  YYSYMBOL_230_ = 230,                     /* '['  */
+  YYSYMBOL_231_ = 231,                     /* ']'  */
+  YYSYMBOL_232_ = 232,                     /* ','  */
+  YYSYMBOL_233_ = 233,                     /* '#'  */
+  YYSYMBOL_234_ = 234,                     /* '!'  */
+  YYSYMBOL_235_ = 235,                     /* '.'  */
+  YYSYMBOL_YYACCEPT = 236,                 /* $accept  */
+  YYSYMBOL_input = 237,                    /* input  */
+  YYSYMBOL_rest = 238,                     /* rest  */
+  YYSYMBOL_emptyline = 239,                /* emptyline  */
+  YYSYMBOL_emptylines = 240,               /* emptylines  */
+  YYSYMBOL_topelement = 241,               /* topelement  */
+  YYSYMBOL_funcdef = 242,                  /* funcdef  */
+  YYSYMBOL_funcdef_end = 243,              /* funcdef_end  */
+  YYSYMBOL_optparamlist = 244,             /* optparamlist  */
+  YYSYMBOL_resultname = 245,               /* resultname  */
+  YYSYMBOL_localvars = 246,                /* localvars  */
+  YYSYMBOL_funcbody_internal = 247,        /* funcbody_internal  */
+  YYSYMBOL_enter_func = 248,               /* enter_func  */
+  YYSYMBOL_exit_func = 249,                /* exit_func  */
+  YYSYMBOL_funcbody = 250,                 /* funcbody  */
+  YYSYMBOL_stmtlist = 251,                 /* stmtlist  */
+  YYSYMBOL_stmt = 252,                     /* stmt  */
+  YYSYMBOL_basicstmt = 253,                /* basicstmt  */
+  YYSYMBOL_debug_prefix = 254,             /* debug_prefix  */
+  YYSYMBOL_optdebugmask = 255,             /* optdebugmask  */
+  YYSYMBOL_debug_exprlist = 256,           /* debug_exprlist  */
+  YYSYMBOL_debug_exprlist_continue = 257,  /* debug_exprlist_continue  */
+  YYSYMBOL_debug_expritem_first = 258,     /* debug_expritem_first  */
+  YYSYMBOL_debug_expritem = 259,           /* debug_expritem  */
+  YYSYMBOL_asmdebug_func = 260,            /* asmdebug_func  */
+  YYSYMBOL_asmdebug_exprlist = 261,        /* asmdebug_exprlist  */
+  YYSYMBOL_asmdebug_exprlist_continue = 262, /* asmdebug_exprlist_continue  */
+  YYSYMBOL_asmdebug_expritem_first = 263,  /* asmdebug_expritem_first  */
+  YYSYMBOL_asmdebug_expritem = 264,        /* asmdebug_expritem  */
+  YYSYMBOL_multiassign = 265,              /* multiassign  */
+  YYSYMBOL_compoundstmt = 266,             /* compoundstmt  */
+  YYSYMBOL_stmtblock = 267,                /* stmtblock  */
+  YYSYMBOL_ifstmt = 268,                   /* ifstmt  */
+  YYSYMBOL_elseblock = 269,                /* elseblock  */
+  YYSYMBOL_casestmt = 270,                 /* casestmt  */
+  YYSYMBOL_casematchlist = 271,            /* casematchlist  */
+  YYSYMBOL_casematchitem = 272,            /* casematchitem  */
+  YYSYMBOL_casematch = 273,                /* casematch  */
+  YYSYMBOL_matchexprlist = 274,            /* matchexprlist  */
+  YYSYMBOL_matchexpritem = 275,            /* matchexpritem  */
+  YYSYMBOL_rangeexpritem = 276,            /* rangeexpritem  */
+  YYSYMBOL_rangeexprlist = 277,            /* rangeexprlist  */
+  YYSYMBOL_repeatstmt = 278,               /* repeatstmt  */
+  YYSYMBOL_lookupexpr = 279,               /* lookupexpr  */
+  YYSYMBOL_lookdownexpr = 280,             /* lookdownexpr  */
+  YYSYMBOL_conblock = 281,                 /* conblock  */
+  YYSYMBOL_conline = 282,                  /* conline  */
+  YYSYMBOL_structlist = 283,               /* structlist  */
+  YYSYMBOL_optarray = 284,                 /* optarray  */
+  YYSYMBOL_structitem = 285,               /* structitem  */
+  YYSYMBOL_ifacelist = 286,                /* ifacelist  */
+  YYSYMBOL_ifaceitem = 287,                /* ifaceitem  */
+  YYSYMBOL_enumlist = 288,                 /* enumlist  */
+  YYSYMBOL_enumitem = 289,                 /* enumitem  */
+  YYSYMBOL_datblock = 290,                 /* datblock  */
+  YYSYMBOL_datline = 291,                  /* datline  */
+  YYSYMBOL_basedatline = 292,              /* basedatline  */
+  YYSYMBOL_optidentifier = 293,            /* optidentifier  */
+  YYSYMBOL_objblock = 294,                 /* objblock  */
+  YYSYMBOL_objline = 295,                  /* objline  */
+  YYSYMBOL_optobjparams = 296,             /* optobjparams  */
+  YYSYMBOL_objparams = 297,                /* objparams  */
+  YYSYMBOL_objparamitem = 298,             /* objparamitem  */
+  YYSYMBOL_varblock = 299,                 /* varblock  */
+  YYSYMBOL_varline = 300,                  /* varline  */
+  YYSYMBOL_identlist = 301,                /* identlist  */
+  YYSYMBOL_identdecl = 302,                /* identdecl  */
+  YYSYMBOL_vardecl = 303,                  /* vardecl  */
+  YYSYMBOL_vardecllist = 304,              /* vardecllist  */
+  YYSYMBOL_general_type = 305,             /* general_type  */
+  YYSYMBOL_paramidentdecl = 306,           /* paramidentdecl  */
+  YYSYMBOL_paramidentlist = 307,           /* paramidentlist  */
+  YYSYMBOL_expr = 308,                     /* expr  */
+  YYSYMBOL_lhs = 309,                      /* lhs  */
+  YYSYMBOL_lhsseq = 310,                   /* lhsseq  */
+  YYSYMBOL_lhsseqcont = 311,               /* lhsseqcont  */
+  YYSYMBOL_lhssingle = 312,                /* lhssingle  */
+  YYSYMBOL_opt_emptysize = 313,            /* opt_emptysize  */
+  YYSYMBOL_opt_numrets = 314,              /* opt_numrets  */
+  YYSYMBOL_funccall = 315,                 /* funccall  */
+  YYSYMBOL_expritem = 316,                 /* expritem  */
+  YYSYMBOL_exprlist = 317,                 /* exprlist  */
+  YYSYMBOL_datexpritem = 318,              /* datexpritem  */
+  YYSYMBOL_datexprlist = 319,              /* datexprlist  */
+  YYSYMBOL_optcatch = 320,                 /* optcatch  */
+  YYSYMBOL_operand = 321,                  /* operand  */
+  YYSYMBOL_operandlist = 322,              /* operandlist  */
+  YYSYMBOL_range = 323,                    /* range  */
+  YYSYMBOL_integer = 324,                  /* integer  */
+  YYSYMBOL_float = 325,                    /* float  */
+  YYSYMBOL_string = 326,                   /* string  */
+  YYSYMBOL_identifier = 327,               /* identifier  */
+  YYSYMBOL_annotation = 328,               /* annotation  */
+  YYSYMBOL_hwreg = 329,                    /* hwreg  */
+  YYSYMBOL_instruction = 330,              /* instruction  */
+  YYSYMBOL_instrmodifier = 331,            /* instrmodifier  */
+  YYSYMBOL_modifierlist = 332,             /* modifierlist  */
+  YYSYMBOL_structname = 333,               /* structname  */
+  YYSYMBOL_ptrstructname = 334             /* ptrstructname  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* 1 */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined SPINYYSTYPE_IS_TRIVIAL && SPINYYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  191
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   29168
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  236
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  99
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  559
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1234
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   467
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   234,     2,   233,     2,     2,   222,     2,
+     227,   228,   218,   217,   232,   216,   235,   219,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   229,     2,
+     214,   226,   215,   225,   223,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   230,   213,   231,   221,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,   220,     2,   224,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212
+};
+
+#if SPINYYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   705,   705,   706,   715,   716,   720,   723,   724,   728,
+     730,   732,   737,   743,   749,   751,   753,   755,   757,   759,
+     762,   764,   767,   773,   779,   784,   800,   807,   811,   816,
+     818,   824,   825,   839,   840,   846,   847,   853,   858,   864,
+     869,   874,   878,   885,   887,   889,   891,   896,   898,   902,
+     904,   914,   916,   917,   919,   921,   923,   929,   934,   942,
+     949,   952,   956,   958,   963,   965,   970,   974,   983,   985,
+     990,   992,   994,   996,   998,  1000,  1005,  1006,  1011,  1013,
+    1023,  1033,  1035,  1037,  1039,  1044,  1046,  1050,  1052,  1054,
+    1056,  1061,  1063,  1068,  1070,  1075,  1077,  1079,  1081,  1086,
+    1088,  1093,  1095,  1100,  1118,  1126,  1128,  1133,  1135,  1137,
+    1143,  1145,  1150,  1152,  1157,  1164,  1166,  1168,  1173,  1181,
+    1189,  1197,  1205,  1213,  1223,  1229,  1235,  1240,  1245,  1250,
+    1252,  1256,  1258,  1263,  1265,  1270,  1272,  1280,  1288,  1296,
+    1306,  1315,  1329,  1331,  1336,  1338,  1340,  1345,  1348,  1352,
+    1354,  1358,  1362,  1366,  1370,  1379,  1381,  1386,  1388,  1393,
+    1395,  1405,  1412,  1416,  1420,  1422,  1427,  1433,  1441,  1445,
+    1470,  1472,  1474,  1476,  1478,  1480,  1482,  1484,  1488,  1492,
+    1494,  1496,  1498,  1500,  1502,  1504,  1506,  1510,  1514,  1518,
+    1522,  1524,  1526,  1528,  1530,  1538,  1540,  1542,  1547,  1549,
+    1551,  1553,  1555,  1557,  1566,  1576,  1587,  1591,  1597,  1603,
+    1607,  1620,  1623,  1630,  1632,  1637,  1639,  1641,  1651,  1672,
+    1686,  1687,  1692,  1694,  1698,  1707,  1709,  1714,  1716,  1718,
+    1720,  1727,  1732,  1734,  1736,  1738,  1743,  1745,  1748,  1753,
+    1755,  1760,  1762,  1764,  1769,  1771,  1776,  1778,  1783,  1785,
+    1790,  1795,  1797,  1802,  1804,  1806,  1808,  1810,  1815,  1817,
+    1819,  1824,  1831,  1839,  1844,  1849,  1854,  1859,  1864,  1869,
+    1874,  1879,  1884,  1889,  1894,  1899,  1908,  1910,  1913,  1915,
+    1921,  1922,  1923,  1924,  1929,  1936,  1942,  1948,  1954,  1955,
+    1975,  1977,  1979,  1984,  1986,  1988,  1990,  1992,  1994,  1996,
+    1998,  2000,  2002,  2004,  2006,  2008,  2010,  2012,  2014,  2016,
+    2018,  2020,  2022,  2024,  2026,  2028,  2030,  2032,  2034,  2036,
+    2038,  2041,  2043,  2045,  2047,  2049,  2051,  2053,  2055,  2057,
+    2059,  2061,  2063,  2065,  2067,  2069,  2071,  2073,  2075,  2077,
+    2079,  2081,  2083,  2085,  2087,  2089,  2091,  2093,  2095,  2097,
+    2099,  2101,  2103,  2105,  2107,  2109,  2111,  2113,  2115,  2117,
+    2119,  2121,  2123,  2125,  2127,  2129,  2131,  2133,  2135,  2137,
+    2139,  2146,  2153,  2160,  2162,  2164,  2166,  2168,  2170,  2172,
+    2174,  2176,  2178,  2180,  2182,  2184,  2186,  2188,  2190,  2192,
+    2194,  2196,  2207,  2212,  2217,  2219,  2221,  2223,  2225,  2227,
+    2229,  2231,  2233,  2235,  2237,  2239,  2241,  2243,  2245,  2247,
+    2249,  2251,  2253,  2255,  2261,  2263,  2265,  2273,  2284,  2286,
+    2288,  2290,  2292,  2294,  2296,  2298,  2300,  2302,  2304,  2309,
+    2314,  2320,  2326,  2328,  2330,  2332,  2334,  2336,  2338,  2340,
+    2342,  2367,  2368,  2372,  2376,  2377,  2380,  2388,  2394,  2400,
+    2405,  2407,  2409,  2416,  2423,  2430,  2435,  2440,  2445,  2450,
+    2455,  2460,  2465,  2470,  2475,  2481,  2489,  2493,  2495,  2500,
+    2506,  2515,  2520,  2528,  2530,  2538,  2540,  2548,  2553,  2554,
+    2556,  2564,  2566,  2571,  2580,  2587,  2594,  2601,  2608,  2612,
+    2622,  2626,  2630,  2635,  2640,  2644,  2648,  2654,  2677,  2700,
+    2723,  2740,  2747,  2754,  2761,  2768,  2775,  2782,  2789,  2796,
+    2807,  2809,  2813,  2817,  2823,  2829,  2836,  2838,  2843,  2845,
+    2847,  2849,  2851,  2853,  2859,  2864,  2866,  2871,  2873,  2879,
+    2880,  2885,  2887,  2897,  2907,  2915,  2917,  2922,  2924,  2929,
+    2930,  2932,  2937,  2941,  2945,  2947,  2952,  2958,  2963,  2965,
+    2983,  2988,  2993,  2995,  2997,  3002,  3004,  3008,  3014,  3018
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "\"identifier\"",
+  "\"__bytecode__\"", "\"number\"", "\"string\"", "\"` string\"",
+  "\"float point number\"", "\"SPR\"", "\"REG\"", "\"CON\"", "\"VAR\"",
+  "\"DAT\"", "\"PUB\"", "\"PRI\"", "\"OBJ\"", "\"END\"", "\"CCODE\"",
+  "\"BYTE\"", "\"WORD\"", "\"LONG\"", "\"%QUAD\"", "\"BYTEFIT\"",
+  "\"WORDFIT\"", "\"FVAR\"", "\"FVARS\"", "\"ASMCLK\"", "\"instruction\"",
+  "\"instruction modifier\"", "\"hardware register\"", "\"ORG\"",
+  "\"ORGH\"", "\"ORGF\"", "\"RES\"", "\"FIT\"", "\"ALIGNL\"", "\"ALIGNW\"",
+  "\"REPEAT\"", "\"FROM\"", "\"TO\"", "\"STEP\"", "\"WHILE\"", "\"WITH\"",
+  "\"UNTIL\"", "\"IF\"", "\"IFNOT\"", "\"ELSE\"", "\"ELSEIF\"",
+  "\"ELSEIFNOT\"", "\"THEN\"", "\"ENDIF\"", "\"LOOKDOWN\"",
+  "\"LOOKDOWNZ\"", "\"LOOKUP\"", "\"LOOKUPZ\"", "\"COGINIT\"",
+  "\"COGNEW\"", "\"TASKSPIN\"", "\"TASKHLT\"", "\"PINREAD\"",
+  "\"PINTOGGLE\"", "\"PINWRITE\"", "\"PINLOW\"", "\"PINHIGH\"", "\"CASE\"",
+  "\"CASE_FAST\"", "\"OTHER\"", "\"QUIT\"", "\"NEXT\"",
+  "\"__BUILTIN_ALLOCA\"", "\"REGEXEC\"", "\"REGLOAD\"", "\"ABORT\"",
+  "\"RESULT\"", "\"RETURN\"", "\"indentation\"", "\"lack of indentation\"",
+  "\"end of line\"", "\"end of file\"", "\"..\"", "\"$\"", "\"STRING\"",
+  "\"FILE\"", "SP_ANNOTATION", "\"ASM\"", "\"ASM_CONST\"", "\"ENDASM\"",
+  "\"%IF\"", "\"%ELSEIF\"", "\"%ELSE\"", "\"%END\"", "\"%INTERFACE\"",
+  "\"%NAMESP\"", "\"%VARARGS\"", "\"FIELD\"", "\"BYTES\"", "\"WORDS\"",
+  "\"LONGS\"", "\"LSTRING\"", "\"STRUCTURE NAME\"", "\"BYTESWAP\"",
+  "\"WORDSWAP\"", "\"LONGSWAP\"", "\"BYTECOMP\"", "\"WORDCOMP\"",
+  "\"LONGCOMP\"", "\"FILL\"", "\"COPY\"", "\"SWAP\"", "\"COMP\"",
+  "\"STRUCT\"", "\"SIZEOF\"", "\":=:\"", "\"C_Z\"", "\"NEWTASK\"",
+  "\"THISTASK\"", "\"DITTO\"", "\":=\"", "\"XOR (^^)\"", "\"OR (||)\"",
+  "\"AND (&&)\"", "\"__ORELSE__\"", "\"__ANDTHEN__\"", "\"=>\"", "\"=<\"",
+  "\"+=>\"", "\"+=<\"", "\"+>\"", "\"+<\"", "\"<>\"", "\"==\"", "\"<=>\"",
+  "\"#>\"", "\"<#\"", "\"//\"", "\"+/\"", "\"+//\"", "\"FRAC\"", "\"**\"",
+  "\"SCAS\"", "\"SCA (+**)\"", "\"ROR (->)\"", "\"ROL (<-)\"", "\"<<\"",
+  "\">>\"", "\"SAR (~>)\"", "\"><\"", "\"REV\"", "\"ADDBITS\"",
+  "\"ADDPINS\"", "\"-\"", "\"!\"", "\"SQRT (^^)\"", "\"ABS (||)\"",
+  "\"FSQRT\"", "\"FABS\"", "\"DECOD (|<)\"", "\">|\"", "\"ENCOD\"",
+  "\"NOT (!!)\"", "\"~~\"", "\"++\"", "\"--\"", "\"[++]\"", "\"[--]\"",
+  "\"@@\"", "\"@@@\"", "\"^@\"", "\"floating point number\"", "\"TRUNC\"",
+  "\"ROUND\"", "\"constant\"", "\"??\"", "\"empty assignment marker _\"",
+  "\"SIGNX\"", "\"ZEROX\"", "\"NAN\"", "\"ONES\"", "\"BMASK\"", "\"QLOG\"",
+  "\"QEXP\"", "\"DEBUG\"", "\": after lookup/down\"", "\"?\"",
+  "\": after ?\"", "\": after repeat\"", "\"LOG2\"", "\"EXP2\"",
+  "\"LOG10\"", "\"EXP10\"", "\"LN\"", "\"EXP\"", "\"POW\"", "\"MOVBYTS\"",
+  "\"ENDIANL\"", "\"ENDIANW\"", "\"DEBUG_END_SESSION\"", "\"OFFSETOF\"",
+  "\"+.\"", "\"-.\"", "\"*.\"", "\"%.\"", "\"<.\"", "\">.\"", "\"<>.\"",
+  "\"==.\"", "\"<=.\"", "\">=.\"", "\"float negate\"", "\"[ in DAT\"",
+  "\"] in DAT\"", "\"$$\"", "'\\\\'", "'<'", "'>'", "'-'", "'+'", "'*'",
+  "'/'", "'|'", "'^'", "'&'", "'@'", "'~'", "'?'", "'='", "'('", "')'",
+  "':'", "'['", "']'", "','", "'#'", "'!'", "'.'", "$accept", "input",
+  "rest", "emptyline", "emptylines", "topelement", "funcdef",
+  "funcdef_end", "optparamlist", "resultname", "localvars",
+  "funcbody_internal", "enter_func", "exit_func", "funcbody", "stmtlist",
+  "stmt", "basicstmt", "debug_prefix", "optdebugmask", "debug_exprlist",
+  "debug_exprlist_continue", "debug_expritem_first", "debug_expritem",
+  "asmdebug_func", "asmdebug_exprlist", "asmdebug_exprlist_continue",
+  "asmdebug_expritem_first", "asmdebug_expritem", "multiassign",
+  "compoundstmt", "stmtblock", "ifstmt", "elseblock", "casestmt",
+  "casematchlist", "casematchitem", "casematch", "matchexprlist",
+  "matchexpritem", "rangeexpritem", "rangeexprlist", "repeatstmt",
+  "lookupexpr", "lookdownexpr", "conblock", "conline", "structlist",
+  "optarray", "structitem", "ifacelist", "ifaceitem", "enumlist",
+  "enumitem", "datblock", "datline", "basedatline", "optidentifier",
+  "objblock", "objline", "optobjparams", "objparams", "objparamitem",
+  "varblock", "varline", "identlist", "identdecl", "vardecl",
+  "vardecllist", "general_type", "paramidentdecl", "paramidentlist",
+  "expr", "lhs", "lhsseq", "lhsseqcont", "lhssingle", "opt_emptysize",
+  "opt_numrets", "funccall", "expritem", "exprlist", "datexpritem",
+  "datexprlist", "optcatch", "operand", "operandlist", "range", "integer",
+  "float", "string", "identifier", "annotation", "hwreg", "instruction",
+  "instrmodifier", "modifierlist", "structname", "ptrstructname", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-1086)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-474)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     558,   -52,  -176,   137,   965,  1576,    46,   183,   102, -1086,
+   -1086, -1086,   116,   129, 17977,   156, -1086,   574,   558, -1086,
+     -45, -1086,   -93, -1086, -1086,   175,   101,    87,  -171,   150,
+     150,   150,    96,   104, -1086, -1086,    88,  1236, -1086,   136,
+      -8,    21,   150,   180,  2858,  3081,  3304,  3527,  3750, -1086,
+   -1086, -1086,  6433,  6632, 17977, 17977,  6831,   190,   203, -1086,
+     277, 17977, 17977,   289,   303,   333,  7032,    16,   316,  1371,
+   -1086, -1086, 19502, 19424,  4841,    33,    21, -1086,   344, -1086,
+     151,    94,   349, -1086,   609,   196,   308, -1086,   159,  1263,
+   -1086,   -71,   266,   297, -1086, -1086, -1086,   229,   240,   241,
+     248,   268, -1086, 17977,   276,   279,   287,   307,   315,   322,
+     330, -1086,   348,   365,   368,   373,   375,   393,   394,   399,
+   -1086,   414,   285,   419,   422,   427,   432,   -12,   434,   454,
+     462,   494,   496, -1086, -1086,  7231,  7430, 17977, 17977,  7629,
+    7828,  8027,  8226,   869,   869,   869,   210,   210, 17977, 17977,
+   17977,   501,   502,   503,   504,   869, 17977,  8425,  8624, 17977,
+   17977, 17977, 17977, 17977, 17977, 17977, 17977,   505,   506,   507,
+     508, 17977, -1086, 17977,  8823, 17977, 17977,   869, 17977,   869,
+    9022, -1086, -1086, 25844,  1510, -1086, -1086, -1086, -1086,   250,
+     305, -1086, -1086, -1086, -1086, -1086,    13, 17977, 17977,   470,
+    -154,   564,   664,   734,   739,    41, -1086,   524,    15, -1086,
+     648,   -34, -1086,   210,   -15,   -13, -1086, -1086,  -171,    21,
+   -1086, -1086, 17977,   650,    10, -1086,  3973,  4196,  4419,  4642,
+    4642,  4642,  4642, -1086, 27609, -1086,    12, -1086,    22, -1086,
+      28, -1086,    29, -1086,    31, -1086, 20044, -1086, 20158, 20272,
+   20376, -1086, 20480, -1086, -1086,   674, 20584, 20688, -1086, -1086,
+   -1086, -1086, -1086, 28337, -1086,   611, -1086, -1086, -1086,  1481,
+   -1086,  -134, 25956, -1086,    -4, -1086,     5, -1086,   210,  1762,
+   -1086, -1086, -1086, -1086, -1086,   363,   210,   603,   525,   210,
+   -1086,   527,    48,   795,    21,   750, -1086,   519,   210, -1086,
+     210,   751, -1086, -1086,   277, -1086,   277,   277,    88,    63,
+      88,   491, 17977, 17977, 17977, 17977, 17977, 19940, 17977, 17977,
+   17977, 17977, 18176, 18176, 18176, 17977, 17977, 17977, 17977, 17977,
+   17977, 18176, 18176, 18176, 17977,  4642,  4642,  4642, 18176, 17977,
+     210,   210, 17977, 17977, 17977, 17977, 18375, 17977, -1086, 17977,
+   -1086, -1086, -1086, 17977, -1086, 17977, -1086, 17977, -1086, 17977,
+   28746,   301, -1086,   301,   301, -1086, -1086, -1086, -1086, -1086,
+   17977, 17977, 17977, 17977,   301, -1086, 17977, -1086, 17977, -1086,
+   -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086,  9221, 17977,
+   17977,   668, -1086, -1086, 17977, -1086, -1086, -1086,   301, 26179,
+     130, 17977, -1086,  9420,  9619,  9818, 17977, 17977, 10017, 10216,
+   17977, 17977, 17977, 17977, 10415, 17977, 17977, 10614, 10813, 11012,
+   11211, 11410, 11609, 11808, 12007, 12206, 12405, 12604, 12803, 13002,
+   13201, 13400, 13599, 13798, 13997, 14196, 14395, 17977, 17977, 17977,
+   17977, 17977, 17977, 17977, 17977, 17977, 17977, 17977, 17977,  5239,
+   14594, 14793, 14992, 15191, 15390, 15589, 15788, 15987, 17977, 17977,
+   17977, -1086, -1086, -1086, -1086, -1086, -1086, -1086, 17977, -1086,
+   16186, 17977, -1086,    34,   210, 16385, -1086, 28337, 23019, -1086,
+   -1086, 17977, -1086,   539,   539,   539,   539,   692,   909,   210,
+     546,   539, -1086, -1086,   210, -1086, -1086, -1086, 23132, -1086,
+   -1086, 17977, -1086, 17977, -1086, 17977, -1086, -1086, -1086, -1086,
+   -1086, 17977, -1086,  4642, -1086, -1086, -1086, -1086, -1086, 17977,
+   -1086, 17977, -1086, -1086, -1086, -1086, -1086, -1086, -1086,   548,
+     549,   550, -1086,   701, -1086,   552,   551, -1086, -1086, -1086,
+     555, -1086,   576, 17977, 17977, -1086,  9221,     7, -1086,   761,
+   -1086, -1086,   714,   566, -1086, 19424, 19424,  5040, 17977, 17977,
+   17977, 17977,   719,   721, 16584, 16783,  2434, -1086, 19424, 19424,
+     572,   573, 16982, -1086,  2233, -1086, -1086,    32, -1086, -1086,
+   -1086, -1086, -1086, -1086, 20792,  1983,   687,   575, -1086,   210,
+     728, -1086,    54,   560,   588, -1086,   861,  5438, 17977, -1086,
+     210, -1086, -1086, -1086,   731,   210, -1086,   524,   524,   524,
+     -35,   210, -1086,     8, -1086,   -32,    64, 23245, 23358, 23471,
+   23584, 23697, 17977, 27713, 27817, 27921, 28025,  8823, 28337, -1086,
+     110,   581,   595,   597,   121,   223,   590, 22249,   600,   601,
+     610,   613, 26289,   236,   253,   256, 23810,   258,   272,   288,
+     293, 23923, -1086, -1086, 22563, 22677, 22791, 22905,   244, 26399,
+   28337, 28337, 28337, 28337, 28337, 28337, 26509, 26619, 26729, 26839,
+   28337, 28337,   366, 26949, 27059,   602, 28337,   670, -1086, 28337,
+   17977, 28647, 17977, 28545, 17977, 28746, 28545, 28746, 17977, 28836,
+   17977, 28836, 28836, 28836, 28836, 28836, 17977, 28836, 28836, 28836,
+   17977, 28924, 17977, 28924, 17977,  1140, 17977,  1140, 17977,  1140,
+   17977,  1140, 17977,  1140, 17977,  1140, 17977,  1140, 17977, -1086,
+   17977, -1086, 17977, -1086, 17977, -1086, 17977, -1086, 17977, -1086,
+   17977, -1086, 17977, 19411, 17977, 19411, 17977, -1086, 17977, -1086,
+   28129,   995, 28946, 28946,  1140,  1140, 28836, 28836, 28836, 28836,
+   28836, 28836, 17977, 17977, 28836, 17977, 28836, 17977, 28946, 17977,
+   28946, 17977,  1140, 17977,  1140, 17977,  2007, 17977,   995, 17977,
+    1221, 24036, 28337, 28337, 28337,   615,   377, 24149,   616,   617,
+     618, 17977, -1086, -1086,   612, 22354,   620, -1086, 24262, -1086,
+   -1086, -1086, -1086, -1086,   491, -1086,   621, -1086,   623,   774,
+   -1086, -1086, -1086,  1312, 28233, -1086, 20896, 21000,  9221,  9221,
+    9221, -1086,   776,   992,  5637, 17977, 28337, 24375, -1086, -1086,
+   -1086, -1086, -1086,   855,  1992, 19190, 17977, 17977,   786, 19628,
+      -7, 19836, 21104, 21208, 21312, -1086, -1086, -1086, 21416, -1086,
+   18176,    40, -1086,  2635, 19268, 19346, 18574, -1086, 17977, -1086,
+     631, -1086, -1086, -1086,  5836, -1086, 18773,   847, -1086, -1086,
+   -1086,   527,   903,   787, -1086, -1086,   268, -1086,   414, 17977,
+     501,    24, 17181, 18972, 17380, 28337, 24488, -1086, -1086, -1086,
+   -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086,   792, -1086,
+   -1086,   793, -1086, -1086, -1086, -1086, -1086, 19732, 17977, 17977,
+   17977, 17977,   643,   644, -1086, 18176, 17977, 17977, 17977, -1086,
+   -1086, -1086, 17977, -1086, 18176, -1086, -1086, -1086, -1086, -1086,
+   -1086,   666, -1086, -1086, -1086, -1086, -1086, 17977, 17977, 17977,
+   17977, -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086,
+     210, 17977, 28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337,
+   28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337,
+   28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337, 17977, 28836,
+   28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337, 28337, -1086,
+      91, -1086,   615, -1086, 17977, 17977, 17977,   671, 17977, 17977,
+   -1086, -1086, -1086,   210, 17977, -1086, -1086, -1086, -1086,   383,
+     415,   420, -1086,   665, -1086, -1086,   423, 28337, -1086,   675,
+   -1086, -1086, 21520, 21624,    51,   210,   786,   210, 17977,   786,
+     786,   831,   832, -1086, 26179,   447, -1086, -1086, -1086, -1086,
+     138, 24601, 24714,   847, -1086,   833,   681,   685, -1086, 18176,
+     688,   301,   694, -1086,   210,   210,   210,   210,   801, -1086,
+   -1086,   700,   210, -1086, -1086,   898,   268,   268,   241,   248,
+     268, -1086, -1086, -1086, -1086, -1086, -1086, -1086, 17977, -1086,
+     452,   463,   469,   479, 17977, 17977, -1086, 24827, 24940, 25053,
+   28337,   705, 17977, 27169, 27279, 27389, 27499,   706, 26068, 28441,
+   -1086, -1086, -1086, 25166, 25279, 25392, -1086,   709, 28337, -1086,
+   28337, -1086, -1086, -1086,   992, -1086,   859,   786,   786, 17977,
+   17977,   863, -1086,   866,  1915,   242, -1086, -1086, 17579, 17579,
+     867, -1086, -1086, -1086,   485, -1086,   868, 17778,   487,   847,
+   -1086, -1086, -1086, -1086,   210,   210,   210,   210,   903, -1086,
+   -1086, 28337, -1086, 17977, -1086, -1086, -1086, 25505, 25618, -1086,
+   -1086, -1086, -1086, 25731, -1086, -1086, -1086, -1086, -1086, 17977,
+   -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086, 21728, 21832,
+     786,   786, 17977,   870, 17977, 17977, -1086,  6035, -1086,   871,
+     -40, -1086, 22459,  6234, -1086, -1086, -1086, -1086,   718, -1086,
+   -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086, -1086,
+   -1086, -1086, 28337, -1086, -1086, -1086, -1086, 19520,   786, 21936,
+   22040, -1086, -1086,   786, -1086, 17579, 17977, -1086, 17778, 17977,
+     786, -1086,   786,   786, -1086, -1086, 28337, -1086, 22144, -1086,
+   -1086, -1086,   786, -1086
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+       0,     0,   544,     0,     0,     0,     0,     0,     0,   545,
+     142,   546,     0,     0,     0,     0,     2,     4,     0,   133,
+       0,   159,   162,     7,   143,     0,     0,     0,   544,     0,
+       0,     0,     0,     0,   234,   555,     0,     0,   225,     0,
+     239,   559,     0,     0,     0,     0,     0,     0,     0,   206,
+     548,   551,     0,     0,     0,     0,     0,     0,     0,   170,
+       0,     0,     0,     0,     0,   211,     0,     0,     0,     0,
+     166,   168,     0,     0,     0,     0,   210,   544,     0,    38,
+      27,     0,     0,    38,    27,     0,     0,   215,     0,     0,
+     213,     0,     0,     0,   539,   543,   542,     0,     0,     0,
+       0,     0,   547,     0,     0,     0,     0,     0,     0,     0,
+       0,   496,     0,     0,     0,     0,     0,     0,     0,     0,
+     418,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   540,   541,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   419,     0,     0,     0,     0,     0,     0,     0,
+       0,   437,   438,   164,   288,   390,   280,   281,   282,   441,
+     444,     1,     5,     3,   134,   135,     0,     0,     0,    24,
+     148,     0,     0,     0,     0,     0,   144,   220,     0,   235,
+       0,     0,   236,     0,     0,     0,   232,   233,     0,   558,
+     226,   231,     0,     0,     0,   171,     0,     0,     0,     0,
+       0,     0,     0,   172,   518,   527,     0,   174,     0,   180,
+       0,   176,     0,   178,     0,   192,     0,   195,     0,     0,
+       0,   201,     0,   190,   191,     0,     0,     0,   188,   189,
+     212,   209,   207,   208,   203,     0,   549,   167,   169,     0,
+     182,   529,   531,   535,     0,   552,     0,   550,     0,     0,
+      26,   253,   254,   255,   256,     0,     0,     0,    31,     0,
+     276,    29,   258,     0,   257,     0,    38,    27,     0,    26,
+       0,     0,    38,   216,     0,   214,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   403,     0,
+     400,   402,   399,     0,   405,     0,   407,     0,   408,     0,
+     397,   431,   441,   422,   423,   442,   443,   290,   291,   292,
+       0,     0,     0,     0,   425,   413,     0,   414,     0,   416,
+     411,   412,   501,   502,   503,   504,   505,   506,     0,     0,
+       0,     0,   392,   389,     0,   391,   393,   289,   430,     0,
+       0,     0,   394,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   428,   427,   420,   421,   467,   468,   424,     0,   426,
+       0,     0,   429,     0,     0,     0,   160,   161,     0,     6,
+       8,     0,   149,   148,   148,   148,   148,     0,     0,     0,
+       0,   148,   556,   227,     0,   237,   228,   229,     0,   557,
+     230,     0,   522,     0,   521,     0,   520,   524,   523,   525,
+     526,     0,   173,     0,   175,   181,   177,   179,   193,     0,
+     196,     0,   198,   199,   200,   202,   186,   187,    81,     0,
+       0,     0,    72,     0,    84,     0,    76,    80,    83,    82,
+       0,   530,   529,     0,     0,   183,     0,     0,   184,     0,
+     553,    26,     0,     0,   128,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    45,     0,     0,
+     477,    61,     0,    39,     0,    41,    43,     0,    52,    44,
+      89,    87,    90,    88,     0,   288,     0,     0,    14,     0,
+       0,    28,     0,     0,    33,   261,     0,     0,     0,   277,
+       0,    26,    26,    15,     0,     0,    26,   220,   220,   220,
+       0,     0,   157,     0,   155,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   510,   516,
+       0,   280,   281,   282,     0,     0,     0,   110,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   454,   453,     0,     0,     0,     0,     0,     0,
+     404,   401,   406,   409,   410,   398,     0,     0,     0,     0,
+     415,   417,     0,     0,     0,     0,   396,   388,   449,   395,
+       0,   345,     0,   344,     0,   343,   342,   341,     0,   305,
+       0,   306,   307,   308,   309,   310,     0,   311,   312,   313,
+       0,   328,     0,   329,     0,   321,     0,   322,     0,   323,
+       0,   327,     0,   324,     0,   325,     0,   326,     0,   337,
+       0,   336,     0,   338,     0,   339,     0,   340,     0,   332,
+       0,   333,     0,   334,     0,   335,     0,   331,     0,   330,
+       0,   350,   346,   347,   348,   349,   317,   316,   315,   314,
+     319,   318,     0,     0,   304,     0,   303,     0,   297,     0,
+     296,     0,   298,     0,   299,     0,   301,     0,   302,     0,
+     300,     0,   440,   293,   295,   478,     0,     0,   459,   461,
+     463,     0,   465,   294,     0,   537,     0,   163,     0,   150,
+     151,   152,   153,   136,     0,   145,   221,   222,     0,     0,
+     154,   238,   240,   288,     0,   528,     0,     0,     0,     0,
+       0,   204,     0,     0,     0,     0,   532,     0,   536,   185,
+     554,    18,    46,     0,     0,     0,     0,     0,     0,     0,
+     441,     0,     0,     0,     0,    54,    55,    50,     0,    47,
+       0,     0,    92,     0,     0,     0,     0,   474,     0,    59,
+       0,    40,    42,    56,     0,    53,     0,     0,   262,    23,
+      30,    32,     0,     0,   279,   278,   263,   267,   274,   275,
+     269,     0,     0,     0,     0,   260,     0,    26,    16,    19,
+      22,    26,    17,   218,   219,   217,   141,    26,     0,   156,
+     140,     0,   450,   451,   455,   456,   457,     0,     0,     0,
+       0,     0,   280,   281,   488,     0,     0,     0,     0,   489,
+     495,   484,     0,   487,     0,   485,   486,   433,   490,   491,
+     283,   448,   285,   286,   287,   284,   452,     0,     0,     0,
+       0,   492,   493,   434,   436,   435,   432,   509,   507,   508,
+       0,     0,   380,   379,   378,   384,   383,   385,   365,   366,
+     358,   359,   360,   364,   361,   363,   362,   374,   373,   375,
+     376,   377,   369,   370,   371,   372,   368,   367,     0,   320,
+     381,   382,   352,   351,   354,   353,   356,   357,   355,   165,
+       0,   482,   478,   466,     0,     0,     0,     0,     0,     0,
+     445,   147,   146,     0,     0,   139,   519,   194,   197,     0,
+       0,     0,   205,    77,    78,    71,     0,   533,   534,     0,
+     127,   126,     0,     0,   114,     0,     0,     0,     0,     0,
+       0,     0,     0,    51,   510,     0,    49,    91,   124,   125,
+       0,     0,     0,     0,    66,     0,     0,    62,    67,     0,
+      86,   473,   470,   471,     0,     0,     0,     0,     0,   241,
+     251,    34,     0,    25,   266,     0,   264,   265,   273,   272,
+     271,   270,   259,    20,    21,   158,   137,   138,     0,   112,
+       0,     0,     0,     0,     0,     0,   517,     0,     0,     0,
+     111,     0,     0,     0,     0,     0,     0,     0,     0,   387,
+     479,   480,   481,     0,     0,     0,   464,     0,   538,   223,
+     224,    73,    74,    75,     0,    70,     0,     0,     0,     0,
+       0,     0,   123,     0,     0,    95,    93,    94,     0,     0,
+       0,   476,   475,    60,     0,    57,     0,     0,     0,     0,
+     242,   244,   246,   248,     0,     0,     0,     0,     0,   250,
+     268,   439,   132,     0,   131,   130,   129,     0,     0,   511,
+     512,   515,   483,     0,   500,   497,   498,   499,   494,     0,
+     458,   460,   462,   446,    79,    36,   117,   118,     0,     0,
+       0,     0,     0,     0,     0,     0,   107,     0,   101,     0,
+       0,   105,   109,     0,    48,   469,    58,    68,    63,    64,
+      69,    85,   472,   243,   245,   247,   249,   252,   113,   513,
+     514,   447,   386,   115,   116,   122,   121,     0,     0,     0,
+       0,    99,   102,     0,   104,     0,     0,   100,     0,     0,
+       0,    96,     0,     0,   103,   106,   108,    65,     0,   120,
+      97,    98,     0,   119
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+   -1086, -1086,   214, -1086, -1086, -1086,    -1,  -280, -1086, -1086,
+   -1086, -1086, -1086, -1086,   -69,   385,  -563, -1086, -1086, -1086,
+   -1086, -1086, -1086,  -266, -1086, -1086, -1086, -1086,  -801, -1086,
+   -1086,  -232, -1086,  -970, -1086,  -166, -1085, -1086, -1086,  -259,
+    -324,  -345, -1086, -1086, -1086,   954,   113,   647,   154,  -471,
+   -1086,   347, -1086,   766,   -60,   -59,   891, -1086, -1086,   876,
+     -31, -1086,   -20, -1086,   941,   321,    74,  -156, -1086,   698,
+    -269,  -256,   -14,    61, -1086,   -54,  -564, -1086,    14, -1086,
+    -839,  -303,  -159,    11,   450,   443,  -361,  -758,   440,   340,
+     195,  1146,  1041, -1086,   918,   -67,   720,   165,  -853
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    15,    16,   480,   199,    17,    79,   588,   288,   594,
+     863,   573,   279,   851,   280,   574,   575,   576,   577,   849,
+    1036,  1188,  1037,  1189,   534,   535,  1003,   536,   537,   578,
+     579,   580,   581,  1116,   582,  1177,  1178,  1179,  1180,  1181,
+    1069,  1070,   583,   181,   182,    18,    19,   205,   482,   206,
+     613,   614,    20,    21,    69,    70,    71,   261,    89,    90,
+     490,   796,   797,    37,    38,   211,   212,  1050,  1051,   289,
+     290,   291,   234,   184,   586,  1042,   587,   847,   981,   185,
+     629,   630,   235,   236,   543,   273,   274,   786,   186,   187,
+     188,   189,   293,   190,    74,    75,   276,    76,    42
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     183,   636,   638,   639,   640,   641,    83,   275,   850,  1052,
+     267,   852,  1004,   269,   299,  1038,    77,   795,   491,   603,
+     634,   635,   611,   987,   599,    51,    24,   672,   643,   644,
+     645,   592,  1018,   195,    51,   650,    51,    77,   246,   248,
+     249,   250,   252,   886,   493,  1054,   890,   256,   257,    77,
+    1117,    25,   263,   778,   779,   780,   238,   240,   242,   244,
+     272,    50,    51,   496,   210,   497,  1076,   502,   504,   506,
+     507,   508,   509,   510,   545,  1081,   481,   611,    39,   541,
+     296,   210,    91,   548,   302,   819,   612,     9,   500,   317,
+     512,   218,  1212,  1109,   264,  1110,  1090,    77,  1212,   542,
+     514,    -9,     1,    86,     2,    77,   515,   516,     9,   517,
+     853,    39,    -9,    -9,    -9,    -9,    -9,    -9,  1026,    92,
+       9,   348,   350,   351,   352,   354,   356,   358,   360,    78,
+      11,   194,    93,   197,   367,   368,   369,   198,     1,   194,
+       2,   612,   375,   377,   379,   380,   381,   382,   383,   384,
+     385,   386,   387,    77,    28,   306,   191,   392,   307,   393,
+     395,   396,   397,    91,   399,   209,   402,   776,     9,    41,
+     281,   282,   283,   284,   216,     9,     9,   295,   200,    10,
+      87,    95,   217,   477,   478,    -9,    77,   196,    35,  1214,
+     208,  1091,  1215,    12,   201,   202,   203,   204,   494,    77,
+     223,   219,    41,   223,   361,   363,   364,   275,   498,   550,
+     267,     9,    13,    77,   221,    10,   374,   494,   339,   494,
+     207,   340,   222,   341,     9,     9,   474,   601,   546,    12,
+    1097,   192,   193,   606,    11,    11,   888,   549,   398,   549,
+     400,  1055,   494,   265,   513,   294,    14,    68,    13,   294,
+     223,    35,  1230,  1231,   513,   255,   223,     9,   225,   854,
+     513,   513,   841,   513,   781,   584,    82,    11,   253,   487,
+       9,   821,   905,   488,   597,    35,    88,   551,   598,   301,
+     852,   254,   860,    95,     9,  1052,   596,   495,  1190,  1173,
+    1174,  1175,   891,  1043,   465,   466,   488,   602,   617,   618,
+     619,   620,   621,  1164,   623,   624,   625,   626,   628,   628,
+     628,   637,   637,   637,   637,   637,   642,   628,   628,   628,
+     646,   878,   879,   992,   628,   651,   882,   865,   654,   655,
+     656,   657,   659,   660,    14,   661,   260,   861,   904,   662,
+     585,   663,   905,   664,   266,   665,   647,   648,   649,   909,
+     278,   214,   215,   905,   805,   298,   666,   667,   668,   669,
+     471,   678,   670,   224,   671,   473,   218,   258,   339,  1121,
+      14,   340,   285,   341,   272,   673,   674,   286,   287,  1190,
+     676,   259,   281,   282,   283,   284,   303,   679,   304,   681,
+     683,   685,   686,   687,   689,   691,   692,   693,   694,   695,
+     697,   698,   699,   701,   703,   705,   707,   709,   711,   713,
+     715,   717,   719,   721,   723,   725,   727,   729,   731,   733,
+     735,   737,   739,   740,   741,   742,   743,   744,   745,   746,
+     747,   748,   749,   750,   751,   754,   756,   758,   760,   762,
+     764,   766,   768,   770,   771,   772,   773,   999,  1000,  1001,
+     294,   910,   294,  1006,   774,   905,   628,   777,   294,   312,
+     539,   785,   294,    35,   918,   465,   466,   788,   905,  1043,
+     313,   314,   931,   610,   339,   615,   208,   340,   315,   341,
+     550,   919,   820,   474,   920,   905,   922,   619,   905,   620,
+     513,   621,   308,   309,   200,   824,   825,   804,   316,   607,
+     923,   608,   609,   318,   513,   806,   319,   807,   844,   845,
+     201,   202,   203,   204,   320,   334,   924,   633,   633,   633,
+     513,   925,    28,   310,   311,   905,   633,   633,   633,   816,
+     817,   471,   272,   633,   321,   475,   473,  1025,   281,   282,
+     283,   284,   322,   829,   831,   832,   833,   834,   479,   323,
+     838,   628,   584,  1040,  1071,  1072,  1073,   324,   399,     1,
+     584,     2,   803,    28,   803,  1192,   803,   483,   801,     3,
+       4,     5,     6,     7,     8,   325,   883,   884,   885,   281,
+     282,   283,   284,   875,   876,     3,     4,     5,     6,     7,
+       8,    35,   326,     9,   937,   327,  1014,  1063,   546,   877,
+     328,  1064,   329,    11,   881,   982,    28,  1065,   897,   905,
+     887,  1101,    28,   395,    77,   546,    94,    95,   528,    35,
+     330,   331,   281,   282,   283,   284,   332,   585,   281,   282,
+     283,   284,     9,   585,     9,   585,    10,   789,   790,   791,
+     792,   333,    11,  1102,    11,   800,   335,   546,  1103,   336,
+      12,  1105,   546,   208,   337,   546,   529,   530,    11,   338,
+      35,   342,   632,   632,   632,   633,   942,   484,   943,    13,
+     944,   632,   632,   632,   945,  1120,   946,     9,   632,   905,
+    1142,   343,   947,     9,  1143,     9,   948,    11,   949,   344,
+     950,  1144,   951,    11,   952,  1143,   953,  1145,   954,   531,
+     955,  1143,   956,    35,   957,   538,   958,  1146,   959,    35,
+     960,  1143,   961,  1185,   962,  1191,   963,  1129,   964,   905,
+     965,   345,   966,   346,   967,   532,   133,   134,   370,   371,
+     372,   373,   388,   389,   390,   391,  1128,   485,   969,   970,
+     285,   971,   486,   972,   489,   973,   287,   974,   492,   975,
+     499,   976,   525,   977,   593,   978,   600,   605,   294,   596,
+     633,   294,   631,   631,   631,   267,   267,   785,   675,   481,
+     793,   631,   631,   631,   799,   808,   809,   810,   631,   811,
+     812,   285,   814,   813,  1112,   267,   267,  1115,  1115,   541,
+      51,    14,   822,   823,   272,   272,   272,   835,    28,   836,
+     272,  1007,   846,   848,   218,   856,   859,   857,   862,   880,
+     632,   906,  1012,  1013,   281,   282,   283,   284,   911,  1198,
+    1134,  1135,  1136,  1137,   285,   907,  1024,   908,   913,   584,
+     285,   591,  1031,   914,  1032,   300,   287,   940,   915,   533,
+     628,   916,   628,   941,   980,   988,   984,   985,   986,   994,
+      77,   990,   995,   993,  1002,   368,    97,    98,   395,   396,
+     397,  1009,   566,  1033,    28,  1053,    99,   100,   101,     9,
+    1066,  1067,    77,  1074,  1075,  1166,  1167,   102,    97,    98,
+     281,   282,   283,   284,   637,   637,   637,   637,    99,   100,
+     101,   628,  1077,  1078,  1079,    35,  1082,  1104,  1080,   102,
+     628,    35,  1096,  1106,   585,   632,    28,  1118,  1119,  1126,
+     631,  1125,   200,  1083,  1084,  1085,  1086,  1127,  1041,  1140,
+     905,     9,  1044,  1045,  1046,  1047,  1129,  1088,   201,   202,
+     203,   204,  1138,  1152,  1158,     9,  1049,  1165,  1205,  1206,
+    1163,  1170,   122,     9,  1171,  1184,  1186,   127,  1208,  1213,
+    1218,   843,  1227,  1183,  1089,   864,  1225,    26,   616,   208,
+     889,    35,   476,   268,   122,   305,    27,   903,    28,   127,
+    1093,  1094,  1095,  1099,   785,  1098,  1221,     9,   220,  1124,
+    1100,  1224,  1197,   589,    29,    30,    31,   794,  1229,   818,
+    1115,  1115,   815,   277,   547,    77,  1092,    94,    95,   528,
+    1233,    32,    33,    35,  1114,   631,     0,     0,   539,    35,
+       0,   146,   147,     0,     0,     0,   285,     0,     0,     0,
+       0,   570,     0,     0,     0,  1024,     0,    41,     0,     0,
+       0,     0,     0,   146,   147,   633,     0,   529,   530,     9,
+       0,    23,     0,    34,     0,     0,    73,    81,    85,   633,
+       0,   633,     0,     0,  1141,     0,     0,     0,    23,    23,
+    1147,  1148,     0,     0,     0,    35,     9,   902,  1153,     0,
+     213,   213,   213,     0,     0,     0,     0,   179,     0,     0,
+     531,     0,   285,   213,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  1041,  1168,  1169,     0,     0,   179,
+     633,     0,     0,     0,  1182,  1182,   532,   133,   134,   633,
+       0,     0,     0,   628,     0,     0,     0,     0,  1130,  1131,
+    1132,  1133,     0,     0,  1048,     0,  1139,     0,     0,   637,
+       0,     0,     0,     0,     0,     0,     0,   426,   427,   428,
+     429,   430,   431,   432,     0,  1202,    22,     0,     0,    22,
+      40,    72,    80,    84,    40,     0,     0,     0,  1207,     0,
+    1209,  1210,     0,  1182,    22,     0,     0,     0,     0,  1182,
+     435,   436,    22,     0,     0,    40,    40,    40,     0,     0,
+     632,     0,     0,    40,     0,     0,    36,     0,    40,     0,
+    1041,     0,     0,     0,   632,     0,   632,     0,     0,     0,
+       0,  1182,  1226,     0,   628,  1228,     0,     0,  1193,  1194,
+    1195,  1196,  1049,   219,     0,    72,     0,   457,     0,    72,
+       0,     0,     0,     0,     0,     0,   292,   297,     0,     0,
+     292,   297,     0,     0,   633,    40,   -12,    27,     0,    28,
+       0,     0,     0,     0,     0,   632,     0,   -12,   -12,   -12,
+     -12,   -12,   -12,   538,   632,    29,    30,    31,     0,     0,
+       0,     0,     0,   -13,    86,     0,    77,     0,     0,     0,
+       0,     0,    32,    33,   -13,   -13,   -13,   -13,   -13,   -13,
+     631,     0,   426,   427,   428,   429,   430,   431,   432,   362,
+     362,   362,   365,   366,   631,     0,   631,     0,     0,   539,
+       0,   362,     0,    41,     0,     0,     0,     0,     0,     0,
+       9,     0,     0,     0,    34,   435,   436,     0,     0,     0,
+     -12,     0,   633,   362,     0,   362,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,    35,     9,     0,     0,
+       0,    87,    22,     0,     0,   631,     0,   -13,     0,     0,
+       0,     0,     0,     0,   631,     0,     0,     0,     0,    40,
+     455,   456,   457,   426,   427,   428,   429,   430,   431,   432,
+       0,   -10,    43,     0,    28,     0,     0,     0,     0,   632,
+       0,     0,   -10,   -10,   -10,   -10,   -10,   -10,     0,     0,
+      44,    45,    46,     0,    47,    48,   435,   436,    49,    50,
+      51,     0,    52,    53,    54,    55,    56,    57,    58,     0,
+       0,   540,     0,   633,     0,    72,     0,     0,     0,     0,
+       0,     0,     0,     0,   297,   459,     0,     0,     0,     0,
+     460,     0,   590,   292,     0,   595,     0,    88,     0,   292,
+       0,     0,     0,   292,   297,     9,   604,     0,     0,    59,
+       0,     0,     0,     0,    60,   -10,     0,    36,     0,    61,
+      62,    63,    64,     0,    65,     0,     0,   632,     0,     0,
+       0,    35,   461,   462,   463,   464,   465,   466,     0,   631,
+       0,   -11,    43,     0,    28,   467,   652,   653,    66,     0,
+       0,     0,   -11,   -11,   -11,   -11,   -11,   -11,     0,     0,
+      44,    45,    46,     0,    47,    48,     0,     0,    49,    50,
+      51,     0,    52,    53,    54,    55,    56,    57,    58,     0,
+       0,     0,     0,     0,     0,   468,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   469,     0,     0,   470,
+       0,     0,   471,   678,   538,     0,   472,   473,     0,     0,
+       0,     0,     0,    67,     0,     9,     0,     0,   632,    59,
+       0,     0,     0,     0,    60,   -11,     0,   631,     0,    61,
+      62,    63,    64,     0,    65,     0,     0,    43,     0,    28,
+       0,    35,     0,     0,     0,    68,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    44,    45,    46,    66,    47,
+      48,     0,     0,    49,    50,    51,     0,    52,    53,    54,
+      55,    56,    57,    58,     0,     0,     0,     0,     0,   782,
+     783,     0,     0,   459,     0,     0,     0,     0,   460,     0,
+       0,     0,     0,     0,     0,   798,     0,     0,     0,     0,
+      40,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       9,     0,     0,     0,    59,     0,     0,     0,   631,    60,
+      11,     0,     0,    67,    61,    62,    63,    64,     0,    65,
+     461,   462,   463,   464,   465,   466,    35,     0,     0,     0,
+       0,     0,     0,   467,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    66,     0,    68,     0,     0,     0,     0,
+       0,    72,    72,   830,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    72,    72,     0,     0,     0,     0,
+       0,     0,     0,   468,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   469,   858,     0,   470,     0,   292,
+     471,     0,   292,     0,   472,   473,   297,     0,     0,     0,
+       0,   297,     0,     0,     0,     0,     0,   297,    67,     0,
+       0,     0,   -35,   552,     0,    77,   553,    94,    95,     0,
+      96,    97,    98,   -35,   -35,   -35,   -35,   -35,   -35,     0,
+     554,    99,   100,   101,     0,     0,     0,     0,     0,     0,
+      68,     0,   102,   555,   556,     0,     0,     0,     0,     0,
+     557,     0,     0,     0,     0,     0,     0,   558,   559,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,   560,   561,     0,
+     562,   563,   117,   118,   119,   564,     9,   565,   566,     0,
+     567,     0,     0,   120,   121,     0,   -35,   568,   569,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   570,     0,     0,   156,
+     157,   158,   159,   160,   571,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,  1172,   167,   168,   169,   540,
+     170,     0,   171,     0,     0,     0,     0,     0,     0,     0,
+      72,    72,     0,     0,   172,   173,     0,     0,   174,   175,
+       0,     0,     0,     0,     0,   176,   177,     0,     0,   572,
+      72,    72,   179,    43,     0,    28,   180,     0,     0,     0,
+       0,     0,     0,   362,     0,     0,     0,     0,    40,  1010,
+       0,    44,    45,    46,     0,    47,    48,     0,     0,    49,
+      50,    51,     0,    52,    53,    54,    55,    56,    57,    58,
+       0,     0,     0,     0,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     9,     0,     0,     0,
+      59,     0,     0,     0,     0,    60,     0,     0,     0,     0,
+      61,    62,    63,    64,     0,    65,  1087,     0,     0,     0,
+     435,   436,    35,     0,     0,     0,   459,     0,     0,   437,
+       0,   460,     0,     0,     0,     0,     0,     0,   438,    66,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,     0,   798,
+       0,     0,     0,   461,   462,   463,   464,   465,   466,   426,
+     427,   428,   429,   430,   431,   432,   467,     0,     0,     0,
+       0,  1111,     0,  1113,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    67,     0,     0,     0,     0,   362,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+      40,    40,    40,    40,     0,     0,   468,     0,    40,     0,
+     438,     0,     0,     0,     0,     0,    68,   469,     0,     0,
+     470,     0,     0,   471,     0,  -473,     0,   472,   473,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   456,   457,
+       0,     0,     0,   -37,   552,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,   -37,   -37,   -37,   -37,   -37,   -37,
+     540,   554,    99,   100,   101,     0,     0,     0,     0,     0,
+       0,     0,     0,   102,   555,   556,     0,     0,     0,     0,
+       0,   557,     0,     0,     0,   362,     0,     0,   558,   559,
+      40,    40,    40,    40,    40,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   560,   561,
+       0,   562,   563,   117,   118,   119,   564,     9,   565,   566,
+       0,   567,     0,     0,   120,   121,     0,   -37,   568,   569,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,   570,     0,     0,
+     156,   157,   158,   159,   160,   571,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,   552,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,   172,   173,     0,     0,   174,
+     175,     0,   554,    99,   100,   101,   176,   177,     0,     0,
+     572,     0,     0,   179,   102,   555,   556,   180,     0,     0,
+       0,     0,   557,     0,     0,     0,     0,     0,     0,   558,
+     559,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   560,
+     561,     0,   562,   563,   117,   118,   119,   564,     9,   565,
+     566,   842,   567,     0,     0,   120,   121,     0,     0,   568,
+     569,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   570,     0,
+       0,   156,   157,   158,   159,   160,   571,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,   552,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,   172,   173,     0,     0,
+     174,   175,     0,   554,    99,   100,   101,   176,   177,     0,
+       0,   572,     0,     0,   179,   102,   555,   556,   180,     0,
+       0,     0,     0,   557,     0,     0,     0,     0,     0,     0,
+     558,   559,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+     560,   561,     0,   562,   563,   117,   118,   119,   564,     9,
+     565,   566,  1027,   567,     0,     0,   120,   121,     0,     0,
+     568,   569,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   570,
+       0,     0,   156,   157,   158,   159,   160,   571,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   172,   173,     0,
+       0,   174,   175,     0,     0,     0,     0,     0,   176,   177,
+       0,    77,   572,    94,    95,   179,    96,    97,    98,   180,
+       0,     0,     0,     0,     0,     0,     0,   226,   227,   228,
+       0,   229,   230,   231,   232,     0,     0,     0,   102,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,   233,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     172,   173,     0,     0,   174,   175,     0,     0,     0,     0,
+       0,   176,   177,     0,    77,   178,    94,    95,   179,    96,
+      97,    98,   180,     0,     0,     0,     0,     0,     0,     0,
+     226,   227,   228,     0,   229,   230,   231,   232,     0,     0,
+       0,   102,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,   237,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   172,   173,     0,     0,   174,   175,     0,
+       0,     0,     0,     0,   176,   177,     0,    77,   178,    94,
+      95,   179,    96,    97,    98,   180,     0,     0,     0,     0,
+       0,     0,     0,   226,   227,   228,     0,   229,   230,   231,
+     232,     0,     0,     0,   102,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,   239,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   172,   173,     0,     0,
+     174,   175,     0,     0,     0,     0,     0,   176,   177,     0,
+      77,   178,    94,    95,   179,    96,    97,    98,   180,     0,
+       0,     0,     0,     0,     0,     0,   226,   227,   228,     0,
+     229,   230,   231,   232,     0,     0,     0,   102,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,   241,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   172,
+     173,     0,     0,   174,   175,     0,     0,     0,     0,     0,
+     176,   177,     0,    77,   178,    94,    95,   179,    96,    97,
+      98,   180,     0,     0,     0,     0,     0,     0,     0,   226,
+     227,   228,     0,   229,   230,   231,   232,     0,     0,     0,
+     102,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,   243,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   172,   173,     0,     0,   174,   175,     0,     0,
+       0,     0,     0,   176,   177,     0,    77,   178,    94,    95,
+     179,    96,    97,    98,   180,     0,     0,     0,     0,     0,
+       0,     0,   226,   227,   228,     0,   229,   230,   231,   232,
+       0,     0,     0,   102,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   172,   173,     0,     0,   174,
+     175,     0,     0,     0,     0,     0,   176,   177,     0,    77,
+     178,    94,    95,   501,    96,    97,    98,   180,     0,     0,
+       0,     0,     0,     0,     0,   226,   227,   228,     0,   229,
+     230,   231,   232,     0,     0,     0,   102,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   172,   173,
+       0,     0,   174,   175,     0,     0,     0,     0,     0,   176,
+     177,     0,    77,   178,    94,    95,   503,    96,    97,    98,
+     180,     0,     0,     0,     0,     0,     0,     0,   226,   227,
+     228,     0,   229,   230,   231,   232,     0,     0,     0,   102,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   172,   173,     0,     0,   174,   175,     0,     0,     0,
+       0,     0,   176,   177,     0,    77,   178,    94,    95,   505,
+      96,    97,    98,   180,     0,     0,     0,     0,     0,     0,
+       0,   226,   227,   228,     0,   229,   230,   231,   232,     0,
+       0,     0,   102,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,     0,   178,
+      51,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,   270,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,     0,   178,     0,
+     102,   179,     0,     0,   271,   180,     0,     0,     0,     0,
+       0,     0,   826,     0,   827,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,   828,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,     0,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,   752,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   866,
+     867,     0,   176,   177,     0,   753,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     868,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   869,   150,   870,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,   871,   872,   873,    99,   100,   101,     0,
+       0,   874,   177,     0,     0,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,  1034,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,     0,   178,  1005,   102,   179,     0,     0,
+     271,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   627,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,     0,   178,  1035,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,  1176,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,  1211,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,     0,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,  1176,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,  1217,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+       0,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,   245,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   174,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,     0,
+     178,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+     247,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,     0,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,   251,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,     0,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,   172,   173,     0,     0,   174,   175,   262,
+       0,    99,   100,   101,   176,   177,     0,     0,   178,     0,
+       0,   179,   102,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,     0,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,   347,   178,     0,
+     102,   179,     0,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,   349,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,   353,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   174,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,   355,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,   357,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   174,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,   359,   178,     0,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,   376,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+     378,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   174,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,   394,
+     178,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,   401,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,     0,   178,     0,
+     102,   179,     0,     0,   271,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,   680,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,   682,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   174,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,   684,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,   688,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   174,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,   690,   178,     0,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,   696,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+     700,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   174,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,   702,
+     178,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,   704,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,   706,   178,     0,
+     102,   179,     0,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,   708,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,   710,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   174,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,   712,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,   714,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   174,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,   716,   178,     0,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,   718,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+     720,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   174,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,   722,
+     178,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,   724,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,   726,   178,     0,
+     102,   179,     0,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,   728,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,   730,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   174,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,   732,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,   734,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   174,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,   736,   178,     0,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,   738,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+     755,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   174,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,   757,
+     178,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,   101,     0,     0,   176,   177,     0,   759,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,    99,
+     100,   101,     0,     0,   176,   177,     0,   761,   178,     0,
+     102,   179,     0,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,   763,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,     0,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,     0,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,   765,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   174,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,   767,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,   769,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   627,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,     0,   178,   775,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   127,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,     0,   178,     0,   102,   179,     0,     0,   784,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,   837,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,   127,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+       0,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,   839,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   627,
+     175,    99,   100,   101,     0,     0,   176,   177,     0,     0,
+     840,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   570,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,    77,     0,    94,    95,     0,    96,
+      97,    98,     0,     0,   172,   173,     0,     0,   174,   175,
+      99,   100,  1056,     0,     0,   176,   177,     0,     0,   178,
+       0,   102,   179,     0,     0,     0,   180,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   103,     0,     0,     0,
+       0,     0,     0,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,     0,     0,     0,     0,
+       0,   117,   118,   119,     0,     9,     0,     0,     0,     0,
+       0,     0,   120,   121,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   122,   123,   124,   125,
+     126,   127,     0,     0,     0,     0,     0,     0,   128,   129,
+     130,   131,     0,   132,     0,     0,   133,   134,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+     151,   152,   153,   154,   155,     0,     0,     0,   156,   157,
+     158,   159,   160,     0,     0,     0,     0,     0,   161,   162,
+     163,   164,   165,   166,     0,   167,   168,   169,     0,   170,
+       0,   171,     0,    77,     0,    94,    95,     0,    96,    97,
+      98,     0,     0,   172,   173,     0,     0,   174,   175,  1058,
+    1059,  1060,  1061,     0,   176,   177,     0,   394,   178,     0,
+     102,   179,     0,     0,     0,   180,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   103,     0,     0,     0,     0,
+       0,     0,   104,   105,   106,   107,   108,   109,   110,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+     117,   118,   119,     0,     9,     0,     0,     0,     0,     0,
+       0,   120,   121,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   122,   123,   124,   125,   126,
+     127,     0,     0,     0,     0,     0,     0,   128,   129,   130,
+     131,     0,   132,     0,     0,   133,   134,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,     0,     0,     0,   156,   157,   158,
+     159,   160,     0,     0,     0,     0,     0,   161,   162,   163,
+     164,   165,   166,     0,   167,   168,   169,     0,   170,     0,
+     171,     0,    77,     0,    94,    95,     0,    96,    97,    98,
+       0,     0,   172,   173,     0,     0,   174,   175,    99,   100,
+     101,     0,     0,   176,   177,     0,     0,   178,     0,   102,
+     179,     0,     0,     0,   180,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   103,     0,     0,     0,     0,     0,
+       0,   104,   105,   106,   107,   108,   109,   110,   111,   112,
+     113,   114,   115,   116,     0,     0,  1176,     0,     0,   117,
+     118,   119,     0,     9,     0,     0,     0,     0,     0,     0,
+     120,   121,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   122,   123,   124,   125,   126,   127,
+       0,     0,     0,     0,     0,     0,   128,   129,   130,   131,
+       0,   132,     0,     0,   133,   134,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
+     153,   154,   155,     0,     0,     0,   156,   157,   158,   159,
+     160,     0,     0,     0,     0,     0,   161,   162,   163,   164,
+     165,   166,     0,   167,   168,   169,     0,   170,     0,   171,
+       0,    77,     0,    94,    95,  1187,    96,    97,    98,     0,
+       0,   172,   173,     0,     0,   174,   175,    99,   100,   101,
+       0,     0,   176,   177,     0,     0,   178,     0,   102,   179,
+       0,     0,     0,   180,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   103,     0,     0,     0,     0,     0,     0,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,     0,     0,     0,     0,     0,   117,   118,
+     119,     0,     9,     0,     0,     0,     0,     0,     0,   120,
+     121,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   122,   123,   124,   125,   126,   127,     0,
+       0,     0,     0,     0,     0,   128,   129,   130,   131,     0,
+     132,     0,     0,   133,   134,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,     0,     0,     0,   156,   157,   158,   159,   160,
+       0,     0,     0,     0,     0,   161,   162,   163,   164,   165,
+     166,     0,   167,   168,   169,     0,   170,     0,   171,     0,
+      77,     0,    94,    95,     0,    96,    97,    98,     0,     0,
+     172,   173,     0,     0,   627,   175,    99,   100,   101,     0,
+       0,   176,   177,     0,     0,   178,     0,   102,   179,     0,
+       0,     0,   180,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   103,     0,     0,     0,     0,     0,     0,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,     0,     0,     0,     0,     0,   117,   118,   119,
+       0,     9,     0,     0,     0,     0,     0,     0,   120,   121,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   122,   123,   124,   125,   126,   127,     0,     0,
+       0,     0,     0,     0,   128,   129,   130,   131,     0,   132,
+       0,     0,   133,   134,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,     0,     0,     0,   156,   157,   158,   159,   160,     0,
+       0,     0,     0,     0,   161,   162,   163,   164,   165,   166,
+       0,   167,   168,   169,     0,   170,     0,   171,     0,    77,
+       0,    94,    95,     0,    96,    97,    98,     0,     0,   172,
+     173,     0,     0,   174,   175,    99,   100,   101,     0,     0,
+     176,   177,     0,     0,   178,     0,   102,   179,     0,     0,
+       0,   180,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   103,     0,     0,     0,     0,     0,     0,   104,   105,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,   117,   118,   119,     0,
+       9,     0,     0,     0,     0,     0,     0,   120,   121,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123,   124,   125,   126,   127,     0,     0,     0,
+       0,     0,     0,   128,   129,   130,   131,     0,   132,     0,
+       0,   133,   134,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
+       0,     0,     0,   156,   157,   158,   159,   160,     0,     0,
+       0,     0,     0,   161,   162,   163,   164,   165,   166,     0,
+     167,   168,   169,     0,   170,     0,   171,     0,    77,     0,
+      94,    95,     0,    96,    97,    98,     0,     0,   172,   173,
+       0,     0,   627,   175,    99,   100,   101,     0,     0,   176,
+     177,     0,     0,   178,     0,   102,   179,     0,     0,     0,
+     180,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     103,     0,     0,     0,     0,     0,     0,   104,   105,   106,
+     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
+       0,     0,     0,     0,     0,   117,   118,   119,     0,     9,
+       0,     0,     0,     0,     0,     0,   120,   121,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,   124,   125,   126,   658,     0,     0,     0,     0,
+       0,     0,   128,   129,   130,   131,     0,   132,     0,     0,
+     133,   134,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,     0,
+       0,     0,   156,   157,   158,   159,   160,     0,     0,     0,
+       0,     0,   161,   162,   163,   164,   165,   166,     0,   167,
+     168,   169,     0,   170,     0,   171,     0,    77,     0,    94,
+      95,     0,    96,    97,    98,     0,     0,   172,   173,     0,
+       0,   174,   175,    99,   100,   101,     0,     0,   176,   177,
+       0,     0,   178,     0,   102,   179,     0,     0,     0,   180,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
+       0,     0,     0,     0,     0,     0,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,   117,   118,   119,     0,     9,     0,
+       0,     0,     0,     0,     0,   120,   121,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   122,
+     123,   124,   125,   126,  1030,     0,     0,     0,     0,     0,
+       0,   128,   129,   130,   131,     0,   132,     0,     0,   133,
+     134,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,     0,     0,
+       0,   156,   157,   158,   159,   160,     0,     0,     0,     0,
+       0,   161,   162,   163,   164,   165,   166,     0,   167,   168,
+     169,     0,   170,     0,   171,     0,    77,     0,    94,    95,
+       0,    96,    97,    98,     0,     0,   172,   173,     0,     0,
+     174,   175,    99,   100,   101,     0,     0,   176,   177,     0,
+       0,   178,     0,   102,   179,     0,     0,     0,   180,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   103,     0,
+       0,     0,     0,     0,     0,   104,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,     0,     0,
+       0,     0,     0,   117,   118,   119,     0,     9,     0,     0,
+       0,     0,     0,     0,   120,   121,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   122,   123,
+     124,   125,   126,   127,     0,     0,     0,     0,     0,     0,
+     128,   129,   130,   131,     0,   132,     0,     0,   133,   134,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,   151,   152,   153,   154,   155,     0,     0,     0,
+     156,   157,   158,   159,   160,     0,     0,     0,     0,     0,
+     161,   162,   163,   164,   165,   166,     0,   167,   168,   169,
+       0,   170,     0,   171,     0,    77,     0,    94,    95,     0,
+      96,    97,    98,     0,     0,   172,   173,     0,     0,   627,
+     175,    99,   100,  1057,     0,     0,   176,   177,     0,     0,
+    1039,     0,   102,   179,     0,     0,     0,   180,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   103,     0,     0,
+       0,     0,     0,     0,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   116,     0,     0,     0,
+       0,     0,   117,   118,   119,     0,     9,     0,     0,     0,
+       0,     0,     0,   120,   121,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   122,   123,   124,
+     125,   126,   127,     0,     0,     0,     0,     0,     0,   128,
+     129,   130,   131,     0,   132,     0,     0,   133,   134,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,     0,     0,     0,   156,
+     157,   158,   159,   160,     0,     0,     0,     0,     0,   161,
+     162,   163,   164,   165,   166,     0,   167,   168,   169,     0,
+     170,     0,   171,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   172,   173,     0,     0,   174,   175,
+       0,    43,     0,    28,     0,   176,   177,     0,     0,   178,
+       0,     0,   179,     0,     0,     0,   180,  1011,     0,    44,
+      45,    46,     0,    47,    48,     0,     0,    49,    50,    51,
+       0,    52,    53,    54,    55,    56,    57,    58,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     9,     0,     0,     0,    59,    43,
+       0,    28,     0,    60,     0,     0,     0,     0,    61,    62,
+      63,    64,     0,    65,     0,     0,     0,    44,    45,    46,
+      35,    47,    48,     0,     0,    49,    50,    51,     0,    52,
+      53,    54,    55,    56,    57,    58,     0,    66,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     9,     0,     0,     0,    59,    43,     0,    28,
+       0,    60,     0,     0,     0,  1028,    61,    62,    63,    64,
+       0,    65,     0,     0,     0,    44,    45,    46,    35,    47,
+      48,     0,    67,    49,    50,    51,     0,    52,    53,    54,
+      55,    56,    57,    58,     0,    66,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    68,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       9,     0,     0,     0,    59,    43,     0,    28,     0,    60,
+       0,     0,     0,  1029,    61,    62,    63,    64,     0,    65,
+       0,     0,     0,    44,    45,    46,    35,    47,    48,     0,
+      67,    49,    50,    51,     0,    52,    53,    54,    55,    56,
+      57,    58,     0,    66,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    68,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     9,     0,
+       0,     0,    59,    43,     0,   218,     0,    60,     0,     0,
+       0,     0,    61,    62,    63,    64,     0,    65,     0,     0,
+       0,    44,    45,    46,    35,    47,    48,     0,    67,    49,
+      50,    51,     0,    52,    53,    54,    55,    56,    57,    58,
+       0,    66,     0,     0,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+      68,  1219,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      59,     0,     0,     0,     0,    60,   435,   436,     0,     0,
+      61,    62,    63,    64,     0,    65,     0,     0,  1220,     0,
+       0,     0,    35,     0,   438,     0,    67,     0,     0,     0,
+     439,   440,   441,   442,     0,     0,     0,     0,     0,    66,
+       0,     0,     0,     0,     0,     0,     0,   451,   452,   453,
+     454,   455,   456,   457,     0,     0,     0,     0,    68,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,  1015,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    67,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,     0,     0,   437,     0,  1016,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,    68,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,     0,     0,     0,     0,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,  1068,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,  1017,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,   622,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,  1019,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+     622,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,   518,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,   520,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   519,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+     522,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     521,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,   523,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,   524,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,   526,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,   527,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+     855,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,   997,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,   998,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,  1020,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,  1021,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+    1022,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,  1023,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,  1107,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,  1108,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,  1203,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+    1204,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,  1222,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,  1223,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,  1232,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,   912,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,   989,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,  1216,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   435,   436,
+       0,     0,     0,     0,     0,     0,     0,   437,     0,     0,
+       0,     0,     0,     0,     0,     0,   438,     0,     0,     0,
+       0,     0,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,     0,     0,     0,     0,     0,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   927,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+       0,   437,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   928,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,     0,   437,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   929,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,     0,   437,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   930,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,     0,     0,     0,
+     787,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,     0,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,     0,     0,     0,     0,     0,
+       0,     0,     0,   802,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,     0,   437,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,     0,     0,
+       0,     0,     0,     0,     0,     0,   892,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,     0,     0,     0,     0,     0,     0,     0,     0,   893,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,     0,   437,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,     0,     0,     0,     0,     0,     0,
+       0,     0,   894,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,     0,     0,
+       0,     0,     0,     0,     0,   895,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+       0,   437,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+       0,     0,     0,     0,     0,     0,     0,     0,   896,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,     0,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,     0,     0,     0,     0,     0,     0,     0,
+       0,   921,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   435,   436,
+       0,     0,     0,     0,     0,     0,     0,   437,     0,     0,
+       0,     0,     0,     0,     0,     0,   438,     0,     0,     0,
+       0,     0,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,     0,     0,     0,     0,     0,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,     0,     0,     0,     0,
+       0,     0,     0,     0,   926,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,     0,
+       0,     0,     0,     0,     0,     0,     0,   979,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,     0,     0,     0,
+     983,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,     0,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,     0,     0,     0,     0,     0,
+       0,     0,     0,   991,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,     0,   437,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,     0,     0,
+       0,     0,     0,     0,     0,     0,  1008,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,     0,     0,     0,     0,     0,     0,     0,     0,  1062,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,     0,   437,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,     0,     0,     0,     0,     0,     0,
+       0,     0,  1122,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,     0,     0,
+       0,     0,     0,     0,     0,  1123,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+       0,   437,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+       0,     0,     0,     0,     0,     0,     0,     0,  1149,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   435,   436,     0,     0,     0,
+       0,     0,     0,     0,   437,     0,     0,     0,     0,     0,
+       0,     0,     0,   438,     0,     0,     0,     0,     0,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,     0,
+       0,     0,     0,     0,   449,   450,   451,   452,   453,   454,
+     455,   456,   457,     0,     0,     0,     0,     0,     0,     0,
+       0,  1150,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   435,   436,
+       0,     0,     0,     0,     0,     0,     0,   437,     0,     0,
+       0,     0,     0,     0,     0,     0,   438,     0,     0,     0,
+       0,     0,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,     0,     0,     0,     0,     0,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,     0,     0,     0,     0,
+       0,     0,     0,     0,  1151,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,     0,
+       0,     0,     0,     0,     0,     0,     0,  1160,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,     0,     0,     0,
+    1161,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     432,   433,   434,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   435,   436,     0,
+       0,     0,     0,     0,     0,     0,   437,     0,     0,     0,
+       0,     0,     0,     0,     0,   438,     0,     0,     0,     0,
+       0,   439,   440,   441,   442,   443,   444,   445,   446,   447,
+     448,     0,     0,     0,     0,     0,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,     0,     0,     0,     0,     0,
+       0,     0,     0,  1162,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,     0,   437,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,     0,     0,
+       0,     0,     0,     0,     0,     0,  1199,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,     0,     0,     0,     0,     0,     0,     0,     0,  1200,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,     0,   437,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,     0,     0,     0,     0,     0,     0,
+       0,     0,  1201,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,   437,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,     0,     0,   439,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,     0,     0,     0,     0,     0,   449,   450,
+     451,   452,   453,   454,   455,   456,   457,     0,     0,     0,
+       0,     0,     0,     0,   458,   403,   404,   405,   406,   407,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+     437,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,     0,
+       0,     0,     0,     0,     0,     0,   544,   403,   404,   405,
+     406,   407,   408,   409,   410,   411,   412,   413,   414,   415,
+     416,   417,   418,   419,   420,   421,   422,   423,   424,   425,
+     426,   427,   428,   429,   430,   431,   432,   433,   434,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   435,   436,     0,     0,     0,     0,     0,
+       0,     0,   437,     0,     0,     0,     0,     0,     0,     0,
+       0,   438,     0,     0,     0,     0,     0,   439,   440,   441,
+     442,   443,   444,   445,   446,   447,   448,     0,     0,     0,
+       0,     0,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,     0,     0,     0,     0,     0,     0,  1159,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   677,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   917,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   932,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   933,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   934,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   935,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   936,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   938,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,   939,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,  1154,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,  1155,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,  1156,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,     0,     0,     0,     0,     0,  1157,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,     0,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,   511,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   435,   436,
+       0,     0,     0,     0,     0,     0,   898,   437,     0,     0,
+       0,     0,     0,     0,     0,     0,   438,     0,     0,     0,
+       0,     0,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,     0,     0,     0,     0,     0,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+     899,   437,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,   900,   437,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,   901,   437,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   403,   404,
+     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   435,   436,     0,     0,     0,     0,
+       0,     0,     0,   437,   968,     0,     0,     0,     0,     0,
+       0,     0,   438,     0,     0,     0,     0,     0,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   448,     0,     0,
+       0,     0,     0,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   403,   404,   405,   406,   407,   408,   409,   410,
+     411,   412,   413,   414,   415,   416,   417,   418,   419,   420,
+     421,   422,   423,   424,   425,   426,   427,   428,   429,   430,
+     431,   432,   433,   434,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   435,   436,
+       0,     0,     0,     0,     0,     0,     0,   437,     0,     0,
+       0,     0,     0,     0,     0,     0,   438,     0,     0,     0,
+       0,     0,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,   448,     0,     0,   996,     0,     0,   449,   450,   451,
+     452,   453,   454,   455,   456,   457,   403,   404,   405,   406,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+       0,   437,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
+     423,   424,   425,   426,   427,   428,   429,   430,   431,   432,
+     433,   434,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   435,   436,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   438,     0,     0,     0,     0,     0,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,   448,
+       0,     0,     0,     0,     0,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   403,     0,   405,     0,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     435,   436,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   438,     0,
+       0,     0,     0,     0,   439,   440,   441,   442,   443,   444,
+     445,   446,   447,   448,     0,     0,     0,     0,     0,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   405,     0,
+     407,   408,   409,   410,   411,   412,   413,   414,   415,   416,
+     417,   418,   419,   420,   421,   422,   423,   424,   425,   426,
+     427,   428,   429,   430,   431,   432,   433,   434,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   435,   436,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     438,     0,     0,     0,     0,     0,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,     0,     0,     0,     0,
+       0,   449,   450,   451,   452,   453,   454,   455,   456,   457,
+     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,     0,     0,     0,     0,     0,
+     449,   450,   451,   452,   453,   454,   455,   456,   457,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,   433,   434,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   435,   436,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+       0,     0,     0,     0,     0,   439,   440,   441,   442,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   451,   452,   453,   454,   455,   456,   457,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,     0,     0,     0,     0,     0,     0,     0,
+       0,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     428,   429,   430,   431,   432,     0,     0,     0,     0,   435,
+     436,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   438,     0,     0,
+       0,   435,   436,   439,   440,   441,   442,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   438,
+     451,   452,   453,   454,   455,   456,   457,   441,   442,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   453,   454,   455,   456,   457
+};
+
+static const yytype_int16 yycheck[] =
+{
+      14,   325,   326,   327,   328,   329,     7,    74,   572,   862,
+      69,   574,   813,    73,    83,   854,     3,   488,     3,   299,
+     323,   324,    14,   781,   293,    29,    78,   388,   331,   332,
+     333,   287,    39,    78,    29,   338,    29,     3,    52,    53,
+      54,    55,    56,    78,    78,    21,    78,    61,    62,     3,
+    1020,   227,    66,    19,    20,    21,    45,    46,    47,    48,
+      74,    28,    29,    78,   235,    78,   905,   226,   227,   228,
+     229,   230,   231,   232,    78,   914,   230,    14,     4,   213,
+      81,   235,     8,    78,    85,    78,    78,    74,    78,   103,
+      78,     3,  1177,    42,    78,    44,     5,     3,  1183,   233,
+      78,     0,     1,     1,     3,     3,    78,    78,    74,    78,
+      78,    37,    11,    12,    13,    14,    15,    16,    78,     3,
+      74,   135,   136,   137,   138,   139,   140,   141,   142,    83,
+      84,    18,     3,   226,   148,   149,   150,   230,     1,    26,
+       3,    78,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,     3,     3,   226,     0,   171,   229,   173,
+     174,   175,   176,    89,   178,    78,   180,   470,    74,     4,
+      19,    20,    21,    22,    78,    74,    74,    83,     3,    78,
+      78,     6,    78,   197,   198,    84,     3,   232,   100,   229,
+      25,   100,   232,    92,    19,    20,    21,    22,   232,     3,
+     235,    36,    37,   235,   143,   144,   145,   274,   222,   276,
+     269,    74,   111,     3,    78,    78,   155,   232,   230,   232,
+      25,   233,   230,   235,    74,    74,   233,   296,   232,    92,
+     988,    17,    18,   302,    84,    84,   228,   232,   177,   232,
+     179,   217,   232,   227,   232,    80,   233,   214,   111,    84,
+     235,   100,  1222,  1223,   232,    60,   235,    74,    78,   227,
+     232,   232,   565,   232,   230,   279,    83,    84,    78,   228,
+      74,   551,   232,   232,   226,   100,   174,   278,   230,    83,
+     843,    78,   228,     6,    74,  1138,   232,   213,  1127,    47,
+      48,    49,   228,   857,   164,   165,   232,   298,   312,   313,
+     314,   315,   316,  1104,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   601,   602,   794,   338,   339,   606,   596,   342,   343,
+     344,   345,   346,   347,   233,   349,     3,   593,   228,   353,
+     279,   355,   232,   357,    28,   359,   335,   336,   337,   228,
+       6,    30,    31,   232,   513,     6,   370,   371,   372,   373,
+     230,   231,   376,    42,   378,   235,     3,    78,   230,   231,
+     233,   233,   221,   235,   388,   389,   390,   226,   227,  1218,
+     394,    78,    19,    20,    21,    22,    78,   401,   229,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   459,   460,   808,   809,   810,
+     285,   228,   287,   814,   468,   232,   470,   471,   293,   230,
+     265,   475,   297,   100,   228,   164,   165,   481,   232,  1033,
+     230,   230,   228,   308,   230,   310,   311,   233,   230,   235,
+     547,   228,   549,   233,   228,   232,   228,   501,   232,   503,
+     232,   505,   226,   227,     3,   555,   556,   511,   230,   304,
+     228,   306,   307,   227,   232,   519,   227,   521,   568,   569,
+      19,    20,    21,    22,   227,   230,   228,   322,   323,   324,
+     232,   228,     3,   226,   227,   232,   331,   332,   333,   543,
+     544,   230,   546,   338,   227,   230,   235,   840,    19,    20,
+      21,    22,   227,   557,   558,   559,   560,   561,    78,   227,
+     564,   565,   566,   856,   899,   900,   901,   227,   572,     1,
+     574,     3,   501,     3,   503,  1129,   505,     3,   494,    11,
+      12,    13,    14,    15,    16,   227,   607,   608,   609,    19,
+      20,    21,    22,   597,   598,    11,    12,    13,    14,    15,
+      16,   100,   227,    74,   228,   227,   828,   877,   232,   600,
+     227,   881,   227,    84,   605,   228,     3,   887,   622,   232,
+     611,   228,     3,   627,     3,   232,     5,     6,     7,   100,
+     227,   227,    19,    20,    21,    22,   227,   566,    19,    20,
+      21,    22,    74,   572,    74,   574,    78,   483,   484,   485,
+     486,   227,    84,   228,    84,   491,   227,   232,   228,   227,
+      92,   228,   232,   488,   227,   232,    45,    46,    84,   227,
+     100,   227,   322,   323,   324,   470,   680,     3,   682,   111,
+     684,   331,   332,   333,   688,   228,   690,    74,   338,   232,
+     228,   227,   696,    74,   232,    74,   700,    84,   702,   227,
+     704,   228,   706,    84,   708,   232,   710,   228,   712,    88,
+     714,   232,   716,   100,   718,   265,   720,   228,   722,   100,
+     724,   232,   726,   228,   728,   228,   730,   232,   732,   232,
+     734,   227,   736,   227,   738,   114,   115,   116,   227,   227,
+     227,   227,   227,   227,   227,   227,  1039,     3,   752,   753,
+     221,   755,     3,   757,   220,   759,   227,   761,   100,   763,
+     100,   765,    78,   767,   229,   769,     6,     6,   593,   232,
+     565,   596,   322,   323,   324,   824,   825,   781,   100,   230,
+      78,   331,   332,   333,   228,   227,   227,   227,   338,    78,
+     228,   221,   227,   232,  1016,   844,   845,  1019,  1020,   213,
+      29,   233,    78,   227,   808,   809,   810,    78,     3,    78,
+     814,   815,   230,   230,     3,   118,    78,   232,   220,    78,
+     470,   230,   826,   827,    19,    20,    21,    22,   228,  1143,
+      19,    20,    21,    22,   221,   230,   840,   230,   228,   843,
+     221,   228,   846,   232,   848,   226,   227,   235,   228,   228,
+     854,   228,   856,   173,   229,   233,   230,   230,   230,   226,
+       3,   231,    78,   232,    78,   869,     9,    10,   872,   873,
+     874,     6,    76,   232,     3,    78,    19,    20,    21,    74,
+      78,    78,     3,   230,   230,  1107,  1108,    30,     9,    10,
+      19,    20,    21,    22,   898,   899,   900,   901,    19,    20,
+      21,   905,   906,   907,   908,   100,   230,   232,   912,    30,
+     914,   100,   231,   228,   843,   565,     3,    76,    76,   228,
+     470,    78,     3,   927,   928,   929,   930,   232,   857,    21,
+     232,    74,    19,    20,    21,    22,   232,   941,    19,    20,
+      21,    22,   232,   228,   228,    74,   862,    78,  1170,  1171,
+     231,    78,    95,    74,    78,    78,    78,   100,    78,    78,
+     232,   566,  1218,  1119,   968,    94,  1215,     3,   311,   794,
+     613,   100,   196,    72,    95,    89,     1,   627,     3,   100,
+     984,   985,   986,   993,   988,   989,  1208,    74,    37,  1033,
+     994,  1213,  1138,   285,    19,    20,    21,    78,  1220,   546,
+    1222,  1223,   542,    75,   274,     3,   982,     5,     6,     7,
+    1232,    36,    37,   100,  1018,   565,    -1,    -1,   813,   100,
+      -1,   164,   165,    -1,    -1,    -1,   221,    -1,    -1,    -1,
+      -1,   174,    -1,    -1,    -1,  1039,    -1,   862,    -1,    -1,
+      -1,    -1,    -1,   164,   165,   840,    -1,    45,    46,    74,
+      -1,     0,    -1,    78,    -1,    -1,     5,     6,     7,   854,
+      -1,   856,    -1,    -1,  1068,    -1,    -1,    -1,    17,    18,
+    1074,  1075,    -1,    -1,    -1,   100,    74,   627,  1082,    -1,
+      29,    30,    31,    -1,    -1,    -1,    -1,   230,    -1,    -1,
+      88,    -1,   221,    42,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,  1033,  1109,  1110,    -1,    -1,   230,
+     905,    -1,    -1,    -1,  1118,  1119,   114,   115,   116,   914,
+      -1,    -1,    -1,  1127,    -1,    -1,    -1,    -1,  1044,  1045,
+    1046,  1047,    -1,    -1,   221,    -1,  1052,    -1,    -1,  1143,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   142,   143,   144,
+     145,   146,   147,   148,    -1,  1159,     0,    -1,    -1,     3,
+       4,     5,     6,     7,     8,    -1,    -1,    -1,  1172,    -1,
+    1174,  1175,    -1,  1177,    18,    -1,    -1,    -1,    -1,  1183,
+     175,   176,    26,    -1,    -1,    29,    30,    31,    -1,    -1,
+     840,    -1,    -1,    37,    -1,    -1,   221,    -1,    42,    -1,
+    1129,    -1,    -1,    -1,   854,    -1,   856,    -1,    -1,    -1,
+      -1,  1215,  1216,    -1,  1218,  1219,    -1,    -1,  1134,  1135,
+    1136,  1137,  1138,  1048,    -1,    69,    -1,   222,    -1,    73,
+      -1,    -1,    -1,    -1,    -1,    -1,    80,    81,    -1,    -1,
+      84,    85,    -1,    -1,  1039,    89,     0,     1,    -1,     3,
+      -1,    -1,    -1,    -1,    -1,   905,    -1,    11,    12,    13,
+      14,    15,    16,   813,   914,    19,    20,    21,    -1,    -1,
+      -1,    -1,    -1,     0,     1,    -1,     3,    -1,    -1,    -1,
+      -1,    -1,    36,    37,    11,    12,    13,    14,    15,    16,
+     840,    -1,   142,   143,   144,   145,   146,   147,   148,   143,
+     144,   145,   146,   147,   854,    -1,   856,    -1,    -1,  1104,
+      -1,   155,    -1,  1138,    -1,    -1,    -1,    -1,    -1,    -1,
+      74,    -1,    -1,    -1,    78,   175,   176,    -1,    -1,    -1,
+      84,    -1,  1127,   177,    -1,   179,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,   100,    74,    -1,    -1,
+      -1,    78,   196,    -1,    -1,   905,    -1,    84,    -1,    -1,
+      -1,    -1,    -1,    -1,   914,    -1,    -1,    -1,    -1,   213,
+     220,   221,   222,   142,   143,   144,   145,   146,   147,   148,
+      -1,     0,     1,    -1,     3,    -1,    -1,    -1,    -1,  1039,
+      -1,    -1,    11,    12,    13,    14,    15,    16,    -1,    -1,
+      19,    20,    21,    -1,    23,    24,   175,   176,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    -1,
+      -1,   265,    -1,  1218,    -1,   269,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   278,   113,    -1,    -1,    -1,    -1,
+     118,    -1,   286,   287,    -1,   289,    -1,   174,    -1,   293,
+      -1,    -1,    -1,   297,   298,    74,   300,    -1,    -1,    78,
+      -1,    -1,    -1,    -1,    83,    84,    -1,   221,    -1,    88,
+      89,    90,    91,    -1,    93,    -1,    -1,  1127,    -1,    -1,
+      -1,   100,   160,   161,   162,   163,   164,   165,    -1,  1039,
+      -1,     0,     1,    -1,     3,   173,   340,   341,   117,    -1,
+      -1,    -1,    11,    12,    13,    14,    15,    16,    -1,    -1,
+      19,    20,    21,    -1,    23,    24,    -1,    -1,    27,    28,
+      29,    -1,    31,    32,    33,    34,    35,    36,    37,    -1,
+      -1,    -1,    -1,    -1,    -1,   213,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   224,    -1,    -1,   227,
+      -1,    -1,   230,   231,  1104,    -1,   234,   235,    -1,    -1,
+      -1,    -1,    -1,   182,    -1,    74,    -1,    -1,  1218,    78,
+      -1,    -1,    -1,    -1,    83,    84,    -1,  1127,    -1,    88,
+      89,    90,    91,    -1,    93,    -1,    -1,     1,    -1,     3,
+      -1,   100,    -1,    -1,    -1,   214,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    19,    20,    21,   117,    23,
+      24,    -1,    -1,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    -1,    -1,    -1,    -1,    -1,   473,
+     474,    -1,    -1,   113,    -1,    -1,    -1,    -1,   118,    -1,
+      -1,    -1,    -1,    -1,    -1,   489,    -1,    -1,    -1,    -1,
+     494,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      74,    -1,    -1,    -1,    78,    -1,    -1,    -1,  1218,    83,
+      84,    -1,    -1,   182,    88,    89,    90,    91,    -1,    93,
+     160,   161,   162,   163,   164,   165,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   173,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   117,    -1,   214,    -1,    -1,    -1,    -1,
+      -1,   555,   556,   557,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   568,   569,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   213,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   224,   589,    -1,   227,    -1,   593,
+     230,    -1,   596,    -1,   234,   235,   600,    -1,    -1,    -1,
+      -1,   605,    -1,    -1,    -1,    -1,    -1,   611,   182,    -1,
+      -1,    -1,     0,     1,    -1,     3,     4,     5,     6,    -1,
+       8,     9,    10,    11,    12,    13,    14,    15,    16,    -1,
+      18,    19,    20,    21,    -1,    -1,    -1,    -1,    -1,    -1,
+     214,    -1,    30,    31,    32,    -1,    -1,    -1,    -1,    -1,
+      38,    -1,    -1,    -1,    -1,    -1,    -1,    45,    46,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    65,    66,    -1,
+      68,    69,    70,    71,    72,    73,    74,    75,    76,    -1,
+      78,    -1,    -1,    81,    82,    -1,    84,    85,    86,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,    -1,    -1,   177,
+     178,   179,   180,   181,   182,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    40,   194,   195,   196,   813,
+     198,    -1,   200,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     824,   825,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      -1,    -1,    -1,    -1,    -1,   223,   224,    -1,    -1,   227,
+     844,   845,   230,     1,    -1,     3,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,   857,    -1,    -1,    -1,    -1,   862,    17,
+      -1,    19,    20,    21,    -1,    23,    24,    -1,    -1,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      -1,    -1,    -1,    -1,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    74,    -1,    -1,    -1,
+      78,    -1,    -1,    -1,    -1,    83,    -1,    -1,    -1,    -1,
+      88,    89,    90,    91,    -1,    93,   940,    -1,    -1,    -1,
+     175,   176,   100,    -1,    -1,    -1,   113,    -1,    -1,   184,
+      -1,   118,    -1,    -1,    -1,    -1,    -1,    -1,   193,   117,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,    -1,   993,
+      -1,    -1,    -1,   160,   161,   162,   163,   164,   165,   142,
+     143,   144,   145,   146,   147,   148,   173,    -1,    -1,    -1,
+      -1,  1015,    -1,  1017,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   182,    -1,    -1,    -1,    -1,  1033,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+    1044,  1045,  1046,  1047,    -1,    -1,   213,    -1,  1052,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   214,   224,    -1,    -1,
+     227,    -1,    -1,   230,    -1,   232,    -1,   234,   235,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   221,   222,
+      -1,    -1,    -1,     0,     1,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+    1104,    18,    19,    20,    21,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    30,    31,    32,    -1,    -1,    -1,    -1,
+      -1,    38,    -1,    -1,    -1,  1129,    -1,    -1,    45,    46,
+    1134,  1135,  1136,  1137,  1138,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      -1,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      -1,    78,    -1,    -1,    81,    82,    -1,    84,    85,    86,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,   174,    -1,    -1,
+     177,   178,   179,   180,   181,   182,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     1,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,   212,   213,    -1,    -1,   216,
+     217,    -1,    18,    19,    20,    21,   223,   224,    -1,    -1,
+     227,    -1,    -1,   230,    30,    31,    32,   234,    -1,    -1,
+      -1,    -1,    38,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      46,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      66,    -1,    68,    69,    70,    71,    72,    73,    74,    75,
+      76,    77,    78,    -1,    -1,    81,    82,    -1,    -1,    85,
+      86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,   174,    -1,
+      -1,   177,   178,   179,   180,   181,   182,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     1,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,   212,   213,    -1,    -1,
+     216,   217,    -1,    18,    19,    20,    21,   223,   224,    -1,
+      -1,   227,    -1,    -1,   230,    30,    31,    32,   234,    -1,
+      -1,    -1,    -1,    38,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    46,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    -1,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    -1,    -1,    81,    82,    -1,    -1,
+      85,    86,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+      -1,    -1,   177,   178,   179,   180,   181,   182,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    -1,    -1,    -1,    -1,    -1,   223,   224,
+      -1,     3,   227,     5,     6,   230,     8,     9,    10,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    19,    20,    21,
+      -1,    23,    24,    25,    26,    -1,    -1,    -1,    30,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    78,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    -1,    -1,    -1,    -1,
+      -1,   223,   224,    -1,     3,   227,     5,     6,   230,     8,
+       9,    10,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      19,    20,    21,    -1,    23,    24,    25,    26,    -1,    -1,
+      -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    78,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    -1,
+      -1,    -1,    -1,    -1,   223,   224,    -1,     3,   227,     5,
+       6,   230,     8,     9,    10,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    19,    20,    21,    -1,    23,    24,    25,
+      26,    -1,    -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    78,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    -1,    -1,    -1,    -1,    -1,   223,   224,    -1,
+       3,   227,     5,     6,   230,     8,     9,    10,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,
+      23,    24,    25,    26,    -1,    -1,    -1,    30,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    78,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    -1,    -1,    -1,    -1,    -1,
+     223,   224,    -1,     3,   227,     5,     6,   230,     8,     9,
+      10,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    19,
+      20,    21,    -1,    23,    24,    25,    26,    -1,    -1,    -1,
+      30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    -1,    -1,
+      -1,    -1,    -1,   223,   224,    -1,     3,   227,     5,     6,
+     230,     8,     9,    10,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    19,    20,    21,    -1,    23,    24,    25,    26,
+      -1,    -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    -1,    -1,    -1,    -1,    -1,   223,   224,    -1,     3,
+     227,     5,     6,   230,     8,     9,    10,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    19,    20,    21,    -1,    23,
+      24,    25,    26,    -1,    -1,    -1,    30,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    -1,    -1,    -1,    -1,    -1,   223,
+     224,    -1,     3,   227,     5,     6,   230,     8,     9,    10,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    19,    20,
+      21,    -1,    23,    24,    25,    26,    -1,    -1,    -1,    30,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    -1,    -1,    -1,
+      -1,    -1,   223,   224,    -1,     3,   227,     5,     6,   230,
+       8,     9,    10,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    19,    20,    21,    -1,    23,    24,    25,    26,    -1,
+      -1,    -1,    30,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,
+      29,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    78,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,    -1,
+      30,   230,    -1,    -1,   233,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    42,    -1,    44,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    78,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,    -1,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   124,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      22,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,   215,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,    -1,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,     7,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,    -1,   227,   228,    30,   230,    -1,    -1,
+     233,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,    -1,   227,   228,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    67,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    77,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,    -1,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    67,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    77,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+      -1,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    78,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      78,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    78,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,    -1,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,   212,   213,    -1,    -1,   216,   217,    17,
+      -1,    19,    20,    21,   223,   224,    -1,    -1,   227,    -1,
+      -1,   230,    30,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,
+      30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,   226,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+     226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,   226,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,   226,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,    -1,
+      30,   230,    -1,    -1,   233,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,   226,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+     226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,   226,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,   226,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,
+      30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,   226,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+     226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,   226,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,   226,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,
+      30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,   226,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,   226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+     226,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,   226,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,   226,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,
+      30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,    -1,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,   226,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,   226,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,   226,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,    -1,   227,   228,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,    -1,   227,    -1,    30,   230,    -1,    -1,   233,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    78,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+      -1,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    78,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,
+       9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,   227,
+      -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,
+      -1,    -1,    -1,    52,    53,    54,    55,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,
+      -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,
+      99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,
+     109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
+     169,   170,   171,   172,   173,    -1,    -1,    -1,   177,   178,
+     179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,
+     189,   190,   191,   192,    -1,   194,   195,   196,    -1,   198,
+      -1,   200,    -1,     3,    -1,     5,     6,    -1,     8,     9,
+      10,    -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,
+      20,    21,    22,    -1,   223,   224,    -1,   226,   227,    -1,
+      30,   230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,
+      -1,    -1,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,    -1,    -1,    -1,    -1,    -1,
+      70,    71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,
+      -1,    81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,
+     100,    -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,
+     110,    -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   153,   154,   155,   156,   157,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,    -1,    -1,    -1,   177,   178,   179,
+     180,   181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,
+     190,   191,   192,    -1,   194,   195,   196,    -1,   198,    -1,
+     200,    -1,     3,    -1,     5,     6,    -1,     8,     9,    10,
+      -1,    -1,   212,   213,    -1,    -1,   216,   217,    19,    20,
+      21,    -1,    -1,   223,   224,    -1,    -1,   227,    -1,    30,
+     230,    -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,
+      -1,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    -1,    -1,    67,    -1,    -1,    70,
+      71,    72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,
+      81,    82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    95,    96,    97,    98,    99,   100,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,
+      -1,   112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   153,   154,   155,   156,   157,   158,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,    -1,    -1,    -1,   177,   178,   179,   180,
+     181,    -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,
+     191,   192,    -1,   194,   195,   196,    -1,   198,    -1,   200,
+      -1,     3,    -1,     5,     6,     7,     8,     9,    10,    -1,
+      -1,   212,   213,    -1,    -1,   216,   217,    19,    20,    21,
+      -1,    -1,   223,   224,    -1,    -1,   227,    -1,    30,   230,
+      -1,    -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,
+      72,    -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,
+      82,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    95,    96,    97,    98,    99,   100,    -1,
+      -1,    -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,
+     112,    -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,    -1,    -1,    -1,   177,   178,   179,   180,   181,
+      -1,    -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,
+     192,    -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,
+       3,    -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,
+     212,   213,    -1,    -1,   216,   217,    19,    20,    21,    -1,
+      -1,   223,   224,    -1,    -1,   227,    -1,    30,   230,    -1,
+      -1,    -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,
+      -1,    74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    95,    96,    97,    98,    99,   100,    -1,    -1,
+      -1,    -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,
+      -1,    -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+     173,    -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,
+      -1,    -1,    -1,    -1,   187,   188,   189,   190,   191,   192,
+      -1,   194,   195,   196,    -1,   198,    -1,   200,    -1,     3,
+      -1,     5,     6,    -1,     8,     9,    10,    -1,    -1,   212,
+     213,    -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,
+     223,   224,    -1,    -1,   227,    -1,    30,   230,    -1,    -1,
+      -1,   234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
+      64,    -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,
+      74,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    95,    96,    97,    98,    99,   100,    -1,    -1,    -1,
+      -1,    -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,
+      -1,   115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+      -1,    -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,
+      -1,    -1,    -1,   187,   188,   189,   190,   191,   192,    -1,
+     194,   195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,
+       5,     6,    -1,     8,     9,    10,    -1,    -1,   212,   213,
+      -1,    -1,   216,   217,    19,    20,    21,    -1,    -1,   223,
+     224,    -1,    -1,   227,    -1,    30,   230,    -1,    -1,    -1,
+     234,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      45,    -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,
+      -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      95,    96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,
+     115,   116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,    -1,
+      -1,    -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,
+      -1,    -1,   187,   188,   189,   190,   191,   192,    -1,   194,
+     195,   196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,
+       6,    -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,
+      -1,   216,   217,    19,    20,    21,    -1,    -1,   223,   224,
+      -1,    -1,   227,    -1,    30,   230,    -1,    -1,    -1,   234,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,
+      -1,    -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    -1,
+      -1,    -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,
+      -1,    -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,
+      96,    97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,   107,   108,   109,   110,    -1,   112,    -1,    -1,   115,
+     116,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
+     166,   167,   168,   169,   170,   171,   172,   173,    -1,    -1,
+      -1,   177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,
+      -1,   187,   188,   189,   190,   191,   192,    -1,   194,   195,
+     196,    -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,
+      -1,     8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,
+     216,   217,    19,    20,    21,    -1,    -1,   223,   224,    -1,
+      -1,   227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,
+      -1,    -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,
+      -1,    -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,
+      97,    98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,
+     107,   108,   109,   110,    -1,   112,    -1,    -1,   115,   116,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   173,    -1,    -1,    -1,
+     177,   178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,
+     187,   188,   189,   190,   191,   192,    -1,   194,   195,   196,
+      -1,   198,    -1,   200,    -1,     3,    -1,     5,     6,    -1,
+       8,     9,    10,    -1,    -1,   212,   213,    -1,    -1,   216,
+     217,    19,    20,    21,    -1,    -1,   223,   224,    -1,    -1,
+     227,    -1,    30,   230,    -1,    -1,    -1,   234,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    -1,    -1,
+      -1,    -1,    -1,    -1,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    -1,    -1,    -1,
+      -1,    -1,    70,    71,    72,    -1,    74,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    95,    96,    97,
+      98,    99,   100,    -1,    -1,    -1,    -1,    -1,    -1,   107,
+     108,   109,   110,    -1,   112,    -1,    -1,   115,   116,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,    -1,    -1,    -1,   177,
+     178,   179,   180,   181,    -1,    -1,    -1,    -1,    -1,   187,
+     188,   189,   190,   191,   192,    -1,   194,   195,   196,    -1,
+     198,    -1,   200,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   212,   213,    -1,    -1,   216,   217,
+      -1,     1,    -1,     3,    -1,   223,   224,    -1,    -1,   227,
+      -1,    -1,   230,    -1,    -1,    -1,   234,    17,    -1,    19,
+      20,    21,    -1,    23,    24,    -1,    -1,    27,    28,    29,
+      -1,    31,    32,    33,    34,    35,    36,    37,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    74,    -1,    -1,    -1,    78,     1,
+      -1,     3,    -1,    83,    -1,    -1,    -1,    -1,    88,    89,
+      90,    91,    -1,    93,    -1,    -1,    -1,    19,    20,    21,
+     100,    23,    24,    -1,    -1,    27,    28,    29,    -1,    31,
+      32,    33,    34,    35,    36,    37,    -1,   117,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    74,    -1,    -1,    -1,    78,     1,    -1,     3,
+      -1,    83,    -1,    -1,    -1,    87,    88,    89,    90,    91,
+      -1,    93,    -1,    -1,    -1,    19,    20,    21,   100,    23,
+      24,    -1,   182,    27,    28,    29,    -1,    31,    32,    33,
+      34,    35,    36,    37,    -1,   117,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   214,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      74,    -1,    -1,    -1,    78,     1,    -1,     3,    -1,    83,
+      -1,    -1,    -1,    87,    88,    89,    90,    91,    -1,    93,
+      -1,    -1,    -1,    19,    20,    21,   100,    23,    24,    -1,
+     182,    27,    28,    29,    -1,    31,    32,    33,    34,    35,
+      36,    37,    -1,   117,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   214,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    74,    -1,
+      -1,    -1,    78,     1,    -1,     3,    -1,    83,    -1,    -1,
+      -1,    -1,    88,    89,    90,    91,    -1,    93,    -1,    -1,
+      -1,    19,    20,    21,   100,    23,    24,    -1,   182,    27,
+      28,    29,    -1,    31,    32,    33,    34,    35,    36,    37,
+      -1,   117,    -1,    -1,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     214,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,    -1,    -1,    -1,    83,   175,   176,    -1,    -1,
+      88,    89,    90,    91,    -1,    93,    -1,    -1,    78,    -1,
+      -1,    -1,   100,    -1,   193,    -1,   182,    -1,    -1,    -1,
+     199,   200,   201,   202,    -1,    -1,    -1,    -1,    -1,   117,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   216,   217,   218,
+     219,   220,   221,   222,    -1,    -1,    -1,    -1,   214,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    43,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   182,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   184,    -1,    78,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,   214,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,    -1,    -1,    -1,    -1,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    47,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,   186,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    50,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      50,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   232,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      78,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     232,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    78,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    78,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    78,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      78,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    78,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    78,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    78,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    80,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    80,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    80,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,
+      -1,    -1,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   232,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   232,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     231,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   231,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   231,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   231,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   231,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   231,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,
+      -1,    -1,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   231,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     231,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   231,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   231,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   231,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   231,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,   119,
+     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
+     130,   131,   132,   133,   134,   135,   136,   137,   138,   139,
+     140,   141,   142,   143,   144,   145,   146,   147,   148,   149,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,    -1,
+      -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   231,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,
+      -1,    -1,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   231,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     231,   119,   120,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,   134,   135,   136,   137,
+     138,   139,   140,   141,   142,   143,   144,   145,   146,   147,
+     148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,
+      -1,   199,   200,   201,   202,   203,   204,   205,   206,   207,
+     208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,
+     218,   219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   231,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   231,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   231,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   231,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,    -1,    -1,   199,   200,   201,   202,   203,   204,   205,
+     206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,
+     216,   217,   218,   219,   220,   221,   222,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   230,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   230,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   136,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,
+     202,   203,   204,   205,   206,   207,   208,    -1,    -1,    -1,
+      -1,    -1,   214,   215,   216,   217,   218,   219,   220,   221,
+     222,    -1,    -1,    -1,    -1,    -1,    -1,   229,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,    -1,    -1,    -1,    -1,    -1,   228,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,   210,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,
+      -1,    -1,    -1,    -1,    -1,    -1,   183,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,
+      -1,    -1,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,    -1,    -1,    -1,    -1,    -1,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+     183,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,   183,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,   183,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   145,   146,   147,   148,   149,   150,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   175,   176,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   184,   185,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,   199,   200,
+     201,   202,   203,   204,   205,   206,   207,   208,    -1,    -1,
+      -1,    -1,    -1,   214,   215,   216,   217,   218,   219,   220,
+     221,   222,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   175,   176,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,
+      -1,    -1,   199,   200,   201,   202,   203,   204,   205,   206,
+     207,   208,    -1,    -1,   211,    -1,    -1,   214,   215,   216,
+     217,   218,   219,   220,   221,   222,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   142,   143,   144,   145,   146,   147,   148,
+     149,   150,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   175,   176,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   193,    -1,    -1,    -1,    -1,    -1,
+     199,   200,   201,   202,   203,   204,   205,   206,   207,   208,
+      -1,    -1,    -1,    -1,    -1,   214,   215,   216,   217,   218,
+     219,   220,   221,   222,   119,    -1,   121,    -1,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,
+      -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   121,    -1,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,   137,   138,   139,   140,   141,   142,
+     143,   144,   145,   146,   147,   148,   149,   150,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     193,    -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,
+      -1,   214,   215,   216,   217,   218,   219,   220,   221,   222,
+     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,    -1,    -1,    -1,    -1,    -1,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   133,
+     134,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   175,   176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+      -1,    -1,    -1,    -1,    -1,   199,   200,   201,   202,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   216,   217,   218,   219,   220,   221,   222,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   135,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,    -1,    -1,    -1,    -1,   175,
+     176,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,    -1,    -1,
+      -1,   175,   176,   199,   200,   201,   202,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   193,
+     216,   217,   218,   219,   220,   221,   222,   201,   202,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   218,   219,   220,   221,   222
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,     1,     3,    11,    12,    13,    14,    15,    16,    74,
+      78,    84,    92,   111,   233,   237,   238,   241,   281,   282,
+     288,   289,   327,   328,    78,   227,   281,     1,     3,    19,
+      20,    21,    36,    37,    78,   100,   221,   299,   300,   302,
+     327,   333,   334,     1,    19,    20,    21,    23,    24,    27,
+      28,    29,    31,    32,    33,    34,    35,    36,    37,    78,
+      83,    88,    89,    90,    91,    93,   117,   182,   214,   290,
+     291,   292,   327,   328,   330,   331,   333,     3,    83,   242,
+     327,   328,    83,   242,   327,   328,     1,    78,   174,   294,
+     295,   302,     3,     3,     5,     6,     8,     9,    10,    19,
+      20,    21,    30,    45,    52,    53,    54,    55,    56,    57,
+      58,    59,    60,    61,    62,    63,    64,    70,    71,    72,
+      81,    82,    95,    96,    97,    98,    99,   100,   107,   108,
+     109,   110,   112,   115,   116,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   177,   178,   179,   180,
+     181,   187,   188,   189,   190,   191,   192,   194,   195,   196,
+     198,   200,   212,   213,   216,   217,   223,   224,   227,   230,
+     234,   279,   280,   308,   309,   315,   324,   325,   326,   327,
+     329,     0,   238,   238,   282,    78,   232,   226,   230,   240,
+       3,    19,    20,    21,    22,   283,   285,   326,   333,    78,
+     235,   301,   302,   328,   301,   301,    78,    78,     3,   333,
+     300,    78,   230,   235,   301,    78,    19,    20,    21,    23,
+      24,    25,    26,    78,   308,   318,   319,    78,   319,    78,
+     319,    78,   319,    78,   319,    78,   308,    78,   308,   308,
+     308,    78,   308,    78,    78,   326,   308,   308,    78,    78,
+       3,   293,    17,   308,    78,   227,    28,   291,   292,   290,
+      78,   233,   308,   321,   322,   331,   332,   330,     6,   248,
+     250,    19,    20,    21,    22,   221,   226,   227,   244,   305,
+     306,   307,   327,   328,   333,    83,   242,   327,     6,   250,
+     226,    83,   242,    78,   229,   295,   226,   229,   226,   227,
+     226,   227,   230,   230,   230,   230,   230,   308,   227,   227,
+     227,   227,   227,   227,   227,   227,   227,   227,   227,   227,
+     227,   227,   227,   227,   230,   227,   227,   227,   227,   230,
+     233,   235,   227,   227,   227,   227,   227,   226,   308,   226,
+     308,   308,   308,   226,   308,   226,   308,   226,   308,   226,
+     308,   309,   327,   309,   309,   327,   327,   308,   308,   308,
+     227,   227,   227,   227,   309,   308,   226,   308,   226,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   227,   227,
+     227,   227,   308,   308,   226,   308,   308,   308,   309,   308,
+     309,   226,   308,   119,   120,   121,   122,   123,   124,   125,
+     126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   150,   175,   176,   184,   193,   199,
+     200,   201,   202,   203,   204,   205,   206,   207,   208,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   230,   113,
+     118,   160,   161,   162,   163,   164,   165,   173,   213,   224,
+     227,   230,   234,   235,   233,   230,   289,   308,   308,    78,
+     239,   230,   284,     3,     3,     3,     3,   228,   232,   220,
+     296,     3,   100,    78,   232,   302,    78,    78,   308,   100,
+      78,   230,   318,   230,   318,   230,   318,   318,   318,   318,
+     318,   210,    78,   232,    78,    78,    78,    78,    78,   232,
+      78,   232,    78,    78,    78,    78,    78,    78,     7,    45,
+      46,    88,   114,   228,   260,   261,   263,   264,   324,   326,
+     327,   213,   233,   320,   230,    78,   232,   332,    78,   232,
+     331,   242,     1,     4,    18,    31,    32,    38,    45,    46,
+      65,    66,    68,    69,    73,    75,    76,    78,    85,    86,
+     174,   182,   227,   247,   251,   252,   253,   254,   265,   266,
+     267,   268,   270,   278,   308,   309,   310,   312,   243,   305,
+     327,   228,   307,   229,   245,   327,   232,   226,   230,   306,
+       6,   250,   242,   243,   327,     6,   250,   326,   326,   326,
+     333,    14,    78,   286,   287,   333,   283,   308,   308,   308,
+     308,   308,    50,   308,   308,   308,   308,   216,   308,   316,
+     317,   324,   325,   326,   317,   317,   276,   308,   276,   276,
+     276,   276,   308,   317,   317,   317,   308,   319,   319,   319,
+     317,   308,   327,   327,   308,   308,   308,   308,   100,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   322,   308,   308,   100,   308,   228,   231,   308,
+     226,   308,   226,   308,   226,   308,   308,   308,   226,   308,
+     226,   308,   308,   308,   308,   308,   226,   308,   308,   308,
+     226,   308,   226,   308,   226,   308,   226,   308,   226,   308,
+     226,   308,   226,   308,   226,   308,   226,   308,   226,   308,
+     226,   308,   226,   308,   226,   308,   226,   308,   226,   308,
+     226,   308,   226,   308,   226,   308,   226,   308,   226,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   124,   226,   308,   226,   308,   226,   308,   226,
+     308,   226,   308,   226,   308,   226,   308,   226,   308,   226,
+     308,   308,   308,   308,   308,   228,   317,   308,    19,    20,
+      21,   230,   327,   327,   233,   308,   323,   231,   308,   284,
+     284,   284,   284,    78,    78,   285,   297,   298,   327,   228,
+     284,   302,   231,   309,   308,   318,   308,   308,   227,   227,
+     227,    78,   228,   232,   227,   320,   308,   308,   321,    78,
+     331,   243,    78,   227,   290,   290,    42,    44,    78,   308,
+     327,   308,   308,   308,   308,    78,    78,    78,   308,    78,
+     227,   317,    77,   251,   290,   290,   230,   313,   230,   255,
+     312,   249,   252,    78,   227,    78,   118,   232,   327,    78,
+     228,   307,   220,   246,    94,   306,    21,    22,    82,   167,
+     169,   215,   216,   217,   223,   308,   308,   242,   243,   243,
+      78,   242,   243,   296,   296,   296,    78,   242,   228,   287,
+      78,   228,   231,   231,   231,   231,   231,   308,   183,   183,
+     183,   183,   324,   325,   228,   232,   230,   230,   230,   228,
+     228,   228,    80,   228,   232,   228,   228,   228,   228,   228,
+     228,   231,   228,   228,   228,   228,   231,   232,   232,   232,
+     232,   228,   228,   228,   228,   228,   228,   228,   228,   228,
+     235,   173,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   185,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   231,
+     229,   314,   228,   231,   230,   230,   230,   323,   233,    80,
+     231,   231,   285,   232,   226,    78,   211,    78,    78,   322,
+     322,   322,    78,   262,   264,   228,   322,   308,   231,     6,
+      17,    17,   308,   308,   267,    43,    78,   186,    39,    78,
+      78,    78,    78,    78,   308,   317,    78,    77,    87,    87,
+     100,   308,   308,   232,     7,   228,   256,   258,   316,   227,
+     317,   309,   311,   312,    19,    20,    21,    22,   221,   302,
+     303,   304,   334,    78,    21,   217,    21,    21,    19,    20,
+      21,    22,   231,   243,   243,   243,    78,    78,    47,   276,
+     277,   277,   277,   277,   230,   230,   316,   308,   308,   308,
+     308,   316,   230,   308,   308,   308,   308,   327,   308,   308,
+       5,   100,   314,   308,   308,   308,   231,   323,   308,   298,
+     308,   228,   228,   228,   232,   228,   228,    78,    78,    42,
+      44,   327,   267,   327,   308,   267,   269,   269,    76,    76,
+     228,   231,   231,   231,   311,    78,   228,   232,   317,   232,
+     302,   302,   302,   302,    19,    20,    21,    22,   232,   302,
+      21,   308,   228,   232,   228,   228,   228,   308,   308,   231,
+     231,   231,   228,   308,   228,   228,   228,   228,   228,   229,
+     231,   231,   231,   231,   264,    78,   267,   267,   308,   308,
+      78,    78,    40,    47,    48,    49,    67,   271,   272,   273,
+     274,   275,   308,   271,    78,   228,    78,     7,   257,   259,
+     316,   228,   312,   302,   302,   302,   302,   303,   276,   231,
+     231,   231,   308,    78,    78,   267,   267,   308,    78,   308,
+     308,    77,   272,    78,   229,   232,    80,    77,   232,    41,
+      78,   267,    78,    78,   267,   275,   308,   259,   308,   267,
+     269,   269,    78,   267
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   236,   237,   237,   238,   238,   239,   240,   240,   241,
+     241,   241,   241,   241,   241,   241,   241,   241,   241,   241,
+     241,   241,   241,   241,   241,   242,   243,   244,   244,   244,
+     244,   245,   245,   246,   246,   247,   247,   247,   248,   249,
+     250,   251,   251,   252,   252,   252,   252,   253,   253,   253,
+     253,   253,   253,   253,   253,   253,   253,   253,   253,   254,
+     255,   255,   256,   256,   257,   257,   258,   258,   259,   259,
+     260,   260,   260,   260,   260,   260,   261,   261,   262,   262,
+     263,   264,   264,   264,   264,   265,   265,   266,   266,   266,
+     266,   267,   267,   268,   268,   269,   269,   269,   269,   270,
+     270,   271,   271,   272,   273,   274,   274,   275,   275,   275,
+     276,   276,   277,   277,   278,   278,   278,   278,   278,   278,
+     278,   278,   278,   278,   278,   278,   278,   278,   278,   279,
+     279,   280,   280,   281,   281,   282,   282,   282,   282,   282,
+     282,   282,   282,   282,   283,   283,   283,   284,   284,   285,
+     285,   285,   285,   285,   285,   286,   286,   287,   287,   288,
+     288,   289,   289,   289,   289,   289,   290,   290,   291,   291,
+     292,   292,   292,   292,   292,   292,   292,   292,   292,   292,
+     292,   292,   292,   292,   292,   292,   292,   292,   292,   292,
+     292,   292,   292,   292,   292,   292,   292,   292,   292,   292,
+     292,   292,   292,   292,   292,   292,   292,   292,   292,   292,
+     292,   293,   293,   294,   294,   295,   295,   295,   295,   295,
+     296,   296,   297,   297,   298,   299,   299,   300,   300,   300,
+     300,   300,   300,   300,   300,   300,   301,   301,   301,   302,
+     302,   303,   303,   303,   303,   303,   303,   303,   303,   303,
+     303,   304,   304,   305,   305,   305,   305,   305,   306,   306,
+     306,   306,   306,   306,   306,   306,   306,   306,   306,   306,
+     306,   306,   306,   306,   306,   306,   307,   307,   307,   307,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   308,   308,   308,   308,   308,   308,   308,   308,   308,
+     308,   309,   309,   309,   309,   309,   309,   309,   309,   309,
+     309,   309,   309,   309,   309,   309,   309,   309,   309,   309,
+     309,   309,   309,   309,   309,   309,   309,   309,   309,   310,
+     310,   311,   311,   312,   312,   313,   313,   313,   314,   314,
+     314,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
+     316,   316,   316,   316,   316,   316,   317,   317,   318,   318,
+     318,   318,   318,   318,   318,   318,   318,   319,   319,   320,
+     320,   321,   321,   321,   321,   322,   322,   323,   323,   324,
+     324,   324,   325,   326,   327,   327,   328,   329,   330,   330,
+     330,   331,   332,   332,   332,   333,   333,   333,   334,   334
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     2,     1,     2,     1,     0,     2,     2,
+       2,     3,     2,     2,     4,     4,     5,     5,     5,     5,
+       6,     6,     5,     5,     2,     5,     0,     0,     2,     1,
+       3,     0,     2,     0,     2,     0,     5,     1,     0,     0,
+       3,     1,     2,     1,     1,     1,     2,     2,     5,     3,
+       2,     3,     1,     2,     2,     2,     2,     4,     5,     2,
+       3,     0,     1,     3,     1,     3,     1,     1,     1,     1,
+       4,     3,     1,     4,     4,     4,     1,     3,     1,     3,
+       1,     1,     1,     1,     1,     5,     3,     1,     1,     1,
+       1,     3,     2,     4,     4,     1,     4,     5,     5,     6,
+       6,     1,     2,     3,     2,     1,     3,     1,     3,     1,
+       1,     3,     1,     3,     3,     6,     6,     5,     5,    10,
+       8,     6,     6,     4,     3,     3,     3,     3,     1,     6,
+       6,     6,     6,     1,     2,     2,     5,     6,     6,     6,
+       5,     5,     1,     2,     1,     3,     4,     3,     0,     2,
+       3,     3,     3,     3,     3,     1,     2,     1,     3,     1,
+       3,     3,     1,     4,     2,     5,     1,     2,     1,     2,
+       1,     2,     2,     3,     2,     3,     2,     3,     2,     3,
+       2,     3,     2,     3,     3,     4,     3,     3,     2,     2,
+       2,     2,     2,     3,     5,     2,     3,     5,     3,     3,
+       3,     2,     3,     2,     4,     5,     1,     2,     2,     2,
+       1,     0,     1,     1,     2,     1,     2,     4,     4,     4,
+       0,     2,     1,     3,     3,     1,     2,     3,     3,     3,
+       3,     2,     2,     2,     1,     2,     1,     2,     3,     1,
+       4,     1,     2,     3,     2,     3,     2,     3,     2,     3,
+       2,     1,     3,     1,     1,     1,     1,     1,     1,     4,
+       3,     2,     3,     3,     4,     4,     4,     3,     5,     3,
+       4,     4,     4,     4,     3,     3,     1,     2,     3,     3,
+       1,     1,     1,     4,     4,     4,     4,     4,     1,     2,
+       2,     2,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       4,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     7,     5,     3,     2,
+       1,     2,     2,     2,     2,     3,     3,     2,     3,     2,
+       2,     3,     2,     2,     3,     2,     3,     2,     2,     3,
+       3,     2,     2,     2,     2,     3,     2,     3,     1,     1,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     4,     4,     4,     4,     4,     1,     1,     6,
+       3,     1,     2,     2,     1,     4,     6,     7,     4,     3,
+       4,     4,     4,     3,     3,     4,     4,     4,     6,     3,
+       6,     3,     6,     3,     5,     3,     4,     2,     2,     5,
+       3,     1,     3,     1,     2,     3,     3,     0,     0,     2,
+       2,     5,     4,     6,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     6,     4,     1,     6,     6,     6,
+       6,     2,     2,     2,     2,     2,     2,     4,     4,     4,
+       1,     4,     4,     5,     5,     4,     1,     3,     1,     4,
+       2,     2,     2,     2,     2,     2,     2,     1,     3,     0,
+       1,     1,     3,     4,     4,     1,     3,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+       2,     1,     1,     2,     3,     1,     3,     3,     2,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = SPINYYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == SPINYYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use SPINYYerror or SPINYYUNDEF. */
+#define YYERRCODE SPINYYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if SPINYYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !SPINYYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !SPINYYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
+
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
+/* Return the length of YYSTR.  */
+static YYPTRDIFF_T
+yystrlen (const char *yystr)
+{
+  YYPTRDIFF_T yylen;
+  for (yylen = 0; yystr[yylen]; yylen++)
+    continue;
+  return yylen;
+}
+# endif
+#endif
+
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
+/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
+   YYDEST.  */
+static char *
+yystpcpy (char *yydest, const char *yysrc)
+{
+  char *yyd = yydest;
+  const char *yys = yysrc;
+
+  while ((*yyd++ = *yys++) != '\0')
+    continue;
+
+  return yyd - 1;
+}
+# endif
+#endif
+
+#ifndef yytnamerr
+/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
+   quotes and backslashes, so that it's suitable for yyerror.  The
+   heuristic is that double-quoting is unnecessary unless the string
+   contains an apostrophe, a comma, or backslash (other than
+   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
+   null, do not copy; instead, return the length of what the result
+   would have been.  */
+static YYPTRDIFF_T
+yytnamerr (char *yyres, const char *yystr)
+{
+  if (*yystr == '"')
+    {
+      YYPTRDIFF_T yyn = 0;
+      char const *yyp = yystr;
+      for (;;)
+        switch (*++yyp)
+          {
+          case '\'':
+          case ',':
+            goto do_not_strip_quotes;
+
+          case '\\':
+            if (*++yyp != '\\')
+              goto do_not_strip_quotes;
+            else
+              goto append;
+
+          append:
+          default:
+            if (yyres)
+              yyres[yyn] = *yyp;
+            yyn++;
+            break;
+
+          case '"':
+            if (yyres)
+              yyres[yyn] = '\0';
+            return yyn;
+          }
+    do_not_strip_quotes: ;
+    }
+
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
+    return yystrlen (yystr);
+}
+#endif
+
+
+static int
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  /* There are many possibilities here to consider:
+     - If this state is a consistent state with a default action, then
+       the only way this function was invoked is if the default action
+       is an error action.  In that case, don't check for expected
+       tokens because there are none.
+     - The only way there can be no lookahead present (in yychar) is if
+       this state is a consistent state with a default action.  Thus,
+       detecting the absence of a lookahead is sufficient to determine
+       that there is no unexpected or expected token to report.  In that
+       case, just report a simple "syntax error".
+     - Don't assume there isn't a lookahead just because this state is a
+       consistent state with a default action.  There might have been a
+       previous inconsistent state, consistent state with a non-default
+       action, or user semantic action that manipulated yychar.
+     - Of course, the expected token list depends on states to have
+       correct lookahead information, and it depends on the parser not
+       to perform extra reductions after fetching a lookahead from the
+       scanner and before detecting a syntax error.  Thus, state merging
+       (from LALR or IELR) and default reductions corrupt the expected
+       token list.  However, the list is correct for canonical LR with
+       one exception: it will still contain any token that will not be
+       accepted due to an error action in a later state.
+  */
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
+    }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
+
+  switch (yycount)
+    {
+#define YYCASE_(N, S)                       \
+      case N:                               \
+        yyformat = S;                       \
+        break
+    default: /* Avoid compiler warnings. */
+      YYCASE_(0, YY_("syntax error"));
+      YYCASE_(1, YY_("syntax error, unexpected %s"));
+      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
+      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
+    }
+
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
+  {
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
+  }
+
+  if (*yymsg_alloc < yysize)
+    {
+      *yymsg_alloc = 2 * yysize;
+      if (! (yysize <= *yymsg_alloc
+             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
+        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
+      return -1;
+    }
+
+  /* Avoid sprintf, as that infringes on the user's name space.
+     Don't have undefined behavior even if the translation
+     produced a string with the wrong number of "%s"s.  */
+  {
+    char *yyp = *yymsg;
+    int yyi = 0;
+    while ((*yyp = *yyformat) != '\0')
+      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
+        {
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
+          yyformat += 2;
+        }
+      else
+        {
+          ++yyp;
+          ++yyformat;
+        }
+  }
+  return 0;
+}
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+  /* Buffer for error messages, and its allocated size.  */
+  char yymsgbuf[128];
+  char *yymsg = yymsgbuf;
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = SPINYYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == SPINYYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= SPINYYEOF)
+    {
+      yychar = SPINYYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == SPINYYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = SPINYYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = SPINYYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* input: conblock rest  */
+#line 707 "frontends/spin/spin.y"
+    {
+        if (current) {
+            current->conblock = AddToListEx(current->conblock, (yyvsp[-1].list).head, &current->conblock_tail);
+        }
+    }
+#line 8540 "build/spin.tab.c"
+    break;
+
+  case 9: /* topelement: "CON" conblock  */
+#line 729 "frontends/spin/spin.y"
+    { (yyval.ast) = current->conblock = AddToListEx(current->conblock, (yyvsp[0].list).head, &current->conblock_tail); }
+#line 8546 "build/spin.tab.c"
+    break;
+
+  case 10: /* topelement: "DAT" datblock  */
+#line 731 "frontends/spin/spin.y"
+    { (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[0].ast), &current->datblock_tail); }
+#line 8552 "build/spin.tab.c"
+    break;
+
+  case 11: /* topelement: "DAT" annotation datblock  */
+#line 733 "frontends/spin/spin.y"
+    {
+      current->datannotations = AddToList(current->datannotations, (yyvsp[-1].ast));
+      (yyval.ast) = current->datblock = AddToListEx(current->datblock, (yyvsp[0].ast), &current->datblock_tail); 
+    }
+#line 8561 "build/spin.tab.c"
+    break;
+
+  case 12: /* topelement: "VAR" varblock  */
+#line 738 "frontends/spin/spin.y"
+    {
+        AST *vars = (yyvsp[0].list).head;
+        SpinDeclareVarSymbols(vars);
+        (yyval.ast) = current->pendingvarblock = AddToList(current->pendingvarblock, vars);
+    }
+#line 8571 "build/spin.tab.c"
+    break;
+
+  case 13: /* topelement: "OBJ" objblock  */
+#line 744 "frontends/spin/spin.y"
+    {
+        AST *objs = (yyvsp[0].list).head;
+        (yyval.ast) = current->objblock = AddToList(current->objblock, objs);
+        SpinDeclareObjectSymbols(objs);
+    }
+#line 8581 "build/spin.tab.c"
+    break;
+
+  case 14: /* topelement: "PUB" funcdef funcbody funcdef_end  */
+#line 750 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-2].ast)), 1, (yyvsp[-2].ast), (yyvsp[-1].ast), NULL, (yyvsp[-3].ast)); }
+#line 8587 "build/spin.tab.c"
+    break;
+
+  case 15: /* topelement: "PRI" funcdef funcbody funcdef_end  */
+#line 752 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-2].ast)), 0, (yyvsp[-2].ast), (yyvsp[-1].ast), NULL, (yyvsp[-3].ast)); }
+#line 8593 "build/spin.tab.c"
+    break;
+
+  case 16: /* topelement: "PUB" annotation funcdef funcbody funcdef_end  */
+#line 754 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-2].ast)), 1, (yyvsp[-2].ast), (yyvsp[-1].ast), (yyvsp[-3].ast), (yyvsp[-4].ast)); }
+#line 8599 "build/spin.tab.c"
+    break;
+
+  case 17: /* topelement: "PRI" annotation funcdef funcbody funcdef_end  */
+#line 756 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-2].ast)), 0, (yyvsp[-2].ast), (yyvsp[-1].ast), (yyvsp[-3].ast), (yyvsp[-4].ast)); }
+#line 8605 "build/spin.tab.c"
+    break;
+
+  case 18: /* topelement: "PUB" "FILE" "string" funcdef funcdef_end  */
+#line 758 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-1].ast)), 1, (yyvsp[-1].ast), (yyvsp[-2].ast), NULL, (yyvsp[-4].ast)); }
+#line 8611 "build/spin.tab.c"
+    break;
+
+  case 19: /* topelement: "PRI" "FILE" "string" funcdef funcdef_end  */
+#line 760 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-1].ast)), 0, (yyvsp[-1].ast), (yyvsp[-2].ast), NULL, (yyvsp[-4].ast)); }
+#line 8617 "build/spin.tab.c"
+    break;
+
+  case 20: /* topelement: "PUB" annotation "FILE" "string" funcdef funcdef_end  */
+#line 763 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-1].ast)), 1, (yyvsp[-1].ast), (yyvsp[-2].ast), (yyvsp[-4].ast), (yyvsp[-5].ast)); }
+#line 8623 "build/spin.tab.c"
+    break;
+
+  case 21: /* topelement: "PRI" annotation "FILE" "string" funcdef funcdef_end  */
+#line 765 "frontends/spin/spin.y"
+    { DeclareFunction(current, SpinRetType((yyvsp[-1].ast)), 0, (yyvsp[-1].ast), (yyvsp[-2].ast), (yyvsp[-4].ast), (yyvsp[-5].ast)); }
+#line 8629 "build/spin.tab.c"
+    break;
+
+  case 22: /* topelement: "PRI" identifier '=' identifier "end of line"  */
+#line 768 "frontends/spin/spin.y"
+    {
+        const char *oldname = GetIdentifierName((yyvsp[-1].ast));
+        const char *newname = GetIdentifierName((yyvsp[-3].ast));
+        AddSymbol(&current->objsyms, newname, SYM_WEAK_ALIAS, (void *)oldname, NULL);
+    }
+#line 8639 "build/spin.tab.c"
+    break;
+
+  case 23: /* topelement: "PUB" identifier '=' identifier "end of line"  */
+#line 774 "frontends/spin/spin.y"
+    {
+        const char *oldname = GetIdentifierName((yyvsp[-1].ast));
+        const char *newname = GetIdentifierName((yyvsp[-3].ast));
+        AddSymbol(&current->objsyms, newname, SYM_WEAK_ALIAS, (void *)oldname, NULL);
+    }
+#line 8649 "build/spin.tab.c"
+    break;
+
+  case 24: /* topelement: annotation emptylines  */
+#line 780 "frontends/spin/spin.y"
+    { DeclareToplevelAnnotation((yyvsp[-1].ast)); }
+#line 8655 "build/spin.tab.c"
+    break;
+
+  case 25: /* funcdef: identifier optparamlist resultname localvars "end of line"  */
+#line 785 "frontends/spin/spin.y"
+  {
+      AST *funcname = (yyvsp[-4].ast);
+      AST *paramlist = (yyvsp[-3].ast);
+      AST *resultname = (yyvsp[-2].ast);
+      AST *vars = (yyvsp[-1].ast);
+      AST *funcdecl = NewAST(AST_FUNCDECL, funcname, resultname);
+      AST *funcvars = NewAST(AST_FUNCVARS, paramlist, vars);
+      SpinAddLocalSymbol(funcname, SYM_FUNCTION, NULL);
+      PushCurrentTypes();
+      SpinDeclareFuncSymbols(paramlist, resultname, vars);
+      (yyval.ast) = NewAST(AST_FUNCDEF, funcdecl, funcvars);
+  }
+#line 8672 "build/spin.tab.c"
+    break;
+
+  case 26: /* funcdef_end: %empty  */
+#line 800 "frontends/spin/spin.y"
+  {
+      PopCurrentTypes();
+  }
+#line 8680 "build/spin.tab.c"
+    break;
+
+  case 27: /* optparamlist: %empty  */
+#line 807 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = NULL;
+      LANGUAGE_WARNING(LANG_SPIN_SPIN2, NULL, "omitting () for empty parameter lists is a flexspin extension");
+  }
+#line 8689 "build/spin.tab.c"
+    break;
+
+  case 28: /* optparamlist: '(' ')'  */
+#line 812 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = NULL;
+      LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "() for empty parameter lists is a flexspin extension");
+  }
+#line 8698 "build/spin.tab.c"
+    break;
+
+  case 29: /* optparamlist: paramidentlist  */
+#line 817 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].list).head; }
+#line 8704 "build/spin.tab.c"
+    break;
+
+  case 30: /* optparamlist: '(' paramidentlist ')'  */
+#line 819 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[-1].list).head; }
+#line 8710 "build/spin.tab.c"
+    break;
+
+  case 31: /* resultname: %empty  */
+#line 824 "frontends/spin/spin.y"
+  { (yyval.ast) = NULL; }
+#line 8716 "build/spin.tab.c"
+    break;
+
+  case 32: /* resultname: ':' paramidentlist  */
+#line 826 "frontends/spin/spin.y"
+  {
+      // handle the common case of just one identifier by
+      // unwrapping the list
+      AST *list = (yyvsp[0].list).head;
+      if (list->kind == AST_LISTHOLDER && list->right == NULL) {
+          list = list->left;
+      }
+      (yyval.ast) = list;
+  }
+#line 8730 "build/spin.tab.c"
+    break;
+
+  case 33: /* localvars: %empty  */
+#line 839 "frontends/spin/spin.y"
+  { (yyval.ast) = NULL; }
+#line 8736 "build/spin.tab.c"
+    break;
+
+  case 34: /* localvars: '|' vardecllist  */
+#line 841 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].list).head; }
+#line 8742 "build/spin.tab.c"
+    break;
+
+  case 35: /* funcbody_internal: %empty  */
+#line 846 "frontends/spin/spin.y"
+  { (yyval.ast) = NULL; }
+#line 8748 "build/spin.tab.c"
+    break;
+
+  case 36: /* funcbody_internal: "__bytecode__" '(' "string" ')' "end of line"  */
+#line 848 "frontends/spin/spin.y"
+  {
+      AST *str = (yyvsp[-2].ast);
+      str->kind = AST_BYTECODE;
+      (yyval.ast) = str;
+  }
+#line 8758 "build/spin.tab.c"
+    break;
+
+  case 37: /* funcbody_internal: stmtlist  */
+#line 854 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].list).head; }
+#line 8764 "build/spin.tab.c"
+    break;
+
+  case 38: /* enter_func: %empty  */
+#line 858 "frontends/spin/spin.y"
+  {
+      gl_in_spin2_funcbody = 1;
+  }
+#line 8772 "build/spin.tab.c"
+    break;
+
+  case 39: /* exit_func: %empty  */
+#line 864 "frontends/spin/spin.y"
+  {
+      gl_in_spin2_funcbody = 0;
+  }
+#line 8780 "build/spin.tab.c"
+    break;
+
+  case 40: /* funcbody: enter_func funcbody_internal exit_func  */
+#line 870 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[-1].ast); }
+#line 8786 "build/spin.tab.c"
+    break;
+
+  case 41: /* stmtlist: stmt  */
+#line 875 "frontends/spin/spin.y"
+    {
+        (yyval.list) = ListBuilderStart((yyvsp[0].ast));
+    }
+#line 8794 "build/spin.tab.c"
+    break;
+
+  case 42: /* stmtlist: stmtlist stmt  */
+#line 879 "frontends/spin/spin.y"
+  {
+      (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast));
+  }
+#line 8802 "build/spin.tab.c"
+    break;
+
+  case 43: /* stmt: basicstmt  */
+#line 886 "frontends/spin/spin.y"
+    {  (yyval.ast) = NewCommentedStatement((yyvsp[0].ast)); }
+#line 8808 "build/spin.tab.c"
+    break;
+
+  case 44: /* stmt: compoundstmt  */
+#line 888 "frontends/spin/spin.y"
+    { (yyval.ast) = NewStatement((yyvsp[0].ast)); }
+#line 8814 "build/spin.tab.c"
+    break;
+
+  case 45: /* stmt: "end of line"  */
+#line 890 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 8820 "build/spin.tab.c"
+    break;
+
+  case 46: /* stmt: error "end of line"  */
+#line 892 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 8826 "build/spin.tab.c"
+    break;
+
+  case 47: /* basicstmt: "RETURN" "end of line"  */
+#line 897 "frontends/spin/spin.y"
+    { (yyval.ast) = AstReturn(NULL, (yyvsp[-1].ast)); }
+#line 8832 "build/spin.tab.c"
+    break;
+
+  case 48: /* basicstmt: "RETURN" '(' exprlist ')' "end of line"  */
+#line 899 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = AstReturn((yyvsp[-2].list).head, (yyvsp[-4].ast));
+    }
+#line 8840 "build/spin.tab.c"
+    break;
+
+  case 49: /* basicstmt: "RETURN" exprlist "end of line"  */
+#line 903 "frontends/spin/spin.y"
+    { (yyval.ast) = AstReturn((yyvsp[-1].list).head, (yyvsp[-2].ast)); }
+#line 8846 "build/spin.tab.c"
+    break;
+
+  case 50: /* basicstmt: "ABORT" "end of line"  */
+#line 905 "frontends/spin/spin.y"
+    {
+        if (current && current->curLanguage == LANG_SPIN_SPIN2) {
+            // in Spin2 plain "abort" is the same as "abort 0"
+            (yyval.ast) = AstAbort(AstInteger(0), (yyvsp[-1].ast));
+        } else {
+            // in Spin1 plain "abort" should return the result variable
+            (yyval.ast) = AstAbort(NULL, (yyvsp[-1].ast));
+        }
+    }
+#line 8860 "build/spin.tab.c"
+    break;
+
+  case 51: /* basicstmt: "ABORT" expr "end of line"  */
+#line 915 "frontends/spin/spin.y"
+    { (yyval.ast) = AstAbort((yyvsp[-1].ast), (yyvsp[-2].ast)); }
+#line 8866 "build/spin.tab.c"
+    break;
+
+  case 53: /* basicstmt: expr "end of line"  */
+#line 918 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 8872 "build/spin.tab.c"
+    break;
+
+  case 54: /* basicstmt: "QUIT" "end of line"  */
+#line 920 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_QUITLOOP, NULL, NULL, (yyvsp[-1].ast)); }
+#line 8878 "build/spin.tab.c"
+    break;
+
+  case 55: /* basicstmt: "NEXT" "end of line"  */
+#line 922 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_CONTINUE, NULL, NULL, (yyvsp[-1].ast)); }
+#line 8884 "build/spin.tab.c"
+    break;
+
+  case 56: /* basicstmt: debug_prefix "end of line"  */
+#line 924 "frontends/spin/spin.y"
+    {
+        AST *ast = NULL;
+        if (gl_brkdebug) ast = NewAST(AST_BRKDEBUG, NULL, NULL);
+        (yyval.ast) = ast;
+    }
+#line 8894 "build/spin.tab.c"
+    break;
+
+  case 57: /* basicstmt: debug_prefix '(' ')' "end of line"  */
+#line 930 "frontends/spin/spin.y"
+    {
+        AST *ast = NULL;
+        (yyval.ast) = ast;
+    }
+#line 8903 "build/spin.tab.c"
+    break;
+
+  case 58: /* basicstmt: debug_prefix '(' debug_exprlist ')' "end of line"  */
+#line 935 "frontends/spin/spin.y"
+    {
+        AST *ast = BuildDebugList((yyvsp[-2].ast), (yyvsp[-4].ast));
+        (yyval.ast) = ast;
+    }
+#line 8912 "build/spin.tab.c"
+    break;
+
+  case 59: /* debug_prefix: "DEBUG" optdebugmask  */
+#line 943 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = (yyvsp[0].ast);
+  }
+#line 8920 "build/spin.tab.c"
+    break;
+
+  case 60: /* optdebugmask: '[' expr ']'  */
+#line 950 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 8926 "build/spin.tab.c"
+    break;
+
+  case 61: /* optdebugmask: %empty  */
+#line 952 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 8932 "build/spin.tab.c"
+    break;
+
+  case 62: /* debug_exprlist: debug_expritem_first  */
+#line 957 "frontends/spin/spin.y"
+     { (yyval.ast) = (yyvsp[0].ast); }
+#line 8938 "build/spin.tab.c"
+    break;
+
+  case 63: /* debug_exprlist: debug_expritem_first ',' debug_exprlist_continue  */
+#line 959 "frontends/spin/spin.y"
+     { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 8944 "build/spin.tab.c"
+    break;
+
+  case 64: /* debug_exprlist_continue: debug_expritem  */
+#line 964 "frontends/spin/spin.y"
+     { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 8950 "build/spin.tab.c"
+    break;
+
+  case 65: /* debug_exprlist_continue: debug_exprlist_continue ',' debug_expritem  */
+#line 966 "frontends/spin/spin.y"
+     { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 8956 "build/spin.tab.c"
+    break;
+
+  case 66: /* debug_expritem_first: "` string"  */
+#line 971 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+    }
+#line 8964 "build/spin.tab.c"
+    break;
+
+  case 67: /* debug_expritem_first: expritem  */
+#line 975 "frontends/spin/spin.y"
+    {
+        AST *list = (yyvsp[0].ast);
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        (yyval.ast) = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 8975 "build/spin.tab.c"
+    break;
+
+  case 68: /* debug_expritem: "` string"  */
+#line 984 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 8981 "build/spin.tab.c"
+    break;
+
+  case 69: /* debug_expritem: expritem  */
+#line 986 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 8987 "build/spin.tab.c"
+    break;
+
+  case 70: /* asmdebug_func: identifier '(' operandlist ')'  */
+#line 991 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall((yyvsp[-3].ast),(yyvsp[-1].list).head,NULL);}
+#line 8993 "build/spin.tab.c"
+    break;
+
+  case 71: /* asmdebug_func: identifier '(' ')'  */
+#line 993 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall((yyvsp[-2].ast),NULL,NULL);}
+#line 8999 "build/spin.tab.c"
+    break;
+
+  case 72: /* asmdebug_func: "C_Z"  */
+#line 995 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall(AstIdentifier("c_z"),NULL,NULL);}
+#line 9005 "build/spin.tab.c"
+    break;
+
+  case 73: /* asmdebug_func: "IF" '(' operandlist ')'  */
+#line 997 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall(AstIdentifier("if"),(yyvsp[-1].list).head,NULL);}
+#line 9011 "build/spin.tab.c"
+    break;
+
+  case 74: /* asmdebug_func: "IFNOT" '(' operandlist ')'  */
+#line 999 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall(AstIdentifier("ifnot"),(yyvsp[-1].list).head,NULL);}
+#line 9017 "build/spin.tab.c"
+    break;
+
+  case 75: /* asmdebug_func: "%IF" '(' operandlist ')'  */
+#line 1001 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall(AstIdentifier("if"),(yyvsp[-1].list).head,NULL);}
+#line 9023 "build/spin.tab.c"
+    break;
+
+  case 77: /* asmdebug_exprlist: asmdebug_expritem_first ',' asmdebug_exprlist_continue  */
+#line 1007 "frontends/spin/spin.y"
+     { (yyval.ast) = AddToList((yyvsp[-2].ast), (yyvsp[0].list).head); }
+#line 9029 "build/spin.tab.c"
+    break;
+
+  case 78: /* asmdebug_exprlist_continue: asmdebug_expritem  */
+#line 1012 "frontends/spin/spin.y"
+     { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 9035 "build/spin.tab.c"
+    break;
+
+  case 79: /* asmdebug_exprlist_continue: asmdebug_exprlist_continue ',' asmdebug_expritem  */
+#line 1014 "frontends/spin/spin.y"
+     { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 9041 "build/spin.tab.c"
+    break;
+
+  case 80: /* asmdebug_expritem_first: asmdebug_expritem  */
+#line 1024 "frontends/spin/spin.y"
+    {
+        AST *list = (yyvsp[0].ast);
+        AST *note = NewAST(AST_LABEL, NULL, NULL);
+
+        (yyval.ast) = NewAST(AST_EXPRLIST, note, list);
+    }
+#line 9052 "build/spin.tab.c"
+    break;
+
+  case 81: /* asmdebug_expritem: "` string"  */
+#line 1034 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9058 "build/spin.tab.c"
+    break;
+
+  case 82: /* asmdebug_expritem: string  */
+#line 1036 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9064 "build/spin.tab.c"
+    break;
+
+  case 83: /* asmdebug_expritem: integer  */
+#line 1038 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9070 "build/spin.tab.c"
+    break;
+
+  case 84: /* asmdebug_expritem: asmdebug_func  */
+#line 1040 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9076 "build/spin.tab.c"
+    break;
+
+  case 85: /* multiassign: lhsseq ":=" '(' exprlist ')'  */
+#line 1045 "frontends/spin/spin.y"
+    { (yyval.ast) = AstAssignList((yyvsp[-4].ast), (yyvsp[-1].list).head, (yyvsp[-3].ast)); }
+#line 9082 "build/spin.tab.c"
+    break;
+
+  case 86: /* multiassign: lhsseq ":=" exprlist  */
+#line 1047 "frontends/spin/spin.y"
+    { (yyval.ast) = AstAssignList((yyvsp[-2].ast), (yyvsp[0].list).head, (yyvsp[-1].ast)); }
+#line 9088 "build/spin.tab.c"
+    break;
+
+  case 87: /* compoundstmt: ifstmt  */
+#line 1051 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 9094 "build/spin.tab.c"
+    break;
+
+  case 88: /* compoundstmt: repeatstmt  */
+#line 1053 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 9100 "build/spin.tab.c"
+    break;
+
+  case 89: /* compoundstmt: stmtblock  */
+#line 1055 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 9106 "build/spin.tab.c"
+    break;
+
+  case 90: /* compoundstmt: casestmt  */
+#line 1057 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 9112 "build/spin.tab.c"
+    break;
+
+  case 91: /* stmtblock: "indentation" stmtlist "lack of indentation"  */
+#line 1062 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[-1].list).head; }
+#line 9118 "build/spin.tab.c"
+    break;
+
+  case 92: /* stmtblock: "indentation" "lack of indentation"  */
+#line 1064 "frontends/spin/spin.y"
+  { (yyval.ast) = NULL; }
+#line 9124 "build/spin.tab.c"
+    break;
+
+  case 93: /* ifstmt: "IF" expr "end of line" elseblock  */
+#line 1069 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_IF, (yyvsp[-2].ast), (yyvsp[0].ast), (yyvsp[-3].ast)); }
+#line 9130 "build/spin.tab.c"
+    break;
+
+  case 94: /* ifstmt: "IFNOT" expr "end of line" elseblock  */
+#line 1071 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_IF, AstOperator(K_BOOL_NOT, NULL, (yyvsp[-2].ast)), (yyvsp[0].ast), (yyvsp[-3].ast)); }
+#line 9136 "build/spin.tab.c"
+    break;
+
+  case 95: /* elseblock: stmtblock  */
+#line 1076 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[0].ast), NULL); }
+#line 9142 "build/spin.tab.c"
+    break;
+
+  case 96: /* elseblock: stmtblock "ELSE" "end of line" stmtblock  */
+#line 1078 "frontends/spin/spin.y"
+  { (yyval.ast) = NewCommentedAST(AST_THENELSE, (yyvsp[-3].ast), (yyvsp[0].ast), (yyvsp[-2].ast)); }
+#line 9148 "build/spin.tab.c"
+    break;
+
+  case 97: /* elseblock: stmtblock "ELSEIF" expr "end of line" elseblock  */
+#line 1080 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-4].ast), NewAST(AST_STMTLIST, NewCommentedAST(AST_IF, (yyvsp[-2].ast), (yyvsp[0].ast), (yyvsp[-3].ast)), NULL)); }
+#line 9154 "build/spin.tab.c"
+    break;
+
+  case 98: /* elseblock: stmtblock "ELSEIFNOT" expr "end of line" elseblock  */
+#line 1082 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_THENELSE, (yyvsp[-4].ast), NewAST(AST_STMTLIST, NewCommentedAST(AST_IF, AstOperator(K_BOOL_NOT, NULL, (yyvsp[-2].ast)), (yyvsp[0].ast), (yyvsp[-3].ast)), NULL)); }
+#line 9160 "build/spin.tab.c"
+    break;
+
+  case 99: /* casestmt: "CASE" expr "end of line" "indentation" casematchlist "lack of indentation"  */
+#line 1087 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_CASE, (yyvsp[-4].ast), (yyvsp[-1].list).head, (yyvsp[-5].ast)); }
+#line 9166 "build/spin.tab.c"
+    break;
+
+  case 100: /* casestmt: "CASE_FAST" expr "end of line" "indentation" casematchlist "lack of indentation"  */
+#line 1089 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_CASETABLE, (yyvsp[-4].ast), (yyvsp[-1].list).head, (yyvsp[-5].ast)); }
+#line 9172 "build/spin.tab.c"
+    break;
+
+  case 101: /* casematchlist: casematchitem  */
+#line 1094 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 9178 "build/spin.tab.c"
+    break;
+
+  case 102: /* casematchlist: casematchlist casematchitem  */
+#line 1096 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 9184 "build/spin.tab.c"
+    break;
+
+  case 103: /* casematchitem: casematch "end of line" stmtblock  */
+#line 1101 "frontends/spin/spin.y"
+    {
+        AST *expr = (yyvsp[-2].ast);
+        AST *stmts = (yyvsp[0].ast);
+        AST *firststmt;
+        AST *breakstmt = NewAST(AST_ENDCASE, NULL, NULL);
+        stmts = AddToList(stmts, NewAST(AST_STMTLIST, breakstmt, NULL));
+        firststmt = stmts->left;
+        if (expr->kind == AST_OTHER) {
+            stmts->left = NewAST(AST_OTHER, firststmt, NULL);
+        } else {
+            stmts->left = NewAST(AST_CASEITEM, expr, firststmt);
+        }
+        (yyval.ast) = stmts;
+    }
+#line 9203 "build/spin.tab.c"
+    break;
+
+  case 104: /* casematch: matchexprlist ':'  */
+#line 1119 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = (yyvsp[-1].list).head;
+      EstablishIndent(current->Lptr, -1);
+      resetLineState(current->Lptr);
+  }
+#line 9213 "build/spin.tab.c"
+    break;
+
+  case 105: /* matchexprlist: matchexpritem  */
+#line 1127 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 9219 "build/spin.tab.c"
+    break;
+
+  case 106: /* matchexprlist: matchexprlist ',' matchexpritem  */
+#line 1129 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 9225 "build/spin.tab.c"
+    break;
+
+  case 107: /* matchexpritem: "OTHER"  */
+#line 1134 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_OTHER, NULL, NULL); }
+#line 9231 "build/spin.tab.c"
+    break;
+
+  case 108: /* matchexpritem: expr ".." expr  */
+#line 1136 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, (yyvsp[-2].ast), (yyvsp[0].ast)), NULL); }
+#line 9237 "build/spin.tab.c"
+    break;
+
+  case 109: /* matchexpritem: expr  */
+#line 1138 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9243 "build/spin.tab.c"
+    break;
+
+  case 110: /* rangeexpritem: expr  */
+#line 1144 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 9249 "build/spin.tab.c"
+    break;
+
+  case 111: /* rangeexpritem: expr ".." expr  */
+#line 1146 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_RANGE, (yyvsp[-2].ast), (yyvsp[0].ast)), NULL); }
+#line 9255 "build/spin.tab.c"
+    break;
+
+  case 112: /* rangeexprlist: rangeexpritem  */
+#line 1151 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 9261 "build/spin.tab.c"
+    break;
+
+  case 113: /* rangeexprlist: rangeexprlist ',' rangeexpritem  */
+#line 1153 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 9267 "build/spin.tab.c"
+    break;
+
+  case 114: /* repeatstmt: "REPEAT" "end of line" stmtblock  */
+#line 1158 "frontends/spin/spin.y"
+    {   AST *body = (yyvsp[0].ast); body = CheckYield(body);
+        AST *one = AstInteger(1);
+        one->lineidx = (yyvsp[-2].ast)->lineidx;
+        (yyval.ast) = NewCommentedAST(AST_WHILE, one, body, (yyvsp[-2].ast));
+        (yyval.ast)->lineidx = (yyvsp[-2].ast)->lineidx;
+    }
+#line 9278 "build/spin.tab.c"
+    break;
+
+  case 115: /* repeatstmt: "REPEAT" "end of line" stmtblock "WHILE" expr "end of line"  */
+#line 1165 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_DOWHILE, (yyvsp[-1].ast), CheckYield((yyvsp[-3].ast)), (yyvsp[-5].ast)); }
+#line 9284 "build/spin.tab.c"
+    break;
+
+  case 116: /* repeatstmt: "REPEAT" "end of line" stmtblock "UNTIL" expr "end of line"  */
+#line 1167 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_DOWHILE, AstOperator(K_BOOL_NOT, NULL, (yyvsp[-1].ast)), CheckYield((yyvsp[-3].ast)), (yyvsp[-5].ast)); }
+#line 9290 "build/spin.tab.c"
+    break;
+
+  case 117: /* repeatstmt: "REPEAT" "WHILE" expr "end of line" stmtblock  */
+#line 1169 "frontends/spin/spin.y"
+    {   AST *body = (yyvsp[0].ast); body = CheckYield(body); 
+        (yyval.ast) = NewCommentedAST(AST_WHILE, (yyvsp[-2].ast), body, (yyvsp[-4].ast));
+        (yyval.ast)->lineidx = (yyvsp[-4].ast)->lineidx;
+    }
+#line 9299 "build/spin.tab.c"
+    break;
+
+  case 118: /* repeatstmt: "REPEAT" "UNTIL" expr "end of line" stmtblock  */
+#line 1174 "frontends/spin/spin.y"
+    {   AST *body = (yyvsp[0].ast);
+        AST *expr = AstOperator(K_BOOL_NOT, NULL, (yyvsp[-2].ast));
+        expr->lineidx = (yyvsp[-2].ast)->lineidx;
+        body = CheckYield(body); 
+        (yyval.ast) = NewCommentedAST(AST_WHILE, expr, body, (yyvsp[-4].ast));
+        (yyval.ast)->lineidx = (yyvsp[-4].ast)->lineidx;
+    }
+#line 9311 "build/spin.tab.c"
+    break;
+
+  case 119: /* repeatstmt: "REPEAT" identifier "FROM" expr "TO" expr "STEP" expr "end of line" stmtblock  */
+#line 1182 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step; 
+      step = NewAST(AST_STEP, (yyvsp[-2].ast), (yyvsp[0].ast));
+      to = NewAST(AST_TO, (yyvsp[-4].ast), step);
+      from = NewAST(AST_FROM, (yyvsp[-6].ast), to);
+      (yyval.ast) = NewCommentedAST(AST_COUNTREPEAT, (yyvsp[-8].ast), from, (yyvsp[-9].ast));
+    }
+#line 9323 "build/spin.tab.c"
+    break;
+
+  case 120: /* repeatstmt: "REPEAT" identifier "FROM" expr "TO" expr "end of line" stmtblock  */
+#line 1190 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step; 
+      step = NewAST(AST_STEP, AstInteger(1), (yyvsp[0].ast));
+      to = NewAST(AST_TO, (yyvsp[-2].ast), step);
+      from = NewAST(AST_FROM, (yyvsp[-4].ast), to);
+      (yyval.ast) = NewCommentedAST(AST_COUNTREPEAT, (yyvsp[-6].ast), from, (yyvsp[-7].ast));
+    }
+#line 9335 "build/spin.tab.c"
+    break;
+
+  case 121: /* repeatstmt: "REPEAT" expr ": after repeat" identifier "end of line" stmtblock  */
+#line 1198 "frontends/spin/spin.y"
+    {
+      AST *body = CheckYield((yyvsp[0].ast));
+      AST *step = NewAST(AST_STEP,AstInteger(1),body);
+      AST *to = NewAST(AST_TO, AstOperator('-',(yyvsp[-4].ast),AstInteger(1)), step);
+      AST *from = NewAST(AST_FROM, AstInteger(0), to);
+      (yyval.ast) = NewCommentedAST(AST_COUNTREPEAT, (yyvsp[-2].ast), from, (yyvsp[-5].ast));
+    }
+#line 9347 "build/spin.tab.c"
+    break;
+
+  case 122: /* repeatstmt: "REPEAT" expr "WITH" identifier "end of line" stmtblock  */
+#line 1206 "frontends/spin/spin.y"
+    {
+      AST *body = CheckYield((yyvsp[0].ast));
+      AST *step = NewAST(AST_STEP,AstInteger(1),body);
+      AST *to = NewAST(AST_TO, AstOperator('-',(yyvsp[-4].ast),AstInteger(1)), step);
+      AST *from = NewAST(AST_FROM, AstInteger(0), to);
+      (yyval.ast) = NewCommentedAST(AST_COUNTREPEAT, (yyvsp[-2].ast), from, (yyvsp[-5].ast));
+    }
+#line 9359 "build/spin.tab.c"
+    break;
+
+  case 123: /* repeatstmt: "REPEAT" expr "end of line" stmtblock  */
+#line 1214 "frontends/spin/spin.y"
+    {
+      AST *from, *to, *step;
+      AST *body = (yyvsp[0].ast);
+      body = CheckYield(body);
+      step = NewAST(AST_STEP, AstInteger(1), body);
+      to = NewAST(AST_TO, (yyvsp[-2].ast), step);
+      from = NewAST(AST_FROM, NULL, to);
+      (yyval.ast) = NewCommentedAST(AST_COUNTREPEAT, NULL, from, (yyvsp[-3].ast));
+    }
+#line 9373 "build/spin.tab.c"
+    break;
+
+  case 124: /* repeatstmt: "ASM" datblock "ENDASM"  */
+#line 1224 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, (yyvsp[-1].ast), AstInteger(0), (yyvsp[-2].ast));
+        (yyval.ast) = ast;
+        LANGUAGE_WARNING(LANG_ANY, NULL, "asm/endasm is a flexspin extension");
+    }
+#line 9383 "build/spin.tab.c"
+    break;
+
+  case 125: /* repeatstmt: "ASM_CONST" datblock "ENDASM"  */
+#line 1230 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, (yyvsp[-1].ast), AstInteger(INLINE_ASM_FLAG_CONST), (yyvsp[-2].ast));
+        (yyval.ast) = ast;
+        LANGUAGE_WARNING(LANG_ANY, NULL, "asm/endasm is a flexspin extension");
+    }
+#line 9393 "build/spin.tab.c"
+    break;
+
+  case 126: /* repeatstmt: "ORGH" datblock "END"  */
+#line 1236 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, (yyvsp[-1].ast), AstInteger(INLINE_ASM_FLAG_CONST), (yyvsp[-2].ast));
+        (yyval.ast) = ast;
+    }
+#line 9402 "build/spin.tab.c"
+    break;
+
+  case 127: /* repeatstmt: "ORG" datblock "END"  */
+#line 1241 "frontends/spin/spin.y"
+    {
+        AST *ast = NewCommentedAST(AST_INLINEASM, (yyvsp[-1].ast), AstInteger(INLINE_ASM_FLAG_VOLATILE), (yyvsp[-2].ast));
+        (yyval.ast) = ast;
+    }
+#line 9411 "build/spin.tab.c"
+    break;
+
+  case 128: /* repeatstmt: "CCODE"  */
+#line 1246 "frontends/spin/spin.y"
+    {  (yyval.ast) = (yyvsp[0].ast); }
+#line 9417 "build/spin.tab.c"
+    break;
+
+  case 129: /* lookupexpr: "LOOKUPZ" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 1251 "frontends/spin/spin.y"
+    { (yyval.ast) = AstLookup(AST_LOOKUP, 0, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 9423 "build/spin.tab.c"
+    break;
+
+  case 130: /* lookupexpr: "LOOKUP" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 1253 "frontends/spin/spin.y"
+    { (yyval.ast) = AstLookup(AST_LOOKUP, 1, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 9429 "build/spin.tab.c"
+    break;
+
+  case 131: /* lookdownexpr: "LOOKDOWNZ" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 1257 "frontends/spin/spin.y"
+    { (yyval.ast) = AstLookup(AST_LOOKDOWN, 0, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 9435 "build/spin.tab.c"
+    break;
+
+  case 132: /* lookdownexpr: "LOOKDOWN" '(' expr ": after lookup/down" rangeexprlist ')'  */
+#line 1259 "frontends/spin/spin.y"
+    { (yyval.ast) = AstLookup(AST_LOOKDOWN, 1, (yyvsp[-3].ast), (yyvsp[-1].list).head); }
+#line 9441 "build/spin.tab.c"
+    break;
+
+  case 133: /* conblock: conline  */
+#line 1264 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 9447 "build/spin.tab.c"
+    break;
+
+  case 134: /* conblock: conblock conline  */
+#line 1266 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 9453 "build/spin.tab.c"
+    break;
+
+  case 135: /* conline: enumlist "end of line"  */
+#line 1271 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].list).head; }
+#line 9459 "build/spin.tab.c"
+    break;
+
+  case 136: /* conline: "identifier" '(' structlist ')' "end of line"  */
+#line 1273 "frontends/spin/spin.y"
+    {
+        /* basically an inline object definition */
+        AST *defs = (yyvsp[-2].list).head;
+        AST *name = (yyvsp[-4].ast);
+        SpinDeclareStruct(name, defs);
+        (yyval.ast) = NULL;
+    }
+#line 9471 "build/spin.tab.c"
+    break;
+
+  case 137: /* conline: "%INTERFACE" "identifier" '(' ifacelist ')' "end of line"  */
+#line 1281 "frontends/spin/spin.y"
+    {
+        /* basically an inline object definition */
+        AST *defs = (yyvsp[-2].list).head;
+        AST *name = (yyvsp[-4].ast);
+        SpinDeclareInterface(name, defs);
+        (yyval.ast) = NULL;
+    }
+#line 9483 "build/spin.tab.c"
+    break;
+
+  case 138: /* conline: "STRUCT" "identifier" '(' structlist ')' "end of line"  */
+#line 1289 "frontends/spin/spin.y"
+    {
+        /* basically an inline object definition */
+        AST *defs = (yyvsp[-2].list).head;
+        AST *name = (yyvsp[-4].ast);
+        SpinDeclareStruct(name, defs);
+        (yyval.ast) = NULL;
+    }
+#line 9495 "build/spin.tab.c"
+    break;
+
+  case 139: /* conline: "identifier" '(' string optobjparams ')' "end of line"  */
+#line 1297 "frontends/spin/spin.y"
+    {
+        /* basically an inline object definition */
+        AST *paramlist = (yyvsp[-2].ast);
+        AST *filename = (yyvsp[-3].ast);
+        AST *ident = (yyvsp[-5].ast);
+        AST *typ = NewAbstractObjectWithParams(ident, filename, 1, paramlist);
+        AddSymbol(currentTypes, GetUserIdentifierName(ident), SYM_TYPEDEF, typ, NULL);
+        (yyval.ast) = NULL;
+    }
+#line 9509 "build/spin.tab.c"
+    break;
+
+  case 140: /* conline: "STRUCT" "identifier" '=' structname "end of line"  */
+#line 1307 "frontends/spin/spin.y"
+    {
+        /* basically a type alias*/
+        AST *oldtype = (yyvsp[-1].ast);
+        AST *ident = (yyvsp[-3].ast);
+        const char *name = GetUserIdentifierName(ident);
+        AddSymbol(currentTypes, name, SYM_TYPEDEF, oldtype, NULL);
+        (yyval.ast) = NULL;
+    }
+#line 9522 "build/spin.tab.c"
+    break;
+
+  case 141: /* conline: "%INTERFACE" "identifier" '=' structname "end of line"  */
+#line 1316 "frontends/spin/spin.y"
+    {
+        /* basically a type alias*/
+        AST *oldtype = (yyvsp[-1].ast);
+        AST *ident = (yyvsp[-3].ast);
+        Module *P = GetClassPtr(oldtype);
+        const char *name = GetUserIdentifierName(ident);
+        AddSymbol(currentTypes, name, SYM_TYPEDEF, oldtype, NULL);
+        (yyval.ast) = NULL;
+        if (!P->isInterface) {
+            ERROR(ident, "item assigned to `%s' is not an interface",
+                  name);
+        }
+    }
+#line 9540 "build/spin.tab.c"
+    break;
+
+  case 142: /* conline: "end of line"  */
+#line 1330 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 9546 "build/spin.tab.c"
+    break;
+
+  case 143: /* conline: error "end of line"  */
+#line 1332 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 9552 "build/spin.tab.c"
+    break;
+
+  case 144: /* structlist: structitem  */
+#line 1337 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 9558 "build/spin.tab.c"
+    break;
+
+  case 145: /* structlist: structlist ',' structitem  */
+#line 1339 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), CommentedListHolder((yyvsp[0].ast))); }
+#line 9564 "build/spin.tab.c"
+    break;
+
+  case 146: /* structlist: structlist ',' "end of line" structitem  */
+#line 1341 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-3].list), CommentedListHolder((yyvsp[0].ast))); }
+#line 9570 "build/spin.tab.c"
+    break;
+
+  case 147: /* optarray: '[' expr ']'  */
+#line 1346 "frontends/spin/spin.y"
+     { (yyval.ast) = (yyvsp[-1].ast); }
+#line 9576 "build/spin.tab.c"
+    break;
+
+  case 148: /* optarray: %empty  */
+#line 1348 "frontends/spin/spin.y"
+     { (yyval.ast) = NULL; }
+#line 9582 "build/spin.tab.c"
+    break;
+
+  case 149: /* structitem: "identifier" optarray  */
+#line 1353 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(NULL, (yyvsp[0].ast)), (yyvsp[-1].ast)); }
+#line 9588 "build/spin.tab.c"
+    break;
+
+  case 150: /* structitem: "BYTE" "identifier" optarray  */
+#line 1355 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(ast_type_byte, (yyvsp[0].ast)), (yyvsp[-1].ast));
+    }
+#line 9596 "build/spin.tab.c"
+    break;
+
+  case 151: /* structitem: "WORD" "identifier" optarray  */
+#line 1359 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(ast_type_word, (yyvsp[0].ast)), (yyvsp[-1].ast));
+    }
+#line 9604 "build/spin.tab.c"
+    break;
+
+  case 152: /* structitem: "LONG" "identifier" optarray  */
+#line 1363 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(NULL, (yyvsp[0].ast)), (yyvsp[-1].ast));
+    }
+#line 9612 "build/spin.tab.c"
+    break;
+
+  case 153: /* structitem: "%QUAD" "identifier" optarray  */
+#line 1367 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(ast_type_long64, (yyvsp[0].ast)), (yyvsp[-1].ast));
+    }
+#line 9620 "build/spin.tab.c"
+    break;
+
+  case 154: /* structitem: structname "identifier" optarray  */
+#line 1371 "frontends/spin/spin.y"
+  {
+      AST *name = (yyvsp[-1].ast);
+      AST *typname = (yyvsp[-2].ast);
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, MaybeArrayType(typname, (yyvsp[0].ast)), name);
+  }
+#line 9630 "build/spin.tab.c"
+    break;
+
+  case 155: /* ifacelist: ifaceitem  */
+#line 1380 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 9636 "build/spin.tab.c"
+    break;
+
+  case 156: /* ifacelist: ifacelist ifaceitem  */
+#line 1382 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), CommentedListHolder((yyvsp[0].ast))); }
+#line 9642 "build/spin.tab.c"
+    break;
+
+  case 157: /* ifaceitem: "end of line"  */
+#line 1387 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 9648 "build/spin.tab.c"
+    break;
+
+  case 158: /* ifaceitem: "PUB" funcdef funcdef_end  */
+#line 1389 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 9654 "build/spin.tab.c"
+    break;
+
+  case 159: /* enumlist: enumitem  */
+#line 1394 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 9660 "build/spin.tab.c"
+    break;
+
+  case 160: /* enumlist: enumlist ',' enumitem  */
+#line 1396 "frontends/spin/spin.y"
+    {
+        AST *item = (yyvsp[0].ast);
+        if (item) {
+            (yyval.list) = ListBuilderAdd((yyvsp[-2].list), CommentedListHolder((yyvsp[0].ast)));
+        }
+    }
+#line 9671 "build/spin.tab.c"
+    break;
+
+  case 161: /* enumitem: identifier '=' expr  */
+#line 1406 "frontends/spin/spin.y"
+  {
+      AST *id = (yyvsp[-2].ast);
+      AST *val = (yyvsp[0].ast);
+      AST *decl = SpinAddConstant(id, val); //NewAST(AST_ASSIGN, $1, $3);
+      (yyval.ast) = decl;
+  }
+#line 9682 "build/spin.tab.c"
+    break;
+
+  case 162: /* enumitem: identifier  */
+#line 1413 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = (yyvsp[0].ast);
+  }
+#line 9690 "build/spin.tab.c"
+    break;
+
+  case 163: /* enumitem: identifier '[' expr ']'  */
+#line 1417 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_ENUMSKIP, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 9698 "build/spin.tab.c"
+    break;
+
+  case 164: /* enumitem: '#' expr  */
+#line 1421 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_ENUMSET, (yyvsp[0].ast), NULL); }
+#line 9704 "build/spin.tab.c"
+    break;
+
+  case 165: /* enumitem: '#' expr '[' expr ']'  */
+#line 1423 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_ENUMSET, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 9710 "build/spin.tab.c"
+    break;
+
+  case 166: /* datblock: datline  */
+#line 1428 "frontends/spin/spin.y"
+    {
+        AST *dat = (yyvsp[0].ast);
+        (yyval.ast) = dat; // NewAST(AST_LISTHOLDER, dat, NULL);
+        current->parse_tail = NULL;
+    }
+#line 9720 "build/spin.tab.c"
+    break;
+
+  case 167: /* datblock: datblock datline  */
+#line 1434 "frontends/spin/spin.y"
+    {
+        AST *dat = (yyvsp[0].ast); // NewAST(AST_LISTHOLDER, $2, NULL);
+        (yyval.ast) = AddToListEx((yyvsp[-1].ast), dat, &current->parse_tail);
+    }
+#line 9729 "build/spin.tab.c"
+    break;
+
+  case 168: /* datline: basedatline  */
+#line 1442 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL);
+  }
+#line 9737 "build/spin.tab.c"
+    break;
+
+  case 169: /* datline: identifier basedatline  */
+#line 1446 "frontends/spin/spin.y"
+    {
+        AST *comment = GetComments();
+        AST *idast = (yyvsp[-1].ast);
+        AST *datast = (yyvsp[0].ast);
+        AST *label = DupAST(idast);
+        AST *linebreak = NULL;
+        AST *changetype = NULL;
+        if (datast) {
+            changetype = ExtractPasmType(datast);
+            datast = NewAST(AST_LISTHOLDER, datast, NULL);
+        }
+        SpinAddLocalSymbol(label, SYM_NAME, NULL);
+        if (comment && (comment->d.string || comment->kind == AST_SRCCOMMENT)) {
+            linebreak = NewCommentedAST(AST_LINEBREAK, changetype, NULL, comment);
+        } else {
+            linebreak = NewAST(AST_LINEBREAK, changetype, NULL);
+        }
+        idast = NewAST(AST_LISTHOLDER, idast, datast);
+        idast = NewAST(AST_LISTHOLDER, linebreak, idast);
+        (yyval.ast) = idast;
+    }
+#line 9763 "build/spin.tab.c"
+    break;
+
+  case 170: /* basedatline: "end of line"  */
+#line 1471 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 9769 "build/spin.tab.c"
+    break;
+
+  case 171: /* basedatline: error "end of line"  */
+#line 1473 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 9775 "build/spin.tab.c"
+    break;
+
+  case 172: /* basedatline: "BYTE" "end of line"  */
+#line 1475 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9781 "build/spin.tab.c"
+    break;
+
+  case 173: /* basedatline: "BYTE" datexprlist "end of line"  */
+#line 1477 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, FixupList((yyvsp[-1].list).head), NULL, (yyvsp[-2].ast)); }
+#line 9787 "build/spin.tab.c"
+    break;
+
+  case 174: /* basedatline: "WORD" "end of line"  */
+#line 1479 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9793 "build/spin.tab.c"
+    break;
+
+  case 175: /* basedatline: "WORD" datexprlist "end of line"  */
+#line 1481 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDLIST, FixupList((yyvsp[-1].list).head), NULL, (yyvsp[-2].ast)); }
+#line 9799 "build/spin.tab.c"
+    break;
+
+  case 176: /* basedatline: "BYTEFIT" "end of line"  */
+#line 1483 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_BYTELIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9805 "build/spin.tab.c"
+    break;
+
+  case 177: /* basedatline: "BYTEFIT" datexprlist "end of line"  */
+#line 1485 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_BYTEFITLIST, FixupList((yyvsp[-1].list).head), NULL, (yyvsp[-2].ast));
+    }
+#line 9813 "build/spin.tab.c"
+    break;
+
+  case 178: /* basedatline: "WORDFIT" "end of line"  */
+#line 1489 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_WORDLIST, NULL, NULL, (yyvsp[-1].ast));
+    }
+#line 9821 "build/spin.tab.c"
+    break;
+
+  case 179: /* basedatline: "WORDFIT" datexprlist "end of line"  */
+#line 1493 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_WORDFITLIST, FixupList((yyvsp[-1].list).head), NULL, (yyvsp[-2].ast)); }
+#line 9827 "build/spin.tab.c"
+    break;
+
+  case 180: /* basedatline: "LONG" "end of line"  */
+#line 1495 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9833 "build/spin.tab.c"
+    break;
+
+  case 181: /* basedatline: "LONG" datexprlist "end of line"  */
+#line 1497 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_LONGLIST, FixupList((yyvsp[-1].list).head), NULL, (yyvsp[-2].ast)); }
+#line 9839 "build/spin.tab.c"
+    break;
+
+  case 182: /* basedatline: instruction "end of line"  */
+#line 1499 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedInstr((yyvsp[-1].ast)); }
+#line 9845 "build/spin.tab.c"
+    break;
+
+  case 183: /* basedatline: instruction operandlist "end of line"  */
+#line 1501 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 9851 "build/spin.tab.c"
+    break;
+
+  case 184: /* basedatline: instruction modifierlist "end of line"  */
+#line 1503 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-2].ast), (yyvsp[-1].list).head)); }
+#line 9857 "build/spin.tab.c"
+    break;
+
+  case 185: /* basedatline: instruction operandlist modifierlist "end of line"  */
+#line 1505 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedInstr(AddToList((yyvsp[-3].ast), ListBuilderAdd((yyvsp[-2].list), (yyvsp[-1].list).head).head)); }
+#line 9863 "build/spin.tab.c"
+    break;
+
+  case 186: /* basedatline: "%IF" expr "end of line"  */
+#line 1507 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_ASM_IF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast));
+    }
+#line 9871 "build/spin.tab.c"
+    break;
+
+  case 187: /* basedatline: "%ELSEIF" expr "end of line"  */
+#line 1511 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_ASM_ELSEIF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast));
+    }
+#line 9879 "build/spin.tab.c"
+    break;
+
+  case 188: /* basedatline: "%ELSE" "end of line"  */
+#line 1515 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_ASM_ELSEIF, AstInteger(1), NULL, (yyvsp[-1].ast));
+    }
+#line 9887 "build/spin.tab.c"
+    break;
+
+  case 189: /* basedatline: "%END" "end of line"  */
+#line 1519 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewCommentedAST(AST_ASM_ENDIF, NULL, NULL, (yyvsp[-1].ast));
+    }
+#line 9895 "build/spin.tab.c"
+    break;
+
+  case 190: /* basedatline: "ALIGNL" "end of line"  */
+#line 1523 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, (yyvsp[-1].ast)); }
+#line 9901 "build/spin.tab.c"
+    break;
+
+  case 191: /* basedatline: "ALIGNW" "end of line"  */
+#line 1525 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, (yyvsp[-1].ast)); }
+#line 9907 "build/spin.tab.c"
+    break;
+
+  case 192: /* basedatline: "ORG" "end of line"  */
+#line 1527 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9913 "build/spin.tab.c"
+    break;
+
+  case 193: /* basedatline: "ORG" expr "end of line"  */
+#line 1529 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORG, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 9919 "build/spin.tab.c"
+    break;
+
+  case 194: /* basedatline: "ORG" expr ',' expr "end of line"  */
+#line 1531 "frontends/spin/spin.y"
+    {
+        AST *src = (yyvsp[-3].ast);
+        AST *limit = (yyvsp[-1].ast);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "second parameter for ORG is only valid in Spin2");
+        src = NewAST(AST_RANGE, src, limit);
+        (yyval.ast) = NewCommentedAST(AST_ORG, src, NULL, (yyvsp[-4].ast));
+    }
+#line 9931 "build/spin.tab.c"
+    break;
+
+  case 195: /* basedatline: "ORGH" "end of line"  */
+#line 1539 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, NULL, NULL, (yyvsp[-1].ast)); }
+#line 9937 "build/spin.tab.c"
+    break;
+
+  case 196: /* basedatline: "ORGH" expr "end of line"  */
+#line 1541 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGH, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 9943 "build/spin.tab.c"
+    break;
+
+  case 197: /* basedatline: "ORGH" expr ',' expr "end of line"  */
+#line 1543 "frontends/spin/spin.y"
+    {
+        AST *addr = NewAST(AST_RANGE, (yyvsp[-3].ast), (yyvsp[-1].ast));
+        (yyval.ast) = NewCommentedAST(AST_ORGH, addr, NULL, (yyvsp[-4].ast));
+    }
+#line 9952 "build/spin.tab.c"
+    break;
+
+  case 198: /* basedatline: "ORGF" expr "end of line"  */
+#line 1548 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ORGF, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 9958 "build/spin.tab.c"
+    break;
+
+  case 199: /* basedatline: "RES" expr "end of line"  */
+#line 1550 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_RES, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 9964 "build/spin.tab.c"
+    break;
+
+  case 200: /* basedatline: "FIT" expr "end of line"  */
+#line 1552 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, (yyvsp[-1].ast), NULL, (yyvsp[-2].ast)); }
+#line 9970 "build/spin.tab.c"
+    break;
+
+  case 201: /* basedatline: "FIT" "end of line"  */
+#line 1554 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_FIT, AstInteger(0x1f0), NULL, (yyvsp[-1].ast)); }
+#line 9976 "build/spin.tab.c"
+    break;
+
+  case 202: /* basedatline: "FILE" string "end of line"  */
+#line 1556 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_FILE, GetFullFileName((yyvsp[-1].ast)), NULL, (yyvsp[-2].ast)); }
+#line 9982 "build/spin.tab.c"
+    break;
+
+  case 203: /* basedatline: "DEBUG" "end of line"  */
+#line 1558 "frontends/spin/spin.y"
+    {
+      // Interactive debugger
+      if (gl_brkdebug) {
+        (yyval.ast) = NewAST(AST_BRKDEBUG,NULL,NULL);
+      } else {
+        (yyval.ast) = NULL;
+      }
+    }
+#line 9995 "build/spin.tab.c"
+    break;
+
+  case 204: /* basedatline: "DEBUG" '(' ')' "end of line"  */
+#line 1567 "frontends/spin/spin.y"
+    {
+        if (!gl_brkdebug) {
+          // for now just ignore DEBUG in PASM
+          (yyval.ast) = NULL;
+        } else {
+          // TODO: What does empty debug do??
+          (yyval.ast) = NULL;
+        }
+    }
+#line 10009 "build/spin.tab.c"
+    break;
+
+  case 205: /* basedatline: "DEBUG" '(' asmdebug_exprlist ')' "end of line"  */
+#line 1577 "frontends/spin/spin.y"
+    {
+        AST *ast = NULL;
+        if (gl_brkdebug) {
+          ast = NewAST(AST_BRKDEBUG,(yyvsp[-2].ast),NULL);
+        }
+        if ((yyvsp[-4].ast)) {
+            ast = NewAST(AST_COMMENTEDNODE, ast, (yyvsp[-4].ast));
+        }
+        (yyval.ast) = ast;
+    }
+#line 10024 "build/spin.tab.c"
+    break;
+
+  case 206: /* basedatline: "ASMCLK"  */
+#line 1588 "frontends/spin/spin.y"
+  {
+      SYNTAX_ERROR("ASMCLK instruction is not supported");
+  }
+#line 10032 "build/spin.tab.c"
+    break;
+
+  case 207: /* basedatline: "DITTO" "END"  */
+#line 1592 "frontends/spin/spin.y"
+  {
+      AST *ast = NewAST(AST_DITTO_END, NULL, NULL);
+      ast = NewAST(AST_COMMENTEDNODE, ast, (yyvsp[-1].ast));
+      (yyval.ast) = ast;
+  }
+#line 10042 "build/spin.tab.c"
+    break;
+
+  case 208: /* basedatline: "DITTO" expr  */
+#line 1598 "frontends/spin/spin.y"
+  {
+      AST *ast = NewAST(AST_DITTO_START, (yyvsp[0].ast), NULL);
+      ast = NewAST(AST_COMMENTEDNODE, ast, (yyvsp[-1].ast));
+      (yyval.ast) = ast;
+  }
+#line 10052 "build/spin.tab.c"
+    break;
+
+  case 209: /* basedatline: "%NAMESP" optidentifier  */
+#line 1604 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = NewAST(AST_NAMESPACE, (yyvsp[0].ast), NULL);
+  }
+#line 10060 "build/spin.tab.c"
+    break;
+
+  case 210: /* basedatline: structname  */
+#line 1608 "frontends/spin/spin.y"
+    {
+        AST *ident = NULL;
+        AST *typ = (yyvsp[0].ast);
+        AST *var;
+
+        var = NewAST(AST_DECLARE_VAR, typ, ident);
+        (yyval.ast) = var;
+    }
+#line 10073 "build/spin.tab.c"
+    break;
+
+  case 211: /* optidentifier: %empty  */
+#line 1620 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = NULL;
+  }
+#line 10081 "build/spin.tab.c"
+    break;
+
+  case 212: /* optidentifier: "identifier"  */
+#line 1624 "frontends/spin/spin.y"
+  {
+      (yyval.ast) = (yyvsp[0].ast);
+  }
+#line 10089 "build/spin.tab.c"
+    break;
+
+  case 213: /* objblock: objline  */
+#line 1631 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 10095 "build/spin.tab.c"
+    break;
+
+  case 214: /* objblock: objblock objline  */
+#line 1633 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 10101 "build/spin.tab.c"
+    break;
+
+  case 215: /* objline: "end of line"  */
+#line 1638 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 10107 "build/spin.tab.c"
+    break;
+
+  case 216: /* objline: error "end of line"  */
+#line 1640 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 10113 "build/spin.tab.c"
+    break;
+
+  case 217: /* objline: identdecl ':' string optobjparams  */
+#line 1642 "frontends/spin/spin.y"
+    {
+        AST *paramlist = (yyvsp[0].ast);
+        AST *filename = (yyvsp[-1].ast);
+        AST *ident = (yyvsp[-3].ast);
+        AST *typ = NewObjectWithParams(ident, filename, 1, paramlist);
+        /* last parameter is 1 for a private member */
+        DeclareOneMemberVar(current, ident, typ, 0);
+        (yyval.ast) = typ;
+    }
+#line 10127 "build/spin.tab.c"
+    break;
+
+  case 218: /* objline: "empty assignment marker _" ':' string optobjparams  */
+#line 1652 "frontends/spin/spin.y"
+    {
+        AST *paramlist = (yyvsp[0].ast);
+        AST *filename = (yyvsp[-1].ast);
+        AST *ident = AstTempIdentifier("__anonymous__");
+        
+        AST *typ = NewObjectWithParams(ident, filename, 1, paramlist);
+        Module *P;
+        
+        /* last parameter is 1 for a private member */
+        DeclareOneMemberVar(current, ident, typ, 0);
+
+        /* create aliases */
+        P = GetClassPtr(typ);
+        if (!P) {
+            SYNTAX_ERROR("Internal error, could not find class for _ declaration");
+        } else {
+            DeclareAnonymousAliases(current, P, ident);
+        }
+        (yyval.ast) = typ;
+    }
+#line 10152 "build/spin.tab.c"
+    break;
+
+  case 219: /* objline: identdecl '=' string optobjparams  */
+#line 1673 "frontends/spin/spin.y"
+    {
+        AST *paramlist = (yyvsp[0].ast);
+        AST *filename = (yyvsp[-1].ast);
+        AST *typ = NewAbstractObjectWithParams((yyvsp[-3].ast), filename, 1, paramlist);
+        AST *ident = (yyvsp[-3].ast);
+        const char *name = GetIdentifierName(ident);
+        AddSymbol(&current->objsyms, name, SYM_TYPEDEF, typ, NULL);
+        (yyval.ast) = typ;
+    }
+#line 10166 "build/spin.tab.c"
+    break;
+
+  case 220: /* optobjparams: %empty  */
+#line 1686 "frontends/spin/spin.y"
+      { (yyval.ast) = NULL; }
+#line 10172 "build/spin.tab.c"
+    break;
+
+  case 221: /* optobjparams: '|' objparams  */
+#line 1688 "frontends/spin/spin.y"
+      { (yyval.ast) = (yyvsp[0].list).head; }
+#line 10178 "build/spin.tab.c"
+    break;
+
+  case 222: /* objparams: objparamitem  */
+#line 1693 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 10184 "build/spin.tab.c"
+    break;
+
+  case 223: /* objparams: objparams ',' objparamitem  */
+#line 1695 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), CommentedListHolder((yyvsp[0].ast))); }
+#line 10190 "build/spin.tab.c"
+    break;
+
+  case 224: /* objparamitem: identifier '=' expr  */
+#line 1699 "frontends/spin/spin.y"
+  {
+      AST *id = (yyvsp[-2].ast);
+      AST *val = (yyvsp[0].ast);
+      AST *decl = NewAST(AST_ASSIGN, id, val);
+      (yyval.ast) = decl;
+  }
+#line 10201 "build/spin.tab.c"
+    break;
+
+  case 225: /* varblock: varline  */
+#line 1708 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(CommentedListHolder((yyvsp[0].ast))); }
+#line 10207 "build/spin.tab.c"
+    break;
+
+  case 226: /* varblock: varblock varline  */
+#line 1710 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), CommentedListHolder((yyvsp[0].ast))); }
+#line 10213 "build/spin.tab.c"
+    break;
+
+  case 227: /* varline: "BYTE" identlist "end of line"  */
+#line 1715 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_BYTELIST, (yyvsp[-1].list).head, NULL); }
+#line 10219 "build/spin.tab.c"
+    break;
+
+  case 228: /* varline: "WORD" identlist "end of line"  */
+#line 1717 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_WORDLIST, (yyvsp[-1].list).head, NULL); }
+#line 10225 "build/spin.tab.c"
+    break;
+
+  case 229: /* varline: "LONG" identlist "end of line"  */
+#line 1719 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_LONGLIST, (yyvsp[-1].list).head, NULL); }
+#line 10231 "build/spin.tab.c"
+    break;
+
+  case 230: /* varline: ptrstructname identlist "end of line"  */
+#line 1721 "frontends/spin/spin.y"
+    {
+        AST *typ = (yyvsp[-2].ast);
+        AST *decllist = (yyvsp[-1].list).head;
+        AST *def = NewAST(AST_DECLARE_VAR, typ, decllist);
+        (yyval.ast) = def; // NewAST(AST_LISTHOLDER, def, NULL);
+    }
+#line 10242 "build/spin.tab.c"
+    break;
+
+  case 231: /* varline: identdecl "end of line"  */
+#line 1728 "frontends/spin/spin.y"
+    {
+        AST *decl = NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), NULL);
+        (yyval.ast) = NewAST(AST_LONGLIST, decl, NULL);
+    }
+#line 10251 "build/spin.tab.c"
+    break;
+
+  case 232: /* varline: "ALIGNL" "end of line"  */
+#line 1733 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, (yyvsp[-1].ast)); }
+#line 10257 "build/spin.tab.c"
+    break;
+
+  case 233: /* varline: "ALIGNW" "end of line"  */
+#line 1735 "frontends/spin/spin.y"
+    { (yyval.ast) = NewCommentedAST(AST_ALIGN, AstInteger(2), NULL, (yyvsp[-1].ast)); }
+#line 10263 "build/spin.tab.c"
+    break;
+
+  case 234: /* varline: "end of line"  */
+#line 1737 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 10269 "build/spin.tab.c"
+    break;
+
+  case 235: /* varline: error "end of line"  */
+#line 1739 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 10275 "build/spin.tab.c"
+    break;
+
+  case 236: /* identlist: identdecl  */
+#line 1744 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10281 "build/spin.tab.c"
+    break;
+
+  case 237: /* identlist: annotation identdecl  */
+#line 1746 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderAdd(ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), NULL)),
+                        NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10288 "build/spin.tab.c"
+    break;
+
+  case 238: /* identlist: identlist ',' identdecl  */
+#line 1749 "frontends/spin/spin.y"
+  { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10294 "build/spin.tab.c"
+    break;
+
+  case 239: /* identdecl: identifier  */
+#line 1754 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 10300 "build/spin.tab.c"
+    break;
+
+  case 240: /* identdecl: identifier '[' expr ']'  */
+#line 1756 "frontends/spin/spin.y"
+  { (yyval.ast) = NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 10306 "build/spin.tab.c"
+    break;
+
+  case 241: /* vardecl: identdecl  */
+#line 1761 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 10312 "build/spin.tab.c"
+    break;
+
+  case 242: /* vardecl: "BYTE" identdecl  */
+#line 1763 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_byte, (yyvsp[0].ast)); }
+#line 10318 "build/spin.tab.c"
+    break;
+
+  case 243: /* vardecl: '^' "BYTE" identdecl  */
+#line 1765 "frontends/spin/spin.y"
+    {
+        AST *typ = NewAST(AST_REFTYPE, ast_type_byte, NULL);
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[0].ast));
+    }
+#line 10327 "build/spin.tab.c"
+    break;
+
+  case 244: /* vardecl: "WORD" identdecl  */
+#line 1770 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_word, (yyvsp[0].ast)); }
+#line 10333 "build/spin.tab.c"
+    break;
+
+  case 245: /* vardecl: '^' "WORD" identdecl  */
+#line 1772 "frontends/spin/spin.y"
+    {
+        AST *typ = NewAST(AST_REFTYPE, ast_type_word, NULL);
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[0].ast));
+    }
+#line 10342 "build/spin.tab.c"
+    break;
+
+  case 246: /* vardecl: "LONG" identdecl  */
+#line 1777 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, NULL, (yyvsp[0].ast)); }
+#line 10348 "build/spin.tab.c"
+    break;
+
+  case 247: /* vardecl: '^' "LONG" identdecl  */
+#line 1779 "frontends/spin/spin.y"
+    {
+        AST *typ = NewAST(AST_REFTYPE, ast_type_long, NULL);
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[0].ast));
+    }
+#line 10357 "build/spin.tab.c"
+    break;
+
+  case 248: /* vardecl: "%QUAD" identdecl  */
+#line 1784 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_long64, (yyvsp[0].ast)); }
+#line 10363 "build/spin.tab.c"
+    break;
+
+  case 249: /* vardecl: '^' "%QUAD" identdecl  */
+#line 1786 "frontends/spin/spin.y"
+    {
+        AST *typ = NewAST(AST_REFTYPE, ast_type_long64, NULL);
+        (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, (yyvsp[0].ast));
+    }
+#line 10372 "build/spin.tab.c"
+    break;
+
+  case 250: /* vardecl: ptrstructname identdecl  */
+#line 1791 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DECLARE_VAR, (yyvsp[-1].ast), (yyvsp[0].ast)); }
+#line 10378 "build/spin.tab.c"
+    break;
+
+  case 251: /* vardecllist: vardecl  */
+#line 1796 "frontends/spin/spin.y"
+      { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10384 "build/spin.tab.c"
+    break;
+
+  case 252: /* vardecllist: vardecllist ',' vardecl  */
+#line 1798 "frontends/spin/spin.y"
+      { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10390 "build/spin.tab.c"
+    break;
+
+  case 253: /* general_type: "BYTE"  */
+#line 1803 "frontends/spin/spin.y"
+    { (yyval.ast) = ast_type_byte; }
+#line 10396 "build/spin.tab.c"
+    break;
+
+  case 254: /* general_type: "WORD"  */
+#line 1805 "frontends/spin/spin.y"
+    { (yyval.ast) = ast_type_word; }
+#line 10402 "build/spin.tab.c"
+    break;
+
+  case 255: /* general_type: "LONG"  */
+#line 1807 "frontends/spin/spin.y"
+    { (yyval.ast) = ast_type_long; }
+#line 10408 "build/spin.tab.c"
+    break;
+
+  case 256: /* general_type: "%QUAD"  */
+#line 1809 "frontends/spin/spin.y"
+    { (yyval.ast) = ast_type_long64; }
+#line 10414 "build/spin.tab.c"
+    break;
+
+  case 257: /* general_type: structname  */
+#line 1811 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 10420 "build/spin.tab.c"
+    break;
+
+  case 258: /* paramidentdecl: identifier  */
+#line 1816 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 10426 "build/spin.tab.c"
+    break;
+
+  case 259: /* paramidentdecl: identifier '[' expr ']'  */
+#line 1818 "frontends/spin/spin.y"
+  { (yyval.ast) = NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)); }
+#line 10432 "build/spin.tab.c"
+    break;
+
+  case 260: /* paramidentdecl: identifier '=' expr  */
+#line 1820 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "default parameter values are a flexspin extension");
+      (yyval.ast) = AstAssign((yyvsp[-2].ast), (yyvsp[0].ast));
+  }
+#line 10441 "build/spin.tab.c"
+    break;
+
+  case 261: /* paramidentdecl: general_type identifier  */
+#line 1825 "frontends/spin/spin.y"
+  {
+      AST *typ = (yyvsp[-1].ast);
+      AST *ident = (yyvsp[0].ast);
+
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, ident);
+  }
+#line 10452 "build/spin.tab.c"
+    break;
+
+  case 262: /* paramidentdecl: '^' general_type identifier  */
+#line 1832 "frontends/spin/spin.y"
+  {
+      AST *typ = (yyvsp[-1].ast);
+      AST *ident = (yyvsp[0].ast);
+
+      typ = NewAST(AST_REFTYPE, typ, NULL);
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, typ, ident);
+  }
+#line 10464 "build/spin.tab.c"
+    break;
+
+  case 263: /* paramidentdecl: identifier '=' "LONG"  */
+#line 1840 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_long, (yyvsp[-2].ast));
+  }
+#line 10473 "build/spin.tab.c"
+    break;
+
+  case 264: /* paramidentdecl: identifier '=' '-' "LONG"  */
+#line 1845 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_long, (yyvsp[-3].ast));
+  }
+#line 10482 "build/spin.tab.c"
+    break;
+
+  case 265: /* paramidentdecl: identifier '=' '+' "LONG"  */
+#line 1850 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_unsigned_long, (yyvsp[-3].ast));
+  }
+#line 10491 "build/spin.tab.c"
+    break;
+
+  case 266: /* paramidentdecl: identifier '=' '>' "LONG"  */
+#line 1855 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_long64, (yyvsp[-3].ast));
+  }
+#line 10500 "build/spin.tab.c"
+    break;
+
+  case 267: /* paramidentdecl: identifier '=' "%QUAD"  */
+#line 1860 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_long64, (yyvsp[-2].ast));
+  }
+#line 10509 "build/spin.tab.c"
+    break;
+
+  case 268: /* paramidentdecl: identifier '=' '>' '+' "LONG"  */
+#line 1865 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-4].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_unsigned_long64, (yyvsp[-4].ast));
+  }
+#line 10518 "build/spin.tab.c"
+    break;
+
+  case 269: /* paramidentdecl: identifier '=' "floating point number"  */
+#line 1870 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_float, (yyvsp[-2].ast));
+  }
+#line 10527 "build/spin.tab.c"
+    break;
+
+  case 270: /* paramidentdecl: identifier '=' '@' "%QUAD"  */
+#line 1875 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_ptr_long64, (yyvsp[-3].ast));
+  }
+#line 10536 "build/spin.tab.c"
+    break;
+
+  case 271: /* paramidentdecl: identifier '=' '@' "LONG"  */
+#line 1880 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_ptr_long, (yyvsp[-3].ast));
+  }
+#line 10545 "build/spin.tab.c"
+    break;
+
+  case 272: /* paramidentdecl: identifier '=' '@' "WORD"  */
+#line 1885 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_ptr_word, (yyvsp[-3].ast));
+  }
+#line 10554 "build/spin.tab.c"
+    break;
+
+  case 273: /* paramidentdecl: identifier '=' '@' "BYTE"  */
+#line 1890 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-3].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_ptr_byte, (yyvsp[-3].ast));
+  }
+#line 10563 "build/spin.tab.c"
+    break;
+
+  case 274: /* paramidentdecl: identifier '=' "STRING"  */
+#line 1895 "frontends/spin/spin.y"
+  {
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, ast_type_string, (yyvsp[-2].ast));
+  }
+#line 10572 "build/spin.tab.c"
+    break;
+
+  case 275: /* paramidentdecl: identifier '=' "@@@"  */
+#line 1900 "frontends/spin/spin.y"
+  {
+      AST *anyref = NewAST(AST_REFTYPE, ast_type_generic, NULL);
+      LANGUAGE_WARNING(LANG_ANY, (yyvsp[-2].ast), "parameter types are a flexspin extension");
+      (yyval.ast) = NewAST(AST_DECLARE_VAR, anyref, (yyvsp[-2].ast));
+  }
+#line 10582 "build/spin.tab.c"
+    break;
+
+  case 276: /* paramidentlist: paramidentdecl  */
+#line 1909 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10588 "build/spin.tab.c"
+    break;
+
+  case 277: /* paramidentlist: annotation paramidentdecl  */
+#line 1911 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd(ListBuilderStart(NewAST(AST_LISTHOLDER, (yyvsp[-1].ast), NULL)),
+                          NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10595 "build/spin.tab.c"
+    break;
+
+  case 278: /* paramidentlist: paramidentlist ',' paramidentdecl  */
+#line 1914 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, (yyvsp[0].ast), NULL)); }
+#line 10601 "build/spin.tab.c"
+    break;
+
+  case 279: /* paramidentlist: paramidentlist ',' "%VARARGS"  */
+#line 1916 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), NewAST(AST_LISTHOLDER, NewAST(AST_VARARGS, NULL, NULL),
+                              NULL)); }
+#line 10608 "build/spin.tab.c"
+    break;
+
+  case 283: /* expr: "STRING" '(' exprlist ')'  */
+#line 1925 "frontends/spin/spin.y"
+    {
+        AST *elist = (yyvsp[-1].list).head;
+        (yyval.ast) = NewAST(AST_STRINGPTR, elist, NULL);
+    }
+#line 10617 "build/spin.tab.c"
+    break;
+
+  case 284: /* expr: "LSTRING" '(' exprlist ')'  */
+#line 1930 "frontends/spin/spin.y"
+    {
+        AST *elist = (yyvsp[-1].list).head;
+        AST *ptr = NewAST(AST_STRINGPTR, elist, NULL);
+        ptr->d.ival = 1;
+        (yyval.ast) = ptr;
+    }
+#line 10628 "build/spin.tab.c"
+    break;
+
+  case 285: /* expr: "BYTES" '(' datexprlist ')'  */
+#line 1937 "frontends/spin/spin.y"
+    {
+        AST *datlist = (yyvsp[-1].list).head;
+        datlist = NewAST(AST_BYTELIST, datlist, NULL);
+        (yyval.ast) = SpinAddDatList(datlist);
+    }
+#line 10638 "build/spin.tab.c"
+    break;
+
+  case 286: /* expr: "WORDS" '(' datexprlist ')'  */
+#line 1943 "frontends/spin/spin.y"
+    {
+        AST *datlist = (yyvsp[-1].list).head;
+        datlist = NewAST(AST_WORDLIST, datlist, NULL);
+        (yyval.ast) = SpinAddDatList(datlist);
+    }
+#line 10648 "build/spin.tab.c"
+    break;
+
+  case 287: /* expr: "LONGS" '(' datexprlist ')'  */
+#line 1949 "frontends/spin/spin.y"
+    {
+        AST *datlist = (yyvsp[-1].list).head;
+        datlist = NewAST(AST_LONGLIST, datlist, NULL);
+        (yyval.ast) = SpinAddDatList(datlist);
+    }
+#line 10658 "build/spin.tab.c"
+    break;
+
+  case 289: /* expr: '@' expr  */
+#line 1956 "frontends/spin/spin.y"
+    {
+        AST *e = (yyvsp[0].ast);
+        if (e) {
+            if (e->kind == AST_CATCH && e->left && e->left->kind == AST_STRING) {
+                LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "@\\\"string\" is a flexspin extension to Spin1");
+                AST *str = ExpandCEscapes(e->left);
+                (yyval.ast) = NewAST(AST_STRINGPTR, str, NULL);
+            } else if (e->kind == AST_STRING) {
+                LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "@\"string\" is a flexspin extension to Spin1");
+                (yyval.ast) = NewAST(AST_STRINGPTR,
+                            NewAST(AST_EXPRLIST, e, NULL),
+                            NULL);
+            } else {
+                (yyval.ast) = NewAST(AST_ADDROF, e, NULL);
+            }
+        } else {
+            SYNTAX_ERROR("@ must be followed by an expression");
+        }
+    }
+#line 10682 "build/spin.tab.c"
+    break;
+
+  case 290: /* expr: "@@" expr  */
+#line 1976 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DATADDROF, (yyvsp[0].ast), NULL); }
+#line 10688 "build/spin.tab.c"
+    break;
+
+  case 291: /* expr: "@@@" expr  */
+#line 1978 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_ABSADDROF, (yyvsp[0].ast), NULL); }
+#line 10694 "build/spin.tab.c"
+    break;
+
+  case 292: /* expr: "^@" expr  */
+#line 1980 "frontends/spin/spin.y"
+    {
+        AST *ref = (yyvsp[0].ast);
+        (yyval.ast) = NewAST(AST_FIELDADDR, ref, NULL); // placeholder
+    }
+#line 10703 "build/spin.tab.c"
+    break;
+
+  case 293: /* expr: lhs ":=" expr  */
+#line 1985 "frontends/spin/spin.y"
+    { (yyval.ast) = AstAssign((yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10709 "build/spin.tab.c"
+    break;
+
+  case 294: /* expr: identifier '#' identifier  */
+#line 1987 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CONSTREF, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10715 "build/spin.tab.c"
+    break;
+
+  case 295: /* expr: lhs '\\' expr  */
+#line 1989 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_POSTSET, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10721 "build/spin.tab.c"
+    break;
+
+  case 296: /* expr: expr '+' expr  */
+#line 1991 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('+', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10727 "build/spin.tab.c"
+    break;
+
+  case 297: /* expr: expr '-' expr  */
+#line 1993 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('-', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10733 "build/spin.tab.c"
+    break;
+
+  case 298: /* expr: expr '*' expr  */
+#line 1995 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('*', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10739 "build/spin.tab.c"
+    break;
+
+  case 299: /* expr: expr '/' expr  */
+#line 1997 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('/', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10745 "build/spin.tab.c"
+    break;
+
+  case 300: /* expr: expr '&' expr  */
+#line 1999 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('&', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10751 "build/spin.tab.c"
+    break;
+
+  case 301: /* expr: expr '|' expr  */
+#line 2001 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10757 "build/spin.tab.c"
+    break;
+
+  case 302: /* expr: expr '^' expr  */
+#line 2003 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('^', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10763 "build/spin.tab.c"
+    break;
+
+  case 303: /* expr: expr '>' expr  */
+#line 2005 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('>', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10769 "build/spin.tab.c"
+    break;
+
+  case 304: /* expr: expr '<' expr  */
+#line 2007 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('<', (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10775 "build/spin.tab.c"
+    break;
+
+  case 305: /* expr: expr "=>" expr  */
+#line 2009 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_GE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10781 "build/spin.tab.c"
+    break;
+
+  case 306: /* expr: expr "=<" expr  */
+#line 2011 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10787 "build/spin.tab.c"
+    break;
+
+  case 307: /* expr: expr "+=>" expr  */
+#line 2013 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_GEU, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10793 "build/spin.tab.c"
+    break;
+
+  case 308: /* expr: expr "+=<" expr  */
+#line 2015 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LEU, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10799 "build/spin.tab.c"
+    break;
+
+  case 309: /* expr: expr "+>" expr  */
+#line 2017 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_GTU, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10805 "build/spin.tab.c"
+    break;
+
+  case 310: /* expr: expr "+<" expr  */
+#line 2019 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LTU, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10811 "build/spin.tab.c"
+    break;
+
+  case 311: /* expr: expr "<>" expr  */
+#line 2021 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_NE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10817 "build/spin.tab.c"
+    break;
+
+  case 312: /* expr: expr "==" expr  */
+#line 2023 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_EQ, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10823 "build/spin.tab.c"
+    break;
+
+  case 313: /* expr: expr "<=>" expr  */
+#line 2025 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SGNCOMP, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10829 "build/spin.tab.c"
+    break;
+
+  case 314: /* expr: expr "==." expr  */
+#line 2027 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FEQ, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10835 "build/spin.tab.c"
+    break;
+
+  case 315: /* expr: expr "<>." expr  */
+#line 2029 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FNE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10841 "build/spin.tab.c"
+    break;
+
+  case 316: /* expr: expr ">." expr  */
+#line 2031 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FGT, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10847 "build/spin.tab.c"
+    break;
+
+  case 317: /* expr: expr "<." expr  */
+#line 2033 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FLT, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10853 "build/spin.tab.c"
+    break;
+
+  case 318: /* expr: expr ">=." expr  */
+#line 2035 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FGE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10859 "build/spin.tab.c"
+    break;
+
+  case 319: /* expr: expr "<=." expr  */
+#line 2037 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FLE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10865 "build/spin.tab.c"
+    break;
+
+  case 320: /* expr: expr '<' "=>" expr  */
+#line 2040 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SGNCOMP, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 10871 "build/spin.tab.c"
+    break;
+
+  case 321: /* expr: expr "//" expr  */
+#line 2042 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_MODULUS, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10877 "build/spin.tab.c"
+    break;
+
+  case 322: /* expr: expr "+/" expr  */
+#line 2044 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_UNS_DIV, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10883 "build/spin.tab.c"
+    break;
+
+  case 323: /* expr: expr "+//" expr  */
+#line 2046 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_UNS_MOD, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10889 "build/spin.tab.c"
+    break;
+
+  case 324: /* expr: expr "**" expr  */
+#line 2048 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_HIGHMULT, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10895 "build/spin.tab.c"
+    break;
+
+  case 325: /* expr: expr "SCAS" expr  */
+#line 2050 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SCAS, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10901 "build/spin.tab.c"
+    break;
+
+  case 326: /* expr: expr "SCA (+**)" expr  */
+#line 2052 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_UNS_HIGHMULT, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10907 "build/spin.tab.c"
+    break;
+
+  case 327: /* expr: expr "FRAC" expr  */
+#line 2054 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FRAC64, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10913 "build/spin.tab.c"
+    break;
+
+  case 328: /* expr: expr "#>" expr  */
+#line 2056 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LIMITMIN, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10919 "build/spin.tab.c"
+    break;
+
+  case 329: /* expr: expr "<#" expr  */
+#line 2058 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LIMITMAX, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10925 "build/spin.tab.c"
+    break;
+
+  case 330: /* expr: expr "ZEROX" expr  */
+#line 2060 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ZEROEXTEND, (yyvsp[-2].ast), AstOperator('+', (yyvsp[0].ast), AstInteger(1))); }
+#line 10931 "build/spin.tab.c"
+    break;
+
+  case 331: /* expr: expr "SIGNX" expr  */
+#line 2062 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SIGNEXTEND, (yyvsp[-2].ast), AstOperator('+', (yyvsp[0].ast), AstInteger(1))); }
+#line 10937 "build/spin.tab.c"
+    break;
+
+  case 332: /* expr: expr "><" expr  */
+#line 2064 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_REV, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10943 "build/spin.tab.c"
+    break;
+
+  case 333: /* expr: expr "REV" expr  */
+#line 2066 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_REV, (yyvsp[-2].ast), AstOperator('+', (yyvsp[0].ast), AstInteger(1))); }
+#line 10949 "build/spin.tab.c"
+    break;
+
+  case 334: /* expr: expr "ADDBITS" expr  */
+#line 2068 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), AstOperator(K_SHL, (yyvsp[0].ast), AstInteger(5))); }
+#line 10955 "build/spin.tab.c"
+    break;
+
+  case 335: /* expr: expr "ADDPINS" expr  */
+#line 2070 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('|', (yyvsp[-2].ast), AstOperator(K_SHL, (yyvsp[0].ast), AstInteger(6))); }
+#line 10961 "build/spin.tab.c"
+    break;
+
+  case 336: /* expr: expr "ROL (<-)" expr  */
+#line 2072 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ROTL, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10967 "build/spin.tab.c"
+    break;
+
+  case 337: /* expr: expr "ROR (->)" expr  */
+#line 2074 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ROTR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10973 "build/spin.tab.c"
+    break;
+
+  case 338: /* expr: expr "<<" expr  */
+#line 2076 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SHL, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10979 "build/spin.tab.c"
+    break;
+
+  case 339: /* expr: expr ">>" expr  */
+#line 2078 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SHR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10985 "build/spin.tab.c"
+    break;
+
+  case 340: /* expr: expr "SAR (~>)" expr  */
+#line 2080 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SAR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10991 "build/spin.tab.c"
+    break;
+
+  case 341: /* expr: expr "__ANDTHEN__" expr  */
+#line 2082 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_BOOL_AND, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 10997 "build/spin.tab.c"
+    break;
+
+  case 342: /* expr: expr "__ORELSE__" expr  */
+#line 2084 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_BOOL_OR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11003 "build/spin.tab.c"
+    break;
+
+  case 343: /* expr: expr "AND (&&)" expr  */
+#line 2086 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LOGIC_AND, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11009 "build/spin.tab.c"
+    break;
+
+  case 344: /* expr: expr "OR (||)" expr  */
+#line 2088 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LOGIC_OR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11015 "build/spin.tab.c"
+    break;
+
+  case 345: /* expr: expr "XOR (^^)" expr  */
+#line 2090 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_LOGIC_XOR, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11021 "build/spin.tab.c"
+    break;
+
+  case 346: /* expr: expr "+." expr  */
+#line 2092 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FADD, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11027 "build/spin.tab.c"
+    break;
+
+  case 347: /* expr: expr "-." expr  */
+#line 2094 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FSUB, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11033 "build/spin.tab.c"
+    break;
+
+  case 348: /* expr: expr "*." expr  */
+#line 2096 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FMUL, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11039 "build/spin.tab.c"
+    break;
+
+  case 349: /* expr: expr "%." expr  */
+#line 2098 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FDIV, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11045 "build/spin.tab.c"
+    break;
+
+  case 350: /* expr: expr "POW" expr  */
+#line 2100 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_POWER, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 11051 "build/spin.tab.c"
+    break;
+
+  case 351: /* expr: expr '+' '=' expr  */
+#line 2102 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('+', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11057 "build/spin.tab.c"
+    break;
+
+  case 352: /* expr: expr '-' '=' expr  */
+#line 2104 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('-', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11063 "build/spin.tab.c"
+    break;
+
+  case 353: /* expr: expr '/' '=' expr  */
+#line 2106 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('/', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11069 "build/spin.tab.c"
+    break;
+
+  case 354: /* expr: expr '*' '=' expr  */
+#line 2108 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('*', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11075 "build/spin.tab.c"
+    break;
+
+  case 355: /* expr: expr '&' '=' expr  */
+#line 2110 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('&', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11081 "build/spin.tab.c"
+    break;
+
+  case 356: /* expr: expr '|' '=' expr  */
+#line 2112 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('|', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11087 "build/spin.tab.c"
+    break;
+
+  case 357: /* expr: expr '^' '=' expr  */
+#line 2114 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('^', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11093 "build/spin.tab.c"
+    break;
+
+  case 358: /* expr: expr "//" '=' expr  */
+#line 2116 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_MODULUS, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11099 "build/spin.tab.c"
+    break;
+
+  case 359: /* expr: expr "+/" '=' expr  */
+#line 2118 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_UNS_DIV, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11105 "build/spin.tab.c"
+    break;
+
+  case 360: /* expr: expr "+//" '=' expr  */
+#line 2120 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_UNS_MOD, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11111 "build/spin.tab.c"
+    break;
+
+  case 361: /* expr: expr "**" '=' expr  */
+#line 2122 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_HIGHMULT, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11117 "build/spin.tab.c"
+    break;
+
+  case 362: /* expr: expr "SCA (+**)" '=' expr  */
+#line 2124 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_UNS_HIGHMULT, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11123 "build/spin.tab.c"
+    break;
+
+  case 363: /* expr: expr "SCAS" '=' expr  */
+#line 2126 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SCAS, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11129 "build/spin.tab.c"
+    break;
+
+  case 364: /* expr: expr "FRAC" '=' expr  */
+#line 2128 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_FRAC64, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11135 "build/spin.tab.c"
+    break;
+
+  case 365: /* expr: expr "#>" '=' expr  */
+#line 2130 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_LIMITMIN, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11141 "build/spin.tab.c"
+    break;
+
+  case 366: /* expr: expr "<#" '=' expr  */
+#line 2132 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_LIMITMAX, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11147 "build/spin.tab.c"
+    break;
+
+  case 367: /* expr: expr "ZEROX" '=' expr  */
+#line 2134 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ZEROEXTEND, (yyvsp[-3].ast), AstOperator('+', (yyvsp[0].ast), AstInteger(1))); }
+#line 11153 "build/spin.tab.c"
+    break;
+
+  case 368: /* expr: expr "SIGNX" '=' expr  */
+#line 2136 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SIGNEXTEND, (yyvsp[-3].ast), AstOperator('+', (yyvsp[0].ast), AstInteger(1))); }
+#line 11159 "build/spin.tab.c"
+    break;
+
+  case 369: /* expr: expr "><" '=' expr  */
+#line 2138 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_REV, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11165 "build/spin.tab.c"
+    break;
+
+  case 370: /* expr: expr "REV" '=' expr  */
+#line 2140 "frontends/spin/spin.y"
+    {
+        AST *lhs = (yyvsp[-3].ast);
+        AST *rhs = (yyvsp[0].ast);
+        (yyval.ast) = AstOpAssign(K_REV, lhs,
+                         AstOperator('+', rhs, AstInteger(1)));
+    }
+#line 11176 "build/spin.tab.c"
+    break;
+
+  case 371: /* expr: expr "ADDBITS" '=' expr  */
+#line 2147 "frontends/spin/spin.y"
+    {
+        AST *lhs = (yyvsp[-3].ast);
+        AST *rhs = (yyvsp[0].ast);
+        (yyval.ast) = AstOpAssign('|', lhs,
+                       AstOperator(K_SHL, rhs, AstInteger(5)));
+    }
+#line 11187 "build/spin.tab.c"
+    break;
+
+  case 372: /* expr: expr "ADDPINS" '=' expr  */
+#line 2154 "frontends/spin/spin.y"
+    {
+        AST *lhs = (yyvsp[-3].ast);
+        AST *rhs = (yyvsp[0].ast);
+        (yyval.ast) = AstOpAssign('|', lhs,
+                       AstOperator(K_SHL, rhs, AstInteger(6)));
+    }
+#line 11198 "build/spin.tab.c"
+    break;
+
+  case 373: /* expr: expr "ROL (<-)" '=' expr  */
+#line 2161 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ROTL, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11204 "build/spin.tab.c"
+    break;
+
+  case 374: /* expr: expr "ROR (->)" '=' expr  */
+#line 2163 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ROTR, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11210 "build/spin.tab.c"
+    break;
+
+  case 375: /* expr: expr "<<" '=' expr  */
+#line 2165 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SHL, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11216 "build/spin.tab.c"
+    break;
+
+  case 376: /* expr: expr ">>" '=' expr  */
+#line 2167 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SHR, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11222 "build/spin.tab.c"
+    break;
+
+  case 377: /* expr: expr "SAR (~>)" '=' expr  */
+#line 2169 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SAR, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11228 "build/spin.tab.c"
+    break;
+
+  case 378: /* expr: expr "AND (&&)" '=' expr  */
+#line 2171 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_BOOL_AND, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11234 "build/spin.tab.c"
+    break;
+
+  case 379: /* expr: expr "OR (||)" '=' expr  */
+#line 2173 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_BOOL_OR, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11240 "build/spin.tab.c"
+    break;
+
+  case 380: /* expr: expr "XOR (^^)" '=' expr  */
+#line 2175 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_BOOL_XOR, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11246 "build/spin.tab.c"
+    break;
+
+  case 381: /* expr: expr '<' '=' expr  */
+#line 2177 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('<', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11252 "build/spin.tab.c"
+    break;
+
+  case 382: /* expr: expr '>' '=' expr  */
+#line 2179 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign('>', (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11258 "build/spin.tab.c"
+    break;
+
+  case 383: /* expr: expr "=<" '=' expr  */
+#line 2181 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_LE, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11264 "build/spin.tab.c"
+    break;
+
+  case 384: /* expr: expr "=>" '=' expr  */
+#line 2183 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_GE, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11270 "build/spin.tab.c"
+    break;
+
+  case 385: /* expr: expr "<>" '=' expr  */
+#line 2185 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_NE, (yyvsp[-3].ast), (yyvsp[0].ast)); }
+#line 11276 "build/spin.tab.c"
+    break;
+
+  case 386: /* expr: '(' expr ')' "??" expr ':' expr  */
+#line 2187 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CONDRESULT, (yyvsp[-5].ast), NewAST(AST_THENELSE, (yyvsp[-2].ast), (yyvsp[0].ast))); }
+#line 11282 "build/spin.tab.c"
+    break;
+
+  case 387: /* expr: expr "?" expr ": after ?" expr  */
+#line 2189 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CONDRESULT, (yyvsp[-4].ast), NewAST(AST_THENELSE, (yyvsp[-2].ast), (yyvsp[0].ast))); }
+#line 11288 "build/spin.tab.c"
+    break;
+
+  case 388: /* expr: '(' expr ')'  */
+#line 2191 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 11294 "build/spin.tab.c"
+    break;
+
+  case 389: /* expr: '\\' expr  */
+#line 2193 "frontends/spin/spin.y"
+    { (yyval.ast) = AstCatch((yyvsp[0].ast)); }
+#line 11300 "build/spin.tab.c"
+    break;
+
+  case 390: /* expr: funccall  */
+#line 2195 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 11306 "build/spin.tab.c"
+    break;
+
+  case 391: /* expr: '-' expr  */
+#line 2197 "frontends/spin/spin.y"
+    {
+        AST *op = (yyvsp[0].ast);
+        /* special case -x where x is a float constant */
+        if (op->kind == AST_FLOAT) {
+            op->d.ival ^= 0x80000000U;
+            (yyval.ast) = op;
+        } else {
+            (yyval.ast) = AstOperator(K_NEGATE, NULL, op);
+        }
+    }
+#line 11321 "build/spin.tab.c"
+    break;
+
+  case 392: /* expr: "-." expr  */
+#line 2208 "frontends/spin/spin.y"
+    {
+        AST *op = (yyvsp[0].ast);
+        (yyval.ast) = AstOperator(K_FNEGATE, NULL, op);
+    }
+#line 11330 "build/spin.tab.c"
+    break;
+
+  case 393: /* expr: '+' expr  */
+#line 2213 "frontends/spin/spin.y"
+    {
+        AST *op = (yyvsp[0].ast);
+        (yyval.ast) = op;
+    }
+#line 11339 "build/spin.tab.c"
+    break;
+
+  case 394: /* expr: '!' expr  */
+#line 2218 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_BIT_NOT, NULL, (yyvsp[0].ast)); }
+#line 11345 "build/spin.tab.c"
+    break;
+
+  case 395: /* expr: '!' '=' expr  */
+#line 2220 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_BIT_NOT, (yyvsp[0].ast), NULL); }
+#line 11351 "build/spin.tab.c"
+    break;
+
+  case 396: /* expr: '-' '=' expr  */
+#line 2222 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_NEGATE, (yyvsp[0].ast), NULL); }
+#line 11357 "build/spin.tab.c"
+    break;
+
+  case 397: /* expr: "NOT (!!)" expr  */
+#line 2224 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_BOOL_NOT, NULL, (yyvsp[0].ast)); }
+#line 11363 "build/spin.tab.c"
+    break;
+
+  case 398: /* expr: "NOT (!!)" '=' expr  */
+#line 2226 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_BOOL_NOT, (yyvsp[0].ast), NULL); }
+#line 11369 "build/spin.tab.c"
+    break;
+
+  case 399: /* expr: "FABS" expr  */
+#line 2228 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FABS, NULL, (yyvsp[0].ast)); }
+#line 11375 "build/spin.tab.c"
+    break;
+
+  case 400: /* expr: "ABS (||)" expr  */
+#line 2230 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ABS, NULL, (yyvsp[0].ast)); }
+#line 11381 "build/spin.tab.c"
+    break;
+
+  case 401: /* expr: "ABS (||)" '=' expr  */
+#line 2232 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ABS, (yyvsp[0].ast), NULL); }
+#line 11387 "build/spin.tab.c"
+    break;
+
+  case 402: /* expr: "FSQRT" expr  */
+#line 2234 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_FSQRT, NULL, (yyvsp[0].ast)); }
+#line 11393 "build/spin.tab.c"
+    break;
+
+  case 403: /* expr: "SQRT (^^)" expr  */
+#line 2236 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_SQRT, NULL, (yyvsp[0].ast)); }
+#line 11399 "build/spin.tab.c"
+    break;
+
+  case 404: /* expr: "SQRT (^^)" '=' expr  */
+#line 2238 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_SQRT, (yyvsp[0].ast), NULL); }
+#line 11405 "build/spin.tab.c"
+    break;
+
+  case 405: /* expr: "DECOD (|<)" expr  */
+#line 2240 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_DECODE, NULL, (yyvsp[0].ast)); }
+#line 11411 "build/spin.tab.c"
+    break;
+
+  case 406: /* expr: "DECOD (|<)" '=' expr  */
+#line 2242 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_DECODE, (yyvsp[0].ast), NULL); }
+#line 11417 "build/spin.tab.c"
+    break;
+
+  case 407: /* expr: ">|" expr  */
+#line 2244 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ENCODE, NULL, (yyvsp[0].ast)); }
+#line 11423 "build/spin.tab.c"
+    break;
+
+  case 408: /* expr: "ENCOD" expr  */
+#line 2246 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ENCODE2, NULL, (yyvsp[0].ast)); }
+#line 11429 "build/spin.tab.c"
+    break;
+
+  case 409: /* expr: ">|" '=' expr  */
+#line 2248 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ENCODE, (yyvsp[0].ast), NULL); }
+#line 11435 "build/spin.tab.c"
+    break;
+
+  case 410: /* expr: "ENCOD" '=' expr  */
+#line 2250 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ENCODE2, (yyvsp[0].ast), NULL); }
+#line 11441 "build/spin.tab.c"
+    break;
+
+  case 411: /* expr: "QLOG" expr  */
+#line 2252 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_QLOG, NULL, (yyvsp[0].ast)); }
+#line 11447 "build/spin.tab.c"
+    break;
+
+  case 412: /* expr: "QEXP" expr  */
+#line 2254 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_QEXP, NULL, (yyvsp[0].ast)); }
+#line 11453 "build/spin.tab.c"
+    break;
+
+  case 413: /* expr: "NAN" expr  */
+#line 2256 "frontends/spin/spin.y"
+    {   AST *op = (yyvsp[0].ast);
+        AST *cmp;
+        cmp = AstOperator(K_FNE, op, op);
+        (yyval.ast) = cmp;
+    }
+#line 11463 "build/spin.tab.c"
+    break;
+
+  case 414: /* expr: "ONES" expr  */
+#line 2262 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_ONES_COUNT, NULL, (yyvsp[0].ast)); }
+#line 11469 "build/spin.tab.c"
+    break;
+
+  case 415: /* expr: "ONES" '=' expr  */
+#line 2264 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOpAssign(K_ONES_COUNT, (yyvsp[0].ast), NULL); }
+#line 11475 "build/spin.tab.c"
+    break;
+
+  case 416: /* expr: "BMASK" expr  */
+#line 2266 "frontends/spin/spin.y"
+    {
+        AST *ast;
+        AST *expr = (yyvsp[0].ast);
+        ast = AstOperator(K_SHL, AstInteger(2), expr);
+        ast = AstOperator('-', ast, AstInteger(1));
+        (yyval.ast) = ast;
+    }
+#line 11487 "build/spin.tab.c"
+    break;
+
+  case 417: /* expr: "BMASK" '=' expr  */
+#line 2274 "frontends/spin/spin.y"
+    {
+        AST *ast;
+        AST *expr = (yyvsp[0].ast);
+        ast = AstOperator(K_SHL, AstInteger(2), expr);
+        ast = AstOperator('-', ast, AstInteger(1));
+        if (ExprHasSideEffects(expr)) {
+            SYNTAX_ERROR("expression following BMASK= should not have side effects");
+        }
+        (yyval.ast) = AstAssign(expr, ast);
+    }
+#line 11502 "build/spin.tab.c"
+    break;
+
+  case 418: /* expr: "$"  */
+#line 2285 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_HERE, NULL, NULL); }
+#line 11508 "build/spin.tab.c"
+    break;
+
+  case 419: /* expr: "$$"  */
+#line 2287 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_DITTO_COUNT, NULL, NULL); }
+#line 11514 "build/spin.tab.c"
+    break;
+
+  case 420: /* expr: lhs "++"  */
+#line 2289 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_INCREMENT, (yyvsp[-1].ast), NULL); }
+#line 11520 "build/spin.tab.c"
+    break;
+
+  case 421: /* expr: lhs "--"  */
+#line 2291 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_DECREMENT, (yyvsp[-1].ast), NULL); }
+#line 11526 "build/spin.tab.c"
+    break;
+
+  case 422: /* expr: "++" lhs  */
+#line 2293 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_INCREMENT, NULL, (yyvsp[0].ast)); }
+#line 11532 "build/spin.tab.c"
+    break;
+
+  case 423: /* expr: "--" lhs  */
+#line 2295 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_DECREMENT, NULL, (yyvsp[0].ast)); }
+#line 11538 "build/spin.tab.c"
+    break;
+
+  case 424: /* expr: lhs "??"  */
+#line 2297 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('?', (yyvsp[-1].ast), NULL); }
+#line 11544 "build/spin.tab.c"
+    break;
+
+  case 425: /* expr: "??" lhs  */
+#line 2299 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator('?', NULL, (yyvsp[0].ast)); }
+#line 11550 "build/spin.tab.c"
+    break;
+
+  case 426: /* expr: lhs '~'  */
+#line 2301 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_POSTSET, (yyvsp[-1].ast), AstInteger(0)); }
+#line 11556 "build/spin.tab.c"
+    break;
+
+  case 427: /* expr: lhs "~~"  */
+#line 2303 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_POSTSET, (yyvsp[-1].ast), AstInteger(-1)); }
+#line 11562 "build/spin.tab.c"
+    break;
+
+  case 428: /* expr: lhs "NOT (!!)"  */
+#line 2305 "frontends/spin/spin.y"
+    {
+        AST *lhs = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_POSTSET, lhs, AstOperator(K_BOOL_NOT, NULL, DupAST(lhs)));
+    }
+#line 11571 "build/spin.tab.c"
+    break;
+
+  case 429: /* expr: lhs '!'  */
+#line 2310 "frontends/spin/spin.y"
+    {
+        AST *lhs = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_POSTSET, lhs, AstOperator(K_BIT_NOT, NULL, DupAST(lhs)));
+    }
+#line 11580 "build/spin.tab.c"
+    break;
+
+  case 430: /* expr: '~' lhs  */
+#line 2315 "frontends/spin/spin.y"
+    { AST *shf;
+      AST *val = (yyvsp[0].ast);
+      shf = AstOpAssign(K_SIGNEXTEND, val, AstInteger(8));
+      (yyval.ast) = shf;
+    }
+#line 11590 "build/spin.tab.c"
+    break;
+
+  case 431: /* expr: "~~" lhs  */
+#line 2321 "frontends/spin/spin.y"
+    { AST *shf;
+      AST *val = (yyvsp[0].ast);
+      shf = AstOpAssign(K_SIGNEXTEND, val, AstInteger(16));
+      (yyval.ast) = shf;
+    }
+#line 11600 "build/spin.tab.c"
+    break;
+
+  case 432: /* expr: "constant" '(' expr ')'  */
+#line 2327 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CONSTANT, (yyvsp[-1].ast), NULL); }
+#line 11606 "build/spin.tab.c"
+    break;
+
+  case 433: /* expr: "__BUILTIN_ALLOCA" '(' expr ')'  */
+#line 2329 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_ALLOCA, NULL, (yyvsp[-1].ast)); }
+#line 11612 "build/spin.tab.c"
+    break;
+
+  case 434: /* expr: "floating point number" '(' expr ')'  */
+#line 2331 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_TOFLOAT, (yyvsp[-1].ast), NULL); }
+#line 11618 "build/spin.tab.c"
+    break;
+
+  case 435: /* expr: "ROUND" '(' expr ')'  */
+#line 2333 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_ROUND, (yyvsp[-1].ast), NULL); }
+#line 11624 "build/spin.tab.c"
+    break;
+
+  case 436: /* expr: "TRUNC" '(' expr ')'  */
+#line 2335 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_TRUNC, (yyvsp[-1].ast), NULL); }
+#line 11630 "build/spin.tab.c"
+    break;
+
+  case 437: /* expr: lookupexpr  */
+#line 2337 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 11636 "build/spin.tab.c"
+    break;
+
+  case 438: /* expr: lookdownexpr  */
+#line 2339 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 11642 "build/spin.tab.c"
+    break;
+
+  case 439: /* expr: "IF" expr "THEN" expr "ELSE" expr  */
+#line 2341 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CONDRESULT, (yyvsp[-4].ast), NewAST(AST_THENELSE, (yyvsp[-2].ast), (yyvsp[0].ast))); }
+#line 11648 "build/spin.tab.c"
+    break;
+
+  case 440: /* expr: lhs ":=:" expr  */
+#line 2343 "frontends/spin/spin.y"
+    {
+        AST *dst = (yyvsp[-2].ast);
+        AST *src = (yyvsp[0].ast);
+        AST *check = NewAST(AST_STATIC_ASSERT,
+                            NewAST(AST_SAMETYPES,
+                                   NewAST(AST_TYPEOF, dst, NULL),
+                                   NewAST(AST_TYPEOF, src, NULL)),
+                            AstStringPtr("Parameters to :=: must have the same type"));
+        AST *dstptr = NewAST(AST_ADDROF, dst, NULL);
+        AST *srcptr = NewAST(AST_ADDROF, src, NULL);
+        AST *copyparams = NewAST(AST_EXPRLIST,
+                                 dstptr,
+                                 NewAST(AST_EXPRLIST,
+                                        srcptr,
+                                        NewAST(AST_EXPRLIST,
+                                               NewAST(AST_SIZEOF, src, NULL),
+                                               NULL)));
+        AST *copy = NewAST(AST_FUNCCALL,
+                           AstIdentifier("__builtin_swapdata"),
+                           copyparams);
+        (yyval.ast) = NewAST(AST_SEQUENCE, check, copy);
+    }
+#line 11675 "build/spin.tab.c"
+    break;
+
+  case 442: /* lhs: "[++]" identifier  */
+#line 2369 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = AstOperator(K_REF_PREINC, NULL, (yyvsp[0].ast));
+    }
+#line 11683 "build/spin.tab.c"
+    break;
+
+  case 443: /* lhs: "[--]" identifier  */
+#line 2373 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = AstOperator(K_REF_PREDEC, NULL, (yyvsp[0].ast));
+    }
+#line 11691 "build/spin.tab.c"
+    break;
+
+  case 445: /* lhs: hwreg '[' range ']'  */
+#line 2378 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_RANGEREF, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 11698 "build/spin.tab.c"
+    break;
+
+  case 446: /* lhs: hwreg '[' '#' '#' range ']'  */
+#line 2381 "frontends/spin/spin.y"
+    {
+        AST *reg = (yyvsp[-5].ast);
+        AST *index = (yyvsp[-1].ast);
+        AST *base = NewAST(AST_RANGEREF, reg, index);
+        AST *holder = NewAST(AST_BIGIMMHOLDER, base, NULL);
+        (yyval.ast) = holder;
+    }
+#line 11710 "build/spin.tab.c"
+    break;
+
+  case 447: /* lhs: "FIELD" '[' expr ']' '[' expr ']'  */
+#line 2389 "frontends/spin/spin.y"
+    {
+        AST *ref = (yyvsp[-4].ast);
+        AST *idx = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_FIELDREF, ref, idx);
+    }
+#line 11720 "build/spin.tab.c"
+    break;
+
+  case 448: /* lhs: "FIELD" '[' expr ']'  */
+#line 2395 "frontends/spin/spin.y"
+    {
+        AST *ref = (yyvsp[-1].ast);
+        AST *idx = AstInteger(0);
+        (yyval.ast) = NewAST(AST_FIELDREF, ref, idx);
+    }
+#line 11730 "build/spin.tab.c"
+    break;
+
+  case 449: /* lhs: '[' lhs ']'  */
+#line 2401 "frontends/spin/spin.y"
+    {
+        AST *refptr = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_ADDROF, refptr, NULL);
+    }
+#line 11739 "build/spin.tab.c"
+    break;
+
+  case 450: /* lhs: "SPR" '[' expr ']'  */
+#line 2406 "frontends/spin/spin.y"
+    { (yyval.ast) = AstSprRef((yyvsp[-1].ast), 0x1f0); }
+#line 11745 "build/spin.tab.c"
+    break;
+
+  case 451: /* lhs: "REG" '[' expr ']'  */
+#line 2408 "frontends/spin/spin.y"
+    { (yyval.ast) = AstSprRef((yyvsp[-1].ast), 0x0); }
+#line 11751 "build/spin.tab.c"
+    break;
+
+  case 452: /* lhs: "STRUCTURE NAME" '[' expr ']'  */
+#line 2410 "frontends/spin/spin.y"
+    {
+        AST *typ = (yyvsp[-3].ast);
+        AST *expr = (yyvsp[-1].ast);
+        AST *base = NewAST(AST_MEMREF, typ, expr);
+        (yyval.ast) = base;
+    }
+#line 11762 "build/spin.tab.c"
+    break;
+
+  case 453: /* lhs: "STRUCTURE NAME" '.' identifier  */
+#line 2417 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, (yyvsp[-2].ast), AstInteger(0));
+        AST *ident = (yyvsp[0].ast);
+        AST *method = NewAST(AST_METHODREF, base, ident);
+        (yyval.ast) = method;
+    }
+#line 11773 "build/spin.tab.c"
+    break;
+
+  case 454: /* lhs: "STRUCTURE NAME" '#' identifier  */
+#line 2424 "frontends/spin/spin.y"
+    {
+        AST *base = (yyvsp[-2].ast);
+        AST *ident = (yyvsp[0].ast);
+        AST *method = NewAST(AST_CONSTREF, base, ident);
+        (yyval.ast) = method;
+    }
+#line 11784 "build/spin.tab.c"
+    break;
+
+  case 455: /* lhs: "BYTE" '[' expr ']'  */
+#line 2431 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_byte, (yyvsp[-1].ast));
+        (yyval.ast) = base;
+    }
+#line 11793 "build/spin.tab.c"
+    break;
+
+  case 456: /* lhs: "WORD" '[' expr ']'  */
+#line 2436 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_word, (yyvsp[-1].ast));
+        (yyval.ast) = base;
+    }
+#line 11802 "build/spin.tab.c"
+    break;
+
+  case 457: /* lhs: "LONG" '[' expr ']'  */
+#line 2441 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_long, (yyvsp[-1].ast));
+        (yyval.ast) = base;
+    }
+#line 11811 "build/spin.tab.c"
+    break;
+
+  case 458: /* lhs: lhs '.' "BYTE" '[' expr ']'  */
+#line 2446 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_byte, NewAST(AST_ADDROF, (yyvsp[-5].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, (yyvsp[-1].ast));
+    }
+#line 11820 "build/spin.tab.c"
+    break;
+
+  case 459: /* lhs: lhs '.' "BYTE"  */
+#line 2451 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_byte, NewAST(AST_ADDROF, (yyvsp[-2].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, AstInteger(0));
+    }
+#line 11829 "build/spin.tab.c"
+    break;
+
+  case 460: /* lhs: lhs '.' "WORD" '[' expr ']'  */
+#line 2456 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_word, NewAST(AST_ADDROF, (yyvsp[-5].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, (yyvsp[-1].ast));
+    }
+#line 11838 "build/spin.tab.c"
+    break;
+
+  case 461: /* lhs: lhs '.' "WORD"  */
+#line 2461 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_word, NewAST(AST_ADDROF, (yyvsp[-2].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, AstInteger(0));
+    }
+#line 11847 "build/spin.tab.c"
+    break;
+
+  case 462: /* lhs: lhs '.' "LONG" '[' expr ']'  */
+#line 2466 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_long, NewAST(AST_ADDROF, (yyvsp[-5].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, (yyvsp[-1].ast));
+    }
+#line 11856 "build/spin.tab.c"
+    break;
+
+  case 463: /* lhs: lhs '.' "LONG"  */
+#line 2471 "frontends/spin/spin.y"
+    {
+        AST *base = NewAST(AST_MEMREF, ast_type_long, NewAST(AST_ADDROF, (yyvsp[-2].ast), NULL));
+        (yyval.ast) = NewAST(AST_ARRAYREF, base, AstInteger(0));
+    }
+#line 11865 "build/spin.tab.c"
+    break;
+
+  case 464: /* lhs: lhs '.' '[' range ']'  */
+#line 2476 "frontends/spin/spin.y"
+    {
+        AST *arr = (yyvsp[-4].ast);
+        AST *range = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_RANGEREF, arr, range);
+    }
+#line 11875 "build/spin.tab.c"
+    break;
+
+  case 465: /* lhs: lhs '.' identifier  */
+#line 2482 "frontends/spin/spin.y"
+    {
+        AST *objroot = (yyvsp[-2].ast);
+        AST *method = (yyvsp[0].ast);
+        AST *expr;
+        expr = NewAST(AST_METHODREF, objroot, method);
+        (yyval.ast) = expr;
+    }
+#line 11887 "build/spin.tab.c"
+    break;
+
+  case 466: /* lhs: lhs '[' expr ']'  */
+#line 2490 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 11895 "build/spin.tab.c"
+    break;
+
+  case 467: /* lhs: lhs "[++]"  */
+#line 2494 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_REF_POSTINC, (yyvsp[-1].ast), NULL); }
+#line 11901 "build/spin.tab.c"
+    break;
+
+  case 468: /* lhs: lhs "[--]"  */
+#line 2496 "frontends/spin/spin.y"
+    { (yyval.ast) = AstOperator(K_REF_POSTDEC, (yyvsp[-1].ast), NULL); }
+#line 11907 "build/spin.tab.c"
+    break;
+
+  case 469: /* lhsseq: '(' lhssingle ',' lhsseqcont ')'  */
+#line 2501 "frontends/spin/spin.y"
+    {
+        AST *list = (yyvsp[-1].list).head;
+        AST *item = (yyvsp[-3].ast);
+        (yyval.ast) = NewAST(AST_EXPRLIST, item, list);
+    }
+#line 11917 "build/spin.tab.c"
+    break;
+
+  case 470: /* lhsseq: lhssingle ',' lhsseqcont  */
+#line 2507 "frontends/spin/spin.y"
+    {
+        AST *list = (yyvsp[0].list).head;
+        AST *item = (yyvsp[-2].ast);
+        (yyval.ast) = NewAST(AST_EXPRLIST, item, list);
+    }
+#line 11927 "build/spin.tab.c"
+    break;
+
+  case 471: /* lhsseqcont: lhssingle  */
+#line 2516 "frontends/spin/spin.y"
+    {
+        AST *item = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+        (yyval.list) = ListBuilderStart(item);
+    }
+#line 11936 "build/spin.tab.c"
+    break;
+
+  case 472: /* lhsseqcont: lhsseqcont ',' lhssingle  */
+#line 2521 "frontends/spin/spin.y"
+    {
+        AST *item = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL);
+        (yyval.list) = ListBuilderAdd((yyvsp[-2].list), item);
+    }
+#line 11945 "build/spin.tab.c"
+    break;
+
+  case 473: /* lhssingle: lhs  */
+#line 2529 "frontends/spin/spin.y"
+       { (yyval.ast) = (yyvsp[0].ast); }
+#line 11951 "build/spin.tab.c"
+    break;
+
+  case 474: /* lhssingle: "empty assignment marker _" opt_emptysize  */
+#line 2531 "frontends/spin/spin.y"
+       {
+           AST *size = (yyvsp[0].ast);
+           (yyval.ast) = NewAST(AST_EMPTY, size, NULL);
+       }
+#line 11960 "build/spin.tab.c"
+    break;
+
+  case 475: /* opt_emptysize: '[' expr ']'  */
+#line 2539 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[-1].ast); }
+#line 11966 "build/spin.tab.c"
+    break;
+
+  case 476: /* opt_emptysize: '[' "STRUCTURE NAME" ']'  */
+#line 2541 "frontends/spin/spin.y"
+    {
+        AST *typ = (yyvsp[-1].ast);
+        AST *expr = NewAST(AST_SIZEOF, typ, NULL);
+        expr = AstOperator('/', expr, AstInteger(4));
+        (yyval.ast) = expr;
+    }
+#line 11977 "build/spin.tab.c"
+    break;
+
+  case 477: /* opt_emptysize: %empty  */
+#line 2548 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 11983 "build/spin.tab.c"
+    break;
+
+  case 478: /* opt_numrets: %empty  */
+#line 2553 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 11989 "build/spin.tab.c"
+    break;
+
+  case 479: /* opt_numrets: ':' "number"  */
+#line 2555 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 11995 "build/spin.tab.c"
+    break;
+
+  case 480: /* opt_numrets: ':' "STRUCTURE NAME"  */
+#line 2557 "frontends/spin/spin.y"
+    {
+        AST *typ = (yyvsp[0].ast);
+        (yyval.ast) = typ;
+    }
+#line 12004 "build/spin.tab.c"
+    break;
+
+  case 481: /* funccall: lhs '(' exprlist ')' opt_numrets  */
+#line 2565 "frontends/spin/spin.y"
+    { (yyval.ast) = MakeFunccall((yyvsp[-4].ast), FixupList((yyvsp[-2].list).head), (yyvsp[0].ast)); }
+#line 12010 "build/spin.tab.c"
+    break;
+
+  case 482: /* funccall: lhs '(' ')' opt_numrets  */
+#line 2567 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = MakeFunccall((yyvsp[-3].ast), NULL, (yyvsp[0].ast));
+        LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "Using () for functions with no parameters is a flexspin extension");
+    }
+#line 12019 "build/spin.tab.c"
+    break;
+
+  case 483: /* funccall: "PINWRITE" '(' rangeexpritem ',' expritem ')'  */
+#line 2572 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange((yyvsp[-3].ast));
+        AST *arg2 = (yyvsp[-1].ast);
+        AST *ident = AstIdentifier("pinw");
+        arg1 = AddToList(arg1, arg2);
+        
+        (yyval.ast) = MakeFunccall(ident, arg1, NULL);
+    }
+#line 12032 "build/spin.tab.c"
+    break;
+
+  case 484: /* funccall: "PINREAD" '(' rangeexpritem ')'  */
+#line 2581 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange((yyvsp[-1].ast));
+        AST *ident = AstIdentifier("pinr");
+        
+        (yyval.ast) = MakeFunccall(ident, arg1, NULL);
+    }
+#line 12043 "build/spin.tab.c"
+    break;
+
+  case 485: /* funccall: "PINLOW" '(' rangeexpritem ')'  */
+#line 2588 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange((yyvsp[-1].ast));
+        AST *ident = AstIdentifier("pinl");
+        
+        (yyval.ast) = MakeFunccall(ident, arg1, NULL);
+    }
+#line 12054 "build/spin.tab.c"
+    break;
+
+  case 486: /* funccall: "PINHIGH" '(' rangeexpritem ')'  */
+#line 2595 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange((yyvsp[-1].ast));
+        AST *ident = AstIdentifier("pinh");
+        
+        (yyval.ast) = MakeFunccall(ident, arg1, NULL);
+    }
+#line 12065 "build/spin.tab.c"
+    break;
+
+  case 487: /* funccall: "PINTOGGLE" '(' rangeexpritem ')'  */
+#line 2602 "frontends/spin/spin.y"
+    {
+        AST *arg1 = ConvertPinRange((yyvsp[-1].ast));
+        AST *ident = AstIdentifier("pintoggle");
+        
+        (yyval.ast) = MakeFunccall(ident, arg1, NULL);
+    }
+#line 12076 "build/spin.tab.c"
+    break;
+
+  case 488: /* funccall: "COGINIT" '(' exprlist ')'  */
+#line 2609 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_COGINIT, FixupList((yyvsp[-1].list).head), NULL);
+    }
+#line 12084 "build/spin.tab.c"
+    break;
+
+  case 489: /* funccall: "COGNEW" '(' exprlist ')'  */
+#line 2613 "frontends/spin/spin.y"
+    {
+        AST *elist;
+        AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
+        elist = NewAST(AST_EXPRLIST, immval, NULL);
+        elist = AddToList(elist, (yyvsp[-1].list).head);
+        elist = FixupList(elist);
+        (yyval.ast) = NewAST(AST_COGINIT, elist, NULL);
+        LANGUAGE_WARNING(LANG_SPIN_SPIN2, NULL, "cognew support in Spin2 is a flexspin extension");
+    }
+#line 12098 "build/spin.tab.c"
+    break;
+
+  case 490: /* funccall: "REGEXEC" '(' exprlist ')'  */
+#line 2623 "frontends/spin/spin.y"
+    {
+        SYNTAX_ERROR("REGEXEC is not supported by flexspin");
+    }
+#line 12106 "build/spin.tab.c"
+    break;
+
+  case 491: /* funccall: "REGLOAD" '(' exprlist ')'  */
+#line 2627 "frontends/spin/spin.y"
+    {
+        SYNTAX_ERROR("REGLOAD is not supported by flexspin");
+    }
+#line 12114 "build/spin.tab.c"
+    break;
+
+  case 492: /* funccall: "SIZEOF" '(' "STRUCTURE NAME" ')'  */
+#line 2631 "frontends/spin/spin.y"
+    {
+        AST *src = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_SIZEOF, src, NULL);
+    }
+#line 12123 "build/spin.tab.c"
+    break;
+
+  case 493: /* funccall: "SIZEOF" '(' expr ')'  */
+#line 2636 "frontends/spin/spin.y"
+    {
+        AST *src = (yyvsp[-1].ast);
+        (yyval.ast) = NewAST(AST_SIZEOF, src, NULL);
+    }
+#line 12132 "build/spin.tab.c"
+    break;
+
+  case 494: /* funccall: "OFFSETOF" '(' "STRUCTURE NAME" '.' identifier ')'  */
+#line 2641 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_OFFSETOF, (yyvsp[-3].ast), (yyvsp[-1].ast));
+    }
+#line 12140 "build/spin.tab.c"
+    break;
+
+  case 495: /* funccall: "TASKSPIN" '(' exprlist ')'  */
+#line 2645 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_TASKINIT, FixupList((yyvsp[-1].list).head), NULL);
+    }
+#line 12148 "build/spin.tab.c"
+    break;
+
+  case 496: /* funccall: "TASKHLT"  */
+#line 2649 "frontends/spin/spin.y"
+    {
+        AST *ident = AstIdentifier("__builtin_gethalted");
+        
+        (yyval.ast) = MakeFunccall(ident, NULL, NULL);
+    }
+#line 12158 "build/spin.tab.c"
+    break;
+
+  case 497: /* funccall: "COPY" '(' expr ',' expr ')'  */
+#line 2655 "frontends/spin/spin.y"
+    {
+        AST *dst = (yyvsp[-3].ast);
+        AST *src = (yyvsp[-1].ast);
+        AST *check = NewAST(AST_STATIC_ASSERT,
+                            NewAST(AST_SAMETYPES,
+                                   NewAST(AST_TYPEOF, dst, NULL),
+                                   NewAST(AST_TYPEOF, src, NULL)),
+                            AstStringPtr("Parameters to COPY must have the same type"));
+        AST *dstptr = NewAST(AST_ADDROF, dst, NULL);
+        AST *srcptr = NewAST(AST_ADDROF, src, NULL);
+        AST *copyparams = NewAST(AST_EXPRLIST,
+                                 dstptr,
+                                 NewAST(AST_EXPRLIST,
+                                        srcptr,
+                                        NewAST(AST_EXPRLIST,
+                                               NewAST(AST_SIZEOF, src, NULL),
+                                               NULL)));
+        AST *copy = NewAST(AST_FUNCCALL,
+                           AstIdentifier("__builtin_memcpy"),
+                           copyparams);
+        (yyval.ast) = NewAST(AST_SEQUENCE, check, copy);
+    }
+#line 12185 "build/spin.tab.c"
+    break;
+
+  case 498: /* funccall: "SWAP" '(' expr ',' expr ')'  */
+#line 2678 "frontends/spin/spin.y"
+    {
+        AST *dst = (yyvsp[-3].ast);
+        AST *src = (yyvsp[-1].ast);
+        AST *check = NewAST(AST_STATIC_ASSERT,
+                            NewAST(AST_SAMETYPES,
+                                   NewAST(AST_TYPEOF, dst, NULL),
+                                   NewAST(AST_TYPEOF, src, NULL)),
+                            AstStringPtr("Parameters to SWAP must have the same type"));
+        AST *dstptr = NewAST(AST_ADDROF, dst, NULL);
+        AST *srcptr = NewAST(AST_ADDROF, src, NULL);
+        AST *copyparams = NewAST(AST_EXPRLIST,
+                                 dstptr,
+                                 NewAST(AST_EXPRLIST,
+                                        srcptr,
+                                        NewAST(AST_EXPRLIST,
+                                               NewAST(AST_SIZEOF, src, NULL),
+                                               NULL)));
+        AST *copy = NewAST(AST_FUNCCALL,
+                           AstIdentifier("__builtin_swapdata"),
+                           copyparams);
+        (yyval.ast) = NewAST(AST_SEQUENCE, check, copy);
+    }
+#line 12212 "build/spin.tab.c"
+    break;
+
+  case 499: /* funccall: "COMP" '(' expr ',' expr ')'  */
+#line 2701 "frontends/spin/spin.y"
+    {
+        AST *dst = (yyvsp[-3].ast);
+        AST *src = (yyvsp[-1].ast);
+        AST *check = NewAST(AST_STATIC_ASSERT,
+                            NewAST(AST_SAMETYPES,
+                                   NewAST(AST_TYPEOF, dst, NULL),
+                                   NewAST(AST_TYPEOF, src, NULL)),
+                            AstStringPtr("Parameters to COMP must have the same type"));
+        AST *dstptr = NewAST(AST_ADDROF, dst, NULL);
+        AST *srcptr = NewAST(AST_ADDROF, src, NULL);
+        AST *copyparams = NewAST(AST_EXPRLIST,
+                                 dstptr,
+                                 NewAST(AST_EXPRLIST,
+                                        srcptr,
+                                        NewAST(AST_EXPRLIST,
+                                               NewAST(AST_SIZEOF, src, NULL),
+                                               NULL)));
+        AST *copy = NewAST(AST_FUNCCALL,
+                           AstIdentifier("__builtin_compdata"),
+                           copyparams);
+        (yyval.ast) = NewAST(AST_SEQUENCE, check, copy);
+    }
+#line 12239 "build/spin.tab.c"
+    break;
+
+  case 500: /* funccall: "FILL" '(' expr ',' expr ')'  */
+#line 2724 "frontends/spin/spin.y"
+    {
+        AST *dst = (yyvsp[-3].ast);
+        AST *val = (yyvsp[-1].ast);
+        AST *dstptr = NewAST(AST_ADDROF, dst, NULL);
+        AST *params = NewAST(AST_EXPRLIST,
+                                 dstptr,
+                                 NewAST(AST_EXPRLIST,
+                                        val,
+                                        NewAST(AST_EXPRLIST,
+                                               NewAST(AST_SIZEOF, dst, NULL),
+                                               NULL)));
+        AST *call = NewAST(AST_FUNCCALL,
+                           AstIdentifier("__builtin_memset"),
+                           params);
+        (yyval.ast) = call;
+    }
+#line 12260 "build/spin.tab.c"
+    break;
+
+  case 501: /* funccall: "LOG2" expr  */
+#line 2741 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_log2f");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12271 "build/spin.tab.c"
+    break;
+
+  case 502: /* funccall: "EXP2" expr  */
+#line 2748 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_exp2f");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12282 "build/spin.tab.c"
+    break;
+
+  case 503: /* funccall: "LOG10" expr  */
+#line 2755 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_log10f");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12293 "build/spin.tab.c"
+    break;
+
+  case 504: /* funccall: "EXP10" expr  */
+#line 2762 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_exp10f");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12304 "build/spin.tab.c"
+    break;
+
+  case 505: /* funccall: "LN" expr  */
+#line 2769 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_logf");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12315 "build/spin.tab.c"
+    break;
+
+  case 506: /* funccall: "EXP" expr  */
+#line 2776 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[0].ast);
+        AST *ident = AstIdentifier("__builtin_expf");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12326 "build/spin.tab.c"
+    break;
+
+  case 507: /* funccall: "ENDIANL" '(' expr ')'  */
+#line 2783 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[-1].ast);
+        AST *ident = AstIdentifier("__builtin_bswap32");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12337 "build/spin.tab.c"
+    break;
+
+  case 508: /* funccall: "ENDIANW" '(' expr ')'  */
+#line 2790 "frontends/spin/spin.y"
+    {
+        AST *arg1 = (yyvsp[-1].ast);
+        AST *ident = AstIdentifier("__builtin_bswap16");
+        
+        (yyval.ast) = MakeFunccall1(ident, arg1);
+    }
+#line 12348 "build/spin.tab.c"
+    break;
+
+  case 509: /* funccall: "MOVBYTS" '(' operandlist ')'  */
+#line 2797 "frontends/spin/spin.y"
+    {
+        AST *args = (yyvsp[-1].list).head;
+        AST *ident = AstIdentifier("__builtin_movbyts");
+        
+        (yyval.ast) = MakeFunccall(ident, args, NULL);
+    }
+#line 12359 "build/spin.tab.c"
+    break;
+
+  case 510: /* expritem: expr  */
+#line 2808 "frontends/spin/spin.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 12365 "build/spin.tab.c"
+    break;
+
+  case 511: /* expritem: integer '[' expr ']'  */
+#line 2810 "frontends/spin/spin.y"
+   {
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL);
+   }
+#line 12373 "build/spin.tab.c"
+    break;
+
+  case 512: /* expritem: float '[' expr ']'  */
+#line 2814 "frontends/spin/spin.y"
+   {
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL);
+   }
+#line 12381 "build/spin.tab.c"
+    break;
+
+  case 513: /* expritem: '-' integer '[' expr ']'  */
+#line 2818 "frontends/spin/spin.y"
+   {
+       AST *op = (yyvsp[-3].ast);
+       op->d.ival = -op->d.ival;
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, op, (yyvsp[-1].ast)), NULL);
+   }
+#line 12391 "build/spin.tab.c"
+    break;
+
+  case 514: /* expritem: '-' float '[' expr ']'  */
+#line 2824 "frontends/spin/spin.y"
+   {
+       AST *op = (yyvsp[-3].ast);
+       op->d.ival ^= 0x80000000U;
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, op, (yyvsp[-1].ast)), NULL);
+   }
+#line 12401 "build/spin.tab.c"
+    break;
+
+  case 515: /* expritem: string '[' expr ']'  */
+#line 2830 "frontends/spin/spin.y"
+   {
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL);
+   }
+#line 12409 "build/spin.tab.c"
+    break;
+
+  case 516: /* exprlist: expritem  */
+#line 2837 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 12415 "build/spin.tab.c"
+    break;
+
+  case 517: /* exprlist: exprlist ',' expritem  */
+#line 2839 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 12421 "build/spin.tab.c"
+    break;
+
+  case 518: /* datexpritem: expr  */
+#line 2844 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 12427 "build/spin.tab.c"
+    break;
+
+  case 519: /* datexpritem: expr "[ in DAT" expr "] in DAT"  */
+#line 2846 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYDECL, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL); }
+#line 12433 "build/spin.tab.c"
+    break;
+
+  case 520: /* datexpritem: "LONG" datexpritem  */
+#line 2848 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_LONGLIST, (yyvsp[0].ast), NULL), NULL); }
+#line 12439 "build/spin.tab.c"
+    break;
+
+  case 521: /* datexpritem: "WORD" datexpritem  */
+#line 2850 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_WORDLIST, (yyvsp[0].ast), NULL), NULL); }
+#line 12445 "build/spin.tab.c"
+    break;
+
+  case 522: /* datexpritem: "BYTE" datexpritem  */
+#line 2852 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BYTELIST, (yyvsp[0].ast), NULL), NULL); }
+#line 12451 "build/spin.tab.c"
+    break;
+
+  case 523: /* datexpritem: "WORDFIT" datexpritem  */
+#line 2854 "frontends/spin/spin.y"
+       {
+           AST *dat = NewAST(AST_EXPRLIST, NewAST(AST_WORDFITLIST, (yyvsp[0].ast), NULL), NULL);
+           dat->d.ival = 1; // make it fit
+           (yyval.ast) = dat;
+       }
+#line 12461 "build/spin.tab.c"
+    break;
+
+  case 524: /* datexpritem: "BYTEFIT" datexpritem  */
+#line 2860 "frontends/spin/spin.y"
+       {
+           AST *dat = NewAST(AST_EXPRLIST, NewAST(AST_BYTEFITLIST, (yyvsp[0].ast), NULL), NULL);
+           (yyval.ast) = dat;
+       }
+#line 12470 "build/spin.tab.c"
+    break;
+
+  case 525: /* datexpritem: "FVAR" datexpritem  */
+#line 2865 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_FVAR_LIST, (yyvsp[0].ast), NULL), NULL); }
+#line 12476 "build/spin.tab.c"
+    break;
+
+  case 526: /* datexpritem: "FVARS" datexpritem  */
+#line 2867 "frontends/spin/spin.y"
+       { (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_FVARS_LIST, (yyvsp[0].ast), NULL), NULL); }
+#line 12482 "build/spin.tab.c"
+    break;
+
+  case 527: /* datexprlist: datexpritem  */
+#line 2872 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 12488 "build/spin.tab.c"
+    break;
+
+  case 528: /* datexprlist: datexprlist ',' datexpritem  */
+#line 2874 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 12494 "build/spin.tab.c"
+    break;
+
+  case 529: /* optcatch: %empty  */
+#line 2879 "frontends/spin/spin.y"
+    { (yyval.ast) = NULL; }
+#line 12500 "build/spin.tab.c"
+    break;
+
+  case 530: /* optcatch: '\\'  */
+#line 2881 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_CATCH, NULL, NULL); }
+#line 12506 "build/spin.tab.c"
+    break;
+
+  case 531: /* operand: expr  */
+#line 2886 "frontends/spin/spin.y"
+   { (yyval.ast) = NewAST(AST_EXPRLIST, (yyvsp[0].ast), NULL); }
+#line 12512 "build/spin.tab.c"
+    break;
+
+  case 532: /* operand: '#' optcatch expr  */
+#line 2888 "frontends/spin/spin.y"
+   {
+       AST *catchexpr = (yyvsp[-1].ast);
+       AST *expr = (yyvsp[0].ast);
+       if (catchexpr) {
+           catchexpr->left = expr;
+           expr = catchexpr;
+       }
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_IMMHOLDER, expr, NULL), NULL);
+   }
+#line 12526 "build/spin.tab.c"
+    break;
+
+  case 533: /* operand: '#' '#' optcatch expr  */
+#line 2898 "frontends/spin/spin.y"
+   {
+       AST *catchexpr = (yyvsp[-1].ast);
+       AST *expr = (yyvsp[0].ast);
+       if (catchexpr) {
+           catchexpr->left = expr;
+           expr = catchexpr;
+       }
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_BIGIMMHOLDER, expr, NULL), NULL);
+   }
+#line 12540 "build/spin.tab.c"
+    break;
+
+  case 534: /* operand: expr '[' expr ']'  */
+#line 2908 "frontends/spin/spin.y"
+   {
+       /* this is an extra rule for ptra++[Y] */
+       (yyval.ast) = NewAST(AST_EXPRLIST, NewAST(AST_ARRAYREF, (yyvsp[-3].ast), (yyvsp[-1].ast)), NULL);
+   }
+#line 12549 "build/spin.tab.c"
+    break;
+
+  case 535: /* operandlist: operand  */
+#line 2916 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 12555 "build/spin.tab.c"
+    break;
+
+  case 536: /* operandlist: operandlist ',' operand  */
+#line 2918 "frontends/spin/spin.y"
+   { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 12561 "build/spin.tab.c"
+    break;
+
+  case 537: /* range: expr  */
+#line 2923 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_RANGE, (yyvsp[0].ast), NULL); }
+#line 12567 "build/spin.tab.c"
+    break;
+
+  case 538: /* range: expr ".." expr  */
+#line 2925 "frontends/spin/spin.y"
+    { (yyval.ast) = NewAST(AST_RANGE, (yyvsp[-2].ast), (yyvsp[0].ast)); }
+#line 12573 "build/spin.tab.c"
+    break;
+
+  case 540: /* integer: "NEWTASK"  */
+#line 2931 "frontends/spin/spin.y"
+    { (yyval.ast) = AstInteger(-1); }
+#line 12579 "build/spin.tab.c"
+    break;
+
+  case 541: /* integer: "THISTASK"  */
+#line 2933 "frontends/spin/spin.y"
+    { (yyval.ast) = AstInteger(-1); }
+#line 12585 "build/spin.tab.c"
+    break;
+
+  case 544: /* identifier: "identifier"  */
+#line 2946 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 12591 "build/spin.tab.c"
+    break;
+
+  case 545: /* identifier: "RESULT"  */
+#line 2948 "frontends/spin/spin.y"
+  { (yyval.ast) = NewAST(AST_RESULT, NULL, NULL); }
+#line 12597 "build/spin.tab.c"
+    break;
+
+  case 546: /* annotation: SP_ANNOTATION  */
+#line 2953 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 12603 "build/spin.tab.c"
+    break;
+
+  case 547: /* hwreg: "hardware register"  */
+#line 2959 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 12609 "build/spin.tab.c"
+    break;
+
+  case 548: /* instruction: "instruction"  */
+#line 2964 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 12615 "build/spin.tab.c"
+    break;
+
+  case 549: /* instruction: '<' "instruction"  */
+#line 2966 "frontends/spin/spin.y"
+    {
+        AST *ast = (yyvsp[0].ast);
+        AST *rootast = (yyvsp[0].ast);
+        AST *parent = NULL;
+        while (ast->kind == AST_SRCCOMMENT || ast->kind == AST_COMMENT)
+        {
+            parent = ast;
+            ast = ast->right;
+        }
+        ast = NewAST(AST_COMPRESS_INSTR, ast, NULL);
+        if (parent) {
+            parent->right = ast;
+            (yyval.ast) = rootast;
+        } else {
+            (yyval.ast) = ast;
+        }
+    }
+#line 12637 "build/spin.tab.c"
+    break;
+
+  case 550: /* instruction: instrmodifier instruction  */
+#line 2984 "frontends/spin/spin.y"
+    { (yyval.ast) = AddToList((yyvsp[0].ast), (yyvsp[-1].ast)); }
+#line 12643 "build/spin.tab.c"
+    break;
+
+  case 551: /* instrmodifier: "instruction modifier"  */
+#line 2989 "frontends/spin/spin.y"
+  { (yyval.ast) = (yyvsp[0].ast); }
+#line 12649 "build/spin.tab.c"
+    break;
+
+  case 552: /* modifierlist: instrmodifier  */
+#line 2994 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderStart((yyvsp[0].ast)); }
+#line 12655 "build/spin.tab.c"
+    break;
+
+  case 553: /* modifierlist: modifierlist instrmodifier  */
+#line 2996 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-1].list), (yyvsp[0].ast)); }
+#line 12661 "build/spin.tab.c"
+    break;
+
+  case 554: /* modifierlist: modifierlist ',' instrmodifier  */
+#line 2998 "frontends/spin/spin.y"
+    { (yyval.list) = ListBuilderAdd((yyvsp[-2].list), (yyvsp[0].ast)); }
+#line 12667 "build/spin.tab.c"
+    break;
+
+  case 555: /* structname: "STRUCTURE NAME"  */
+#line 3003 "frontends/spin/spin.y"
+    { (yyval.ast) = (yyvsp[0].ast); }
+#line 12673 "build/spin.tab.c"
+    break;
+
+  case 556: /* structname: "identifier" '.' "STRUCTURE NAME"  */
+#line 3005 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 12681 "build/spin.tab.c"
+    break;
+
+  case 557: /* structname: structname '.' "STRUCTURE NAME"  */
+#line 3009 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 12689 "build/spin.tab.c"
+    break;
+
+  case 558: /* ptrstructname: '^' structname  */
+#line 3015 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = NewAST(AST_REFTYPE, (yyvsp[0].ast), NULL);
+    }
+#line 12697 "build/spin.tab.c"
+    break;
+
+  case 559: /* ptrstructname: structname  */
+#line 3019 "frontends/spin/spin.y"
+    {
+        (yyval.ast) = (yyvsp[0].ast);
+    }
+#line 12705 "build/spin.tab.c"
+    break;
+
+
+#line 12709 "build/spin.tab.c"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == SPINYYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
+        char const *yymsgp = YY_("syntax error");
+        int yysyntax_error_status;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+        if (yysyntax_error_status == 0)
+          yymsgp = yymsg;
+        else if (yysyntax_error_status == -1)
+          {
+            if (yymsg != yymsgbuf)
+              YYSTACK_FREE (yymsg);
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
+              {
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
+              }
+            else
+              {
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
+              }
+          }
+        yyerror (yymsgp);
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
+      }
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= SPINYYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == SPINYYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = SPINYYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != SPINYYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+  if (yymsg != yymsgbuf)
+    YYSTACK_FREE (yymsg);
+  return yyresult;
+}
+
+#line 3023 "frontends/spin/spin.y"
+
+
+void
+spinyyerror(const char *msg)
+{
+    extern int saved_spinyychar;
+    int yychar = saved_spinyychar;
+    const char *new_keyword = NULL;
+    
+    SETCOLOR(PRINT_ERROR);
+    ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "error");
+
+    if (!strcmp(msg, "syntax error, unexpected $end")) {
+        fprintf(stderr, "syntax error, unexpected end of file");
+        msg = "";
+    }
+    // massage bison's error messages to make them easier to understand
+    while (*msg) {
+        // say which identifier was unexpected
+        if (!strncmp(msg, "unexpected identifier", strlen("unexpected identifier")) && last_ast && last_ast->kind == AST_IDENTIFIER) {
+            fprintf(stderr, "unexpected identifier `%s'", last_ast->d.string);
+            msg += strlen("unexpected identifier");
+            if (Spin2NewKeyword(current->Lptr, last_ast->d.string)) {
+                new_keyword = last_ast->d.string;
+            }
+        }
+        // if we get a stray character in source, sometimes bison tries to treat it as a token for
+        // error purposes, resulting in $undefined as the token
+        else if (!strncmp(msg, "$undefined", strlen("$undefined")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("$undefined");
+        }
+        else if (!strncmp(msg, "invalid token", strlen("invalid token")) && yychar >= ' ' && yychar < 127) {
+            fprintf(stderr, "%c", yychar);
+            msg += strlen("invalid token");
+        }
+        else {
+            fprintf(stderr, "%c", *msg);
+            msg++;
+        }
+    }
+    fprintf(stderr, "\n");
+    gl_errors++;
+    RESETCOLOR();
+    if (!new_keyword && prev_last_ast && prev_last_ast->kind == AST_IDENTIFIER) {
+        if (Spin2NewKeyword(current->Lptr, prev_last_ast->d.string)) {
+            new_keyword = prev_last_ast->d.string;
+        }
+    }
+    if (new_keyword) {
+        SETCOLOR(PRINT_WARNING);
+        ERRORHEADER(current->Lptr->fileName, current->Lptr->lineCounter, "note");
+        fprintf(stderr, "`%s' is a keyword in some Spin2 versions; did you forget a {Spin2_vXX} comment?\n", new_keyword);
+        RESETCOLOR();
+    }
+}
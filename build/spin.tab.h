@@ -0,0 +1,287 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED
+# define YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED
+/* Debug traces.  */
+#ifndef SPINYYDEBUG
+# if defined YYDEBUG
+#if YYDEBUG
+#   define SPINYYDEBUG 1
+#  else
+#   define SPINYYDEBUG 0
+#  endif
+# else /* ! defined YYDEBUG */
+#  define SPINYYDEBUG 1
+# endif /* ! defined YYDEBUG */
+#endif  /* ! defined SPINYYDEBUG */
+#if SPINYYDEBUG
+extern int spinyydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef SPINYYTOKENTYPE
+# define SPINYYTOKENTYPE
+  enum spinyytokentype
+  {
+    SPINYYEMPTY = -2,
+    SPINYYEOF = 0,                 /* "end of file"  */
+    SPINYYerror = 256,             /* error  */
+    SPINYYUNDEF = 257,             /* "invalid token"  */
+    SP_IDENTIFIER = 258,           /* "identifier"  */
+    SP_BYTECODE = 259,             /* "__bytecode__"  */
+    SP_NUM = 260,                  /* "number"  */
+    SP_STRING = 261,               /* "string"  */
+    SP_BACKTICK_STRING = 262,      /* "` string"  */
+    SP_FLOATNUM = 263,             /* "float point number"  */
+    SP_SPR = 264,                  /* "SPR"  */
+    SP_COGREG = 265,               /* "REG"  */
+    SP_CON = 266,                  /* "CON"  */
+    SP_VAR = 267,                  /* "VAR"  */
+    SP_DAT = 268,                  /* "DAT"  */
+    SP_PUB = 269,                  /* "PUB"  */
+    SP_PRI = 270,                  /* "PRI"  */
+    SP_OBJ = 271,                  /* "OBJ"  */
+    SP_END = 272,                  /* "END"  */
+    SP_INLINECCODE = 273,          /* "CCODE"  */
+    SP_BYTE = 274,                 /* "BYTE"  */
+    SP_WORD = 275,                 /* "WORD"  */
+    SP_LONG = 276,                 /* "LONG"  */
+    SP_QUAD = 277,                 /* "%QUAD"  */
+    SP_BYTEFIT = 278,              /* "BYTEFIT"  */
+    SP_WORDFIT = 279,              /* "WORDFIT"  */
+    SP_FVAR = 280,                 /* "FVAR"  */
+    SP_FVARS = 281,                /* "FVARS"  */
+    SP_ASMCLK = 282,               /* "ASMCLK"  */
+    SP_INSTR = 283,                /* "instruction"  */
+    SP_INSTRMODIFIER = 284,        /* "instruction modifier"  */
+    SP_HWREG = 285,                /* "hardware register"  */
+    SP_ORG = 286,                  /* "ORG"  */
+    SP_ORGH = 287,                 /* "ORGH"  */
+    SP_ORGF = 288,                 /* "ORGF"  */
+    SP_RES = 289,                  /* "RES"  */
+    SP_FIT = 290,                  /* "FIT"  */
+    SP_ALIGNL = 291,               /* "ALIGNL"  */
+    SP_ALIGNW = 292,               /* "ALIGNW"  */
+    SP_REPEAT = 293,               /* "REPEAT"  */
+    SP_FROM = 294,                 /* "FROM"  */
+    SP_TO = 295,                   /* "TO"  */
+    SP_STEP = 296,                 /* "STEP"  */
+    SP_WHILE = 297,                /* "WHILE"  */
+    SP_WITH = 298,                 /* "WITH"  */
+    SP_UNTIL = 299,                /* "UNTIL"  */
+    SP_IF = 300,                   /* "IF"  */
+    SP_IFNOT = 301,                /* "IFNOT"  */
+    SP_ELSE = 302,                 /* "ELSE"  */
+    SP_ELSEIF = 303,               /* "ELSEIF"  */
+    SP_ELSEIFNOT = 304,            /* "ELSEIFNOT"  */
+    SP_THEN = 305,                 /* "THEN"  */
+    SP_ENDIF = 306,                /* "ENDIF"  */
+    SP_LOOKDOWN = 307,             /* "LOOKDOWN"  */
+    SP_LOOKDOWNZ = 308,            /* "LOOKDOWNZ"  */
+    SP_LOOKUP = 309,               /* "LOOKUP"  */
+    SP_LOOKUPZ = 310,              /* "LOOKUPZ"  */
+    SP_COGINIT = 311,              /* "COGINIT"  */
+    SP_COGNEW = 312,               /* "COGNEW"  */
+    SP_TASKINIT = 313,             /* "TASKSPIN"  */
+    SP_TASKHLT = 314,              /* "TASKHLT"  */
+    SP_PINR = 315,                 /* "PINREAD"  */
+    SP_PINT = 316,                 /* "PINTOGGLE"  */
+    SP_PINW = 317,                 /* "PINWRITE"  */
+    SP_PINL = 318,                 /* "PINLOW"  */
+    SP_PINH = 319,                 /* "PINHIGH"  */
+    SP_CASE = 320,                 /* "CASE"  */
+    SP_CASE_FAST = 321,            /* "CASE_FAST"  */
+    SP_OTHER = 322,                /* "OTHER"  */
+    SP_QUIT = 323,                 /* "QUIT"  */
+    SP_NEXT = 324,                 /* "NEXT"  */
+    SP_ALLOCA = 325,               /* "__BUILTIN_ALLOCA"  */
+    SP_REGEXEC = 326,              /* "REGEXEC"  */
+    SP_REGLOAD = 327,              /* "REGLOAD"  */
+    SP_ABORT = 328,                /* "ABORT"  */
+    SP_RESULT = 329,               /* "RESULT"  */
+    SP_RETURN = 330,               /* "RETURN"  */
+    SP_INDENT = 331,               /* "indentation"  */
+    SP_OUTDENT = 332,              /* "lack of indentation"  */
+    SP_EOLN = 333,                 /* "end of line"  */
+    SP_EOF = 334,                  /* "end of file"  */
+    SP_DOTS = 335,                 /* ".."  */
+    SP_HERE = 336,                 /* "$"  */
+    SP_STRINGPTR = 337,            /* "STRING"  */
+    SP_FILE = 338,                 /* "FILE"  */
+    SP_ANNOTATION = 339,           /* SP_ANNOTATION  */
+    SP_ASM = 340,                  /* "ASM"  */
+    SP_ASM_CONST = 341,            /* "ASM_CONST"  */
+    SP_ENDASM = 342,               /* "ENDASM"  */
+    SP_ASM_IF = 343,               /* "%IF"  */
+    SP_ASM_ELSEIF = 344,           /* "%ELSEIF"  */
+    SP_ASM_ELSE = 345,             /* "%ELSE"  */
+    SP_ASM_ENDIF = 346,            /* "%END"  */
+    SP_INTERFACE = 347,            /* "%INTERFACE"  */
+    SP_NAMESP = 348,               /* "%NAMESP"  */
+    SP_VARARGS = 349,              /* "%VARARGS"  */
+    SP_FIELD = 350,                /* "FIELD"  */
+    SP_BYTES = 351,                /* "BYTES"  */
+    SP_WORDS = 352,                /* "WORDS"  */
+    SP_LONGS = 353,                /* "LONGS"  */
+    SP_LSTRING = 354,              /* "LSTRING"  */
+    SP_TYPENAME = 355,             /* "STRUCTURE NAME"  */
+    SP_BYTESWAP = 356,             /* "BYTESWAP"  */
+    SP_WORDSWAP = 357,             /* "WORDSWAP"  */
+    SP_LONGSWAP = 358,             /* "LONGSWAP"  */
+    SP_BYTECOMP = 359,             /* "BYTECOMP"  */
+    SP_WORDCOMP = 360,             /* "WORDCOMP"  */
+    SP_LONGCOMP = 361,             /* "LONGCOMP"  */
+    SP_FILL = 362,                 /* "FILL"  */
+    SP_COPY = 363,                 /* "COPY"  */
+    SP_SWAP = 364,                 /* "SWAP"  */
+    SP_COMP = 365,                 /* "COMP"  */
+    SP_STRUCT = 366,               /* "STRUCT"  */
+    SP_SIZEOF = 367,               /* "SIZEOF"  */
+    SP_SWAP_OP = 368,              /* ":=:"  */
+    SP_C_Z = 369,                  /* "C_Z"  */
+    SP_NEWTASK = 370,              /* "NEWTASK"  */
+    SP_THISTASK = 371,             /* "THISTASK"  */
+    SP_DITTO = 372,                /* "DITTO"  */
+    SP_ASSIGN = 373,               /* ":="  */
+    SP_XOR = 374,                  /* "XOR (^^)"  */
+    SP_OR = 375,                   /* "OR (||)"  */
+    SP_AND = 376,                  /* "AND (&&)"  */
+    SP_ORELSE = 377,               /* "__ORELSE__"  */
+    SP_ANDTHEN = 378,              /* "__ANDTHEN__"  */
+    SP_GE = 379,                   /* "=>"  */
+    SP_LE = 380,                   /* "=<"  */
+    SP_GEU = 381,                  /* "+=>"  */
+    SP_LEU = 382,                  /* "+=<"  */
+    SP_GTU = 383,                  /* "+>"  */
+    SP_LTU = 384,                  /* "+<"  */
+    SP_NE = 385,                   /* "<>"  */
+    SP_EQ = 386,                   /* "=="  */
+    SP_SGNCOMP = 387,              /* "<=>"  */
+    SP_LIMITMIN = 388,             /* "#>"  */
+    SP_LIMITMAX = 389,             /* "<#"  */
+    SP_REMAINDER = 390,            /* "//"  */
+    SP_UNSDIV = 391,               /* "+/"  */
+    SP_UNSMOD = 392,               /* "+//"  */
+    SP_FRAC = 393,                 /* "FRAC"  */
+    SP_HIGHMULT = 394,             /* "**"  */
+    SP_SCAS = 395,                 /* "SCAS"  */
+    SP_UNSHIGHMULT = 396,          /* "SCA (+**)"  */
+    SP_ROTR = 397,                 /* "ROR (->)"  */
+    SP_ROTL = 398,                 /* "ROL (<-)"  */
+    SP_SHL = 399,                  /* "<<"  */
+    SP_SHR = 400,                  /* ">>"  */
+    SP_SAR = 401,                  /* "SAR (~>)"  */
+    SP_REV = 402,                  /* "><"  */
+    SP_REV2 = 403,                 /* "REV"  */
+    SP_ADDBITS = 404,              /* "ADDBITS"  */
+    SP_ADDPINS = 405,              /* "ADDPINS"  */
+    SP_NEGATE = 406,               /* "-"  */
+    SP_BIT_NOT = 407,              /* "!"  */
+    SP_SQRT = 408,                 /* "SQRT (^^)"  */
+    SP_ABS = 409,                  /* "ABS (||)"  */
+    SP_FSQRT = 410,                /* "FSQRT"  */
+    SP_FABS = 411,                 /* "FABS"  */
+    SP_DECODE = 412,               /* "DECOD (|<)"  */
+    SP_ENCODE = 413,               /* ">|"  */
+    SP_ENCODE2 = 414,              /* "ENCOD"  */
+    SP_NOT = 415,                  /* "NOT (!!)"  */
+    SP_DOUBLETILDE = 416,          /* "~~"  */
+    SP_INCREMENT = 417,            /* "++"  */
+    SP_DECREMENT = 418,            /* "--"  */
+    SP_REF_INC = 419,              /* "[++]"  */
+    SP_REF_DEC = 420,              /* "[--]"  */
+    SP_DOUBLEAT = 421,             /* "@@"  */
+    SP_TRIPLEAT = 422,             /* "@@@"  */
+    SP_FIELDPTR = 423,             /* "^@"  */
+    SP_FLOAT = 424,                /* "floating point number"  */
+    SP_TRUNC = 425,                /* "TRUNC"  */
+    SP_ROUND = 426,                /* "ROUND"  */
+    SP_CONSTANT = 427,             /* "constant"  */
+    SP_RANDOM = 428,               /* "??"  */
+    SP_EMPTY = 429,                /* "empty assignment marker _"  */
+    SP_SIGNX = 430,                /* "SIGNX"  */
+    SP_ZEROX = 431,                /* "ZEROX"  */
+    SP_NAN = 432,                  /* "NAN"  */
+    SP_ONES = 433,                 /* "ONES"  */
+    SP_BMASK = 434,                /* "BMASK"  */
+    SP_QLOG = 435,                 /* "QLOG"  */
+    SP_QEXP = 436,                 /* "QEXP"  */
+    SP_DEBUG = 437,                /* "DEBUG"  */
+    SP_LOOK_SEP = 438,             /* ": after lookup/down"  */
+    SP_CONDITIONAL = 439,          /* "?"  */
+    SP_CONDITIONAL_SEP = 440,      /* ": after ?"  */
+    SP_REPEAT_SEP = 441,           /* ": after repeat"  */
+    SP_LOG2 = 442,                 /* "LOG2"  */
+    SP_EXP2 = 443,                 /* "EXP2"  */
+    SP_LOG10 = 444,                /* "LOG10"  */
+    SP_EXP10 = 445,                /* "EXP10"  */
+    SP_LOG = 446,                  /* "LN"  */
+    SP_EXP = 447,                  /* "EXP"  */
+    SP_POW = 448,                  /* "POW"  */
+    SP_MOVBYTS = 449,              /* "MOVBYTS"  */
+    SP_ENDIANL = 450,              /* "ENDIANL"  */
+    SP_ENDIANW = 451,              /* "ENDIANW"  */
+    SP_DEBUG_END_SESSION = 452,    /* "DEBUG_END_SESSION"  */
+    SP_OFFSETOF = 453,             /* "OFFSETOF"  */
+    SP_FADD = 454,                 /* "+."  */
+    SP_FSUB = 455,                 /* "-."  */
+    SP_FMUL = 456,                 /* "*."  */
+    SP_FDIV = 457,                 /* "%."  */
+    SP_FLT = 458,                  /* "<."  */
+    SP_FGT = 459,                  /* ">."  */
+    SP_FNE = 460,                  /* "<>."  */
+    SP_FEQ = 461,                  /* "==."  */
+    SP_FLE = 462,                  /* "<=."  */
+    SP_FGE = 463,                  /* ">=."  */
+    SP_FNEGATE = 464,              /* "float negate"  */
+    SP_DAT_LBRACK = 465,           /* "[ in DAT"  */
+    SP_DAT_RBRACK = 466,           /* "] in DAT"  */
+    SP_DOUBLE_DOLLAR = 467         /* "$$"  */
+  };
+  typedef enum spinyytokentype spinyytoken_kind_t;
+#endif
+
+/* Value type.  */
+
+
+
+
+int spinyyparse (void);
+
+
+#endif /* !YY_SPINYY_BUILD_SPIN_TAB_H_INCLUDED  */
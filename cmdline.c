@@ -130,6 +130,20 @@ CompileAsmToBinary(const char *binname, const char *asmname)
     }
 }
 
+//
+// print internal statistics about the compilation (--stats)
+//
+static void
+PrintStatistics(void)
+{
+    printf("Memory arenas:\n");
+    arena_print_stats(stdout, &ast_arena);
+    arena_print_stats(stdout, &symbol_arena);
+    arena_print_stats(stdout, &linedata_arena);
+    PrintPeepholeStats(stdout);
+    PrintIRCacheStats(stdout);
+}
+
 int ProcessCommandLine(CmdLineOptions *cmd)
 {
     Module *P;
@@ -413,6 +427,10 @@ int ProcessCommandLine(CmdLineOptions *cmd)
                     asmname = ReplaceExtension(P->fullname, gl_p2 ? ".p2asm" : ".pasm");
                 }
             }
+            if (cmd->cycleReport) {
+                // goes next to the listing file
+                gl_cycle_report = ReplaceExtension(binname ? binname : P->fullname, ".cycles.json");
+            }
             if (gl_errors >= gl_max_errors) {
                 if (asmname) remove(asmname);
                 if (binname) remove(binname);
@@ -475,6 +493,9 @@ int ProcessCommandLine(CmdLineOptions *cmd)
         return 1;
     }
 
+    if (cmd->printStats) {
+        PrintStatistics();
+    }
     return 0;
 }
 
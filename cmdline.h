@@ -23,6 +23,8 @@ typedef struct CmdLineOptions {
     int quiet;
     int bstcMode;
     int printSizes;
+    int cycleReport;
+    int printStats;
     const char *outname;
 #define MAX_FILES_ON_CMD_LINE 1024
     int file_argc;
@@ -3004,6 +3004,9 @@ ExprType(AST *expr)
 /*
  * figure out an expression's type
  * returns NULL if we can't deduce it
+ * the result is deliberately not cached on the node: it is cheap to
+ * recompute, and function return types are filled in (and the tree
+ * rewritten) in place while types are being inferred
  */
 AST *
 ExprTypeRelative(SymbolTable *table, AST *expr, Module *P)
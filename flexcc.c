@@ -72,14 +72,18 @@ Usage(FILE *f)
     fprintf(f, "  [ -Wmax-errors=N ] allow at most N errors in a pass before stopping\n");
     fprintf(f, "  [ -x ]             capture program exit code (for testing)\n");
     //fprintf(f, "  [ -z ]             compress code\n");
+    fprintf(f, "  [ --cache-dir=dir ] save optimized code in dir and reuse it in later compiles\n");
     fprintf(f, "  [ --code=cog ]     compile for COG mode instead of LMM\n");
+    fprintf(f, "  [ --cycle-report ] write estimated cycle counts for each function to a .cycles.json file\n");
     fprintf(f, "  [ --fcache=N ]     set FCACHE size to N (0 to disable)\n");
     fprintf(f, "  [ --fixedreal ]    use 16.16 fixed point in place of floats\n");
     fprintf(f, "  [ --lmm=xxx ]      use alternate LMM implementation for P1\n");
     fprintf(f, "           xxx = orig uses original flexspin LMM\n");
     fprintf(f, "           xxx = slow uses traditional (slow) LMM\n");
     fprintf(f, "  [ --nostdlib]      skip searching in the standard library location for include files\n");
+    fprintf(f, "  [ --profile-use=file ] use execution counts in file to guide optimization\n");
     fprintf(f, "  [ --sizes]         print info about program sizes\n");
+    fprintf(f, "  [ --stats ]        print internal compiler statistics\n");
     fprintf(f, "  [ --verbose ]      print additional diagnostic messages (for debugging the compiler)\n");
     fprintf(f, "  [ --version ]      just show compiler version\n");
     fprintf(f, "  [ --zip ]          create zip archive of source files\n");
@@ -265,6 +269,18 @@ main(int argc, const char **argv)
         } else if (!strcmp(argv[0], "--verbose")) {
             gl_verbosity = 1;
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--cache-dir=", 12)) {
+            gl_ircache_dir = argv[0]+12;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--profile-use=", 14)) {
+            gl_profile_use = argv[0]+14;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--cycle-report")) {
+            cmd->cycleReport = 1;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--stats")) {
+            cmd->printStats = 1;
+            argv++; --argc;
         } else if (!strcmp(argv[0], "--sizes")) {
             cmd->printSizes = 1;
             argv++; --argc;
@@ -94,10 +94,12 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "  [ -C ]             enable case sensitive mode\n");
     fprintf(f, "  [ -x ]             capture program exit code (for testing)\n");
     //fprintf(f, "  [ -z ]             compress code\n");
+    fprintf(f, "  [ --cache-dir=dir ] save optimized code in dir and reuse it in later compiles\n");
     fprintf(f, "  [ --charset=xxx ]  set character set for runtime\n");
     fprintf(f, "           xxx is one of utf8, latin1, shiftjis, or parallax\n");
     fprintf(f, "  [ --code=cog ]     compile for COG mode instead of LMM\n");
     fprintf(f, "  [ --compress ]     compress output binary for faster download\n");
+    fprintf(f, "  [ --cycle-report ] write estimated cycle counts for each function to a .cycles.json file\n");
     fprintf(f, "  [ --interp=rom ]   compile bytecodes for P1 ROM interpreter (alpha feature!)\n");
     fprintf(f, "  [ --interp=nu ]    compile bytecodes for NuCode interpreter (alpha feature!)\n");
     fprintf(f, "  [ --fcache=N ]     set FCACHE size to N (0 to disable)\n");
@@ -106,7 +108,9 @@ Usage(FILE *f, int bstcMode)
     fprintf(f, "           xxx = orig uses original flexspin LMM\n");
     fprintf(f, "           xxx = slow uses traditional (slow) LMM\n");
     fprintf(f, "  [ --nostdlib]      skip searching in the standard library location for include files\n");
+    fprintf(f, "  [ --profile-use=file ] use execution counts in file to guide optimization\n");
     fprintf(f, "  [ --sizes]         print code and interpreter sizes\n");
+    fprintf(f, "  [ --stats ]        print internal compiler statistics\n");
     fprintf(f, "  [ --tabs=N ]       assume tabs are set every N spaces for indentation purposes\n");
     fprintf(f, "  [ --verbose ]      print additional diagnostic messages (for debugging the compiler)\n");
     fprintf(f, "  [ --version ]      just show compiler version\n");
@@ -310,6 +314,18 @@ main(int argc, const char **argv)
         } else if (!strcmp(argv[0], "--verbose")) {
             gl_verbosity = 1;
             argv++; --argc;
+        } else if (!strncmp(argv[0], "--cache-dir=", 12)) {
+            gl_ircache_dir = argv[0]+12;
+            argv++; --argc;
+        } else if (!strncmp(argv[0], "--profile-use=", 14)) {
+            gl_profile_use = argv[0]+14;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--cycle-report")) {
+            cmd->cycleReport = 1;
+            argv++; --argc;
+        } else if (!strcmp(argv[0], "--stats")) {
+            cmd->printStats = 1;
+            argv++; --argc;
         } else if (!strcmp(argv[0], "--sizes")) {
             cmd->printSizes = 1;
             argv++; --argc;
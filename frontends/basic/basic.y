@@ -15,7 +15,6 @@
 #include "frontends/common.h"
 #include "frontends/lexer.h"
 
-#define BASICYYSTYPE AST*
 #undef  YYSTYPE
 #define YYSTYPE BASICYYSTYPE
     
@@ -336,7 +335,7 @@ GetCurrentLoop(int token)
 static AST *
 BuildOnGotoCases(AST *exprlist)
 {
-    AST *list = NULL;
+    ListBuilder list = { NULL, NULL };
     AST *target;
     AST *item;
     int index = 1;
@@ -356,10 +355,10 @@ BuildOnGotoCases(AST *exprlist)
         item = NewAST(AST_EXPRLIST, AstInteger(index), NULL);
         item = NewAST(AST_CASEITEM, item, gostmt);
         item = NewAST(AST_STMTLIST, item, NULL);
-        list = AddToList(list, item);
+        list = ListBuilderAdd(list, item);
         index++;
     }
-    return list;
+    return list.head;
 }
 
 static AST *
@@ -392,162 +391,162 @@ AdjustParamForByVal(AST *param)
 
 %}
 
-%token BAS_EMPTY      "_"
-%token BAS_IDENTIFIER "identifier"
-%token BAS_LABEL_INFERRED      "label"
-%token BAS_LABEL_EXPLICIT       "label:"
-%token BAS_INTEGER    "integer number"
-%token BAS_FLOAT      "number"
-%token BAS_STRING     "literal string"
-%token BAS_EOLN       "end of line"
-%token BAS_EOF        "end of file"
-%token BAS_TYPENAME   "type name"
-%token BAS_INSTR      "asm instruction"
-%token BAS_INSTRMODIFIER "asm instruction modifier"
-%token BAS_HWREG      "hardware register"
-%token BAS_ALIGNL     "alignl"
-%token BAS_ALIGNW     "alignw"
-%token BAS_FILE       "file"
-%token BAS_FIT        "fit"
-%token BAS_ORG        "org"
-%token BAS_ORGF       "orgf"
-%token BAS_ORGH       "orgh"
-%token BAS_RES        "res"
+%token <ast> BAS_EMPTY      "_"
+%token <ast> BAS_IDENTIFIER "identifier"
+%token <ast> BAS_LABEL_INFERRED      "label"
+%token <ast> BAS_LABEL_EXPLICIT       "label:"
+%token <ast> BAS_INTEGER    "integer number"
+%token <ast> BAS_FLOAT      "number"
+%token <ast> BAS_STRING     "literal string"
+%token <ast> BAS_EOLN       "end of line"
+%token <ast> BAS_EOF        "end of file"
+%token <ast> BAS_TYPENAME   "type name"
+%token <ast> BAS_INSTR      "asm instruction"
+%token <ast> BAS_INSTRMODIFIER "asm instruction modifier"
+%token <ast> BAS_HWREG      "hardware register"
+%token <ast> BAS_ALIGNL     "alignl"
+%token <ast> BAS_ALIGNW     "alignw"
+%token <ast> BAS_FILE       "file"
+%token <ast> BAS_FIT        "fit"
+%token <ast> BAS_ORG        "org"
+%token <ast> BAS_ORGF       "orgf"
+%token <ast> BAS_ORGH       "orgh"
+%token <ast> BAS_RES        "res"
 
 /* keywords */
-%token BAS_ABS        "abs"
-%token BAS_ALIAS      "alias"
-%token BAS_AND        "and"
-%token BAS_ANDALSO    "andalso"
-%token BAS_ANY        "any"
-%token BAS_APPEND     "append"
-%token BAS_AS         "as"
-%token BAS_ASC        "asc"
-%token BAS_ASM        "asm"
-%token BAS_ALLOCA     "__builtin_alloca"
-%token BAS_BOOLEAN    "boolean"
-%token BAS_BYREF      "byref"
-%token BAS_BYTE       "byte"
-%token BAS_BYVAL      "byval"
-%token BAS_CALL       "call"
-%token BAS_CASE       "case"
-%token BAS_CAST       "cast"
-%token BAS_CATCH      "catch"
-%token BAS_CHAIN      "chain"
-%token BAS_CLASS      "class"
-%token BAS_CLOSE      "close"
-%token BAS_CONST      "const"
-%token BAS_CONTINUE   "continue"
-%token BAS_CPU        "cpu"
-%token BAS_DATA       "data"
-%token BAS_DECLARE    "declare"
-%token BAS_DEF        "def"
-%token BAS_DEFINT     "defint"
-%token BAS_DEFSNG     "defsng"
-%token BAS_DELETE     "delete"
-%token BAS_DIM        "dim"
-%token BAS_DIRECTION  "direction"
-%token BAS_DO         "do"
-%token BAS_DOUBLE     "double"
-%token BAS_ELSE       "else"
-%token BAS_END        "end"
-%token BAS_ENDIF      "endif"
-%token BAS_ENUM       "enum"
-%token BAS_EXIT       "exit"
-%token BAS_EXTERN     "extern"
-%token BAS_FIXED      "fixed"
-%token BAS_FOR        "for"
-%token BAS_FUNCTION   "function"
-%token BAS_FUNC_NAME  "__FUNCTION__"
-%token BAS_GET        "get"
-%token BAS_GOTO       "goto"
-%token BAS_GOSUB      "gosub"
-%token BAS_HASMETHOD  "_hasmethod"
-%token BAS_IF         "if"
-%token BAS_IMPLEMENTS "implements"
-%token BAS_IMPORT     "import"
-%token BAS_INPUT      "input"
-%token BAS_CAST_INT   "int"
-%token BAS_INTEGER_KW "integer"
-%token BAS_INTERFACE  "interface"
-%token BAS_LEN        "len"
-%token BAS_LET        "let"
-%token BAS_LIB        "lib"
-%token BAS_LINE       "line"
-%token BAS_LONG       "long"
-%token BAS_LONGINT    "longint"
-%token BAS_LOOP       "loop"
-%token BAS_MOD        "mod"
-%token BAS_NEW        "new"
-%token BAS_NEXT       "next"
-%token BAS_NIL        "nil"
-%token BAS_NOT        "not"
-%token BAS_OFFSETOF   "offsetof"
-%token BAS_ON         "on"
-%token BAS_OPEN       "open"
-%token BAS_OPTION     "option"
-%token BAS_OR         "or"
-%token BAS_ORELSE     "orelse"
-%token BAS_OUTPUT     "output"
-%token BAS_POINTER    "pointer"
-%token BAS_PRESERVE   "preserve"
-%token BAS_PRINT      "print"
-%token BAS_PRIVATE    "private"
-%token BAS_PROGRAM    "program"
-%token BAS_PTR        "ptr"
-%token BAS_PUT        "put"
-%token BAS_READ       "read"
-%token BAS_REDIM      "redim"
-%token BAS_REGISTER   "register"
-%token BAS_RESTORE    "restore"
-%token BAS_RETURN     "return"
-%token BAS_SAMETYPES  "_sametypes"
-%token BAS_SELECT     "select"
-%token BAS_SELF       "self"
-%token BAS_SHARED     "shared"
-%token BAS_SHORT      "short"
-%token BAS_SINGLE     "single"
-%token BAS_SIZEOF     "sizeof"
-%token BAS_SQRT       "sqrt"
-%token BAS_STEP       "step"
-%token BAS_STRING_KW  "string"
-%token BAS_STRUCT     "struct"
-%token BAS_SUB        "sub"
-%token BAS_THEN       "then"
-%token BAS_THROW      "throw"
-%token BAS_THROWIFCAUGHT      "throwifcaught"
-%token BAS_TO         "to"
-%token BAS_TRY        "try"
-%token BAS_TYPE       "type"
-%token BAS_UBYTE      "ubyte"
-%token BAS_UINTEGER   "uinteger"
-%token BAS_ULONG      "ulong"
-%token BAS_ULONGINT   "ulongint"
-%token BAS_UNION      "union"
-%token BAS_UNTIL      "until"
-%token BAS_USHORT     "ushort"
-%token BAS_USING      "using"
-%token BAS_VAR        "var"
-%token BAS_WEND       "wend"
-%token BAS_WITH       "with"
-%token BAS_WHILE      "while"
-%token BAS_WORD       "word"
-%token BAS_XOR        "xor"
-%token BAS_LE         "<="
-%token BAS_GE         ">="
-%token BAS_NE         "<>"
-%token BAS_SHL        "shl"
-%token BAS_SHR        "shr"
-%token BAS_ABSADDR    "@@@"
-
-%token BAS_ADD_ASSIGN "+="
-%token BAS_SUB_ASSIGN "-="
-%token BAS_MUL_ASSIGN "*="
-%token BAS_DIV_ASSIGN "/="
-%token BAS_MOD_ASSIGN "MOD="
-%token BAS_AND_ASSIGN "AND="
-%token BAS_OR_ASSIGN "OR="
-%token BAS_XOR_ASSIGN "XOR="
+%token <ast> BAS_ABS        "abs"
+%token <ast> BAS_ALIAS      "alias"
+%token <ast> BAS_AND        "and"
+%token <ast> BAS_ANDALSO    "andalso"
+%token <ast> BAS_ANY        "any"
+%token <ast> BAS_APPEND     "append"
+%token <ast> BAS_AS         "as"
+%token <ast> BAS_ASC        "asc"
+%token <ast> BAS_ASM        "asm"
+%token <ast> BAS_ALLOCA     "__builtin_alloca"
+%token <ast> BAS_BOOLEAN    "boolean"
+%token <ast> BAS_BYREF      "byref"
+%token <ast> BAS_BYTE       "byte"
+%token <ast> BAS_BYVAL      "byval"
+%token <ast> BAS_CALL       "call"
+%token <ast> BAS_CASE       "case"
+%token <ast> BAS_CAST       "cast"
+%token <ast> BAS_CATCH      "catch"
+%token <ast> BAS_CHAIN      "chain"
+%token <ast> BAS_CLASS      "class"
+%token <ast> BAS_CLOSE      "close"
+%token <ast> BAS_CONST      "const"
+%token <ast> BAS_CONTINUE   "continue"
+%token <ast> BAS_CPU        "cpu"
+%token <ast> BAS_DATA       "data"
+%token <ast> BAS_DECLARE    "declare"
+%token <ast> BAS_DEF        "def"
+%token <ast> BAS_DEFINT     "defint"
+%token <ast> BAS_DEFSNG     "defsng"
+%token <ast> BAS_DELETE     "delete"
+%token <ast> BAS_DIM        "dim"
+%token <ast> BAS_DIRECTION  "direction"
+%token <ast> BAS_DO         "do"
+%token <ast> BAS_DOUBLE     "double"
+%token <ast> BAS_ELSE       "else"
+%token <ast> BAS_END        "end"
+%token <ast> BAS_ENDIF      "endif"
+%token <ast> BAS_ENUM       "enum"
+%token <ast> BAS_EXIT       "exit"
+%token <ast> BAS_EXTERN     "extern"
+%token <ast> BAS_FIXED      "fixed"
+%token <ast> BAS_FOR        "for"
+%token <ast> BAS_FUNCTION   "function"
+%token <ast> BAS_FUNC_NAME  "__FUNCTION__"
+%token <ast> BAS_GET        "get"
+%token <ast> BAS_GOTO       "goto"
+%token <ast> BAS_GOSUB      "gosub"
+%token <ast> BAS_HASMETHOD  "_hasmethod"
+%token <ast> BAS_IF         "if"
+%token <ast> BAS_IMPLEMENTS "implements"
+%token <ast> BAS_IMPORT     "import"
+%token <ast> BAS_INPUT      "input"
+%token <ast> BAS_CAST_INT   "int"
+%token <ast> BAS_INTEGER_KW "integer"
+%token <ast> BAS_INTERFACE  "interface"
+%token <ast> BAS_LEN        "len"
+%token <ast> BAS_LET        "let"
+%token <ast> BAS_LIB        "lib"
+%token <ast> BAS_LINE       "line"
+%token <ast> BAS_LONG       "long"
+%token <ast> BAS_LONGINT    "longint"
+%token <ast> BAS_LOOP       "loop"
+%token <ast> BAS_MOD        "mod"
+%token <ast> BAS_NEW        "new"
+%token <ast> BAS_NEXT       "next"
+%token <ast> BAS_NIL        "nil"
+%token <ast> BAS_NOT        "not"
+%token <ast> BAS_OFFSETOF   "offsetof"
+%token <ast> BAS_ON         "on"
+%token <ast> BAS_OPEN       "open"
+%token <ast> BAS_OPTION     "option"
+%token <ast> BAS_OR         "or"
+%token <ast> BAS_ORELSE     "orelse"
+%token <ast> BAS_OUTPUT     "output"
+%token <ast> BAS_POINTER    "pointer"
+%token <ast> BAS_PRESERVE   "preserve"
+%token <ast> BAS_PRINT      "print"
+%token <ast> BAS_PRIVATE    "private"
+%token <ast> BAS_PROGRAM    "program"
+%token <ast> BAS_PTR        "ptr"
+%token <ast> BAS_PUT        "put"
+%token <ast> BAS_READ       "read"
+%token <ast> BAS_REDIM      "redim"
+%token <ast> BAS_REGISTER   "register"
+%token <ast> BAS_RESTORE    "restore"
+%token <ast> BAS_RETURN     "return"
+%token <ast> BAS_SAMETYPES  "_sametypes"
+%token <ast> BAS_SELECT     "select"
+%token <ast> BAS_SELF       "self"
+%token <ast> BAS_SHARED     "shared"
+%token <ast> BAS_SHORT      "short"
+%token <ast> BAS_SINGLE     "single"
+%token <ast> BAS_SIZEOF     "sizeof"
+%token <ast> BAS_SQRT       "sqrt"
+%token <ast> BAS_STEP       "step"
+%token <ast> BAS_STRING_KW  "string"
+%token <ast> BAS_STRUCT     "struct"
+%token <ast> BAS_SUB        "sub"
+%token <ast> BAS_THEN       "then"
+%token <ast> BAS_THROW      "throw"
+%token <ast> BAS_THROWIFCAUGHT      "throwifcaught"
+%token <ast> BAS_TO         "to"
+%token <ast> BAS_TRY        "try"
+%token <ast> BAS_TYPE       "type"
+%token <ast> BAS_UBYTE      "ubyte"
+%token <ast> BAS_UINTEGER   "uinteger"
+%token <ast> BAS_ULONG      "ulong"
+%token <ast> BAS_ULONGINT   "ulongint"
+%token <ast> BAS_UNION      "union"
+%token <ast> BAS_UNTIL      "until"
+%token <ast> BAS_USHORT     "ushort"
+%token <ast> BAS_USING      "using"
+%token <ast> BAS_VAR        "var"
+%token <ast> BAS_WEND       "wend"
+%token <ast> BAS_WITH       "with"
+%token <ast> BAS_WHILE      "while"
+%token <ast> BAS_WORD       "word"
+%token <ast> BAS_XOR        "xor"
+%token <ast> BAS_LE         "<="
+%token <ast> BAS_GE         ">="
+%token <ast> BAS_NE         "<>"
+%token <ast> BAS_SHL        "shl"
+%token <ast> BAS_SHR        "shr"
+%token <ast> BAS_ABSADDR    "@@@"
+
+%token <ast> BAS_ADD_ASSIGN "+="
+%token <ast> BAS_SUB_ASSIGN "-="
+%token <ast> BAS_MUL_ASSIGN "*="
+%token <ast> BAS_DIV_ASSIGN "/="
+%token <ast> BAS_MOD_ASSIGN "MOD="
+%token <ast> BAS_AND_ASSIGN "AND="
+%token <ast> BAS_OR_ASSIGN "OR="
+%token <ast> BAS_XOR_ASSIGN "XOR="
 
 %left BAS_EOLN
 %left BAS_FUNCTION
@@ -563,6 +562,31 @@ AdjustParamForByVal(AST *param)
 %left '.'
 %left '('
 
+%type <ast> eolnseq toplabel topitem wrapped_stmt
+%type <ast> optstatementlist stmtlistitem statementlist realstatementlist optelselist ifline
+%type <ast> statement assignment_operator varassignlist simple_assign_statement assign_statement branchstmt
+%type <ast> file_handle iostmt chain_args inputitem printitem
+%type <ast> printlist putgetargs optzeroexpritem optvar ifstmt thenelseblock
+%type <ast> endif whilestmt endwhile doloopstmt doloopend selectstmt
+%type <ast> casematchitem casematch caseitem forstmt endfor optstep
+%type <ast> trycatchstmt endtry exitstmt topdecl defitem deflist
+%type <ast> varexpr varassigntarget pinrange register_expr np_primary_expr primary_expr
+%type <ast> unary_op pseudofunc_expr unary_expr np_unary_expr lambdaexpr opttype
+%type <ast> mult_op power_expr np_power_expr mult_expr np_mult_expr add_expr
+%type <ast> np_add_expr compare_expr bit_expr bool_expr expr np_expr
+%type <ast> optexprlist initexpritem expritem np_expritem np_exprlist subbody
+%type <ast> endsub funcbody endfunc attributes subdecl funcdecl
+%type <ast> functemplate templateheader assignitem assignlist optobjparams classdecl
+%type <ast> classheader classend constdecl constitem
+%type <ast> typedecl optarraylimit arraysizeitem typename ptrdef basetypename
+%type <ast> paramdecl paramitem paramvar dimension opt_type_as dimitem
+%type <ast> identdecl asmstmt asmline basedatline operand pasmexpr
+%type <ast> instruction instrmodifier
+%type <list> iflist multivars inputlist rawprintlist usingprintlist casematchlist
+%type <list> caselist initexprlist exprlist identlist constlist arraysizelist
+%type <list> typelist paramdecl1 dimlist asmlist operandlist modifierlist
+%type <ast> '='
+
 %%
 
 toplist:
@@ -668,21 +692,21 @@ realstatementlist:
 
 iflist:
   statement
-    { $$ = NewAST(AST_STMTLIST, $1, NULL); }
+    { $$ = ListBuilderStart(NewAST(AST_STMTLIST, $1, NULL)); }
   | iflist ':' statement
-    { $$ = AddToList($1, NewAST(AST_STMTLIST, $3, NULL)); }
+    { $$ = ListBuilderAdd($1, NewAST(AST_STMTLIST, $3, NULL)); }
 ;
 
 optelselist:
   BAS_ELSE iflist
-     { $$ = $2; }
+     { $$ = $2.head; }
   | /* nothing */
     { $$ = NULL; }
 ;
 
 ifline:
   iflist optelselist
-     { $$ = NewAST(AST_THENELSE, $1, $2); }
+     { $$ = NewAST(AST_THENELSE, $1.head, $2); }
 ;
 
 statement:
@@ -711,7 +735,7 @@ statement:
   | BAS_CALL BAS_IDENTIFIER '(' exprlist ')'
     {
         AST *params;
-        params = $4;
+        params = $4.head;
         $$ = NewAST(AST_FUNCCALL, $2, params);
     }
   | BAS_VAR BAS_IDENTIFIER '=' expr
@@ -778,14 +802,14 @@ assignment_operator
 
 varassignlist:
   varassigntarget ',' multivars
-      { $$ = NewAST(AST_EXPRLIST, $1, $3); }
+      { $$ = NewAST(AST_EXPRLIST, $1, $3.head); }
   ;
 
 multivars:
   varassigntarget
-      { $$ = NewAST(AST_EXPRLIST, $1, NULL); }
+      { $$ = ListBuilderStart(NewAST(AST_EXPRLIST, $1, NULL)); }
   | multivars ',' varassigntarget
-      { $$ = AddToList($1, NewAST(AST_EXPRLIST, $3, NULL)); }
+      { $$ = ListBuilderAdd($1, NewAST(AST_EXPRLIST, $3, NULL)); }
   ;
 
 
@@ -799,7 +823,7 @@ simple_assign_statement:
     }
   | varassignlist '=' exprlist
   {
-      $$ = AstAssignList($1, $3, $2);
+      $$ = AstAssignList($1, $3.head, $2);
   }
   | register_expr '=' expr
     {
@@ -845,7 +869,7 @@ branchstmt:
   | BAS_RETURN
     { $$ = AstReturn(NULL, $1); }
   | BAS_RETURN exprlist
-    { $$ = AstReturn($2, $1); }
+    { $$ = AstReturn($2.head, $1); }
   | BAS_LABEL_EXPLICIT
     { $$ = NewAST(AST_LABEL, $1, NULL); }
   | BAS_GOTO BAS_IDENTIFIER
@@ -897,7 +921,7 @@ iostmt:
         $$ = AstAssign(var, readit);
     }
   | BAS_INPUT file_handle inputlist
-    { $$ = NewCommentedAST(AST_READ, $3, InputHandle($2), $1); }
+    { $$ = NewCommentedAST(AST_READ, $3.head, InputHandle($2), $1); }
   | BAS_INPUT file_handle BAS_STRING ',' inputlist
     {
         AST *inhandle = InputHandle($2);
@@ -906,7 +930,7 @@ iostmt:
                              NewAST(AST_EXPRLIST, $3, NULL), NULL);
         AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
         AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, $1);
-        AST *inpstmt = NewAST(AST_READ, $5, inhandle);
+        AST *inpstmt = NewAST(AST_READ, $5.head, inhandle);
         AST *stmt;
         stmt = NewAST(AST_STMTLIST,
                       printstmt,
@@ -924,7 +948,7 @@ iostmt:
                              NewAST(AST_EXPRLIST, $3, question), NULL);
         AST *printlist = NewAST(AST_EXPRLIST, string, NULL);
         AST *printstmt = NewCommentedAST(AST_PRINT, printlist, outhandle, $1);
-        AST *inpstmt = NewAST(AST_READ, $5, inhandle);
+        AST *inpstmt = NewAST(AST_READ, $5.head, inhandle);
         AST *stmt;
         stmt = NewAST(AST_STMTLIST,
                       printstmt,
@@ -932,7 +956,7 @@ iostmt:
         $$ = stmt;
     }
   | BAS_READ inputlist
-    { $$ = NewCommentedAST(AST_READ, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_READ, $2.head, NULL, $1); }
   | BAS_RESTORE
     {
       AST *varname = AstIdentifier("__basic_data_ptr");
@@ -1067,10 +1091,10 @@ inputitem:
 
 inputlist:
   inputitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | inputlist ',' inputitem
     {
-        $$ = AddToList($1, $3);
+        $$ = ListBuilderAdd($1, $3);
     }
   ;
 
@@ -1083,35 +1107,35 @@ printitem:
 
 rawprintlist:
   printitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | rawprintlist ';' printitem
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   | rawprintlist ',' printitem
-    { $$ = AddToList(AddToList($1, AstCharItem('\t')), $3); }
+    { $$ = ListBuilderAdd(ListBuilderAdd($1, AstCharItem('\t')), $3); }
 ;
 
 usingprintlist:
   printitem
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | usingprintlist ';' printitem
-  { $$ = AddToList($1, $3); }
+  { $$ = ListBuilderAdd($1, $3); }
   | usingprintlist ',' printitem
-  { $$ = AddToList($1, $3); }
+  { $$ = ListBuilderAdd($1, $3); }
 ;
 
 printlist:
 /* empty */
     { $$ = AstCharItem('\n'); }
   | rawprintlist
-    { $$ = AddToList($1, AstCharItem('\n')); }
+    { $$ = ListBuilderAdd($1, AstCharItem('\n')).head; }
   | rawprintlist ','
-    { $$ = AddToList($1, AstCharItem('\t')); }
+    { $$ = ListBuilderAdd($1, AstCharItem('\t')).head; }
   | rawprintlist ';'
-    { $$ = $1; }
+    { $$ = $1.head; }
   | BAS_USING BAS_STRING ';' usingprintlist
-    { $$ = NewAST(AST_USING, $2, AddToList($4, AstCharItem('\n'))); }
+    { $$ = NewAST(AST_USING, $2, ListBuilderAdd($4, AstCharItem('\n')).head); }
   | BAS_USING BAS_STRING ';' usingprintlist ';'
-    { $$ = NewAST(AST_USING, $2, $4); }
+    { $$ = NewAST(AST_USING, $2, $4.head); }
 ;
 
 /* parse handle ',' position ',' data ',' size 
@@ -1267,16 +1291,16 @@ doloopend:
 
 selectstmt:
   BAS_SELECT BAS_CASE expr eoln casematchlist BAS_END BAS_SELECT
-    { $$ = NewCommentedAST(AST_CASE, $3, $5, $1); }
+    { $$ = NewCommentedAST(AST_CASE, $3, $5.head, $1); }
   | BAS_ON expr BAS_GOTO exprlist
-    { $$ = NewCommentedAST(AST_CASETABLE, $2, BuildOnGotoCases($4), $1); }
+    { $$ = NewCommentedAST(AST_CASETABLE, $2, BuildOnGotoCases($4.head), $1); }
 ;
 
 casematchlist:
   casematchitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | casematchlist casematchitem
-    { $$ = AddToList($1, $2); }
+    { $$ = ListBuilderAdd($1, $2); }
   ;
 
 casematchitem:
@@ -1299,7 +1323,7 @@ casematchitem:
 
 casematch:
   BAS_CASE caselist
-    {  $$ = $2; }
+    {  $$ = $2.head; }
 ;
 
 caseitem:
@@ -1313,9 +1337,9 @@ caseitem:
 
 caselist:
   caseitem
-    {  $$ = $1; }
+    {  $$ = ListBuilderStart($1); }
   | caselist ',' caseitem
-    {  $$ = AddToList($1, $3); }
+    {  $$ = ListBuilderAdd($1, $3); }
 ;
 
 //
@@ -1563,7 +1587,7 @@ varexpr:
   | varexpr '(' ')'
     { $$ = NewAST(AST_FUNCCALL, $1, NULL); }
   | varexpr '(' exprlist ')'
-    { $$ = NewAST(AST_FUNCCALL, $1, $3); }
+    { $$ = NewAST(AST_FUNCCALL, $1, $3.head); }
   | varexpr '.' BAS_IDENTIFIER
     { $$ = NewAST(AST_METHODREF, $1, $3); }
   | varexpr '.' BAS_PROGRAM
@@ -1679,7 +1703,7 @@ pseudofunc_expr:
         AST *elist;
         AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
         elist = NewAST(AST_EXPRLIST, immval, NULL);
-        elist = AddToList(elist, $3);
+        elist = AddToList(elist, $3.head);
         $$ = NewAST(AST_COGINIT, elist, NULL);
     }
   | BAS_HASMETHOD '(' typename ',' BAS_IDENTIFIER ')'
@@ -1910,14 +1934,14 @@ optexprlist:
     /* empty */
     { $$ = NULL; }
   | exprlist
-    { $$ = $1; }
+    { $$ = $1.head; }
 ;
 
 initexprlist:
   initexpritem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
  | initexprlist ',' initexpritem
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 initexpritem:
@@ -1929,9 +1953,9 @@ initexpritem:
 
 exprlist:
   expritem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
  | exprlist ',' expritem
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 expritem:
@@ -1947,7 +1971,7 @@ np_exprlist:
   np_expritem
     { $$ = $1; }
   | np_expritem ',' exprlist
-    { $$ = AddToList($1, $3); }
+    { $$ = AddToList($1, $3.head); }
 ;
 
 subbody:
@@ -2048,7 +2072,7 @@ funcdecl:
     AST *attrib = $2;
     AST *name = $3;
     AST *parms = $5;
-    AST *rettype = $8;
+    AST *rettype = $8.head;
     AST *body = $10;
     AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
     AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
@@ -2060,7 +2084,7 @@ funcdecl:
     AST *attrib = $3;
     AST *name = $4;
     AST *parms = $6;
-    AST *rettype = $9;
+    AST *rettype = $9.head;
     AST *body = NULL;
     AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
     AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
@@ -2072,7 +2096,7 @@ funcdecl:
          AST *attrib = NULL;
          AST *name = $3;
          AST *parms = $7;
-         AST *rettype = $10;
+         AST *rettype = $10.head;
          AST *body = $5;
          AST *funcdecl = NewAST(AST_FUNCDECL, name, NULL);
          AST *funcvars = NewAST(AST_FUNCVARS, parms, NULL);
@@ -2103,7 +2127,7 @@ functemplate:
         AST *name = $3;
 	AST *types = $1;
         AST *paramvars = $5;
-        AST *rettype = $8;
+        AST *rettype = $8.head;
 	AST *functype = NewAST(AST_FUNCTYPE, rettype, paramvars);
 	AST *body = $10;
 	AST *top_decl;
@@ -2136,19 +2160,19 @@ templateheader:
     BAS_ANY '(' identlist ')'
     {
       PushCurrentTypes();
-      $$ = AddTemplateTypes($3);
+      $$ = AddTemplateTypes($3.head);
     }
     ;
 
 identlist:
   BAS_IDENTIFIER
     {
-      $$ = NewAST(AST_LISTHOLDER, $1, NULL);
+      $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL));
     }
   | identlist ',' BAS_IDENTIFIER
     {
       AST *rhs = NewAST(AST_LISTHOLDER, $3, NULL);
-      $$ = AddToList($1, rhs);
+      $$ = ListBuilderAdd($1, rhs);
     }
 ;
 
@@ -2313,12 +2337,12 @@ classend:
 classdeclitem:
 | dimlist BAS_AS typename
     {
-        AST *ast = NewAST(AST_DECLARE_VAR, $3, $1);
+        AST *ast = NewAST(AST_DECLARE_VAR, $3, $1.head);
         DeclareBASICMemberVariables(ast);
     }
 | BAS_AS typename dimlist
     {
-        AST *ast = NewAST(AST_DECLARE_VAR, $2, $3);
+        AST *ast = NewAST(AST_DECLARE_VAR, $2, $3.head);
         DeclareBASICMemberVariables(ast);
     }
 | dimension
@@ -2338,7 +2362,7 @@ classdeclitem:
 constdecl:
   BAS_CONST constlist
   {
-      $$ = current->conblock = AddToList(current->conblock, $2);
+      $$ = current->conblock = AddToList(current->conblock, $2.head);
   }
 ;
 constitem:
@@ -2351,9 +2375,9 @@ constitem:
 ;
 constlist:
   constlist ',' constitem
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   | constitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
 ;
 
 typedecl:
@@ -2395,10 +2419,10 @@ arraysizeitem: expr optarraylimit
 
 arraysizelist:
   arraysizeitem
-    { $$ = NewAST(AST_EXPRLIST, $1, NULL); }
+    { $$ = ListBuilderStart(NewAST(AST_EXPRLIST, $1, NULL)); }
   | arraysizelist ',' arraysizeitem
     {
-        $$ = AddToList($1, $3);
+        $$ = ListBuilderAdd($1, $3);
     }
 ;
 
@@ -2414,22 +2438,22 @@ typename:
   | basetypename '(' arraysizelist ')'
     {
         AST *typ = $1;
-        AST *siz = $3;
+        AST *siz = $3.head;
         $$ = MakeArrayType(typ, siz);
     }
   ;
 
 typelist:
   typename
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | typelist ',' typename
     {
-        AST *list = $1;
+        ListBuilder list = $1;
         AST *added = $3;
-        if (list->kind != AST_TUPLE_TYPE) {
-            list = NewAST(AST_TUPLE_TYPE, list, NULL);
+        if (list.head->kind != AST_TUPLE_TYPE) {
+            list = ListBuilderStart(NewAST(AST_TUPLE_TYPE, list.head, NULL));
         }
-        $$ = AddToList(list, NewAST(AST_TUPLE_TYPE, added, NULL));
+        $$ = ListBuilderAdd(list, NewAST(AST_TUPLE_TYPE, added, NULL));
     }
 ;
 
@@ -2512,13 +2536,13 @@ paramdecl:
   /* empty */
     { $$ = NULL; }
   | paramdecl1
-    { $$ = $1; }
+    { $$ = $1.head; }
 ;
 paramdecl1:
   paramitem
-    { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+    { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
   | paramdecl1 ',' paramitem
-    { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+    { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
   ;
 
 paramitem:
@@ -2545,7 +2569,7 @@ paramvar:
     }
   | BAS_IDENTIFIER '(' arraysizelist ')' BAS_AS typename
     {
-        AST *siz = $3;
+        AST *siz = $3.head;
         AST *typ = $6;
         typ = MakeArrayType(typ, siz);
         $$ = NewAST(AST_DECLARE_VAR, typ, $1);
@@ -2556,23 +2580,23 @@ paramvar:
 
 dimension:
   BAS_DIM dimlist
-    { $$ = NewAST(AST_DECLARE_VAR, NULL, $2); }
+    { $$ = NewAST(AST_DECLARE_VAR, NULL, $2.head); }
   | BAS_DIM dimlist BAS_AS typename
-    { $$ = NewAST(AST_DECLARE_VAR, $4, $2); }
+    { $$ = NewAST(AST_DECLARE_VAR, $4, $2.head); }
   | BAS_DIM BAS_AS typename dimlist
-    { $$ = NewAST(AST_DECLARE_VAR, $3, $4); }
+    { $$ = NewAST(AST_DECLARE_VAR, $3, $4.head); }
   | BAS_DIM BAS_SHARED dimlist
-    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, NULL, $3), NULL); }
+    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, NULL, $3.head), NULL); }
   | BAS_DIM BAS_SHARED dimlist BAS_AS typename
-    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, $5, $3), NULL); }
+    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, $5, $3.head), NULL); }
   | BAS_DIM BAS_SHARED BAS_AS typename dimlist
-    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, $4, $5), NULL); }
+    { $$ = NewAST(AST_GLOBALVARS, NewAST(AST_DECLARE_VAR, $4, $5.head), NULL); }
   | BAS_DIM BAS_REGISTER dimlist
-    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, NULL, $3), NULL); }
+    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, NULL, $3.head), NULL); }
   | BAS_DIM BAS_REGISTER dimlist BAS_AS typename
-    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, $5, $3), NULL); }
+    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, $5, $3.head), NULL); }
   | BAS_DIM BAS_REGISTER BAS_AS typename dimlist
-    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, $4, $5), NULL); }
+    { $$ = NewAST(AST_REGISTERVARS, NewAST(AST_DECLARE_VAR, $4, $5.head), NULL); }
   | BAS_DECLARE BAS_IDENTIFIER BAS_ALIAS BAS_IDENTIFIER opt_type_as
     {
         AST *newname = $2;
@@ -2605,9 +2629,9 @@ opt_type_as :
 
 dimlist:
   dimitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | dimlist ',' dimitem
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
 ;
 dimitem:
   identdecl
@@ -2620,9 +2644,9 @@ dimitem:
   | identdecl '=' expr
     { $$ = NewAST(AST_LISTHOLDER, AstAssign($1, $3), NULL); }
   | identdecl '=' '{' initexprlist '}'
-    { $$ = NewAST(AST_LISTHOLDER, AstAssign($1, $4), NULL); }
+    { $$ = NewAST(AST_LISTHOLDER, AstAssign($1, $4.head), NULL); }
   | identdecl '=' '{' initexprlist BAS_EOLN '}'
-    { $$ = NewAST(AST_LISTHOLDER, AstAssign($1, $4), NULL); }
+    { $$ = NewAST(AST_LISTHOLDER, AstAssign($1, $4.head), NULL); }
 ;
 
 identdecl:
@@ -2756,29 +2780,29 @@ asmstmt:
   BAS_ASM eoln asmlist BAS_END BAS_ASM
       {
           // integer 0 means default asm
-          $$ = NewCommentedAST(AST_INLINEASM, $3, AstInteger(0), $1);
+          $$ = NewCommentedAST(AST_INLINEASM, $3.head, AstInteger(0), $1);
       }
   | BAS_CONST BAS_ASM eoln asmlist BAS_END BAS_ASM
       {
-          $$ = NewCommentedAST(AST_INLINEASM, $4, AstInteger(INLINE_ASM_FLAG_CONST), $1);
+          $$ = NewCommentedAST(AST_INLINEASM, $4.head, AstInteger(INLINE_ASM_FLAG_CONST), $1);
       }
   | BAS_CPU BAS_ASM eoln asmlist BAS_END BAS_ASM
       {
-          $$ = NewCommentedAST(AST_INLINEASM, $4, AstInteger(INLINE_ASM_FLAG_VOLATILE), $1);
+          $$ = NewCommentedAST(AST_INLINEASM, $4.head, AstInteger(INLINE_ASM_FLAG_VOLATILE), $1);
       }
   | BAS_SHARED BAS_ASM eoln asmlist BAS_END BAS_ASM
-      { current->datblock = AddToListEx(current->datblock, $4, &current->datblock_tail); $$ = 0;}
+      { current->datblock = AddToListEx(current->datblock, $4.head, &current->datblock_tail); $$ = 0;}
   ;
 
   | BAS_ASM BAS_SHARED eoln asmlist BAS_END BAS_ASM
-      { current->datblock = AddToListEx(current->datblock, $4, &current->datblock_tail); $$ = 0;}
+      { current->datblock = AddToListEx(current->datblock, $4.head, &current->datblock_tail); $$ = 0;}
   ;
 
 asmlist:
   asmline
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | asmlist asmline
-  { $$ = AddToList($1, $2); }
+  { $$ = ListBuilderAdd($1, $2); }
   ;
 
 asmline:
@@ -2814,23 +2838,23 @@ basedatline:
   | BAS_BYTE BAS_EOLN
     { $$ = NewCommentedAST(AST_BYTELIST, NULL, NULL, $1); }
   | BAS_BYTE operandlist BAS_EOLN
-    { $$ = NewCommentedAST(AST_BYTELIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_BYTELIST, $2.head, NULL, $1); }
   | BAS_WORD BAS_EOLN
     { $$ = NewCommentedAST(AST_WORDLIST, NULL, NULL, $1); }
   | BAS_WORD operandlist BAS_EOLN
-    { $$ = NewCommentedAST(AST_WORDLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_WORDLIST, $2.head, NULL, $1); }
   | BAS_LONG BAS_EOLN
     { $$ = NewCommentedAST(AST_LONGLIST, NULL, NULL, $1); }
   | BAS_LONG operandlist BAS_EOLN
-    { $$ = NewCommentedAST(AST_LONGLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_LONGLIST, $2.head, NULL, $1); }
   | instruction BAS_EOLN
     { $$ = NewCommentedInstr($1); }
   | instruction operandlist BAS_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction modifierlist BAS_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction operandlist modifierlist BAS_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, AddToList($2, $3))); }
+    { $$ = NewCommentedInstr(AddToList($1, ListBuilderAdd($2, $3.head).head)); }
   | BAS_ALIGNL BAS_EOLN
     { $$ = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, $1); }
   | BAS_ALIGNW BAS_EOLN
@@ -2885,9 +2909,9 @@ pasmexpr:
 
 operandlist:
    operand
-   { $$ = $1; }
+   { $$ = ListBuilderStart($1); }
  | operandlist ',' operand
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 instruction:
@@ -2904,11 +2928,11 @@ instrmodifier:
 
 modifierlist:
   instrmodifier
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | modifierlist instrmodifier
-    { $$ = AddToList($1, $2); }
+    { $$ = ListBuilderAdd($1, $2); }
   | modifierlist ',' instrmodifier
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   ;
 
 %%
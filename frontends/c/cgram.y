@@ -16,7 +16,6 @@
 
     extern AST *BuildDebugList(AST *, AST *); /* in frontends/printdebug.c */
     
-#define CGRAMYYSTYPE AST*
 #undef  YYSTYPE
 #define YYSTYPE CGRAMYYSTYPE
 #define IN_DAT 1
@@ -436,7 +435,7 @@ static AST *
 MultipleDeclareVar(AST *first, AST *second)
 {
     AST *ident, *type;
-    AST *stmtlist = NULL;
+    ListBuilder stmtlist = { NULL, NULL };
     AST *item;
     Module *module = NULL;
     AST *regtype = NULL;
@@ -444,7 +443,7 @@ MultipleDeclareVar(AST *first, AST *second)
     while (second) {
         if (second->kind != AST_LISTHOLDER) {
             ERROR(second, "internal error in createVarDeclarations: expected listholder");
-            return stmtlist;
+            return stmtlist.head;
         }
         item = second->left;
         second = second->right;
@@ -453,7 +452,7 @@ MultipleDeclareVar(AST *first, AST *second)
             ERROR(first, ":: not supported yet");
         }
         if (IsStaticType(type)) {
-            stmtlist = AddToList(stmtlist, DeclareStatics(current, ExtractStaticType(type), ident));
+            stmtlist = ListBuilderAdd(stmtlist, DeclareStatics(current, ExtractStaticType(type), ident));
         } else if ( NULL != (regtype = IsGlobalRegisterDecl(type)) ) {
             /* declare a register global variable */
             ident = NewAST(AST_DECLARE_VAR, regtype, ident);
@@ -468,10 +467,10 @@ MultipleDeclareVar(AST *first, AST *second)
                 type = type->left;
             }
             ident = NewAST(AST_DECLARE_VAR, type, ident);
-            stmtlist = AddToList(stmtlist, NewAST(AST_STMTLIST, ident, NULL));
+            stmtlist = ListBuilderAdd(stmtlist, NewAST(AST_STMTLIST, ident, NULL));
         }
     }
-    return stmtlist;
+    return stmtlist.head;
 }
 
 AST *
@@ -957,149 +956,172 @@ ConstructDefaultValue(AST *decl, AST *val)
 
 %}
 
-%token C_IDENTIFIER "identifier"
-%token C_CONSTANT   "constant"
-%token C_STRING_LITERAL "string literal"
-%token C_SIZEOF     "sizeof"
-%token C_TYPEOF     "typeof"
-
-%token C_PTR_OP "->"
-%token C_INC_OP "++"
-%token C_DEC_OP "--"
-%token C_LEFT_OP "<<"
-%token C_RIGHT_OP ">>"
-%token C_LE_OP "<="
-%token C_GE_OP ">="
-%token C_EQ_OP "=="
-%token C_NE_OP "!="
-%token C_AND_OP "&&"
-%token C_OR_OP "||"
-%token C_MUL_ASSIGN "*="
-%token C_DIV_ASSIGN "/="
-%token C_MOD_ASSIGN "%="
-%token C_ADD_ASSIGN "+="
-%token C_SUB_ASSIGN "-="
-%token C_LEFT_ASSIGN "<<="
-%token C_RIGHT_ASSIGN ">>="
-%token C_AND_ASSIGN "&="
-%token C_XOR_ASSIGN "^="
-%token C_OR_ASSIGN "|="
-%token C_TYPE_NAME "type name"
-
-%token C_LIMITMIN_OP "#<"
-%token C_LIMITMAX_OP "#>"
-%token C_ABSADDR_OP  "@@@"
-
-%token C_TYPEDEF "typedef"
-%token C_EXTERN "extern"
-%token C_STATIC "static"
-%token C_AUTO "auto"
-%token C_REGISTER "register"
-%token C_RESTRICT "__restrict"
-%token C_BOOL "_Bool"
-%token C_CHAR  "char"
-%token C_SHORT "short"
-%token C_IMAGINARY "_Imaginary"
-%token C_INLINE "inline"
-%token C_INT   "int"
-%token C_LONG  "long"
-%token C_SIGNED "signed"
-%token C_UNSIGNED "unsigned"
-%token C_FLOAT  "float"
-%token C_DOUBLE "double"
-%token C_CONST "const"
-%token C_VOLATILE "volatile"
-%token C_VOID "void"
-%token C_STRUCT "struct"
-%token C_UNION "union"
-%token C_ENUM "enum"
-%token C_ELLIPSIS "..."
-%token C_DOUBLECOLON "::"
-
-%token C_CASE "case"
-%token C_DEFAULT "default"
-%token C_IF "if"
-%token C_ELSE "else"
-%token C_SWITCH "switch"
-%token C_WHILE "while"
-%token C_DO    "do"
-%token C_FOR   "for"
-%token C_GOTO  "goto"
-%token C_CONTINUE "continue"
-%token C_BREAK "break"
-%token C_RETURN "return"
-
-%token C_FROMFILE "__fromfile"
-%token C_USING "__using"
-%token C_ATTRIBUTE "__attribute__"
-
-%token C_ASM "__asm"
-%token C_PASM "__pasm"
-%token C_DEBUG "__debug"
-%token C_INSTR "asm instruction"
-%token C_INSTRMODIFIER "instruction modifier"
-%token C_HWREG "hardware register"
+%token <ast> C_IDENTIFIER "identifier"
+%token <ast> C_CONSTANT   "constant"
+%token <ast> C_STRING_LITERAL "string literal"
+%token <ast> C_SIZEOF     "sizeof"
+%token <ast> C_TYPEOF     "typeof"
+
+%token <ast> C_PTR_OP "->"
+%token <ast> C_INC_OP "++"
+%token <ast> C_DEC_OP "--"
+%token <ast> C_LEFT_OP "<<"
+%token <ast> C_RIGHT_OP ">>"
+%token <ast> C_LE_OP "<="
+%token <ast> C_GE_OP ">="
+%token <ast> C_EQ_OP "=="
+%token <ast> C_NE_OP "!="
+%token <ast> C_AND_OP "&&"
+%token <ast> C_OR_OP "||"
+%token <ast> C_MUL_ASSIGN "*="
+%token <ast> C_DIV_ASSIGN "/="
+%token <ast> C_MOD_ASSIGN "%="
+%token <ast> C_ADD_ASSIGN "+="
+%token <ast> C_SUB_ASSIGN "-="
+%token <ast> C_LEFT_ASSIGN "<<="
+%token <ast> C_RIGHT_ASSIGN ">>="
+%token <ast> C_AND_ASSIGN "&="
+%token <ast> C_XOR_ASSIGN "^="
+%token <ast> C_OR_ASSIGN "|="
+%token <ast> C_TYPE_NAME "type name"
+
+%token <ast> C_LIMITMIN_OP "#<"
+%token <ast> C_LIMITMAX_OP "#>"
+%token <ast> C_ABSADDR_OP  "@@@"
+
+%token <ast> C_TYPEDEF "typedef"
+%token <ast> C_EXTERN "extern"
+%token <ast> C_STATIC "static"
+%token <ast> C_AUTO "auto"
+%token <ast> C_REGISTER "register"
+%token <ast> C_RESTRICT "__restrict"
+%token <ast> C_BOOL "_Bool"
+%token <ast> C_CHAR  "char"
+%token <ast> C_SHORT "short"
+%token <ast> C_IMAGINARY "_Imaginary"
+%token <ast> C_INLINE "inline"
+%token <ast> C_INT   "int"
+%token <ast> C_LONG  "long"
+%token <ast> C_SIGNED "signed"
+%token <ast> C_UNSIGNED "unsigned"
+%token <ast> C_FLOAT  "float"
+%token <ast> C_DOUBLE "double"
+%token <ast> C_CONST "const"
+%token <ast> C_VOLATILE "volatile"
+%token <ast> C_VOID "void"
+%token <ast> C_STRUCT "struct"
+%token <ast> C_UNION "union"
+%token <ast> C_ENUM "enum"
+%token <ast> C_ELLIPSIS "..."
+%token <ast> C_DOUBLECOLON "::"
+
+%token <ast> C_CASE "case"
+%token <ast> C_DEFAULT "default"
+%token <ast> C_IF "if"
+%token <ast> C_ELSE "else"
+%token <ast> C_SWITCH "switch"
+%token <ast> C_WHILE "while"
+%token <ast> C_DO    "do"
+%token <ast> C_FOR   "for"
+%token <ast> C_GOTO  "goto"
+%token <ast> C_CONTINUE "continue"
+%token <ast> C_BREAK "break"
+%token <ast> C_RETURN "return"
+
+%token <ast> C_FROMFILE "__fromfile"
+%token <ast> C_USING "__using"
+%token <ast> C_ATTRIBUTE "__attribute__"
+
+%token <ast> C_ASM "__asm"
+%token <ast> C_PASM "__pasm"
+%token <ast> C_DEBUG "__debug"
+%token <ast> C_INSTR "asm instruction"
+%token <ast> C_INSTRMODIFIER "instruction modifier"
+%token <ast> C_HWREG "hardware register"
 
 // C++ tokens
-%token C_CATCH "catch"
-%token C_CLASS "class"
-%token C_DELETE "delete"
-%token C_FALSE "false"
-%token C_NEW "new"
-%token C_NULLPTR "nullptr"
-%token C_TRUE "true"
-%token C_PRIVATE "private"
-%token C_PUBLIC "public"
-%token C_TEMPLATE "template"
-%token C_THIS "this"
-%token C_THROW "throw"
-%token C_THROWIF "__throwifcaught"
-%token C_TRY "try"
-%token C_VIRTUAL "virtual"
+%token <ast> C_CATCH "catch"
+%token <ast> C_CLASS "class"
+%token <ast> C_DELETE "delete"
+%token <ast> C_FALSE "false"
+%token <ast> C_NEW "new"
+%token <ast> C_NULLPTR "nullptr"
+%token <ast> C_TRUE "true"
+%token <ast> C_PRIVATE "private"
+%token <ast> C_PUBLIC "public"
+%token <ast> C_TEMPLATE "template"
+%token <ast> C_THIS "this"
+%token <ast> C_THROW "throw"
+%token <ast> C_THROWIF "__throwifcaught"
+%token <ast> C_TRY "try"
+%token <ast> C_VIRTUAL "virtual"
 
 // asm only tokens
-%token C_ALIGNL "alignl"
-%token C_ALIGNW "alignw"
-%token C_BYTE "byte"
-%token C_ELSEIF "elseif"
-%token C_END  "end"
-%token C_FILE "file"
-%token C_FIT "fit"
-%token C_ORG  "org"
-%token C_ORGH "orgh"
-%token C_ORGF "orgf"
-%token C_RES "res"
-%token C_WORD "word"
-%token C_EOLN "end of line"
-
-%token C_FUNC "__func__ or __FUNCTION__"
+%token <ast> C_ALIGNL "alignl"
+%token <ast> C_ALIGNW "alignw"
+%token <ast> C_BYTE "byte"
+%token <ast> C_ELSEIF "elseif"
+%token <ast> C_END  "end"
+%token <ast> C_FILE "file"
+%token <ast> C_FIT "fit"
+%token <ast> C_ORG  "org"
+%token <ast> C_ORGH "orgh"
+%token <ast> C_ORGF "orgf"
+%token <ast> C_RES "res"
+%token <ast> C_WORD "word"
+%token <ast> C_EOLN "end of line"
+
+%token <ast> C_FUNC "__func__ or __FUNCTION__"
 
 // builtin functions
-%token C_BUILTIN_ABS    "__builtin_abs"
-%token C_BUILTIN_CLZ    "__builtin_clz"
-%token C_BUILTIN_SQRT   "__builtin_sqrt"
-%token C_BUILTIN_FRAC   "__builtin_frac"
-%token C_BUILTIN_MULH   "__builtin_mulh"
-%token C_BUILTIN_MULUH  "__builtin_muluh"
-
-%token C_BUILTIN_ALLOCA "__builtin_alloca"
-%token C_BUILTIN_COGSTART "__builtin_cogstart"
-%token C_BUILTIN_COGSTART_COG "__builtin_cogstart_cog"
-%token C_BUILTIN_EXPECT "__builtin_expect"
-%token C_BUILTIN_OFFSETOF "__builtin_offsetof"
-%token C_BUILTIN_PRINTF "__builtin_printf"
-%token C_BUILTIN_REV    "__builtin_rev"
-%token C_BUILTIN_VA_START "__builtin_va_start"
-%token C_BUILTIN_VA_ARG   "__builtin_va_arg"
-%token C_BUILTIN_SETJMP   "__builtin_setjmp"
-%token C_BUILTIN_LONGJMP  "__builtin_longjmp"
-
-%token C_BUILTIN_STRLEN   "__builtin_strlen"
-
-%token C_EOF "end of file"
+%token <ast> C_BUILTIN_ABS    "__builtin_abs"
+%token <ast> C_BUILTIN_CLZ    "__builtin_clz"
+%token <ast> C_BUILTIN_SQRT   "__builtin_sqrt"
+%token <ast> C_BUILTIN_FRAC   "__builtin_frac"
+%token <ast> C_BUILTIN_MULH   "__builtin_mulh"
+%token <ast> C_BUILTIN_MULUH  "__builtin_muluh"
+
+%token <ast> C_BUILTIN_ALLOCA "__builtin_alloca"
+%token <ast> C_BUILTIN_COGSTART "__builtin_cogstart"
+%token <ast> C_BUILTIN_COGSTART_COG "__builtin_cogstart_cog"
+%token <ast> C_BUILTIN_EXPECT "__builtin_expect"
+%token <ast> C_BUILTIN_OFFSETOF "__builtin_offsetof"
+%token <ast> C_BUILTIN_PRINTF "__builtin_printf"
+%token <ast> C_BUILTIN_REV    "__builtin_rev"
+%token <ast> C_BUILTIN_VA_START "__builtin_va_start"
+%token <ast> C_BUILTIN_VA_ARG   "__builtin_va_arg"
+%token <ast> C_BUILTIN_SETJMP   "__builtin_setjmp"
+%token <ast> C_BUILTIN_LONGJMP  "__builtin_longjmp"
+
+%token <ast> C_BUILTIN_STRLEN   "__builtin_strlen"
+
+%token <ast> C_EOF "end of file"
 
 %start translation_unit
 
+%type <ast> primary_expression postfix_expression unary_expression unary_operator cast_expression multiplicative_expression
+%type <ast> additive_expression shift_expression relational_expression equality_expression and_expression exclusive_or_expression
+%type <ast> inclusive_or_expression logical_and_expression logical_or_expression conditional_expression assignment_expression assignment_operator
+%type <ast> expression constant_expression declaration declaration_specifiers reset_identifier_expectation init_declarator
+%type <ast> storage_class_specifier type_specifier struct_or_union_specifier any_identifier struct_or_union using_clause
+%type <ast> optobjarguments one_objarg struct_open struct_close struct_declaration struct_specifier_qualifier_list
+%type <ast> specifier_qualifier_list struct_declarator enum_specifier enumerator type_qualifier declarator
+%type <ast> direct_declarator pointer type_qualifier_list parameter_type_list raw_parameter_declaration parameter_declaration
+%type <ast> opt_param_default type_name abstract_declarator direct_abstract_declarator initializer initializer_list
+%type <ast> designation designator_list designator statement labeled_statement compound_statement
+%type <ast> compound_statement_open compound_statement_close for_statement_start block_item asm_statement opt_asm_volatile
+%type <ast> top_asm asmline asm_baseline asm_debug_exprlist asm_debug_expritem_first
+%type <ast> asm_debug_expritem asm_operand asmexpr instruction instrmodifier func_declaration_list
+%type <ast> expression_statement selection_statement iteration_statement for_declaration jump_statement try_statement
+%type <ast> handler_item push_current_types pop_current_types handler_declarator translation_unit external_declaration
+%type <ast> function_definition attribute_decl fromfile_decl compound_statement_or_fromfile top_pasm pasmline
+%type <ast> pasm_baseline pasm_debug_exprlist pasm_debug_expritem_first pasm_debug_expritem pasm_operand optpasmrange
+%type <ast> pasmatom pasmunary pasm_e1 pasm_e2 pasm_e3 pasm_e4
+%type <ast> pasm_e5 pasm_e6 pasm_e7 pasmexpr
+%type <list> argument_expression_list init_declarator_list objargs struct_declaration_list struct_declarator_list enumerator_list
+%type <list> parameter_list identifier_list block_item_list asmlist asm_debug_exprlist_continue asm_operandlist
+%type <list> modifierlist declaration_list handler_sequence pasmlist pasm_debug_exprlist_continue pasm_operandlist
+
 %%
 
 primary_expression
@@ -1141,7 +1163,7 @@ primary_expression
 	| '(' expression ')'
             { $$ = $2; }
 	| '(' compound_statement_open block_item_list compound_statement_close ')'
-            { $$ = $3; }
+            { $$ = $3.head; }
 	;
 
 postfix_expression
@@ -1162,7 +1184,7 @@ postfix_expression
                 AST *list;
                 AST *arg1, *arg2;
                 
-                list = $3;
+                list = $3.head;
                 if (!list || !list->left)
                 {
                     SYNTAX_ERROR("Missing argument to __builtin_rev");
@@ -1188,7 +1210,7 @@ postfix_expression
                 AST *list;
                 AST *arg1, *arg2;
                 
-                list = $3;
+                list = $3.head;
                 if (!list || !list->left)
                 {
                     SYNTAX_ERROR("Missing argument to __builtin_frac");
@@ -1211,7 +1233,7 @@ postfix_expression
                 AST *list;
                 AST *arg1, *arg2;
                 
-                list = $3;
+                list = $3.head;
                 if (!list || !list->left)
                 {
                     SYNTAX_ERROR("Missing argument to __builtin_muluh");
@@ -1234,7 +1256,7 @@ postfix_expression
                 AST *list;
                 AST *arg1, *arg2;
                 
-                list = $3;
+                list = $3.head;
                 if (!list || !list->left)
                 {
                     SYNTAX_ERROR("Missing argument to __builtin_mulh");
@@ -1272,12 +1294,12 @@ postfix_expression
                 AST *elist;
                 AST *immval = AstInteger(0x1e);
                 elist = NewAST(AST_EXPRLIST, immval, NULL);
-                elist = AddToList(elist, $3);
+                elist = AddToList(elist, $3.head);
                 $$ = NewAST(AST_COGINIT, elist, NULL);
             }
         | C_BUILTIN_COGSTART_COG '(' argument_expression_list ')'
             {
-                AST *elist = $3;
+                AST *elist = $3.head;
                 $$ = NewAST(AST_COGINIT, elist, NULL);
             }
         | C_BUILTIN_EXPECT '(' assignment_expression ',' assignment_expression ')'
@@ -1297,7 +1319,7 @@ postfix_expression
 	| postfix_expression '(' ')'
             { $$ = NewAST(AST_FUNCCALL, $1, NULL); }
 	| postfix_expression '(' argument_expression_list ')'
-            { $$ = NewAST(AST_FUNCCALL, $1, $3); }
+            { $$ = NewAST(AST_FUNCCALL, $1, $3.head); }
 	| postfix_expression '.' any_identifier
             { $$ = NewAST(AST_METHODREF, $1, $3); }
 	| postfix_expression C_PTR_OP any_identifier
@@ -1342,9 +1364,9 @@ postfix_expression
 
 argument_expression_list
 	: assignment_expression
-            { $$ = NewAST(AST_EXPRLIST, $1, NULL); }
+            { $$ = ListBuilderStart(NewAST(AST_EXPRLIST, $1, NULL)); }
 	| argument_expression_list ',' assignment_expression
-            { $$ = AddToList($1, NewAST(AST_EXPRLIST, $3, NULL)); }
+            { $$ = ListBuilderAdd($1, NewAST(AST_EXPRLIST, $3, NULL)); }
 	;
 
 unary_expression
@@ -1551,7 +1573,7 @@ declaration
             { $$ = SingleDeclareVar(NULL, $1); }
 	| declaration_specifiers init_declarator_list ';'
             {
-                $$ = MultipleDeclareVar($1, $2);
+                $$ = MultipleDeclareVar($1, $2.head);
             }
 	;
 
@@ -1581,9 +1603,9 @@ reset_identifier_expectation
 
 init_declarator_list
 	: init_declarator
-            { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+            { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
 	| init_declarator_list ',' init_declarator
-            { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+            { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
 	;
 
 init_declarator
@@ -1677,7 +1699,7 @@ struct_or_union_specifier
 	: struct_open struct_declaration_list '}' struct_close
             {
                 AST *d = $1;
-                AddStructBody(current, $2);
+                AddStructBody(current, $2.head);
                 PopCurrentModule();
                 $$ = d;
             }
@@ -1735,17 +1757,17 @@ using_clause
 
 optobjarguments
         : ',' objargs
-          { $$ = $2; }
+          { $$ = $2.head; }
         | /* empty */
           { $$ = NULL; }
         ;
 
 objargs
        : one_objarg
-         { $$ = CommentedListHolder($1); }
+         { $$ = ListBuilderStart(CommentedListHolder($1)); }
        | objargs ',' one_objarg
          {
-             $$ = AddToList($1, CommentedListHolder($3));
+             $$ = ListBuilderAdd($1, CommentedListHolder($3));
          }
        ;
 
@@ -1796,9 +1818,9 @@ struct_close:
 
 struct_declaration_list
 	: struct_declaration
-           { $$ = $1; }
+           { $$ = ListBuilderStart($1); }
 	| struct_declaration_list struct_declaration
-           { $$ = AddToList($1, $2); }
+           { $$ = ListBuilderAdd($1, $2); }
 	;
 
 struct_declaration
@@ -1823,7 +1845,7 @@ struct_declaration
             }
 	| struct_specifier_qualifier_list struct_declarator_list ';'
             {
-                $$ = MultipleDeclareVar($1, $2);
+                $$ = MultipleDeclareVar($1, $2.head);
             }
         | C_PUBLIC ':'
             {
@@ -1840,7 +1862,7 @@ struct_declaration
                 AST *type;
                 AST *ident = NULL;
                 AST *body = $3;
-                AST *decl = $2;
+                AST *decl = $2.head;
                 AST *spqual = $1;
                 AST *top_decl;
                 Module *module = NULL;
@@ -1891,9 +1913,9 @@ specifier_qualifier_list
 
 struct_declarator_list
 	: struct_declarator
-            { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+            { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
 	| struct_declarator_list ',' struct_declarator
-            { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+            { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
 	;
 
 struct_declarator
@@ -1909,22 +1931,22 @@ struct_declarator
 
 enum_specifier
 	: C_ENUM '{' enumerator_list '}'
-            { $$ = AddEnumerators(NULL, $3); }
+            { $$ = AddEnumerators(NULL, $3.head); }
 	| C_ENUM any_identifier '{' enumerator_list '}'
-            { $$ = AddEnumerators($2, $4); }
+            { $$ = AddEnumerators($2, $4.head); }
 	| C_ENUM '{' enumerator_list ',' '}'
-            { $$ = AddEnumerators(NULL, $3); }
+            { $$ = AddEnumerators(NULL, $3.head); }
 	| C_ENUM any_identifier '{' enumerator_list ',' '}'
-            { $$ = AddEnumerators($2, $4); }
+            { $$ = AddEnumerators($2, $4.head); }
 	| C_ENUM any_identifier
             { $$ = ast_type_long; }
 	;
 
 enumerator_list
 	: enumerator
-            { $$ = $1; }
+            { $$ = ListBuilderStart($1); }
 	| enumerator_list ',' enumerator
-            { $$ = AddToList($1, $3); }
+            { $$ = ListBuilderAdd($1, $3); }
 	;
 
 enumerator
@@ -1973,7 +1995,7 @@ direct_declarator
 	| direct_declarator '(' parameter_type_list ')'
             { $$ = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList($3)), $1); }
 	| direct_declarator '(' identifier_list ')'
-            { $$ = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList($3)), $1); }
+            { $$ = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, ProcessParamList($3.head)), $1); }
 	| direct_declarator '(' ')'
             { $$ = NewAST(AST_DECLARE_VAR, NewAST(AST_FUNCTYPE, NULL, NULL), $1); }
 	;
@@ -2023,20 +2045,20 @@ type_qualifier_list
 
 parameter_type_list
 	: parameter_list
-           { $$ = $1; }
+           { $$ = $1.head; }
 	| parameter_list ',' C_ELLIPSIS
-            { $$ = AddToList($1,
+            { $$ = ListBuilderAdd($1,
                              NewAST(AST_LISTHOLDER,
                                     NewAST(AST_VARARGS, NULL, NULL),
-                                    NULL));
+                                    NULL)).head;
             }
 	;
 
 parameter_list
 	: parameter_declaration
-            { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+            { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
 	| parameter_list ',' parameter_declaration
-            { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+            { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
 	;
 
 raw_parameter_declaration
@@ -2064,9 +2086,9 @@ opt_param_default
 
 identifier_list
 	: C_IDENTIFIER
-            { $$ = NewAST(AST_EXPRLIST, $1, NULL); }
+            { $$ = ListBuilderStart(NewAST(AST_EXPRLIST, $1, NULL)); }
 	| identifier_list ',' C_IDENTIFIER
-            { $$ = AddToList($1, NewAST(AST_EXPRLIST, $3, NULL)); }
+            { $$ = ListBuilderAdd($1, NewAST(AST_EXPRLIST, $3, NULL)); }
 	;
 
 type_name
@@ -2263,7 +2285,7 @@ compound_statement
 	: compound_statement_open compound_statement_close
             { $$ = NULL; }
 	| compound_statement_open block_item_list compound_statement_close
-            { $$ = $2; }
+            { $$ = $2.head; }
 	;
 
 compound_statement_open:
@@ -2283,9 +2305,9 @@ for_statement_start:
 
 block_item_list
    : block_item
-       { $$ = $1; }
+       { $$ = ListBuilderStart($1); }
    | block_item_list block_item
-       { $$ = AddToList($1, $2); }
+       { $$ = ListBuilderAdd($1, $2); }
    ;
 
 block_item
@@ -2303,14 +2325,14 @@ asm_statement:
     {
         AST *asmcode;
         AST *vol = $2;
-        asmcode = NewAST(AST_INLINEASM, $4, vol);
+        asmcode = NewAST(AST_INLINEASM, $4.head, vol);
         $$ = asmcode;
     }
   | C_ASM opt_asm_volatile C_EOLN '{' asmlist '}'
     {
         AST *asmcode;
         AST *vol = $2;
-        asmcode = NewAST(AST_INLINEASM, $5, vol);
+        asmcode = NewAST(AST_INLINEASM, $5.head, vol);
         $$ = asmcode;
     }
   ;
@@ -2326,16 +2348,16 @@ opt_asm_volatile:
 
 top_asm:
   C_ASM '{' asmlist '}'
-      { $$ = current->datblock = AddToListEx(current->datblock, $3, &current->datblock_tail); }
+      { $$ = current->datblock = AddToListEx(current->datblock, $3.head, &current->datblock_tail); }
   | C_ASM C_EOLN '{' asmlist '}'
-      { $$ = current->datblock = AddToListEx(current->datblock, $4, &current->datblock_tail); }
+      { $$ = current->datblock = AddToListEx(current->datblock, $4.head, &current->datblock_tail); }
 ;
 
 asmlist:
   asmline
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | asmlist asmline
-  { $$ = AddToList($1, $2); }
+  { $$ = ListBuilderAdd($1, $2); }
   ;
 
 asmline:
@@ -2376,23 +2398,23 @@ asm_baseline:
   | C_BYTE asm_eoln
     { $$ = NewCommentedAST(AST_BYTELIST, NULL, NULL, $1); }
   | C_BYTE asm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_BYTELIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_BYTELIST, $2.head, NULL, $1); }
   | C_WORD asm_eoln
     { $$ = NewCommentedAST(AST_WORDLIST, NULL, NULL, $1); }
   | C_WORD asm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_WORDLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_WORDLIST, $2.head, NULL, $1); }
   | C_LONG asm_eoln
     { $$ = NewCommentedAST(AST_LONGLIST, NULL, NULL, $1); }
   | C_LONG asm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_LONGLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_LONGLIST, $2.head, NULL, $1); }
   | instruction asm_eoln
     { $$ = NewCommentedInstr($1); }
   | instruction asm_operandlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction modifierlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction asm_operandlist modifierlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, AddToList($2, $3))); }
+    { $$ = NewCommentedInstr(AddToList($1, ListBuilderAdd($2, $3.head).head)); }
   | C_ALIGNL asm_eoln
     { $$ = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, $1); }
   | C_ALIGNW asm_eoln
@@ -2447,7 +2469,7 @@ asm_debug_exprlist:
    asm_debug_expritem_first
      { $$ = $1; }
    | asm_debug_expritem_first ',' asm_debug_exprlist_continue
-     { $$ = AddToList($1, $3); }
+     { $$ = AddToList($1, $3.head); }
 ;
 
 asm_debug_expritem_first:
@@ -2462,9 +2484,9 @@ asm_debug_expritem_first:
    
 asm_debug_exprlist_continue:
    asm_debug_expritem
-     { $$ = $1; }
+     { $$ = ListBuilderStart($1); }
    | asm_debug_exprlist_continue ',' asm_debug_expritem
-     { $$ = AddToList($1, $3); }
+     { $$ = ListBuilderAdd($1, $3); }
 ;
 
 asm_debug_expritem: asm_operand
@@ -2487,9 +2509,9 @@ asm_operand:
 
 asm_operandlist:
    asm_operand
-   { $$ = $1; }
+   { $$ = ListBuilderStart($1); }
  | asm_operandlist ',' asm_operand
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 asmexpr:
@@ -2513,25 +2535,25 @@ instrmodifier:
 
 modifierlist:
   instrmodifier
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | modifierlist instrmodifier
-    { $$ = AddToList($1, $2); }
+    { $$ = ListBuilderAdd($1, $2); }
   | modifierlist ',' instrmodifier
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   ;
   
 func_declaration_list
 	: declaration
             { $$ = $1; }
 	| declaration_list declaration
-            { $$ = AddToList($1, $2); }
+            { $$ = ListBuilderAdd($1, $2).head; }
 	;
 
 declaration_list
 	: declaration
-            { $$ = MakeDeclarations($1, currentTypes); }
+            { $$ = ListBuilderStart(MakeDeclarations($1, currentTypes)); }
 	| declaration_list declaration
-            { $$ = AddToList($1, MakeDeclarations($2, currentTypes)); }
+            { $$ = ListBuilderAdd($1, MakeDeclarations($2, currentTypes)); }
 	;
 
 expression_statement
@@ -2675,7 +2697,7 @@ try_statement
 	: C_TRY compound_statement handler_sequence
           {
               AST *tryblock = $2;
-              AST *catchlist = $3;
+              AST *catchlist = $3.head;
               AST *catchseq;
               AST *catchvar, *catchblock, *catchdecl;
               AST *try_if = NULL;
@@ -2704,11 +2726,11 @@ try_statement
 
 handler_sequence
 	: handler_item
-          { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+          { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
 	| handler_sequence handler_item
           {
               AST *last = NewAST(AST_LISTHOLDER, $2, NULL);
-              $$ = AddToList($1, last);
+              $$ = ListBuilderAdd($1, last);
           }
         ;
 
@@ -2851,16 +2873,16 @@ compound_statement_or_fromfile
 /* PASM syntax: this is awkward, so not fully supported yet */
 top_pasm:
   C_PASM '{' pasmlist '}'
-      { $$ = current->datblock = AddToListEx(current->datblock, $3, &current->datblock_tail); }
+      { $$ = current->datblock = AddToListEx(current->datblock, $3.head, &current->datblock_tail); }
   | C_PASM C_EOLN '{' pasmlist '}'
-      { $$ = current->datblock = AddToListEx(current->datblock, $4, &current->datblock_tail); }
+      { $$ = current->datblock = AddToListEx(current->datblock, $4.head, &current->datblock_tail); }
 ;
 
 pasmlist:
   pasmline
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | pasmlist pasmline
-  { $$ = AddToList($1, $2); }
+  { $$ = ListBuilderAdd($1, $2); }
   ;
 
 pasmline:
@@ -2897,23 +2919,23 @@ pasm_baseline:
   | C_BYTE asm_eoln
     { $$ = NewCommentedAST(AST_BYTELIST, NULL, NULL, $1); }
   | C_BYTE pasm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_BYTELIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_BYTELIST, $2.head, NULL, $1); }
   | C_WORD asm_eoln
     { $$ = NewCommentedAST(AST_WORDLIST, NULL, NULL, $1); }
   | C_WORD pasm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_WORDLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_WORDLIST, $2.head, NULL, $1); }
   | C_LONG asm_eoln
     { $$ = NewCommentedAST(AST_LONGLIST, NULL, NULL, $1); }
   | C_LONG pasm_operandlist asm_eoln
-    { $$ = NewCommentedAST(AST_LONGLIST, $2, NULL, $1); }
+    { $$ = NewCommentedAST(AST_LONGLIST, $2.head, NULL, $1); }
   | instruction asm_eoln
     { $$ = NewCommentedInstr($1); }
   | instruction pasm_operandlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction modifierlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction pasm_operandlist modifierlist asm_eoln
-    { $$ = NewCommentedInstr(AddToList($1, AddToList($2, $3))); }
+    { $$ = NewCommentedInstr(AddToList($1, ListBuilderAdd($2, $3.head).head)); }
   | C_ALIGNL asm_eoln
     { $$ = NewCommentedAST(AST_ALIGN, AstInteger(4), NULL, $1); }
   | C_ALIGNW asm_eoln
@@ -2960,7 +2982,7 @@ pasm_debug_exprlist:
    pasm_debug_expritem_first
      { $$ = $1; }
    | pasm_debug_expritem_first ',' pasm_debug_exprlist_continue
-     { $$ = AddToList($1, $3); }
+     { $$ = AddToList($1, $3.head); }
 ;
 
 pasm_debug_expritem_first:
@@ -2975,9 +2997,9 @@ pasm_debug_expritem_first:
    
 pasm_debug_exprlist_continue:
    pasm_debug_expritem
-     { $$ = $1; }
+     { $$ = ListBuilderStart($1); }
    | pasm_debug_exprlist_continue ',' pasm_debug_expritem
-     { $$ = AddToList($1, $3); }
+     { $$ = ListBuilderAdd($1, $3); }
 ;
 
 pasm_debug_expritem: pasm_operand
@@ -2996,9 +3018,9 @@ pasm_operand:
 
 pasm_operandlist:
    pasm_operand
-   { $$ = $1; }
+   { $$ = ListBuilderStart($1); }
  | pasm_operandlist ',' pasm_operand
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 optpasmrange
@@ -3048,7 +3070,7 @@ pasmatom
       | pasmatom C_DEC_OP
             { $$ = AstOperator(K_DECREMENT, $1, NULL); }
       | pasmatom '(' pasm_operandlist ')'
-            { $$ = NewAST(AST_FUNCCALL, $1, $3); }
+            { $$ = NewAST(AST_FUNCCALL, $1, $3.head); }
 ;
 
 pasmunary
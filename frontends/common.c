@@ -56,6 +56,7 @@ int gl_src_charset = CHARSET_UTF8;
 int gl_run_charset = CHARSET_UTF8;
 int gl_have_lut;
 int gl_errors;
+int gl_warnings;
 int gl_warnings_are_errors;
 int gl_verbosity;
 int gl_max_errors;
@@ -990,6 +991,7 @@ LANGUAGE_WARNING(int language, AST *ast, const char *msg, ...)
         banner = "warning";
         SETCOLOR(PRINT_WARNING);
     }
+    gl_warnings++;
     if (ast) {
         ERRORHEADER_AST(ast, banner);
     } else if (current) {
@@ -1018,6 +1020,7 @@ WARNING(AST *instr, const char *msg, ...)
         banner = "warning";
         SETCOLOR(PRINT_WARNING);
     }
+    gl_warnings++;
     ERRORHEADER_AST(instr, banner);
 
     va_start(args, msg);
@@ -38,7 +38,6 @@ struct lexstream {
     void *ptr;  /* current pointer */
     void *arg;  /* original value of pointer */
     size_t maxbytes;
-    int (*getcf)(LexStream *);
 #define UNGET_MAX 16 /* we can ungetc this many times */
     int ungot[UNGET_MAX];
     int ungot_ptr;
@@ -77,12 +76,9 @@ struct lexstream {
     int language;
     int language_version;
 
-    /* for handling Unicode CR+LF */
-    int sawCr;
-
     int pendingLine;  /* 1 if lineCounter needs incrementing */
 
-    Flexbuf curLine;  /* string of current line */
+    const char *lineStart; /* start of current line in the input */
     Flexbuf lineInfo; /* pointers to line info about the file */
 
     unsigned flags;
@@ -235,6 +231,9 @@ extern int gl_list_options;   /* options for listing files */
 
 extern int gl_printprogress;  /* print files as we process them */
 extern int gl_fcache_size;   /* size of fcache for LMM mode */
+extern const char *gl_ircache_dir; /* directory for caching optimized IR, or NULL */
+extern const char *gl_profile_use; /* file of execution counts to guide optimization, or NULL */
+extern const char *gl_cycle_report; /* file for static cycle estimates, or NULL */
 extern const char *gl_cc; /* C compiler to use; NULL means default (PropGCC) */
 extern const char *gl_intstring; /* int string to use */
 
@@ -656,6 +655,18 @@ struct modulestate {
 /* maximum number of items in a multiple assignment */
 #define MAX_TUPLE 16
 
+/* semantic values for the parsers; everything is an AST, except
+ * that rules which build long lists carry a ListBuilder
+ */
+typedef union ParserValue {
+    AST *ast;
+    ListBuilder list;
+} ParserValue;
+
+#define SPINYYSTYPE ParserValue
+#define BASICYYSTYPE ParserValue
+#define CGRAMYYSTYPE ParserValue
+
 /* the current parser state */
 extern Module *current;
 extern Function *curfunc;
@@ -776,6 +787,7 @@ void CheckRecursive(Function *f);
 
 /* code for printing errors */
 extern int gl_errors;
+extern int gl_warnings;
 extern int gl_warnings_are_errors;
 extern int gl_verbosity;
 extern int gl_max_errors;
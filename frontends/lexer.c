@@ -124,7 +124,8 @@ unsigned int findInTable(unsigned int *tab, unsigned wc) {
 static void InitPasm(int flags);
 
 /* functions for handling string streams */
-static int
+/* (files are read into memory all at once, so every stream is a string) */
+static inline int
 strgetc(LexStream *L)
 {
     char *s;
@@ -135,17 +136,16 @@ strgetc(LexStream *L)
     if (delta >= L->maxbytes) {
         return EOF;
     }
+    /* go by length only: a 0 byte in a file is just another character */
     c = (*s++) & 0x00ff;
     if (c == '\r') {
-        c = (*s++) & 0x00ff;
-        if (c != '\n') {
-            --s;
-            c = '\n';
+        if (delta + 1 < L->maxbytes && *s == '\n') {
+            s++;
         }
+        c = '\n';
     }
-    if (c != 0)
-        L->ptr = s;
-    return (c == 0) ? EOF : c;
+    L->ptr = s;
+    return c;
 }
 
 /* open a stream from a string s */
@@ -156,112 +156,66 @@ void strToLex(LexStream *L, const char *s, size_t maxBytes, const char *name, in
     }
     memset(L, 0, sizeof(*L));
     L->arg = L->ptr = (void *)s;
+    L->lineStart = s;
     L->maxbytes = maxBytes;
-    L->getcf = strgetc;
     L->pendingLine = 1;
     L->fileName = name ? name : "<string>";
     L->language = language;
-    flexbuf_init(&L->curLine, 1024);
     flexbuf_init(&L->lineInfo, 1024);
 }
 
-/* functions for handling FILE streams */
-/* filegetc is for ASCII streams;
-   filegetwc is for UCS-16LE streams
-*/
-
-static int
-filegetc(LexStream *L)
-{
-    FILE *f;
-    int c;
-
-    f = (FILE *)L->ptr;
-    c = fgetc(f);
-    /* translate CR+LF ->LF, plain CR ->LF */
-    if (c == '\r') {
-        c = fgetc(f);
-        if (c != '\n') {
-            ungetc(c, f);
-            c = '\n';
-        }
-    }
-
-    return (c >= 0) ? c : EOF;
-}
-
-static int
-filegetwc(LexStream *L)
+/* convert UCS-16LE text to UTF-8 */
+static void
+utf16ToUtf8(Flexbuf *dst, const unsigned char *src, size_t len)
 {
-    FILE *f;
-    int c1, c2;
-    f = (FILE *)L->ptr;
-again:
-    c1 = fgetc(f);
-    if (c1 < 0) return EOF;
-    c2 = fgetc(f);
-    if (c2 != 0 || c1 >= 0x80) {
-        wchar_t w;
-        size_t n;
-        char buf[8];
-        if (c2 < 0) return EOF;
-        /* convert to UTF-8 */
-        w = (c2<<8) | c1;
-        n = to_utf8(buf, w);
-        while (n > 1) {
-            --n;
-            lexungetc(L, buf[n] & 0xff);
-        }
-        return buf[0] & 0xff;
-    }
-    /* eliminate carriage returns */
-    /* actually there's a problem: if we have a MAC file,
-       we may not have line feeds, so we need to
-       convert carriage returns to line feeds; but for
-       Windows we need to ignore a line feed right after a
-       carriage return!
-    */
-    if (c1 == '\r') {
-        c1 = '\n';
-        L->sawCr = 1;
-    } else {
-        if (c1 == '\n') {
-            if (L->sawCr) {
-                L->sawCr = 0;
-                goto again;
-            }
+    char buf[8];
+    size_t n;
+    wchar_t w;
+
+    while (len >= 2) {
+        w = src[0] | (src[1] << 8);
+        src += 2;
+        len -= 2;
+        if (w < 0x80) {
+            flexbuf_addchar(dst, w);
+        } else {
+            n = to_utf8(buf, w);
+            flexbuf_addmem(dst, buf, n);
         }
-        L->sawCr = 0;
     }
-    return c1;
 }
 
 /* open a stream from a FILE f */
-void fileToLex(LexStream *L, FILE *f, const char *name, int language)
+/* returns the buffer holding the file text, which the caller must free
+   once parsing is finished */
+char *fileToLex(LexStream *L, FILE *f, const char *name, int language)
 {
-    int c1, c2;
-
-    if (!L) {
-        current->Lptr = L = (LexStream *)malloc(sizeof(*L));
-    }
-    memset(L, 0, sizeof(*L));
-    L->ptr = (void *)f;
-    L->arg = NULL;
-    L->getcf = filegetc;
-    L->pendingLine = 1;
-    L->language = language;
-    flexbuf_init(&L->curLine, 1024);
-    flexbuf_init(&L->lineInfo, 1024);
+    char *text;
+    Flexbuf fb;
+    Flexbuf wide;
+    char tmp[8192];
+    size_t n;
+    const unsigned char *data;
+
+    /* read the whole file at once */
+    flexbuf_init(&fb, 65536);
+    while ((n = fread(tmp, 1, sizeof(tmp), f)) > 0) {
+        flexbuf_addmem(&fb, tmp, n);
+    }
+    n = flexbuf_curlen(&fb);
+    data = (const unsigned char *)flexbuf_peek(&fb);
     /* check for Unicode */
-    c1 = fgetc(f);
-    c2 = fgetc(f);
-    if (c1 == 0xff && c2 == 0xfe) {
-        L->getcf = filegetwc;
-    } else {
-        rewind(f);
+    if (n >= 2 && data[0] == 0xff && data[1] == 0xfe) {
+        flexbuf_init(&wide, 2*n);
+        utf16ToUtf8(&wide, data+2, n-2);
+        flexbuf_delete(&fb);
+        fb = wide;
+        n = flexbuf_curlen(&fb);
     }
-    L->fileName = name;
-
+    flexbuf_addchar(&fb, 0);
+    text = flexbuf_get(&fb);
+    strToLex(L, text, n, name, language);
+    return text;
 }
 
 //
@@ -296,15 +250,34 @@ static void ResetExprState(LexStream *L)
     L->exprStateStack[0] = ExprState_Default;
 }
 
+/* saved source lines live as long as the ASTs that refer to them */
+Arena linedata_arena = { "linedata" };
+
 /*
  * utility function: start a new line
  */
 static void startNewLine(LexStream *L)
 {
     LineInfo lineInfo;
-
-    flexbuf_addchar(&L->curLine, 0); // terminate the line
-    lineInfo.linedata = flexbuf_get(&L->curLine);
+    const char *src = L->lineStart;
+    const char *end = (const char *)L->ptr;
+    char *dst;
+
+    // save a copy of the text read since the last line started,
+    // with line endings translated the same way strgetc does
+    dst = lineInfo.linedata = (char *)arena_alloc(&linedata_arena, end - src + 1);
+    while (src < end) {
+        if (*src == '\r') {
+            src++;
+            if (src == end || *src != '\n') {
+                *dst++ = '\n';
+            }
+            continue;
+        }
+        *dst++ = *src++;
+    }
+    *dst = 0;
+    L->lineStart = end;
     lineInfo.fileName = L->fileName;
     lineInfo.lineno = L->lineCounter;
     flexbuf_addmem(&L->lineInfo, (char *)&lineInfo, sizeof(lineInfo));
@@ -348,7 +321,7 @@ lexgetc(LexStream *L)
         L->sawInstruction = L->sawDataDirective = 0;
         L->backtick_state = 0;
     }
-    c = (L->getcf(L));
+    c = strgetc(L);
     if (c == '\n') {
         L->pendingLine = 1;
     } else if (c == VT) {
@@ -363,8 +336,6 @@ lexgetc(LexStream *L)
     }
     if (c == EOF) {
         startNewLine(L);
-    } else {
-        flexbuf_addchar(&L->curLine, c);
     }
     return c;
 }
@@ -1273,7 +1244,6 @@ parseBacktickString(LexStream *L, AST **ast_ptr, int first)
     ast->d.string = getTranslatedString(&fb);
     if (ast->d.string[0] == 0) {
         c = lexgetc(L);
-        free(ast);
         ast = NULL;
     } else {
         c = SP_BACKTICK_STRING;
@@ -4473,7 +4443,7 @@ spinyylex(SPINYYSTYPE *yval)
 {
     int c;
 
-    saved_spinyychar = c = getSpinToken(current->Lptr, yval);
+    saved_spinyychar = c = getSpinToken(current->Lptr, &yval->ast);
     if (c == SP_EOF)
         return 0;
     return c;
@@ -4825,7 +4795,7 @@ int
 basicyylex(BASICYYSTYPE *yval)
 {
     int c;
-    saved_basicyychar = c = getBasicToken(current->Lptr, yval);
+    saved_basicyychar = c = getBasicToken(current->Lptr, &yval->ast);
     if (c == BAS_EOF || c == EOF)
         return 0;
     return c;
@@ -5305,7 +5275,7 @@ int
 cgramyylex(CGRAMYYSTYPE *yval)
 {
     int c;
-    saved_cgramyychar = c = getCToken(current->Lptr, yval);
+    saved_cgramyychar = c = getCToken(current->Lptr, &yval->ast);
     if (c == EOF)
         return 0;
     return c;
@@ -27,7 +27,7 @@ void strToLex(LexStream *lex, const char *s, size_t maxBytes, const char *name,
 /*
  * function to open a lexer stream from a FILE
  */
-void fileToLex(LexStream *lex, FILE *f, const char *name, int language);
+char *fileToLex(LexStream *lex, FILE *f, const char *name, int language);
 
 /*
  * function to get the next token from a stream
@@ -13,7 +13,6 @@
 #include <ctype.h>
 #include "spinc.h"
 
-#define SPINYYSTYPE AST*
 #undef  YYSTYPE
 #define YYSTYPE SPINYYSTYPE
     
@@ -149,7 +148,7 @@ SpinDeclareObjectSymbols(AST *objlist)
 // expand C escapes (like \n) in a string
 // return an exprlist of strings and characters
 AST *ExpandCEscapes(AST *str) {
-    AST *elist = NULL;
+    ListBuilder elist = { NULL, NULL };
     const char *inpstr;
     int c;
     
@@ -211,10 +210,10 @@ AST *ExpandCEscapes(AST *str) {
             elem->d.string = dummy;
             elem = NewAST(AST_EXPRLIST, elem, NULL);
         }
-        elist = AddToList(elist, elem);
+        elist = ListBuilderAdd(elist, elem);
         c = *inpstr++;
     }
-    return elist;
+    return elist.head;
 }
 
 static AST *
@@ -414,250 +413,250 @@ SpinDeclareInterface(AST *ident, AST *defs)
 #define YYERROR_VERBOSE 1
 %}
 
-%token SP_IDENTIFIER "identifier"
-%token SP_BYTECODE   "__bytecode__"
-%token SP_NUM        "number"
-%token SP_STRING     "string"
-%token SP_BACKTICK_STRING "` string"
-%token SP_FLOATNUM   "float point number"
-%token SP_SPR        "SPR"
-%token SP_COGREG     "REG"
+%token <ast> SP_IDENTIFIER "identifier"
+%token <ast> SP_BYTECODE   "__bytecode__"
+%token <ast> SP_NUM        "number"
+%token <ast> SP_STRING     "string"
+%token <ast> SP_BACKTICK_STRING "` string"
+%token <ast> SP_FLOATNUM   "float point number"
+%token <ast> SP_SPR        "SPR"
+%token <ast> SP_COGREG     "REG"
 
 /* various keywords */
-%token SP_CON        "CON"
-%token SP_VAR        "VAR"
-%token SP_DAT        "DAT"
-%token SP_PUB        "PUB"
-%token SP_PRI        "PRI"
-%token SP_OBJ        "OBJ"
-%token SP_END        "END"
-%token SP_INLINECCODE "CCODE"
-%token SP_BYTE       "BYTE"
-%token SP_WORD       "WORD"
-%token SP_LONG       "LONG"
-%token SP_QUAD       "%QUAD"
-%token SP_BYTEFIT    "BYTEFIT"
-%token SP_WORDFIT    "WORDFIT"
-%token SP_FVAR       "FVAR"
-%token SP_FVARS      "FVARS"
-%token SP_ASMCLK     "ASMCLK"
-
-%token SP_INSTR      "instruction"
-%token SP_INSTRMODIFIER "instruction modifier"
-%token SP_HWREG      "hardware register"
-%token SP_ORG        "ORG"
-%token SP_ORGH       "ORGH"
-%token SP_ORGF       "ORGF"
-%token SP_RES        "RES"
-%token SP_FIT        "FIT"
-%token SP_ALIGNL     "ALIGNL"
-%token SP_ALIGNW     "ALIGNW"
-
-%token SP_REPEAT     "REPEAT"
-%token SP_FROM       "FROM"
-%token SP_TO         "TO"
-%token SP_STEP       "STEP"
-%token SP_WHILE      "WHILE"
-%token SP_WITH       "WITH"
-%token SP_UNTIL      "UNTIL"
-%token SP_IF         "IF"
-%token SP_IFNOT      "IFNOT"
-%token SP_ELSE       "ELSE"
-%token SP_ELSEIF     "ELSEIF"
-%token SP_ELSEIFNOT  "ELSEIFNOT"
-%token SP_THEN       "THEN"
-%token SP_ENDIF      "ENDIF"
-
-%token SP_LOOKDOWN   "LOOKDOWN"
-%token SP_LOOKDOWNZ  "LOOKDOWNZ"
-%token SP_LOOKUP     "LOOKUP"
-%token SP_LOOKUPZ    "LOOKUPZ"
-%token SP_COGINIT    "COGINIT"
-%token SP_COGNEW     "COGNEW"
-%token SP_TASKINIT   "TASKSPIN"
-%token SP_TASKHLT    "TASKHLT"
-%token SP_PINR       "PINREAD"
-%token SP_PINT       "PINTOGGLE"
-%token SP_PINW       "PINWRITE"
-%token SP_PINL       "PINLOW"
-%token SP_PINH       "PINHIGH"
-
-%token SP_CASE       "CASE"
-%token SP_CASE_FAST  "CASE_FAST"
-%token SP_OTHER      "OTHER"
-
-%token SP_QUIT       "QUIT"
-%token SP_NEXT       "NEXT"
-
-%token SP_ALLOCA     "__BUILTIN_ALLOCA"
-%token SP_REGEXEC    "REGEXEC"
-%token SP_REGLOAD    "REGLOAD"
+%token <ast> SP_CON        "CON"
+%token <ast> SP_VAR        "VAR"
+%token <ast> SP_DAT        "DAT"
+%token <ast> SP_PUB        "PUB"
+%token <ast> SP_PRI        "PRI"
+%token <ast> SP_OBJ        "OBJ"
+%token <ast> SP_END        "END"
+%token <ast> SP_INLINECCODE "CCODE"
+%token <ast> SP_BYTE       "BYTE"
+%token <ast> SP_WORD       "WORD"
+%token <ast> SP_LONG       "LONG"
+%token <ast> SP_QUAD       "%QUAD"
+%token <ast> SP_BYTEFIT    "BYTEFIT"
+%token <ast> SP_WORDFIT    "WORDFIT"
+%token <ast> SP_FVAR       "FVAR"
+%token <ast> SP_FVARS      "FVARS"
+%token <ast> SP_ASMCLK     "ASMCLK"
+
+%token <ast> SP_INSTR      "instruction"
+%token <ast> SP_INSTRMODIFIER "instruction modifier"
+%token <ast> SP_HWREG      "hardware register"
+%token <ast> SP_ORG        "ORG"
+%token <ast> SP_ORGH       "ORGH"
+%token <ast> SP_ORGF       "ORGF"
+%token <ast> SP_RES        "RES"
+%token <ast> SP_FIT        "FIT"
+%token <ast> SP_ALIGNL     "ALIGNL"
+%token <ast> SP_ALIGNW     "ALIGNW"
+
+%token <ast> SP_REPEAT     "REPEAT"
+%token <ast> SP_FROM       "FROM"
+%token <ast> SP_TO         "TO"
+%token <ast> SP_STEP       "STEP"
+%token <ast> SP_WHILE      "WHILE"
+%token <ast> SP_WITH       "WITH"
+%token <ast> SP_UNTIL      "UNTIL"
+%token <ast> SP_IF         "IF"
+%token <ast> SP_IFNOT      "IFNOT"
+%token <ast> SP_ELSE       "ELSE"
+%token <ast> SP_ELSEIF     "ELSEIF"
+%token <ast> SP_ELSEIFNOT  "ELSEIFNOT"
+%token <ast> SP_THEN       "THEN"
+%token <ast> SP_ENDIF      "ENDIF"
+
+%token <ast> SP_LOOKDOWN   "LOOKDOWN"
+%token <ast> SP_LOOKDOWNZ  "LOOKDOWNZ"
+%token <ast> SP_LOOKUP     "LOOKUP"
+%token <ast> SP_LOOKUPZ    "LOOKUPZ"
+%token <ast> SP_COGINIT    "COGINIT"
+%token <ast> SP_COGNEW     "COGNEW"
+%token <ast> SP_TASKINIT   "TASKSPIN"
+%token <ast> SP_TASKHLT    "TASKHLT"
+%token <ast> SP_PINR       "PINREAD"
+%token <ast> SP_PINT       "PINTOGGLE"
+%token <ast> SP_PINW       "PINWRITE"
+%token <ast> SP_PINL       "PINLOW"
+%token <ast> SP_PINH       "PINHIGH"
+
+%token <ast> SP_CASE       "CASE"
+%token <ast> SP_CASE_FAST  "CASE_FAST"
+%token <ast> SP_OTHER      "OTHER"
+
+%token <ast> SP_QUIT       "QUIT"
+%token <ast> SP_NEXT       "NEXT"
+
+%token <ast> SP_ALLOCA     "__BUILTIN_ALLOCA"
+%token <ast> SP_REGEXEC    "REGEXEC"
+%token <ast> SP_REGLOAD    "REGLOAD"
 
 /* other stuff */
-%token SP_ABORT      "ABORT"
-%token SP_RESULT     "RESULT"
-%token SP_RETURN     "RETURN"
-%token SP_INDENT     "indentation"
-%token SP_OUTDENT    "lack of indentation"
-%token SP_EOLN       "end of line"
-%token SP_EOF        "end of file"
-%token SP_DOTS       ".."
-%token SP_HERE       "$"
-%token SP_STRINGPTR  "STRING"
-%token SP_FILE       "FILE"
+%token <ast> SP_ABORT      "ABORT"
+%token <ast> SP_RESULT     "RESULT"
+%token <ast> SP_RETURN     "RETURN"
+%token <ast> SP_INDENT     "indentation"
+%token <ast> SP_OUTDENT    "lack of indentation"
+%token <ast> SP_EOLN       "end of line"
+%token <ast> SP_EOF        "end of file"
+%token <ast> SP_DOTS       ".."
+%token <ast> SP_HERE       "$"
+%token <ast> SP_STRINGPTR  "STRING"
+%token <ast> SP_FILE       "FILE"
 
 /* flexspin extensions */
-%token SP_ANNOTATION
-%token SP_ASM        "ASM"
-%token SP_ASM_CONST  "ASM_CONST"
-%token SP_ENDASM     "ENDASM"
+%token <ast> SP_ANNOTATION
+%token <ast> SP_ASM        "ASM"
+%token <ast> SP_ASM_CONST  "ASM_CONST"
+%token <ast> SP_ENDASM     "ENDASM"
 /* the lexer can generate ASM_IF family from regular IF */
-%token SP_ASM_IF     "%IF"
-%token SP_ASM_ELSEIF "%ELSEIF"
-%token SP_ASM_ELSE   "%ELSE"
-%token SP_ASM_ENDIF  "%END"
-%token SP_INTERFACE  "%INTERFACE"
-%token SP_NAMESP     "%NAMESP"
-%token SP_VARARGS    "%VARARGS"
+%token <ast> SP_ASM_IF     "%IF"
+%token <ast> SP_ASM_ELSEIF "%ELSEIF"
+%token <ast> SP_ASM_ELSE   "%ELSE"
+%token <ast> SP_ASM_ENDIF  "%END"
+%token <ast> SP_INTERFACE  "%INTERFACE"
+%token <ast> SP_NAMESP     "%NAMESP"
+%token <ast> SP_VARARGS    "%VARARGS"
 
 /* Spin2 additions */
-%token SP_FIELD      "FIELD"
-%token SP_BYTES      "BYTES"
-%token SP_WORDS      "WORDS"
-%token SP_LONGS      "LONGS"
-%token SP_LSTRING    "LSTRING"
+%token <ast> SP_FIELD      "FIELD"
+%token <ast> SP_BYTES      "BYTES"
+%token <ast> SP_WORDS      "WORDS"
+%token <ast> SP_LONGS      "LONGS"
+%token <ast> SP_LSTRING    "LSTRING"
 
 /* v44 additions */
-%token SP_TYPENAME   "STRUCTURE NAME"
-%token SP_BYTESWAP   "BYTESWAP"
-%token SP_WORDSWAP   "WORDSWAP"
-%token SP_LONGSWAP   "LONGSWAP"
-%token SP_BYTECOMP   "BYTECOMP"
-%token SP_WORDCOMP   "WORDCOMP"
-%token SP_LONGCOMP   "LONGCOMP"
-%token SP_FILL       "FILL"
-%token SP_COPY       "COPY"
-%token SP_SWAP       "SWAP"
-%token SP_COMP       "COMP"
+%token <ast> SP_TYPENAME   "STRUCTURE NAME"
+%token <ast> SP_BYTESWAP   "BYTESWAP"
+%token <ast> SP_WORDSWAP   "WORDSWAP"
+%token <ast> SP_LONGSWAP   "LONGSWAP"
+%token <ast> SP_BYTECOMP   "BYTECOMP"
+%token <ast> SP_WORDCOMP   "WORDCOMP"
+%token <ast> SP_LONGCOMP   "LONGCOMP"
+%token <ast> SP_FILL       "FILL"
+%token <ast> SP_COPY       "COPY"
+%token <ast> SP_SWAP       "SWAP"
+%token <ast> SP_COMP       "COMP"
 
 /* v45 additions */
-%token SP_STRUCT     "STRUCT"
-%token SP_SIZEOF     "SIZEOF"
-%token SP_SWAP_OP    ":=:"
+%token <ast> SP_STRUCT     "STRUCT"
+%token <ast> SP_SIZEOF     "SIZEOF"
+%token <ast> SP_SWAP_OP    ":=:"
 
 /* v46 additions */
-%token SP_C_Z        "C_Z"
+%token <ast> SP_C_Z        "C_Z"
 
 /* v47 additions */
-%token SP_NEWTASK    "NEWTASK"
-%token SP_THISTASK   "THISTASK"
+%token <ast> SP_NEWTASK    "NEWTASK"
+%token <ast> SP_THISTASK   "THISTASK"
 
 /* v50 additions */
-%token SP_DITTO      "DITTO"
+%token <ast> SP_DITTO      "DITTO"
 
 /* operators */
-%token SP_ASSIGN     ":="
-%token SP_XOR        "XOR (^^)"
-%token SP_OR         "OR (||)"
-%token SP_AND        "AND (&&)"
-%token SP_ORELSE     "__ORELSE__"
-%token SP_ANDTHEN    "__ANDTHEN__"
-%token SP_GE         "=>"
-%token SP_LE         "=<"
-%token SP_GEU        "+=>"
-%token SP_LEU        "+=<"
-%token SP_GTU        "+>"
-%token SP_LTU        "+<"
-%token SP_NE         "<>"
-%token SP_EQ         "=="
-%token SP_SGNCOMP    "<=>"
-%token SP_LIMITMIN   "#>"
-%token SP_LIMITMAX   "<#"
-%token SP_REMAINDER  "//"
-%token SP_UNSDIV     "+/"
-%token SP_UNSMOD     "+//"
-%token SP_FRAC       "FRAC"
-%token SP_HIGHMULT   "**"
-%token SP_SCAS        "SCAS"
-%token SP_UNSHIGHMULT "SCA (+**)"
-%token SP_ROTR       "ROR (->)"
-%token SP_ROTL       "ROL (<-)"
-%token SP_SHL        "<<"
-%token SP_SHR        ">>"
-%token SP_SAR        "SAR (~>)"
-%token SP_REV        "><"
-%token SP_REV2       "REV"
-%token SP_ADDBITS    "ADDBITS"
-%token SP_ADDPINS    "ADDPINS"
-%token SP_NEGATE     "-"
-%token SP_BIT_NOT    "!"
-%token SP_SQRT       "SQRT (^^)"
-%token SP_ABS        "ABS (||)"
-%token SP_FSQRT      "FSQRT"
-%token SP_FABS       "FABS"
-%token SP_DECODE     "DECOD (|<)"
-%token SP_ENCODE     ">|"
-%token SP_ENCODE2    "ENCOD"
-%token SP_NOT        "NOT (!!)"
-%token SP_DOUBLETILDE "~~"
-%token SP_INCREMENT  "++"
-%token SP_DECREMENT  "--"
-%token SP_REF_INC    "[++]"
-%token SP_REF_DEC    "[--]"
-%token SP_DOUBLEAT   "@@"
-%token SP_TRIPLEAT   "@@@"
-%token SP_FIELDPTR   "^@"
-%token SP_FLOAT      "floating point number"
-%token SP_TRUNC      "TRUNC"
-%token SP_ROUND      "ROUND"
-%token SP_CONSTANT   "constant"
-%token SP_RANDOM     "??"
-%token SP_EMPTY      "empty assignment marker _"
-%token SP_SIGNX      "SIGNX"
-%token SP_ZEROX      "ZEROX"
-%token SP_NAN        "NAN"
-%token SP_ONES       "ONES"
-%token SP_BMASK      "BMASK"
-%token SP_QLOG       "QLOG"
-%token SP_QEXP       "QEXP"
-%token SP_DEBUG      "DEBUG"
-%token SP_LOOK_SEP   ": after lookup/down"
-%token SP_CONDITIONAL  "?"
-%token SP_CONDITIONAL_SEP ": after ?"
-%token SP_REPEAT_SEP ": after repeat"
-
-%token SP_LOG2   "LOG2"
-%token SP_EXP2   "EXP2"
-%token SP_LOG10  "LOG10"
-%token SP_EXP10  "EXP10"
-%token SP_LOG    "LN"
-%token SP_EXP    "EXP"
-%token SP_POW    "POW"
-
-%token SP_MOVBYTS "MOVBYTS"
-%token SP_ENDIANL "ENDIANL"
-%token SP_ENDIANW "ENDIANW"
-%token SP_DEBUG_END_SESSION "DEBUG_END_SESSION"
+%token <ast> SP_ASSIGN     ":="
+%token <ast> SP_XOR        "XOR (^^)"
+%token <ast> SP_OR         "OR (||)"
+%token <ast> SP_AND        "AND (&&)"
+%token <ast> SP_ORELSE     "__ORELSE__"
+%token <ast> SP_ANDTHEN    "__ANDTHEN__"
+%token <ast> SP_GE         "=>"
+%token <ast> SP_LE         "=<"
+%token <ast> SP_GEU        "+=>"
+%token <ast> SP_LEU        "+=<"
+%token <ast> SP_GTU        "+>"
+%token <ast> SP_LTU        "+<"
+%token <ast> SP_NE         "<>"
+%token <ast> SP_EQ         "=="
+%token <ast> SP_SGNCOMP    "<=>"
+%token <ast> SP_LIMITMIN   "#>"
+%token <ast> SP_LIMITMAX   "<#"
+%token <ast> SP_REMAINDER  "//"
+%token <ast> SP_UNSDIV     "+/"
+%token <ast> SP_UNSMOD     "+//"
+%token <ast> SP_FRAC       "FRAC"
+%token <ast> SP_HIGHMULT   "**"
+%token <ast> SP_SCAS        "SCAS"
+%token <ast> SP_UNSHIGHMULT "SCA (+**)"
+%token <ast> SP_ROTR       "ROR (->)"
+%token <ast> SP_ROTL       "ROL (<-)"
+%token <ast> SP_SHL        "<<"
+%token <ast> SP_SHR        ">>"
+%token <ast> SP_SAR        "SAR (~>)"
+%token <ast> SP_REV        "><"
+%token <ast> SP_REV2       "REV"
+%token <ast> SP_ADDBITS    "ADDBITS"
+%token <ast> SP_ADDPINS    "ADDPINS"
+%token <ast> SP_NEGATE     "-"
+%token <ast> SP_BIT_NOT    "!"
+%token <ast> SP_SQRT       "SQRT (^^)"
+%token <ast> SP_ABS        "ABS (||)"
+%token <ast> SP_FSQRT      "FSQRT"
+%token <ast> SP_FABS       "FABS"
+%token <ast> SP_DECODE     "DECOD (|<)"
+%token <ast> SP_ENCODE     ">|"
+%token <ast> SP_ENCODE2    "ENCOD"
+%token <ast> SP_NOT        "NOT (!!)"
+%token <ast> SP_DOUBLETILDE "~~"
+%token <ast> SP_INCREMENT  "++"
+%token <ast> SP_DECREMENT  "--"
+%token <ast> SP_REF_INC    "[++]"
+%token <ast> SP_REF_DEC    "[--]"
+%token <ast> SP_DOUBLEAT   "@@"
+%token <ast> SP_TRIPLEAT   "@@@"
+%token <ast> SP_FIELDPTR   "^@"
+%token <ast> SP_FLOAT      "floating point number"
+%token <ast> SP_TRUNC      "TRUNC"
+%token <ast> SP_ROUND      "ROUND"
+%token <ast> SP_CONSTANT   "constant"
+%token <ast> SP_RANDOM     "??"
+%token <ast> SP_EMPTY      "empty assignment marker _"
+%token <ast> SP_SIGNX      "SIGNX"
+%token <ast> SP_ZEROX      "ZEROX"
+%token <ast> SP_NAN        "NAN"
+%token <ast> SP_ONES       "ONES"
+%token <ast> SP_BMASK      "BMASK"
+%token <ast> SP_QLOG       "QLOG"
+%token <ast> SP_QEXP       "QEXP"
+%token <ast> SP_DEBUG      "DEBUG"
+%token <ast> SP_LOOK_SEP   ": after lookup/down"
+%token <ast> SP_CONDITIONAL  "?"
+%token <ast> SP_CONDITIONAL_SEP ": after ?"
+%token <ast> SP_REPEAT_SEP ": after repeat"
+
+%token <ast> SP_LOG2   "LOG2"
+%token <ast> SP_EXP2   "EXP2"
+%token <ast> SP_LOG10  "LOG10"
+%token <ast> SP_EXP10  "EXP10"
+%token <ast> SP_LOG    "LN"
+%token <ast> SP_EXP    "EXP"
+%token <ast> SP_POW    "POW"
+
+%token <ast> SP_MOVBYTS "MOVBYTS"
+%token <ast> SP_ENDIANL "ENDIANL"
+%token <ast> SP_ENDIANW "ENDIANW"
+%token <ast> SP_DEBUG_END_SESSION "DEBUG_END_SESSION"
 
 /* v53 additions */
-%token SP_OFFSETOF   "OFFSETOF"
+%token <ast> SP_OFFSETOF   "OFFSETOF"
 
-%token SP_FADD   "+."
-%token SP_FSUB   "-."
-%token SP_FMUL   "*."
-%token SP_FDIV   "%."
-%token SP_FLT    "<."
-%token SP_FGT    ">."
-%token SP_FNE    "<>."
-%token SP_FEQ    "==."
-%token SP_FLE    "<=."
-%token SP_FGE    ">=."
-%token SP_FNEGATE "float negate"
+%token <ast> SP_FADD   "+."
+%token <ast> SP_FSUB   "-."
+%token <ast> SP_FMUL   "*."
+%token <ast> SP_FDIV   "%."
+%token <ast> SP_FLT    "<."
+%token <ast> SP_FGT    ">."
+%token <ast> SP_FNE    "<>."
+%token <ast> SP_FEQ    "==."
+%token <ast> SP_FLE    "<=."
+%token <ast> SP_FGE    ">=."
+%token <ast> SP_FNEGATE "float negate"
 
-%token SP_DAT_LBRACK "[ in DAT"
-%token SP_DAT_RBRACK "] in DAT"
+%token <ast> SP_DAT_LBRACK "[ in DAT"
+%token <ast> SP_DAT_RBRACK "] in DAT"
 
-%token SP_DOUBLE_DOLLAR "$$"
+%token <ast> SP_DOUBLE_DOLLAR "$$"
 
 /* operator precedence */
 %right SP_ASSIGN SP_SWAP_OP
@@ -683,13 +682,31 @@ SpinDeclareInterface(AST *ident, AST *defs)
 %left SP_REF_INC SP_REF_DEC
 %left SP_CONSTANT SP_FLOAT SP_TRUNC SP_ROUND SP_NAN
 
+%type <ast> input rest emptyline topelement funcdef
+%type <ast> funcdef_end optparamlist resultname localvars funcbody_internal enter_func
+%type <ast> exit_func funcbody stmt basicstmt debug_prefix optdebugmask
+%type <ast> debug_exprlist debug_expritem_first debug_expritem asmdebug_func asmdebug_exprlist asmdebug_expritem_first
+%type <ast> asmdebug_expritem multiassign compoundstmt stmtblock ifstmt elseblock
+%type <ast> casestmt casematchitem casematch matchexpritem rangeexpritem repeatstmt
+%type <ast> lookupexpr lookdownexpr conline optarray structitem ifaceitem
+%type <ast> enumitem datblock datline basedatline optidentifier objline
+%type <ast> optobjparams objparamitem varline identdecl vardecl general_type
+%type <ast> paramidentdecl expr lhs lhsseq lhssingle opt_emptysize
+%type <ast> opt_numrets funccall expritem datexpritem optcatch operand
+%type <ast> range integer float string identifier annotation
+%type <ast> hwreg instruction instrmodifier structname ptrstructname
+%type <list> stmtlist debug_exprlist_continue asmdebug_exprlist_continue casematchlist matchexprlist rangeexprlist
+%type <list> conblock structlist ifacelist enumlist objblock objparams
+%type <list> varblock identlist vardecllist paramidentlist lhsseqcont exprlist
+%type <list> datexprlist operandlist modifierlist
+
 %%
 input:
   rest
   | conblock rest
     {
         if (current) {
-            current->conblock = AddToListEx(current->conblock, $1, &current->conblock_tail);
+            current->conblock = AddToListEx(current->conblock, $1.head, &current->conblock_tail);
         }
     }
 ;
@@ -709,7 +726,7 @@ emptylines:
 
 topelement:
   SP_CON conblock
-    { $$ = current->conblock = AddToListEx(current->conblock, $2, &current->conblock_tail); }
+    { $$ = current->conblock = AddToListEx(current->conblock, $2.head, &current->conblock_tail); }
   | SP_DAT datblock
     { $$ = current->datblock = AddToListEx(current->datblock, $2, &current->datblock_tail); }
   | SP_DAT annotation datblock
@@ -719,13 +736,13 @@ topelement:
     }
   | SP_VAR varblock
     {
-        AST *vars = $2;
+        AST *vars = $2.head;
         SpinDeclareVarSymbols(vars);
         $$ = current->pendingvarblock = AddToList(current->pendingvarblock, vars);
     }
   | SP_OBJ objblock
     {
-        AST *objs = $2;
+        AST *objs = $2.head;
         $$ = current->objblock = AddToList(current->objblock, objs);
         SpinDeclareObjectSymbols(objs);
     }
@@ -797,9 +814,9 @@ optparamlist:
       LANGUAGE_WARNING(LANG_SPIN_SPIN1, NULL, "() for empty parameter lists is a flexspin extension");
   }
 | paramidentlist
-  { $$ = $1; }
+  { $$ = $1.head; }
 | '(' paramidentlist ')'
-  { $$ = $2; }
+  { $$ = $2.head; }
   ;
 
 resultname:
@@ -809,7 +826,7 @@ resultname:
   {
       // handle the common case of just one identifier by
       // unwrapping the list
-      AST *list = $2;
+      AST *list = $2.head;
       if (list->kind == AST_LISTHOLDER && list->right == NULL) {
           list = list->left;
       }
@@ -821,7 +838,7 @@ localvars:
 /* empty */
   { $$ = NULL; }
 | '|' vardecllist
-  { $$ = $2; }
+  { $$ = $2.head; }
     ;
 
 funcbody_internal:
@@ -834,7 +851,7 @@ funcbody_internal:
       $$ = str;
   }
 | stmtlist
-  { $$ = $1; }
+  { $$ = $1.head; }
 ;
 
 enter_func:
@@ -856,11 +873,11 @@ funcbody: enter_func funcbody_internal exit_func
 stmtlist:
   stmt
     {
-        $$ = $1;
+        $$ = ListBuilderStart($1);
     }
   | stmtlist stmt
   {
-      $$ = AddToList($1, $2); 
+      $$ = ListBuilderAdd($1, $2);
   }
   ;
 
@@ -880,10 +897,10 @@ basicstmt:
     { $$ = AstReturn(NULL, $1); }
   |  SP_RETURN '(' exprlist ')' SP_EOLN
     {
-        $$ = AstReturn($3, $1);
+        $$ = AstReturn($3.head, $1);
     }
   |  SP_RETURN exprlist SP_EOLN
-    { $$ = AstReturn($2, $1); }
+    { $$ = AstReturn($2.head, $1); }
   | SP_ABORT SP_EOLN
     {
         if (current && current->curLanguage == LANG_SPIN_SPIN2) {
@@ -939,14 +956,14 @@ debug_exprlist:
   debug_expritem_first
      { $$ = $1; }
   | debug_expritem_first ',' debug_exprlist_continue
-     { $$ = AddToList($1, $3); }
+     { $$ = AddToList($1, $3.head); }
 ;
 
 debug_exprlist_continue:
    debug_expritem
-     { $$ = $1; }
+     { $$ = ListBuilderStart($1); }
    | debug_exprlist_continue ',' debug_expritem
-     { $$ = AddToList($1, $3); }
+     { $$ = ListBuilderAdd($1, $3); }
    ;
 
 debug_expritem_first:
@@ -971,29 +988,30 @@ debug_expritem:
 
 asmdebug_func:
   identifier '(' operandlist ')'
-    { $$ = MakeFunccall($1,$3,NULL);}
+    { $$ = MakeFunccall($1,$3.head,NULL);}
   | identifier '(' ')'
     { $$ = MakeFunccall($1,NULL,NULL);}
   | SP_C_Z
     { $$ = MakeFunccall(AstIdentifier("c_z"),NULL,NULL);}
   | SP_IF '(' operandlist ')'
-    { $$ = MakeFunccall(AstIdentifier("if"),$3,NULL);}
+    { $$ = MakeFunccall(AstIdentifier("if"),$3.head,NULL);}
   | SP_IFNOT '(' operandlist ')'
-    { $$ = MakeFunccall(AstIdentifier("ifnot"),$3,NULL);}
+    { $$ = MakeFunccall(AstIdentifier("ifnot"),$3.head,NULL);}
   | SP_ASM_IF '(' operandlist ')'
-    { $$ = MakeFunccall(AstIdentifier("if"),$3,NULL);}
+    { $$ = MakeFunccall(AstIdentifier("if"),$3.head,NULL);}
 ;
 
 asmdebug_exprlist:
   asmdebug_expritem_first
   | asmdebug_expritem_first ',' asmdebug_exprlist_continue
-     { $$ = AddToList($1, $3); }
+     { $$ = AddToList($1, $3.head); }
 ;
 
 asmdebug_exprlist_continue:
    asmdebug_expritem
+     { $$ = ListBuilderStart($1); }
    | asmdebug_exprlist_continue ',' asmdebug_expritem
-     { $$ = AddToList($1, $3); }
+     { $$ = ListBuilderAdd($1, $3); }
    ;
 
 asmdebug_expritem_first:
@@ -1024,9 +1042,9 @@ asmdebug_expritem:
 
 multiassign:
   lhsseq SP_ASSIGN '(' exprlist ')'
-    { $$ = AstAssignList($1, $4, $2); }
+    { $$ = AstAssignList($1, $4.head, $2); }
   | lhsseq SP_ASSIGN exprlist
-    { $$ = AstAssignList($1, $3, $2); }
+    { $$ = AstAssignList($1, $3.head, $2); }
 
 compoundstmt:
    ifstmt
@@ -1041,7 +1059,7 @@ compoundstmt:
 
 stmtblock:
   SP_INDENT stmtlist SP_OUTDENT
-  { $$ = $2; }
+  { $$ = $2.head; }
   | SP_INDENT SP_OUTDENT
   { $$ = NULL; }
 ;
@@ -1066,16 +1084,16 @@ elseblock:
 
 casestmt:
   SP_CASE expr SP_EOLN SP_INDENT casematchlist SP_OUTDENT
-    { $$ = NewCommentedAST(AST_CASE, $2, $5, $1); }
+    { $$ = NewCommentedAST(AST_CASE, $2, $5.head, $1); }
   | SP_CASE_FAST expr SP_EOLN SP_INDENT casematchlist SP_OUTDENT
-    { $$ = NewCommentedAST(AST_CASETABLE, $2, $5, $1); }
+    { $$ = NewCommentedAST(AST_CASETABLE, $2, $5.head, $1); }
 ;
 
 casematchlist:
   casematchitem
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | casematchlist casematchitem
-    { $$ = AddToList($1, $2); }
+    { $$ = ListBuilderAdd($1, $2); }
   ;
 
 casematchitem:
@@ -1099,15 +1117,16 @@ casematchitem:
 casematch:
   matchexprlist ':'
   {
-      $$ = $1;
+      $$ = $1.head;
       EstablishIndent(current->Lptr, -1);
       resetLineState(current->Lptr);
   }
 
 matchexprlist:
   matchexpritem
+    { $$ = ListBuilderStart($1); }
   | matchexprlist ',' matchexpritem
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   ;
 
 matchexpritem:
@@ -1129,8 +1148,9 @@ rangeexpritem:
 
 rangeexprlist:
   rangeexpritem
+    { $$ = ListBuilderStart($1); }
   | rangeexprlist ',' rangeexpritem
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   ;
 
 repeatstmt:
@@ -1228,31 +1248,31 @@ repeatstmt:
 
 lookupexpr:
 SP_LOOKUPZ '(' expr SP_LOOK_SEP rangeexprlist ')'
-    { $$ = AstLookup(AST_LOOKUP, 0, $3, $5); }
+    { $$ = AstLookup(AST_LOOKUP, 0, $3, $5.head); }
   | SP_LOOKUP '(' expr SP_LOOK_SEP rangeexprlist ')'
-    { $$ = AstLookup(AST_LOOKUP, 1, $3, $5); }
+    { $$ = AstLookup(AST_LOOKUP, 1, $3, $5.head); }
 ;
 lookdownexpr:
   SP_LOOKDOWNZ '(' expr SP_LOOK_SEP rangeexprlist ')'
-    { $$ = AstLookup(AST_LOOKDOWN, 0, $3, $5); }
+    { $$ = AstLookup(AST_LOOKDOWN, 0, $3, $5.head); }
   | SP_LOOKDOWN '(' expr SP_LOOK_SEP rangeexprlist ')'
-    { $$ = AstLookup(AST_LOOKDOWN, 1, $3, $5); }
+    { $$ = AstLookup(AST_LOOKDOWN, 1, $3, $5.head); }
 ;
 
 conblock:
   conline
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | conblock conline
-  { $$ = AddToList($1, $2); }
+  { $$ = ListBuilderAdd($1, $2); }
   ;
 
 conline:
   enumlist SP_EOLN
-    { $$ = $1; }
+    { $$ = $1.head; }
   | SP_IDENTIFIER '(' structlist ')' SP_EOLN
     {
         /* basically an inline object definition */
-        AST *defs = $3;
+        AST *defs = $3.head;
         AST *name = $1;
         SpinDeclareStruct(name, defs);
         $$ = NULL;
@@ -1260,7 +1280,7 @@ conline:
   | SP_INTERFACE SP_IDENTIFIER '(' ifacelist ')' SP_EOLN
     {
         /* basically an inline object definition */
-        AST *defs = $4;
+        AST *defs = $4.head;
         AST *name = $2;
         SpinDeclareInterface(name, defs);
         $$ = NULL;
@@ -1268,7 +1288,7 @@ conline:
   | SP_STRUCT SP_IDENTIFIER '(' structlist ')' SP_EOLN
     {
         /* basically an inline object definition */
-        AST *defs = $4;
+        AST *defs = $4.head;
         AST *name = $2;
         SpinDeclareStruct(name, defs);
         $$ = NULL;
@@ -1314,11 +1334,11 @@ conline:
 
 structlist:
   structitem
-    { $$ = CommentedListHolder($1); }
+    { $$ = ListBuilderStart(CommentedListHolder($1)); }
   | structlist ',' structitem
-    { $$ = AddToList($1, CommentedListHolder($3)); }
+    { $$ = ListBuilderAdd($1, CommentedListHolder($3)); }
   | structlist ',' SP_EOLN structitem
-    { $$ = AddToList($1, CommentedListHolder($4)); }
+    { $$ = ListBuilderAdd($1, CommentedListHolder($4)); }
 ;
 
 optarray:
@@ -1357,9 +1377,9 @@ structitem:
 
 ifacelist:
   ifaceitem
-    { $$ = CommentedListHolder($1); }
+    { $$ = ListBuilderStart(CommentedListHolder($1)); }
   | ifacelist ifaceitem
-    { $$ = AddToList($1, CommentedListHolder($2)); }
+    { $$ = ListBuilderAdd($1, CommentedListHolder($2)); }
 ;
 
 ifaceitem:
@@ -1371,12 +1391,12 @@ ifaceitem:
 
 enumlist:
   enumitem
-    { $$ = CommentedListHolder($1); }
+    { $$ = ListBuilderStart(CommentedListHolder($1)); }
   | enumlist ',' enumitem
     {
         AST *item = $3;
         if (item) {
-            $$ = AddToList($1, CommentedListHolder($3));
+            $$ = ListBuilderAdd($1, CommentedListHolder($3));
         }
     }
   ;
@@ -1454,35 +1474,35 @@ basedatline:
   | SP_BYTE SP_EOLN
     { $$ = NewCommentedAST(AST_BYTELIST, NULL, NULL, $1); }
   | SP_BYTE datexprlist SP_EOLN
-    { $$ = NewCommentedAST(AST_BYTELIST, FixupList($2), NULL, $1); }
+    { $$ = NewCommentedAST(AST_BYTELIST, FixupList($2.head), NULL, $1); }
   | SP_WORD SP_EOLN
     { $$ = NewCommentedAST(AST_WORDLIST, NULL, NULL, $1); }
   | SP_WORD datexprlist SP_EOLN
-    { $$ = NewCommentedAST(AST_WORDLIST, FixupList($2), NULL, $1); }
+    { $$ = NewCommentedAST(AST_WORDLIST, FixupList($2.head), NULL, $1); }
   | SP_BYTEFIT SP_EOLN
     { $$ = NewCommentedAST(AST_BYTELIST, NULL, NULL, $1); }
   | SP_BYTEFIT datexprlist SP_EOLN
     {
-        $$ = NewCommentedAST(AST_BYTEFITLIST, FixupList($2), NULL, $1);
+        $$ = NewCommentedAST(AST_BYTEFITLIST, FixupList($2.head), NULL, $1);
     }
   | SP_WORDFIT SP_EOLN
     {
         $$ = NewCommentedAST(AST_WORDLIST, NULL, NULL, $1);
     }
   | SP_WORDFIT datexprlist SP_EOLN
-    { $$ = NewCommentedAST(AST_WORDFITLIST, FixupList($2), NULL, $1); }
+    { $$ = NewCommentedAST(AST_WORDFITLIST, FixupList($2.head), NULL, $1); }
   | SP_LONG SP_EOLN
     { $$ = NewCommentedAST(AST_LONGLIST, NULL, NULL, $1); }
   | SP_LONG datexprlist SP_EOLN
-    { $$ = NewCommentedAST(AST_LONGLIST, FixupList($2), NULL, $1); }
+    { $$ = NewCommentedAST(AST_LONGLIST, FixupList($2.head), NULL, $1); }
   | instruction SP_EOLN
     { $$ = NewCommentedInstr($1); }
   | instruction operandlist SP_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction modifierlist SP_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, $2)); }
+    { $$ = NewCommentedInstr(AddToList($1, $2.head)); }
   | instruction operandlist modifierlist SP_EOLN
-    { $$ = NewCommentedInstr(AddToList($1, AddToList($2, $3))); }
+    { $$ = NewCommentedInstr(AddToList($1, ListBuilderAdd($2, $3.head).head)); }
   | SP_ASM_IF expr SP_EOLN
     {
         $$ = NewCommentedAST(AST_ASM_IF, $2, NULL, $1);
@@ -1608,9 +1628,9 @@ optidentifier:
 
 objblock:
   objline
-  { $$ = $1; }
+  { $$ = ListBuilderStart($1); }
   | objblock objline
-  { $$ = AddToList($1, $2); }
+  { $$ = ListBuilderAdd($1, $2); }
 ;
 
 objline:
@@ -1665,14 +1685,14 @@ optobjparams:
     /* empty */
       { $$ = NULL; }
   | '|' objparams
-      { $$ = $2; }
+      { $$ = $2.head; }
 ;
 
 objparams:
   objparamitem
-    { $$ = CommentedListHolder($1); }
+    { $$ = ListBuilderStart(CommentedListHolder($1)); }
   | objparams ',' objparamitem
-    { $$ = AddToList($1, CommentedListHolder($3)); }
+    { $$ = ListBuilderAdd($1, CommentedListHolder($3)); }
 ;
 objparamitem:
   identifier '=' expr
@@ -1685,22 +1705,22 @@ objparamitem:
 ;
 varblock:
     varline
-    { $$ = CommentedListHolder($1); }
+    { $$ = ListBuilderStart(CommentedListHolder($1)); }
   | varblock varline
-    { $$ = AddToList($1, CommentedListHolder($2)); }
+    { $$ = ListBuilderAdd($1, CommentedListHolder($2)); }
   ;
 
 varline:
   SP_BYTE identlist SP_EOLN
-    { $$ = NewAST(AST_BYTELIST, $2, NULL); }
+    { $$ = NewAST(AST_BYTELIST, $2.head, NULL); }
   | SP_WORD identlist SP_EOLN
-    { $$ = NewAST(AST_WORDLIST, $2, NULL); }
+    { $$ = NewAST(AST_WORDLIST, $2.head, NULL); }
   | SP_LONG identlist SP_EOLN
-    { $$ = NewAST(AST_LONGLIST, $2, NULL); }
+    { $$ = NewAST(AST_LONGLIST, $2.head, NULL); }
   | ptrstructname identlist SP_EOLN
     {
         AST *typ = $1;
-        AST *decllist = $2;
+        AST *decllist = $2.head;
         AST *def = NewAST(AST_DECLARE_VAR, typ, decllist);
         $$ = def; // NewAST(AST_LISTHOLDER, def, NULL);
     }
@@ -1721,12 +1741,12 @@ varline:
 
 identlist:
   identdecl
-  { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+  { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
   | annotation identdecl
-  { $$ = AddToList(NewAST(AST_LISTHOLDER, $1, NULL),
-                   NewAST(AST_LISTHOLDER, $2, NULL)); }
+  { $$ = ListBuilderAdd(ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)),
+                        NewAST(AST_LISTHOLDER, $2, NULL)); }
   | identlist ',' identdecl
-  { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+  { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
   ;
 
 identdecl:
@@ -1773,9 +1793,9 @@ vardecl:
 
 vardecllist:
    vardecl
-      { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+      { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
    | vardecllist ',' vardecl
-      { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+      { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
    ;
 
 general_type:
@@ -1886,14 +1906,14 @@ paramidentdecl:
 
 paramidentlist:
   paramidentdecl
-    { $$ = NewAST(AST_LISTHOLDER, $1, NULL); }
+    { $$ = ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)); }
   | annotation paramidentdecl
-    { $$ = AddToList(NewAST(AST_LISTHOLDER, $1, NULL),
-                   NewAST(AST_LISTHOLDER, $2, NULL)); }
+    { $$ = ListBuilderAdd(ListBuilderStart(NewAST(AST_LISTHOLDER, $1, NULL)),
+                          NewAST(AST_LISTHOLDER, $2, NULL)); }
   | paramidentlist ',' paramidentdecl
-    { $$ = AddToList($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
+    { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, $3, NULL)); }
   | paramidentlist ',' SP_VARARGS
-    { $$ = AddToList($1, NewAST(AST_LISTHOLDER, NewAST(AST_VARARGS, NULL, NULL),
+    { $$ = ListBuilderAdd($1, NewAST(AST_LISTHOLDER, NewAST(AST_VARARGS, NULL, NULL),
                               NULL)); }
   ;
 
@@ -1903,31 +1923,31 @@ expr:
   | string
   | SP_STRINGPTR '(' exprlist ')'
     {
-        AST *elist = $3;
+        AST *elist = $3.head;
         $$ = NewAST(AST_STRINGPTR, elist, NULL);
     }
   | SP_LSTRING '(' exprlist ')'
     {
-        AST *elist = $3;
+        AST *elist = $3.head;
         AST *ptr = NewAST(AST_STRINGPTR, elist, NULL);
         ptr->d.ival = 1;
         $$ = ptr;
     }
   | SP_BYTES '(' datexprlist ')'
     {
-        AST *datlist = $3;
+        AST *datlist = $3.head;
         datlist = NewAST(AST_BYTELIST, datlist, NULL);
         $$ = SpinAddDatList(datlist);
     }
   | SP_WORDS '(' datexprlist ')'
     {
-        AST *datlist = $3;
+        AST *datlist = $3.head;
         datlist = NewAST(AST_WORDLIST, datlist, NULL);
         $$ = SpinAddDatList(datlist);
     }
   | SP_LONGS '(' datexprlist ')'
     {
-        AST *datlist = $3;
+        AST *datlist = $3.head;
         datlist = NewAST(AST_LONGLIST, datlist, NULL);
         $$ = SpinAddDatList(datlist);
     }
@@ -2479,13 +2499,13 @@ lhs: identifier
 lhsseq:
   '(' lhssingle ',' lhsseqcont ')'
     {
-        AST *list = $4;
+        AST *list = $4.head;
         AST *item = $2;
         $$ = NewAST(AST_EXPRLIST, item, list);
     }
   | lhssingle ',' lhsseqcont
     {
-        AST *list = $3;
+        AST *list = $3.head;
         AST *item = $1;
         $$ = NewAST(AST_EXPRLIST, item, list);
     }
@@ -2495,13 +2515,12 @@ lhsseqcont:
   lhssingle
     {
         AST *item = NewAST(AST_EXPRLIST, $1, NULL);
-        $$ = item;
+        $$ = ListBuilderStart(item);
     }
   | lhsseqcont ',' lhssingle
     {
-        AST *list = $1;
         AST *item = NewAST(AST_EXPRLIST, $3, NULL);
-        $$ = AddToList(list, item);
+        $$ = ListBuilderAdd($1, item);
     }
 ;
 
@@ -2543,7 +2562,7 @@ opt_numrets:
 
 funccall:
   lhs '(' exprlist ')' opt_numrets
-    { $$ = MakeFunccall($1, FixupList($3), $5); }
+    { $$ = MakeFunccall($1, FixupList($3.head), $5); }
   | lhs '(' ')' opt_numrets
     {
         $$ = MakeFunccall($1, NULL, $4);
@@ -2588,14 +2607,14 @@ funccall:
     }
   | SP_COGINIT '(' exprlist ')'
     {
-        $$ = NewAST(AST_COGINIT, FixupList($3), NULL);
+        $$ = NewAST(AST_COGINIT, FixupList($3.head), NULL);
     }
   | SP_COGNEW '(' exprlist ')'
     {
         AST *elist;
         AST *immval = AstInteger(0x1e); // works to cognew both P1 and P2
         elist = NewAST(AST_EXPRLIST, immval, NULL);
-        elist = AddToList(elist, $3);
+        elist = AddToList(elist, $3.head);
         elist = FixupList(elist);
         $$ = NewAST(AST_COGINIT, elist, NULL);
         LANGUAGE_WARNING(LANG_SPIN_SPIN2, NULL, "cognew support in Spin2 is a flexspin extension");
@@ -2624,7 +2643,7 @@ funccall:
     }
   | SP_TASKINIT '(' exprlist ')'
     {
-        $$ = NewAST(AST_TASKINIT, FixupList($3), NULL);
+        $$ = NewAST(AST_TASKINIT, FixupList($3.head), NULL);
     }
   | SP_TASKHLT
     {
@@ -2776,7 +2795,7 @@ funccall:
     }
   | SP_MOVBYTS '(' operandlist ')'
     {
-        AST *args = $3;
+        AST *args = $3.head;
         AST *ident = AstIdentifier("__builtin_movbyts");
         
         $$ = MakeFunccall(ident, args, NULL);
@@ -2815,8 +2834,9 @@ expritem:
 
 exprlist:
   expritem
+   { $$ = ListBuilderStart($1); }
  | exprlist ',' expritem
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 datexpritem:
@@ -2849,8 +2869,9 @@ datexpritem:
 
 datexprlist:
   datexpritem
+   { $$ = ListBuilderStart($1); }
  | datexprlist ',' datexpritem
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 optcatch:
@@ -2892,9 +2913,9 @@ operand:
 
 operandlist:
    operand
-   { $$ = $1; }
+   { $$ = ListBuilderStart($1); }
  | operandlist ',' operand
-   { $$ = AddToList($1, $3); }
+   { $$ = ListBuilderAdd($1, $3); }
  ;
 
 range:
@@ -2970,11 +2991,11 @@ instrmodifier:
 
 modifierlist:
   instrmodifier
-    { $$ = $1; }
+    { $$ = ListBuilderStart($1); }
   | modifierlist instrmodifier
-    { $$ = AddToList($1, $2); }
+    { $$ = ListBuilderAdd($1, $2); }
   | modifierlist ',' instrmodifier
-    { $$ = AddToList($1, $3); }
+    { $$ = ListBuilderAdd($1, $3); }
   ;
 
 structname:
@@ -658,6 +658,36 @@ PlaceAssignAfter(AST *parent, AST *assign)
     return false;
 }
 
+/*
+ * check whether "expr" uses a variable (other than basename) that is
+ * assigned inside the loop and whose assignment has not already been
+ * pulled out in front of it; such an expression cannot be evaluated
+ * before the loop starts
+ */
+static bool
+UsesLoopAssignment(LoopValueSet *lvs, LoopValueEntry *self, AST *expr, AST *basename)
+{
+    LoopValueEntry *entry;
+
+    for (entry = lvs->head; entry; entry = entry->next) {
+        if (entry == self || !entry->value) {
+            continue;
+        }
+        if (AstMatchName(entry->name, basename)) {
+            continue;
+        }
+        if (!AstUsesName(expr, entry->name)) {
+            continue;
+        }
+        // pulled out statements have had their parent's left nulled
+        if (entry->parent && entry->parent->left == NULL) {
+            continue;
+        }
+        return true;
+    }
+    return false;
+}
+
 /*
  * actually perform loop strength reduction on a single loop body
  * "initial" is a loop value set holding potential initial values for
@@ -732,6 +762,11 @@ doLoopStrengthReduction(LoopValueSet *initial, AST *body, AST *condition, AST *u
             if (entry->flags & LVFLAG_CONDITIONAL) {
                 continue;
             }
+            // if the value needs something computed inside the loop,
+            // its initial value is not known before the loop
+            if (UsesLoopAssignment(&lv, entry, entry->value, entry->basename)) {
+                continue;
+            }
             pullvalue = DupASTWithReplace(entry->value, entry->basename, initEntry->value);
             if (entry->loopstep->kind == AST_OPERATOR && entry->loopstep->d.ival == K_NEGATE) {
                 replace = AstAssign(entry->name,
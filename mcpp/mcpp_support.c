@@ -160,7 +160,9 @@ void    mcpp_use_mem_buffers(
 }
 
 #define BUF_INCR_SIZE   (NWORK * 2)
+#define BUF_INCR_MAX    (64 * 1024 * 1024)
 #define MAX( a, b)      (((a) > (b)) ? (a) : (b))
+#define MIN( a, b)      (((a) < (b)) ? (a) : (b))
 
 static char *   append_to_buffer(
     MEMBUF *    mem_buf_p,
@@ -169,7 +171,11 @@ static char *   append_to_buffer(
 )
 {
     if (mem_buf_p->bytes_avail < length + 1) {  /* Need to allocate more memory */
-        size_t size = MAX( BUF_INCR_SIZE, length);
+        /* Double the buffer (within limits) so that the total   */
+        /* copying done by xrealloc() stays linear              */
+        size_t size = MAX( BUF_INCR_SIZE, MIN( mem_buf_p->size, BUF_INCR_MAX));
+
+        size = MAX( size, length + 1);
 
         if (mem_buf_p->buffer == NULL) {            /* 1st append   */
             mem_buf_p->size = size;
@@ -179,6 +179,10 @@ static void     do_once( const char * fullname);
                 /* Process #pragma once             */
 static int      included( const char * fullname);
                 /* The file has been once included? */
+static int      guarded( const char * fullname);
+                /* The file's include guard is defined? */
+static char *   scan_guard( const char * fullname);
+                /* Find the include guard macro of the file */
 static void     push_or_pop( int direction);
                 /* Push or pop a macro definition   */
 static void     do_preprocessed( void);
@@ -226,6 +230,24 @@ static INC_LIST *   once_list;          /* Once opened file         */
 static INC_LIST *   once_end;           /* -> active end of once_list   */
 static int          max_once;           /* Number of once_list[]    */
 
+/*
+ * guard_table[] remembers the include guard macro of every header opened so
+ * far, or NULL if the header has none.  A header is scanned only when it is
+ * included for the second time, so that headers included just once cost
+ * nothing.  The table lives for the whole process (it is not freed by
+ * clear_filelist()), so each header is scanned at most once even though
+ * mcpp is restarted for every translation unit.
+ */
+typedef struct guard_list {
+    struct guard_list * link;           /* Next entry in the chain  */
+    char *      fname;                  /* Full-path-list of header */
+    char *      guard;                  /* Guard macro or NULL      */
+    int         scanned;                /* guard has been looked for    */
+} GUARD_LIST;
+
+#define GUARD_HASH          256         /* Number of guard_table[] chains   */
+static GUARD_LIST * guard_table[ GUARD_HASH];
+
 #define INIT_NUM_INCLUDE    32          /* Initial number of incdir[]   */
 #define INIT_NUM_FNAMELIST  256         /* Initial number of fnamelist[]    */
 #define INIT_NUM_ONCE       64          /* Initial number of once_list[]    */
@@ -1764,6 +1786,10 @@ static int  open_file(
         return  FALSE;
     if (included( fullname))        /* Once included    */
         goto  true_case;
+    if (guarded( fullname)) {       /* Guard already defined    */
+        free( fullname);
+        goto  true_case;
+    }
 
     if ((max_open != 0 && max_open <= include_nest)
                             /* Exceed the known limit of open files */
@@ -2314,6 +2340,258 @@ static int  included(
     return  FALSE;                          /* Not yet included     */
 }
 
+static int  guarded(
+    const char *    fullname
+)
+/*
+ * Is the header wrapped in an include guard which is already defined ?
+ * Then including it again would produce nothing, and the file need not be
+ * opened at all.  The guard of each header is found by scan_guard() and
+ * remembered in guard_table[].
+ * This routine is only called from open_file().
+ */
+{
+    GUARD_LIST *    gp;
+    const char *    cp;
+    size_t      hash = 0;
+    int         c;
+
+    for (cp = fullname; *cp; cp++) {
+        c = *cp & UCHARMAX;             /* Fold case as str_case_eq()   */
+        if (c >= 'A' && c <= 'Z')       /*  might do                    */
+            c += 'a' - 'A';
+        hash = hash * 31 + c;
+    }
+    hash %= GUARD_HASH;
+    for (gp = guard_table[ hash]; gp != NULL; gp = gp->link) {
+        if (str_case_eq( gp->fname, fullname))
+            break;
+    }
+    if (gp == NULL) {                       /* First time to see it */
+        gp = (GUARD_LIST *) xmalloc( sizeof (GUARD_LIST));
+        gp->fname = save_string( fullname);
+        gp->guard = NULL;
+        gp->scanned = FALSE;
+        gp->link = guard_table[ hash];
+        guard_table[ hash] = gp;
+        return  FALSE;
+    }
+    if (! gp->scanned) {                    /* Included again       */
+        gp->guard = scan_guard( fullname);
+        gp->scanned = TRUE;
+        if ((mcpp_debug & PATH) && gp->guard)
+            mcpp_fprintf( DBG, "Include guard of \"%s\" is %s\n"
+                    , fullname, gp->guard);
+    }
+    if (gp->guard == NULL || look_id( gp->guard) == NULL)
+        return  FALSE;
+    if (mcpp_debug & PATH)
+        mcpp_fprintf( DBG, "Guarded by %s \"%s\"\n", gp->guard, fullname);
+    return  TRUE;
+}
+
+static const char * guard_skip_space(
+    const char *    cp,
+    const char *    end,
+    int         newline             /* Skip newlines too    */
+)
+/*
+ * Skip white spaces, comments and <backslash><newline> sequences for
+ * scan_guard().
+ */
+{
+    while (cp < end) {
+        if (*cp == ' ' || *cp == '\t' || *cp == '\f' || *cp == '\v'
+                || *cp == '\r' || (newline && *cp == '\n')) {
+            cp++;
+        } else if (*cp == '\\' && cp + 1 < end && cp[ 1] == '\n') {
+            cp += 2;
+        } else if (*cp == '\\' && cp + 2 < end && cp[ 1] == '\r'
+                && cp[ 2] == '\n') {
+            cp += 3;
+        } else if (*cp == '/' && cp + 1 < end && cp[ 1] == '*') {
+            for (cp += 2; cp < end; cp++) {
+                if (*cp == '*' && cp + 1 < end && cp[ 1] == '/')
+                    break;
+            }
+            if (cp >= end)                  /* Unterminated comment */
+                return  end;
+            cp += 2;
+        } else if (*cp == '/' && cp + 1 < end && cp[ 1] == '/') {
+            while (cp < end && *cp != '\n')
+                cp++;
+        } else {
+            break;
+        }
+    }
+    return  cp;
+}
+
+static const char * guard_skip_line(
+    const char *    cp,
+    const char *    end
+)
+/*
+ * Skip the rest of the logical line, stepping over string literals and
+ * character constants so that a comment opener in quotes is not taken
+ * as a comment.
+ * Returns a pointer to the terminating newline.
+ */
+{
+    int         delim;
+
+    while ((cp = guard_skip_space( cp, end, FALSE)) < end && *cp != '\n') {
+        if (*cp == '"' || *cp == '\'') {
+            delim = *cp++;
+            while (cp < end && *cp != delim && *cp != '\n') {
+                if (*cp == '\\' && cp + 1 < end)
+                    cp++;
+                cp++;
+            }
+            if (cp < end && *cp == delim)
+                cp++;
+        } else {
+            cp++;
+        }
+    }
+    return  cp;
+}
+
+static const char * guard_ident(
+    const char *    cp,
+    const char *    end,
+    const char **   idp,                /* Start of the identifier  */
+    size_t *    lenp                    /* Length, 0 if none        */
+)
+/*
+ * Read an identifier (or directive name) for scan_guard().
+ */
+{
+    *idp = cp;
+    while (cp < end && ((*cp >= 'a' && *cp <= 'z') || (*cp >= 'A' && *cp <= 'Z')
+            || (*cp >= '0' && *cp <= '9') || *cp == '_' || *cp == '$'))
+        cp++;
+    *lenp = cp - *idp;
+    return  cp;
+}
+
+static int  guard_eq(
+    const char *    id,
+    size_t      len,
+    const char *    name
+)
+{
+    return  len == strlen( name) && memcmp( id, name, len) == 0;
+}
+
+static char *   scan_guard(
+    const char *    fullname
+)
+/*
+ * Find the include guard macro of the header, that is the X of
+ *      #ifndef X   (or  #if ! defined X  or  #if ! defined( X))
+ *      ...
+ *      #endif
+ * when nothing but white spaces and comments are outside of the group and
+ * the group has no #else nor #elif.  Returns the malloced name of the
+ * macro, or NULL if the header is not guarded in this way.
+ */
+{
+    FILE *      fp;
+    char *      buf;
+    char *      guard = NULL;
+    const char *    cp;
+    const char *    end;
+    const char *    id;
+    size_t      len;
+    long        size;
+    int         depth = 0;              /* Nesting of #if groups    */
+    int         paren;
+
+    if ((fp = mcpp_fopen( fullname, "rb")) == NULL)
+        return  NULL;
+    if (fseek( fp, 0L, SEEK_END) != 0 || (size = ftell( fp)) < 0
+            || fseek( fp, 0L, SEEK_SET) != 0) {
+        fclose( fp);
+        return  NULL;
+    }
+    buf = xmalloc( (size_t) size + 1);
+    size = (long) fread( buf, 1, (size_t) size, fp);
+    fclose( fp);
+    end = buf + size;
+
+    for (cp = buf; (cp = guard_skip_space( cp, end, TRUE)) < end;
+            cp = guard_skip_line( cp, end)) {
+        if (*cp != '#') {                   /* Text line            */
+            if (depth == 0)                 /* Outside of the guard */
+                goto  not_guarded;
+            continue;
+        }
+        cp = guard_ident( guard_skip_space( cp + 1, end, FALSE), end
+                , &id, &len);
+        if (len == 0) {                     /* Null directive ?     */
+            if (depth == 0 && (cp = guard_skip_space( cp, end, FALSE)) < end
+                    && *cp != '\n')
+                goto  not_guarded;
+            continue;
+        }
+        if (depth == 0) {
+            if (guard)                      /* After the #endif     */
+                goto  not_guarded;
+            if (guard_eq( id, len, "ifndef")) {
+                cp = guard_ident( guard_skip_space( cp, end, FALSE), end
+                        , &id, &len);
+            } else if (guard_eq( id, len, "if")) {
+                cp = guard_skip_space( cp, end, FALSE);
+                if (cp >= end || *cp != '!')
+                    goto  not_guarded;
+                cp = guard_ident( guard_skip_space( cp + 1, end, FALSE), end
+                        , &id, &len);
+                if (! guard_eq( id, len, "defined"))
+                    goto  not_guarded;
+                cp = guard_skip_space( cp, end, FALSE);
+                paren = (cp < end && *cp == '(');
+                if (paren)
+                    cp = guard_skip_space( cp + 1, end, FALSE);
+                cp = guard_ident( cp, end, &id, &len);
+                if (paren) {
+                    cp = guard_skip_space( cp, end, FALSE);
+                    if (cp >= end || *cp != ')')
+                        goto  not_guarded;
+                    cp++;
+                }
+            } else {
+                goto  not_guarded;
+            }
+            if (len == 0 || ((cp = guard_skip_space( cp, end, FALSE)) < end
+                    && *cp != '\n'))
+                goto  not_guarded;
+            guard = xmalloc( len + 1);
+            memcpy( guard, id, len);
+            guard[ len] = EOS;
+            depth = 1;
+        } else if (guard_eq( id, len, "if") || guard_eq( id, len, "ifdef")
+                || guard_eq( id, len, "ifndef")) {
+            depth++;
+        } else if (guard_eq( id, len, "endif")) {
+            depth--;
+        } else if (depth == 1 && (guard_eq( id, len, "else")
+                || guard_eq( id, len, "elif")
+                || guard_eq( id, len, "elifdef")
+                || guard_eq( id, len, "elifndef"))) {
+            goto  not_guarded;
+        }
+    }
+    if (guard && depth == 0) {
+        free( buf);
+        return  guard;
+    }
+not_guarded:
+    free( guard);
+    free( buf);
+    return  NULL;
+}
+
 static void push_or_pop(
     int     direction
 )
@@ -93,15 +93,42 @@ fopen_fileonly(const char *name, const char *mode) {
 // forward declaration
 static void doerror(struct preprocess *pp, const char *msg, ...);
 
+/*
+ * fetch the next byte from a file state, which may be
+ * backed either by a FILE or by an in-memory string
+ */
+static int
+pp_getc(struct filestate *A)
+{
+    if (A->str) {
+        if (A->strend ? (A->str == A->strend) : (*A->str == 0))
+            return EOF;
+        return (unsigned char)*A->str++;
+    }
+    return fgetc(A->f);
+}
+
+static void
+pp_ungetc(int c, struct filestate *A)
+{
+    if (c == EOF)
+        return;
+    if (A->str) {
+        --A->str;
+    } else {
+        ungetc(c, A->f);
+    }
+}
+
 /*
  * function to read a single LATIN-1 character
  * from a file
  * returns number of bytes placed in buffer, or -1 on EOF
  */
 static int
-read_latin1(FILE *f, char buf[4])
+read_latin1(struct filestate *A, char buf[4])
 {
-  int c = fgetc(f);
+  int c = pp_getc(A);
   if (c == EOF)
     return -1;
   if (c <= 127) {
@@ -119,9 +146,9 @@ read_latin1(FILE *f, char buf[4])
  * returns number of bytes placed in buffer, or -1 on EOF
  */
 static int
-read_single(FILE *f, char buf[4])
+read_single(struct filestate *A, char buf[4])
 {
-    int c = fgetc(f);
+    int c = pp_getc(A);
     if (c == EOF)
         return -1;
     buf[0] = (char)c;
@@ -134,14 +161,14 @@ read_single(FILE *f, char buf[4])
  * returns number of bytes placed in buffer, or -1 on EOF
  */
 static int
-read_utf16(FILE *f, char buf[4])
+read_utf16(struct filestate *A, char buf[4])
 {
     int c, d;
     int r;
-    c = fgetc(f);
+    c = pp_getc(A);
     if (c < 0)
         return -1;
-    d = fgetc(f);
+    d = pp_getc(A);
     if (d < 0)
         return -1;
 
@@ -192,7 +219,6 @@ pp_nextline(struct preprocess *pp)
 {
     int r;
     int count = 0;
-    FILE *f;
     char buf[4];
     char *full_line;
     struct filestate *A;
@@ -200,26 +226,25 @@ pp_nextline(struct preprocess *pp)
     A = pp->fil;
     if (!A)
         return 0;
-    f = A->f;
 
     flexbuf_clear(&pp->line);
     if (A->readfunc == NULL) {
         int c0, c1;
-        c0 = fgetc(f);
+        c0 = pp_getc(A);
         if (c0 < 0) return 0;
 	if (c0 == 0xef) {
 	    A->readfunc = read_single;
-	    c1 = fgetc(f);
+	    c1 = pp_getc(A);
 	    if (c1 == 0xbb) {
-	        c1 = fgetc(f);
+	        c1 = pp_getc(A);
 		if (c1 == 0xbf) {
 		  /* discard the byte order mark */
 		} else {
-		  ungetc(c1, f);
-		  ungetc(0xbb, f);
+		  pp_ungetc(c1, A);
+		  pp_ungetc(0xbb, A);
 		}
 	    } else {
-	        ungetc(c1, f);
+	        pp_ungetc(c1, A);
 	    }
 	} else
         if (c0 != 0xff) {
@@ -230,13 +255,13 @@ pp_nextline(struct preprocess *pp)
 	    }
             flexbuf_addchar(&pp->line, c0);
         } else {
-            c1 = fgetc(f);
+            c1 = pp_getc(A);
             if (c1 == 0xfe) {
                 A->readfunc = read_utf16;
             } else {
                 A->readfunc = read_single;
                 flexbuf_addchar(&pp->line, c0);
-                ungetc(c1, f);
+                pp_ungetc(c1, A);
             }
         }
         A->skipnl = 0;
@@ -247,7 +272,20 @@ pp_nextline(struct preprocess *pp)
         }
     }
     for(;;) {
-        r = (*A->readfunc)(f, buf);
+        if (A->strend && A->readfunc == read_single) {
+            /* file is in memory: copy ordinary characters in one go */
+            const char *s = A->str;
+            while (s < A->strend && *s != '\n' && *s != '\r') {
+                s++;
+            }
+            if (s != A->str) {
+                flexbuf_addmem(&pp->line, A->str, s - A->str);
+                count += s - A->str;
+                A->str = s;
+                A->skipnl = 0;
+            }
+        }
+        r = (*A->readfunc)(A, buf);
         if (r <= 0) break;
         if (buf[0] == '\n' && A->skipnl) {
             A->skipnl = 0;
@@ -421,18 +459,66 @@ pp_push_file_struct(struct preprocess *pp, FILE *f, const char *filename)
     }
 }
 
+/*
+ * read all of a file into memory; this is much faster than
+ * going through it one fgetc at a time
+ * returns NULL on error
+ */
+static char *
+read_whole_file(FILE *f, size_t *lenp)
+{
+    size_t len = 0;
+    size_t size = 65536;
+    size_t n;
+    char *buf = (char *)malloc(size);
+    char *newbuf;
+
+    while (buf) {
+        n = fread(buf + len, 1, size - len, f);
+        len += n;
+        if (len < size) {
+            if (ferror(f)) {
+                free(buf);
+                return NULL;
+            }
+            break;
+        }
+        size *= 2;
+        newbuf = (char *)realloc(buf, size);
+        if (!newbuf) {
+            free(buf);
+        }
+        buf = newbuf;
+    }
+    *lenp = len;
+    return buf;
+}
+
 void
 pp_push_file(struct preprocess *pp, const char *name)
 {
     FILE *f;
+    char *buf;
+    size_t len;
 
     f = fopen_fileonly(name, "rb");
     if (!f) {
         doerror(pp, "Unable to open file %s", name);
         return;
     }
-    pp_push_file_struct(pp, f, name);
-    pp->fil->flags |= FILE_FLAGS_CLOSEFILE;
+    buf = read_whole_file(f, &len);
+    if (!buf) {
+        /* fall back to reading it a character at a time */
+        rewind(f);
+        pp_push_file_struct(pp, f, name);
+        pp->fil->flags |= FILE_FLAGS_CLOSEFILE;
+        return;
+    }
+    fclose(f);
+    pp_push_file_struct(pp, NULL, name);
+    pp->fil->buf = buf;
+    pp->fil->str = buf;
+    pp->fil->strend = buf + len;
 }
 
 /*
@@ -459,6 +545,7 @@ void pp_pop_file(struct preprocess *pp)
         pp->fil = A->next;
         if (A->flags & FILE_FLAGS_CLOSEFILE)
             fclose(A->f);
+        free(A->buf);
         free(A);
         A = pp->fil;
         if (A && A->name) {
@@ -477,10 +564,26 @@ void pp_pop_file(struct preprocess *pp)
  * "flags" indicates things like whether we must free the memory
  * associated with name and def
  */
+
+/*
+ * hash bucket for a definition; names are case folded so that the
+ * same table works whether or not pp->ignore_case is set
+ */
+static struct predef **
+pp_defbucket(struct preprocess *pp, const char *name)
+{
+    unsigned hash = 0;
+    while (*name) {
+        hash = hash * 31 + tolower((unsigned char)*name++);
+    }
+    return &pp->defhash[hash % PP_DEFINE_HASH_SIZE];
+}
+
 static void
 pp_define_internal(struct preprocess *pp, const char *name, const char *def, int flags)
 {
     struct predef *the;
+    struct predef **bucket;
 
     the = (struct predef *)calloc(sizeof(*the), 1);
     the->name = name;
@@ -488,6 +591,9 @@ pp_define_internal(struct preprocess *pp, const char *name, const char *def, int
     the->flags = flags;
     the->next = pp->defs;
     pp->defs = the;
+    bucket = pp_defbucket(pp, name);
+    the->hnext = *bucket;
+    *bucket = the;
 }
 
 /*
@@ -512,7 +618,7 @@ pp_getdef(struct preprocess *pp, const char *name)
     const char *def = NULL;
     int (*strcmp_func)(const char *a, const char *b);
     
-    X = pp->defs;
+    X = *pp_defbucket(pp, name);
     if (pp->ignore_case) {
         strcmp_func = strcasecmp;
     } else {
@@ -523,7 +629,7 @@ pp_getdef(struct preprocess *pp, const char *name)
             def = X->def;
             break;
         }
-        X = X->next;
+        X = X->hnext;
     }
     if (!def) {
         static char newdef[1024];
@@ -1337,11 +1443,15 @@ pp_restore_define_state(struct preprocess *pp, void *vp)
 {
     struct predef *where = (struct predef *)vp;
     struct predef *x, *old;
+    struct predef **prev;
 
     x = pp->defs;
     while (x && x != where) {
         old = x;
         x = old->next;
+        for (prev = pp_defbucket(pp, old->name); *prev != old; prev = &(*prev)->hnext)
+            ;
+        *prev = old->hnext;
         if (old->flags & PREDEF_FLAG_FREEDEFS)
         {
             free((void *)old->name);
@@ -1356,17 +1466,22 @@ void
 pp_define_weak_global(struct preprocess *pp, const char *name, const char *def)
 {
     struct predef *x, *the;
+    struct predef **prev;
     the = (struct predef *)calloc(sizeof(*the), 1);
     the->name = name;
     the->def = def;
     the->flags = 0;
     the->next = NULL;
+    the->hnext = NULL;
+    // postpend the definition, both in the hash bucket and the main list
+    for (prev = pp_defbucket(pp, name); *prev; prev = &(*prev)->hnext)
+        ;
+    *prev = the;
     if (!pp->defs) {
         pp->defs = the;
         return;
     }
     x = pp->defs;
-    // postpend the definition
     while (x->next) {
         x = x->next;
     }
@@ -14,6 +14,7 @@
 
 struct predef {
     struct predef *next;
+    struct predef *hnext; /* next definition in the same hash bucket */
     const char *name;
     const char *def;
     const char *argcdef; /* -Dname=def version, for passing to mcpp */
@@ -29,9 +30,12 @@ struct predef {
 struct filestate {
     struct filestate *next;
     FILE *f;
+    const char *str; /* if non-NULL, read from this string instead of f */
+    const char *strend; /* end of str, if it may contain 0 bytes */
+    char *buf;       /* file contents read into memory, freed with the filestate */
     const char *name;
     int lineno;
-    int (*readfunc)(FILE *f, char *buf);
+    int (*readfunc)(struct filestate *A, char *buf);
     int flags;
     int skipnl;
 };
@@ -46,11 +50,16 @@ struct ifstate {
     int sawelse;  /* if we have already processed a #else */
 };
 
+#define PP_DEFINE_HASH_SIZE 256
+
 struct preprocess {
     struct filestate *fil;
     struct flexbuf line;
     struct flexbuf whole;
     struct predef *defs;
+    /* the same definitions hashed by (case folded) name; each bucket
+       is in the same order as defs */
+    struct predef *defhash[PP_DEFINE_HASH_SIZE];
 
     struct ifstate *ifs;
 
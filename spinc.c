@@ -793,8 +793,9 @@ doParseFile(const char *name, Module *P, int *is_dup, AST *paramlist)
         doparse(language);
         free(parseString);
     } else {
-        fileToLex(NULL, f, fname, language);
+        parseString = fileToLex(NULL, f, fname, language);
         doparse(language);
+        free(parseString);
     }
     fclose(f);
 
@@ -13,11 +13,6 @@
 #include "frontends/common.h"
 #include "frontends/lexer.h"
 
-// definition for the Spin parser
-#define SPINYYSTYPE AST*
-#define BASICYYSTYPE AST*
-#define CGRAMYYSTYPE AST*
-
 extern Module *allparse;
 
 /* printing functions */
@@ -34,26 +34,38 @@ SymbolHash(const char *str)
 /* find a symbol in the table */
 //extern inline Symbol *FindSymbol(SymbolTable *table, const char *name);
 
-Symbol *
-FindSymbolEx(SymbolTable *table, const char *name,int forceCaseSens)
+/*
+ * like FindSymbolEx, but with the RawSymbolHash of name already known
+ *
+ * names are not interned, so a match still needs a string compare;
+ * lookup names come from all the frontends and backends and from
+ * names built on the fly, and Spin and BASIC compare them without
+ * regard to case, so every caller would have to intern (hash and
+ * compare) a case-folded copy first. Instead each symbol keeps its
+ * full hash, so nearly all mismatches are rejected without a compare,
+ * and a name that is the same pointer skips the compare altogether.
+ */
+static Symbol *
+FindSymbolHashed(SymbolTable *table, const char *name, unsigned hash, int forceCaseSens)
 {
-    unsigned hash;
     Symbol *sym;
     int nocase = ((table->flags & SYMTAB_FLAG_NOCASE) != 0) && !gl_caseSensitive;
     if (forceCaseSens) nocase = forceCaseSens < 0; // 1 forces case sensitive, -1 forces case insensitive
-    hash = SymbolHash(name);
-    sym = table->hash[hash];
+    if (!table->hashSize) {
+        return NULL;
+    }
+    sym = table->hash[hash & (table->hashSize - 1)];
 
     if (nocase) {
         while (sym) {
-            if (!strcasecmp(sym->our_name, name)) {
+            if (sym->hash == hash && !strcasecmp(sym->our_name, name)) {
                 return sym;
             }
             sym = sym->next;
         }
     } else {
         while (sym) {
-            if (!strcmp(sym->our_name, name)) {
+            if (sym->hash == hash && (sym->our_name == name || !strcmp(sym->our_name, name))) {
                 return sym;
             }
             sym = sym->next;
@@ -64,6 +76,12 @@ FindSymbolEx(SymbolTable *table, const char *name,int forceCaseSens)
     return NULL;
 }
 
+Symbol *
+FindSymbolEx(SymbolTable *table, const char *name,int forceCaseSens)
+{
+    return FindSymbolHashed(table, name, RawSymbolHash(name), forceCaseSens);
+}
+
 //
 // like FindSymbol, but goes back through previous contexts too
 //
@@ -71,10 +89,13 @@ Symbol *
 FindSymbolInContext(SymbolTable *table, const char *name)
 {
     Symbol *sym;
-    if (!table) return NULL;
-    sym = FindSymbolEx(table, name, 0);
-    if (sym) return sym;
-    return FindSymbolInContext(table->next, name);
+    unsigned hash = RawSymbolHash(name);
+
+    for (; table; table = table->next) {
+        sym = FindSymbolHashed(table, name, hash, 0);
+        if (sym) return sym;
+    }
+    return NULL;
 }
 
 /* find a symbol in a table or in any of its links */
@@ -83,12 +104,12 @@ static Symbol *
 doLookupSymbolInTable(SymbolTable *table, const char *name, int level)
 {
     Symbol *sym = NULL;
+    SymbolTable *t;
+    unsigned hash;
     if (!table) return NULL;
-    sym = FindSymbol(table, name);
-    if (!sym) {
-        if (table->next) {
-           sym = doLookupSymbolInTable(table->next, name, level);
-	}
+    hash = RawSymbolHash(name);
+    for (t = table; t && !sym; t = t->next) {
+        sym = FindSymbolHashed(t, name, hash, 0);
     }
     if (sym && IsAlias(sym)) {
         // have to look it up again
@@ -128,8 +149,8 @@ Symbol *
 FindSymbolByOffsetAndKind(SymbolTable *table, int offset, int kind)
 {
     Symbol *sym = NULL;
-    int hash;
-    for (hash = 0; hash < SYMTABLE_HASH_SIZE; hash++) {
+    unsigned hash;
+    for (hash = 0; hash < table->hashSize; hash++) {
         sym = table->hash[hash];
         while (sym) {
             if (sym->offset == offset && sym->kind == kind)
@@ -168,13 +189,42 @@ IterateOverSymbols(SymbolTable *table, SymbolFunc func, void *arg)
 /*
  * create a new symbol
  */
+Arena symbol_arena = { "symbol" };
+
 Symbol *
 NewSymbol(void)
 {
-    Symbol *sym = (Symbol *)calloc(1, sizeof(*sym));
+    Symbol *sym = (Symbol *)arena_calloc(&symbol_arena, sizeof(*sym));
     return sym;
 }
 
+/*
+ * make the table's bucket array bigger (or create it)
+ */
+static void
+GrowSymbolTable(SymbolTable *table)
+{
+    unsigned newSize = table->hashSize ? 4 * table->hashSize : SYMTABLE_INITIAL_SIZE;
+    Symbol **newHash = (Symbol **)calloc(newSize, sizeof(Symbol *));
+    Symbol **bucket;
+    Symbol *sym;
+
+    if (!newHash) {
+        fprintf(stderr, "FATAL ERROR: out of memory\n");
+        abort();
+    }
+    // re-insert in order of definition, so within each chain later
+    // definitions still come before (and hide) earlier ones
+    for (sym = table->i_first; sym; sym = sym->i_next) {
+        bucket = &newHash[sym->hash & (newSize - 1)];
+        sym->next = *bucket;
+        *bucket = sym;
+    }
+    free(table->hash);
+    table->hash = newHash;
+    table->hashSize = newSize;
+}
+
 /*
  * add a symbol to the table
  * returns NULL if there was a conflict
@@ -184,44 +234,26 @@ AddSymbol(SymbolTable *table, const char *name, int type, void *val, const char
 {
     unsigned hash;
     Symbol *sym;
-    int nocase = ((table->flags & SYMTAB_FLAG_NOCASE) != 0) && !gl_caseSensitive;
-    
-    hash = SymbolHash(name);
-    sym = table->hash[hash];
-    if (nocase) {
-        while (sym) {
-            if (!strcasecmp(sym->our_name, name)) {
-                if (sym->kind == SYM_WEAK_ALIAS) {
-                    // it's OK to override aliases
-                    break;
-                }
-                return NULL;
-            }
-            sym = sym->next;
-        }
-    } else {
-        while (sym) {
-            if (!strcmp(sym->our_name, name)) {
-                if (sym->kind == SYM_WEAK_ALIAS) {
-                    // it's OK to override aliases
-                    break;
-                }
-                return NULL;
-            }
-            sym = sym->next;
-        }
-    }
+    Symbol **bucket;
 
+    hash = RawSymbolHash(name);
+    sym = FindSymbolHashed(table, name, hash, 0);
     if (sym) {
-        // it's OK for us to override a weak alias
         if (sym->kind != SYM_WEAK_ALIAS) {
-            fprintf(stderr, "Duplicate definition for symbol `%s'\n", user_name);
+            return NULL;
         }
+        // it's OK for us to override a weak alias
+    }
+
+    if (table->count >= 2 * table->hashSize) {
+        GrowSymbolTable(table);
     }
-    
     sym = NewSymbol();
-    sym->next = table->hash[hash];
-    table->hash[hash] = sym;
+    sym->hash = hash;
+    bucket = &table->hash[hash & (table->hashSize - 1)];
+    sym->next = *bucket;
+    *bucket = sym;
+    table->count++;
     // now link into global list
     if (table->i_last) {
         table->i_last->i_next = sym;
@@ -270,6 +302,51 @@ SetTempVariableBase(int base, int max)
     return oldbase;
 }
 
+/*
+ * names handed out by NewTemporaryVariable are remembered, so that
+ * they can be told apart from user identifiers that happen to end
+ * in digits
+ */
+#define TEMPNAME_HASH_SIZE 1024
+
+struct tempname {
+    struct tempname *next;
+    const char *name;
+};
+static struct tempname *tempnames[TEMPNAME_HASH_SIZE];
+
+static void
+AddTemporaryName(const char *name)
+{
+    struct tempname *t = (struct tempname *)malloc(sizeof(*t));
+    unsigned h = RawSymbolHash(name) % TEMPNAME_HASH_SIZE;
+
+    t->name = name;
+    t->next = tempnames[h];
+    tempnames[h] = t;
+}
+
+/*
+ * if "name" ends with a name created by NewTemporaryVariable (as local
+ * variable names built from temporaries do), return a pointer to the
+ * "_nnnn" counter at its end; otherwise return NULL
+ */
+const char *
+TemporaryNameCounter(const char *name)
+{
+    const char *s;
+    struct tempname *t;
+
+    for (s = name; *s; s++) {
+        for (t = tempnames[RawSymbolHash(s) % TEMPNAME_HASH_SIZE]; t; t = t->next) {
+            if (!strcmp(t->name, s)) {
+                return strrchr(s, '_');
+            }
+        }
+    }
+    return NULL;
+}
+
 /*
  * create a temporary variable name
  */
@@ -295,6 +372,7 @@ NewTemporaryVariable(const char *prefix, int *counter)
         abort();
     }
     *counter = countval;
+    AddTemporaryName(str);
     return str;
 }
 
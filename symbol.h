@@ -2,6 +2,7 @@
 #define SYMBOL_H
 
 #include <stdint.h>
+#include "util/arena.h"
 
 
 typedef enum symtype {
@@ -47,6 +48,7 @@ typedef union {
 //
 typedef struct symbol {
     struct symbol *next;  /* next in hash table */
+    unsigned      hash;   /* RawSymbolHash(our_name) */
     const char   *user_name;   /* name given by the user */
     const char   *our_name;    /* internal compiler name */
     Symtype       kind;   /* kind of symbol */
@@ -80,8 +82,13 @@ typedef struct symbol {
 /* make this a power of two, please */
 #define SYMTABLE_HASH_SIZE 128
 
+/* tables start out this small and grow as symbols are added */
+#define SYMTABLE_INITIAL_SIZE 16
+
 typedef struct symtab {
-    Symbol *hash[SYMTABLE_HASH_SIZE];
+    Symbol **hash;        /* buckets, allocated when first needed */
+    unsigned hashSize;    /* number of buckets (a power of two) */
+    unsigned count;       /* number of symbols in the table */
     struct symtab *next;
     unsigned flags;
     Symbol *i_first;  // for iterating over symbols
@@ -89,6 +96,9 @@ typedef struct symtab {
 } SymbolTable;
 #define SYMTAB_FLAG_NOCASE 0x01  /* do case insensitive comparisons */
 
+/* all Symbol structs are allocated from here */
+extern Arena symbol_arena;
+
 unsigned RawSymbolHash(const char *str);
 unsigned SymbolHash(const char *str);
 Symbol *AddSymbol(SymbolTable *table, const char *name, int type, void *val, const char *user_name);
@@ -106,6 +116,9 @@ Symbol *AddInternalSymbol(SymbolTable *table, const char *name, int type, void *
 /* counter is an optional pointer to the counter to increment */
 char *NewTemporaryVariable(const char *prefix, int *counter);
 
+/* find the "_nnnn" counter if name ends with a temporary variable name */
+const char *TemporaryNameCounter(const char *name);
+
 /* set the number to use in temporary variables, and the max allowed */
 /* if max <= 0 then the max is left alone */
 /* returns the old base */
@@ -4,174 +4,128 @@ unsigned char sys_common_pasm_spin[] = {
   0x70, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x6f,
   0x74, 0x68, 0x20, 0x50, 0x31, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x50, 0x32,
   0x20, 0x50, 0x41, 0x53, 0x4d, 0x0a, 0x27, 0x27, 0x0a, 0x20, 0x20, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x6d, 0x6f, 0x76, 0x65,
+  0x70, 0x72, 0x69, 0x20, 0x62, 0x79, 0x74, 0x65, 0x6d, 0x6f, 0x76, 0x65,
   0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x2c, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a,
-  0x20, 0x6f, 0x72, 0x69, 0x67, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x6f,
-  0x72, 0x69, 0x67, 0x64, 0x73, 0x74, 0x20, 0x3a, 0x3d, 0x20, 0x64, 0x73,
-  0x74, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x73, 0x74, 0x20, 0x3c,
-  0x20, 0x73, 0x72, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70,
-  0x65, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x64, 0x73, 0x74,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x72,
-  0x63, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74,
-  0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x72, 0x63, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x65,
-  0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x20,
-  0x2b, 0x3d, 0x20, 0x34, 0x2a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x2a,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-  0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2d, 0x3d, 0x20,
-  0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20,
-  0x2d, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x6e, 0x67, 0x5b, 0x64, 0x73, 0x74, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x72, 0x63, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x77, 0x6f, 0x72,
-  0x64, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73,
-  0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x6c, 0x6f,
-  0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x64, 0x73,
-  0x74, 0x0a, 0x20, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x64, 0x73, 0x74, 0x20,
-  0x3a, 0x3d, 0x20, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x64, 0x73, 0x74, 0x20, 0x3c, 0x20, 0x73, 0x72, 0x63, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
-  0x64, 0x5b, 0x64, 0x73, 0x74, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f,
-  0x72, 0x64, 0x5b, 0x73, 0x72, 0x63, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2b, 0x3d, 0x20,
-  0x32, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x2a, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20,
-  0x2b, 0x3d, 0x20, 0x32, 0x2a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73,
-  0x74, 0x20, 0x2d, 0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x72, 0x63, 0x20, 0x2d, 0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x64, 0x73, 0x74,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x73, 0x72,
-  0x63, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x62, 0x79, 0x74, 0x65,
-  0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x72,
+  0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x0a, 0x20,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x62, 0x75,
+  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x6d, 0x6f, 0x76,
+  0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x2c, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65,
+  0x6d, 0x63, 0x70, 0x79, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x72,
   0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x6c, 0x6f, 0x6e,
   0x67, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
   0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65,
   0x6d, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73,
   0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x0a,
   0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
-  0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x63, 0x70, 0x79, 0x28, 0x64, 0x73, 0x74,
-  0x2c, 0x20, 0x73, 0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74,
-  0x75, 0x72, 0x6e, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
-  0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64, 0x73,
-  0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75,
-  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e,
-  0x28, 0x73, 0x74, 0x72, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x3d, 0x6c, 0x6f,
-  0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x73, 0x74,
-  0x72, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77,
-  0x68, 0x69, 0x6c, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x72, 0x5d,
-  0x20, 0x3c, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x2b,
-  0x2b, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x2d, 0x3d, 0x20, 0x73, 0x74, 0x72,
-  0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c,
-  0x74, 0x69, 0x6e, 0x5f, 0x73, 0x74, 0x72, 0x63, 0x70, 0x79, 0x28, 0x64,
-  0x73, 0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x29, 0x20, 0x3a, 0x20, 0x72,
-  0x3d, 0x40, 0x62, 0x79, 0x74, 0x65, 0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20,
-  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20,
-  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x20, 0x3a, 0x3d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x72, 0x63,
-  0x2b, 0x2b, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65,
-  0x5b, 0x64, 0x73, 0x74, 0x2b, 0x2b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x63,
-  0x0a, 0x20, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x63, 0x3d, 0x3d,
-  0x30, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6f,
-  0x6d, 0x70, 0x28, 0x73, 0x31, 0x2c, 0x20, 0x73, 0x32, 0x29, 0x20, 0x7c,
-  0x20, 0x63, 0x31, 0x2c, 0x20, 0x63, 0x32, 0x0a, 0x20, 0x20, 0x72, 0x65,
-  0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x31, 0x20,
-  0x3a, 0x3d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x31, 0x2b, 0x2b,
-  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x32, 0x20, 0x3a, 0x3d, 0x20,
-  0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x32, 0x2b, 0x2b, 0x5d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x31, 0x20, 0x3c, 0x3e,
-  0x20, 0x63, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x75, 0x6e,
-  0x74, 0x69, 0x6c, 0x20, 0x28, 0x63, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x30,
-  0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d,
-  0x31, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
-  0x75, 0x70, 0x28, 0x78, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61, 0x72, 0x72,
-  0x2c, 0x20, 0x6e, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x7c, 0x20,
-  0x69, 0x0a, 0x20, 0x20, 0x69, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x20, 0x2d,
-  0x20, 0x62, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3d,
-  0x3e, 0x20, 0x30, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x69, 0x20, 0x3c, 0x20,
-  0x6e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
-  0x6e, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x61, 0x72, 0x72, 0x5d, 0x5b,
-  0x69, 0x5d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
-  0x30, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b,
-  0x64, 0x6f, 0x77, 0x6e, 0x28, 0x78, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61,
-  0x72, 0x72, 0x2c, 0x20, 0x6e, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20,
-  0x7c, 0x20, 0x69, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
-  0x20, 0x69, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x30, 0x20, 0x74, 0x6f,
-  0x20, 0x6e, 0x2d, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x61, 0x72, 0x72, 0x5d, 0x20, 0x3d,
-  0x3d, 0x20, 0x78, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x69, 0x2b, 0x62, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x61, 0x72, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20,
+  0x6e, 0x5f, 0x73, 0x74, 0x72, 0x6c, 0x65, 0x6e, 0x28, 0x73, 0x74, 0x72,
+  0x29, 0x20, 0x3a, 0x20, 0x72, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20,
+  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x73, 0x74, 0x72, 0x0a, 0x20, 0x20,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65,
+  0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x72, 0x5d, 0x20, 0x3c, 0x3e, 0x20,
+  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x2b, 0x2b, 0x0a, 0x20, 0x20,
+  0x72, 0x20, 0x2d, 0x3d, 0x20, 0x73, 0x74, 0x72, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
+  0x73, 0x74, 0x72, 0x63, 0x70, 0x79, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20,
+  0x73, 0x72, 0x63, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x3d, 0x40, 0x62, 0x79,
+  0x74, 0x65, 0x20, 0x7c, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
+  0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x20, 0x3a, 0x3d, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x5b, 0x73, 0x72, 0x63, 0x2b, 0x2b, 0x5d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x64, 0x73, 0x74,
+  0x2b, 0x2b, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x63, 0x0a, 0x20, 0x20, 0x75,
+  0x6e, 0x74, 0x69, 0x6c, 0x20, 0x63, 0x3d, 0x3d, 0x30, 0x0a, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x73, 0x74, 0x72, 0x63, 0x6f, 0x6d, 0x70, 0x28, 0x73,
+  0x31, 0x2c, 0x20, 0x73, 0x32, 0x29, 0x20, 0x7c, 0x20, 0x63, 0x31, 0x2c,
+  0x20, 0x63, 0x32, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x31, 0x20, 0x3a, 0x3d, 0x20, 0x62,
+  0x79, 0x74, 0x65, 0x5b, 0x73, 0x31, 0x2b, 0x2b, 0x5d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x63, 0x32, 0x20, 0x3a, 0x3d, 0x20, 0x62, 0x79, 0x74, 0x65,
+  0x5b, 0x73, 0x32, 0x2b, 0x2b, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x63, 0x31, 0x20, 0x3c, 0x3e, 0x20, 0x63, 0x32, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20,
+  0x28, 0x63, 0x31, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x0a, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x75, 0x70, 0x28, 0x78,
+  0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61, 0x72, 0x72, 0x2c, 0x20, 0x6e, 0x3d,
+  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x7c, 0x20, 0x69, 0x0a, 0x20, 0x20,
+  0x69, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x20, 0x2d, 0x20, 0x62, 0x0a, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3d, 0x3e, 0x20, 0x30, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6e, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x5b, 0x61, 0x72, 0x72, 0x5d, 0x5b, 0x69, 0x5d, 0x0a, 0x20,
   0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x70,
-  0x72, 0x69, 0x20, 0x5f, 0x6c, 0x66, 0x73, 0x72, 0x5f, 0x66, 0x6f, 0x72,
-  0x77, 0x61, 0x72, 0x64, 0x28, 0x78, 0x29, 0x20, 0x7c, 0x20, 0x61, 0x0a,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3a, 0x3d, 0x20, 0x31,
-  0x0a, 0x20, 0x20, 0x61, 0x20, 0x3a, 0x3d, 0x20, 0x24, 0x38, 0x30, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x62, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
-  0x61, 0x74, 0x20, 0x33, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73,
-  0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x73, 0x74,
-  0x20, 0x78, 0x2c, 0x20, 0x61, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x20, 0x78, 0x2c, 0x20, 0x23,
-  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d,
-  0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a,
-  0x20, 0x20, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6c, 0x66, 0x73, 0x72,
-  0x5f, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x28, 0x78, 0x29,
-  0x20, 0x7c, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x78,
-  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78,
-  0x20, 0x3a, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x61, 0x20, 0x3a, 0x3d,
-  0x20, 0x24, 0x31, 0x37, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
-  0x74, 0x20, 0x33, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x6d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20,
-  0x78, 0x2c, 0x20, 0x61, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x63, 0x72, 0x20, 0x20, 0x78, 0x2c, 0x20, 0x23, 0x31,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a,
-  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a, 0x20,
-  0x20, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x67, 0x65, 0x74, 0x73,
-  0x70, 0x20, 0x7c, 0x20, 0x78, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x78, 0x2c, 0x20, 0x73,
-  0x70, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20,
-  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a, 0x0a, 0x70,
-  0x72, 0x69, 0x20, 0x5f, 0x5f, 0x74, 0x6f, 0x70, 0x6f, 0x66, 0x73, 0x74,
-  0x61, 0x63, 0x6b, 0x28, 0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x40, 0x70, 0x74, 0x72, 0x0a, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65,
-  0x61, 0x70, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x20, 0x3a, 0x20, 0x72, 0x0a,
-  0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f,
-  0x76, 0x20, 0x72, 0x2c, 0x20, 0x5f, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f,
-  0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d,
-  0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d,
-  0x65, 0x6d, 0x28, 0x61, 0x64, 0x64, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x72,
-  0x2c, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x73,
-  0x6b, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69, 0x64, 0x28,
-  0x29, 0x20, 0x2b, 0x20, 0x24, 0x31, 0x30, 0x30, 0x0a, 0x20, 0x20, 0x72,
-  0x65, 0x70, 0x65, 0x61, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73,
-  0x6d, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20,
-  0x72, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x77, 0x7a, 0x0a, 0x20,
-  0x20, 0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x20, 0x77, 0x72, 0x6c, 0x6f,
-  0x6e, 0x67, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x2c, 0x20, 0x61, 0x64, 0x64,
-  0x72, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x20, 0x72,
-  0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x2c, 0x20, 0x61, 0x64, 0x64,
-  0x72, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x20, 0x72,
-  0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x2c, 0x20, 0x61, 0x64, 0x64,
-  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d,
-  0x0a, 0x20, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x72, 0x20, 0x3d,
-  0x3d, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
-  0x5f, 0x75, 0x6e, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x61,
-  0x64, 0x64, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x6f, 0x6c, 0x64, 0x6c, 0x6f,
-  0x63, 0x6b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x61, 0x64,
-  0x64, 0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x0a
+  0x72, 0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x6f, 0x6b, 0x64, 0x6f, 0x77, 0x6e,
+  0x28, 0x78, 0x2c, 0x20, 0x62, 0x2c, 0x20, 0x61, 0x72, 0x72, 0x2c, 0x20,
+  0x6e, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x7c, 0x20, 0x69, 0x0a,
+  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x69, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x30, 0x20, 0x74, 0x6f, 0x20, 0x6e, 0x2d, 0x31,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x6e,
+  0x67, 0x5b, 0x61, 0x72, 0x72, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x78, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x69, 0x2b, 0x62, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x72,
+  0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x30, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
+  0x6c, 0x66, 0x73, 0x72, 0x5f, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
+  0x28, 0x78, 0x29, 0x20, 0x7c, 0x20, 0x61, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x78, 0x20, 0x3a, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x61,
+  0x20, 0x3a, 0x3d, 0x20, 0x24, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x62, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x33,
+  0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x78, 0x2c, 0x20,
+  0x61, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x63, 0x6c, 0x20, 0x20, 0x78, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a, 0x20, 0x20, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x6c, 0x66, 0x73, 0x72, 0x5f, 0x62, 0x61, 0x63,
+  0x6b, 0x77, 0x61, 0x72, 0x64, 0x28, 0x78, 0x29, 0x20, 0x7c, 0x20, 0x61,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x78, 0x20, 0x3d, 0x3d, 0x20,
+  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x20, 0x3a, 0x3d, 0x20,
+  0x31, 0x0a, 0x20, 0x20, 0x61, 0x20, 0x3a, 0x3d, 0x20, 0x24, 0x31, 0x37,
+  0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x33, 0x32,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x65, 0x73, 0x74, 0x20, 0x78, 0x2c, 0x20, 0x61,
+  0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x63,
+  0x72, 0x20, 0x20, 0x78, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a, 0x20, 0x20, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x5f, 0x67, 0x65, 0x74, 0x73, 0x70, 0x20, 0x7c, 0x20,
+  0x78, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x76, 0x20, 0x78, 0x2c, 0x20, 0x73, 0x70, 0x0a, 0x20, 0x20,
+  0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74,
+  0x75, 0x72, 0x6e, 0x20, 0x78, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
+  0x5f, 0x74, 0x6f, 0x70, 0x6f, 0x66, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x28,
+  0x70, 0x74, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x20, 0x40, 0x70, 0x74, 0x72, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x62,
+  0x61, 0x73, 0x65, 0x20, 0x3a, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x61, 0x73,
+  0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x72, 0x2c,
+  0x20, 0x5f, 0x5f, 0x68, 0x65, 0x61, 0x70, 0x5f, 0x70, 0x74, 0x72, 0x0a,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x6c, 0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x61,
+  0x64, 0x64, 0x72, 0x29, 0x20, 0x7c, 0x20, 0x72, 0x2c, 0x20, 0x6d, 0x61,
+  0x73, 0x6b, 0x0a, 0x20, 0x20, 0x6d, 0x61, 0x73, 0x6b, 0x20, 0x3a, 0x3d,
+  0x20, 0x5f, 0x63, 0x6f, 0x67, 0x69, 0x64, 0x28, 0x29, 0x20, 0x2b, 0x20,
+  0x24, 0x31, 0x30, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
+  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x5f, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x72, 0x2c, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x20, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x5f,
+  0x7a, 0x20, 0x20, 0x20, 0x77, 0x72, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x6d,
+  0x61, 0x73, 0x6b, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e,
+  0x67, 0x20, 0x72, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x20, 0x72, 0x64, 0x6c, 0x6f, 0x6e,
+  0x67, 0x20, 0x72, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x75,
+  0x6e, 0x74, 0x69, 0x6c, 0x20, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x6d, 0x61,
+  0x73, 0x6b, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x75, 0x6e, 0x6c,
+  0x6f, 0x63, 0x6b, 0x6d, 0x65, 0x6d, 0x28, 0x61, 0x64, 0x64, 0x72, 0x29,
+  0x20, 0x7c, 0x20, 0x6f, 0x6c, 0x64, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x61, 0x64, 0x64, 0x72, 0x5d, 0x20,
+  0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x0a
 };
-unsigned int sys_common_pasm_spin_len = 2087;
+unsigned int sys_common_pasm_spin_len = 1531;
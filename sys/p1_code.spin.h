@@ -545,477 +545,524 @@ unsigned char sys_p1_code_spin[] = {
   0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x64, 0x73,
   0x74, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x73,
   0x72, 0x63, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x6c, 0x6f, 0x6e,
-  0x67, 0x66, 0x69, 0x6c, 0x6c, 0x28, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x76,
-  0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20,
-  0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6c,
-  0x6f, 0x6e, 0x67, 0x73, 0x65, 0x74, 0x28, 0x70, 0x74, 0x72, 0x2c, 0x20,
-  0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x66, 0x69, 0x6c, 0x6c,
-  0x28, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
+  0x67, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64, 0x73, 0x74, 0x2c, 0x20, 0x73,
+  0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x6c, 0x6f,
+  0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x64, 0x73,
+  0x74, 0x0a, 0x20, 0x20, 0x6f, 0x72, 0x69, 0x67, 0x64, 0x73, 0x74, 0x20,
+  0x3a, 0x3d, 0x20, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x64, 0x73, 0x74, 0x20, 0x3c, 0x20, 0x73, 0x72, 0x63, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e,
+  0x67, 0x5b, 0x64, 0x73, 0x74, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x5b, 0x73, 0x72, 0x63, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2b, 0x3d, 0x20,
+  0x34, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x2a, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20,
+  0x2b, 0x3d, 0x20, 0x34, 0x2a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73,
+  0x74, 0x20, 0x2d, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x72, 0x63, 0x20, 0x2d, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x64, 0x73, 0x74,
+  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x72,
+  0x63, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x64,
+  0x73, 0x74, 0x2c, 0x20, 0x73, 0x72, 0x63, 0x2c, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x3d, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x6f,
+  0x72, 0x69, 0x67, 0x64, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x6f, 0x72, 0x69,
+  0x67, 0x64, 0x73, 0x74, 0x20, 0x3a, 0x3d, 0x20, 0x64, 0x73, 0x74, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x73, 0x74, 0x20, 0x3c, 0x20, 0x73,
+  0x72, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
+  0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x64, 0x73, 0x74, 0x5d, 0x20,
+  0x3a, 0x3d, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x73, 0x72, 0x63, 0x5d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2b,
+  0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72,
+  0x63, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2b, 0x3d,
+  0x20, 0x32, 0x2a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x72, 0x63, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x2a, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
   0x61, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a,
-  0x3d, 0x20, 0x76, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74,
-  0x72, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x62,
-  0x79, 0x74, 0x65, 0x66, 0x69, 0x6c, 0x6c, 0x28, 0x70, 0x74, 0x72, 0x2c,
-  0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29,
-  0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e,
-  0x5f, 0x6d, 0x65, 0x6d, 0x73, 0x65, 0x74, 0x28, 0x70, 0x74, 0x72, 0x2c,
-  0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29,
-  0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x67, 0x65, 0x74, 0x72, 0x65, 0x67,
-  0x73, 0x28, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x63, 0x6f,
-  0x67, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29,
-  0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68,
-  0x69, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3e, 0x20,
-  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x68,
-  0x75, 0x62, 0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x25, 0x72,
-  0x65, 0x67, 0x5b, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x5d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x3d,
-  0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x67, 0x70, 0x74,
-  0x72, 0x2b, 0x2b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x73, 0x65, 0x74,
-  0x72, 0x65, 0x67, 0x73, 0x28, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72, 0x2c,
-  0x20, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
-  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x20, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x25, 0x72, 0x65,
-  0x67, 0x5b, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a, 0x3d,
-  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72,
-  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72,
-  0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x67, 0x70, 0x74, 0x72, 0x2b, 0x2b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2d,
-  0x2d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x0a, 0x27, 0x27, 0x20, 0x63,
-  0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x6d, 0x65, 0x74, 0x68,
-  0x6f, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x27,
-  0x27, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x50, 0x31, 0x2c, 0x20, 0x61, 0x64,
-  0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x66, 0x69, 0x74, 0x20,
-  0x69, 0x6e, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x0a,
-  0x27, 0x27, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75,
-  0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
-  0x65, 0x72, 0x20, 0x67, 0x6f, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x74,
-  0x68, 0x65, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x20, 0x31, 0x36, 0x2c,
-  0x0a, 0x27, 0x27, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x70,
-  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f,
-  0x77, 0x65, 0x72, 0x20, 0x31, 0x36, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
-  0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64,
-  0x70, 0x74, 0x72, 0x28, 0x6f, 0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x29,
-  0x20, 0x3a, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72,
-  0x20, 0x3a, 0x3d, 0x20, 0x6f, 0x20, 0x7c, 0x20, 0x28, 0x66, 0x75, 0x6e,
-  0x63, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29, 0x0a, 0x0a, 0x70, 0x72,
-  0x69, 0x20, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x72, 0x61, 0x77, 0x66, 0x75,
-  0x6e, 0x63, 0x61, 0x64, 0x64, 0x72, 0x28, 0x6f, 0x2c, 0x20, 0x66, 0x75,
-  0x6e, 0x63, 0x29, 0x20, 0x3a, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20, 0x20,
-  0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x0a,
-  0x0a, 0x27, 0x0a, 0x27, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
-  0x61, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65,
-  0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x61,
-  0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x65, 0x20, 0x6f, 0x62,
-  0x6a, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x20, 0x61, 0x6e, 0x64, 0x0a, 0x27,
-  0x20, 0x61, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x65, 0x74, 0x6f, 0x6e, 0x20,
-  0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x75, 0x6e, 0x63,
-  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x20, 0x63,
-  0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x20,
-  0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0a, 0x27, 0x0a, 0x70, 0x75,
-  0x62, 0x20, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x69, 0x6e, 0x74, 0x65,
-  0x72, 0x66, 0x61, 0x63, 0x65, 0x70, 0x74, 0x72, 0x73, 0x28, 0x6f, 0x2c,
-  0x20, 0x73, 0x6b, 0x65, 0x6c, 0x2c, 0x20, 0x6e, 0x29, 0x20, 0x3a, 0x20,
-  0x72, 0x20, 0x7c, 0x20, 0x73, 0x69, 0x7a, 0x2c, 0x20, 0x69, 0x2c, 0x20,
-  0x70, 0x2c, 0x20, 0x66, 0x0a, 0x20, 0x20, 0x73, 0x69, 0x7a, 0x20, 0x3a,
-  0x3d, 0x20, 0x6e, 0x20, 0x2a, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x70, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
-  0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64, 0x28, 0x73, 0x69, 0x7a,
-  0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70, 0x20, 0x3d, 0x3d, 0x20,
-  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
-  0x20, 0x70, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x70, 0x0a,
-  0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69,
-  0x6c, 0x65, 0x20, 0x6e, 0x2d, 0x2d, 0x20, 0x3e, 0x20, 0x30, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x66, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x6f, 0x6e, 0x67,
-  0x5b, 0x73, 0x6b, 0x65, 0x6c, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x66, 0x20, 0x26, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x70, 0x5d, 0x20, 0x3a, 0x3d,
-  0x20, 0x72, 0x20, 0x7c, 0x20, 0x28, 0x66, 0x20, 0x26, 0x20, 0x2d, 0x32,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x70, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x6f, 0x20, 0x7c, 0x20, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x6b, 0x65, 0x6c, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x0a,
-  0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x64, 0x69, 0x76, 0x69, 0x64,
-  0x65, 0x20, 0x28, 0x6e, 0x2c, 0x20, 0x6e, 0x6c, 0x6f, 0x29, 0x20, 0x62,
-  0x79, 0x20, 0x64, 0x2c, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0x69,
-  0x6e, 0x67, 0x20, 0x71, 0x6c, 0x6f, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x72,
-  0x6c, 0x6f, 0x20, 0x28, 0x75, 0x73, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20,
-  0x46, 0x52, 0x41, 0x43, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69,
-  0x6f, 0x6e, 0x29, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
-  0x64, 0x69, 0x76, 0x36, 0x34, 0x28, 0x6e, 0x2c, 0x20, 0x6e, 0x6c, 0x6f,
-  0x2c, 0x20, 0x64, 0x6c, 0x6f, 0x29, 0x20, 0x3a, 0x20, 0x71, 0x6c, 0x6f,
-  0x2c, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x7c, 0x20, 0x71, 0x2c, 0x20, 0x72,
-  0x2c, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x64, 0x6c, 0x6f,
-  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x71, 0x6c,
-  0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x2d, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x2d, 0x31, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x6e, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x71, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x6c, 0x6f, 0x20,
-  0x2b, 0x2f, 0x20, 0x64, 0x6c, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
-  0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x6c, 0x6f, 0x20, 0x2b, 0x2f,
-  0x2f, 0x20, 0x64, 0x6c, 0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
-  0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20, 0x64, 0x20, 0x3a, 0x3d, 0x20,
-  0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20,
-  0x30, 0x0a, 0x20, 0x20, 0x71, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x71,
-  0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65,
-  0x61, 0x74, 0x20, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73,
-  0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20,
-  0x51, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20, 0x71, 0x6c, 0x6f, 0x2c,
-  0x20, 0x23, 0x31, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x71, 0x2c, 0x20, 0x23, 0x31,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x52,
-  0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20,
-  0x23, 0x31, 0x20, 0x77, 0x63, 0x20, 0x20, 0x27, 0x20, 0x72, 0x20, 0x3a,
-  0x3d, 0x20, 0x72, 0x3c, 0x3c, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x72, 0x2c, 0x20, 0x23, 0x31,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x62,
-  0x69, 0x74, 0x20, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x20, 0x67, 0x65,
-  0x74, 0x73, 0x20, 0x68, 0x69, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6f, 0x66,
-  0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x68, 0x6c, 0x20, 0x6e, 0x6c, 0x6f, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77,
-  0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x63,
-  0x6c, 0x20, 0x6e, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77, 0x63, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20,
-  0x62, 0x69, 0x74, 0x20, 0x30, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x20, 0x67,
-  0x65, 0x74, 0x73, 0x20, 0x68, 0x69, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6f,
-  0x66, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x75, 0x78, 0x63, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x23, 0x31,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x20, 0x20, 0x72,
-  0x6c, 0x6f, 0x2c, 0x20, 0x64, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x2c, 0x77,
-  0x7a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x20, 0x3c, 0x3d, 0x20, 0x64,
-  0x20, 0x28, 0x72, 0x2d, 0x64, 0x20, 0x3e, 0x3d, 0x20, 0x30, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x78,
-  0x20, 0x72, 0x2c, 0x20, 0x64, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a,
-  0x20, 0x69, 0x66, 0x5f, 0x62, 0x20, 0x20, 0x20, 0x6a, 0x6d, 0x70, 0x20,
-  0x20, 0x23, 0x7a, 0x7a, 0x5f, 0x73, 0x6b, 0x69, 0x70, 0x66, 0x72, 0x61,
-  0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75,
-  0x62, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x64, 0x6c, 0x6f, 0x20,
-  0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x75, 0x62, 0x78, 0x20, 0x72, 0x2c, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x20, 0x20, 0x20, 0x71, 0x6c,
-  0x6f, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x7a, 0x7a, 0x5f, 0x73, 0x6b, 0x69,
-  0x70, 0x66, 0x72, 0x61, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x65, 0x6e, 0x64,
-  0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x6d, 0x75,
-  0x6c, 0x64, 0x69, 0x76, 0x36, 0x34, 0x28, 0x6d, 0x75, 0x6c, 0x74, 0x31,
-  0x2c, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32, 0x2c, 0x20, 0x64, 0x69, 0x76,
-  0x69, 0x73, 0x6f, 0x72, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x7c, 0x20,
-  0x6d, 0x6c, 0x6f, 0x2c, 0x20, 0x6d, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x6d,
-  0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x31, 0x20,
-  0x2a, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32, 0x0a, 0x20, 0x20, 0x6d, 0x68,
-  0x69, 0x20, 0x3a, 0x3d, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x31, 0x20, 0x2b,
-  0x2a, 0x2a, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32, 0x0a, 0x20, 0x20, 0x72,
-  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x64, 0x69, 0x76, 0x36, 0x34, 0x28, 0x6d,
-  0x68, 0x69, 0x2c, 0x20, 0x6d, 0x6c, 0x6f, 0x2c, 0x20, 0x64, 0x69, 0x76,
-  0x69, 0x73, 0x6f, 0x72, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
-  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x73, 0x77,
-  0x61, 0x70, 0x31, 0x36, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f,
-  0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x79, 0x20, 0x3d, 0x20, 0x2b, 0x6c,
-  0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x79, 0x20, 0x3a, 0x3d, 0x20, 0x30,
-  0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x30, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x31,
-  0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x31,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b,
-  0x30, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75,
-  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x73, 0x77, 0x61, 0x70, 0x33,
-  0x32, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
-  0x20, 0x3a, 0x20, 0x79, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67,
-  0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x30, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x33,
-  0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x31,
-  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b,
-  0x32, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b,
-  0x32, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74, 0x65,
-  0x5b, 0x31, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74, 0x65,
-  0x5b, 0x33, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79, 0x74,
-  0x65, 0x5b, 0x30, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f,
-  0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x6f, 0x76, 0x62,
-  0x79, 0x74, 0x73, 0x28, 0x76, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e,
-  0x67, 0x2c, 0x20, 0x6d, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67,
-  0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e,
-  0x67, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x76, 0x2e, 0x62,
-  0x79, 0x74, 0x65, 0x5b, 0x6d, 0x26, 0x33, 0x5d, 0x0a, 0x20, 0x20, 0x72,
-  0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x31, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
-  0x76, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x28, 0x6d, 0x3e, 0x3e, 0x32,
-  0x29, 0x26, 0x33, 0x5d, 0x0a, 0x20, 0x20, 0x72, 0x2e, 0x62, 0x79, 0x74,
-  0x65, 0x5b, 0x32, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x76, 0x2e, 0x62, 0x79,
-  0x74, 0x65, 0x5b, 0x28, 0x6d, 0x3e, 0x3e, 0x34, 0x29, 0x26, 0x33, 0x5d,
-  0x0a, 0x20, 0x20, 0x72, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x33, 0x5d,
-  0x20, 0x3a, 0x3d, 0x20, 0x76, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x28,
-  0x6d, 0x3e, 0x3e, 0x36, 0x29, 0x26, 0x33, 0x5d, 0x0a, 0x0a, 0x70, 0x72,
+  0x20, 0x20, 0x20, 0x64, 0x73, 0x74, 0x20, 0x2d, 0x3d, 0x20, 0x32, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x72, 0x63, 0x20, 0x2d, 0x3d,
+  0x20, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72,
+  0x64, 0x5b, 0x64, 0x73, 0x74, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x77, 0x6f,
+  0x72, 0x64, 0x5b, 0x73, 0x72, 0x63, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x66, 0x69, 0x6c, 0x6c, 0x28, 0x70, 0x74,
+  0x72, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74,
+  0x69, 0x6e, 0x5f, 0x6c, 0x6f, 0x6e, 0x67, 0x73, 0x65, 0x74, 0x28, 0x70,
+  0x74, 0x72, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x29, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x77, 0x6f, 0x72, 0x64,
+  0x66, 0x69, 0x6c, 0x6c, 0x28, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x76, 0x61,
+  0x6c, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x5b, 0x70, 0x74,
+  0x72, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x76, 0x61, 0x6c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x32, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x62, 0x79, 0x74, 0x65, 0x66, 0x69, 0x6c, 0x6c, 0x28,
+  0x70, 0x74, 0x72, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69,
+  0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x6d, 0x73, 0x65, 0x74, 0x28,
+  0x70, 0x74, 0x72, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x2c, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x67, 0x65,
+  0x74, 0x72, 0x65, 0x67, 0x73, 0x28, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72,
+  0x2c, 0x20, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x2c, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61,
+  0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x6e, 0x67, 0x5b, 0x68, 0x75, 0x62, 0x70, 0x74, 0x72, 0x5d, 0x20, 0x3a,
+  0x3d, 0x20, 0x25, 0x72, 0x65, 0x67, 0x5b, 0x63, 0x6f, 0x67, 0x70, 0x74,
+  0x72, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x75, 0x62, 0x70, 0x74,
+  0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63,
+  0x6f, 0x67, 0x70, 0x74, 0x72, 0x2b, 0x2b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2d, 0x2d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x73, 0x65, 0x74, 0x72, 0x65, 0x67, 0x73, 0x28, 0x68, 0x75, 0x62,
+  0x70, 0x74, 0x72, 0x2c, 0x20, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x2c,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x65,
+  0x70, 0x65, 0x61, 0x74, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3e, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x25, 0x72, 0x65, 0x67, 0x5b, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72,
+  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x68, 0x75,
+  0x62, 0x70, 0x74, 0x72, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x75,
+  0x62, 0x70, 0x74, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x34, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x63, 0x6f, 0x67, 0x70, 0x74, 0x72, 0x2b, 0x2b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2d, 0x2d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x0a,
+  0x27, 0x27, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x61, 0x20,
+  0x6d, 0x65, 0x74, 0x68, 0x6f, 0x64, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x65, 0x72, 0x0a, 0x27, 0x27, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x50, 0x31,
+  0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20,
+  0x66, 0x69, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69,
+  0x74, 0x73, 0x2c, 0x0a, 0x27, 0x27, 0x20, 0x73, 0x6f, 0x20, 0x74, 0x68,
+  0x65, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x67, 0x6f, 0x65, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72,
+  0x20, 0x31, 0x36, 0x2c, 0x0a, 0x27, 0x27, 0x20, 0x6f, 0x62, 0x6a, 0x65,
+  0x63, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x69,
+  0x6e, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20, 0x31, 0x36, 0x0a, 0x0a,
+  0x70, 0x72, 0x69, 0x20, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f, 0x6d, 0x65,
+  0x74, 0x68, 0x6f, 0x64, 0x70, 0x74, 0x72, 0x28, 0x6f, 0x2c, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x29, 0x20, 0x3a, 0x20, 0x70, 0x74, 0x72, 0x0a, 0x20,
+  0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x6f, 0x20, 0x7c, 0x20,
+  0x28, 0x66, 0x75, 0x6e, 0x63, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29,
+  0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x67, 0x65, 0x74, 0x5f, 0x72,
+  0x61, 0x77, 0x66, 0x75, 0x6e, 0x63, 0x61, 0x64, 0x64, 0x72, 0x28, 0x6f,
+  0x2c, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x29, 0x20, 0x3a, 0x20, 0x70, 0x74,
+  0x72, 0x0a, 0x20, 0x20, 0x70, 0x74, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x66,
+  0x75, 0x6e, 0x63, 0x0a, 0x0a, 0x27, 0x0a, 0x27, 0x20, 0x63, 0x72, 0x65,
+  0x61, 0x74, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x20,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x61, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x69, 0x74,
+  0x65, 0x20, 0x6f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x20, 0x61,
+  0x6e, 0x64, 0x0a, 0x27, 0x20, 0x61, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x65,
+  0x74, 0x6f, 0x6e, 0x20, 0x6c, 0x69, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20,
+  0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x6b,
+  0x65, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x6e, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0a,
+  0x27, 0x0a, 0x70, 0x75, 0x62, 0x20, 0x5f, 0x6d, 0x61, 0x6b, 0x65, 0x5f,
+  0x69, 0x6e, 0x74, 0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x70, 0x74, 0x72,
+  0x73, 0x28, 0x6f, 0x2c, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x2c, 0x20, 0x6e,
+  0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x7c, 0x20, 0x73, 0x69, 0x7a, 0x2c,
+  0x20, 0x69, 0x2c, 0x20, 0x70, 0x2c, 0x20, 0x66, 0x0a, 0x20, 0x20, 0x73,
+  0x69, 0x7a, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x20, 0x2a, 0x20, 0x34, 0x0a,
+  0x20, 0x20, 0x70, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x67, 0x63, 0x5f, 0x61,
+  0x6c, 0x6c, 0x6f, 0x63, 0x5f, 0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x64,
+  0x28, 0x73, 0x69, 0x7a, 0x29, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x70,
+  0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65,
+  0x74, 0x75, 0x72, 0x6e, 0x20, 0x70, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x70, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74,
+  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6e, 0x2d, 0x2d, 0x20, 0x3e,
+  0x20, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x20, 0x3a, 0x3d, 0x20,
+  0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x73, 0x6b, 0x65, 0x6c, 0x5d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x66, 0x20, 0x26, 0x20, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x5b, 0x70,
+  0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x72, 0x20, 0x7c, 0x20, 0x28, 0x66, 0x20,
+  0x26, 0x20, 0x2d, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x6e,
+  0x67, 0x5b, 0x70, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x6f, 0x20, 0x7c, 0x20,
+  0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x2b, 0x3d, 0x20, 0x34,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6b, 0x65, 0x6c, 0x20, 0x2b, 0x3d,
+  0x20, 0x34, 0x0a, 0x0a, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x64,
+  0x69, 0x76, 0x69, 0x64, 0x65, 0x20, 0x28, 0x6e, 0x2c, 0x20, 0x6e, 0x6c,
+  0x6f, 0x29, 0x20, 0x62, 0x79, 0x20, 0x64, 0x2c, 0x20, 0x70, 0x72, 0x6f,
+  0x64, 0x75, 0x63, 0x69, 0x6e, 0x67, 0x20, 0x71, 0x6c, 0x6f, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x28, 0x75, 0x73, 0x65, 0x64,
+  0x20, 0x69, 0x6e, 0x20, 0x46, 0x52, 0x41, 0x43, 0x20, 0x6f, 0x70, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x0a, 0x27, 0x27, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x64, 0x69, 0x76, 0x36, 0x34, 0x28, 0x6e, 0x2c,
+  0x20, 0x6e, 0x6c, 0x6f, 0x2c, 0x20, 0x64, 0x6c, 0x6f, 0x29, 0x20, 0x3a,
+  0x20, 0x71, 0x6c, 0x6f, 0x2c, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x7c, 0x20,
+  0x71, 0x2c, 0x20, 0x72, 0x2c, 0x20, 0x64, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x64, 0x6c, 0x6f, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x71, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x2d, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x2d,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x6e, 0x20, 0x3d, 0x3d, 0x20, 0x30,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x71, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20,
+  0x6e, 0x6c, 0x6f, 0x20, 0x2b, 0x2f, 0x20, 0x64, 0x6c, 0x6f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x6e, 0x6c,
+  0x6f, 0x20, 0x2b, 0x2f, 0x2f, 0x20, 0x64, 0x6c, 0x6f, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x0a, 0x20, 0x20, 0x64,
+  0x20, 0x3a, 0x3d, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x71, 0x6c, 0x6f, 0x20,
+  0x3a, 0x3d, 0x20, 0x71, 0x20, 0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20,
+  0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x20, 0x36, 0x34, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x27, 0x20, 0x51, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20,
+  0x71, 0x6c, 0x6f, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77, 0x63, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x71,
+  0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x27, 0x20, 0x52, 0x20, 0x3c, 0x3c, 0x3d, 0x20, 0x31, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20, 0x72,
+  0x6c, 0x6f, 0x2c, 0x20, 0x23, 0x31, 0x20, 0x77, 0x63, 0x20, 0x20, 0x27,
+  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x72, 0x3c, 0x3c, 0x31, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x72,
+  0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x27, 0x20, 0x62, 0x69, 0x74, 0x20, 0x30, 0x20, 0x6f, 0x66, 0x20,
+  0x72, 0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x68, 0x69, 0x20, 0x62, 0x69,
+  0x74, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x68, 0x6c, 0x20, 0x6e, 0x6c, 0x6f, 0x2c, 0x20,
+  0x23, 0x31, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x6e, 0x2c, 0x20, 0x23, 0x31, 0x20,
+  0x77, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x27, 0x20, 0x62, 0x69, 0x74, 0x20, 0x30, 0x20, 0x6f, 0x66,
+  0x20, 0x72, 0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x68, 0x69, 0x20, 0x62,
+  0x69, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x75, 0x78, 0x63, 0x20, 0x72, 0x6c, 0x6f,
+  0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d,
+  0x70, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x64, 0x6c, 0x6f, 0x20,
+  0x77, 0x63, 0x2c, 0x77, 0x7a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x27, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x72, 0x20,
+  0x3c, 0x3d, 0x20, 0x64, 0x20, 0x28, 0x72, 0x2d, 0x64, 0x20, 0x3e, 0x3d,
+  0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6d, 0x70, 0x78, 0x20, 0x72, 0x2c, 0x20, 0x64, 0x20, 0x77, 0x63,
+  0x2c, 0x77, 0x7a, 0x0a, 0x20, 0x69, 0x66, 0x5f, 0x62, 0x20, 0x20, 0x20,
+  0x6a, 0x6d, 0x70, 0x20, 0x20, 0x23, 0x7a, 0x7a, 0x5f, 0x73, 0x6b, 0x69,
+  0x70, 0x66, 0x72, 0x61, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x75, 0x62, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20,
+  0x64, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x78, 0x20, 0x72, 0x2c, 0x20, 0x64,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x72, 0x20,
+  0x20, 0x20, 0x71, 0x6c, 0x6f, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x7a, 0x7a,
+  0x5f, 0x73, 0x6b, 0x69, 0x70, 0x66, 0x72, 0x61, 0x63, 0x0a, 0x20, 0x20,
+  0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x6d, 0x75, 0x6c, 0x64, 0x69, 0x76, 0x36, 0x34, 0x28, 0x6d,
+  0x75, 0x6c, 0x74, 0x31, 0x2c, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32, 0x2c,
+  0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x6f, 0x72, 0x29, 0x20, 0x3a, 0x20,
+  0x72, 0x20, 0x7c, 0x20, 0x6d, 0x6c, 0x6f, 0x2c, 0x20, 0x6d, 0x68, 0x69,
+  0x0a, 0x20, 0x20, 0x6d, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x6d, 0x75,
+  0x6c, 0x74, 0x31, 0x20, 0x2a, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32, 0x0a,
+  0x20, 0x20, 0x6d, 0x68, 0x69, 0x20, 0x3a, 0x3d, 0x20, 0x6d, 0x75, 0x6c,
+  0x74, 0x31, 0x20, 0x2b, 0x2a, 0x2a, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x32,
+  0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x64, 0x69, 0x76,
+  0x36, 0x34, 0x28, 0x6d, 0x68, 0x69, 0x2c, 0x20, 0x6d, 0x6c, 0x6f, 0x2c,
+  0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x6f, 0x72, 0x29, 0x0a, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e,
+  0x5f, 0x62, 0x73, 0x77, 0x61, 0x70, 0x31, 0x36, 0x28, 0x78, 0x20, 0x3d,
+  0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x79, 0x20,
+  0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x79, 0x20,
+  0x3a, 0x3d, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74,
+  0x65, 0x5b, 0x30, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x31, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x31, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62,
+  0x79, 0x74, 0x65, 0x5b, 0x30, 0x5d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x73,
+  0x77, 0x61, 0x70, 0x33, 0x32, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c,
+  0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x79, 0x20, 0x3d, 0x20, 0x2b,
+  0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79, 0x74,
+  0x65, 0x5b, 0x30, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x33, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x31, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e, 0x62,
+  0x79, 0x74, 0x65, 0x5b, 0x32, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e, 0x62,
+  0x79, 0x74, 0x65, 0x5b, 0x32, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78, 0x2e,
+  0x62, 0x79, 0x74, 0x65, 0x5b, 0x31, 0x5d, 0x0a, 0x20, 0x20, 0x79, 0x2e,
+  0x62, 0x79, 0x74, 0x65, 0x5b, 0x33, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x78,
+  0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x30, 0x5d, 0x0a, 0x0a, 0x70, 0x72,
   0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
-  0x6d, 0x65, 0x72, 0x67, 0x65, 0x77, 0x28, 0x76, 0x20, 0x3d, 0x20, 0x2b,
+  0x6d, 0x6f, 0x76, 0x62, 0x79, 0x74, 0x73, 0x28, 0x76, 0x20, 0x3d, 0x20,
+  0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x2c, 0x20, 0x6d, 0x20, 0x3d, 0x20, 0x2b,
   0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20,
   0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d,
-  0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62,
-  0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73,
-  0x74, 0x65, 0x70, 0x28, 0x76, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x41,
-  0x41, 0x41, 0x41, 0x2c, 0x31, 0x35, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20,
-  0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e,
-  0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65,
-  0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30,
-  0x30, 0x43, 0x43, 0x43, 0x43, 0x2c, 0x31, 0x34, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x76, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x6d, 0x26, 0x33, 0x5d,
+  0x0a, 0x20, 0x20, 0x72, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x31, 0x5d,
+  0x20, 0x3a, 0x3d, 0x20, 0x76, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x28,
+  0x6d, 0x3e, 0x3e, 0x32, 0x29, 0x26, 0x33, 0x5d, 0x0a, 0x20, 0x20, 0x72,
+  0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x32, 0x5d, 0x20, 0x3a, 0x3d, 0x20,
+  0x76, 0x2e, 0x62, 0x79, 0x74, 0x65, 0x5b, 0x28, 0x6d, 0x3e, 0x3e, 0x34,
+  0x29, 0x26, 0x33, 0x5d, 0x0a, 0x20, 0x20, 0x72, 0x2e, 0x62, 0x79, 0x74,
+  0x65, 0x5b, 0x33, 0x5d, 0x20, 0x3a, 0x3d, 0x20, 0x76, 0x2e, 0x62, 0x79,
+  0x74, 0x65, 0x5b, 0x28, 0x6d, 0x3e, 0x3e, 0x36, 0x29, 0x26, 0x33, 0x5d,
+  0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c,
+  0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x77, 0x28, 0x76,
+  0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20,
+  0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20,
   0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74,
   0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75,
-  0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30,
-  0x30, 0x30, 0x30, 0x46, 0x30, 0x46, 0x30, 0x2c, 0x31, 0x32, 0x29, 0x0a,
+  0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x2c, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x41, 0x41, 0x41, 0x41, 0x2c, 0x31, 0x35, 0x29, 0x0a,
   0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69,
   0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72,
   0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c,
-  0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x30, 0x30, 0x2c, 0x20, 0x38,
-  0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69,
-  0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x77, 0x28,
-  0x76, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a,
-  0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20,
-  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c,
-  0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d,
-  0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x2c, 0x24,
-  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x2c, 0x20, 0x31, 0x29,
-  0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75,
-  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65,
-  0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72,
-  0x2c, 0x24, 0x30, 0x43, 0x30, 0x43, 0x30, 0x43, 0x30, 0x43, 0x2c, 0x20,
-  0x32, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f,
+  0x24, 0x30, 0x30, 0x30, 0x30, 0x43, 0x43, 0x43, 0x43, 0x2c, 0x31, 0x34,
+  0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70,
+  0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28,
+  0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x30, 0x46, 0x30, 0x2c,
+  0x31, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
+  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74,
+  0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65,
+  0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x30,
+  0x30, 0x2c, 0x20, 0x38, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
+  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x77, 0x28, 0x76, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e,
+  0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f,
+  0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f,
   0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f,
   0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70,
-  0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x46, 0x30, 0x30, 0x30, 0x46, 0x30,
-  0x2c, 0x20, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20,
+  0x28, 0x76, 0x2c, 0x24, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+  0x2c, 0x20, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20,
   0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69,
   0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74,
-  0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46,
-  0x30, 0x30, 0x2c, 0x20, 0x38, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
-  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x6d, 0x65,
-  0x72, 0x67, 0x65, 0x62, 0x28, 0x76, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f,
-  0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c,
-  0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f,
-  0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74,
-  0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65,
-  0x70, 0x28, 0x76, 0x2c, 0x24, 0x30, 0x30, 0x41, 0x41, 0x30, 0x30, 0x41,
-  0x41, 0x2c, 0x20, 0x37, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d,
-  0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62,
-  0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73,
-  0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x43,
-  0x43, 0x43, 0x43, 0x2c, 0x31, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20,
+  0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x43, 0x30, 0x43, 0x30, 0x43,
+  0x30, 0x43, 0x2c, 0x20, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
+  0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f,
+  0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x46, 0x30,
+  0x30, 0x30, 0x46, 0x30, 0x2c, 0x20, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x72,
+  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
+  0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74,
+  0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30,
+  0x30, 0x30, 0x46, 0x46, 0x30, 0x30, 0x2c, 0x20, 0x38, 0x29, 0x0a, 0x0a,
+  0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
+  0x6e, 0x5f, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x62, 0x28, 0x76, 0x20, 0x3d,
+  0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20,
+  0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72, 0x20,
   0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e,
   0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65,
-  0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x46,
-  0x30, 0x30, 0x30, 0x46, 0x30, 0x2c, 0x20, 0x34, 0x29, 0x0a, 0x20, 0x20,
+  0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x2c, 0x24, 0x30, 0x30, 0x41,
+  0x41, 0x30, 0x30, 0x41, 0x41, 0x2c, 0x20, 0x37, 0x29, 0x0a, 0x20, 0x20,
   0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74,
   0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75,
   0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30,
-  0x30, 0x30, 0x30, 0x46, 0x46, 0x30, 0x30, 0x2c, 0x20, 0x38, 0x29, 0x0a,
-  0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74,
-  0x69, 0x6e, 0x5f, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x62, 0x28, 0x76, 0x20,
-  0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72,
-  0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x72,
-  0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69,
-  0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74,
-  0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x2c, 0x24, 0x30, 0x41,
-  0x30, 0x41, 0x30, 0x41, 0x30, 0x41, 0x2c, 0x20, 0x33, 0x29, 0x0a, 0x20,
-  0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c,
-  0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d,
-  0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24,
-  0x30, 0x30, 0x43, 0x43, 0x30, 0x30, 0x43, 0x43, 0x2c, 0x20, 0x36, 0x29,
+  0x30, 0x30, 0x30, 0x43, 0x43, 0x43, 0x43, 0x2c, 0x31, 0x34, 0x29, 0x0a,
+  0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69,
+  0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72,
+  0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c,
+  0x24, 0x30, 0x30, 0x46, 0x30, 0x30, 0x30, 0x46, 0x30, 0x2c, 0x20, 0x34,
+  0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70,
+  0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28,
+  0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x30, 0x30, 0x2c,
+  0x20, 0x38, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62,
+  0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x62, 0x28, 0x76, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29,
+  0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67,
   0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75,
   0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f, 0x70, 0x65,
-  0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x72,
-  0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x30, 0x46, 0x30, 0x2c, 0x31,
-  0x32, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f,
+  0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76,
+  0x2c, 0x24, 0x30, 0x41, 0x30, 0x41, 0x30, 0x41, 0x30, 0x41, 0x2c, 0x20,
+  0x33, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20, 0x5f, 0x5f,
   0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69, 0x74, 0x5f,
   0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74, 0x65, 0x70,
-  0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x30, 0x30,
-  0x2c, 0x20, 0x38, 0x29, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f,
-  0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x65, 0x75, 0x73,
-  0x73, 0x66, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67,
-  0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e,
-  0x67, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28,
-  0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x32, 0x30, 0x30, 0x5f, 0x30,
-  0x30, 0x30, 0x32, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x34, 0x29, 0x20,
-  0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28,
-  0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35, 0x29, 0x20, 0x26, 0x20,
-  0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x31, 0x30, 0x29, 0x20,
-  0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28,
-  0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x34, 0x31, 0x38, 0x30, 0x5f, 0x38,
-  0x30, 0x30, 0x30, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20, 0x20, 0x38, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x34, 0x30, 0x31, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x31, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x30, 0x29, 0x20, 0x26,
-  0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x32, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x38, 0x36, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x34, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x29, 0x20, 0x26,
-  0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x34, 0x30, 0x34, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x30, 0x30, 0x34, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x36, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x32, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x37, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26,
-  0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x34, 0x30, 0x30, 0x30, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x33, 0x29, 0x20, 0x26,
-  0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x32, 0x30, 0x30, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x31, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x30, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x30, 0x30, 0x38, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x31, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x38, 0x34, 0x30, 0x30, 0x5f,
-  0x31, 0x30, 0x39, 0x30, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20, 0x20, 0x32,
-  0x33, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20, 0x37, 0x29,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x38,
+  0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x43, 0x43, 0x30, 0x30, 0x43, 0x43,
+  0x2c, 0x20, 0x36, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a, 0x3d, 0x20,
+  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x62, 0x69,
+  0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f, 0x73, 0x74,
+  0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30, 0x46, 0x30,
+  0x46, 0x30, 0x2c, 0x31, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x72, 0x20, 0x3a,
+  0x3d, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
+  0x62, 0x69, 0x74, 0x5f, 0x70, 0x65, 0x72, 0x6d, 0x75, 0x74, 0x65, 0x5f,
+  0x73, 0x74, 0x65, 0x70, 0x28, 0x72, 0x2c, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x46, 0x46, 0x30, 0x30, 0x2c, 0x20, 0x38, 0x29, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f,
+  0x73, 0x65, 0x75, 0x73, 0x73, 0x66, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b,
+  0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20,
+  0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x28, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x32,
+  0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x32, 0x29, 0x20, 0x3c, 0x3c, 0x20,
+  0x20, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x35,
+  0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30,
+  0x31, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x34, 0x31,
+  0x38, 0x30, 0x5f, 0x38, 0x30, 0x30, 0x30, 0x29, 0x20, 0x72, 0x6f, 0x6c,
+  0x20, 0x20, 0x38, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x34, 0x30, 0x31, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32,
+  0x30, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30,
+  0x30, 0x30, 0x32, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x38, 0x36, 0x30, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x37, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30,
+  0x34, 0x30, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x34, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x36, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x32, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x37, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x34, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x34,
+  0x30, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x33, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30,
+  0x32, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x31, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x32, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x38, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x32, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x38,
+  0x34, 0x30, 0x30, 0x5f, 0x31, 0x30, 0x39, 0x30, 0x29, 0x20, 0x72, 0x6f,
+  0x6c, 0x20, 0x20, 0x32, 0x33, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e,
+  0x20, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x30, 0x30, 0x38, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e,
+  0x20, 0x20, 0x35, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x39, 0x31, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e,
+  0x20, 0x20, 0x33, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x32, 0x30, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e,
+  0x20, 0x20, 0x32, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x31,
+  0x5f, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x29, 0x20, 0x5e, 0x20, 0x24, 0x33, 0x35, 0x34,
+  0x44, 0x5f, 0x41, 0x45, 0x35, 0x31, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20,
+  0x5f, 0x5f, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x65,
+  0x75, 0x73, 0x73, 0x72, 0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f,
+  0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c,
+  0x6f, 0x6e, 0x67, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28,
+  0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x31,
+  0x5f, 0x30, 0x30, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x32,
+  0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x32, 0x30, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x33,
+  0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x39, 0x31, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x35,
+  0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30,
+  0x5f, 0x30, 0x30, 0x38, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x37,
+  0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
+  0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x34, 0x38, 0x34, 0x32,
+  0x5f, 0x30, 0x30, 0x30, 0x38, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20, 0x20,
+  0x39, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x31, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30,
+  0x38, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x30, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x31, 0x30,
   0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20, 0x35, 0x29,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x39, 0x31, 0x30,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30,
+  0x30, 0x5f, 0x30, 0x32, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31,
+  0x33, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30,
+  0x30, 0x5f, 0x34, 0x30, 0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31,
+  0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x32, 0x30,
   0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20, 0x33, 0x29,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x32, 0x30, 0x30,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30,
+  0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30,
+  0x30, 0x5f, 0x30, 0x34, 0x30, 0x34, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31,
+  0x37, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x38, 0x36,
   0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20, 0x32, 0x29,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x31, 0x5f, 0x30, 0x30, 0x30,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30,
+  0x30, 0x5f, 0x30, 0x30, 0x30, 0x32, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32,
   0x30, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x29, 0x20, 0x5e, 0x20, 0x24, 0x33, 0x35, 0x34, 0x44, 0x5f, 0x41, 0x45,
-  0x35, 0x31, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x5f, 0x62, 0x75,
-  0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x73, 0x65, 0x75, 0x73, 0x73, 0x72,
-  0x28, 0x78, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20,
-  0x3a, 0x20, 0x72, 0x20, 0x3d, 0x20, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x28, 0x78,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x31, 0x5f, 0x30, 0x30, 0x30,
-  0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x32, 0x29, 0x20, 0x7b, 0x0a,
-  0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x32, 0x30, 0x30,
-  0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x33, 0x29, 0x20, 0x7b, 0x0a,
-  0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x39, 0x31, 0x30,
-  0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x35, 0x29, 0x20, 0x7b, 0x0a,
-  0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78,
-  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x38,
-  0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x20, 0x37, 0x29, 0x20, 0x7b, 0x0a,
-  0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78,
-  0x20, 0x26, 0x20, 0x24, 0x34, 0x38, 0x34, 0x32, 0x5f, 0x30, 0x30, 0x30,
-  0x38, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20, 0x20, 0x39, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x31, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x38, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x32, 0x30, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x31, 0x30, 0x30, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x32,
-  0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x34, 0x30,
-  0x30, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x34, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x32, 0x30, 0x30, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x36, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x34, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x34,
-  0x30, 0x34, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x37, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x34, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x38, 0x36, 0x30, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x30,
-  0x30, 0x32, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x30, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x31, 0x29, 0x20, 0x26, 0x20, 0x24,
-  0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x34, 0x30, 0x31, 0x29, 0x20, 0x7b,
-  0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x28,
-  0x78, 0x20, 0x26, 0x20, 0x24, 0x38, 0x30, 0x38, 0x30, 0x5f, 0x30, 0x30,
-  0x34, 0x31, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20, 0x20, 0x32, 0x34, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f,
-  0x30, 0x30, 0x31, 0x30, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x32, 0x35, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20,
-  0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20, 0x34, 0x29, 0x20, 0x26,
-  0x20, 0x24, 0x30, 0x32, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x32, 0x29,
-  0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20,
-  0x5e, 0x20, 0x24, 0x45, 0x42, 0x35, 0x35, 0x5f, 0x30, 0x33, 0x32, 0x44,
-  0x0a, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20, 0x36, 0x34, 0x20, 0x62,
-  0x69, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
-  0x73, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x69, 0x6e,
-  0x74, 0x36, 0x34, 0x5f, 0x61, 0x64, 0x64, 0x28, 0x61, 0x6c, 0x6f, 0x2c,
-  0x20, 0x61, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x2c, 0x20, 0x62,
-  0x68, 0x69, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x72,
-  0x68, 0x69, 0x0a, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20,
-  0x61, 0x6c, 0x6f, 0x0a, 0x20, 0x20, 0x72, 0x68, 0x69, 0x20, 0x3a, 0x3d,
-  0x20, 0x61, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c,
-  0x20, 0x62, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x61, 0x64, 0x64, 0x78, 0x20, 0x72, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x68,
-  0x69, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a,
-  0x70, 0x72, 0x69, 0x20, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x73,
-  0x75, 0x62, 0x28, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c,
-  0x20, 0x62, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20, 0x3a,
-  0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x72, 0x68, 0x69, 0x0a, 0x20, 0x20,
-  0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x61, 0x6c, 0x6f, 0x0a, 0x20,
-  0x20, 0x72, 0x68, 0x69, 0x20, 0x3a, 0x3d, 0x20, 0x61, 0x68, 0x69, 0x0a,
-  0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75,
-  0x62, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x20,
-  0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x62, 0x78, 0x20,
-  0x72, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x65,
-  0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x27, 0x20, 0x63, 0x6f, 0x6d,
-  0x70, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65,
-  0x64, 0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20,
-  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x2c, 0x20, 0x30,
-  0x2c, 0x20, 0x6f, 0x72, 0x20, 0x2b, 0x31, 0x0a, 0x70, 0x72, 0x69, 0x20,
-  0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x63, 0x6d, 0x70, 0x75, 0x28,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x31, 0x29,
+  0x20, 0x26, 0x20, 0x24, 0x30, 0x30, 0x30, 0x30, 0x5f, 0x30, 0x34, 0x30,
+  0x31, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x38, 0x30, 0x38,
+  0x30, 0x5f, 0x30, 0x30, 0x34, 0x31, 0x29, 0x20, 0x72, 0x6f, 0x6c, 0x20,
+  0x20, 0x32, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x26, 0x20, 0x24, 0x30,
+  0x30, 0x30, 0x30, 0x5f, 0x30, 0x30, 0x31, 0x30, 0x29, 0x20, 0x3c, 0x3c,
+  0x20, 0x32, 0x35, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x20,
+  0x34, 0x29, 0x20, 0x26, 0x20, 0x24, 0x30, 0x32, 0x30, 0x30, 0x5f, 0x30,
+  0x30, 0x30, 0x32, 0x29, 0x20, 0x7b, 0x0a, 0x7d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x29, 0x20, 0x5e, 0x20, 0x24, 0x45, 0x42, 0x35, 0x35, 0x5f,
+  0x30, 0x33, 0x32, 0x44, 0x0a, 0x0a, 0x27, 0x27, 0x0a, 0x27, 0x27, 0x20,
+  0x36, 0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x27, 0x27, 0x0a, 0x70, 0x72, 0x69,
+  0x20, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x61, 0x64, 0x64, 0x28,
   0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x6c,
-  0x6f, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x0a,
-  0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x63, 0x6d, 0x70, 0x20, 0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x6c,
-  0x6f, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x6d, 0x70, 0x78, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20,
-  0x62, 0x68, 0x69, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a, 0x69, 0x66,
-  0x5f, 0x7a, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x72, 0x2c, 0x20,
-  0x23, 0x30, 0x0a, 0x69, 0x66, 0x5f, 0x6e, 0x7a, 0x20, 0x6e, 0x65, 0x67,
-  0x63, 0x20, 0x72, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x65, 0x6e,
-  0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x0a, 0x27, 0x20, 0x63, 0x6f,
-  0x6d, 0x70, 0x61, 0x72, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64,
-  0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x2c, 0x20, 0x30, 0x2c,
-  0x20, 0x6f, 0x72, 0x20, 0x2b, 0x31, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f,
-  0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x63, 0x6d, 0x70, 0x73, 0x28, 0x61,
-  0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x6c, 0x6f,
-  0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x0a, 0x20,
-  0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6d, 0x70, 0x20, 0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x6c, 0x6f,
-  0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x63, 0x6d, 0x70, 0x73, 0x78, 0x20, 0x61, 0x68, 0x69, 0x2c, 0x20,
-  0x62, 0x68, 0x69, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a, 0x69, 0x66,
-  0x5f, 0x7a, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20, 0x20, 0x72, 0x2c, 0x20,
-  0x23, 0x30, 0x0a, 0x69, 0x66, 0x5f, 0x6e, 0x7a, 0x20, 0x6e, 0x65, 0x67,
-  0x63, 0x20, 0x72, 0x2c, 0x20, 0x23, 0x31, 0x0a, 0x20, 0x20, 0x65, 0x6e,
-  0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x66, 0x69,
+  0x6f, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x6c,
+  0x6f, 0x2c, 0x20, 0x72, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x72, 0x6c, 0x6f,
+  0x20, 0x3a, 0x3d, 0x20, 0x61, 0x6c, 0x6f, 0x0a, 0x20, 0x20, 0x72, 0x68,
+  0x69, 0x20, 0x3a, 0x3d, 0x20, 0x61, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x61,
+  0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x20, 0x20,
+  0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x61, 0x64, 0x64, 0x78, 0x20, 0x72, 0x68, 0x69,
+  0x2c, 0x20, 0x62, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61,
+  0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x5f, 0x69, 0x6e, 0x74,
+  0x36, 0x34, 0x5f, 0x73, 0x75, 0x62, 0x28, 0x61, 0x6c, 0x6f, 0x2c, 0x20,
+  0x61, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x68,
+  0x69, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20, 0x72, 0x68,
+  0x69, 0x0a, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x20, 0x3a, 0x3d, 0x20, 0x61,
+  0x6c, 0x6f, 0x0a, 0x20, 0x20, 0x72, 0x68, 0x69, 0x20, 0x3a, 0x3d, 0x20,
+  0x61, 0x68, 0x69, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x75, 0x62, 0x20, 0x20, 0x72, 0x6c, 0x6f, 0x2c, 0x20,
+  0x62, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x75, 0x62, 0x78, 0x20, 0x72, 0x68, 0x69, 0x2c, 0x20, 0x62, 0x68, 0x69,
+  0x0a, 0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x27,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x20, 0x75, 0x6e, 0x73,
+  0x69, 0x67, 0x6e, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61,
+  0x68, 0x69, 0x2c, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d,
+  0x31, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x2b, 0x31, 0x0a,
+  0x70, 0x72, 0x69, 0x20, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x63,
+  0x6d, 0x70, 0x75, 0x28, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69,
+  0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20,
+  0x3a, 0x20, 0x72, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x20, 0x20, 0x61, 0x6c, 0x6f,
+  0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x78, 0x20, 0x61,
+  0x68, 0x69, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x20, 0x77, 0x63, 0x2c, 0x77,
+  0x7a, 0x0a, 0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x72, 0x2c, 0x20, 0x23, 0x30, 0x0a, 0x69, 0x66, 0x5f, 0x6e, 0x7a,
+  0x20, 0x6e, 0x65, 0x67, 0x63, 0x20, 0x72, 0x2c, 0x20, 0x23, 0x31, 0x0a,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x0a,
+  0x27, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x20, 0x73, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68,
+  0x69, 0x2c, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x6f, 0x72, 0x20, 0x2b, 0x31, 0x0a, 0x70,
+  0x72, 0x69, 0x20, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x63, 0x6d,
+  0x70, 0x73, 0x28, 0x61, 0x6c, 0x6f, 0x2c, 0x20, 0x61, 0x68, 0x69, 0x2c,
+  0x20, 0x62, 0x6c, 0x6f, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x29, 0x20, 0x3a,
+  0x20, 0x72, 0x0a, 0x20, 0x20, 0x61, 0x73, 0x6d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x20, 0x20, 0x61, 0x6c, 0x6f, 0x2c,
+  0x20, 0x62, 0x6c, 0x6f, 0x20, 0x77, 0x63, 0x2c, 0x77, 0x7a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6d, 0x70, 0x73, 0x78, 0x20, 0x61,
+  0x68, 0x69, 0x2c, 0x20, 0x62, 0x68, 0x69, 0x20, 0x77, 0x63, 0x2c, 0x77,
+  0x7a, 0x0a, 0x69, 0x66, 0x5f, 0x7a, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x20,
+  0x20, 0x72, 0x2c, 0x20, 0x23, 0x30, 0x0a, 0x69, 0x66, 0x5f, 0x6e, 0x7a,
+  0x20, 0x6e, 0x65, 0x67, 0x63, 0x20, 0x72, 0x2c, 0x20, 0x23, 0x31, 0x0a,
+  0x20, 0x20, 0x65, 0x6e, 0x64, 0x61, 0x73, 0x6d, 0x0a, 0x0a, 0x70, 0x72,
+  0x69, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x73,
+  0x79, 0x73, 0x2f, 0x70, 0x31, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2e,
+  0x63, 0x22, 0x20, 0x20, 0x20, 0x5f, 0x71, 0x65, 0x78, 0x70, 0x28, 0x6e,
+  0x3d, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x3d,
+  0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x66, 0x69,
   0x6c, 0x65, 0x20, 0x22, 0x6c, 0x69, 0x62, 0x73, 0x79, 0x73, 0x2f, 0x70,
   0x31, 0x5f, 0x75, 0x74, 0x69, 0x6c, 0x73, 0x2e, 0x63, 0x22, 0x20, 0x20,
-  0x20, 0x5f, 0x71, 0x65, 0x78, 0x70, 0x28, 0x6e, 0x3d, 0x2b, 0x6c, 0x6f,
+  0x20, 0x5f, 0x71, 0x6c, 0x6f, 0x67, 0x28, 0x6e, 0x3d, 0x2b, 0x6c, 0x6f,
   0x6e, 0x67, 0x29, 0x20, 0x3a, 0x20, 0x72, 0x3d, 0x2b, 0x6c, 0x6f, 0x6e,
-  0x67, 0x0a, 0x70, 0x72, 0x69, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x20, 0x22,
-  0x6c, 0x69, 0x62, 0x73, 0x79, 0x73, 0x2f, 0x70, 0x31, 0x5f, 0x75, 0x74,
-  0x69, 0x6c, 0x73, 0x2e, 0x63, 0x22, 0x20, 0x20, 0x20, 0x5f, 0x71, 0x6c,
-  0x6f, 0x67, 0x28, 0x6e, 0x3d, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x29, 0x20,
-  0x3a, 0x20, 0x72, 0x3d, 0x2b, 0x6c, 0x6f, 0x6e, 0x67, 0x0a
+  0x67, 0x0a
 };
-unsigned int sys_p1_code_spin_len = 12214;
+unsigned int sys_p1_code_spin_len = 12770;
@@ -0,0 +1,149 @@
+/*
+ * Simple bump-pointer memory arenas.
+ * MIT Licensed; see terms at the end of this file.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include "arena.h"
+
+/* big enough that the C library will usually hand the blocks
+   back to the OS when they are released */
+#define DEFAULT_BLOCKSIZE (256*1024)
+#define ARENA_ALIGN 8
+
+struct arena_block {
+    struct arena_block *prev;
+    size_t size;
+    size_t used;
+    /* data follows */
+};
+
+#define BLOCK_HDR_SIZE ((sizeof(struct arena_block) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN-1))
+#define BLOCK_DATA(b) ((char *)(b) + BLOCK_HDR_SIZE)
+
+void arena_init(struct arena *A, const char *name, size_t blocksize)
+{
+    memset(A, 0, sizeof(*A));
+    A->name = name;
+    A->blocksize = blocksize ? blocksize : DEFAULT_BLOCKSIZE;
+}
+
+static struct arena_block *
+arena_newblock(struct arena *A, size_t minsize)
+{
+    struct arena_block *b;
+    size_t size = A->blocksize ? A->blocksize : DEFAULT_BLOCKSIZE;
+
+    if (size < minsize) {
+        size = minsize;
+    }
+    b = (struct arena_block *)malloc(BLOCK_HDR_SIZE + size);
+    if (!b) {
+        fprintf(stderr, "FATAL ERROR: out of memory\n");
+        abort();
+    }
+    b->prev = A->cur;
+    b->size = size;
+    b->used = 0;
+    A->cur = b;
+    A->bytes_reserved += size;
+    if (A->bytes_reserved > A->peak_reserved) {
+        A->peak_reserved = A->bytes_reserved;
+    }
+    return b;
+}
+
+void *arena_alloc(struct arena *A, size_t size)
+{
+    struct arena_block *b = A->cur;
+    void *r;
+
+    size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN-1);
+    if (!b || b->used + size > b->size) {
+        b = arena_newblock(A, size);
+    }
+    r = BLOCK_DATA(b) + b->used;
+    b->used += size;
+    A->num_allocs++;
+    A->bytes_alloced += size;
+    return r;
+}
+
+void *arena_calloc(struct arena *A, size_t size)
+{
+    void *r = arena_alloc(A, size);
+    memset(r, 0, size);
+    return r;
+}
+
+void *arena_memdup(struct arena *A, const void *src, size_t N)
+{
+    void *r = arena_alloc(A, N);
+    memcpy(r, src, N);
+    return r;
+}
+
+void arena_mark(struct arena *A, ArenaMark *mark)
+{
+    mark->block = A->cur;
+    mark->used = A->cur ? A->cur->used : 0;
+}
+
+void arena_release(struct arena *A, ArenaMark *mark)
+{
+    struct arena_block *b;
+
+    while (A->cur && A->cur != mark->block) {
+        b = A->cur;
+        A->cur = b->prev;
+        A->bytes_reserved -= b->size;
+        A->bytes_released += b->used;
+        free(b);
+    }
+    if (A->cur) {
+        A->bytes_released += A->cur->used - mark->used;
+        A->cur->used = mark->used;
+    }
+}
+
+void arena_free(struct arena *A)
+{
+    ArenaMark empty = { NULL, 0 };
+    arena_release(A, &empty);
+}
+
+void arena_print_stats(FILE *f, struct arena *A)
+{
+    fprintf(f, "  %-10s %10lu allocs %12lu bytes  %12lu peak reserved  %12lu released\n",
+            A->name ? A->name : "(arena)",
+            (unsigned long)A->num_allocs,
+            (unsigned long)A->bytes_alloced,
+            (unsigned long)A->peak_reserved,
+            (unsigned long)A->bytes_released);
+}
+
+/*
+ * +--------------------------------------------------------------------
+ * ¦  TERMS OF USE: MIT License
+ * +--------------------------------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * +--------------------------------------------------------------------
+ */
@@ -0,0 +1,62 @@
+/*
+ * Simple bump-pointer memory arenas.
+ * Objects are carved out of large blocks and are never freed
+ * individually; instead everything allocated after a given
+ * mark may be released at once.
+ * MIT Licensed; see terms in arena.c
+ */
+
+#ifndef ARENA_H_
+#define ARENA_H_
+
+#include <stdio.h>
+#include <string.h>
+
+struct arena_block;
+
+struct arena {
+    const char *name;            /* for statistics */
+    struct arena_block *cur;     /* block currently being filled */
+    size_t blocksize;            /* default size for new blocks */
+
+    /* statistics */
+    size_t num_allocs;           /* total number of allocations */
+    size_t bytes_alloced;        /* total bytes handed out */
+    size_t bytes_reserved;       /* bytes currently held in blocks */
+    size_t peak_reserved;        /* maximum value of bytes_reserved */
+    size_t bytes_released;       /* total bytes given back by arena_release */
+};
+
+typedef struct arena Arena;
+
+/* a position in an arena, to which it may later be released */
+typedef struct arena_mark {
+    struct arena_block *block;
+    size_t used;
+} ArenaMark;
+
+/* initialize an arena; blocksize 0 picks a default */
+void arena_init(struct arena *A, const char *name, size_t blocksize);
+
+/* allocate memory (uninitialized) */
+void *arena_alloc(struct arena *A, size_t size);
+
+/* allocate zeroed memory */
+void *arena_calloc(struct arena *A, size_t size);
+
+/* copy N bytes into the arena */
+void *arena_memdup(struct arena *A, const void *src, size_t N);
+
+/* remember the current position */
+void arena_mark(struct arena *A, ArenaMark *mark);
+
+/* free everything allocated since "mark" was taken */
+void arena_release(struct arena *A, ArenaMark *mark);
+
+/* free everything in the arena */
+void arena_free(struct arena *A);
+
+/* print allocation statistics */
+void arena_print_stats(FILE *f, struct arena *A);
+
+#endif
@@ -16,6 +16,12 @@
 //#define DEFAULT_GROWSIZE BUFSIZ
 #define DEFAULT_GROWSIZE 65536
 
+/* buffers double in size when they fill up (but never grow by less
+ * than growsize, or by more than MAX_GROWSIZE at once), so building
+ * a large buffer a piece at a time takes linear time
+ */
+#define MAX_GROWSIZE (64*1024*1024)
+
 void flexbuf_init(struct flexbuf *fb, size_t growsize)
 {
     fb->data = NULL;
@@ -29,17 +35,54 @@ size_t flexbuf_curlen(struct flexbuf *fb)
     return fb->len;
 }
 
+/* set the space of a buffer to newspace bytes */
+static char *flexbuf_resize(struct flexbuf *fb, size_t newspace)
+{
+    char *newdata;
+    newdata = (char *)realloc(fb->data, newspace);
+    if (!newdata) return newdata;
+    fb->space = newspace;
+    fb->data = newdata;
+    return newdata;
+}
+
+/* make room for the buffer to hold newlen bytes */
+static char *flexbuf_grow(struct flexbuf *fb, size_t newlen)
+{
+    size_t grow = fb->space;
+    size_t newspace;
+
+    if (grow > MAX_GROWSIZE) {
+        grow = MAX_GROWSIZE;
+    }
+    if (grow < fb->growsize) {
+        grow = fb->growsize;
+    }
+    newspace = fb->space + grow;
+    if (newspace < newlen) {
+        newspace = newlen + fb->growsize;
+    }
+    return flexbuf_resize(fb, newspace);
+}
+
+/* make sure N more bytes can be added without reallocating */
+char *flexbuf_reserve(struct flexbuf *fb, size_t N)
+{
+    size_t newlen = fb->len + N;
+
+    if (newlen > fb->space) {
+        return flexbuf_resize(fb, newlen);
+    }
+    return fb->data;
+}
+
 /* add a single character to a buffer */
 char *flexbuf_addchar(struct flexbuf *fb, int c)
 {
     size_t newlen = fb->len + 1;
 
     if (newlen > fb->space) {
-        char *newdata;
-        newdata = (char *)realloc(fb->data, fb->space + fb->growsize);
-        if (!newdata) return newdata;
-        fb->space += fb->growsize;
-        fb->data = newdata;
+        if (!flexbuf_grow(fb, newlen)) return NULL;
     }
     fb->data[fb->len] = c;
     fb->len = newlen;
@@ -52,16 +95,7 @@ char *flexbuf_addmem(struct flexbuf *fb, const char *buf, size_t N)
     size_t newlen = fb->len + N;
 
     if (newlen > fb->space) {
-        char *newdata;
-        size_t newspace;
-        newspace = fb->space + fb->growsize;
-        if (newspace < newlen) {
-            newspace = newlen + fb->growsize;
-        }
-        newdata = (char *)realloc(fb->data, newspace);
-        if (!newdata) return newdata;
-        fb->space = newspace;
-        fb->data = newdata;
+        if (!flexbuf_grow(fb, newlen)) return NULL;
     }
     memcpy(fb->data + fb->len, buf, N);
     fb->len = newlen;
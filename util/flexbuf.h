@@ -30,6 +30,10 @@ char *flexbuf_addchar(struct flexbuf *fb, int c);
 /* add N characters to a buffer */
 char *flexbuf_addmem(struct flexbuf *fb, const char *buf, size_t N);
 
+/* make sure N more bytes can be added without reallocating */
+/* (a size hint for callers that know roughly how much they will add) */
+char *flexbuf_reserve(struct flexbuf *fb, size_t N);
+
 /* add a string to a buffer */
 char *flexbuf_addstr(struct flexbuf *fb, const char *str);
 
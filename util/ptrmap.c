@@ -0,0 +1,146 @@
+/*
+ * Small open addressing hash tables from pointers (or C strings)
+ * to integers.
+ * MIT Licensed; see terms at the end of this file.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ptrmap.h"
+
+#define MIN_SIZE 64
+
+static unsigned
+ptrmap_hash(PtrMap *M, const void *key)
+{
+    uintptr_t h;
+    if (M->strkeys) {
+        const unsigned char *s = (const unsigned char *)key;
+        h = 2166136261U;
+        while (*s) {
+            h = (h ^ *s++) * 16777619U;
+        }
+    } else {
+        h = (uintptr_t)key;
+        h ^= h >> 7;
+        h *= 0x9e3779b1U;
+    }
+    return (unsigned)h & (M->size - 1);
+}
+
+/* find the slot holding key, or the empty slot where it would go */
+static unsigned
+ptrmap_slot(PtrMap *M, const void *key)
+{
+    unsigned i = ptrmap_hash(M, key);
+    if (M->strkeys) {
+        while (M->key[i] && strcmp((const char *)M->key[i], (const char *)key) != 0) {
+            i = (i + 1) & (M->size - 1);
+        }
+    } else {
+        while (M->key[i] && M->key[i] != key) {
+            i = (i + 1) & (M->size - 1);
+        }
+    }
+    return i;
+}
+
+static void
+ptrmap_grow(PtrMap *M)
+{
+    const void **oldkey = M->key;
+    intptr_t *oldval = M->val;
+    unsigned oldsize = M->size;
+    unsigned i, j;
+
+    M->size = oldsize ? 2*oldsize : MIN_SIZE;
+    M->key = (const void **)calloc(M->size, sizeof(M->key[0]));
+    M->val = (intptr_t *)calloc(M->size, sizeof(M->val[0]));
+    if (!M->key || !M->val) {
+        fprintf(stderr, "FATAL ERROR: out of memory\n");
+        abort();
+    }
+    for (i = 0; i < oldsize; i++) {
+        if (oldkey[i]) {
+            j = ptrmap_slot(M, oldkey[i]);
+            M->key[j] = oldkey[i];
+            M->val[j] = oldval[i];
+        }
+    }
+    free(oldkey);
+    free(oldval);
+}
+
+int ptrmap_find(PtrMap *M, const void *key, intptr_t *val)
+{
+    unsigned i;
+    if (!key || !M->count) {
+        return 0;
+    }
+    i = ptrmap_slot(M, key);
+    if (!M->key[i]) {
+        return 0;
+    }
+    *val = M->val[i];
+    return 1;
+}
+
+int ptrmap_add(PtrMap *M, const void *key, intptr_t val)
+{
+    unsigned i;
+    /* keep the table at most half full */
+    if (2*(M->count+1) > M->size) {
+        ptrmap_grow(M);
+    }
+    i = ptrmap_slot(M, key);
+    if (M->key[i]) {
+        return 0;
+    }
+    M->key[i] = key;
+    M->val[i] = val;
+    M->count++;
+    return 1;
+}
+
+void ptrmap_clear(PtrMap *M)
+{
+    if (M->count) {
+        memset(M->key, 0, M->size * sizeof(M->key[0]));
+        M->count = 0;
+    }
+}
+
+void ptrmap_free(PtrMap *M)
+{
+    free(M->key);
+    free(M->val);
+    M->key = NULL;
+    M->val = NULL;
+    M->size = M->count = 0;
+}
+
+/*
+ * +--------------------------------------------------------------------
+ * ¦  TERMS OF USE: MIT License
+ * +--------------------------------------------------------------------
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software,
+ * and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+ * CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * +--------------------------------------------------------------------
+ */
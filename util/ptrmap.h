@@ -0,0 +1,38 @@
+/*
+ * Small open addressing hash tables from pointers (or C strings)
+ * to integers.
+ * MIT Licensed; see terms in ptrmap.c
+ */
+
+#ifndef PTRMAP_H_
+#define PTRMAP_H_
+
+#include <stdint.h>
+
+/*
+ * a table set to all zeros is empty and ready to use; NULL may
+ * not be used as a key
+ */
+struct ptrmap {
+    const void **key;
+    intptr_t *val;
+    unsigned size;               /* always 0 or a power of 2 */
+    unsigned count;
+    int strkeys;                 /* keys are C strings, compared by contents */
+};
+
+typedef struct ptrmap PtrMap;
+
+/* look up key; returns 1 and sets *val if it is present, 0 if not */
+int ptrmap_find(PtrMap *M, const void *key, intptr_t *val);
+
+/* add key; returns 0 (leaving the old value) if it is already present */
+int ptrmap_add(PtrMap *M, const void *key, intptr_t val);
+
+/* remove all keys, but keep the memory for re-use */
+void ptrmap_clear(PtrMap *M);
+
+/* free the memory used by the table, leaving it empty */
+void ptrmap_free(PtrMap *M);
+
+#endif